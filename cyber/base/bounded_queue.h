@@ -50,6 +50,8 @@ class BoundedQueue {
   bool WaitEnqueue(T&& element);
   bool Dequeue(T* element);
   bool WaitDequeue(T* element);
+  uint64_t EnqueueBatch(const T* elements, uint64_t num);
+  uint64_t DequeueBatch(T* elements, uint64_t num);
   uint64_t Size();
   bool Empty();
   void SetWaitStrategy(WaitStrategy* WaitStrategy);
@@ -166,6 +168,59 @@ bool BoundedQueue<T>::Dequeue(T* element) {
   return true;
 }
 
+// Reserves up to num slots with a single tail CAS and publishes them with
+// a single commit round-trip, so a burst costs one synchronization
+// exchange instead of one per element. Returns the number of elements
+// actually enqueued, 0 when the queue is full.
+template <typename T>
+uint64_t BoundedQueue<T>::EnqueueBatch(const T* elements, uint64_t num) {
+  uint64_t count = 0;
+  uint64_t old_tail = tail_.load(std::memory_order_acquire);
+  do {
+    uint64_t head = head_.load(std::memory_order_acquire);
+    uint64_t free_slots = pool_size_ - 1 - (old_tail - head);
+    count = std::min(num, free_slots);
+    if (count == 0) {
+      return 0;
+    }
+  } while (!tail_.compare_exchange_weak(old_tail, old_tail + count,
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_relaxed));
+  for (uint64_t i = 0; i < count; ++i) {
+    pool_[GetIndex(old_tail + i)] = elements[i];
+  }
+  uint64_t old_commit = 0;
+  do {
+    old_commit = old_tail;
+  } while (cyber_unlikely(!commit_.compare_exchange_weak(
+      old_commit, old_tail + count, std::memory_order_acq_rel,
+      std::memory_order_relaxed)));
+  wait_strategy_->NotifyOne();
+  return count;
+}
+
+// Drains up to num committed elements with a single head CAS. Returns the
+// number of elements dequeued, 0 when the queue is empty.
+template <typename T>
+uint64_t BoundedQueue<T>::DequeueBatch(T* elements, uint64_t num) {
+  uint64_t count = 0;
+  uint64_t old_head = head_.load(std::memory_order_acquire);
+  do {
+    uint64_t commit = commit_.load(std::memory_order_acquire);
+    uint64_t available = commit - old_head - 1;
+    count = std::min(num, available);
+    if (count == 0) {
+      return 0;
+    }
+    for (uint64_t i = 0; i < count; ++i) {
+      elements[i] = pool_[GetIndex(old_head + 1 + i)];
+    }
+  } while (!head_.compare_exchange_weak(old_head, old_head + count,
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_relaxed));
+  return count;
+}
+
 template <typename T>
 bool BoundedQueue<T>::WaitEnqueue(const T& element) {
   while (!break_all_wait_) {
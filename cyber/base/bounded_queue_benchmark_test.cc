@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/bounded_queue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+namespace {
+
+const int kProducerNum = 4;
+const int kItemsPerProducer = 1 << 14;
+const int kBatchSize = 32;
+
+// Runs kProducerNum producers against one consumer and returns the wall
+// time in milliseconds. Producers and the consumer use the batch API when
+// batch is true, the single-element API otherwise.
+int64_t RunThroughput(bool batch) {
+  BoundedQueue<int> queue;
+  queue.Init(8192);
+  std::atomic<uint64_t> consumed = {0};
+  const uint64_t total =
+      static_cast<uint64_t>(kProducerNum) * kItemsPerProducer;
+
+  auto start = std::chrono::steady_clock::now();
+  std::thread producers[kProducerNum];
+  for (int i = 0; i < kProducerNum; ++i) {
+    producers[i] = std::thread([&queue, batch]() {
+      int buffer[kBatchSize];
+      for (int j = 0; j < kBatchSize; ++j) {
+        buffer[j] = j;
+      }
+      if (batch) {
+        int remain = kItemsPerProducer;
+        while (remain > 0) {
+          uint64_t num = queue.EnqueueBatch(
+              buffer, std::min(remain, kBatchSize));
+          remain -= static_cast<int>(num);
+          if (num == 0) {
+            std::this_thread::yield();
+          }
+        }
+      } else {
+        for (int j = 0; j < kItemsPerProducer; ++j) {
+          while (!queue.Enqueue(j)) {
+            std::this_thread::yield();
+          }
+        }
+      }
+    });
+  }
+  std::thread consumer([&queue, &consumed, batch, total]() {
+    int buffer[kBatchSize];
+    while (consumed.load(std::memory_order_relaxed) < total) {
+      if (batch) {
+        uint64_t num = queue.DequeueBatch(buffer, kBatchSize);
+        if (num == 0) {
+          std::this_thread::yield();
+        } else {
+          consumed.fetch_add(num, std::memory_order_relaxed);
+        }
+      } else {
+        int value = 0;
+        if (queue.Dequeue(&value)) {
+          consumed.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    }
+  });
+  for (int i = 0; i < kProducerNum; ++i) {
+    producers[i].join();
+  }
+  consumer.join();
+  auto end = std::chrono::steady_clock::now();
+
+  EXPECT_EQ(total, consumed.load());
+  EXPECT_TRUE(queue.Empty());
+  return std::chrono::duration_cast<std::chrono::milliseconds>(end - start)
+      .count();
+}
+
+}  // namespace
+
+TEST(BoundedQueueBenchmarkTest, multi_producer_throughput) {
+  auto single_ms = RunThroughput(false);
+  auto batch_ms = RunThroughput(true);
+  std::cout << kProducerNum << " producers, "
+            << kProducerNum * kItemsPerProducer << " items: single "
+            << single_ms << " ms, batch(" << kBatchSize << ") " << batch_ms
+            << " ms" << std::endl;
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
@@ -47,6 +47,46 @@ TEST(BoundedQueueTest, Dequeue) {
   EXPECT_FALSE(queue.Dequeue(&value));
 }
 
+TEST(BoundedQueueTest, EnqueueBatch) {
+  BoundedQueue<int> queue;
+  queue.Init(100);
+  int batch[64];
+  for (int i = 0; i < 64; i++) {
+    batch[i] = i;
+  }
+  EXPECT_EQ(64, queue.EnqueueBatch(batch, 64));
+  EXPECT_EQ(64, queue.Size());
+  // only the remaining free slots are taken
+  EXPECT_EQ(36, queue.EnqueueBatch(batch, 64));
+  EXPECT_EQ(100, queue.Size());
+  EXPECT_EQ(0, queue.EnqueueBatch(batch, 64));
+
+  int value = 0;
+  for (int i = 0; i < 64; i++) {
+    EXPECT_TRUE(queue.Dequeue(&value));
+    EXPECT_EQ(i, value);
+  }
+}
+
+TEST(BoundedQueueTest, DequeueBatch) {
+  BoundedQueue<int> queue;
+  queue.Init(100);
+  int out[64];
+  EXPECT_EQ(0, queue.DequeueBatch(out, 64));
+  for (int i = 0; i < 100; i++) {
+    EXPECT_TRUE(queue.Enqueue(i));
+  }
+  EXPECT_EQ(64, queue.DequeueBatch(out, 64));
+  for (int i = 0; i < 64; i++) {
+    EXPECT_EQ(i, out[i]);
+  }
+  EXPECT_EQ(36, queue.DequeueBatch(out, 64));
+  for (int i = 0; i < 36; i++) {
+    EXPECT_EQ(64 + i, out[i]);
+  }
+  EXPECT_TRUE(queue.Empty());
+}
+
 TEST(BoundedQueueTest, concurrency) {
   BoundedQueue<int> queue;
   queue.Init(10);
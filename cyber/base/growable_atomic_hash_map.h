@@ -0,0 +1,420 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_GROWABLE_ATOMIC_HASH_MAP_H_
+#define CYBER_BASE_GROWABLE_ATOMIC_HASH_MAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cyber/base/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+/**
+ * @brief A resizable lock-free hash map with epoch-based reclamation
+ *
+ * Drop-in compatible with the Get/Set API of AtomicHashMap, but the table
+ * grows automatically when the average bucket length exceeds two, so long
+ * Entry walks do not appear when the key set outgrows the initial size.
+ * Readers and writers pin an epoch slot around each operation; resizing
+ * freezes the old table, waits for pinned operations to drain, relinks the
+ * entries into a table of twice the capacity and frees the old one. Values
+ * replaced by Set() are retired and freed once no pinned operation can
+ * still observe them, instead of being deleted while readers may hold
+ * them.
+ *
+ * @tparam K Type of key, must be integral
+ * @tparam V Type of value
+ * @tparam 128 Initial size of hash table, must be power of two
+ * @tparam 0 Type traits, use for checking types of key & value
+ */
+template <typename K, typename V, std::size_t InitTableSize = 128,
+          typename std::enable_if<std::is_integral<K>::value &&
+                                      (InitTableSize & (InitTableSize - 1)) ==
+                                          0,
+                                  int>::type = 0>
+class GrowableAtomicHashMap {
+ public:
+  GrowableAtomicHashMap() : table_(new Table(InitTableSize)) {}
+  GrowableAtomicHashMap(const GrowableAtomicHashMap &other) = delete;
+  GrowableAtomicHashMap &operator=(const GrowableAtomicHashMap &other) =
+      delete;
+
+  ~GrowableAtomicHashMap() {
+    for (auto &item : retired_values_) {
+      delete item.first;
+    }
+    for (auto &item : retired_tables_) {
+      delete item.first;
+    }
+    delete table_.load(std::memory_order_acquire);
+  }
+
+  bool Has(K key) {
+    V *val = nullptr;
+    return Get(key, &val);
+  }
+
+  bool Get(K key, V **value) {
+    uint32_t slot = 0;
+    Table *table = AcquireTable(&slot);
+    Entry *prev = nullptr;
+    Entry *target = nullptr;
+    bool res = Find(BucketOf(table, key), key, &prev, &target);
+    if (res) {
+      *value = target->value_ptr.load(std::memory_order_acquire);
+    }
+    Unpin(slot);
+    return res;
+  }
+
+  bool Get(K key, V *value) {
+    uint32_t slot = 0;
+    Table *table = AcquireTable(&slot);
+    Entry *prev = nullptr;
+    Entry *target = nullptr;
+    bool res = Find(BucketOf(table, key), key, &prev, &target);
+    if (res) {
+      *value = *target->value_ptr.load(std::memory_order_acquire);
+    }
+    Unpin(slot);
+    return res;
+  }
+
+  void Set(K key) {
+    SetInternal(key, [] { return new V(); });
+  }
+
+  void Set(K key, const V &value) {
+    SetInternal(key, [&value] { return new V(value); });
+  }
+
+  void Set(K key, V &&value) {
+    SetInternal(key, [&value] { return new V(std::forward<V>(value)); });
+  }
+
+  uint64_t Size() const { return size_.load(std::memory_order_relaxed); }
+  uint64_t Capacity() const {
+    return table_.load(std::memory_order_acquire)->capacity;
+  }
+
+ private:
+  struct Entry {
+    Entry() {}
+    K key = 0;
+    std::atomic<V *> value_ptr = {nullptr};
+    std::atomic<Entry *> next = {nullptr};
+  };
+
+  struct Bucket {
+    Bucket() : head_(new Entry()) {}
+    ~Bucket() {
+      Entry *ite = head_;
+      while (ite) {
+        auto tmp = ite->next.load(std::memory_order_acquire);
+        delete ite->value_ptr.load(std::memory_order_acquire);
+        ite->value_ptr.store(nullptr, std::memory_order_relaxed);
+        delete ite;
+        ite = tmp;
+      }
+    }
+    Entry *head_;
+  };
+
+  struct Table {
+    explicit Table(uint64_t cap)
+        : capacity(cap), mode_num(cap - 1), buckets(new Bucket[cap]) {}
+    ~Table() { delete[] buckets; }
+    uint64_t capacity;
+    uint64_t mode_num;
+    Bucket *buckets;
+    std::atomic<bool> frozen = {false};
+  };
+
+  static const uint64_t kQuiescent = 0;
+  static const uint32_t kEpochSlots = 128;  // must be power of two
+  static const uint64_t kGrowLoadFactor = 2;
+
+  struct alignas(CACHELINE_SIZE) EpochSlot {
+    std::atomic<uint64_t> epoch = {kQuiescent};
+  };
+
+  static uint32_t ThreadIndex() {
+    static std::atomic<uint32_t> counter = {0};
+    static thread_local uint32_t index =
+        counter.fetch_add(1, std::memory_order_relaxed);
+    return index & (kEpochSlots - 1);
+  }
+
+  // Claims an epoch slot and stamps it with the current global epoch. A
+  // resizer or reclaimer only frees memory retired before every pinned
+  // slot's epoch, so memory observed after pinning stays valid until
+  // Unpin().
+  uint32_t Pin() {
+    const uint32_t start = ThreadIndex();
+    while (true) {
+      for (uint32_t i = 0; i < kEpochSlots; ++i) {
+        uint32_t slot = (start + i) & (kEpochSlots - 1);
+        uint64_t expected = kQuiescent;
+        if (epoch_slots_[slot].epoch.compare_exchange_strong(
+                expected, global_epoch_.load(std::memory_order_seq_cst),
+                std::memory_order_seq_cst, std::memory_order_relaxed)) {
+          return slot;
+        }
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  void Unpin(uint32_t slot) {
+    epoch_slots_[slot].epoch.store(kQuiescent, std::memory_order_release);
+  }
+
+  // Pins and returns the current table, retrying while a resize is in
+  // flight; the caller must Unpin(*slot) when done with the table.
+  Table *AcquireTable(uint32_t *slot) {
+    while (true) {
+      *slot = Pin();
+      Table *table = table_.load(std::memory_order_seq_cst);
+      if (!table->frozen.load(std::memory_order_seq_cst)) {
+        return table;
+      }
+      Unpin(*slot);
+      std::this_thread::yield();
+    }
+  }
+
+  static Bucket *BucketOf(Table *table, K key) {
+    return &table->buckets[static_cast<uint64_t>(key) & table->mode_num];
+  }
+
+  bool Find(Bucket *bucket, K key, Entry **prev_ptr, Entry **target_ptr) {
+    Entry *prev = bucket->head_;
+    Entry *m_target = bucket->head_->next.load(std::memory_order_acquire);
+    while (Entry *target = m_target) {
+      if (target->key == key) {
+        *prev_ptr = prev;
+        *target_ptr = target;
+        return true;
+      } else if (target->key > key) {
+        *prev_ptr = prev;
+        *target_ptr = target;
+        return false;
+      } else {
+        prev = target;
+        m_target = target->next.load(std::memory_order_acquire);
+      }
+    }
+    *prev_ptr = prev;
+    *target_ptr = nullptr;
+    return false;
+  }
+
+  template <typename MakeValue>
+  void SetInternal(K key, MakeValue &&make_value) {
+    uint32_t slot = 0;
+    Table *table = AcquireTable(&slot);
+    bool inserted = Insert(BucketOf(table, key), key, make_value);
+    // Grow while still pinned: the pin keeps the table from being freed
+    // between the size check and the freeze CAS.
+    if (inserted &&
+        size_.fetch_add(1, std::memory_order_relaxed) + 1 >
+            table->capacity * kGrowLoadFactor) {
+      Grow(table, slot);
+    }
+    Unpin(slot);
+    TryReclaim();
+  }
+
+  // Inserts a new entry or replaces the value of an existing one.
+  // Returns true when a new key was inserted.
+  template <typename MakeValue>
+  bool Insert(Bucket *bucket, K key, MakeValue &&make_value) {
+    Entry *prev = nullptr;
+    Entry *target = nullptr;
+    Entry *new_entry = nullptr;
+    V *new_value = nullptr;
+    while (true) {
+      if (Find(bucket, key, &prev, &target)) {
+        // key exists, update value
+        if (!new_value) {
+          new_value = make_value();
+        }
+        auto old_val_ptr = target->value_ptr.load(std::memory_order_acquire);
+        if (target->value_ptr.compare_exchange_strong(
+                old_val_ptr, new_value, std::memory_order_acq_rel,
+                std::memory_order_relaxed)) {
+          Retire(old_val_ptr);
+          if (new_entry) {
+            // new_value now lives in the map; free only the spare entry
+            delete new_entry;
+          }
+          return false;
+        }
+        continue;
+      } else {
+        if (!new_entry) {
+          new_entry = new Entry();
+          new_entry->key = key;
+          if (!new_value) {
+            new_value = make_value();
+          }
+          new_entry->value_ptr.store(new_value, std::memory_order_release);
+        }
+        new_entry->next.store(target, std::memory_order_release);
+        if (prev->next.compare_exchange_strong(target, new_entry,
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_relaxed)) {
+          return true;
+        }
+        // another entry has been inserted, retry
+      }
+    }
+  }
+
+  // Retires a replaced value; it is freed by TryReclaim() once every
+  // operation pinned at the time of retirement has finished.
+  void Retire(V *value) {
+    uint64_t epoch = global_epoch_.fetch_add(1, std::memory_order_seq_cst);
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    retired_values_.emplace_back(value, epoch);
+  }
+
+  void TryReclaim() {
+    std::unique_lock<std::mutex> lock(retired_mutex_, std::try_to_lock);
+    if (!lock.owns_lock() || retired_values_.empty()) {
+      return;
+    }
+    uint64_t min_pinned = MinPinnedEpoch();
+    auto ite = retired_values_.begin();
+    while (ite != retired_values_.end()) {
+      if (ite->second < min_pinned) {
+        delete ite->first;
+        ite = retired_values_.erase(ite);
+      } else {
+        ++ite;
+      }
+    }
+    auto table_ite = retired_tables_.begin();
+    while (table_ite != retired_tables_.end()) {
+      if (table_ite->second < min_pinned) {
+        delete table_ite->first;
+        table_ite = retired_tables_.erase(table_ite);
+      } else {
+        ++table_ite;
+      }
+    }
+  }
+
+  uint64_t MinPinnedEpoch() const {
+    uint64_t min_pinned = global_epoch_.load(std::memory_order_seq_cst);
+    for (uint32_t i = 0; i < kEpochSlots; ++i) {
+      uint64_t epoch = epoch_slots_[i].epoch.load(std::memory_order_acquire);
+      if (epoch != kQuiescent && epoch < min_pinned) {
+        min_pinned = epoch;
+      }
+    }
+    return min_pinned;
+  }
+
+  void WaitForQuiescence(uint64_t target, uint32_t skip_slot) {
+    for (uint32_t i = 0; i < kEpochSlots; ++i) {
+      if (i == skip_slot) {
+        continue;
+      }
+      while (true) {
+        uint64_t epoch = epoch_slots_[i].epoch.load(std::memory_order_seq_cst);
+        if (epoch == kQuiescent || epoch >= target) {
+          break;
+        }
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  // Doubles the table. The old table is frozen first, so operations that
+  // pin afterwards retry on the new table; once the ones pinned before
+  // the freeze have drained, the entries are relinked (not copied - value
+  // pointers handed out by Get() stay stable) and the old bucket shells
+  // are retired. The caller stays pinned on self_slot throughout, which
+  // keeps the old table alive across the freeze CAS and is skipped by the
+  // quiescence wait.
+  void Grow(Table *expected, uint32_t self_slot) {
+    if (table_.load(std::memory_order_seq_cst) != expected) {
+      return;  // another grower already replaced the table
+    }
+    bool frozen = false;
+    if (!expected->frozen.compare_exchange_strong(
+            frozen, true, std::memory_order_seq_cst)) {
+      return;  // a grow is already in flight
+    }
+    uint64_t target =
+        global_epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+    WaitForQuiescence(target, self_slot);
+
+    auto *new_table = new Table(expected->capacity * 2);
+    for (uint64_t i = 0; i < expected->capacity; ++i) {
+      Entry *entry = expected->buckets[i].head_->next.load(
+          std::memory_order_relaxed);
+      expected->buckets[i].head_->next.store(nullptr,
+                                             std::memory_order_relaxed);
+      // an ascending bucket splits into two ascending buckets, so a tail
+      // append keeps the order Find() relies on
+      Entry *tail_low = new_table->buckets[i].head_;
+      Entry *tail_high = new_table->buckets[i + expected->capacity].head_;
+      while (entry != nullptr) {
+        Entry *next = entry->next.load(std::memory_order_relaxed);
+        entry->next.store(nullptr, std::memory_order_relaxed);
+        if ((static_cast<uint64_t>(entry->key) & new_table->mode_num) == i) {
+          tail_low->next.store(entry, std::memory_order_relaxed);
+          tail_low = entry;
+        } else {
+          tail_high->next.store(entry, std::memory_order_relaxed);
+          tail_high = entry;
+        }
+        entry = next;
+      }
+    }
+    table_.store(new_table, std::memory_order_seq_cst);
+    // operations pinned before the swap may still hold the old pointer,
+    // so the shells go through the epoch retire list like values do
+    uint64_t epoch = global_epoch_.fetch_add(1, std::memory_order_seq_cst);
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    retired_tables_.emplace_back(expected, epoch);
+  }
+
+  std::atomic<Table *> table_;
+  std::atomic<uint64_t> size_ = {0};
+  std::atomic<uint64_t> global_epoch_ = {1};
+  EpochSlot epoch_slots_[kEpochSlots];
+  std::mutex retired_mutex_;
+  std::vector<std::pair<V *, uint64_t>> retired_values_;
+  std::vector<std::pair<Table *, uint64_t>> retired_tables_;
+};
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_GROWABLE_ATOMIC_HASH_MAP_H_
@@ -0,0 +1,169 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/base/growable_atomic_hash_map.h"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "gtest/gtest.h"
+
+#include "cyber/base/atomic_hash_map.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+TEST(GrowableAtomicHashMapTest, int_int) {
+  GrowableAtomicHashMap<int, int> map;
+  int value = 0;
+  for (int i = 0; i < 1000; i++) {
+    map.Set(i, i);
+    EXPECT_TRUE(map.Has(i));
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(i, value);
+  }
+
+  for (int i = 0; i < 1000; i++) {
+    map.Set(1000 - i, i);
+    EXPECT_TRUE(map.Has(1000 - i));
+    EXPECT_TRUE(map.Get(1000 - i, &value));
+    EXPECT_EQ(i, value);
+  }
+}
+
+TEST(GrowableAtomicHashMapTest, int_str) {
+  GrowableAtomicHashMap<int, std::string> map;
+  std::string value("");
+  for (int i = 0; i < 1000; i++) {
+    map.Set(i, std::to_string(i));
+    EXPECT_TRUE(map.Has(i));
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(std::to_string(i), value);
+  }
+  map.Set(100);
+  EXPECT_TRUE(map.Get(100, &value));
+  EXPECT_TRUE(value.empty());
+  map.Set(100, std::move(std::string("test")));
+  EXPECT_TRUE(map.Get(100, &value));
+  EXPECT_EQ("test", value);
+}
+
+TEST(GrowableAtomicHashMapTest, growth) {
+  GrowableAtomicHashMap<int, int, 4> map;
+  EXPECT_EQ(4u, map.Capacity());
+  int value = 0;
+  for (int i = 0; i < 100000; i++) {
+    map.Set(i, i);
+  }
+  EXPECT_EQ(100000u, map.Size());
+  EXPECT_GE(map.Capacity() * 2, map.Size());
+  for (int i = 0; i < 100000; i++) {
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(i, value);
+  }
+}
+
+TEST(GrowableAtomicHashMapTest, concurrency) {
+  GrowableAtomicHashMap<int, std::string, 128> map;
+  int thread_num = 32;
+  std::thread t[32];
+  volatile bool ready = false;
+
+  for (int i = 0; i < thread_num; i++) {
+    t[i] = std::thread([&, i]() {
+      while (!ready) {
+#if defined(__aarch64__)
+        asm volatile("yield" ::: "memory");
+#else
+        asm volatile("rep; nop" ::: "memory");
+#endif
+      }
+      for (int j = 0; j < thread_num * 1024; j++) {
+        auto j_str = std::to_string(j);
+        map.Set(j);
+        map.Set(j, j_str);
+        map.Set(j, std::move(std::to_string(j)));
+        std::string read_back;
+        map.Get(j, &read_back);
+      }
+    });
+  }
+  ready = true;
+  for (int i = 0; i < thread_num; i++) {
+    t[i].join();
+  }
+
+  std::string value("");
+  for (int i = 1; i < thread_num * 1000; i++) {
+    EXPECT_TRUE(map.Get(i, &value));
+    EXPECT_EQ(std::to_string(i), value);
+  }
+  std::string* str = nullptr;
+  EXPECT_TRUE(map.Get(0, &str));
+  EXPECT_EQ("0", *str);
+}
+
+// Compares the growable map against the fixed-size AtomicHashMap at a key
+// count that overflows the fixed table's default 128 buckets three
+// orders of magnitude, where its bucket walks go quadratic. Sized to
+// stay inside a "medium" test budget; the gap widens with the key count.
+TEST(GrowableAtomicHashMapTest, benchmark_vs_fixed) {
+  const int kKeyNum = 1 << 17;
+  const int kThreadNum = 4;
+  auto* fixed_map = new AtomicHashMap<int, int>();
+  auto* growable_map = new GrowableAtomicHashMap<int, int>();
+
+  auto run = [kKeyNum, kThreadNum](auto* map) {
+    std::thread t[kThreadNum];
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kThreadNum; i++) {
+      t[i] = std::thread([map, i, kKeyNum, kThreadNum]() {
+        for (int j = i; j < kKeyNum; j += kThreadNum) {
+          map->Set(j, j);
+        }
+        int value = 0;
+        for (int j = i; j < kKeyNum; j += kThreadNum) {
+          map->Get(j, &value);
+        }
+      });
+    }
+    for (int i = 0; i < kThreadNum; i++) {
+      t[i].join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - start)
+        .count();
+  };
+
+  auto growable_ms = run(growable_map);
+  auto fixed_ms = run(fixed_map);
+  std::cout << "growable map: " << growable_ms << " ms, fixed map: "
+            << fixed_ms << " ms, " << kKeyNum << " keys, " << kThreadNum
+            << " threads" << std::endl;
+
+  int value = 0;
+  EXPECT_TRUE(growable_map->Get(kKeyNum - 1, &value));
+  EXPECT_EQ(kKeyNum - 1, value);
+
+  delete growable_map;
+  delete fixed_map;
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
@@ -17,7 +17,10 @@
 #ifndef CYBER_BASE_MACROS_H_
 #define CYBER_BASE_MACROS_H_
 
+#include <sys/mman.h>
+
 #include <cstdlib>
+#include <cstring>
 #include <new>
 
 #if __GNUC__ >= 3
@@ -72,4 +75,53 @@ inline void* CheckedCalloc(size_t num, size_t size) {
   return ptr;
 }
 
+#define HUGE_PAGE_SIZE (2ul * 1024 * 1024)
+
+// System-wide switch for backing large long-lived regions (shm segments,
+// object pool arenas, blob host memory) with 2MB huge pages. Off by
+// default; set CYBER_HUGE_PAGES=1 to opt in.
+inline bool HugePagesEnabled() {
+  static const bool enabled = [] {
+    const char* val = std::getenv("CYBER_HUGE_PAGES");
+    return val != nullptr && val[0] == '1';
+  }();
+  return enabled;
+}
+
+// Tries a 2MB-aligned allocation advised to the kernel as a
+// transparent-huge-page candidate. Returns nullptr when huge pages are
+// disabled, the request is smaller than one huge page, or the allocation
+// fails; the advice itself is best effort, the kernel may still use 4KB
+// pages. The pointer is released with std::free.
+inline void* HugePageAlloc(size_t size) {
+  if (!HugePagesEnabled() || size < HUGE_PAGE_SIZE) {
+    return nullptr;
+  }
+  const size_t rounded = (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+  void* ptr = nullptr;
+  if (posix_memalign(&ptr, HUGE_PAGE_SIZE, rounded) != 0) {
+    return nullptr;
+  }
+  madvise(ptr, rounded, MADV_HUGEPAGE);
+  return ptr;
+}
+
+inline void* CheckedHugeMalloc(size_t size) {
+  void* ptr = HugePageAlloc(size);
+  if (ptr) {
+    return ptr;
+  }
+  return CheckedMalloc(size);
+}
+
+inline void* CheckedHugeCalloc(size_t num, size_t size) {
+  const size_t total = num * size;
+  void* ptr = HugePageAlloc(total);
+  if (ptr) {
+    std::memset(ptr, 0, total);
+    return ptr;
+  }
+  return CheckedCalloc(num, size);
+}
+
 #endif  // CYBER_BASE_MACROS_H_
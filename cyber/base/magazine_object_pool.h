@@ -0,0 +1,268 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_BASE_MAGAZINE_OBJECT_POOL_H_
+#define CYBER_BASE_MAGAZINE_OBJECT_POOL_H_
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "cyber/base/for_each.h"
+#include "cyber/base/macros.h"
+
+namespace apollo {
+namespace cyber {
+namespace base {
+
+/**
+ * @brief A concurrent object pool with per-thread magazines
+ *
+ * Same GetObject/ConstructObject API as CCObjectPool, but each thread
+ * serves allocations from a small private magazine and only touches the
+ * shared lock-free free list when its magazine runs empty (refilled in
+ * one batched pop) or full (flushed in one batched push). Cross-thread
+ * cache-line traffic therefore happens once per kMagazineSize/2
+ * operations instead of on every GetObject/ReleaseObject.
+ */
+template <typename T>
+class MagazineObjectPool
+    : public std::enable_shared_from_this<MagazineObjectPool<T>> {
+ public:
+  explicit MagazineObjectPool(uint32_t size);
+  virtual ~MagazineObjectPool();
+
+  template <typename... Args>
+  void ConstructAll(Args &&... args);
+
+  template <typename... Args>
+  std::shared_ptr<T> ConstructObject(Args &&... args);
+
+  std::shared_ptr<T> GetObject();
+  void ReleaseObject(T *);
+
+ private:
+  struct Node {
+    T object;
+    Node *next;
+  };
+
+  struct alignas(2 * sizeof(Node *)) Head {
+    uintptr_t count;
+    Node *node;
+  };
+
+  static const uint32_t kMagazineSize = 32;
+  static const uint32_t kMagazineSlots = 64;  // must be power of two
+
+  // One magazine per thread slot. The flag only arbitrates the rare case
+  // of two threads hashing to the same slot; the owner takes it
+  // uncontended.
+  struct alignas(CACHELINE_SIZE) Magazine {
+    std::atomic_flag lock = ATOMIC_FLAG_INIT;
+    uint32_t count = 0;
+    Node *items[kMagazineSize];
+  };
+
+  MagazineObjectPool(MagazineObjectPool &) = delete;
+  MagazineObjectPool &operator=(MagazineObjectPool &) = delete;
+
+  static uint32_t ThreadSlot() {
+    static std::atomic<uint32_t> counter = {0};
+    static thread_local uint32_t slot =
+        counter.fetch_add(1, std::memory_order_relaxed);
+    return slot & (kMagazineSlots - 1);
+  }
+
+  Node *AcquireNode();
+  bool PopOne(Node **node);
+  uint32_t PopBatch(uint32_t num, Node **nodes);
+  void PushOne(Node *node);
+  void PushBatch(Node **nodes, uint32_t num);
+
+  std::atomic<Head> free_head_;
+  Magazine magazines_[kMagazineSlots];
+  Node *node_arena_ = nullptr;
+  uint32_t capacity_ = 0;
+};
+
+template <typename T>
+MagazineObjectPool<T>::MagazineObjectPool(uint32_t size) : capacity_(size) {
+  node_arena_ =
+      static_cast<Node *>(CheckedHugeCalloc(capacity_, sizeof(Node)));
+  FOR_EACH(i, 0, capacity_ - 1) { node_arena_[i].next = node_arena_ + 1 + i; }
+  node_arena_[capacity_ - 1].next = nullptr;
+  free_head_.store({0, node_arena_}, std::memory_order_relaxed);
+}
+
+template <typename T>
+MagazineObjectPool<T>::~MagazineObjectPool() {
+  std::free(node_arena_);
+}
+
+template <typename T>
+template <typename... Args>
+void MagazineObjectPool<T>::ConstructAll(Args &&... args) {
+  FOR_EACH(i, 0, capacity_) {
+    new (node_arena_ + i) T(std::forward<Args>(args)...);
+  }
+}
+
+template <typename T>
+bool MagazineObjectPool<T>::PopOne(Node **node) {
+  Head new_head;
+  Head old_head = free_head_.load(std::memory_order_acquire);
+  do {
+    if (cyber_unlikely(old_head.node == nullptr)) {
+      return false;
+    }
+    new_head.node = old_head.node->next;
+    new_head.count = old_head.count + 1;
+  } while (!free_head_.compare_exchange_weak(old_head, new_head,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire));
+  *node = old_head.node;
+  return true;
+}
+
+// Pops up to num nodes from the shared free list with one CAS. The walk
+// over next pointers may race with concurrent pops, but any interleaved
+// operation bumps the head tag and fails the CAS, so a stale walk is
+// simply retried; all nodes live in the arena, so the walk never touches
+// unmapped memory.
+template <typename T>
+uint32_t MagazineObjectPool<T>::PopBatch(uint32_t num, Node **nodes) {
+  Head new_head;
+  uint32_t count = 0;
+  Head old_head = free_head_.load(std::memory_order_acquire);
+  do {
+    if (cyber_unlikely(old_head.node == nullptr)) {
+      return 0;
+    }
+    Node *node = old_head.node;
+    count = 0;
+    while (node != nullptr && count < num) {
+      nodes[count++] = node;
+      node = node->next;
+    }
+    new_head.node = node;
+    new_head.count = old_head.count + 1;
+  } while (!free_head_.compare_exchange_weak(old_head, new_head,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire));
+  return count;
+}
+
+template <typename T>
+void MagazineObjectPool<T>::PushOne(Node *node) {
+  Head new_head;
+  Head old_head = free_head_.load(std::memory_order_acquire);
+  do {
+    node->next = old_head.node;
+    new_head.node = node;
+    new_head.count = old_head.count + 1;
+  } while (!free_head_.compare_exchange_weak(old_head, new_head,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire));
+}
+
+// Links num nodes into a chain and pushes the whole chain with one CAS.
+template <typename T>
+void MagazineObjectPool<T>::PushBatch(Node **nodes, uint32_t num) {
+  for (uint32_t i = 0; i + 1 < num; ++i) {
+    nodes[i]->next = nodes[i + 1];
+  }
+  Head new_head;
+  Head old_head = free_head_.load(std::memory_order_acquire);
+  do {
+    nodes[num - 1]->next = old_head.node;
+    new_head.node = nodes[0];
+    new_head.count = old_head.count + 1;
+  } while (!free_head_.compare_exchange_weak(old_head, new_head,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire));
+}
+
+template <typename T>
+typename MagazineObjectPool<T>::Node *MagazineObjectPool<T>::AcquireNode() {
+  Node *node = nullptr;
+  Magazine &mag = magazines_[ThreadSlot()];
+  if (cyber_likely(!mag.lock.test_and_set(std::memory_order_acquire))) {
+    if (mag.count == 0) {
+      mag.count = PopBatch(kMagazineSize / 2, mag.items);
+    }
+    if (mag.count > 0) {
+      node = mag.items[--mag.count];
+    }
+    mag.lock.clear(std::memory_order_release);
+  }
+  if (cyber_unlikely(node == nullptr)) {
+    // slot busy or pool drained, go straight to the shared list
+    PopOne(&node);
+  }
+  return node;
+}
+
+template <typename T>
+std::shared_ptr<T> MagazineObjectPool<T>::GetObject() {
+  Node *node = AcquireNode();
+  if (cyber_unlikely(node == nullptr)) {
+    return nullptr;
+  }
+  auto self = this->shared_from_this();
+  return std::shared_ptr<T>(reinterpret_cast<T *>(node),
+                            [self](T *object) { self->ReleaseObject(object); });
+}
+
+template <typename T>
+template <typename... Args>
+std::shared_ptr<T> MagazineObjectPool<T>::ConstructObject(Args &&... args) {
+  Node *node = AcquireNode();
+  if (cyber_unlikely(node == nullptr)) {
+    return nullptr;
+  }
+  auto self = this->shared_from_this();
+  T *ptr = new (node) T(std::forward<Args>(args)...);
+  return std::shared_ptr<T>(ptr, [self](T *object) {
+    object->~T();
+    self->ReleaseObject(object);
+  });
+}
+
+template <typename T>
+void MagazineObjectPool<T>::ReleaseObject(T *object) {
+  Node *node = reinterpret_cast<Node *>(object);
+  Magazine &mag = magazines_[ThreadSlot()];
+  if (cyber_likely(!mag.lock.test_and_set(std::memory_order_acquire))) {
+    if (mag.count == kMagazineSize) {
+      // flush half of the magazine back to the depot in one push
+      PushBatch(mag.items + kMagazineSize / 2, kMagazineSize / 2);
+      mag.count = kMagazineSize / 2;
+    }
+    mag.items[mag.count++] = node;
+    mag.lock.clear(std::memory_order_release);
+    return;
+  }
+  PushOne(node);
+}
+
+}  // namespace base
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_BASE_MAGAZINE_OBJECT_POOL_H_
@@ -17,11 +17,12 @@
 #ifndef CYBER_BASE_SIGNAL_H_
 #define CYBER_BASE_SIGNAL_H_
 
-#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 namespace apollo {
 namespace cyber {
@@ -39,27 +40,24 @@ class Signal {
   using Callback = std::function<void(Args...)>;
   using SlotPtr = std::shared_ptr<Slot<Args...>>;
   using SlotList = std::list<SlotPtr>;
+  using SnapshotPtr = std::shared_ptr<const std::vector<SlotPtr>>;
   using ConnectionType = Connection<Args...>;
 
   Signal() {}
   virtual ~Signal() { DisconnectAllSlots(); }
 
+  // Emitting walks an immutable snapshot of the slot list, so the hot path
+  // takes no lock and performs no allocation. Connect/Disconnect rebuild the
+  // snapshot under the mutex and publish it atomically; an in-flight emit
+  // keeps the old snapshot alive and skips freshly disconnected slots via
+  // the per-slot connected flag.
   void operator()(Args... args) {
-    SlotList local;
-    {
-      std::lock_guard<std::mutex> lock(mutex_);
-      for (auto& slot : slots_) {
-        local.emplace_back(slot);
-      }
-    }
-
-    if (!local.empty()) {
-      for (auto& slot : local) {
+    auto local = std::atomic_load_explicit(&snapshot_, std::memory_order_acquire);
+    if (local != nullptr) {
+      for (auto& slot : *local) {
         (*slot)(args...);
       }
     }
-
-    ClearDisconnectedSlots();
   }
 
   ConnectionType Connect(const Callback& cb) {
@@ -67,6 +65,7 @@ class Signal {
     {
       std::lock_guard<std::mutex> lock(mutex_);
       slots_.emplace_back(slot);
+      PublishSnapshot();
     }
 
     return ConnectionType(slot, this);
@@ -82,10 +81,12 @@ class Signal {
           slot->Disconnect();
         }
       }
-    }
 
-    if (find) {
-      ClearDisconnectedSlots();
+      if (find) {
+        slots_.remove_if(
+            [](const SlotPtr& slot) { return !slot->connected(); });
+        PublishSnapshot();
+      }
     }
     return find;
   }
@@ -96,21 +97,23 @@ class Signal {
       slot->Disconnect();
     }
     slots_.clear();
+    PublishSnapshot();
   }
 
  private:
   Signal(const Signal&) = delete;
   Signal& operator=(const Signal&) = delete;
 
-  void ClearDisconnectedSlots() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    slots_.erase(
-        std::remove_if(slots_.begin(), slots_.end(),
-                       [](const SlotPtr& slot) { return !slot->connected(); }),
-        slots_.end());
+  // requires mutex_ to be held
+  void PublishSnapshot() {
+    auto snapshot = std::make_shared<const std::vector<SlotPtr>>(
+        slots_.begin(), slots_.end());
+    std::atomic_store_explicit(&snapshot_, SnapshotPtr(std::move(snapshot)),
+                               std::memory_order_release);
   }
 
   SlotList slots_;
+  SnapshotPtr snapshot_;
   std::mutex mutex_;
 };
 
@@ -167,23 +170,26 @@ class Slot {
  public:
   using Callback = std::function<void(Args...)>;
   Slot(const Slot& another)
-      : cb_(another.cb_), connected_(another.connected_) {}
+      : cb_(another.cb_), connected_(another.connected()) {}
   explicit Slot(const Callback& cb, bool connected = true)
       : cb_(cb), connected_(connected) {}
   virtual ~Slot() {}
 
   void operator()(Args... args) {
-    if (connected_ && cb_) {
+    if (connected() && cb_) {
       cb_(args...);
     }
   }
 
-  void Disconnect() { connected_ = false; }
-  bool connected() const { return connected_; }
+  void Disconnect() { connected_.store(false, std::memory_order_release); }
+  bool connected() const {
+    return connected_.load(std::memory_order_acquire);
+  }
 
  private:
   Callback cb_;
-  bool connected_ = true;
+  // read by lock-free emitters while Disconnect runs on another thread
+  std::atomic<bool> connected_ = {true};
 };
 
 }  // namespace base
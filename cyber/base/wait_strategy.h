@@ -17,8 +17,10 @@
 #ifndef CYBER_BASE_WAIT_STRATEGY_H_
 #define CYBER_BASE_WAIT_STRATEGY_H_
 
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <cstdlib>
 #include <mutex>
 #include <thread>
@@ -115,6 +117,76 @@ class TimeoutBlockWaitStrategy : public WaitStrategy {
   std::chrono::milliseconds time_out_;
 };
 
+inline void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+  asm volatile("pause" ::: "memory");
+#elif defined(__aarch64__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+
+// Spins briefly, then yields, then parks on a condition variable. The
+// spin and yield budgets trade idle cpu for wakeup latency: a waiter that
+// is notified during the spin phase wakes in tens of nanoseconds instead
+// of the 50-100us a blocked thread pays, while a long-idle waiter ends up
+// parked and burns nothing.
+class AdaptiveWaitStrategy : public WaitStrategy {
+ public:
+  AdaptiveWaitStrategy() {}
+  AdaptiveWaitStrategy(uint32_t spin_count, uint32_t yield_count,
+                       uint64_t park_timeout_ms)
+      : spin_count_(spin_count),
+        yield_count_(yield_count),
+        park_timeout_(std::chrono::milliseconds(park_timeout_ms)) {}
+
+  void NotifyOne() override {
+    ticket_.fetch_add(1, std::memory_order_release);
+    cv_.notify_one();
+  }
+
+  void BreakAllWait() override {
+    break_all_wait_.store(true, std::memory_order_release);
+    cv_.notify_all();
+  }
+
+  bool EmptyWait() override {
+    const uint64_t observed = ticket_.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < spin_count_; ++i) {
+      if (Notified(observed)) {
+        return true;
+      }
+      CpuRelax();
+    }
+    for (uint32_t i = 0; i < yield_count_; ++i) {
+      if (Notified(observed)) {
+        return true;
+      }
+      std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (Notified(observed)) {
+      return true;
+    }
+    cv_.wait_for(lock, park_timeout_);
+    return !break_all_wait_.load(std::memory_order_acquire);
+  }
+
+ private:
+  bool Notified(uint64_t observed) const {
+    return ticket_.load(std::memory_order_acquire) != observed ||
+           break_all_wait_.load(std::memory_order_acquire);
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::atomic<uint64_t> ticket_ = {0};
+  std::atomic<bool> break_all_wait_ = {false};
+  uint32_t spin_count_ = 1000;
+  uint32_t yield_count_ = 10;
+  std::chrono::milliseconds park_timeout_ = std::chrono::milliseconds(10);
+};
+
 }  // namespace base
 }  // namespace cyber
 }  // namespace apollo
@@ -17,6 +17,7 @@
 #ifndef CYBER_BLOCKER_BLOCKER_H_
 #define CYBER_BLOCKER_BLOCKER_H_
 
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <list>
@@ -109,6 +110,16 @@ class Blocker : public BlockerBase {
   MessageQueue published_msg_queue_;
   mutable std::mutex msg_mutex_;
 
+  // sequence counters for the latest-message fast path. The publisher bumps
+  // publish_seq_ on every Enqueue; Observe compares it against observed_seq_
+  // and skips the mutex when nothing new arrived, which is the common case
+  // for pollers like dreamview that observe dozens of channels per cycle.
+  std::atomic<uint64_t> publish_seq_;
+  std::atomic<uint64_t> observed_seq_;
+  // latest observed message, accessed with atomic shared_ptr loads so the
+  // latest-value readers never block the publisher
+  MessagePtr latest_observed_msg_;
+
   CallbackMap published_callbacks_;
   mutable std::mutex cb_mutex_;
 
@@ -116,7 +127,8 @@ class Blocker : public BlockerBase {
 };
 
 template <typename T>
-Blocker<T>::Blocker(const BlockerAttr& attr) : attr_(attr), dummy_msg_() {}
+Blocker<T>::Blocker(const BlockerAttr& attr)
+    : attr_(attr), publish_seq_(0), observed_seq_(0), dummy_msg_() {}
 
 template <typename T>
 Blocker<T>::~Blocker() {
@@ -142,6 +154,9 @@ void Blocker<T>::Reset() {
     std::lock_guard<std::mutex> lock(msg_mutex_);
     observed_msg_queue_.clear();
     published_msg_queue_.clear();
+    std::atomic_store_explicit(&latest_observed_msg_, MessagePtr(),
+                               std::memory_order_release);
+    observed_seq_.store(publish_seq_.load());
   }
   {
     std::lock_guard<std::mutex> lock(cb_mutex_);
@@ -153,24 +168,42 @@ template <typename T>
 void Blocker<T>::ClearObserved() {
   std::lock_guard<std::mutex> lock(msg_mutex_);
   observed_msg_queue_.clear();
+  std::atomic_store_explicit(&latest_observed_msg_, MessagePtr(),
+                             std::memory_order_release);
+  // force the next Observe to re-copy the published queue
+  observed_seq_.store(publish_seq_.load() - 1);
 }
 
 template <typename T>
 void Blocker<T>::ClearPublished() {
   std::lock_guard<std::mutex> lock(msg_mutex_);
   published_msg_queue_.clear();
+  publish_seq_.fetch_add(1, std::memory_order_release);
 }
 
 template <typename T>
 void Blocker<T>::Observe() {
+  if (publish_seq_.load(std::memory_order_acquire) ==
+      observed_seq_.load(std::memory_order_relaxed)) {
+    // nothing new since the last Observe, don't touch the publisher's mutex
+    return;
+  }
   std::lock_guard<std::mutex> lock(msg_mutex_);
   observed_msg_queue_ = published_msg_queue_;
+  MessagePtr latest;
+  if (!observed_msg_queue_.empty()) {
+    latest = observed_msg_queue_.front();
+  }
+  std::atomic_store_explicit(&latest_observed_msg_, std::move(latest),
+                             std::memory_order_release);
+  // publish_seq_ only changes under msg_mutex_, so this read matches the copy
+  observed_seq_.store(publish_seq_.load(std::memory_order_relaxed));
 }
 
 template <typename T>
 bool Blocker<T>::IsObservedEmpty() const {
-  std::lock_guard<std::mutex> lock(msg_mutex_);
-  return observed_msg_queue_.empty();
+  return std::atomic_load_explicit(&latest_observed_msg_,
+                                   std::memory_order_acquire) == nullptr;
 }
 
 template <typename T>
@@ -198,20 +231,18 @@ bool Blocker<T>::Unsubscribe(const std::string& callback_id) {
 
 template <typename T>
 auto Blocker<T>::GetLatestObserved() const -> const MessageType& {
-  std::lock_guard<std::mutex> lock(msg_mutex_);
-  if (observed_msg_queue_.empty()) {
+  auto msg = std::atomic_load_explicit(&latest_observed_msg_,
+                                       std::memory_order_acquire);
+  if (msg == nullptr) {
     return dummy_msg_;
   }
-  return *observed_msg_queue_.front();
+  return *msg;
 }
 
 template <typename T>
 auto Blocker<T>::GetLatestObservedPtr() const -> const MessagePtr {
-  std::lock_guard<std::mutex> lock(msg_mutex_);
-  if (observed_msg_queue_.empty()) {
-    return nullptr;
-  }
-  return observed_msg_queue_.front();
+  return std::atomic_load_explicit(&latest_observed_msg_,
+                                   std::memory_order_acquire);
 }
 
 template <typename T>
@@ -254,6 +285,7 @@ void Blocker<T>::set_capacity(size_t capacity) {
   while (published_msg_queue_.size() > capacity) {
     published_msg_queue_.pop_back();
   }
+  publish_seq_.fetch_add(1, std::memory_order_release);
 }
 
 template <typename T>
@@ -271,6 +303,7 @@ void Blocker<T>::Enqueue(const MessagePtr& msg) {
   while (published_msg_queue_.size() > attr_.capacity) {
     published_msg_queue_.pop_back();
   }
+  publish_seq_.fetch_add(1, std::memory_order_release);
 }
 
 template <typename T>
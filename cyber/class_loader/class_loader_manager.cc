@@ -19,26 +19,42 @@ namespace apollo {
 namespace cyber {
 namespace class_loader {
 
-ClassLoaderManager::ClassLoaderManager() {}
+ClassLoaderManager::ClassLoaderManager()
+    : loader_snapshot_(
+          std::make_shared<std::map<std::string, ClassLoader*>>()) {}
 
 ClassLoaderManager::~ClassLoaderManager() {}
 
+void ClassLoaderManager::RebuildLoaderSnapshot() {
+  std::atomic_store(
+      &loader_snapshot_,
+      std::shared_ptr<const std::map<std::string, ClassLoader*>>(
+          std::make_shared<std::map<std::string, ClassLoader*>>(
+              libpath_loader_map_)));
+}
+
 ClassLoader* ClassLoaderManager::GetClassLoaderByLibPath(
     const std::string& library_path) {
-  return libpath_loader_map_[library_path];
+  auto snapshot = std::atomic_load(&loader_snapshot_);
+  auto itr = snapshot->find(library_path);
+  return itr == snapshot->end() ? nullptr : itr->second;
 }
 
 std::vector<ClassLoader*> ClassLoaderManager::GetAllValidClassLoaders() {
+  auto snapshot = std::atomic_load(&loader_snapshot_);
   std::vector<ClassLoader*> class_loaders;
-  for (auto& lib_class_loader : libpath_loader_map_) {
-    class_loaders.emplace_back(lib_class_loader.second);
+  for (auto& lib_class_loader : *snapshot) {
+    if (lib_class_loader.second != nullptr) {
+      class_loaders.emplace_back(lib_class_loader.second);
+    }
   }
   return class_loaders;
 }
 
 std::vector<std::string> ClassLoaderManager::GetAllValidLibPath() {
+  auto snapshot = std::atomic_load(&loader_snapshot_);
   std::vector<std::string> libpath;
-  for (auto& lib_class_loader : libpath_loader_map_) {
+  for (auto& lib_class_loader : *snapshot) {
     if (lib_class_loader.second != nullptr) {
       libpath.emplace_back(lib_class_loader.first);
     }
@@ -54,20 +70,40 @@ bool ClassLoaderManager::IsLibraryValid(const std::string& library_name) {
 }
 
 bool ClassLoaderManager::LoadLibrary(const std::string& library_path) {
-  std::lock_guard<std::mutex> lck(libpath_loader_map_mutex_);
-  if (!IsLibraryValid(library_path)) {
-    libpath_loader_map_[library_path] =
-        new class_loader::ClassLoader(library_path);
+  {
+    std::unique_lock<std::mutex> lck(libpath_loader_map_mutex_);
+    while (loading_paths_.count(library_path) > 0) {
+      loading_cond_.wait(lck);
+    }
+    if (IsLibraryValid(library_path)) {
+      return true;
+    }
+    loading_paths_.insert(library_path);
+  }
+
+  // dlopen outside the map lock so that independent libraries can be
+  // loaded from several threads in parallel
+  ClassLoader* loader = new class_loader::ClassLoader(library_path);
+  {
+    std::lock_guard<std::mutex> lck(libpath_loader_map_mutex_);
+    libpath_loader_map_[library_path] = loader;
+    RebuildLoaderSnapshot();
+    loading_paths_.erase(library_path);
   }
-  return IsLibraryValid(library_path);
+  loading_cond_.notify_all();
+  return true;
 }
 
 int ClassLoaderManager::UnloadLibrary(const std::string& library_path) {
   int num_remain_unload = 0;
-  if (IsLibraryValid(library_path)) {
-    ClassLoader* class_loader = GetClassLoaderByLibPath(library_path);
+  ClassLoader* class_loader = GetClassLoaderByLibPath(library_path);
+  if (class_loader != nullptr) {
     if ((num_remain_unload = class_loader->UnloadLibrary()) == 0) {
-      libpath_loader_map_[library_path] = nullptr;
+      {
+        std::lock_guard<std::mutex> lck(libpath_loader_map_mutex_);
+        libpath_loader_map_[library_path] = nullptr;
+        RebuildLoaderSnapshot();
+      }
       delete class_loader;
     }
   }
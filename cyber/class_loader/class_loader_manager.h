@@ -17,9 +17,11 @@
 #ifndef CYBER_CLASS_LOADER_CLASS_LOADER_MANAGER_H_
 #define CYBER_CLASS_LOADER_CLASS_LOADER_MANAGER_H_
 
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -52,10 +54,19 @@ class ClassLoaderManager {
   std::vector<ClassLoader*> GetAllValidClassLoaders();
   std::vector<std::string> GetAllValidLibPath();
   int UnloadLibrary(const std::string& library_path);
+  // rebuild the read snapshot; callers hold libpath_loader_map_mutex_
+  void RebuildLoaderSnapshot();
 
  private:
   std::mutex libpath_loader_map_mutex_;
   std::map<std::string, ClassLoader*> libpath_loader_map_;
+  // immutable copy of libpath_loader_map_, swapped atomically on
+  // load/unload so that lookups on the object-creation path are lock-free
+  std::shared_ptr<const std::map<std::string, ClassLoader*>> loader_snapshot_;
+  // paths currently being loaded; loads of the same path wait for each
+  // other while independent libraries load concurrently
+  std::set<std::string> loading_paths_;
+  std::condition_variable loading_cond_;
 };
 
 template <typename Base>
@@ -43,6 +43,26 @@ LibpathPocolibVector& GetLibPathPocoShareLibVector() {
   return instance;
 }
 
+ClassFactoryMapMapSnapshot& GetClassFactoryMapMapSnapshotReference() {
+  static ClassFactoryMapMapSnapshot snapshot =
+      std::make_shared<BaseToClassFactoryMapMap>();
+  return snapshot;
+}
+
+ClassFactoryMapMapSnapshot GetClassFactoryMapMapSnapshot() {
+  return std::atomic_load(&GetClassFactoryMapMapSnapshotReference());
+}
+
+void RebuildClassFactoryMapMapSnapshot() {
+  // callers hold GetClassFactoryMapMapMutex(), so the live maps are
+  // stable while they are copied; readers keep using the old snapshot
+  // until the new one is swapped in
+  std::atomic_store(&GetClassFactoryMapMapSnapshotReference(),
+                    ClassFactoryMapMapSnapshot(
+                        std::make_shared<BaseToClassFactoryMapMap>(
+                            GetClassFactoryMapMap())));
+}
+
 ClassClassFactoryMap& GetClassFactoryMapByBaseClass(
     const std::string& typeid_base_class_name) {
   BaseToClassFactoryMapMap& factoryMapMap = GetClassFactoryMapMap();
@@ -54,8 +74,11 @@ ClassClassFactoryMap& GetClassFactoryMapByBaseClass(
   return factoryMapMap[base_class_name];
 }
 
+// the loading context is per-thread: a library's static factory
+// registrations run on the thread that dlopens it, so independent
+// libraries can be loaded from several threads concurrently
 std::string& GetCurLoadingLibraryNameReference() {
-  static std::string library_name;
+  static thread_local std::string library_name;
   return library_name;
 }
 
@@ -69,7 +92,7 @@ void SetCurLoadingLibraryName(const std::string& library_name) {
 }
 
 ClassLoader*& GetCurActiveClassLoaderReference() {
-  static ClassLoader* loader = nullptr;
+  static thread_local ClassLoader* loader = nullptr;
   return loader;
 }
 
@@ -149,6 +172,7 @@ void DestroyClassFactoryObjectsOfLibrary(const std::string& library_path,
     DestroyClassFactoryObjectsOfLibrary(library_path, loader,
                                         &baseclass_map.second);
   }
+  RebuildClassFactoryMapMapSnapshot();
 }
 
 LibpathPocolibVector::iterator FindLoadedLibrary(
@@ -205,33 +229,31 @@ bool LoadLibrary(const std::string& library_path, ClassLoader* loader) {
     return true;
   }
 
+  // the loading context is thread local and the factory maps take their
+  // own locks, so loads of independent libraries can run in parallel;
+  // concurrent loads of the same path are serialized by the callers
   PocoLibraryPtr poco_library = nullptr;
-  static std::recursive_mutex loader_mutex;
-  {
-    std::lock_guard<std::recursive_mutex> lck(loader_mutex);
-
-    try {
-      SetCurActiveClassLoader(loader);
-      SetCurLoadingLibraryName(library_path);
-      poco_library = PocoLibraryPtr(new Poco::SharedLibrary(library_path));
-    } catch (const Poco::LibraryLoadException& e) {
-      SetCurLoadingLibraryName("");
-      SetCurActiveClassLoader(nullptr);
-      AERROR << "poco LibraryLoadException: " << e.message();
-    } catch (const Poco::LibraryAlreadyLoadedException& e) {
-      SetCurLoadingLibraryName("");
-      SetCurActiveClassLoader(nullptr);
-      AERROR << "poco LibraryAlreadyLoadedException: " << e.message();
-    } catch (const Poco::NotFoundException& e) {
-      SetCurLoadingLibraryName("");
-      SetCurActiveClassLoader(nullptr);
-      AERROR << "poco NotFoundException: " << e.message();
-    }
-
+  try {
+    SetCurActiveClassLoader(loader);
+    SetCurLoadingLibraryName(library_path);
+    poco_library = PocoLibraryPtr(new Poco::SharedLibrary(library_path));
+  } catch (const Poco::LibraryLoadException& e) {
+    SetCurLoadingLibraryName("");
+    SetCurActiveClassLoader(nullptr);
+    AERROR << "poco LibraryLoadException: " << e.message();
+  } catch (const Poco::LibraryAlreadyLoadedException& e) {
+    SetCurLoadingLibraryName("");
+    SetCurActiveClassLoader(nullptr);
+    AERROR << "poco LibraryAlreadyLoadedException: " << e.message();
+  } catch (const Poco::NotFoundException& e) {
     SetCurLoadingLibraryName("");
     SetCurActiveClassLoader(nullptr);
+    AERROR << "poco NotFoundException: " << e.message();
   }
 
+  SetCurLoadingLibraryName("");
+  SetCurActiveClassLoader(nullptr);
+
   if (poco_library == nullptr) {
     AERROR << "poco shared library failed: " << library_path;
     return false;
@@ -49,9 +49,18 @@ using BaseToClassFactoryMapMap = std::map<std::string, ClassClassFactoryMap>;
 using LibpathPocolibVector =
     std::vector<std::pair<std::string, PocoLibraryPtr>>;
 using ClassFactoryVector = std::vector<AbstractClassFactoryBase*>;
+using ClassFactoryMapMapSnapshot =
+    std::shared_ptr<const BaseToClassFactoryMapMap>;
 
 BaseToClassFactoryMapMap& GetClassFactoryMapMap();
 std::recursive_mutex& GetClassFactoryMapMapMutex();
+// Immutable copy of the factory registry, swapped atomically whenever a
+// library registers or destroys factories. Readers on the object-creation
+// path look classes up here without taking the registry mutex.
+ClassFactoryMapMapSnapshot GetClassFactoryMapMapSnapshot();
+// Rebuild the snapshot from the live maps; callers must hold the registry
+// mutex.
+void RebuildClassFactoryMapMapSnapshot();
 LibpathPocolibVector& GetLibPathPocoShareLibVector();
 std::recursive_mutex& GetLibPathPocoShareLibMutex();
 ClassClassFactoryMap& GetClassFactoryMapByBaseClass(
@@ -87,20 +96,24 @@ void RegisterClass(const std::string& class_name,
   ClassClassFactoryMap& factory_map =
       GetClassFactoryMapByBaseClass(typeid(Base).name());
   factory_map[class_name] = new_class_factrory_obj;
+  RebuildClassFactoryMapMapSnapshot();
   GetClassFactoryMapMapMutex().unlock();
 }
 
 template <typename Base>
 Base* CreateClassObj(const std::string& class_name, ClassLoader* loader) {
-  GetClassFactoryMapMapMutex().lock();
-  ClassClassFactoryMap& factoryMap =
-      GetClassFactoryMapByBaseClass(typeid(Base).name());
+  // Look the factory up in the registry snapshot instead of taking the
+  // registry mutex; the snapshot is immutable once published.
+  ClassFactoryMapMapSnapshot snapshot = GetClassFactoryMapMapSnapshot();
   AbstractClassFactory<Base>* factory = nullptr;
-  if (factoryMap.find(class_name) != factoryMap.end()) {
-    factory = dynamic_cast<utility::AbstractClassFactory<Base>*>(
-        factoryMap[class_name]);
+  auto base_itr = snapshot->find(typeid(Base).name());
+  if (base_itr != snapshot->end()) {
+    auto class_itr = base_itr->second.find(class_name);
+    if (class_itr != base_itr->second.end()) {
+      factory = dynamic_cast<utility::AbstractClassFactory<Base>*>(
+          class_itr->second);
+    }
   }
-  GetClassFactoryMapMapMutex().unlock();
 
   Base* classobj = nullptr;
   if (factory && factory->IsOwnedBy(loader)) {
@@ -112,12 +125,13 @@ Base* CreateClassObj(const std::string& class_name, ClassLoader* loader) {
 
 template <typename Base>
 std::vector<std::string> GetValidClassNames(ClassLoader* loader) {
-  std::lock_guard<std::recursive_mutex> lck(GetClassFactoryMapMapMutex());
-
-  ClassClassFactoryMap& factoryMap =
-      GetClassFactoryMapByBaseClass(typeid(Base).name());
+  ClassFactoryMapMapSnapshot snapshot = GetClassFactoryMapMapSnapshot();
   std::vector<std::string> classes;
-  for (auto& class_factory : factoryMap) {
+  auto base_itr = snapshot->find(typeid(Base).name());
+  if (base_itr == snapshot->end()) {
+    return classes;
+  }
+  for (auto& class_factory : base_itr->second) {
     AbstractClassFactoryBase* factory = class_factory.second;
     if (factory && factory->IsOwnedBy(loader)) {
       classes.emplace_back(class_factory.first);
@@ -61,6 +61,9 @@ CRoutine::CRoutine(const std::function<void()> &func) : func_(func) {
     context_.reset(new RoutineContext());
   }
 
+  // Contexts recycled through the pool keep their guard page and warm
+  // stack; fresh ones pay the mprotect once.
+  InstallStackGuard(context_.get());
   MakeContext(CRoutineEntry, this, context_.get());
   state_ = RoutineState::READY;
   updated_.test_and_set(std::memory_order_release);
@@ -37,6 +37,24 @@ using Duration = std::chrono::microseconds;
 
 enum class RoutineState { READY, FINISHED, SLEEP, IO_WAIT, DATA_WAIT };
 
+/**
+ * @brief Cumulative runtime statistics of one croutine.
+ * Written only by the processor that currently runs the croutine, with
+ * relaxed atomics so a sampler thread can read them concurrently. The
+ * bookkeeping costs two steady_clock reads per context switch, which is
+ * noise against a typical croutine slice.
+ */
+struct RoutineStatistics {
+  static const int kWaitHistSize = 16;
+
+  std::atomic<uint64_t> exec_time_ns = {0};
+  std::atomic<uint64_t> switch_count = {0};
+  std::atomic<uint64_t> wait_time_ns = {0};
+  // ready-to-resume latency histogram with power-of-two buckets, bucket i
+  // covering roughly [2^i, 2^(i+1)) microseconds, the last one overflow
+  std::atomic<uint64_t> wait_hist[kWaitHistSize] = {};
+};
+
 class CRoutine {
  public:
   explicit CRoutine(const RoutineFunc &func);
@@ -94,10 +112,26 @@ class CRoutine {
 
   const std::string &group_name() { return group_name_; }
 
+  // statistics hooks, called by the resuming processor
+  void UpdateStatOnResume();
+  void UpdateStatOnYield();
+  const RoutineStatistics &statistics() const { return statistics_; }
+
  private:
   CRoutine(CRoutine &) = delete;
   CRoutine &operator=(CRoutine &) = delete;
 
+  static uint64_t NowNs() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+  }
+
+  void MarkReady() {
+    ready_since_ns_.store(NowNs(), std::memory_order_relaxed);
+  }
+
   std::string name_;
   std::chrono::steady_clock::time_point wake_time_ =
       std::chrono::steady_clock::now();
@@ -118,6 +152,12 @@ class CRoutine {
 
   std::string group_name_;
 
+  RoutineStatistics statistics_;
+  // steady_clock timestamp of the last wait->READY transition, consumed
+  // by UpdateStatOnResume; zero when the croutine is not waiting
+  std::atomic<uint64_t> ready_since_ns_ = {0};
+  uint64_t resume_start_ns_ = 0;
+
   static thread_local CRoutine *current_routine_;
   static thread_local char *main_stack_;
 };
@@ -150,7 +190,10 @@ inline std::chrono::steady_clock::time_point CRoutine::wake_time() const {
   return wake_time_;
 }
 
-inline void CRoutine::Wake() { state_ = RoutineState::READY; }
+inline void CRoutine::Wake() {
+  MarkReady();
+  state_ = RoutineState::READY;
+}
 
 inline void CRoutine::HangUp() { CRoutine::Yield(RoutineState::DATA_WAIT); }
 
@@ -177,6 +220,7 @@ inline RoutineState CRoutine::UpdateState() {
   // Synchronous Event Mechanism
   if (state_ == RoutineState::SLEEP &&
       std::chrono::steady_clock::now() > wake_time_) {
+    MarkReady();
     state_ = RoutineState::READY;
     return state_;
   }
@@ -184,6 +228,7 @@ inline RoutineState CRoutine::UpdateState() {
   // Asynchronous Event Mechanism
   if (!updated_.test_and_set(std::memory_order_release)) {
     if (state_ == RoutineState::DATA_WAIT || state_ == RoutineState::IO_WAIT) {
+      MarkReady();
       state_ = RoutineState::READY;
     }
   }
@@ -206,6 +251,29 @@ inline void CRoutine::SetUpdateFlag() {
   updated_.clear(std::memory_order_release);
 }
 
+inline void CRoutine::UpdateStatOnResume() {
+  resume_start_ns_ = NowNs();
+  const auto ready_since = ready_since_ns_.exchange(0, std::memory_order_relaxed);
+  if (ready_since == 0 || ready_since > resume_start_ns_) {
+    return;
+  }
+  const uint64_t wait_ns = resume_start_ns_ - ready_since;
+  statistics_.wait_time_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+  uint64_t us = wait_ns >> 10;
+  int bucket = 0;
+  while (us > 1 && bucket < RoutineStatistics::kWaitHistSize - 1) {
+    us >>= 1;
+    ++bucket;
+  }
+  statistics_.wait_hist[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void CRoutine::UpdateStatOnYield() {
+  statistics_.exec_time_ns.fetch_add(NowNs() - resume_start_ns_,
+                                     std::memory_order_relaxed);
+  statistics_.switch_count.fetch_add(1, std::memory_order_relaxed);
+}
+
 }  // namespace croutine
 }  // namespace cyber
 }  // namespace apollo
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <chrono>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "cyber/common/log.h"
+#include "cyber/cyber.h"
+#include "cyber/init.h"
+
+namespace apollo {
+namespace cyber {
+namespace croutine {
+
+// Guards the cost of SwapContext: a croutine that yields immediately is
+// resumed in a tight loop, so each iteration is one switch in and one
+// switch out. Run with --test_output=all to see the per-switch cost.
+TEST(CRoutineSwapBenchmarkTest, round_trip_cost) {
+  constexpr uint32_t kRounds = 100000;
+
+  apollo::cyber::Init("croutine_swap_benchmark_test");
+  auto cr = std::make_shared<CRoutine>([]() {
+    while (true) {
+      CRoutine::Yield(RoutineState::READY);
+    }
+  });
+
+  // warm up the stack and context
+  for (uint32_t i = 0; i < 100; ++i) {
+    cr->Resume();
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < kRounds; ++i) {
+    cr->Resume();
+  }
+  auto end = std::chrono::steady_clock::now();
+  auto ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+  AINFO << "swap round trips: " << kRounds
+        << ", avg round-trip cost: " << ns / kRounds << "ns";
+  EXPECT_GT(ns, 0);
+
+  cr->Stop();
+  cr->Resume();
+}
+
+}  // namespace croutine
+}  // namespace cyber
+}  // namespace apollo
@@ -16,6 +16,11 @@
 
 #include "cyber/croutine/detail/routine_context.h"
 
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+
 namespace apollo {
 namespace cyber {
 namespace croutine {
@@ -50,6 +55,24 @@ void MakeContext(const func &f1, const void *arg, RoutineContext *ctx) {
   *reinterpret_cast<void **>(sp) = const_cast<void *>(arg);
 }
 
+void InstallStackGuard(RoutineContext *ctx) {
+  if (ctx->guarded) {
+    return;
+  }
+
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  // The stack array is not page aligned, so protect the first whole page
+  // inside its low end. The routine grows downwards from the high end and
+  // loses at most two pages of usable stack.
+  auto stack_low = reinterpret_cast<uintptr_t>(ctx->stack);
+  auto guard = (stack_low + page_size - 1) & ~(page_size - 1);
+  if (mprotect(reinterpret_cast<void *>(guard), page_size, PROT_NONE) != 0) {
+    AWARN << "failed to install stack guard page, errno: " << errno;
+    return;
+  }
+  ctx->guarded = true;
+}
+
 }  // namespace croutine
 }  // namespace cyber
 }  // namespace apollo
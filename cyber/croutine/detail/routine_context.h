@@ -42,6 +42,7 @@ typedef void (*func)(void*);
 struct RoutineContext {
   char stack[STACK_SIZE];
   char* sp = nullptr;
+  bool guarded = false;
 #if defined __aarch64__
 } __attribute__((aligned(16)));
 #else
@@ -50,6 +51,13 @@ struct RoutineContext {
 
 void MakeContext(const func& f1, const void* arg, RoutineContext* ctx);
 
+// Marks the lowest whole page of ctx's stack PROT_NONE, so a stack
+// overflow faults immediately instead of silently corrupting the
+// neighbouring pool object. Idempotent: contexts recycled through the
+// pool keep their guard (and their warm stack pages) across croutine
+// lifetimes.
+void InstallStackGuard(RoutineContext* ctx);
+
 inline void SwapContext(char** src_sp, char** dest_sp) {
   ctx_swap(reinterpret_cast<void**>(src_sp), reinterpret_cast<void**>(dest_sp));
 }
@@ -47,18 +47,32 @@ class RoutineFactory {
   std::shared_ptr<data::DataVisitorBase> data_visitor_ = nullptr;
 };
 
+// The routine bodies below fetch optimistically first: while data keeps
+// coming, each iteration is one fetch, one dispatch and one yield, with
+// no state store in between. Only when a fetch fails does the routine
+// publish DATA_WAIT and look again, so a message arriving between the
+// failed fetch and the yield cannot be slept over. The reference to the
+// dispatched message is dropped right after the user function returns,
+// so the routine never pins a message across a wait.
 template <typename M0, typename F>
 RoutineFactory CreateRoutineFactory(
     F&& f, const std::shared_ptr<data::DataVisitor<M0>>& dv) {
   RoutineFactory factory;
   factory.SetDataVisitor(dv);
-  factory.create_routine = [=]() {
-    return [=]() {
+  factory.create_routine = [f = std::forward<F>(f), dv]() {
+    return [f, dv]() {
       std::shared_ptr<M0> msg;
       for (;;) {
+        if (dv->TryFetch(msg)) {
+          f(msg);
+          msg.reset();
+          CRoutine::Yield(RoutineState::READY);
+          continue;
+        }
         CRoutine::GetCurrentRoutine()->set_state(RoutineState::DATA_WAIT);
         if (dv->TryFetch(msg)) {
           f(msg);
+          msg.reset();
           CRoutine::Yield(RoutineState::READY);
         } else {
           CRoutine::Yield();
@@ -74,14 +88,23 @@ RoutineFactory CreateRoutineFactory(
     F&& f, const std::shared_ptr<data::DataVisitor<M0, M1>>& dv) {
   RoutineFactory factory;
   factory.SetDataVisitor(dv);
-  factory.create_routine = [=]() {
-    return [=]() {
+  factory.create_routine = [f = std::forward<F>(f), dv]() {
+    return [f, dv]() {
       std::shared_ptr<M0> msg0;
       std::shared_ptr<M1> msg1;
       for (;;) {
+        if (dv->TryFetch(msg0, msg1)) {
+          f(msg0, msg1);
+          msg0.reset();
+          msg1.reset();
+          CRoutine::Yield(RoutineState::READY);
+          continue;
+        }
         CRoutine::GetCurrentRoutine()->set_state(RoutineState::DATA_WAIT);
         if (dv->TryFetch(msg0, msg1)) {
           f(msg0, msg1);
+          msg0.reset();
+          msg1.reset();
           CRoutine::Yield(RoutineState::READY);
         } else {
           CRoutine::Yield();
@@ -97,15 +120,26 @@ RoutineFactory CreateRoutineFactory(
     F&& f, const std::shared_ptr<data::DataVisitor<M0, M1, M2>>& dv) {
   RoutineFactory factory;
   factory.SetDataVisitor(dv);
-  factory.create_routine = [=]() {
-    return [=]() {
+  factory.create_routine = [f = std::forward<F>(f), dv]() {
+    return [f, dv]() {
       std::shared_ptr<M0> msg0;
       std::shared_ptr<M1> msg1;
       std::shared_ptr<M2> msg2;
       for (;;) {
+        if (dv->TryFetch(msg0, msg1, msg2)) {
+          f(msg0, msg1, msg2);
+          msg0.reset();
+          msg1.reset();
+          msg2.reset();
+          CRoutine::Yield(RoutineState::READY);
+          continue;
+        }
         CRoutine::GetCurrentRoutine()->set_state(RoutineState::DATA_WAIT);
         if (dv->TryFetch(msg0, msg1, msg2)) {
           f(msg0, msg1, msg2);
+          msg0.reset();
+          msg1.reset();
+          msg2.reset();
           CRoutine::Yield(RoutineState::READY);
         } else {
           CRoutine::Yield();
@@ -121,16 +155,29 @@ RoutineFactory CreateRoutineFactory(
     F&& f, const std::shared_ptr<data::DataVisitor<M0, M1, M2, M3>>& dv) {
   RoutineFactory factory;
   factory.SetDataVisitor(dv);
-  factory.create_routine = [=]() {
-    return [=]() {
+  factory.create_routine = [f = std::forward<F>(f), dv]() {
+    return [f, dv]() {
       std::shared_ptr<M0> msg0;
       std::shared_ptr<M1> msg1;
       std::shared_ptr<M2> msg2;
       std::shared_ptr<M3> msg3;
       for (;;) {
+        if (dv->TryFetch(msg0, msg1, msg2, msg3)) {
+          f(msg0, msg1, msg2, msg3);
+          msg0.reset();
+          msg1.reset();
+          msg2.reset();
+          msg3.reset();
+          CRoutine::Yield(RoutineState::READY);
+          continue;
+        }
         CRoutine::GetCurrentRoutine()->set_state(RoutineState::DATA_WAIT);
         if (dv->TryFetch(msg0, msg1, msg2, msg3)) {
           f(msg0, msg1, msg2, msg3);
+          msg0.reset();
+          msg1.reset();
+          msg2.reset();
+          msg3.reset();
           CRoutine::Yield(RoutineState::READY);
         } else {
           CRoutine::Yield();
@@ -17,15 +17,32 @@
 #ifndef CYBER_DATA_CACHE_BUFFER_H_
 #define CYBER_DATA_CACHE_BUFFER_H_
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <vector>
 
 namespace apollo {
 namespace cyber {
 namespace data {
 
+template <typename U>
+struct IsSharedPtr : std::false_type {};
+template <typename U>
+struct IsSharedPtr<std::shared_ptr<U>> : std::true_type {};
+
+/**
+ * @brief Single-writer/multi-reader ring buffer behind every channel.
+ * Writers (Fill callers) still serialize on Mutex(); readers use the
+ * lock-free path of ReadAt() plus the head/tail sequence counters and
+ * retry when the writer lapped them, instead of taking the mutex. For
+ * shared_ptr payloads the slots are accessed with the atomic shared_ptr
+ * free functions, so a reader racing the writer sees either the old or
+ * the new value, never a torn one; the head_ counter then tells it
+ * whether what it read was still inside the valid window.
+ */
 template <typename T>
 class CacheBuffer {
  public:
@@ -40,8 +57,8 @@ class CacheBuffer {
 
   CacheBuffer(const CacheBuffer& rhs) {
     std::lock_guard<std::mutex> lg(rhs.mutex_);
-    head_ = rhs.head_;
-    tail_ = rhs.tail_;
+    head_.store(rhs.head_.load());
+    tail_.store(rhs.tail_.load());
     buffer_ = rhs.buffer_;
     capacity_ = rhs.capacity_;
     fusion_callback_ = rhs.fusion_callback_;
@@ -50,44 +67,75 @@ class CacheBuffer {
   T& operator[](const uint64_t& pos) { return buffer_[GetIndex(pos)]; }
   const T& at(const uint64_t& pos) const { return buffer_[GetIndex(pos)]; }
 
-  uint64_t Head() const { return head_ + 1; }
-  uint64_t Tail() const { return tail_; }
-  uint64_t Size() const { return tail_ - head_; }
+  uint64_t Head() const { return head_.load(std::memory_order_acquire) + 1; }
+  uint64_t Tail() const { return tail_.load(std::memory_order_acquire); }
+  uint64_t Size() const { return Tail() - Head() + 1; }
 
-  const T& Front() const { return buffer_[GetIndex(head_ + 1)]; }
-  const T& Back() const { return buffer_[GetIndex(tail_)]; }
+  const T& Front() const { return buffer_[GetIndex(Head())]; }
+  const T& Back() const { return buffer_[GetIndex(Tail())]; }
 
-  bool Empty() const { return tail_ == 0; }
-  bool Full() const { return capacity_ - 1 == tail_ - head_; }
+  bool Empty() const { return Tail() == 0; }
+  bool Full() const { return capacity_ - 1 == Size(); }
   uint64_t Capacity() const { return capacity_; }
 
   void SetFusionCallback(const FusionCallback& callback) {
     fusion_callback_ = callback;
   }
 
+  // Requires Mutex() to be held; readers are not excluded. The head is
+  // advanced before the slot is overwritten and the tail afterwards, so
+  // a reader validating against Head() after its slot read cannot use a
+  // lapped value unnoticed.
   void Fill(const T& value) {
     if (fusion_callback_) {
       fusion_callback_(value);
     } else {
       if (Full()) {
-        buffer_[GetIndex(head_)] = value;
-        ++head_;
-        ++tail_;
-      } else {
-        buffer_[GetIndex(tail_ + 1)] = value;
-        ++tail_;
+        head_.fetch_add(1, std::memory_order_release);
       }
+      StoreSlot(GetIndex(tail_.load(std::memory_order_relaxed) + 1), value);
+      tail_.fetch_add(1, std::memory_order_release);
     }
   }
 
+  // Lock-free read of one position; the caller must re-check against
+  // Head() afterwards and retry when the writer lapped it.
+  T ReadAt(const uint64_t pos) const { return LoadSlot(GetIndex(pos)); }
+
   std::mutex& Mutex() { return mutex_; }
 
  private:
   CacheBuffer& operator=(const CacheBuffer& other) = delete;
   uint64_t GetIndex(const uint64_t& pos) const { return pos % capacity_; }
 
-  uint64_t head_ = 0;
-  uint64_t tail_ = 0;
+  template <typename U = T>
+  typename std::enable_if<IsSharedPtr<U>::value>::type StoreSlot(
+      uint64_t index, const T& value) {
+    std::atomic_store_explicit(&buffer_[index], value,
+                               std::memory_order_release);
+  }
+
+  template <typename U = T>
+  typename std::enable_if<!IsSharedPtr<U>::value>::type StoreSlot(
+      uint64_t index, const T& value) {
+    buffer_[index] = value;
+  }
+
+  template <typename U = T>
+  typename std::enable_if<IsSharedPtr<U>::value, T>::type LoadSlot(
+      uint64_t index) const {
+    return std::atomic_load_explicit(&buffer_[index],
+                                     std::memory_order_acquire);
+  }
+
+  template <typename U = T>
+  typename std::enable_if<!IsSharedPtr<U>::value, T>::type LoadSlot(
+      uint64_t index) const {
+    return buffer_[index];
+  }
+
+  std::atomic<uint64_t> head_ = {0};
+  std::atomic<uint64_t> tail_ = {0};
   uint64_t capacity_ = 0;
   std::vector<T> buffer_;
   mutable std::mutex mutex_;
@@ -53,53 +53,78 @@ class ChannelBuffer {
   std::shared_ptr<BufferType> buffer_;
 };
 
+// Readers do not take the buffer mutex; they read through the atomic
+// slot accessors and retry when the writer lapped them between the slot
+// read and the Head() validation, which is rare even under overflow.
 template <typename T>
 bool ChannelBuffer<T>::Fetch(uint64_t* index,
                              std::shared_ptr<T>& m) {  // NOLINT
-  std::lock_guard<std::mutex> lock(buffer_->Mutex());
-  if (buffer_->Empty()) {
-    return false;
+  while (true) {
+    if (buffer_->Empty()) {
+      return false;
+    }
+
+    uint64_t target = *index;
+    if (target == 0) {
+      target = buffer_->Tail();
+    } else if (target == buffer_->Tail() + 1) {
+      return false;
+    } else if (target < buffer_->Head()) {
+      auto interval = buffer_->Tail() - target;
+      AWARN << "channel[" << GlobalData::GetChannelById(channel_id_) << "] "
+            << "read buffer overflow, drop_message[" << interval
+            << "] pre_index[" << target << "] current_index["
+            << buffer_->Tail() << "] ";
+      target = buffer_->Tail();
+    }
+    m = buffer_->ReadAt(target);
+    if (target >= buffer_->Head()) {
+      *index = target;
+      return true;
+    }
+    *index = target;
   }
-
-  if (*index == 0) {
-    *index = buffer_->Tail();
-  } else if (*index == buffer_->Tail() + 1) {
-    return false;
-  } else if (*index < buffer_->Head()) {
-    auto interval = buffer_->Tail() - *index;
-    AWARN << "channel[" << GlobalData::GetChannelById(channel_id_) << "] "
-          << "read buffer overflow, drop_message[" << interval << "] pre_index["
-          << *index << "] current_index[" << buffer_->Tail() << "] ";
-    *index = buffer_->Tail();
-  }
-  m = buffer_->at(*index);
-  return true;
 }
 
 template <typename T>
 bool ChannelBuffer<T>::Latest(std::shared_ptr<T>& m) {  // NOLINT
-  std::lock_guard<std::mutex> lock(buffer_->Mutex());
-  if (buffer_->Empty()) {
-    return false;
+  while (true) {
+    if (buffer_->Empty()) {
+      return false;
+    }
+
+    auto tail = buffer_->Tail();
+    m = buffer_->ReadAt(tail);
+    if (tail >= buffer_->Head()) {
+      return true;
+    }
   }
-
-  m = buffer_->Back();
-  return true;
 }
 
 template <typename T>
 bool ChannelBuffer<T>::FetchMulti(uint64_t fetch_size,
                                   std::vector<std::shared_ptr<T>>* vec) {
-  std::lock_guard<std::mutex> lock(buffer_->Mutex());
-  if (buffer_->Empty()) {
-    return false;
+  std::vector<std::shared_ptr<T>> fetched;
+  while (true) {
+    if (buffer_->Empty()) {
+      return false;
+    }
+
+    auto tail = buffer_->Tail();
+    auto head = buffer_->Head();
+    auto num = std::min(tail - head + 1, fetch_size);
+    fetched.clear();
+    fetched.reserve(num);
+    for (auto index = tail - num + 1; index <= tail; ++index) {
+      fetched.emplace_back(buffer_->ReadAt(index));
+    }
+    if (tail - num + 1 >= buffer_->Head()) {
+      break;
+    }
   }
-
-  auto num = std::min(buffer_->Size(), fetch_size);
-  vec->reserve(num);
-  for (auto index = buffer_->Tail() - num + 1; index <= buffer_->Tail();
-       ++index) {
-    vec->emplace_back(buffer_->at(index));
+  vec->reserve(vec->size() + fetched.size());
+  for (auto& m : fetched) {
+    vec->emplace_back(std::move(m));
   }
   return true;
 }
@@ -16,7 +16,9 @@
 
 #include "cyber/data/channel_buffer.h"
 
+#include <atomic>
 #include <memory>
+#include <thread>
 #include <vector>
 #include "gtest/gtest.h"
 
@@ -97,6 +99,58 @@ TEST(ChannelBufferTest, FetchMulti) {
   EXPECT_EQ(2, *vector[1]);
 }
 
+// 1 writer / 8 readers contention: readers go through the lock-free
+// retry path while the writer keeps lapping the small buffer; values
+// seen by every reader must stay valid and monotonic.
+TEST(ChannelBufferTest, ConcurrentLatestAndFetch) {
+  auto cache_buffer = new CacheBuffer<std::shared_ptr<int>>(16);
+  auto buffer = std::make_shared<ChannelBuffer<int>>(channel0, cache_buffer);
+  const int kMessageNum = 100000;
+  const int kReaderNum = 8;
+  std::atomic<bool> done(false);
+  std::atomic<int> failures(0);
+
+  std::thread writer([&]() {
+    for (int i = 1; i <= kMessageNum; ++i) {
+      std::lock_guard<std::mutex> lock(buffer->Buffer()->Mutex());
+      buffer->Buffer()->Fill(std::make_shared<int>(i));
+    }
+    done.store(true);
+  });
+
+  std::vector<std::thread> readers;
+  for (int r = 0; r < kReaderNum; ++r) {
+    readers.emplace_back([&, r]() {
+      std::shared_ptr<int> msg;
+      uint64_t index = 0;
+      int last = 0;
+      while (!done.load()) {
+        bool ok = (r % 2 == 0) ? buffer->Latest(msg)
+                               : buffer->Fetch(&index, msg);
+        if (!ok) {
+          continue;
+        }
+        if (msg == nullptr || *msg < last || *msg > kMessageNum) {
+          failures.fetch_add(1);
+          return;
+        }
+        last = *msg;
+        ++index;
+      }
+    });
+  }
+
+  writer.join();
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(0, failures.load());
+
+  std::shared_ptr<int> msg;
+  ASSERT_TRUE(buffer->Latest(msg));
+  EXPECT_EQ(kMessageNum, *msg);
+}
+
 }  // namespace data
 }  // namespace cyber
 }  // namespace apollo
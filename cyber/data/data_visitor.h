@@ -27,6 +27,7 @@
 #include "cyber/data/data_dispatcher.h"
 #include "cyber/data/data_visitor_base.h"
 #include "cyber/data/fusion/all_latest.h"
+#include "cyber/data/fusion/approximate_time.h"
 #include "cyber/data/fusion/data_fusion.h"
 
 namespace apollo {
@@ -47,7 +48,9 @@ template <typename M0, typename M1 = NullType, typename M2 = NullType,
           typename M3 = NullType>
 class DataVisitor : public DataVisitorBase {
  public:
-  explicit DataVisitor(const std::vector<VisitorConfig>& configs)
+  explicit DataVisitor(const std::vector<VisitorConfig>& configs,
+                       fusion::FusionType fusion_type =
+                           fusion::FusionType::ALL_LATEST)
       : buffer_m0_(configs[0].channel_id,
                    new BufferType<M0>(configs[0].queue_size)),
         buffer_m1_(configs[1].channel_id,
@@ -61,8 +64,15 @@ class DataVisitor : public DataVisitorBase {
     DataDispatcher<M2>::Instance()->AddBuffer(buffer_m2_);
     DataDispatcher<M3>::Instance()->AddBuffer(buffer_m3_);
     data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
-    data_fusion_ = new fusion::AllLatest<M0, M1, M2, M3>(
-        buffer_m0_, buffer_m1_, buffer_m2_, buffer_m3_);
+    switch (fusion_type) {
+      case fusion::FusionType::APPROXIMATE_TIME:
+        data_fusion_ = new fusion::ApproximateTime<M0, M1, M2, M3>(
+            buffer_m0_, buffer_m1_, buffer_m2_, buffer_m3_);
+        break;
+      default:
+        data_fusion_ = new fusion::AllLatest<M0, M1, M2, M3>(
+            buffer_m0_, buffer_m1_, buffer_m2_, buffer_m3_);
+    }
   }
 
   ~DataVisitor() {
@@ -92,7 +102,9 @@ class DataVisitor : public DataVisitorBase {
 template <typename M0, typename M1, typename M2>
 class DataVisitor<M0, M1, M2, NullType> : public DataVisitorBase {
  public:
-  explicit DataVisitor(const std::vector<VisitorConfig>& configs)
+  explicit DataVisitor(const std::vector<VisitorConfig>& configs,
+                       fusion::FusionType fusion_type =
+                           fusion::FusionType::ALL_LATEST)
       : buffer_m0_(configs[0].channel_id,
                    new BufferType<M0>(configs[0].queue_size)),
         buffer_m1_(configs[1].channel_id,
@@ -103,8 +115,15 @@ class DataVisitor<M0, M1, M2, NullType> : public DataVisitorBase {
     DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
     DataDispatcher<M2>::Instance()->AddBuffer(buffer_m2_);
     data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
-    data_fusion_ =
-        new fusion::AllLatest<M0, M1, M2>(buffer_m0_, buffer_m1_, buffer_m2_);
+    switch (fusion_type) {
+      case fusion::FusionType::APPROXIMATE_TIME:
+        data_fusion_ = new fusion::ApproximateTime<M0, M1, M2>(
+            buffer_m0_, buffer_m1_, buffer_m2_);
+        break;
+      default:
+        data_fusion_ = new fusion::AllLatest<M0, M1, M2>(
+            buffer_m0_, buffer_m1_, buffer_m2_);
+    }
   }
 
   ~DataVisitor() {
@@ -133,7 +152,9 @@ class DataVisitor<M0, M1, M2, NullType> : public DataVisitorBase {
 template <typename M0, typename M1>
 class DataVisitor<M0, M1, NullType, NullType> : public DataVisitorBase {
  public:
-  explicit DataVisitor(const std::vector<VisitorConfig>& configs)
+  explicit DataVisitor(const std::vector<VisitorConfig>& configs,
+                       fusion::FusionType fusion_type =
+                           fusion::FusionType::ALL_LATEST)
       : buffer_m0_(configs[0].channel_id,
                    new BufferType<M0>(configs[0].queue_size)),
         buffer_m1_(configs[1].channel_id,
@@ -141,7 +162,14 @@ class DataVisitor<M0, M1, NullType, NullType> : public DataVisitorBase {
     DataDispatcher<M0>::Instance()->AddBuffer(buffer_m0_);
     DataDispatcher<M1>::Instance()->AddBuffer(buffer_m1_);
     data_notifier_->AddNotifier(buffer_m0_.channel_id(), notifier_);
-    data_fusion_ = new fusion::AllLatest<M0, M1>(buffer_m0_, buffer_m1_);
+    switch (fusion_type) {
+      case fusion::FusionType::APPROXIMATE_TIME:
+        data_fusion_ =
+            new fusion::ApproximateTime<M0, M1>(buffer_m0_, buffer_m1_);
+        break;
+      default:
+        data_fusion_ = new fusion::AllLatest<M0, M1>(buffer_m0_, buffer_m1_);
+    }
   }
 
   ~DataVisitor() {
@@ -90,6 +90,30 @@ TEST(DataVisitorTest, two_channel) {
   EXPECT_FALSE(dv->TryFetch(msg0, msg1));
 }
 
+TEST(DataVisitorTest, two_channel_approximate_time) {
+  auto ch0 = str_hash("/channel_at0");
+  auto ch1 = str_hash("/channel_at1");
+  std::vector<VisitorConfig> configs;
+  configs.emplace_back(ch0, 10);
+  configs.emplace_back(ch1, 10);
+  auto dv = std::make_shared<DataVisitor<RawMessage, RawMessage>>(
+      configs, fusion::FusionType::APPROXIMATE_TIME);
+
+  std::shared_ptr<RawMessage> msg0;
+  std::shared_ptr<RawMessage> msg1;
+  DispatchMessage(ch0, 1);
+  EXPECT_FALSE(dv->TryFetch(msg0, msg1));
+  DispatchMessage(ch1, 1);
+  EXPECT_TRUE(dv->TryFetch(msg0, msg1));
+  // unlike ALL_LATEST, bundles consume their messages: a new m0 alone
+  // does not re-pair with the already consumed m1
+  DispatchMessage(ch0, 1);
+  EXPECT_FALSE(dv->TryFetch(msg0, msg1));
+  DispatchMessage(ch1, 1);
+  EXPECT_TRUE(dv->TryFetch(msg0, msg1));
+  EXPECT_FALSE(dv->TryFetch(msg0, msg1));
+}
+
 TEST(DataVisitorTest, three_channel) {
   auto dv = std::make_shared<DataVisitor<RawMessage, RawMessage, RawMessage>>(
       InitConfigs(3));
@@ -0,0 +1,368 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_DATA_FUSION_APPROXIMATE_TIME_H_
+#define CYBER_DATA_FUSION_APPROXIMATE_TIME_H_
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "cyber/common/types.h"
+#include "cyber/data/channel_buffer.h"
+#include "cyber/data/fusion/data_fusion.h"
+#include "cyber/time/time.h"
+
+namespace apollo {
+namespace cyber {
+namespace data {
+namespace fusion {
+
+// An approximate-time synchronizer in the spirit of message_filters.
+// Every channel feeds a short stamped queue (arrival time; cyber message
+// types carry no uniform header timestamp), and whenever the spread of
+// the queue heads fits within max_interval_ns an aligned bundle is
+// emitted into the fusion buffer, so the visitor wakes once per bundle
+// instead of re-checking stale tuples. The head with the oldest stamp is
+// discarded when the spread is too wide, which bounds the latency of a
+// match by queue depth.
+template <typename M0, typename M1 = NullType, typename M2 = NullType,
+          typename M3 = NullType>
+class ApproximateTime : public DataFusion<M0, M1, M2, M3> {
+  using FusionDataType = std::tuple<std::shared_ptr<M0>, std::shared_ptr<M1>,
+                                    std::shared_ptr<M2>, std::shared_ptr<M3>>;
+  template <typename M>
+  using StampedQueue = std::deque<std::pair<std::shared_ptr<M>, uint64_t>>;
+
+ public:
+  static const uint64_t kDefaultMaxIntervalNanoseconds = 100 * 1000 * 1000;
+  static const size_t kDefaultQueueDepth = 10;
+
+  ApproximateTime(const ChannelBuffer<M0>& buffer_0,
+                  const ChannelBuffer<M1>& buffer_1,
+                  const ChannelBuffer<M2>& buffer_2,
+                  const ChannelBuffer<M3>& buffer_3,
+                  uint64_t max_interval_ns = kDefaultMaxIntervalNanoseconds,
+                  size_t queue_depth = kDefaultQueueDepth)
+      : buffer_m0_(buffer_0),
+        buffer_m1_(buffer_1),
+        buffer_m2_(buffer_2),
+        buffer_m3_(buffer_3),
+        buffer_fusion_(buffer_m0_.channel_id(),
+                       new CacheBuffer<std::shared_ptr<FusionDataType>>(
+                           buffer_0.Buffer()->Capacity() - uint64_t(1))),
+        max_interval_ns_(max_interval_ns),
+        queue_depth_(queue_depth) {
+    buffer_m0_.Buffer()->SetFusionCallback(
+        [this](const std::shared_ptr<M0>& m0) { OnMessage(&q0_, m0); });
+    buffer_m1_.Buffer()->SetFusionCallback(
+        [this](const std::shared_ptr<M1>& m1) { OnMessage(&q1_, m1); });
+    buffer_m2_.Buffer()->SetFusionCallback(
+        [this](const std::shared_ptr<M2>& m2) { OnMessage(&q2_, m2); });
+    buffer_m3_.Buffer()->SetFusionCallback(
+        [this](const std::shared_ptr<M3>& m3) { OnMessage(&q3_, m3); });
+  }
+
+  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0, std::shared_ptr<M1>& m1,
+              std::shared_ptr<M2>& m2, std::shared_ptr<M3>& m3) override {
+    std::shared_ptr<FusionDataType> fusion_data;
+    if (!buffer_fusion_.Fetch(index, fusion_data)) {
+      return false;
+    }
+    m0 = std::get<0>(*fusion_data);
+    m1 = std::get<1>(*fusion_data);
+    m2 = std::get<2>(*fusion_data);
+    m3 = std::get<3>(*fusion_data);
+    return true;
+  }
+
+ private:
+  template <typename M>
+  void OnMessage(StampedQueue<M>* queue, const std::shared_ptr<M>& msg) {
+    std::lock_guard<std::mutex> lg(queues_mutex_);
+    queue->emplace_back(msg, Time::Now().ToNanosecond());
+    if (queue->size() > queue_depth_) {
+      queue->pop_front();
+    }
+    TryMatch();
+  }
+
+  void TryMatch() {
+    while (!q0_.empty() && !q1_.empty() && !q2_.empty() && !q3_.empty()) {
+      uint64_t stamps[4] = {q0_.front().second, q1_.front().second,
+                            q2_.front().second, q3_.front().second};
+      uint64_t min_stamp = stamps[0];
+      uint64_t max_stamp = stamps[0];
+      int min_idx = 0;
+      for (int i = 1; i < 4; ++i) {
+        if (stamps[i] < min_stamp) {
+          min_stamp = stamps[i];
+          min_idx = i;
+        }
+        if (stamps[i] > max_stamp) {
+          max_stamp = stamps[i];
+        }
+      }
+
+      if (max_stamp - min_stamp <= max_interval_ns_) {
+        auto data = std::make_shared<FusionDataType>(
+            q0_.front().first, q1_.front().first, q2_.front().first,
+            q3_.front().first);
+        q0_.pop_front();
+        q1_.pop_front();
+        q2_.pop_front();
+        q3_.pop_front();
+        std::lock_guard<std::mutex> lg(buffer_fusion_.Buffer()->Mutex());
+        buffer_fusion_.Buffer()->Fill(data);
+        continue;
+      }
+
+      // spread too wide: the oldest head can never be matched any more
+      switch (min_idx) {
+        case 0:
+          q0_.pop_front();
+          break;
+        case 1:
+          q1_.pop_front();
+          break;
+        case 2:
+          q2_.pop_front();
+          break;
+        default:
+          q3_.pop_front();
+          break;
+      }
+    }
+  }
+
+  ChannelBuffer<M0> buffer_m0_;
+  ChannelBuffer<M1> buffer_m1_;
+  ChannelBuffer<M2> buffer_m2_;
+  ChannelBuffer<M3> buffer_m3_;
+  ChannelBuffer<FusionDataType> buffer_fusion_;
+  uint64_t max_interval_ns_;
+  size_t queue_depth_;
+  std::mutex queues_mutex_;
+  StampedQueue<M0> q0_;
+  StampedQueue<M1> q1_;
+  StampedQueue<M2> q2_;
+  StampedQueue<M3> q3_;
+};
+
+template <typename M0, typename M1, typename M2>
+class ApproximateTime<M0, M1, M2, NullType> : public DataFusion<M0, M1, M2> {
+  using FusionDataType =
+      std::tuple<std::shared_ptr<M0>, std::shared_ptr<M1>, std::shared_ptr<M2>>;
+  template <typename M>
+  using StampedQueue = std::deque<std::pair<std::shared_ptr<M>, uint64_t>>;
+
+ public:
+  static const uint64_t kDefaultMaxIntervalNanoseconds = 100 * 1000 * 1000;
+  static const size_t kDefaultQueueDepth = 10;
+
+  ApproximateTime(const ChannelBuffer<M0>& buffer_0,
+                  const ChannelBuffer<M1>& buffer_1,
+                  const ChannelBuffer<M2>& buffer_2,
+                  uint64_t max_interval_ns = kDefaultMaxIntervalNanoseconds,
+                  size_t queue_depth = kDefaultQueueDepth)
+      : buffer_m0_(buffer_0),
+        buffer_m1_(buffer_1),
+        buffer_m2_(buffer_2),
+        buffer_fusion_(buffer_m0_.channel_id(),
+                       new CacheBuffer<std::shared_ptr<FusionDataType>>(
+                           buffer_0.Buffer()->Capacity() - uint64_t(1))),
+        max_interval_ns_(max_interval_ns),
+        queue_depth_(queue_depth) {
+    buffer_m0_.Buffer()->SetFusionCallback(
+        [this](const std::shared_ptr<M0>& m0) { OnMessage(&q0_, m0); });
+    buffer_m1_.Buffer()->SetFusionCallback(
+        [this](const std::shared_ptr<M1>& m1) { OnMessage(&q1_, m1); });
+    buffer_m2_.Buffer()->SetFusionCallback(
+        [this](const std::shared_ptr<M2>& m2) { OnMessage(&q2_, m2); });
+  }
+
+  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0, std::shared_ptr<M1>& m1,
+              std::shared_ptr<M2>& m2) override {
+    std::shared_ptr<FusionDataType> fusion_data;
+    if (!buffer_fusion_.Fetch(index, fusion_data)) {
+      return false;
+    }
+    m0 = std::get<0>(*fusion_data);
+    m1 = std::get<1>(*fusion_data);
+    m2 = std::get<2>(*fusion_data);
+    return true;
+  }
+
+ private:
+  template <typename M>
+  void OnMessage(StampedQueue<M>* queue, const std::shared_ptr<M>& msg) {
+    std::lock_guard<std::mutex> lg(queues_mutex_);
+    queue->emplace_back(msg, Time::Now().ToNanosecond());
+    if (queue->size() > queue_depth_) {
+      queue->pop_front();
+    }
+    TryMatch();
+  }
+
+  void TryMatch() {
+    while (!q0_.empty() && !q1_.empty() && !q2_.empty()) {
+      uint64_t stamps[3] = {q0_.front().second, q1_.front().second,
+                            q2_.front().second};
+      uint64_t min_stamp = stamps[0];
+      uint64_t max_stamp = stamps[0];
+      int min_idx = 0;
+      for (int i = 1; i < 3; ++i) {
+        if (stamps[i] < min_stamp) {
+          min_stamp = stamps[i];
+          min_idx = i;
+        }
+        if (stamps[i] > max_stamp) {
+          max_stamp = stamps[i];
+        }
+      }
+
+      if (max_stamp - min_stamp <= max_interval_ns_) {
+        auto data = std::make_shared<FusionDataType>(
+            q0_.front().first, q1_.front().first, q2_.front().first);
+        q0_.pop_front();
+        q1_.pop_front();
+        q2_.pop_front();
+        std::lock_guard<std::mutex> lg(buffer_fusion_.Buffer()->Mutex());
+        buffer_fusion_.Buffer()->Fill(data);
+        continue;
+      }
+
+      switch (min_idx) {
+        case 0:
+          q0_.pop_front();
+          break;
+        case 1:
+          q1_.pop_front();
+          break;
+        default:
+          q2_.pop_front();
+          break;
+      }
+    }
+  }
+
+  ChannelBuffer<M0> buffer_m0_;
+  ChannelBuffer<M1> buffer_m1_;
+  ChannelBuffer<M2> buffer_m2_;
+  ChannelBuffer<FusionDataType> buffer_fusion_;
+  uint64_t max_interval_ns_;
+  size_t queue_depth_;
+  std::mutex queues_mutex_;
+  StampedQueue<M0> q0_;
+  StampedQueue<M1> q1_;
+  StampedQueue<M2> q2_;
+};
+
+template <typename M0, typename M1>
+class ApproximateTime<M0, M1, NullType, NullType> : public DataFusion<M0, M1> {
+  using FusionDataType = std::tuple<std::shared_ptr<M0>, std::shared_ptr<M1>>;
+  template <typename M>
+  using StampedQueue = std::deque<std::pair<std::shared_ptr<M>, uint64_t>>;
+
+ public:
+  static const uint64_t kDefaultMaxIntervalNanoseconds = 100 * 1000 * 1000;
+  static const size_t kDefaultQueueDepth = 10;
+
+  ApproximateTime(const ChannelBuffer<M0>& buffer_0,
+                  const ChannelBuffer<M1>& buffer_1,
+                  uint64_t max_interval_ns = kDefaultMaxIntervalNanoseconds,
+                  size_t queue_depth = kDefaultQueueDepth)
+      : buffer_m0_(buffer_0),
+        buffer_m1_(buffer_1),
+        buffer_fusion_(buffer_m0_.channel_id(),
+                       new CacheBuffer<std::shared_ptr<FusionDataType>>(
+                           buffer_0.Buffer()->Capacity() - uint64_t(1))),
+        max_interval_ns_(max_interval_ns),
+        queue_depth_(queue_depth) {
+    buffer_m0_.Buffer()->SetFusionCallback(
+        [this](const std::shared_ptr<M0>& m0) { OnMessage(&q0_, m0); });
+    buffer_m1_.Buffer()->SetFusionCallback(
+        [this](const std::shared_ptr<M1>& m1) { OnMessage(&q1_, m1); });
+  }
+
+  bool Fusion(uint64_t* index, std::shared_ptr<M0>& m0,
+              std::shared_ptr<M1>& m1) override {
+    std::shared_ptr<FusionDataType> fusion_data;
+    if (!buffer_fusion_.Fetch(index, fusion_data)) {
+      return false;
+    }
+    m0 = std::get<0>(*fusion_data);
+    m1 = std::get<1>(*fusion_data);
+    return true;
+  }
+
+ private:
+  template <typename M>
+  void OnMessage(StampedQueue<M>* queue, const std::shared_ptr<M>& msg) {
+    std::lock_guard<std::mutex> lg(queues_mutex_);
+    queue->emplace_back(msg, Time::Now().ToNanosecond());
+    if (queue->size() > queue_depth_) {
+      queue->pop_front();
+    }
+    TryMatch();
+  }
+
+  void TryMatch() {
+    while (!q0_.empty() && !q1_.empty()) {
+      uint64_t stamp0 = q0_.front().second;
+      uint64_t stamp1 = q1_.front().second;
+      uint64_t spread = stamp0 > stamp1 ? stamp0 - stamp1 : stamp1 - stamp0;
+
+      if (spread <= max_interval_ns_) {
+        auto data = std::make_shared<FusionDataType>(q0_.front().first,
+                                                     q1_.front().first);
+        q0_.pop_front();
+        q1_.pop_front();
+        std::lock_guard<std::mutex> lg(buffer_fusion_.Buffer()->Mutex());
+        buffer_fusion_.Buffer()->Fill(data);
+        continue;
+      }
+
+      if (stamp0 < stamp1) {
+        q0_.pop_front();
+      } else {
+        q1_.pop_front();
+      }
+    }
+  }
+
+  ChannelBuffer<M0> buffer_m0_;
+  ChannelBuffer<M1> buffer_m1_;
+  ChannelBuffer<FusionDataType> buffer_fusion_;
+  uint64_t max_interval_ns_;
+  size_t queue_depth_;
+  std::mutex queues_mutex_;
+  StampedQueue<M0> q0_;
+  StampedQueue<M1> q1_;
+};
+
+}  // namespace fusion
+}  // namespace data
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_DATA_FUSION_APPROXIMATE_TIME_H_
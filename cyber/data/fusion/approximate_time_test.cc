@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "cyber/common/log.h"
+#include "cyber/cyber.h"
+#include "cyber/data/data_visitor.h"
+#include "cyber/data/fusion/approximate_time.h"
+
+namespace apollo {
+namespace cyber {
+namespace data {
+
+using apollo::cyber::message::RawMessage;
+
+TEST(ApproximateTimeTest, two_channels_aligned) {
+  auto cache0 = new CacheBuffer<std::shared_ptr<RawMessage>>(10);
+  auto cache1 = new CacheBuffer<std::shared_ptr<RawMessage>>(10);
+  ChannelBuffer<RawMessage> buffer0(static_cast<uint64_t>(0), cache0);
+  ChannelBuffer<RawMessage> buffer1(static_cast<uint64_t>(1), cache1);
+  std::shared_ptr<RawMessage> m0;
+  std::shared_ptr<RawMessage> m1;
+  uint64_t index = 0;
+  fusion::ApproximateTime<RawMessage, RawMessage> fusion(buffer0, buffer1);
+
+  EXPECT_FALSE(fusion.Fusion(&index, m0, m1));
+
+  // messages arriving close together form a bundle
+  cache0->Fill(std::make_shared<RawMessage>("0-0"));
+  EXPECT_FALSE(fusion.Fusion(&index, m0, m1));
+  cache1->Fill(std::make_shared<RawMessage>("1-0"));
+  EXPECT_TRUE(fusion.Fusion(&index, m0, m1));
+  index++;
+  EXPECT_EQ(std::string("0-0"), m0->message);
+  EXPECT_EQ(std::string("1-0"), m1->message);
+  EXPECT_FALSE(fusion.Fusion(&index, m0, m1));
+
+  // each bundle consumes its messages; no re-emission of stale pairs
+  cache0->Fill(std::make_shared<RawMessage>("0-1"));
+  EXPECT_FALSE(fusion.Fusion(&index, m0, m1));
+  cache1->Fill(std::make_shared<RawMessage>("1-1"));
+  EXPECT_TRUE(fusion.Fusion(&index, m0, m1));
+  index++;
+  EXPECT_EQ(std::string("0-1"), m0->message);
+  EXPECT_EQ(std::string("1-1"), m1->message);
+}
+
+TEST(ApproximateTimeTest, stale_message_discarded) {
+  auto cache0 = new CacheBuffer<std::shared_ptr<RawMessage>>(10);
+  auto cache1 = new CacheBuffer<std::shared_ptr<RawMessage>>(10);
+  ChannelBuffer<RawMessage> buffer0(static_cast<uint64_t>(0), cache0);
+  ChannelBuffer<RawMessage> buffer1(static_cast<uint64_t>(1), cache1);
+  std::shared_ptr<RawMessage> m0;
+  std::shared_ptr<RawMessage> m1;
+  uint64_t index = 0;
+  // 1ms interval so the sleep below makes the first message unmatchable
+  fusion::ApproximateTime<RawMessage, RawMessage> fusion(buffer0, buffer1,
+                                                         1000 * 1000, 10);
+
+  cache0->Fill(std::make_shared<RawMessage>("0-stale"));
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  cache0->Fill(std::make_shared<RawMessage>("0-fresh"));
+  cache1->Fill(std::make_shared<RawMessage>("1-0"));
+  EXPECT_TRUE(fusion.Fusion(&index, m0, m1));
+  index++;
+  EXPECT_EQ(std::string("0-fresh"), m0->message);
+  EXPECT_EQ(std::string("1-0"), m1->message);
+}
+
+TEST(ApproximateTimeTest, three_channels) {
+  auto cache0 = new CacheBuffer<std::shared_ptr<RawMessage>>(10);
+  auto cache1 = new CacheBuffer<std::shared_ptr<RawMessage>>(10);
+  auto cache2 = new CacheBuffer<std::shared_ptr<RawMessage>>(10);
+  ChannelBuffer<RawMessage> buffer0(static_cast<uint64_t>(0), cache0);
+  ChannelBuffer<RawMessage> buffer1(static_cast<uint64_t>(1), cache1);
+  ChannelBuffer<RawMessage> buffer2(static_cast<uint64_t>(2), cache2);
+  std::shared_ptr<RawMessage> m0;
+  std::shared_ptr<RawMessage> m1;
+  std::shared_ptr<RawMessage> m2;
+  uint64_t index = 0;
+  fusion::ApproximateTime<RawMessage, RawMessage, RawMessage> fusion(
+      buffer0, buffer1, buffer2);
+
+  cache0->Fill(std::make_shared<RawMessage>("0-0"));
+  cache1->Fill(std::make_shared<RawMessage>("1-0"));
+  EXPECT_FALSE(fusion.Fusion(&index, m0, m1, m2));
+  cache2->Fill(std::make_shared<RawMessage>("2-0"));
+  EXPECT_TRUE(fusion.Fusion(&index, m0, m1, m2));
+  index++;
+  EXPECT_EQ(std::string("0-0"), m0->message);
+  EXPECT_EQ(std::string("1-0"), m1->message);
+  EXPECT_EQ(std::string("2-0"), m2->message);
+}
+
+}  // namespace data
+}  // namespace cyber
+}  // namespace apollo
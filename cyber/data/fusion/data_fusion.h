@@ -31,6 +31,15 @@ namespace cyber {
 namespace data {
 namespace fusion {
 
+// Selects how a multi-channel DataVisitor combines its channels:
+// ALL_LATEST pairs every M0 with the latest message of the other
+// channels, APPROXIMATE_TIME emits bundles whose arrival times lie
+// within a bounded interval.
+enum class FusionType {
+  ALL_LATEST,
+  APPROXIMATE_TIME,
+};
+
 template <typename M0, typename M1 = NullType, typename M2 = NullType,
           typename M3 = NullType>
 class DataFusion {
@@ -16,6 +16,7 @@
 
 #include "cyber/event/perf_event_cache.h"
 
+#include <sstream>
 #include <string>
 
 #include "cyber/common/global_data.h"
@@ -39,10 +40,6 @@ PerfEventCache::PerfEventCache() {
   }
 
   if (enable_) {
-    if (!event_queue_.Init(kEventQueueSize)) {
-      AERROR << "Event queue init failed.";
-      throw std::runtime_error("Event queue init failed.");
-    }
     Start();
   }
 }
@@ -54,17 +51,28 @@ void PerfEventCache::Shutdown() {
     return;
   }
 
-  shutdown_ = true;
-  event_queue_.BreakAllWait();
+  shutdown_.store(true);
   if (io_thread_.joinable()) {
     io_thread_.join();
   }
+  // drain whatever the rings still hold
+  CollectAll();
 
   of_ << cyber::Time::Now().ToNanosecond() << std::endl;
   of_.flush();
   of_.close();
 }
 
+PerfEventRing* PerfEventCache::GetThreadRing() {
+  static thread_local std::shared_ptr<PerfEventRing> ring = nullptr;
+  if (ring == nullptr) {
+    ring = std::make_shared<PerfEventRing>();
+    std::lock_guard<std::mutex> lock(ring_mutex_);
+    rings_.emplace_back(RingEntry{ring, 0});
+  }
+  return ring.get();
+}
+
 void PerfEventCache::AddSchedEvent(const SchedPerf event_id,
                                    const uint64_t cr_id, const int proc_id,
                                    const int cr_state) {
@@ -77,14 +85,15 @@ void PerfEventCache::AddSchedEvent(const SchedPerf event_id,
     return;
   }
 
-  EventBasePtr e = std::make_shared<SchedEvent>();
-  e->set_eid(static_cast<int>(event_id));
-  e->set_stamp(Time::Now().ToNanosecond());
-  e->set_cr_state(cr_state);
-  e->set_cr_id(cr_id);
-  e->set_proc_id(proc_id);
+  PerfRecord record;
+  record.etype = static_cast<int32_t>(EventType::SCHED_EVENT);
+  record.eid = static_cast<int32_t>(event_id);
+  record.stamp = Time::Now().ToNanosecond();
+  record.cr_state = cr_state;
+  record.id = cr_id;
+  record.proc_id = proc_id;
 
-  event_queue_.Enqueue(e);
+  GetThreadRing()->Push(record);
 }
 
 void PerfEventCache::AddTransportEvent(const TransPerf event_id,
@@ -101,32 +110,80 @@ void PerfEventCache::AddTransportEvent(const TransPerf event_id,
     return;
   }
 
-  EventBasePtr e = std::make_shared<TransportEvent>();
-  e->set_eid(static_cast<int>(event_id));
-  e->set_channel_id(channel_id);
-  e->set_msg_seq(msg_seq);
-  e->set_adder(adder);
-  auto t = stamp;
-  if (stamp == 0) {
-    t = Time::Now().ToNanosecond();
+  PerfRecord record;
+  record.etype = static_cast<int32_t>(EventType::TRANS_EVENT);
+  record.eid = static_cast<int32_t>(event_id);
+  record.id = channel_id;
+  record.msg_seq = msg_seq;
+  record.stamp = stamp == 0 ? Time::Now().ToNanosecond() : stamp;
+  std::strncpy(record.adder, adder.c_str(), sizeof(record.adder) - 1);
+
+  GetThreadRing()->Push(record);
+}
+
+std::string PerfEventCache::FormatRecord(const PerfRecord& record) {
+  // keeps the line layout SchedEvent/TransportEvent::SerializeToString
+  // produced, so existing perf tooling reads the output unchanged
+  std::stringstream ss;
+  ss << record.etype << "\t";
+  ss << record.eid << "\t";
+  if (record.etype == static_cast<int32_t>(EventType::SCHED_EVENT)) {
+    ss << GlobalData::GetTaskNameById(record.id) << "\t";
+    ss << record.proc_id << "\t";
+    ss << record.cr_state << "\t";
+    ss << record.stamp;
+  } else {
+    ss << GlobalData::GetChannelById(record.id) << "\t";
+    ss << record.msg_seq << "\t";
+    ss << record.stamp << "\t";
+    ss << record.adder;
+  }
+  return ss.str();
+}
+
+void PerfEventCache::DrainRing(RingEntry* entry) {
+  PerfEventRing* ring = entry->ring.get();
+  const uint64_t produced = ring->next_seq_.load(std::memory_order_acquire);
+  if (produced > entry->next_read + PerfEventRing::kCapacity) {
+    // the writer lapped us; everything older has been overwritten
+    entry->next_read = produced - PerfEventRing::kCapacity;
+  }
+  while (entry->next_read < produced) {
+    const uint64_t seq = entry->next_read;
+    const uint32_t idx = static_cast<uint32_t>(seq % PerfEventRing::kCapacity);
+    const uint64_t slot_seq = ring->seqs_[idx].load(std::memory_order_acquire);
+    if (slot_seq < seq + 1) {
+      // reserved but not yet published; retry on the next pass
+      break;
+    }
+    if (slot_seq > seq + 1) {
+      // overwritten before we got to it
+      ++entry->next_read;
+      continue;
+    }
+    PerfRecord record = ring->records_[idx];
+    if (ring->seqs_[idx].load(std::memory_order_acquire) != seq + 1) {
+      // overwritten while copying; the copy may be torn, drop it
+      ++entry->next_read;
+      continue;
+    }
+    of_ << FormatRecord(record) << "\n";
+    ++entry->next_read;
   }
-  e->set_stamp(t);
+}
 
-  event_queue_.Enqueue(e);
+void PerfEventCache::CollectAll() {
+  std::lock_guard<std::mutex> lock(ring_mutex_);
+  for (auto& entry : rings_) {
+    DrainRing(&entry);
+  }
+  of_.flush();
 }
 
 void PerfEventCache::Run() {
-  EventBasePtr event;
-  int buf_size = 0;
-  while (!shutdown_ && !apollo::cyber::IsShutdown()) {
-    if (event_queue_.WaitDequeue(&event)) {
-      of_ << event->SerializeToString() << std::endl;
-      buf_size++;
-      if (buf_size >= kFlushSize) {
-        of_.flush();
-        buf_size = 0;
-      }
-    }
+  while (!shutdown_.load() && !apollo::cyber::IsShutdown()) {
+    CollectAll();
+    std::this_thread::sleep_for(std::chrono::milliseconds(kCollectIntervalMs));
   }
 }
 
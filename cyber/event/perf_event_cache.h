@@ -17,13 +17,16 @@
 #ifndef CYBER_EVENT_PERF_EVENT_CACHE_H_
 #define CYBER_EVENT_PERF_EVENT_CACHE_H_
 
+#include <atomic>
 #include <chrono>
+#include <cstring>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
-#include "cyber/base/bounded_queue.h"
 #include "cyber/common/macros.h"
 #include "cyber/event/perf_event.h"
 #include "cyber/proto/perf_conf.pb.h"
@@ -32,10 +35,57 @@ namespace apollo {
 namespace cyber {
 namespace event {
 
-class PerfEventCache {
+/**
+ * Fixed-size binary perf record. Hot-path writers fill one of these into
+ * a per-thread ring; the collector thread converts drained records to the
+ * established text format off the critical path, so no allocation or
+ * string formatting happens on the thread being measured.
+ */
+struct alignas(8) PerfRecord {
+  uint64_t stamp = 0;
+  uint64_t id = 0;  // cr_id for sched events, channel_id for transport
+  uint64_t msg_seq = 0;
+  int32_t etype = 0;
+  int32_t eid = 0;
+  int32_t proc_id = 0;
+  int32_t cr_state = -1;
+  char adder[24] = {0};
+};
+
+/**
+ * Single-writer ring of PerfRecords. Push is wait-free: the writer bumps
+ * the reservation counter, copies the record and publishes the slot's
+ * sequence with release semantics, the same scheme the shm
+ * ConditionNotifier indicator uses. The collector detects slots it lost
+ * to wrap-around by re-checking the slot sequence after copying.
+ */
+class PerfEventRing {
  public:
-  using EventBasePtr = std::shared_ptr<EventBase>;
+  static const uint32_t kCapacity = 4096;
+
+  PerfEventRing() {
+    for (uint32_t i = 0; i < kCapacity; ++i) {
+      seqs_[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  void Push(const PerfRecord& record) {
+    const uint64_t seq = next_seq_.fetch_add(1, std::memory_order_relaxed);
+    const uint32_t idx = static_cast<uint32_t>(seq % kCapacity);
+    records_[idx] = record;
+    seqs_[idx].store(seq + 1, std::memory_order_release);
+  }
+
+ private:
+  friend class PerfEventCache;
 
+  std::atomic<uint64_t> next_seq_ = {0};
+  PerfRecord records_[kCapacity];
+  std::atomic<uint64_t> seqs_[kCapacity];
+};
+
+class PerfEventCache {
+ public:
   ~PerfEventCache();
   void AddSchedEvent(const SchedPerf event_id, const uint64_t cr_id,
                      const int proc_id, const int cr_state = -1);
@@ -48,21 +98,33 @@ class PerfEventCache {
   void Shutdown();
 
  private:
+  struct RingEntry {
+    std::shared_ptr<PerfEventRing> ring;
+    // next sequence the collector will read; only the collector thread
+    // touches it
+    uint64_t next_read = 0;
+  };
+
   void Start();
   void Run();
+  PerfEventRing* GetThreadRing();
+  void CollectAll();
+  void DrainRing(RingEntry* entry);
+  std::string FormatRecord(const PerfRecord& record);
 
   std::thread io_thread_;
   std::ofstream of_;
 
   bool enable_ = false;
-  bool shutdown_ = false;
+  std::atomic<bool> shutdown_ = {false};
 
   proto::PerfConf perf_conf_;
   std::string perf_file_ = "";
-  base::BoundedQueue<EventBasePtr> event_queue_;
 
-  const int kFlushSize = 512;
-  const uint64_t kEventQueueSize = 8192;
+  std::mutex ring_mutex_;
+  std::vector<RingEntry> rings_;
+
+  const int kCollectIntervalMs = 20;
 
   DECLARE_SINGLETON(PerfEventCache)
 };
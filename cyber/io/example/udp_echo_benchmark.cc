@@ -0,0 +1,143 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "cyber/cyber.h"
+#include "cyber/init.h"
+#include "cyber/io/session.h"
+#include "cyber/scheduler/scheduler_factory.h"
+#include "cyber/task/task.h"
+#include "cyber/time/time.h"
+
+using apollo::cyber::Time;
+using apollo::cyber::io::Session;
+
+// Loopback echo benchmark for small UDP datagrams. The server drains its
+// socket with batched RecvMmsg (one syscall per burst) while the client
+// sends bursts and waits for all echoes, printing round trips per second.
+
+constexpr int kBatchSize = 32;
+constexpr int kDatagramSize = 64;
+constexpr int kRoundNum = 10000;
+
+void EchoServer(const std::shared_ptr<Session>& session) {
+  struct mmsghdr msgs[kBatchSize];
+  struct iovec iovecs[kBatchSize];
+  struct sockaddr_in addrs[kBatchSize];
+  std::vector<std::vector<char>> buffers(
+      kBatchSize, std::vector<char>(kDatagramSize));
+
+  while (true) {
+    std::memset(msgs, 0, sizeof(msgs));
+    for (int i = 0; i < kBatchSize; ++i) {
+      iovecs[i].iov_base = buffers[i].data();
+      iovecs[i].iov_len = buffers[i].size();
+      msgs[i].msg_hdr.msg_iov = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_hdr.msg_name = &addrs[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+    }
+    int num = session->RecvMmsg(msgs, kBatchSize, 0);
+    if (num <= 0) {
+      continue;
+    }
+    for (int i = 0; i < num; ++i) {
+      session->SendTo(buffers[i].data(), msgs[i].msg_len, 0,
+                      reinterpret_cast<const struct sockaddr*>(&addrs[i]),
+                      msgs[i].msg_hdr.msg_namelen);
+    }
+  }
+}
+
+void Client(uint16_t server_port) {
+  struct sockaddr_in server_addr;
+  server_addr.sin_family = AF_INET;
+  server_addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  server_addr.sin_port = htons(server_port);
+
+  auto session = std::make_shared<Session>();
+  session->Socket(AF_INET, SOCK_DGRAM, 0);
+
+  std::vector<char> send_buffer(kDatagramSize, 'x');
+  std::vector<char> recv_buffer(kDatagramSize);
+
+  auto start = Time::Now().ToNanosecond();
+  int received = 0;
+  for (int round = 0; round < kRoundNum / kBatchSize; ++round) {
+    for (int i = 0; i < kBatchSize; ++i) {
+      session->SendTo(send_buffer.data(), send_buffer.size(), 0,
+                      reinterpret_cast<const struct sockaddr*>(&server_addr),
+                      sizeof(server_addr));
+    }
+    for (int i = 0; i < kBatchSize; ++i) {
+      if (session->Recv(recv_buffer.data(), recv_buffer.size(), 0) > 0) {
+        ++received;
+      }
+    }
+  }
+  auto end = Time::Now().ToNanosecond();
+
+  double seconds = static_cast<double>(end - start) / 1e9;
+  std::cout << received << " echoes of " << kDatagramSize << " bytes in "
+            << seconds << " s, " << static_cast<int>(received / seconds)
+            << " round trips/s" << std::endl;
+  session->Close();
+  apollo::cyber::AsyncShutdown();
+}
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    std::cout << "Usage: " << argv[0] << " <server port>" << std::endl;
+    return -1;
+  }
+
+  apollo::cyber::Init(argv[0]);
+
+  uint16_t server_port = static_cast<uint16_t>(atoi(argv[1]));
+  apollo::cyber::scheduler::Instance()->CreateTask(
+      [&server_port]() {
+        struct sockaddr_in server_addr;
+        server_addr.sin_family = AF_INET;
+        server_addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        server_addr.sin_port = htons(server_port);
+
+        auto session = std::make_shared<Session>();
+        session->Socket(AF_INET, SOCK_DGRAM, 0);
+        if (session->Bind(reinterpret_cast<struct sockaddr*>(&server_addr),
+                          sizeof(server_addr)) < 0) {
+          std::cout << "bind to port[" << server_port << "] failed."
+                    << std::endl;
+          return;
+        }
+        EchoServer(session);
+        session->Close();
+      },
+      "echo_benchmark_server");
+
+  apollo::cyber::scheduler::Instance()->CreateTask(
+      [&server_port]() { Client(server_port); }, "echo_benchmark_client");
+
+  apollo::cyber::WaitForShutdown();
+  return 0;
+}
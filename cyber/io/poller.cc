@@ -18,6 +18,7 @@
 
 #include <fcntl.h>
 #include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <unistd.h>
 #include <csignal>
 #include <cstring>
@@ -110,42 +111,37 @@ bool Poller::Unregister(const PollRequest& req) {
 }
 
 bool Poller::Init() {
-  epoll_fd_ = epoll_create(kPollSize);
+  epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
   if (epoll_fd_ < 0) {
     AERROR << "epoll create failed, " << strerror(errno);
     return false;
   }
 
-  // create pipe, and set nonblock
-  if (pipe(pipe_fd_) == -1) {
-    AERROR << "create pipe failed, " << strerror(errno);
-    return false;
-  }
-  if (fcntl(pipe_fd_[0], F_SETFL, O_NONBLOCK) == -1) {
-    AERROR << "set nonblock failed, " << strerror(errno);
-    return false;
-  }
-  if (fcntl(pipe_fd_[1], F_SETFL, O_NONBLOCK) == -1) {
-    AERROR << "set nonblock failed, " << strerror(errno);
+  // an eventfd coalesces concurrent wakeups into one counter, so a burst
+  // of Register/Unregister calls costs one wakeup instead of one byte in
+  // a pipe per call
+  notify_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (notify_fd_ < 0) {
+    AERROR << "create eventfd failed, " << strerror(errno);
     return false;
   }
 
-  // add pipe[0] to epoll
+  // add notify_fd to epoll
   auto request = std::make_shared<PollRequest>();
-  request->fd = pipe_fd_[0];
+  request->fd = notify_fd_;
   request->events = EPOLLIN;
   request->timeout_ms = -1;
   request->callback = [this](const PollResponse&) {
-    char c = 0;
-    while (read(pipe_fd_[0], &c, 1) > 0) {
+    uint64_t count = 0;
+    while (read(notify_fd_, &count, sizeof(count)) > 0) {
     }
   };
   requests_[request->fd] = request;
 
   PollCtrlParam ctrl_param{};
   ctrl_param.operation = EPOLL_CTL_ADD;
-  ctrl_param.fd = pipe_fd_[0];
-  ctrl_param.event.data.fd = pipe_fd_[0];
+  ctrl_param.fd = notify_fd_;
+  ctrl_param.event.data.fd = notify_fd_;
   ctrl_param.event.events = EPOLLIN;
   ctrl_params_[ctrl_param.fd] = ctrl_param;
 
@@ -165,14 +161,9 @@ void Poller::Clear() {
     epoll_fd_ = -1;
   }
 
-  if (pipe_fd_[0] >= 0) {
-    close(pipe_fd_[0]);
-    pipe_fd_[0] = -1;
-  }
-
-  if (pipe_fd_[1] >= 0) {
-    close(pipe_fd_[1]);
-    pipe_fd_[1] = -1;
+  if (notify_fd_ >= 0) {
+    close(notify_fd_);
+    notify_fd_ = -1;
   }
 
   {
@@ -292,13 +283,8 @@ int Poller::GetTimeoutMs() {
 }
 
 void Poller::Notify() {
-  std::unique_lock<std::mutex> lock(pipe_mutex_, std::try_to_lock);
-  if (!lock.owns_lock()) {
-    return;
-  }
-
-  char msg = 'C';
-  if (write(pipe_fd_[1], &msg, 1) < 0) {
+  uint64_t one = 1;
+  if (write(notify_fd_, &one, sizeof(one)) < 0) {
     AWARN << "notify failed, " << strerror(errno);
   }
 }
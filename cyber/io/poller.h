@@ -59,8 +59,7 @@ class Poller {
   std::thread thread_;
   std::atomic<bool> is_shutdown_ = {true};
 
-  int pipe_fd_[2] = {-1, -1};
-  std::mutex pipe_mutex_;
+  int notify_fd_ = -1;
 
   RequestMap requests_;
   CtrlParamMap ctrl_params_;
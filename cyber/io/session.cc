@@ -136,6 +136,27 @@ ssize_t Session::RecvFrom(void *buf, size_t len, int flags,
   return nbytes;
 }
 
+int Session::RecvMmsg(struct mmsghdr *msgvec, unsigned int vlen, int flags,
+                      int timeout_ms) {
+  ACHECK(msgvec != nullptr);
+  ACHECK(fd_ != -1);
+
+  int num = recvmmsg(fd_, msgvec, vlen, flags, nullptr);
+  if (timeout_ms == 0) {
+    return num;
+  }
+
+  while (num == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    if (poll_handler_->Block(timeout_ms, true)) {
+      num = recvmmsg(fd_, msgvec, vlen, flags, nullptr);
+    }
+    if (timeout_ms > 0) {
+      break;
+    }
+  }
+  return num;
+}
+
 ssize_t Session::Send(const void *buf, size_t len, int flags, int timeout_ms) {
   ACHECK(buf != nullptr);
   ACHECK(fd_ != -1);
@@ -51,6 +51,10 @@ class Session {
   ssize_t Recv(void *buf, size_t len, int flags, int timeout_ms = -1);
   ssize_t RecvFrom(void *buf, size_t len, int flags, struct sockaddr *src_addr,
                    socklen_t *addrlen, int timeout_ms = -1);
+  // receives up to vlen datagrams with one syscall, for high-rate small
+  // datagram workloads; returns the number received
+  int RecvMmsg(struct mmsghdr *msgvec, unsigned int vlen, int flags,
+               int timeout_ms = -1);
 
   ssize_t Send(const void *buf, size_t len, int flags, int timeout_ms = -1);
   ssize_t SendTo(const void *buf, size_t len, int flags,
@@ -20,6 +20,8 @@
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "cyber/base/macros.h"
 #include "cyber/logger/log_file_object.h"
@@ -33,9 +35,13 @@ static std::unordered_map<std::string, LogFileObject*> moduleLoggerMap;
 static std::unordered_map<char, int> log_level_map = {
     {'F', 3}, {'E', 2}, {'W', 1}, {'I', 0}};
 
+static const uint64_t kQueueSize = 1 << 15;
+static const uint64_t kFlushBatchSize = 512;
+
 AsyncLogger::AsyncLogger(google::base::Logger* wrapped) : wrapped_(wrapped) {
-  active_buf_.reset(new std::deque<Msg>());
-  flushing_buf_.reset(new std::deque<Msg>());
+  if (!msg_queue_.Init(kQueueSize)) {
+    std::cerr << "async logger queue init failed." << std::endl;
+  }
 }
 
 AsyncLogger::~AsyncLogger() {
@@ -59,9 +65,13 @@ void AsyncLogger::Stop() {
     log_thread_.join();
   }
 
-  FlushBuffer(active_buf_);
-  CHECK(active_buf_->empty());
-  CHECK(flushing_buf_->empty());
+  // drain whatever raced in before the state change
+  std::vector<Msg> batch(kFlushBatchSize);
+  uint64_t num = 0;
+  while ((num = msg_queue_.DequeueBatch(batch.data(), kFlushBatchSize)) > 0) {
+    FlushBatch(batch.data(), num);
+  }
+  CHECK(msg_queue_.Empty());
   // std::cout << "Async Logger Stop!" << std::endl;
 }
 
@@ -72,13 +82,13 @@ void AsyncLogger::Write(bool force_flush, time_t timestamp, const char* message,
     // std::cout << "Async Logger not running!" << std::endl;
     return;
   }
-  auto msg_str = std::string(message, message_len);
-  while (flag_.test_and_set(std::memory_order_acquire)) {
-    cpu_relax();
+  Msg msg(timestamp, std::string(message, message_len),
+          log_level_map[message[0]]);
+  if (cyber_unlikely(!msg_queue_.Enqueue(std::move(msg)))) {
+    // the writer thread cannot keep up; dropping beats blocking the
+    // logging threads of every component sharing this process
+    drop_count_.fetch_add(1, std::memory_order_relaxed);
   }
-  active_buf_->emplace_back(timestamp, std::move(msg_str),
-                            log_level_map[message[0]]);
-  flag_.clear(std::memory_order_release);
 }
 
 void AsyncLogger::Flush() {
@@ -90,23 +100,23 @@ void AsyncLogger::Flush() {
 uint32_t AsyncLogger::LogSize() { return wrapped_->LogSize(); }
 
 void AsyncLogger::RunThread() {
+  std::vector<Msg> batch(kFlushBatchSize);
   while (state_ == RUNNING) {
-    while (flag_.test_and_set(std::memory_order_acquire)) {
-      cpu_relax();
+    uint64_t num = msg_queue_.DequeueBatch(batch.data(), kFlushBatchSize);
+    if (num > 0) {
+      FlushBatch(batch.data(), num);
+      flush_count_.fetch_add(1, std::memory_order_relaxed);
     }
-    active_buf_.swap(flushing_buf_);
-    flag_.clear(std::memory_order_release);
-    FlushBuffer(flushing_buf_);
-    if (active_buf_->size() < 800) {
+    if (msg_queue_.Size() < 800) {
       std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
   }
 }
 
-void AsyncLogger::FlushBuffer(const std::unique_ptr<std::deque<Msg>>& buffer) {
+void AsyncLogger::FlushBatch(Msg* msgs, uint64_t num) {
   std::string module_name = "";
-  while (!buffer->empty()) {
-    auto& msg = buffer->front();
+  for (uint64_t i = 0; i < num; ++i) {
+    auto& msg = msgs[i];
     FindModuleName(&(msg.message), &module_name);
 
     LogFileObject* fileobject = nullptr;
@@ -126,7 +136,6 @@ void AsyncLogger::FlushBuffer(const std::unique_ptr<std::deque<Msg>>& buffer) {
       fileobject->Write(force_flush, msg.ts, msg.message.data(),
                         static_cast<int>(msg.message.size()));
     }
-    buffer->pop_front();
   }
   Flush();
 }
@@ -18,18 +18,16 @@
 #define CYBER_LOGGER_ASYNC_LOGGER_H_
 
 #include <atomic>
-#include <condition_variable>
 #include <cstdint>
 #include <ctime>
-#include <deque>
 #include <iostream>
 #include <memory>
-#include <mutex>
 #include <string>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "cyber/base/bounded_queue.h"
 #include "cyber/common/macros.h"
 #include "glog/logging.h"
 
@@ -42,17 +40,15 @@ namespace logger {
  * @brief .
  * Wrapper for a glog Logger which asynchronously writes log messages.
  * This class starts a new thread responsible for forwarding the messages
- * to the logger, and performs double buffering. Writers append to the
- * current buffer and then wake up the logger thread. The logger swaps in
- * a new buffer and writes any accumulated messages to the wrapped
- * Logger.
+ * to the logger. Writers push messages onto a lock-free bounded queue
+ * and the logger thread drains it in batches and writes them to the
+ * wrapped Logger.
  *
- * This double-buffering design dramatically improves performance, especially
- * for logging messages which require flushing the underlying file (i.e WARNING
- * and above for default). The flush can take a couple of milliseconds, and in
- * some cases can even block for hundreds of milliseconds or more. With the
- * double-buffered approach, threads can proceed with useful work while the IO
- * thread blocks.
+ * This design dramatically improves performance, especially for logging
+ * messages which require flushing the underlying file (i.e WARNING and above
+ * for default). The flush can take a couple of milliseconds, and in some cases
+ * can even block for hundreds of milliseconds or more. With the queued
+ * approach, threads can proceed with useful work while the IO thread blocks.
  *
  * The semantics provided by this wrapper are slightly weaker than the default
  * glog semantics. By default, glog will immediately (synchronously) flush
@@ -63,9 +59,10 @@ namespace logger {
  * worth it. We do take care that a glog FATAL message flushes all buffered log
  * messages before exiting.
  *
- * @warning The logger limits the total amount of buffer space, so if the
- * underlying log blocks for too long, eventually the threads generating the log
- * messages will block as well. This prevents runaway memory usage.
+ * @warning The queue bounds the total amount of buffer space. If the
+ * underlying log blocks for too long the queue fills up, and further messages
+ * are dropped instead of blocking the logging threads; the drop count is
+ * exposed so log pressure stays visible.
  */
 class AsyncLogger : public google::base::Logger {
  public:
@@ -122,6 +119,20 @@ class AsyncLogger : public google::base::Logger {
    */
   std::thread* LogThread() { return &log_thread_; }
 
+  /**
+   * @brief Get the number of messages dropped because the queue was full.
+   *
+   * @return the dropped message count
+   */
+  uint64_t DroppedCount() const { return drop_count_.load(); }
+
+  /**
+   * @brief Get the number of batches the writer thread has flushed.
+   *
+   * @return the flushed batch count
+   */
+  uint64_t FlushCount() const { return flush_count_.load(); }
+
  private:
   // A buffered message.
   //
@@ -161,7 +172,7 @@ class AsyncLogger : public google::base::Logger {
   };
 
   void RunThread();
-  void FlushBuffer(const std::unique_ptr<std::deque<Msg>>& msg);
+  void FlushBatch(Msg* msgs, uint64_t num);
 
   google::base::Logger* const wrapped_;
   std::thread log_thread_;
@@ -170,21 +181,19 @@ class AsyncLogger : public google::base::Logger {
   // 64 bits should be enough to never worry about overflow.
   std::atomic<uint64_t> flush_count_ = {0};
 
-  // Count of how many times the writer thread has dropped the log messages.
+  // Count of how many log messages have been dropped on overflow.
   // 64 bits should be enough to never worry about overflow.
-  uint64_t drop_count_ = 0;
-
-  // The buffer to which application threads append new log messages.
-  std::unique_ptr<std::deque<Msg>> active_buf_;
+  std::atomic<uint64_t> drop_count_ = {0};
 
-  // The buffer currently being flushed by the logger thread, cleared
-  // after a successful flush.
-  std::unique_ptr<std::deque<Msg>> flushing_buf_;
+  // The queue to which application threads push new log messages, and
+  // from which the writer thread drains them in batches. When it is
+  // full, new messages are dropped and counted instead of blocking the
+  // logging threads.
+  base::BoundedQueue<Msg> msg_queue_;
 
   // Trigger for the logger thread to stop.
   enum State { INITTED, RUNNING, STOPPED };
   std::atomic<State> state_ = {INITTED};
-  std::atomic_flag flag_ = ATOMIC_FLAG_INIT;
 
   DISALLOW_COPY_AND_ASSIGN(AsyncLogger);
 };
@@ -16,11 +16,15 @@
 
 #include "cyber/mainboard/module_controller.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include <utility>
 
 #include "cyber/common/environment.h"
 #include "cyber/common/file.h"
 #include "cyber/component/component_base.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
@@ -35,6 +39,7 @@ void ModuleController::Clear() {
 }
 
 bool ModuleController::LoadAll() {
+  const auto start_time = Time::Now();
   const std::string work_root = common::WorkRoot();
   const std::string current_path = common::GetCurrentPath();
   const std::string dag_root_path = common::GetAbsolutePath(work_root, "dag");
@@ -54,20 +59,77 @@ bool ModuleController::LoadAll() {
         module_path = common::GetAbsolutePath(work_root, dag_conf);
       }
     }
-    total_component_nums += GetComponentNum(module_path);
     paths.emplace_back(std::move(module_path));
   }
+
+  // parse every dag conf once and reuse it for counting and loading
+  std::vector<DagConfig> dag_configs(paths.size());
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    if (!common::GetProtoFromFile(paths[i], &dag_configs[i])) {
+      AERROR << "Get proto failed, file: " << paths[i];
+      return false;
+    }
+    total_component_nums += GetComponentNum(dag_configs[i]);
+  }
   if (has_timer_component) {
     total_component_nums += scheduler::Instance()->TaskPoolSize();
   }
   common::GlobalData::Instance()->SetComponentNums(total_component_nums);
-  for (auto module_path : paths) {
-    AINFO << "Start initialize dag: " << module_path;
-    if (!LoadModule(module_path)) {
-      AERROR << "Failed to load module: " << module_path;
+  const auto parse_time = Time::Now();
+
+  // dlopen independent module libraries in parallel; Initialize below
+  // keeps the dag order, so dependent components still come up in order
+  std::vector<std::string> libraries;
+  for (auto& dag_config : dag_configs) {
+    for (auto& module_config : dag_config.module_config()) {
+      std::string load_path;
+      if (module_config.module_library().front() == '/') {
+        load_path = module_config.module_library();
+      } else {
+        load_path =
+            common::GetAbsolutePath(work_root, module_config.module_library());
+      }
+      if (!common::PathExists(load_path)) {
+        AERROR << "Path does not exist: " << load_path;
+        return false;
+      }
+      if (std::find(libraries.begin(), libraries.end(), load_path) ==
+          libraries.end()) {
+        libraries.emplace_back(std::move(load_path));
+      }
+    }
+  }
+  std::atomic<bool> load_success(true);
+  std::vector<std::thread> load_threads;
+  load_threads.reserve(libraries.size());
+  for (auto& library : libraries) {
+    load_threads.emplace_back([this, &library, &load_success]() {
+      if (!class_loader_manager_.LoadLibrary(library)) {
+        load_success.store(false);
+      }
+    });
+  }
+  for (auto& thread : load_threads) {
+    thread.join();
+  }
+  if (!load_success.load()) {
+    return false;
+  }
+  const auto load_time = Time::Now();
+
+  for (std::size_t i = 0; i < paths.size(); ++i) {
+    AINFO << "Start initialize dag: " << paths[i];
+    if (!LoadModule(dag_configs[i])) {
+      AERROR << "Failed to load module: " << paths[i];
       return false;
     }
   }
+  const auto end_time = Time::Now();
+  AINFO << "mainboard startup timing: dag parse "
+        << (parse_time - start_time).ToNanosecond() / 1000000 << " ms, "
+        << "library load " << (load_time - parse_time).ToNanosecond() / 1000000
+        << " ms, component init "
+        << (end_time - load_time).ToNanosecond() / 1000000 << " ms";
   return true;
 }
 
@@ -122,15 +184,12 @@ bool ModuleController::LoadModule(const std::string& path) {
   return LoadModule(dag_config);
 }
 
-int ModuleController::GetComponentNum(const std::string& path) {
-  DagConfig dag_config;
+int ModuleController::GetComponentNum(const DagConfig& dag_config) {
   int component_nums = 0;
-  if (common::GetProtoFromFile(path, &dag_config)) {
-    for (auto module_config : dag_config.module_config()) {
-      component_nums += module_config.components_size();
-      if (module_config.timer_components_size() > 0) {
-        has_timer_component = true;
-      }
+  for (auto module_config : dag_config.module_config()) {
+    component_nums += module_config.components_size();
+    if (module_config.timer_components_size() > 0) {
+      has_timer_component = true;
     }
   }
   return component_nums;
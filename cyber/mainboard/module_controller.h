@@ -43,7 +43,7 @@ class ModuleController {
  private:
   bool LoadModule(const std::string& path);
   bool LoadModule(const DagConfig& dag_config);
-  int GetComponentNum(const std::string& path);
+  int GetComponentNum(const DagConfig& dag_config);
   int total_component_nums = 0;
   bool has_timer_component = false;
 
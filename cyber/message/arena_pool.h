@@ -0,0 +1,179 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_MESSAGE_ARENA_POOL_H_
+#define CYBER_MESSAGE_ARENA_POOL_H_
+
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/message.h>
+
+#include "cyber/message/message_traits.h"
+
+namespace apollo {
+namespace cyber {
+namespace message {
+
+/**
+ * @class ArenaPool
+ * @brief A per-channel pool of recycled protobuf arenas used to
+ * deserialize incoming messages without per-message heap allocation.
+ * Each arena starts on a pool-owned block which Arena::Reset() keeps
+ * alive, so after warm-up a parse of a message that fits the block does
+ * not call malloc at all. Large channels (point clouds, images) opt in
+ * through `ReaderConfig::arena_parse`; everything else keeps the plain
+ * heap parse.
+ */
+class ArenaPool : public std::enable_shared_from_this<ArenaPool> {
+ public:
+  using ArenaPtr = std::shared_ptr<google::protobuf::Arena>;
+
+  /**
+   * @brief Get an arena whose first block is recycled from the pool.
+   * When the returned pointer drops its last reference the arena is
+   * reset and handed back, block included.
+   */
+  ArenaPtr Acquire() {
+    std::shared_ptr<Chunk> chunk;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!idle_chunks_.empty()) {
+        chunk = idle_chunks_.back();
+        idle_chunks_.pop_back();
+      }
+    }
+    if (chunk == nullptr) {
+      chunk = std::make_shared<Chunk>();
+    }
+    auto self = shared_from_this();
+    return ArenaPtr(chunk->arena.get(),
+                    [self, chunk](google::protobuf::Arena* arena) {
+                      arena->Reset();
+                      std::lock_guard<std::mutex> lock(self->mutex_);
+                      if (self->idle_chunks_.size() < kMaxIdleChunkNum) {
+                        self->idle_chunks_.push_back(chunk);
+                      }
+                    });
+  }
+
+  /**
+   * @brief Turn on arena deserialization for `channel_id`. The flag is
+   * read when the channel's receiver is created, so this must run before
+   * the first reader of the channel finishes Init().
+   */
+  static std::shared_ptr<ArenaPool> Enable(uint64_t channel_id) {
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+    auto& pool = Registry()[channel_id];
+    if (pool == nullptr) {
+      pool.reset(new ArenaPool());
+    }
+    return pool;
+  }
+
+  /**
+   * @brief Get the pool of `channel_id`, or nullptr when the channel has
+   * not been enabled for arena deserialization.
+   */
+  static std::shared_ptr<ArenaPool> Get(uint64_t channel_id) {
+    std::lock_guard<std::mutex> lock(RegistryMutex());
+    auto& registry = Registry();
+    auto search = registry.find(channel_id);
+    if (search == registry.end()) {
+      return nullptr;
+    }
+    return search->second;
+  }
+
+ private:
+  // One recycled unit: an arena and the pool-owned block it starts on.
+  // Arena::Reset() keeps a caller-provided initial block, so the block
+  // survives recycling and is reused parse after parse.
+  struct Chunk {
+    Chunk() : buf(new char[kChunkSize]) {
+      google::protobuf::ArenaOptions options;
+      options.initial_block = buf.get();
+      options.initial_block_size = kChunkSize;
+      arena.reset(new google::protobuf::Arena(options));
+    }
+    std::unique_ptr<char[]> buf;
+    std::unique_ptr<google::protobuf::Arena> arena;
+  };
+
+  static const std::size_t kChunkSize = 1024 * 1024;
+  static const std::size_t kMaxIdleChunkNum = 4;
+
+  static std::unordered_map<uint64_t, std::shared_ptr<ArenaPool>>& Registry() {
+    static std::unordered_map<uint64_t, std::shared_ptr<ArenaPool>> registry;
+    return registry;
+  }
+
+  static std::mutex& RegistryMutex() {
+    static std::mutex registry_mutex;
+    return registry_mutex;
+  }
+
+  ArenaPool() = default;
+
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<Chunk>> idle_chunks_;
+};
+
+/**
+ * @brief Parse `data` into a message allocated on one of `pool`'s
+ * arenas. The returned shared_ptr aliases the arena, which stays alive
+ * until the last reference to the message drops.
+ */
+template <typename M>
+typename std::enable_if<std::is_base_of<google::protobuf::Message, M>::value,
+                        std::shared_ptr<M>>::type
+ArenaParseFromArray(const std::shared_ptr<ArenaPool>& pool, const void* data,
+                    int size) {
+  auto arena = pool->Acquire();
+  M* msg = google::protobuf::Arena::CreateMessage<M>(arena.get());
+  if (!msg->ParseFromArray(data, size)) {
+    return nullptr;
+  }
+  return std::shared_ptr<M>(arena, msg);
+}
+
+/**
+ * @brief Non-protobuf messages cannot live on an arena, fall back to the
+ * regular heap parse.
+ */
+template <typename M>
+typename std::enable_if<!std::is_base_of<google::protobuf::Message, M>::value,
+                        std::shared_ptr<M>>::type
+ArenaParseFromArray(const std::shared_ptr<ArenaPool>& pool, const void* data,
+                    int size) {
+  (void)pool;
+  auto msg = std::make_shared<M>();
+  if (!ParseFromArray(data, size, msg.get())) {
+    return nullptr;
+  }
+  return msg;
+}
+
+}  // namespace message
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_MESSAGE_ARENA_POOL_H_
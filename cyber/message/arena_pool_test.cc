@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/message/arena_pool.h"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "cyber/message/raw_message.h"
+#include "cyber/proto/unit_test.pb.h"
+
+namespace apollo {
+namespace cyber {
+namespace message {
+
+TEST(ArenaPoolTest, enable_and_get) {
+  EXPECT_EQ(nullptr, ArenaPool::Get(100));
+  auto pool = ArenaPool::Enable(100);
+  ASSERT_NE(nullptr, pool);
+  EXPECT_EQ(pool, ArenaPool::Get(100));
+  // enabling twice keeps the same pool
+  EXPECT_EQ(pool, ArenaPool::Enable(100));
+}
+
+TEST(ArenaPoolTest, arena_parse) {
+  auto pool = ArenaPool::Enable(101);
+
+  proto::Chatter chatter;
+  chatter.set_timestamp(12345);
+  chatter.set_seq(1);
+  chatter.set_content("arena_parse");
+  std::string serialized;
+  ASSERT_TRUE(chatter.SerializeToString(&serialized));
+
+  auto msg = ArenaParseFromArray<proto::Chatter>(
+      pool, serialized.data(), static_cast<int>(serialized.size()));
+  ASSERT_NE(nullptr, msg);
+  EXPECT_EQ(12345, msg->timestamp());
+  EXPECT_EQ("arena_parse", msg->content());
+
+  // a corrupt buffer must not produce a message
+  std::string corrupt("\xff\xff\xff\xff", 4);
+  auto bad = ArenaParseFromArray<proto::Chatter>(
+      pool, corrupt.data(), static_cast<int>(corrupt.size()));
+  EXPECT_EQ(nullptr, bad);
+}
+
+TEST(ArenaPoolTest, arena_recycled) {
+  auto pool = ArenaPool::Enable(102);
+  google::protobuf::Arena* first = nullptr;
+  {
+    auto arena = pool->Acquire();
+    first = arena.get();
+    ASSERT_NE(nullptr, first);
+  }
+  // the arena went back to the pool and comes out again
+  auto arena = pool->Acquire();
+  EXPECT_EQ(first, arena.get());
+}
+
+TEST(ArenaPoolTest, non_protobuf_fallback) {
+  auto pool = ArenaPool::Enable(103);
+  std::string content("raw");
+  auto msg = ArenaParseFromArray<RawMessage>(
+      pool, content.data(), static_cast<int>(content.size()));
+  ASSERT_NE(nullptr, msg);
+  EXPECT_EQ(content, msg->message);
+}
+
+}  // namespace message
+}  // namespace cyber
+}  // namespace apollo
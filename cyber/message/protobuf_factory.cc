@@ -155,45 +155,53 @@ void ProtobufFactory::GetDescriptorString(const std::string& type,
 // Internal method
 google::protobuf::Message* ProtobufFactory::GenerateMessageByType(
     const std::string& type) const {
-  google::protobuf::Message* message = GetMessageByGeneratedType(type);
-  if (message != nullptr) {
-    return message;
-  }
-
-  const google::protobuf::Descriptor* descriptor =
-      pool_->FindMessageTypeByName(type);
-  if (descriptor == nullptr) {
-    AERROR << "cannot find [" << type << "] descriptor";
-    return nullptr;
+  // Fast path: the prototype for this type has been resolved before, so
+  // only the read side of the lock is taken and no descriptor pool lookup
+  // runs.
+  {
+    base::ReadLockGuard<base::AtomicRWLock> lock(prototype_lock_);
+    const auto it = prototype_cache_.find(type);
+    if (it != prototype_cache_.end()) {
+      return it->second->New();
+    }
   }
 
-  const google::protobuf::Message* prototype =
-      factory_->GetPrototype(descriptor);
+  const google::protobuf::Message* prototype = FindPrototypeByType(type);
   if (prototype == nullptr) {
-    AERROR << "cannot find [" << type << "] prototype";
     return nullptr;
   }
 
+  {
+    base::WriteLockGuard<base::AtomicRWLock> lock(prototype_lock_);
+    prototype_cache_.emplace(type, prototype);
+  }
   return prototype->New();
 }
 
-google::protobuf::Message* ProtobufFactory::GetMessageByGeneratedType(
+const google::protobuf::Message* ProtobufFactory::FindPrototypeByType(
     const std::string& type) const {
   auto descriptor =
       DescriptorPool::generated_pool()->FindMessageTypeByName(type);
+  if (descriptor != nullptr) {
+    auto prototype =
+        MessageFactory::generated_factory()->GetPrototype(descriptor);
+    if (prototype != nullptr) {
+      return prototype;
+    }
+  }
+
+  descriptor = pool_->FindMessageTypeByName(type);
   if (descriptor == nullptr) {
-    // AERROR << "cannot find [" << type << "] descriptor";
+    AERROR << "cannot find [" << type << "] descriptor";
     return nullptr;
   }
 
-  auto prototype =
-      MessageFactory::generated_factory()->GetPrototype(descriptor);
+  auto prototype = factory_->GetPrototype(descriptor);
   if (prototype == nullptr) {
-    // AERROR << "cannot find [" << type << "] prototype";
+    AERROR << "cannot find [" << type << "] prototype";
     return nullptr;
   }
-
-  return prototype->New();
+  return prototype;
 }
 
 const Descriptor* ProtobufFactory::FindMessageTypeByName(
@@ -21,7 +21,9 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
+#include "cyber/base/atomic_rw_lock.h"
 #include "cyber/common/macros.h"
 #include "cyber/proto/proto_desc.pb.h"
 #include "google/protobuf/compiler/parser.h"
@@ -96,7 +98,7 @@ class ProtobufFactory {
 
  private:
   bool RegisterMessage(const ProtoDesc& proto_desc);
-  google::protobuf::Message* GetMessageByGeneratedType(
+  const google::protobuf::Message* FindPrototypeByType(
       const std::string& type) const;
   static bool GetProtoDesc(const FileDescriptor* file_desc,
                            ProtoDesc* proto_desc);
@@ -105,6 +107,14 @@ class ProtobufFactory {
   std::unique_ptr<DescriptorPool> pool_ = nullptr;
   std::unique_ptr<DynamicMessageFactory> factory_ = nullptr;
 
+  // Prototype instances cached per message type. Descriptors are immutable
+  // once built, so a cached prototype never goes stale; readers take the
+  // shared side of the lock and stop contending on the registration mutex
+  // when many channels are deserialized generically.
+  mutable base::AtomicRWLock prototype_lock_;
+  mutable std::unordered_map<std::string, const google::protobuf::Message*>
+      prototype_cache_;
+
   DECLARE_SINGLETON(ProtobufFactory);
 };
 
@@ -23,6 +23,7 @@
 #include "cyber/blocker/intra_reader.h"
 #include "cyber/blocker/intra_writer.h"
 #include "cyber/common/global_data.h"
+#include "cyber/message/arena_pool.h"
 #include "cyber/message/message_traits.h"
 #include "cyber/node/reader.h"
 #include "cyber/node/writer.h"
@@ -43,11 +44,13 @@ struct ReaderConfig {  ///< configurations for a Reader
     qos_profile.set_durability(proto::QosDurabilityPolicy::DURABILITY_VOLATILE);
 
     pending_queue_size = DEFAULT_PENDING_QUEUE_SIZE;
+    arena_parse = false;
   }
   ReaderConfig(const ReaderConfig& other)
       : channel_name(other.channel_name),
         qos_profile(other.qos_profile),
-        pending_queue_size(other.pending_queue_size) {}
+        pending_queue_size(other.pending_queue_size),
+        arena_parse(other.arena_parse) {}
 
   std::string channel_name;       //< channel reads
   proto::QosProfile qos_profile;  //< the qos configuration
@@ -56,6 +59,14 @@ struct ReaderConfig {  ///< configurations for a Reader
    * Older messages will dropped if you have no time to handle
    */
   uint32_t pending_queue_size;
+  /**
+   * @brief deserialize incoming messages into recycled protobuf arenas
+   * instead of fresh heap allocations. Meant for big-message channels
+   * (point clouds, images) where per-message malloc fragments the heap
+   * over long runs. The flag of the first reader created on a channel
+   * decides for the whole process.
+   */
+  bool arena_parse;
 };
 
 /**
@@ -193,6 +204,12 @@ auto NodeChannelImpl::CreateReader(const ReaderConfig& config,
   proto::RoleAttributes role_attr;
   role_attr.set_channel_name(config.channel_name);
   role_attr.mutable_qos_profile()->CopyFrom(config.qos_profile);
+  if (config.arena_parse) {
+    // must precede receiver creation, the channel's dispatcher adapter
+    // picks the pool up when the first reader registers
+    message::ArenaPool::Enable(
+        GlobalData::RegisterChannel(config.channel_name));
+  }
   return this->template CreateReader<MessageT>(role_attr, reader_func,
                                                config.pending_queue_size);
 }
@@ -17,7 +17,9 @@
 #ifndef CYBER_NODE_WRITER_H_
 #define CYBER_NODE_WRITER_H_
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -25,6 +27,7 @@
 #include "cyber/node/writer_base.h"
 #include "cyber/proto/topology_change.pb.h"
 #include "cyber/service_discovery/topology_manager.h"
+#include "cyber/time/time.h"
 #include "cyber/transport/transport.h"
 
 namespace apollo {
@@ -83,6 +86,25 @@ class Writer : public WriterBase {
    */
   virtual bool Write(const std::shared_ptr<MessageT>& msg_ptr);
 
+  /**
+   * @brief Enable small-message coalescing for this Writer.
+   *
+   * Messages buffer until max_batch messages are pending or max_delay_us
+   * microseconds have passed since the oldest pending message, then
+   * transmit back to back. Readers drain the burst in a single wakeup,
+   * so high-rate telemetry channels pay the dispatch overhead once per
+   * batch instead of once per message. The delay deadline is checked on
+   * the next Write, so a trailing message can wait up to one publish
+   * period; only opt in on channels that publish continuously and
+   * tolerate max_delay_us of added latency.
+   *
+   * Must be called before the first Write.
+   *
+   * @param max_batch flush after this many pending messages
+   * @param max_delay_us flush when the oldest pending message is this old
+   */
+  void SetCoalescing(uint32_t max_batch, uint64_t max_delay_us);
+
   /**
    * @brief Is there any Reader that subscribes our Channel?
    * You can publish message when this return true
@@ -103,9 +125,18 @@ class Writer : public WriterBase {
   void JoinTheTopology();
   void LeaveTheTopology();
   void OnChannelChange(const proto::ChangeMsg& change_msg);
+  // transmit and drop all pending messages; callers hold coalesce_mutex_
+  void FlushCoalesced();
 
   TransmitterPtr transmitter_;
 
+  bool coalescing_enabled_ = false;
+  uint32_t coalesce_max_batch_ = 0;
+  uint64_t coalesce_max_delay_ns_ = 0;
+  uint64_t coalesce_oldest_ns_ = 0;
+  std::mutex coalesce_mutex_;
+  std::vector<std::shared_ptr<MessageT>> coalesce_buf_;
+
   ChangeConnection change_conn_;
   service_discovery::ChannelManagerPtr channel_manager_;
 };
@@ -151,6 +182,10 @@ void Writer<MessageT>::Shutdown() {
     init_ = false;
   }
   LeaveTheTopology();
+  if (coalescing_enabled_) {
+    std::lock_guard<std::mutex> lock(coalesce_mutex_);
+    FlushCoalesced();
+  }
   transmitter_ = nullptr;
   channel_manager_ = nullptr;
 }
@@ -165,9 +200,38 @@ bool Writer<MessageT>::Write(const MessageT& msg) {
 template <typename MessageT>
 bool Writer<MessageT>::Write(const std::shared_ptr<MessageT>& msg_ptr) {
   RETURN_VAL_IF(!WriterBase::IsInit(), false);
+  if (coalescing_enabled_) {
+    std::lock_guard<std::mutex> lock(coalesce_mutex_);
+    if (coalesce_buf_.empty()) {
+      coalesce_oldest_ns_ = Time::Now().ToNanosecond();
+    }
+    coalesce_buf_.emplace_back(msg_ptr);
+    if (coalesce_buf_.size() >= coalesce_max_batch_ ||
+        Time::Now().ToNanosecond() - coalesce_oldest_ns_ >=
+            coalesce_max_delay_ns_) {
+      FlushCoalesced();
+    }
+    return true;
+  }
   return transmitter_->Transmit(msg_ptr);
 }
 
+template <typename MessageT>
+void Writer<MessageT>::SetCoalescing(uint32_t max_batch,
+                                     uint64_t max_delay_us) {
+  coalesce_max_batch_ = std::max(max_batch, 1u);
+  coalesce_max_delay_ns_ = max_delay_us * 1000;
+  coalescing_enabled_ = true;
+}
+
+template <typename MessageT>
+void Writer<MessageT>::FlushCoalesced() {
+  for (auto& msg_ptr : coalesce_buf_) {
+    transmitter_->Transmit(msg_ptr);
+  }
+  coalesce_buf_.clear();
+}
+
 template <typename MessageT>
 void Writer<MessageT>::JoinTheTopology() {
   // add listener
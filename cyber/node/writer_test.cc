@@ -72,6 +72,29 @@ TEST(WriterTest, test2) {
   EXPECT_FALSE(w.Write(c));
 }
 
+TEST(WriterTest, coalescing) {
+  proto::RoleAttributes role;
+  role.set_channel_name("/chatter1");
+  role.set_node_name("chatter_node");
+
+  Writer<Chatter> w(role);
+  w.SetCoalescing(4, 1000000);
+  EXPECT_TRUE(w.Init());
+
+  for (uint64_t seq = 0; seq < 10; ++seq) {
+    auto c = std::make_shared<Chatter>();
+    c->set_timestamp(Time::Now().ToNanosecond());
+    c->set_lidar_timestamp(Time::Now().ToNanosecond());
+    c->set_seq(seq);
+    c->set_content("ChatterMsg");
+    EXPECT_TRUE(w.Write(c));
+  }
+
+  // Shutdown flushes the two messages still pending after the second
+  // batch of four.
+  w.Shutdown();
+}
+
 }  // namespace writer
 }  // namespace cyber
 }  // namespace apollo
@@ -32,10 +32,26 @@ ParameterClient::ParameterClient(const std::shared_ptr<Node>& node,
 
   list_parameters_client_ = node_->CreateClient<NodeName, Params>(
       FixParameterServiceName(service_node_name, LIST_PARAMETERS_SERVICE_NAME));
+
+  parameter_event_reader_ = node_->CreateReader<Param>(
+      FixParameterServiceName(service_node_name, PARAMETER_EVENTS_CHANNEL_NAME),
+      [this](const std::shared_ptr<Param>& event) {
+        std::lock_guard<std::mutex> lock(param_cache_mutex_);
+        param_cache_[event->name()] = *event;
+      });
 }
 
 bool ParameterClient::GetParameter(const std::string& param_name,
                                    Parameter* parameter) {
+  {
+    std::lock_guard<std::mutex> lock(param_cache_mutex_);
+    auto it = param_cache_.find(param_name);
+    if (it != param_cache_.end()) {
+      parameter->FromProtoParam(it->second);
+      return true;
+    }
+  }
+
   auto request = std::make_shared<ParamName>();
   request->set_value(param_name);
   auto response = get_parameter_client_->SendRequest(request);
@@ -47,7 +63,12 @@ bool ParameterClient::GetParameter(const std::string& param_name,
     AWARN << "Parameter " << param_name << " not exists yet.";
     return false;
   }
-  parameter->FromProtoParam(*response);
+
+  std::lock_guard<std::mutex> lock(param_cache_mutex_);
+  // A push event may have delivered a newer value while the request was in
+  // flight; if so, it wins over the response.
+  auto it = param_cache_.emplace(param_name, *response).first;
+  parameter->FromProtoParam(it->second);
   return true;
 }
 
@@ -58,6 +79,12 @@ bool ParameterClient::SetParameter(const Parameter& parameter) {
     AERROR << "Call " << set_parameter_client_->ServiceName() << " failed";
     return false;
   }
+  if (response->value()) {
+    // Write through so that our own reads see the new value before the
+    // server's push event arrives.
+    std::lock_guard<std::mutex> lock(param_cache_mutex_);
+    param_cache_[request->name()] = *request;
+  }
   return response->value();
 }
 
@@ -69,10 +96,13 @@ bool ParameterClient::ListParameters(std::vector<Parameter>* parameters) {
     AERROR << "Call " << list_parameters_client_->ServiceName() << " failed";
     return false;
   }
+  std::lock_guard<std::mutex> lock(param_cache_mutex_);
   for (auto& param : response->param()) {
     Parameter parameter;
     parameter.FromProtoParam(param);
     parameters->emplace_back(parameter);
+    // Warm the cache; cached entries are newer or equal, so keep them.
+    param_cache_.emplace(param.name(), param);
   }
   return true;
 }
@@ -18,9 +18,12 @@
 #define CYBER_PARAMETER_PARAMETER_CLIENT_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "cyber/node/reader.h"
 #include "cyber/parameter/parameter.h"
 #include "cyber/proto/parameter.pb.h"
 #include "cyber/service/client.h"
@@ -34,6 +37,10 @@ class Node;
  * @class ParameterClient
  * @brief Parameter Client is used to set/get/list parameter(s)
  * by sending a request to ParameterServer
+ *
+ * Parameters read once are cached locally and kept fresh by the server's
+ * parameter events channel, so repeated GetParameter calls on the same
+ * name do not pay a service round trip.
  */
 class ParameterClient {
  public:
@@ -57,6 +64,9 @@ class ParameterClient {
   /**
    * @brief Get the Parameter object
    *
+   * A cached value is returned without a service call when the parameter
+   * has been read before; the cache is updated by server push events.
+   *
    * @param param_name
    * @param parameter the pointer to store
    * @return true
@@ -89,6 +99,10 @@ class ParameterClient {
   std::shared_ptr<GetParameterClient> get_parameter_client_;
   std::shared_ptr<SetParameterClient> set_parameter_client_;
   std::shared_ptr<ListParametersClient> list_parameters_client_;
+  std::shared_ptr<Reader<Param>> parameter_event_reader_;
+
+  std::mutex param_cache_mutex_;
+  std::unordered_map<std::string, Param> param_cache_;
 };
 
 }  // namespace cyber
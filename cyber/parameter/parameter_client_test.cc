@@ -72,7 +72,25 @@ TEST_F(ParameterClientTest, get_parameter) {
   EXPECT_FALSE(pc_->GetParameter("double", &parameter));
 
   ps_.reset();
-  EXPECT_FALSE(pc_->GetParameter("int", &parameter));
+  // "int" was cached by the successful read above, so it is still served
+  // locally; parameters never read stay unavailable.
+  EXPECT_TRUE(pc_->GetParameter("int", &parameter));
+  EXPECT_EQ(1, parameter.AsInt64());
+  EXPECT_FALSE(pc_->GetParameter("double", &parameter));
+}
+
+TEST_F(ParameterClientTest, parameter_event_updates_cache) {
+  EXPECT_TRUE(pc_->SetParameter(Parameter("int", 1)));
+  Parameter parameter;
+  EXPECT_TRUE(pc_->GetParameter("int", &parameter));
+  EXPECT_EQ(1, parameter.AsInt64());
+
+  // A server-side write is pushed to the client over the events channel
+  // and refreshes the cached entry without another service call.
+  ps_->SetParameter(Parameter("int", 2));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_TRUE(pc_->GetParameter("int", &parameter));
+  EXPECT_EQ(2, parameter.AsInt64());
 }
 
 TEST_F(ParameterClientTest, list_parameter) {
@@ -24,6 +24,9 @@ namespace cyber {
 ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
     : node_(node) {
   auto name = node_->Name();
+  parameter_event_writer_ = node_->CreateWriter<Param>(
+      FixParameterServiceName(name, PARAMETER_EVENTS_CHANNEL_NAME));
+
   get_parameter_service_ = node_->CreateService<ParamName, Param>(
       FixParameterServiceName(name, GET_PARAMETER_SERVICE_NAME),
       [this](const std::shared_ptr<ParamName>& request,
@@ -40,9 +43,12 @@ ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
       FixParameterServiceName(name, SET_PARAMETER_SERVICE_NAME),
       [this](const std::shared_ptr<Param>& request,
              std::shared_ptr<BoolResult>& response) {
-        std::lock_guard<std::mutex> lock(param_map_mutex_);
-        param_map_[request->name()] = *request;
+        {
+          std::lock_guard<std::mutex> lock(param_map_mutex_);
+          param_map_[request->name()] = *request;
+        }
         response->set_value(true);
+        parameter_event_writer_->Write(request);
       });
 
   list_parameters_service_ = node_->CreateService<NodeName, Params>(
@@ -58,8 +64,12 @@ ParameterServer::ParameterServer(const std::shared_ptr<Node>& node)
 }
 
 void ParameterServer::SetParameter(const Parameter& parameter) {
-  std::lock_guard<std::mutex> lock(param_map_mutex_);
-  param_map_[parameter.Name()] = parameter.ToProtoParam();
+  auto param = std::make_shared<Param>(parameter.ToProtoParam());
+  {
+    std::lock_guard<std::mutex> lock(param_map_mutex_);
+    param_map_[param->name()] = *param;
+  }
+  parameter_event_writer_->Write(param);
 }
 
 bool ParameterServer::GetParameter(const std::string& parameter_name,
@@ -22,6 +22,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "cyber/node/writer.h"
 #include "cyber/parameter/parameter.h"
 #include "cyber/proto/parameter.pb.h"
 #include "cyber/service/service.h"
@@ -83,6 +84,7 @@ class ParameterServer {
   std::shared_ptr<Service<ParamName, Param>> get_parameter_service_;
   std::shared_ptr<Service<Param, BoolResult>> set_parameter_service_;
   std::shared_ptr<Service<NodeName, Params>> list_parameters_service_;
+  std::shared_ptr<Writer<Param>> parameter_event_writer_;
 
   std::mutex param_map_mutex_;
   std::unordered_map<std::string, Param> param_map_;
@@ -133,6 +133,70 @@ PyObject *cyber_PyRecordReader_ReadMessage(PyObject *self, PyObject *args) {
   return pyobj_bag_message;
 }
 
+PyObject *cyber_PyRecordReader_ReadMessagesBuffered(PyObject *self,
+                                                    PyObject *args) {
+  PyObject *pyobj_reader = nullptr;
+  char *channel_filter = nullptr;
+  uint64_t max_count = 0;
+  uint64_t begin_time = 0;
+  uint64_t end_time = UINT64_MAX;
+  if (!PyArg_ParseTuple(
+          args,
+          const_cast<char *>("OsKKK:PyRecordReader_ReadMessagesBuffered"),
+          &pyobj_reader, &channel_filter, &max_count, &begin_time,
+          &end_time)) {
+    return nullptr;
+  }
+
+  auto *reader = reinterpret_cast<PyRecordReader *>(PyCapsule_GetPointer(
+      pyobj_reader, "apollo_cyber_record_pyrecordfilereader"));
+  if (nullptr == reader) {
+    AERROR << "PyRecordReader_ReadMessagesBuffered ptr is null!";
+    return nullptr;
+  }
+
+  const auto &messages = reader->ReadMessagesBuffered(channel_filter,
+                                                      max_count, begin_time,
+                                                      end_time);
+  PyObject *pyobj_message_list = PyList_New(messages.size());
+  for (size_t i = 0; i < messages.size(); ++i) {
+    const auto &message = messages[i];
+    PyObject *pyobj_bag_message = PyDict_New();
+
+    PyObject *bld_name = Py_BuildValue("s", message.channel_name.c_str());
+    PyDict_SetItemString(pyobj_bag_message, "channel_name", bld_name);
+    Py_DECREF(bld_name);
+
+    // Expose the payload as a read-only view over the reader-owned buffer
+    // instead of copying it into bytes; views stay valid until the next
+    // ReadMessagesBuffered call on this reader.
+#if PY_MAJOR_VERSION >= 3
+    PyObject *bld_data = PyMemoryView_FromMemory(
+        const_cast<char *>(message.content.data()),
+        static_cast<Py_ssize_t>(message.content.size()), PyBUF_READ);
+#else
+    PyObject *bld_data = PyBuffer_FromMemory(
+        const_cast<char *>(message.content.data()),
+        static_cast<Py_ssize_t>(message.content.size()));
+#endif
+    CHECK(bld_data) << "create payload view failed.";
+    PyDict_SetItemString(pyobj_bag_message, "data", bld_data);
+    Py_DECREF(bld_data);
+
+    const std::string data_type = reader->GetMessageType(message.channel_name);
+    PyObject *bld_type = Py_BuildValue("s", data_type.c_str());
+    PyDict_SetItemString(pyobj_bag_message, "data_type", bld_type);
+    Py_DECREF(bld_type);
+
+    PyObject *bld_rtime = Py_BuildValue("K", message.time);
+    PyDict_SetItemString(pyobj_bag_message, "timestamp", bld_rtime);
+    Py_DECREF(bld_rtime);
+
+    PyList_SET_ITEM(pyobj_message_list, i, pyobj_bag_message);
+  }
+  return pyobj_message_list;
+}
+
 PyObject *cyber_PyRecordReader_GetMessageNumber(PyObject *self,
                                                 PyObject *args) {
   PyObject *pyobj_reader = nullptr;
@@ -535,6 +599,8 @@ static PyMethodDef _cyber_record_methods[] = {
     {"delete_PyRecordReader", cyber_delete_PyRecordReader, METH_VARARGS, ""},
     {"PyRecordReader_ReadMessage", cyber_PyRecordReader_ReadMessage,
      METH_VARARGS, ""},
+    {"PyRecordReader_ReadMessagesBuffered",
+     cyber_PyRecordReader_ReadMessagesBuffered, METH_VARARGS, ""},
     {"PyRecordReader_GetMessageNumber", cyber_PyRecordReader_GetMessageNumber,
      METH_VARARGS, ""},
     {"PyRecordReader_GetMessageType", cyber_PyRecordReader_GetMessageType,
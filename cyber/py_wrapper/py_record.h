@@ -25,6 +25,8 @@
 #include <set>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "cyber/message/protobuf_factory.h"
 #include "cyber/message/py_message.h"
@@ -70,6 +72,28 @@ class PyRecordReader {
     return ret_msg;
   }
 
+  // Reads up to max_count messages, optionally restricted to one channel,
+  // into a reader-owned buffer. The binding exposes the payloads through the
+  // buffer protocol instead of copying them into Python bytes, leaving the
+  // protobuf decode to happen lazily on access; the buffer is reused by the
+  // next call, which invalidates previously returned views.
+  const std::vector<RecordMessage>& ReadMessagesBuffered(
+      const std::string& channel_filter, uint64_t max_count,
+      uint64_t begin_time = 0, uint64_t end_time = UINT64_MAX) {
+    buffered_messages_.clear();
+    RecordMessage record_message;
+    while (buffered_messages_.size() < max_count &&
+           record_reader_->ReadMessage(&record_message, begin_time,
+                                       end_time)) {
+      if (!channel_filter.empty() &&
+          record_message.channel_name != channel_filter) {
+        continue;
+      }
+      buffered_messages_.push_back(std::move(record_message));
+    }
+    return buffered_messages_;
+  }
+
   uint64_t GetMessageNumber(const std::string& channel_name) {
     return record_reader_->GetMessageNumber(channel_name);
   }
@@ -96,6 +120,7 @@ class PyRecordReader {
 
  private:
   std::unique_ptr<RecordReader> record_reader_;
+  std::vector<RecordMessage> buffered_messages_;
 };
 
 class PyRecordWriter {
@@ -75,5 +75,33 @@ TEST(CyberRecordTest, record_readerwriter) {
   EXPECT_TRUE(header.is_complete());
 }
 
+TEST(CyberRecordTest, record_read_messages_buffered) {
+  record::PyRecordWriter rec_writer;
+  rec_writer.SetSizeOfFileSegmentation(0);
+  rec_writer.SetIntervalOfFileSegmentation(0);
+
+  EXPECT_TRUE(rec_writer.Open(TEST_RECORD_FILE));
+  rec_writer.WriteChannel(CHAN_1, MSG_TYPE, PROTO_DESC);
+  rec_writer.WriteChannel(CHAN_2, MSG_TYPE, PROTO_DESC);
+  rec_writer.WriteMessage(CHAN_1, MSG_DATA, 888);
+  rec_writer.WriteMessage(CHAN_2, MSG_DATA, 889);
+  rec_writer.WriteMessage(CHAN_1, MSG_DATA, 890);
+  rec_writer.Close();
+
+  record::PyRecordReader rec_reader(TEST_RECORD_FILE);
+  sleep(1);
+
+  // channel-filtered batch read; the payloads live in the reader buffer
+  const auto& messages = rec_reader.ReadMessagesBuffered(CHAN_1, 10);
+  EXPECT_EQ(2, messages.size());
+  for (const auto& message : messages) {
+    EXPECT_EQ(CHAN_1, message.channel_name);
+    EXPECT_EQ(MSG_DATA, message.content);
+  }
+
+  // the buffer is reused, and an exhausted reader yields an empty batch
+  EXPECT_TRUE(rec_reader.ReadMessagesBuffered("", 10).empty());
+}
+
 }  // namespace cyber
 }  // namespace apollo
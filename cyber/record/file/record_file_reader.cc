@@ -16,6 +16,11 @@
 
 #include "cyber/record/file/record_file_reader.h"
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cstring>
+
 #include "cyber/common/file.h"
 
 namespace apollo {
@@ -38,6 +43,23 @@ bool RecordFileReader::Open(const std::string& path) {
     return false;
   }
   end_of_file_ = false;
+
+  // Map the file read-only so that section parsing and chunk seeks go
+  // straight to the page cache; fall back to read() when mapping fails
+  // (e.g. on pseudo files).
+  struct stat st;
+  if (fstat(fd_, &st) == 0 && st.st_size > 0) {
+    void* addr = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ,
+                      MAP_PRIVATE, fd_, 0);
+    if (addr != MAP_FAILED) {
+      mmap_addr_ = static_cast<char*>(addr);
+      mmap_size_ = static_cast<uint64_t>(st.st_size);
+    } else {
+      ADEBUG << "mmap failed, fall back to read, file: " << path_
+             << ", errno: " << errno;
+    }
+  }
+
   if (!ReadHeader()) {
     AERROR << "Read header section fail, file: " << path_;
     return false;
@@ -45,7 +67,14 @@ bool RecordFileReader::Open(const std::string& path) {
   return true;
 }
 
-void RecordFileReader::Close() { close(fd_); }
+void RecordFileReader::Close() {
+  if (mmap_addr_ != nullptr) {
+    munmap(mmap_addr_, static_cast<size_t>(mmap_size_));
+    mmap_addr_ = nullptr;
+    mmap_size_ = 0;
+  }
+  close(fd_);
+}
 
 bool RecordFileReader::Reset() {
   if (!SetPosition(sizeof(struct Section) + HEADER_LENGTH)) {
@@ -110,6 +139,18 @@ bool RecordFileReader::ReadIndex() {
 }
 
 bool RecordFileReader::ReadSection(Section* section) {
+  if (mmap_addr_ != nullptr) {
+    int64_t pos = CurrentPosition();
+    if (pos < 0 ||
+        static_cast<uint64_t>(pos) + sizeof(struct Section) > mmap_size_) {
+      end_of_file_ = true;
+      AINFO << "Reach end of file.";
+      return false;
+    }
+    std::memcpy(section, mmap_addr_ + pos, sizeof(struct Section));
+    return SetPosition(pos + sizeof(struct Section));
+  }
+
   ssize_t count = read(fd_, section, sizeof(struct Section));
   if (count < 0) {
     AERROR << "Read fd failed, fd_: " << fd_ << ", errno: " << errno;
@@ -127,6 +168,42 @@ bool RecordFileReader::ReadSection(Section* section) {
   return true;
 }
 
+bool RecordFileReader::ReadRawSection(int64_t size, std::string* data) {
+  if (size < 0 || size > INT_MAX) {
+    AERROR << "Invalid section size: " << size;
+    return false;
+  }
+  int64_t pos = CurrentPosition();
+  if (mmap_addr_ != nullptr) {
+    if (pos < 0 || static_cast<uint64_t>(pos + size) > mmap_size_) {
+      AERROR << "Section exceeds mapped file, position: " << pos
+             << ", size: " << size;
+      end_of_file_ = true;
+      return false;
+    }
+    data->assign(mmap_addr_ + pos, static_cast<size_t>(size));
+    return SetPosition(pos + size);
+  }
+
+  data->resize(static_cast<size_t>(size));
+  int64_t total = 0;
+  while (total < size) {
+    ssize_t count =
+        read(fd_, &(*data)[total], static_cast<size_t>(size - total));
+    if (count < 0) {
+      AERROR << "Read fd failed, fd_: " << fd_ << ", errno: " << errno;
+      return false;
+    }
+    if (count == 0) {
+      end_of_file_ = true;
+      AERROR << "Reach end of file before section is complete.";
+      return false;
+    }
+    total += count;
+  }
+  return true;
+}
+
 bool RecordFileReader::SkipSection(int64_t size) {
   int64_t pos = CurrentPosition();
   if (size > INT64_MAX - pos) {
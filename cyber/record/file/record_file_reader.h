@@ -52,12 +52,21 @@ class RecordFileReader : public RecordFileBase {
   bool SkipSection(int64_t size);
   template <typename T>
   bool ReadSection(int64_t size, T* message);
+  // Reads the section body as raw bytes without parsing, so callers can
+  // hand the parse work to another thread.
+  bool ReadRawSection(int64_t size, std::string* data);
   bool ReadIndex();
   bool EndOfFile() { return end_of_file_; }
 
  private:
   bool ReadHeader();
   bool end_of_file_ = false;
+  // When the file could be mapped, sections are parsed straight out of
+  // the mapping (page cache) instead of through read(); the fd_ offset
+  // is still the single source of truth for the read position, so the
+  // two paths stay interchangeable.
+  char* mmap_addr_ = nullptr;
+  uint64_t mmap_size_ = 0;
 };
 
 template <typename T>
@@ -66,6 +75,22 @@ bool RecordFileReader::ReadSection(int64_t size, T* message) {
     AERROR << "Size value greater than the range of int value.";
     return false;
   }
+
+  if (mmap_addr_ != nullptr) {
+    int64_t pos = CurrentPosition();
+    if (pos < 0 || static_cast<uint64_t>(pos + size) > mmap_size_) {
+      AERROR << "Section exceeds mapped file, position: " << pos
+             << ", size: " << size;
+      end_of_file_ = true;
+      return false;
+    }
+    if (!message->ParseFromArray(mmap_addr_ + pos, static_cast<int>(size))) {
+      AERROR << "Parse section message failed.";
+      return false;
+    }
+    return SetPosition(pos + size);
+  }
+
   FileInputStream raw_input(fd_, static_cast<int>(size));
   CodedInputStream coded_input(&raw_input);
   CodedInputStream::Limit limit = coded_input.PushLimit(static_cast<int>(size));
@@ -53,7 +53,7 @@ bool RecordFileWriter::Open(const std::string& path) {
     return false;
   }
   chunk_active_.reset(new Chunk());
-  chunk_flush_.reset(new Chunk());
+  flush_queue_.clear();
   is_writing_ = true;
   flush_thread_ = std::make_shared<std::thread>([this]() { this->Flush(); });
   if (flush_thread_ == nullptr) {
@@ -65,20 +65,18 @@ bool RecordFileWriter::Open(const std::string& path) {
 
 void RecordFileWriter::Close() {
   if (is_writing_) {
-    // wait for the flush operation that may exist now
-    while (!chunk_flush_->empty()) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
-
-    // last swap
+    // enqueue the last chunk
     {
       std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-      chunk_flush_.swap(chunk_active_);
+      if (!chunk_active_->empty()) {
+        flush_queue_.emplace_back(std::move(chunk_active_));
+        chunk_active_.reset(new Chunk());
+      }
       flush_cv_.notify_one();
     }
 
-    // wait for the last flush operation
-    while (!chunk_flush_->empty()) {
+    // wait until the flush thread has drained the queue
+    while (GetFlushBacklogSize() > 0) {
       std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
 
@@ -219,27 +217,56 @@ bool RecordFileWriter::WriteMessage(const proto::SingleMessage& message) {
   }
   {
     std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-    chunk_flush_.swap(chunk_active_);
+    if (flush_queue_.size() >= kMaxFlushChunkNum) {
+      // The disk cannot keep up. Keep accumulating in the active chunk
+      // instead of growing the queue without bound; nothing is dropped,
+      // the chunk is rotated on a later message once the backlog drains.
+      backpressure_event_number_.fetch_add(1);
+      AWARN_EVERY(100) << "Chunk flush backlog full, file: " << path_
+                       << ", backlog: " << flush_queue_.size();
+      return true;
+    }
+    flush_queue_.emplace_back(std::move(chunk_active_));
+    chunk_active_.reset(new Chunk());
     flush_cv_.notify_one();
   }
   return true;
 }
 
+uint64_t RecordFileWriter::GetFlushBacklogSize() const {
+  std::lock_guard<std::mutex> lock(flush_mutex_);
+  return flush_queue_.size();
+}
+
 void RecordFileWriter::Flush() {
-  while (is_writing_) {
-    std::unique_lock<std::mutex> flush_lock(flush_mutex_);
-    flush_cv_.wait(flush_lock,
-                   [this] { return !chunk_flush_->empty() || !is_writing_; });
-    if (!is_writing_) {
-      break;
-    }
-    if (chunk_flush_->empty()) {
-      continue;
+  while (true) {
+    Chunk* chunk = nullptr;
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      flush_cv_.wait(flush_lock, [this] {
+        return !flush_queue_.empty() || !is_writing_;
+      });
+      if (flush_queue_.empty()) {
+        if (!is_writing_) {
+          break;
+        }
+        continue;
+      }
+      // Leave the chunk at the front while it is written, so the backlog
+      // seen by producers includes the in-flight chunk; the write itself
+      // happens without holding flush_mutex_, so WriteMessage never
+      // stalls behind disk I/O.
+      chunk = flush_queue_.front().get();
     }
-    if (!WriteChunk(chunk_flush_->header_, *(chunk_flush_->body_.get()))) {
+
+    if (!WriteChunk(chunk->header_, *(chunk->body_.get()))) {
       AERROR << "Write chunk fail.";
     }
-    chunk_flush_->clear();
+
+    {
+      std::unique_lock<std::mutex> flush_lock(flush_mutex_);
+      flush_queue_.pop_front();
+    }
   }
 }
 
@@ -17,7 +17,9 @@
 #ifndef CYBER_RECORD_FILE_RECORD_FILE_WRITER_H_
 #define CYBER_RECORD_FILE_RECORD_FILE_WRITER_H_
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -85,7 +87,16 @@ class RecordFileWriter : public RecordFileBase {
   bool WriteMessage(const proto::SingleMessage& message);
   uint64_t GetMessageNumber(const std::string& channel_name) const;
 
+  // backpressure accounting of the asynchronous flush pipeline
+  uint64_t GetFlushBacklogSize() const;
+  uint64_t GetBackpressureEventNumber() const {
+    return backpressure_event_number_.load();
+  }
+
  private:
+  // completed chunks allowed in flight before WriteMessage stops rotating
+  static const size_t kMaxFlushChunkNum = 4;
+
   bool WriteChunk(const proto::ChunkHeader& chunk_header,
                   const proto::ChunkBody& chunk_body);
   template <typename T>
@@ -94,10 +105,12 @@ class RecordFileWriter : public RecordFileBase {
   void Flush();
   bool is_writing_ = false;
   std::unique_ptr<Chunk> chunk_active_ = nullptr;
-  std::unique_ptr<Chunk> chunk_flush_ = nullptr;
   std::shared_ptr<std::thread> flush_thread_ = nullptr;
-  std::mutex flush_mutex_;
+  mutable std::mutex flush_mutex_;
   std::condition_variable flush_cv_;
+  // completed chunks waiting for the flush thread, oldest first
+  std::deque<std::unique_ptr<Chunk>> flush_queue_;
+  std::atomic<uint64_t> backpressure_event_number_ = {0};
   std::unordered_map<std::string, uint64_t> channel_message_number_map_;
 };
 
@@ -42,6 +42,19 @@ RecordReader::RecordReader(const std::string& file) {
     index_ = file_reader_->GetIndex();
     for (int i = 0; i < index_.indexes_size(); ++i) {
       auto single_idx = index_.mutable_indexes(i);
+      if (single_idx->type() == SectionType::SECTION_CHUNK_HEADER) {
+        if (!single_idx->has_chunk_header_cache()) {
+          AERROR << "Single chunk header index does not have "
+                    "chunk_header_cache.";
+          continue;
+        }
+        ChunkIndexEntry entry;
+        entry.position = single_idx->position();
+        entry.begin_time = single_idx->chunk_header_cache().begin_time();
+        entry.end_time = single_idx->chunk_header_cache().end_time();
+        chunk_index_.push_back(entry);
+        continue;
+      }
       if (single_idx->type() != SectionType::SECTION_CHANNEL) {
         continue;
       }
@@ -61,6 +74,7 @@ void RecordReader::Reset() {
   file_reader_->Reset();
   reach_end_ = false;
   message_index_ = 0;
+  next_chunk_index_ = 0;
   chunk_.reset(new ChunkBody());
 }
 
@@ -110,6 +124,47 @@ bool RecordReader::ReadMessage(RecordMessage* message, uint64_t begin_time,
 }
 
 bool RecordReader::ReadNextChunk(uint64_t begin_time, uint64_t end_time) {
+  // With a complete index the reader seeks straight to the next chunk
+  // overlapping the requested time range; chunks outside the range are
+  // never read or parsed. Incomplete records keep the sequential scan.
+  if (!chunk_index_.empty()) {
+    while (next_chunk_index_ < chunk_index_.size()) {
+      const auto& entry = chunk_index_[next_chunk_index_];
+      ++next_chunk_index_;
+      if (entry.end_time < begin_time) {
+        continue;
+      }
+      if (entry.begin_time > end_time) {
+        return false;
+      }
+      if (!file_reader_->SetPosition(static_cast<int64_t>(entry.position))) {
+        AERROR << "Failed to seek to chunk, position: " << entry.position;
+        return false;
+      }
+      Section section;
+      ChunkHeader header;
+      if (!file_reader_->ReadSection(&section) ||
+          section.type != SectionType::SECTION_CHUNK_HEADER ||
+          !file_reader_->ReadSection<ChunkHeader>(section.size, &header)) {
+        AERROR << "Failed to read indexed chunk header, position: "
+               << entry.position;
+        return false;
+      }
+      if (!file_reader_->ReadSection(&section) ||
+          section.type != SectionType::SECTION_CHUNK_BODY) {
+        AERROR << "Failed to read indexed chunk body section.";
+        return false;
+      }
+      chunk_.reset(new ChunkBody());
+      if (!file_reader_->ReadSection<ChunkBody>(section.size, chunk_.get())) {
+        AERROR << "Failed to read chunk body section.";
+        return false;
+      }
+      return true;
+    }
+    return false;
+  }
+
   bool skip_next_chunk_body = false;
   while (!reach_end_) {
     Section section;
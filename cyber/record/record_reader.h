@@ -21,6 +21,7 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "cyber/proto/record.pb.h"
 #include "cyber/record/file/record_file_reader.h"
@@ -112,6 +113,13 @@ class RecordReader : public RecordBase {
   std::set<std::string> GetChannelList() const override;
 
  private:
+  // position and time span of one chunk, taken from the index section
+  struct ChunkIndexEntry {
+    uint64_t position = 0;
+    uint64_t begin_time = 0;
+    uint64_t end_time = 0;
+  };
+
   bool ReadNextChunk(uint64_t begin_time, uint64_t end_time);
 
   bool is_valid_ = false;
@@ -120,6 +128,10 @@ class RecordReader : public RecordBase {
   proto::Index index_;
   int message_index_ = 0;
   ChannelInfoMap channel_info_;
+  // chunk positions in file order; lets ReadNextChunk seek straight to
+  // the first chunk overlapping the requested time range
+  std::vector<ChunkIndexEntry> chunk_index_;
+  size_t next_chunk_index_ = 0;
   FileReaderPtr file_reader_;
 };
 
@@ -17,7 +17,6 @@
 #include "cyber/record/record_viewer.h"
 
 #include <algorithm>
-#include <utility>
 
 #include "cyber/common/log.h"
 
@@ -57,20 +56,21 @@ bool RecordViewer::IsValid() const {
 }
 
 bool RecordViewer::Update(RecordMessage* message) {
-  bool find = false;
-  do {
-    if (msg_buffer_.empty() && !FillBuffer()) {
-      break;
-    }
-    auto& msg = msg_buffer_.begin()->second;
-    if (channels_.empty() || channels_.count(msg->channel_name) == 1) {
-      *message = *msg;
-      find = true;
-    }
-    msg_buffer_.erase(msg_buffer_.begin());
-  } while (!find);
-
-  return find;
+  if (!merging_) {
+    InitMerge();
+  }
+  if (merge_heap_.empty()) {
+    return false;
+  }
+  auto entry = merge_heap_.top();
+  merge_heap_.pop();
+  *message = *entry.msg;
+  // refill the heap with the next pending message of the same stream
+  std::shared_ptr<RecordMessage> next;
+  if (NextFrom(entry.stream_index, &next)) {
+    merge_heap_.push(HeapEntry{next, entry.stream_index});
+  }
+  return true;
 }
 
 RecordViewer::Iterator RecordViewer::begin() { return Iterator(this); }
@@ -85,7 +85,6 @@ void RecordViewer::Init() {
                           channels_.begin(), channels_.end(),
                           std::inserter(channel_list_, channel_list_.end()));
   }
-  readers_finished_.resize(readers_.size(), false);
 
   // Sort the readers
   std::sort(readers_.begin(), readers_.end(),
@@ -103,9 +102,9 @@ void RecordViewer::Reset() {
   for (auto& reader : readers_) {
     reader->Reset();
   }
-  std::fill(readers_finished_.begin(), readers_finished_.end(), false);
-  curr_begin_time_ = begin_time_;
-  msg_buffer_.clear();
+  streams_.clear();
+  merge_heap_ = decltype(merge_heap_)();
+  merging_ = false;
 }
 
 void RecordViewer::UpdateTime() {
@@ -132,46 +131,73 @@ void RecordViewer::UpdateTime() {
   if (end_time_ > max_end_time) {
     end_time_ = max_end_time;
   }
+}
 
-  curr_begin_time_ = begin_time_;
+void RecordViewer::InitMerge() {
+  streams_.resize(readers_.size());
+  for (std::size_t i = 0; i < streams_.size(); ++i) {
+    streams_[i].next_window_begin =
+        std::max(begin_time_, readers_[i]->GetHeader().begin_time());
+  }
+  // Seed the merge heap with the earliest pending message of each stream.
+  for (std::size_t i = 0; i < streams_.size(); ++i) {
+    std::shared_ptr<RecordMessage> msg;
+    if (NextFrom(i, &msg)) {
+      merge_heap_.push(HeapEntry{msg, i});
+    }
+  }
+  merging_ = true;
 }
 
-bool RecordViewer::FillBuffer() {
-  while (curr_begin_time_ <= end_time_ && msg_buffer_.size() < kBufferMinSize) {
-    uint64_t this_begin_time = curr_begin_time_;
+bool RecordViewer::NextFrom(std::size_t stream_index,
+                            std::shared_ptr<RecordMessage>* message) {
+  auto& stream = streams_[stream_index];
+  auto& reader = readers_[stream_index];
+
+  while (stream.batch_pos >= stream.batch.size()) {
+    if (stream.finished) {
+      return false;
+    }
+    if (stream.next_window_begin > end_time_ ||
+        stream.next_window_begin > reader->GetHeader().end_time()) {
+      stream.finished = true;
+      return false;
+    }
+
+    uint64_t this_begin_time = stream.next_window_begin;
     uint64_t this_end_time = this_begin_time + kStepTimeNanoSec;
     if (this_end_time > end_time_) {
       this_end_time = end_time_;
     }
 
-    for (size_t i = 0; i < readers_.size(); ++i) {
-      if (!readers_finished_[i] &&
-          readers_[i]->GetHeader().end_time() < this_begin_time) {
-        readers_finished_[i] = true;
-        readers_[i]->Reset();
+    stream.batch.clear();
+    stream.batch_pos = 0;
+    while (true) {
+      auto record_msg = std::make_shared<RecordMessage>();
+      if (!reader->ReadMessage(record_msg.get(), this_begin_time,
+                               this_end_time)) {
+        break;
       }
-    }
-
-    for (size_t i = 0; i < readers_.size(); ++i) {
-      if (readers_finished_[i]) {
+      if (!channels_.empty() &&
+          channels_.count(record_msg->channel_name) == 0) {
         continue;
       }
-      auto& reader = readers_[i];
-      while (true) {
-        auto record_msg = std::make_shared<RecordMessage>();
-        if (!reader->ReadMessage(record_msg.get(), this_begin_time,
-                                 this_end_time)) {
-          break;
-        }
-        msg_buffer_.emplace(std::make_pair(record_msg->time, record_msg));
-      }
+      stream.batch.push_back(record_msg);
     }
+    // Messages inside one record file may be slightly out of order, so
+    // each window batch is sorted before it enters the merge.
+    std::stable_sort(stream.batch.begin(), stream.batch.end(),
+                     [](const std::shared_ptr<RecordMessage>& lhs,
+                        const std::shared_ptr<RecordMessage>& rhs) {
+                       return lhs->time < rhs->time;
+                     });
 
     // because ReadMessage of RecordReader is closed interval, so we add 1 here
-    curr_begin_time_ = this_end_time + 1;
+    stream.next_window_begin = this_end_time + 1;
   }
 
-  return !msg_buffer_.empty();
+  *message = stream.batch[stream.batch_pos++];
+  return true;
 }
 
 RecordViewer::Iterator::Iterator(RecordViewer* viewer, bool end)
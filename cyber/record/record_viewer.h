@@ -18,8 +18,8 @@
 #define CYBER_RECORD_RECORD_VIEWER_H_
 
 #include <cstddef>
-#include <map>
 #include <memory>
+#include <queue>
 #include <set>
 #include <string>
 #include <vector>
@@ -33,6 +33,12 @@ namespace record {
 
 /**
  * @brief The record viewer.
+ *
+ * Messages of multiple readers are merged in time order with a k-way
+ * merge: every reader is fetched window by window into sorted batches,
+ * and a min-heap over the head of each stream yields the next message,
+ * so only the stream that ran dry touches its reader, instead of every
+ * reader being rescanned for every window.
  */
 class RecordViewer {
  public:
@@ -180,9 +186,32 @@ class RecordViewer {
   void Init();
   void Reset();
   void UpdateTime();
-  bool FillBuffer();
   bool Update(RecordMessage* message);
 
+  void InitMerge();
+  bool NextFrom(std::size_t stream_index,
+                std::shared_ptr<RecordMessage>* message);
+
+  // One reader's message stream. Refilled one time window at a time,
+  // each batch sorted, only when the merge drained it.
+  struct ReaderStream {
+    uint64_t next_window_begin = 0;
+    bool finished = false;
+    std::vector<std::shared_ptr<RecordMessage>> batch;
+    std::size_t batch_pos = 0;
+  };
+
+  // An entry of the merge heap: the next pending message of one stream.
+  struct HeapEntry {
+    std::shared_ptr<RecordMessage> msg;
+    std::size_t stream_index;
+  };
+  struct HeapEntryGreater {
+    bool operator()(const HeapEntry& lhs, const HeapEntry& rhs) const {
+      return lhs.msg->time > rhs.msg->time;
+    }
+  };
+
   uint64_t begin_time_ = 0;
   uint64_t end_time_ = UINT64_MAX;
   // User defined channels
@@ -190,13 +219,13 @@ class RecordViewer {
   // All channel in user defined readers
   std::set<std::string> channel_list_;
   std::vector<RecordReaderPtr> readers_;
-  std::vector<bool> readers_finished_;
 
-  uint64_t curr_begin_time_ = 0;
-  std::multimap<uint64_t, std::shared_ptr<RecordMessage>> msg_buffer_;
+  std::vector<ReaderStream> streams_;
+  bool merging_ = false;
+  std::priority_queue<HeapEntry, std::vector<HeapEntry>, HeapEntryGreater>
+      merge_heap_;
 
   const uint64_t kStepTimeNanoSec = 1000000000UL;  // 1 second
-  const std::size_t kBufferMinSize = 128;
 };
 
 }  // namespace record
@@ -217,6 +217,20 @@ const std::string& RecordWriter::GetProtoDesc(
   return null_type_;
 }
 
+uint64_t RecordWriter::GetFlushBacklogSize() const {
+  if (file_writer_ == nullptr) {
+    return 0;
+  }
+  return file_writer_->GetFlushBacklogSize();
+}
+
+uint64_t RecordWriter::GetBackpressureEventNumber() const {
+  if (file_writer_ == nullptr) {
+    return 0;
+  }
+  return file_writer_->GetBackpressureEventNumber();
+}
+
 std::set<std::string> RecordWriter::GetChannelList() const {
   std::set<std::string> channel_list;
   for (auto& item : channel_message_number_map_) {
@@ -168,6 +168,22 @@ class RecordWriter : public RecordBase {
    */
   bool IsNewChannel(const std::string& channel_name) const;
 
+  /**
+   * @brief Get the number of chunks waiting for the flush thread of the
+   * current output file, including the chunk being written.
+   *
+   * @return Flush backlog size.
+   */
+  uint64_t GetFlushBacklogSize() const;
+
+  /**
+   * @brief Get how many times chunk rotation was deferred because the
+   * flush backlog of the current output file was full.
+   *
+   * @return Backpressure event number.
+   */
+  uint64_t GetBackpressureEventNumber() const;
+
  private:
   bool WriteMessage(const proto::SingleMessage& single_msg);
   bool SplitOutfile();
@@ -18,6 +18,12 @@
 
 #include <sched.h>
 #include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
 
 namespace apollo {
 namespace cyber {
@@ -94,6 +100,63 @@ void SetSchedPolicy(std::thread* thread, std::string spolicy,
   }
 }
 
+int CpusetNumaNode(const std::vector<int>& cpuset) {
+  if (cpuset.empty()) {
+    return -1;
+  }
+  int found = -1;
+  for (int node = 0;; ++node) {
+    std::ifstream cpulist("/sys/devices/system/node/node" +
+                          std::to_string(node) + "/cpulist");
+    if (!cpulist.good()) {
+      break;
+    }
+    std::string line;
+    std::getline(cpulist, line);
+    if (line.empty()) {
+      continue;
+    }
+    std::vector<int> node_cpus;
+    ParseCpuset(line, &node_cpus);
+    bool any = false;
+    bool all = true;
+    for (const auto cpu : cpuset) {
+      if (std::find(node_cpus.begin(), node_cpus.end(), cpu) !=
+          node_cpus.end()) {
+        any = true;
+      } else {
+        all = false;
+      }
+    }
+    if (!any) {
+      continue;
+    }
+    if (!all || found != -1) {
+      // cpus spread over several nodes, no single home node
+      return -1;
+    }
+    found = node;
+  }
+  return found;
+}
+
+void SetLocalNumaMemPolicy(int node) {
+  if (node < 0 || node >= static_cast<int>(sizeof(uint64_t) * 8)) {
+    return;
+  }
+  // MPOL_PREFERRED from <numaif.h>; raw syscall avoids a libnuma dependency
+  const int kMpolPreferred = 1;
+  uint64_t node_mask = 1ULL << node;
+  if (syscall(SYS_set_mempolicy, kMpolPreferred, &node_mask,
+              sizeof(node_mask) * 8) != 0) {
+    AWARN << "set_mempolicy to node " << node
+          << " failed, errno: " << errno;
+    return;
+  }
+  AINFO << "thread " << syscall(SYS_gettid)
+        << " prefers memory from numa node " << node;
+}
+
 }  // namespace scheduler
 }  // namespace cyber
 }  // namespace apollo
@@ -35,6 +35,14 @@ void SetSchedAffinity(std::thread* thread, const std::vector<int>& cpus,
 void SetSchedPolicy(std::thread* thread, std::string spolicy,
                     int sched_priority, pid_t tid = -1);
 
+// Returns the NUMA node that holds every cpu in cpuset, or -1 when the
+// cpus span several nodes or the topology cannot be read.
+int CpusetNumaNode(const std::vector<int>& cpuset);
+
+// Applies a local-allocation memory policy preferring node to the calling
+// thread, so pages it first touches afterwards land on that node.
+void SetLocalNumaMemPolicy(int node);
+
 }  // namespace scheduler
 }  // namespace cyber
 }  // namespace apollo
@@ -18,6 +18,8 @@
 
 #include <climits>
 
+#include "cyber/base/wait_strategy.h"
+
 namespace apollo {
 namespace cyber {
 namespace scheduler {
@@ -33,6 +35,8 @@ alignas(CACHELINE_SIZE) GRP_WQ_CV ClassicContext::cv_wq_;
 alignas(CACHELINE_SIZE) RQ_LOCK_GROUP ClassicContext::rq_locks_;
 alignas(CACHELINE_SIZE) CR_GROUP ClassicContext::cr_group_;
 alignas(CACHELINE_SIZE) NOTIFY_GRP ClassicContext::notify_grp_;
+alignas(CACHELINE_SIZE) std::unordered_map<std::string, uint32_t>
+    ClassicContext::wait_spin_counts_;
 
 ClassicContext::ClassicContext() { InitGroup(DEFAULT_GROUP_NAME); }
 
@@ -46,9 +50,15 @@ void ClassicContext::InitGroup(const std::string& group_name) {
   mtx_wrapper_ = &mtx_wq_[group_name];
   cw_ = &cv_wq_[group_name];
   notify_grp_[group_name] = 0;
+  notify_cnt_ = &notify_grp_[group_name];
   current_grp = group_name;
 }
 
+void ClassicContext::SetGroupWaitSpinCount(const std::string& group_name,
+                                           uint32_t spin_count) {
+  wait_spin_counts_[group_name] = spin_count;
+}
+
 std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
   if (cyber_unlikely(stop_.load())) {
     return nullptr;
@@ -73,6 +83,20 @@ std::shared_ptr<CRoutine> ClassicContext::NextRoutine() {
 }
 
 void ClassicContext::Wait() {
+  // Adaptive idle: spin on the notify count before taking the group
+  // mutex, so a notification arriving within the spin budget is seen
+  // with spin-level latency. The peek is a heuristic only; the locked
+  // wait below remains the source of truth.
+  auto spin_it = wait_spin_counts_.find(current_grp);
+  if (spin_it != wait_spin_counts_.end()) {
+    for (uint32_t i = 0; i < spin_it->second; ++i) {
+      if (*notify_cnt_ > 0) {
+        break;
+      }
+      base::CpuRelax();
+    }
+  }
+
   std::unique_lock<std::mutex> lk(mtx_wrapper_->Mutex());
   cw_->Cv().wait_for(lk, std::chrono::milliseconds(1000),
                      [&]() { return notify_grp_[current_grp] > 0; });
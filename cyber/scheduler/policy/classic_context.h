@@ -61,11 +61,18 @@ class ClassicContext : public ProcessorContext {
   static void Notify(const std::string &group_name);
   static bool RemoveCRoutine(const std::shared_ptr<CRoutine> &cr);
 
+  // Lets latency-critical groups spin briefly before parking in Wait(),
+  // trading idle cpu on their dedicated cores for wakeup latency.
+  static void SetGroupWaitSpinCount(const std::string &group_name,
+                                    uint32_t spin_count);
+
   alignas(CACHELINE_SIZE) static CR_GROUP cr_group_;
   alignas(CACHELINE_SIZE) static RQ_LOCK_GROUP rq_locks_;
   alignas(CACHELINE_SIZE) static GRP_WQ_CV cv_wq_;
   alignas(CACHELINE_SIZE) static GRP_WQ_MUTEX mtx_wq_;
   alignas(CACHELINE_SIZE) static NOTIFY_GRP notify_grp_;
+  alignas(CACHELINE_SIZE) static std::unordered_map<std::string, uint32_t>
+      wait_spin_counts_;
 
  private:
   void InitGroup(const std::string &group_name);
@@ -77,6 +84,7 @@ class ClassicContext : public ProcessorContext {
   LOCK_QUEUE *lq_ = nullptr;
   MutexWrapper *mtx_wrapper_ = nullptr;
   CvWrapper *cw_ = nullptr;
+  int *notify_cnt_ = nullptr;
 
   std::string current_grp;
 };
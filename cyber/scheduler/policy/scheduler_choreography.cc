@@ -93,10 +93,21 @@ SchedulerChoreography::SchedulerChoreography() {
 }
 
 void SchedulerChoreography::CreateProcessor() {
+  auto choreography_numa_node = CpusetNumaNode(choreography_cpuset_);
+  auto pool_numa_node = CpusetNumaNode(pool_cpuset_);
+
   for (uint32_t i = 0; i < proc_num_; i++) {
     auto proc = std::make_shared<Processor>();
     auto ctx = std::make_shared<ChoreographyContext>();
 
+    // with 1to1 affinity each processor lives on a single cpu, so its
+    // home node can be narrower than the whole cpuset
+    auto numa_node = choreography_numa_node;
+    if (!choreography_affinity_.compare("1to1") &&
+        i < choreography_cpuset_.size()) {
+      numa_node = CpusetNumaNode({choreography_cpuset_[i]});
+    }
+    proc->SetNumaNode(numa_node);
     proc->BindContext(ctx);
     SetSchedAffinity(proc->Thread(), choreography_cpuset_,
                      choreography_affinity_, i);
@@ -110,6 +121,11 @@ void SchedulerChoreography::CreateProcessor() {
     auto proc = std::make_shared<Processor>();
     auto ctx = std::make_shared<ClassicContext>();
 
+    auto numa_node = pool_numa_node;
+    if (!pool_affinity_.compare("1to1") && i < pool_cpuset_.size()) {
+      numa_node = CpusetNumaNode({pool_cpuset_[i]});
+    }
+    proc->SetNumaNode(numa_node);
     proc->BindContext(ctx);
     SetSchedAffinity(proc->Thread(), pool_cpuset_, pool_affinity_, i);
     SetSchedPolicy(proc->Thread(), pool_processor_policy_, pool_processor_prio_,
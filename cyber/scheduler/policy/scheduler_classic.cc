@@ -23,6 +23,7 @@
 #include "cyber/common/environment.h"
 #include "cyber/common/file.h"
 #include "cyber/scheduler/policy/classic_context.h"
+#include "cyber/scheduler/policy/work_stealing_context.h"
 #include "cyber/scheduler/processor.h"
 
 namespace apollo {
@@ -38,7 +39,8 @@ using apollo::cyber::common::PathExists;
 using apollo::cyber::common::WorkRoot;
 using apollo::cyber::croutine::RoutineState;
 
-SchedulerClassic::SchedulerClassic() {
+SchedulerClassic::SchedulerClassic(bool enable_work_stealing)
+    : enable_work_stealing_(enable_work_stealing) {
   std::string conf("conf/");
   conf.append(GlobalData::Instance()->ProcessGroup()).append(".conf");
   auto cfg_file = GetAbsolutePath(WorkRoot(), conf);
@@ -94,12 +96,34 @@ void SchedulerClassic::CreateProcessor() {
     auto processor_prio = group.processor_prio();
     std::vector<int> cpuset;
     ParseCpuset(group.cpuset(), &cpuset);
+    auto group_numa_node = CpusetNumaNode(cpuset);
+
+    // Groups scheduled with a realtime policy are the latency-critical
+    // ones; let their processors spin briefly before parking.
+    if (processor_policy == "SCHED_FIFO" || processor_policy == "SCHED_RR") {
+      ClassicContext::SetGroupWaitSpinCount(group_name, 5000);
+    }
 
     for (uint32_t i = 0; i < proc_num; i++) {
-      auto ctx = std::make_shared<ClassicContext>(group_name);
+      // with 1to1 affinity each processor lives on a single cpu, so its
+      // home node can be narrower than the whole group cpuset
+      auto numa_node = group_numa_node;
+      if (!affinity.compare("1to1") && i < cpuset.size()) {
+        numa_node = CpusetNumaNode({cpuset[i]});
+      }
+
+      std::shared_ptr<ProcessorContext> ctx;
+      if (enable_work_stealing_) {
+        auto ws_ctx = std::make_shared<WorkStealingContext>(group_name);
+        ws_ctx->set_numa_node(numa_node);
+        ctx = ws_ctx;
+      } else {
+        ctx = std::make_shared<ClassicContext>(group_name);
+      }
       pctxs_.emplace_back(ctx);
 
       auto proc = std::make_shared<Processor>();
+      proc->SetNumaNode(numa_node);
       proc->BindContext(ctx);
       SetSchedAffinity(proc->Thread(), cpuset, affinity, i);
       SetSchedPolicy(proc->Thread(), processor_policy, processor_prio,
@@ -148,6 +172,11 @@ bool SchedulerClassic::DispatchTask(const std::shared_ptr<CRoutine>& cr) {
   }
 
   // Enqueue task.
+  if (enable_work_stealing_) {
+    WorkStealingContext::Enqueue(cr->group_name(), cr);
+    return true;
+  }
+
   {
     WriteLockGuard<AtomicRWLock> lk(
         ClassicContext::rq_locks_[cr->group_name()].at(cr->priority()));
@@ -174,7 +203,11 @@ bool SchedulerClassic::NotifyProcessor(uint64_t crid) {
         cr->SetUpdateFlag();
       }
 
-      ClassicContext::Notify(cr->group_name());
+      if (enable_work_stealing_) {
+        WorkStealingContext::Notify(cr->group_name());
+      } else {
+        ClassicContext::Notify(cr->group_name());
+      }
       return true;
     }
   }
@@ -216,6 +249,9 @@ bool SchedulerClassic::RemoveCRoutine(uint64_t crid) {
       return false;
     }
   }
+  if (enable_work_stealing_) {
+    return WorkStealingContext::RemoveCRoutine(cr);
+  }
   return ClassicContext::RemoveCRoutine(cr);
 }
 
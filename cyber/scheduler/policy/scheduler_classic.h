@@ -42,7 +42,10 @@ class SchedulerClassic : public Scheduler {
 
  private:
   friend Scheduler* Instance();
-  SchedulerClassic();
+  // With work stealing enabled, every processor of a group gets its own
+  // run queue (WorkStealingContext) instead of sharing the group-wide
+  // classic queues.
+  explicit SchedulerClassic(bool enable_work_stealing = false);
 
   void CreateProcessor();
   bool NotifyProcessor(uint64_t crid) override;
@@ -50,6 +53,7 @@ class SchedulerClassic : public Scheduler {
   std::unordered_map<std::string, ClassicTask> cr_confs_;
 
   ClassicConf classic_conf_;
+  bool enable_work_stealing_ = false;
 };
 
 }  // namespace scheduler
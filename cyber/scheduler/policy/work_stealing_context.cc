@@ -0,0 +1,228 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/scheduler/policy/work_stealing_context.h"
+
+#include <climits>
+#include <thread>
+
+namespace apollo {
+namespace cyber {
+namespace scheduler {
+
+using apollo::cyber::base::AtomicRWLock;
+using apollo::cyber::base::ReadLockGuard;
+using apollo::cyber::base::WriteLockGuard;
+using apollo::cyber::croutine::CRoutine;
+using apollo::cyber::croutine::RoutineState;
+
+std::unordered_map<std::string, std::vector<WorkStealingContext*>>
+    WorkStealingContext::ctx_group_;
+std::mutex WorkStealingContext::ctx_group_mtx_;
+std::atomic<uint64_t> WorkStealingContext::ctx_group_version_ = {0};
+alignas(CACHELINE_SIZE) GRP_WQ_MUTEX WorkStealingContext::mtx_wq_;
+alignas(CACHELINE_SIZE) GRP_WQ_CV WorkStealingContext::cv_wq_;
+alignas(CACHELINE_SIZE) NOTIFY_GRP WorkStealingContext::notify_grp_;
+
+namespace {
+
+// Cheap per-thread xorshift for random victim selection; quality does not
+// matter here, avoiding a shared RNG does.
+uint32_t NextRand() {
+  static thread_local uint32_t seed =
+      static_cast<uint32_t>(std::hash<std::thread::id>()(
+          std::this_thread::get_id()));
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  return seed;
+}
+
+}  // namespace
+
+WorkStealingContext::WorkStealingContext(const std::string& group_name)
+    : current_grp_(group_name) {
+  std::lock_guard<std::mutex> lg(ctx_group_mtx_);
+  ctx_group_[group_name].push_back(this);
+  ctx_group_version_.fetch_add(1, std::memory_order_release);
+  mtx_wrapper_ = &mtx_wq_[group_name];
+  cw_ = &cv_wq_[group_name];
+  notify_grp_[group_name] = 0;
+}
+
+WorkStealingContext::~WorkStealingContext() {
+  std::lock_guard<std::mutex> lg(ctx_group_mtx_);
+  auto& ctxs = ctx_group_[current_grp_];
+  for (auto it = ctxs.begin(); it != ctxs.end(); ++it) {
+    if (*it == this) {
+      ctxs.erase(it);
+      break;
+    }
+  }
+  ctx_group_version_.fetch_add(1, std::memory_order_release);
+}
+
+std::shared_ptr<CRoutine> WorkStealingContext::PickFrom(
+    WorkStealingContext* ctx, int prio) {
+  ReadLockGuard<AtomicRWLock> lk(ctx->rq_locks_.at(prio));
+  for (auto& cr : ctx->local_rq_.at(prio)) {
+    if (!cr->Acquire()) {
+      continue;
+    }
+    if (cr->UpdateState() == RoutineState::READY) {
+      return cr;
+    }
+    cr->Release();
+  }
+  return nullptr;
+}
+
+std::shared_ptr<CRoutine> WorkStealingContext::NextRoutine() {
+  if (cyber_unlikely(stop_.load())) {
+    return nullptr;
+  }
+
+  // Refresh the peer snapshot when registration changed; processors start
+  // while later contexts are still being constructed, so the shared
+  // vector may only be read under the lock. In steady state this is a
+  // single atomic load.
+  if (cyber_unlikely(peers_version_ !=
+                     ctx_group_version_.load(std::memory_order_acquire))) {
+    std::lock_guard<std::mutex> lg(ctx_group_mtx_);
+    peers_snapshot_ = ctx_group_[current_grp_];
+    peers_version_ = ctx_group_version_.load(std::memory_order_relaxed);
+  }
+
+  auto& ctxs = peers_snapshot_;
+  auto ctx_num = static_cast<uint32_t>(ctxs.size());
+  uint32_t victim_base = NextRand();
+
+  for (int i = MAX_PRIO - 1; i >= 0; --i) {
+    // Local queue first; in the common case this is the only lock touched.
+    auto cr = PickFrom(this, i);
+    if (cr != nullptr) {
+      return cr;
+    }
+
+    // Steal at the same priority before dropping to a lower one, so the
+    // group-wide priority order matches the classic policy.
+    for (uint32_t v = 0; v < ctx_num; ++v) {
+      auto* victim = ctxs[(victim_base + v) % ctx_num];
+      if (victim == this) {
+        continue;
+      }
+      // never steal across sockets; remote croutine stacks would keep
+      // faulting against the victim's node
+      if (numa_node_ >= 0 && victim->numa_node_ >= 0 &&
+          victim->numa_node_ != numa_node_) {
+        continue;
+      }
+      cr = PickFrom(victim, i);
+      if (cr != nullptr) {
+        return cr;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+void WorkStealingContext::Wait() {
+  std::unique_lock<std::mutex> lk(mtx_wrapper_->Mutex());
+  cw_->Cv().wait_for(lk, std::chrono::milliseconds(1000),
+                     [&]() { return notify_grp_[current_grp_] > 0; });
+  if (notify_grp_[current_grp_] > 0) {
+    notify_grp_[current_grp_]--;
+  }
+}
+
+void WorkStealingContext::Shutdown() {
+  stop_.store(true);
+  mtx_wrapper_->Mutex().lock();
+  notify_grp_[current_grp_] = UCHAR_MAX;
+  mtx_wrapper_->Mutex().unlock();
+  cw_->Cv().notify_all();
+}
+
+void WorkStealingContext::Enqueue(const std::string& group_name,
+                                  const std::shared_ptr<CRoutine>& cr) {
+  WorkStealingContext* target = nullptr;
+  {
+    std::lock_guard<std::mutex> lg(ctx_group_mtx_);
+    auto& ctxs = ctx_group_[group_name];
+    if (ctxs.empty()) {
+      AERROR << "no work-stealing context for group: " << group_name;
+      return;
+    }
+    target = ctxs[0];
+    for (auto* ctx : ctxs) {
+      if (ctx->local_cr_num_.load() < target->local_cr_num_.load()) {
+        target = ctx;
+      }
+    }
+    target->local_cr_num_.fetch_add(1);
+  }
+
+  {
+    WriteLockGuard<AtomicRWLock> lk(target->rq_locks_.at(cr->priority()));
+    target->local_rq_.at(cr->priority()).emplace_back(cr);
+  }
+  Notify(group_name);
+}
+
+void WorkStealingContext::Notify(const std::string& group_name) {
+  (&mtx_wq_[group_name])->Mutex().lock();
+  notify_grp_[group_name]++;
+  (&mtx_wq_[group_name])->Mutex().unlock();
+  cv_wq_[group_name].Cv().notify_one();
+}
+
+bool WorkStealingContext::RemoveCRoutine(const std::shared_ptr<CRoutine>& cr) {
+  auto grp = cr->group_name();
+  auto prio = cr->priority();
+  auto crid = cr->id();
+
+  std::vector<WorkStealingContext*> ctxs;
+  {
+    std::lock_guard<std::mutex> lg(ctx_group_mtx_);
+    ctxs = ctx_group_[grp];
+  }
+
+  for (auto* ctx : ctxs) {
+    WriteLockGuard<AtomicRWLock> lk(ctx->rq_locks_.at(prio));
+    auto& croutines = ctx->local_rq_.at(prio);
+    for (auto it = croutines.begin(); it != croutines.end(); ++it) {
+      if ((*it)->id() == crid) {
+        auto routine = *it;
+        routine->Stop();
+        while (!routine->Acquire()) {
+          std::this_thread::sleep_for(std::chrono::microseconds(1));
+          AINFO_EVERY(1000) << "waiting for task " << routine->name()
+                            << " completion";
+        }
+        croutines.erase(it);
+        routine->Release();
+        ctx->local_cr_num_.fetch_sub(1);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace scheduler
+}  // namespace cyber
+}  // namespace apollo
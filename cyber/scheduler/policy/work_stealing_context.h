@@ -0,0 +1,98 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_SCHEDULER_POLICY_WORK_STEALING_CONTEXT_H_
+#define CYBER_SCHEDULER_POLICY_WORK_STEALING_CONTEXT_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/base/atomic_rw_lock.h"
+#include "cyber/croutine/croutine.h"
+#include "cyber/scheduler/policy/classic_context.h"
+#include "cyber/scheduler/processor_context.h"
+
+namespace apollo {
+namespace cyber {
+namespace scheduler {
+
+// A work-stealing variant of the classic policy. Croutines of a group are
+// partitioned across per-processor run queues instead of living in one
+// shared MULTI_PRIO_QUEUE, so in the common case a processor only touches
+// its own queue locks. When a processor finds nothing runnable locally it
+// steals from the other queues of its group, visiting victims in random
+// rotation but always serving higher priorities first so the group-wide
+// priority order is preserved.
+class WorkStealingContext : public ProcessorContext {
+ public:
+  explicit WorkStealingContext(const std::string& group_name);
+  ~WorkStealingContext() override;
+
+  std::shared_ptr<CRoutine> NextRoutine() override;
+  void Wait() override;
+  void Shutdown() override;
+
+  // Places cr on the least-loaded run queue of its group.
+  static void Enqueue(const std::string& group_name,
+                      const std::shared_ptr<CRoutine>& cr);
+  static void Notify(const std::string& group_name);
+  static bool RemoveCRoutine(const std::shared_ptr<CRoutine>& cr);
+
+  // Home NUMA node of the owning processor; steals stay on that node so
+  // croutine stacks and queue pages are never pulled across sockets.
+  void set_numa_node(int node) { numa_node_ = node; }
+  int numa_node() const { return numa_node_; }
+
+ private:
+  std::shared_ptr<CRoutine> PickFrom(WorkStealingContext* ctx, int prio);
+
+  alignas(CACHELINE_SIZE) MULTI_PRIO_QUEUE local_rq_;
+  alignas(CACHELINE_SIZE) LOCK_QUEUE rq_locks_;
+  std::atomic<uint32_t> local_cr_num_ = {0};
+
+  MutexWrapper* mtx_wrapper_ = nullptr;
+  CvWrapper* cw_ = nullptr;
+  std::string current_grp_;
+  int numa_node_ = -1;
+
+  // Private snapshot of this group's contexts, refreshed under
+  // ctx_group_mtx_ whenever the registration version changes. NextRoutine
+  // runs on earlier processors while later contexts still register and
+  // reallocate the shared vector, so it must never read ctx_group_
+  // unlocked; only the owning processor thread touches the snapshot.
+  std::vector<WorkStealingContext*> peers_snapshot_;
+  uint64_t peers_version_ = 0;
+
+  // All contexts of a group; mutations bump ctx_group_version_ so cached
+  // snapshots know to refresh.
+  static std::unordered_map<std::string, std::vector<WorkStealingContext*>>
+      ctx_group_;
+  static std::mutex ctx_group_mtx_;
+  static std::atomic<uint64_t> ctx_group_version_;
+  static GRP_WQ_MUTEX mtx_wq_;
+  static GRP_WQ_CV cv_wq_;
+  static NOTIFY_GRP notify_grp_;
+};
+
+}  // namespace scheduler
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_SCHEDULER_POLICY_WORK_STEALING_CONTEXT_H_
@@ -24,6 +24,7 @@
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/croutine/croutine.h"
+#include "cyber/scheduler/common/pin_thread.h"
 #include "cyber/time/time.h"
 
 namespace apollo {
@@ -40,6 +41,9 @@ void Processor::Run() {
   tid_.store(static_cast<int>(syscall(SYS_gettid)));
   AINFO << "processor_tid: " << tid_;
   snap_shot_->processor_id.store(tid_);
+  if (numa_node_ >= 0) {
+    SetLocalNumaMemPolicy(numa_node_);
+  }
 
   while (cyber_likely(running_.load())) {
     if (cyber_likely(context_ != nullptr)) {
@@ -47,7 +51,9 @@ void Processor::Run() {
       if (croutine) {
         snap_shot_->execute_start_time.store(cyber::Time::Now().ToNanosecond());
         snap_shot_->routine_name = croutine->name();
+        croutine->UpdateStatOnResume();
         croutine->Resume();
+        croutine->UpdateStatOnYield();
         croutine->Release();
       } else {
         snap_shot_->execute_start_time.store(0);
@@ -52,6 +52,11 @@ class Processor {
   std::thread* Thread() { return &thread_; }
   std::atomic<pid_t>& Tid();
 
+  // Must be called before BindContext; the processor thread applies a
+  // local-allocation memory policy at startup so croutine stacks and run
+  // queue pages it first touches stay on its own socket.
+  void SetNumaNode(int node) { numa_node_ = node; }
+
   std::shared_ptr<Snapshot> ProcSnapshot() { return snap_shot_; }
 
  private:
@@ -64,6 +69,7 @@ class Processor {
 
   std::atomic<pid_t> tid_{-1};
   std::atomic<bool> running_{false};
+  int numa_node_ = -1;
 
   std::shared_ptr<Snapshot> snap_shot_ = std::make_shared<Snapshot>();
 };
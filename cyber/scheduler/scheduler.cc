@@ -17,6 +17,7 @@
 #include "cyber/scheduler/scheduler.h"
 
 #include <sched.h>
+#include <cstdio>
 #include <utility>
 
 #include "cyber/common/environment.h"
@@ -121,6 +122,29 @@ void Scheduler::CheckSchedStatus() {
   snap_info.clear();
 }
 
+void Scheduler::GetRoutineStats(std::vector<RoutineStatSample>* samples) {
+  if (samples == nullptr) {
+    return;
+  }
+  samples->clear();
+  ReadLockGuard<AtomicRWLock> lk(id_cr_lock_);
+  samples->reserve(id_cr_.size());
+  for (auto& cr : id_cr_) {
+    const auto& stat = cr.second->statistics();
+    RoutineStatSample sample;
+    sample.id = cr.second->id();
+    snprintf(sample.name, sizeof(sample.name), "%s",
+             cr.second->name().c_str());
+    sample.exec_time_ns = stat.exec_time_ns.load(std::memory_order_relaxed);
+    sample.switch_count = stat.switch_count.load(std::memory_order_relaxed);
+    sample.wait_time_ns = stat.wait_time_ns.load(std::memory_order_relaxed);
+    for (int i = 0; i < croutine::RoutineStatistics::kWaitHistSize; ++i) {
+      sample.wait_hist[i] = stat.wait_hist[i].load(std::memory_order_relaxed);
+    }
+    samples->emplace_back(sample);
+  }
+}
+
 void Scheduler::Shutdown() {
   if (cyber_unlikely(stop_.exchange(true))) {
     return;
@@ -53,6 +53,17 @@ using apollo::cyber::proto::InnerThread;
 class Processor;
 class ProcessorContext;
 
+// Fixed-size snapshot of one croutine's cumulative statistics, plain POD
+// so samples can be written to a binary ring file and parsed post-mortem.
+struct RoutineStatSample {
+  uint64_t id;
+  char name[48];
+  uint64_t exec_time_ns;
+  uint64_t switch_count;
+  uint64_t wait_time_ns;
+  uint64_t wait_hist[croutine::RoutineStatistics::kWaitHistSize];
+};
+
 class Scheduler {
  public:
   virtual ~Scheduler() {}
@@ -76,6 +87,7 @@ class Scheduler {
   virtual bool RemoveCRoutine(uint64_t crid) = 0;
 
   void CheckSchedStatus();
+  void GetRoutineStats(std::vector<RoutineStatSample>* samples);
 
   void SetInnerThreadConfs(
       const std::unordered_map<std::string, InnerThread>& confs) {
@@ -64,6 +64,8 @@ Scheduler* Instance() {
       }
       if (!policy.compare("classic")) {
         obj = new SchedulerClassic();
+      } else if (!policy.compare("classic_work_stealing")) {
+        obj = new SchedulerClassic(true);
       } else if (!policy.compare("choreography")) {
         obj = new SchedulerChoreography();
       } else {
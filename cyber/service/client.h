@@ -25,6 +25,7 @@
 #include <tuple>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "cyber/common/log.h"
 #include "cyber/common/types.h"
@@ -155,6 +156,8 @@ class Client : public ClientBase {
 
   bool IsInit(void) const { return response_receiver_ != nullptr; }
 
+  bool ServiceOnSameHost() const;
+
   std::string node_name_;
 
   std::function<void(const std::shared_ptr<Response>&,
@@ -168,6 +171,10 @@ class Client : public ClientBase {
 
   std::shared_ptr<transport::Transmitter<Request>> request_transmitter_;
   std::shared_ptr<transport::Receiver<Response>> response_receiver_;
+  // shared-memory path for intra-host calls; may stay null, in which
+  // case every request rides on rtps
+  std::shared_ptr<transport::Transmitter<Request>> shm_request_transmitter_;
+  std::shared_ptr<transport::Receiver<Response>> shm_response_receiver_;
   std::string request_channel_;
   std::string response_channel_;
 
@@ -182,6 +189,9 @@ template <typename Request, typename Response>
 bool Client<Request, Response>::Init() {
   proto::RoleAttributes role;
   role.set_node_name(node_name_);
+  // the shm lane identifies its host by ip hash
+  role.set_host_name(common::GlobalData::Instance()->HostName());
+  role.set_host_ip(common::GlobalData::Instance()->HostIp());
   role.set_channel_name(request_channel_);
   auto channel_id = common::GlobalData::RegisterChannel(request_channel_);
   role.set_channel_id(channel_id);
@@ -196,6 +206,14 @@ bool Client<Request, Response>::Init() {
   }
   writer_id_ = request_transmitter_->id();
 
+  // An additional shm lane for the intra-host case. Failure here is not
+  // fatal, the client just keeps every request on rtps.
+  shm_request_transmitter_ =
+      transport->CreateTransmitter<Request>(role, proto::OptionalMode::SHM);
+  if (shm_request_transmitter_ == nullptr) {
+    AWARN << "Create shm request pub failed, fall back to rtps.";
+  }
+
   response_callback_ =
       std::bind(&Client<Request, Response>::HandleResponse, this,
                 std::placeholders::_1, std::placeholders::_2);
@@ -216,11 +234,41 @@ bool Client<Request, Response>::Init() {
   if (response_receiver_ == nullptr) {
     AERROR << "Create response sub failed.";
     request_transmitter_.reset();
+    shm_request_transmitter_.reset();
     return false;
   }
+
+  if (shm_request_transmitter_ != nullptr) {
+    shm_response_receiver_ = transport->CreateReceiver<Response>(
+        role,
+        [=](const std::shared_ptr<Response>& response,
+            const transport::MessageInfo& message_info,
+            const proto::RoleAttributes& reader_attr) {
+          (void)reader_attr;
+          response_callback_(response, message_info);
+        },
+        proto::OptionalMode::SHM);
+    if (shm_response_receiver_ == nullptr) {
+      AWARN << "Create shm response sub failed, fall back to rtps.";
+      shm_request_transmitter_.reset();
+    }
+  }
   return true;
 }
 
+template <typename Request, typename Response>
+bool Client<Request, Response>::ServiceOnSameHost() const {
+  std::vector<proto::RoleAttributes> servers;
+  service_discovery::TopologyManager::Instance()->service_manager()->GetServers(
+      &servers);
+  for (auto& server : servers) {
+    if (server.service_name() == service_name_) {
+      return server.host_name() == common::GlobalData::Instance()->HostName();
+    }
+  }
+  return false;
+}
+
 template <typename Request, typename Response>
 typename Client<Request, Response>::SharedResponse
 Client<Request, Response>::SendRequest(SharedRequest request,
@@ -272,7 +320,13 @@ Client<Request, Response>::AsyncSendRequest(SharedRequest request,
     std::lock_guard<std::mutex> lock(pending_requests_mutex_);
     sequence_number_++;
     transport::MessageInfo info(writer_id_, sequence_number_, writer_id_);
-    request_transmitter_->Transmit(request, info);
+    // Same-host services get the request over shared memory; everything
+    // else, and any client without a shm lane, stays on rtps.
+    if (shm_request_transmitter_ != nullptr && ServiceOnSameHost()) {
+      shm_request_transmitter_->Transmit(request, info);
+    } else {
+      request_transmitter_->Transmit(request, info);
+    }
     SharedPromise call_promise = std::make_shared<Promise>();
     SharedFuture f(call_promise->get_future());
     pending_requests_[info.seq_num()] =
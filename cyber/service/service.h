@@ -94,10 +94,10 @@ class Service : public ServiceBase {
 
  private:
   void HandleRequest(const std::shared_ptr<Request>& request,
-                     const transport::MessageInfo& message_info);
+                     const transport::MessageInfo& message_info, bool via_shm);
 
   void SendResponse(const transport::MessageInfo& message_info,
-                    const std::shared_ptr<Response>& response);
+                    const std::shared_ptr<Response>& response, bool via_shm);
 
   bool IsInit(void) const { return request_receiver_ != nullptr; }
 
@@ -109,6 +109,10 @@ class Service : public ServiceBase {
       request_callback_;
   std::shared_ptr<transport::Transmitter<Response>> response_transmitter_;
   std::shared_ptr<transport::Receiver<Request>> request_receiver_;
+  // shm lane for requests arriving from same-host clients; the response
+  // goes back on whichever lane the request came in on
+  std::shared_ptr<transport::Transmitter<Response>> shm_response_transmitter_;
+  std::shared_ptr<transport::Receiver<Request>> shm_request_receiver_;
   std::string request_channel_;
   std::string response_channel_;
   std::mutex service_handle_request_mutex_;
@@ -166,6 +170,9 @@ bool Service<Request, Response>::Init() {
   }
   proto::RoleAttributes role;
   role.set_node_name(node_name_);
+  // the shm lane identifies its host by ip hash
+  role.set_host_name(common::GlobalData::Instance()->HostName());
+  role.set_host_ip(common::GlobalData::Instance()->HostIp());
   role.set_channel_name(response_channel_);
   auto channel_id = common::GlobalData::RegisterChannel(response_channel_);
   role.set_channel_id(channel_id);
@@ -179,9 +186,17 @@ bool Service<Request, Response>::Init() {
     return false;
   }
 
+  // Same-host clients send their requests over shared memory. Failure
+  // here is not fatal, such clients just keep riding on rtps.
+  shm_response_transmitter_ =
+      transport->CreateTransmitter<Response>(role, proto::OptionalMode::SHM);
+  if (shm_response_transmitter_ == nullptr) {
+    AWARN << "Create shm response pub failed, fall back to rtps.";
+  }
+
   request_callback_ =
       std::bind(&Service<Request, Response>::HandleRequest, this,
-                std::placeholders::_1, std::placeholders::_2);
+                std::placeholders::_1, std::placeholders::_2, false);
 
   role.set_channel_name(request_channel_);
   channel_id = common::GlobalData::RegisterChannel(request_channel_);
@@ -193,7 +208,7 @@ bool Service<Request, Response>::Init() {
           const proto::RoleAttributes& reader_attr) {
         (void)reader_attr;
         auto task = [this, request, message_info]() {
-          this->HandleRequest(request, message_info);
+          this->HandleRequest(request, message_info, false);
         };
         Enqueue(std::move(task));
       },
@@ -203,15 +218,36 @@ bool Service<Request, Response>::Init() {
   if (request_receiver_ == nullptr) {
     AERROR << " Create request sub failed." << request_channel_;
     response_transmitter_.reset();
+    shm_response_transmitter_.reset();
     return false;
   }
+
+  if (shm_response_transmitter_ != nullptr) {
+    shm_request_receiver_ = transport->CreateReceiver<Request>(
+        role,
+        [=](const std::shared_ptr<Request>& request,
+            const transport::MessageInfo& message_info,
+            const proto::RoleAttributes& reader_attr) {
+          (void)reader_attr;
+          auto task = [this, request, message_info]() {
+            this->HandleRequest(request, message_info, true);
+          };
+          Enqueue(std::move(task));
+        },
+        proto::OptionalMode::SHM);
+    if (shm_request_receiver_ == nullptr) {
+      AWARN << "Create shm request sub failed, fall back to rtps."
+            << request_channel_;
+      shm_response_transmitter_.reset();
+    }
+  }
   return true;
 }
 
 template <typename Request, typename Response>
 void Service<Request, Response>::HandleRequest(
     const std::shared_ptr<Request>& request,
-    const transport::MessageInfo& message_info) {
+    const transport::MessageInfo& message_info, bool via_shm) {
   if (!IsInit()) {
     // LOG_DEBUG << "not inited error.";
     return;
@@ -221,21 +257,27 @@ void Service<Request, Response>::HandleRequest(
   auto response = std::make_shared<Response>();
   service_callback_(request, response);
   transport::MessageInfo msg_info(message_info);
-  msg_info.set_sender_id(response_transmitter_->id());
-  SendResponse(msg_info, response);
+  auto& transmitter =
+      via_shm ? shm_response_transmitter_ : response_transmitter_;
+  msg_info.set_sender_id(transmitter->id());
+  SendResponse(msg_info, response, via_shm);
 }
 
 template <typename Request, typename Response>
 void Service<Request, Response>::SendResponse(
     const transport::MessageInfo& message_info,
-    const std::shared_ptr<Response>& response) {
+    const std::shared_ptr<Response>& response, bool via_shm) {
   if (!IsInit()) {
     // LOG_DEBUG << "not inited error.";
     return;
   }
   // publish return value ?
   // LOG_DEBUG << "send response id:" << message_id.sequence_number;
-  response_transmitter_->Transmit(response, message_info);
+  if (via_shm) {
+    shm_response_transmitter_->Transmit(response, message_info);
+  } else {
+    response_transmitter_->Transmit(response, message_info);
+  }
 }
 
 }  // namespace cyber
@@ -222,6 +222,26 @@ bool ChannelManager::IsMessageTypeMatching(const std::string& lhs,
   return false;
 }
 
+uint64_t ChannelManager::GetVersionedSnapshot(RoleAttrVec* writers,
+                                              RoleAttrVec* readers) {
+  RETURN_VAL_IF_NULL(writers, 0);
+  RETURN_VAL_IF_NULL(readers, 0);
+
+  uint64_t version = TopologyVersion();
+  while (true) {
+    writers->clear();
+    readers->clear();
+    GetWriters(writers);
+    GetReaders(readers);
+    // retry if changes were applied while the copies were taken
+    uint64_t current = TopologyVersion();
+    if (current == version) {
+      return version;
+    }
+    version = current;
+  }
+}
+
 bool ChannelManager::Check(const RoleAttributes& attr) {
   RETURN_VAL_IF(!attr.has_channel_name(), false);
   RETURN_VAL_IF(!attr.has_channel_id(), false);
@@ -191,6 +191,18 @@ class ChannelManager : public Manager {
    */
   bool IsMessageTypeMatching(const std::string& lhs, const std::string& rhs);
 
+  /**
+   * @brief Get a consistent snapshot of all writers and readers, together
+   * with the topology version it corresponds to. A late joiner takes one
+   * snapshot and then applies only the deltas that arrive afterwards,
+   * instead of replaying the whole change history.
+   *
+   * @param writers result writer RoleAttr vector
+   * @param readers result reader RoleAttr vector
+   * @return uint64_t version of the returned snapshot
+   */
+  uint64_t GetVersionedSnapshot(RoleAttrVec* writers, RoleAttrVec* readers);
+
  private:
   bool Check(const RoleAttributes& attr) override;
   void Dispose(const ChangeMsg& msg) override;
@@ -16,9 +16,14 @@
 
 #include "cyber/service_discovery/specific_manager/manager.h"
 
+#include <utility>
+#include <vector>
+
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
+#include "cyber/croutine/croutine.h"
 #include "cyber/message/message_traits.h"
+#include "cyber/scheduler/scheduler_factory.h"
 #include "cyber/time/time.h"
 #include "cyber/transport/qos/qos_profile_conf.h"
 #include "cyber/transport/rtps/attributes_filler.h"
@@ -40,7 +45,10 @@ Manager::Manager()
       channel_name_(""),
       publisher_(nullptr),
       subscriber_(nullptr),
-      listener_(nullptr) {
+      listener_(nullptr),
+      applier_id_(0),
+      applier_started_(false),
+      version_(0) {
   host_name_ = common::GlobalData::Instance()->HostName();
   process_id_ = common::GlobalData::Instance()->ProcessId();
 }
@@ -59,6 +67,11 @@ bool Manager::StartDiscovery(RtpsParticipant* participant) {
     StopDiscovery();
     return false;
   }
+  if (!StartChangeApplier()) {
+    AERROR << "create change applier failed.";
+    StopDiscovery();
+    return false;
+  }
   return true;
 }
 
@@ -67,6 +80,8 @@ void Manager::StopDiscovery() {
     return;
   }
 
+  StopChangeApplier();
+
   {
     std::lock_guard<std::mutex> lg(lock_);
     if (publisher_ != nullptr) {
@@ -183,7 +198,10 @@ void Manager::Convert(const RoleAttributes& attr, RoleType role,
   }
 }
 
-void Manager::Notify(const ChangeMsg& msg) { signal_(msg); }
+void Manager::Notify(const ChangeMsg& msg) {
+  version_.fetch_add(1);
+  signal_(msg);
+}
 
 void Manager::OnRemoteChange(const std::string& msg_str) {
   if (is_shutdown_.load()) {
@@ -197,7 +215,56 @@ void Manager::OnRemoteChange(const std::string& msg_str) {
     return;
   }
   RETURN_IF(!Check(msg.role_attr()));
-  Dispose(msg);
+
+  if (!applier_started_.load()) {
+    Dispose(msg);
+    return;
+  }
+
+  // queue the delta and let the applier croutine churn through the burst,
+  // so the rtps listener thread returns immediately
+  {
+    std::lock_guard<std::mutex> lg(pending_lock_);
+    pending_changes_.emplace_back(std::move(msg));
+  }
+  scheduler::Instance()->NotifyTask(applier_id_);
+}
+
+bool Manager::StartChangeApplier() {
+  applier_name_ = "/internal/topo" + channel_name_;
+  applier_id_ = common::GlobalData::RegisterTaskName(applier_name_);
+  auto func = [this]() {
+    while (!is_shutdown_.load() && is_discovery_started_.load()) {
+      std::vector<ChangeMsg> local;
+      {
+        std::lock_guard<std::mutex> lg(pending_lock_);
+        local.swap(pending_changes_);
+      }
+      if (local.empty()) {
+        auto routine = croutine::CRoutine::GetCurrentRoutine();
+        routine->HangUp();
+        continue;
+      }
+      for (auto& msg : local) {
+        if (is_shutdown_.load()) {
+          return;
+        }
+        Dispose(msg);
+      }
+    }
+  };
+  if (!scheduler::Instance()->CreateTask(std::move(func), applier_name_)) {
+    return false;
+  }
+  applier_started_.store(true);
+  return true;
+}
+
+void Manager::StopChangeApplier() {
+  if (!applier_started_.exchange(false)) {
+    return;
+  }
+  scheduler::Instance()->RemoveTask(applier_name_);
 }
 
 bool Manager::Publish(const ChangeMsg& msg) {
@@ -21,6 +21,7 @@
 #include <functional>
 #include <mutex>
 #include <string>
+#include <vector>
 
 #include "fastrtps/Domain.h"
 #include "fastrtps/attributes/PublisherAttributes.h"
@@ -135,6 +136,14 @@ class Manager {
   virtual void OnTopoModuleLeave(const std::string& host_name,
                                  int process_id) = 0;
 
+  /**
+   * @brief Get the version of the local topology view, bumped once per
+   * applied change. A late joiner can pair it with a full snapshot of the
+   * current roles and then apply only newer deltas instead of replaying
+   * the change history.
+   */
+  uint64_t TopologyVersion() const { return version_.load(); }
+
  protected:
   bool CreatePublisher(RtpsParticipant* participant);
   bool CreateSubscriber(RtpsParticipant* participant);
@@ -151,6 +160,9 @@ class Manager {
   void OnRemoteChange(const std::string& msg_str);
   bool IsFromSameProcess(const ChangeMsg& msg);
 
+  bool StartChangeApplier();
+  void StopChangeApplier();
+
   std::atomic<bool> is_shutdown_;
   std::atomic<bool> is_discovery_started_;
   int allowed_role_;
@@ -164,6 +176,15 @@ class Manager {
   SubscriberListener* listener_;
 
   ChangeSignal signal_;
+
+  // remote deltas are queued here and applied in batches by a croutine, so
+  // the rtps listener thread never churns through warehouse updates
+  std::mutex pending_lock_;
+  std::vector<ChangeMsg> pending_changes_;
+  std::string applier_name_;
+  uint64_t applier_id_;
+  std::atomic<bool> applier_started_;
+  std::atomic<uint64_t> version_;
 };
 
 }  // namespace service_discovery
@@ -16,19 +16,33 @@
 
 #include "cyber/sysmo/sysmo.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstring>
+
 #include "cyber/common/environment.h"
+#include "cyber/time/time.h"
 
 namespace apollo {
 namespace cyber {
 
 using apollo::cyber::common::GetEnv;
 
+namespace {
+const char kRingMagic[8] = {'C', 'Y', 'B', 'S', 'Y', 'S', 'M', 'O'};
+const uint32_t kRingVersion = 1;
+const uint64_t kRingCapacity = 8192;
+}  // namespace
+
 SysMo::SysMo() { Start(); }
 
 void SysMo::Start() {
   auto sysmo_start = GetEnv("sysmo_start");
   if (sysmo_start != "" && std::stoi(sysmo_start)) {
     start_ = true;
+    InitStatRing();
     sysmo_ = std::thread(&SysMo::Checker, this);
   }
 }
@@ -42,15 +56,82 @@ void SysMo::Shutdown() {
   if (sysmo_.joinable()) {
     sysmo_.join();
   }
+  CloseStatRing();
 }
 
 void SysMo::Checker() {
   while (cyber_unlikely(!shut_down_.load())) {
     scheduler::Instance()->CheckSchedStatus();
+    SampleRoutineStats();
     std::unique_lock<std::mutex> lk(lk_);
     cv_.wait_for(lk, std::chrono::milliseconds(sysmo_interval_ms_));
   }
 }
 
+bool SysMo::InitStatRing() {
+  const std::string path =
+      "/tmp/cyber_sysmo_" + std::to_string(getpid()) + ".bin";
+  ring_size_ =
+      sizeof(SysMoRingHeader) + kRingCapacity * sizeof(SysMoRingRecord);
+  ring_fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (ring_fd_ < 0) {
+    AERROR << "sysmo: failed to create stat file: " << path;
+    return false;
+  }
+  if (ftruncate(ring_fd_, static_cast<off_t>(ring_size_)) != 0) {
+    AERROR << "sysmo: failed to size stat file: " << path;
+    close(ring_fd_);
+    ring_fd_ = -1;
+    return false;
+  }
+  void* addr = mmap(nullptr, ring_size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                    ring_fd_, 0);
+  if (addr == MAP_FAILED) {
+    AERROR << "sysmo: failed to mmap stat file: " << path;
+    close(ring_fd_);
+    ring_fd_ = -1;
+    return false;
+  }
+  ring_header_ = reinterpret_cast<SysMoRingHeader*>(addr);
+  ring_records_ = reinterpret_cast<SysMoRingRecord*>(
+      static_cast<char*>(addr) + sizeof(SysMoRingHeader));
+  memcpy(ring_header_->magic, kRingMagic, sizeof(kRingMagic));
+  ring_header_->version = kRingVersion;
+  ring_header_->record_size = sizeof(SysMoRingRecord);
+  ring_header_->capacity = kRingCapacity;
+  ring_header_->next_index.store(0);
+  AINFO << "sysmo: routine stats exported to " << path;
+  return true;
+}
+
+void SysMo::CloseStatRing() {
+  if (ring_header_ != nullptr) {
+    munmap(ring_header_, ring_size_);
+    ring_header_ = nullptr;
+    ring_records_ = nullptr;
+  }
+  if (ring_fd_ >= 0) {
+    close(ring_fd_);
+    ring_fd_ = -1;
+  }
+}
+
+void SysMo::SampleRoutineStats() {
+  if (ring_header_ == nullptr) {
+    return;
+  }
+  scheduler::Instance()->GetRoutineStats(&samples_);
+  const auto now = Time::Now().ToNanosecond();
+  for (const auto& sample : samples_) {
+    // bump next_index only after the record is fully written so that a
+    // reader never sees a half filled slot as valid
+    const auto index = ring_header_->next_index.load();
+    auto& record = ring_records_[index % kRingCapacity];
+    record.timestamp_ns = now;
+    record.sample = sample;
+    ring_header_->next_index.store(index + 1, std::memory_order_release);
+  }
+}
+
 }  // namespace cyber
 }  // namespace apollo
@@ -23,6 +23,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "cyber/scheduler/scheduler_factory.h"
 
@@ -30,6 +31,24 @@ namespace apollo {
 namespace cyber {
 
 using apollo::cyber::scheduler::Scheduler;
+using apollo::cyber::scheduler::RoutineStatSample;
+
+// Layout of the binary stat file /tmp/cyber_sysmo_<pid>.bin. The header is
+// followed by capacity fixed-size records used as a ring, next_index ever
+// increasing; next_index % capacity is the oldest record once it wraps.
+// The file is mmapped so records survive a crash of the process.
+struct SysMoRingHeader {
+  char magic[8];  // "CYBSYSMO"
+  uint32_t version;
+  uint32_t record_size;
+  uint64_t capacity;
+  std::atomic<uint64_t> next_index;
+};
+
+struct SysMoRingRecord {
+  uint64_t timestamp_ns;
+  RoutineStatSample sample;
+};
 
 class SysMo {
  public:
@@ -38,6 +57,9 @@ class SysMo {
 
  private:
   void Checker();
+  bool InitStatRing();
+  void CloseStatRing();
+  void SampleRoutineStats();
 
   std::atomic<bool> shut_down_{false};
   bool start_ = false;
@@ -47,6 +69,12 @@ class SysMo {
   std::mutex lk_;
   std::thread sysmo_;
 
+  int ring_fd_ = -1;
+  size_t ring_size_ = 0;
+  SysMoRingHeader* ring_header_ = nullptr;
+  SysMoRingRecord* ring_records_ = nullptr;
+  std::vector<RoutineStatSample> samples_;
+
   DECLARE_SINGLETON(SysMo);
 };
 
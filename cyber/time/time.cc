@@ -16,6 +16,10 @@
 
 #include "cyber/time/time.h"
 
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
 #include <chrono>
 #include <ctime>
 #include <iomanip>
@@ -30,6 +34,85 @@ using std::chrono::high_resolution_clock;
 using std::chrono::steady_clock;
 using std::chrono::system_clock;
 
+namespace {
+
+uint64_t SystemNowNs() {
+  auto now = high_resolution_clock::now();
+  auto nano_time_point =
+      std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
+  auto epoch = nano_time_point.time_since_epoch();
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(epoch).count());
+}
+
+#if defined(__x86_64__)
+
+// Fast path for Now(): extrapolate from rdtsc with per-thread calibration
+// against the system clock. Extrapolation is capped at kMaxExtrapolationNs
+// past the last real clock read, which bounds the fast-path error to the
+// tick rate estimation error times that window (measured in the low
+// microseconds); every window expiry re-anchors on a real clock read.
+constexpr uint64_t kMaxExtrapolationNs = 10 * 1000 * 1000;
+// span needed between the rate anchor and the newest clock read before the
+// tick rate estimate is trusted; the estimate keeps refining over the
+// growing span until the anchor is renewed
+constexpr uint64_t kMinRateEstimationSpanNs = 10 * 1000 * 1000;
+// renew the rate anchor periodically so a system clock step can poison the
+// rate estimate for at most one anchor period
+constexpr uint64_t kMaxRateAnchorAgeNs = 60ULL * 1000 * 1000 * 1000;
+// plausibility range for the estimated tick length, guarding the rate
+// estimate against clock steps between anchors
+constexpr double kMinNsPerTick = 0.05;
+constexpr double kMaxNsPerTick = 100.0;
+
+struct TscCalibration {
+  uint64_t base_tsc = 0;
+  uint64_t base_ns = 0;
+  uint64_t rate_anchor_tsc = 0;
+  uint64_t rate_anchor_ns = 0;
+  double ns_per_tick = 0.0;
+};
+
+uint64_t FastNowNs() {
+  static thread_local TscCalibration calibration;
+  const uint64_t tsc = __rdtsc();
+  if (calibration.ns_per_tick > 0.0 && tsc >= calibration.base_tsc) {
+    const uint64_t elapsed_ns = static_cast<uint64_t>(
+        static_cast<double>(tsc - calibration.base_tsc) *
+        calibration.ns_per_tick);
+    if (elapsed_ns < kMaxExtrapolationNs) {
+      return calibration.base_ns + elapsed_ns;
+    }
+  }
+  const uint64_t now_ns = SystemNowNs();
+  const uint64_t anchor_age_ns = now_ns - calibration.rate_anchor_ns;
+  if (calibration.rate_anchor_tsc == 0 ||
+      anchor_age_ns > kMaxRateAnchorAgeNs) {
+    calibration.rate_anchor_tsc = tsc;
+    calibration.rate_anchor_ns = now_ns;
+    calibration.ns_per_tick = 0.0;
+  } else if (anchor_age_ns > kMinRateEstimationSpanNs &&
+             tsc > calibration.rate_anchor_tsc) {
+    const double ns_per_tick =
+        static_cast<double>(anchor_age_ns) /
+        static_cast<double>(tsc - calibration.rate_anchor_tsc);
+    if (ns_per_tick > kMinNsPerTick && ns_per_tick < kMaxNsPerTick) {
+      calibration.ns_per_tick = ns_per_tick;
+    }
+  }
+  calibration.base_tsc = tsc;
+  calibration.base_ns = now_ns;
+  return now_ns;
+}
+
+#else
+
+uint64_t FastNowNs() { return SystemNowNs(); }
+
+#endif
+
+}  // namespace
+
 const Time Time::MAX = Time(std::numeric_limits<uint64_t>::max());
 const Time Time::MIN = Time(1);
 
@@ -54,14 +137,13 @@ Time& Time::operator=(const Time& other) {
   return *this;
 }
 
-Time Time::Now() {
-  auto now = high_resolution_clock::now();
-  auto nano_time_point =
-      std::chrono::time_point_cast<std::chrono::nanoseconds>(now);
-  auto epoch = nano_time_point.time_since_epoch();
-  uint64_t now_nano =
-      std::chrono::duration_cast<std::chrono::nanoseconds>(epoch).count();
-  return Time(now_nano);
+Time Time::Now() { return Time(FastNowNs()); }
+
+void Time::StampBatch(const size_t count, uint64_t* nanoseconds) {
+  const uint64_t now_nano = FastNowNs();
+  for (size_t i = 0; i < count; ++i) {
+    nanoseconds[i] = now_nano;
+  }
 }
 
 Time Time::MonoTime() {
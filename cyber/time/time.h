@@ -48,6 +48,15 @@ class Time {
   static Time Now();
   static Time MonoTime();
 
+  /**
+   * @brief fill a contiguous array of nanosecond timestamps from a single
+   * clock read, for callers that stamp several fields at once.
+   *
+   * @param count the number of timestamps to write.
+   * @param nanoseconds the output array, at least count elements.
+   */
+  static void StampBatch(const size_t count, uint64_t* nanoseconds);
+
   /**
    * @brief Sleep Until time.
    *
@@ -16,6 +16,7 @@
 
 #include "cyber/time/time.h"
 
+#include <chrono>
 #include <iostream>
 #include "gtest/gtest.h"
 
@@ -66,6 +67,44 @@ TEST(TimeTest, to_string) {
 
 TEST(TimeTest, now) { std::cout << "Time Now: " << Time::Now() << std::endl; }
 
+TEST(TimeTest, now_accuracy) {
+  auto system_now_ns = []() {
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::high_resolution_clock::now().time_since_epoch())
+            .count());
+  };
+  // the fast clock path must track the system clock within a loose bound
+  // across repeated reads, including re-calibrations; samples where the
+  // thread was preempted between the bracketing reads are discarded
+  for (int i = 0; i < 100000; ++i) {
+    const uint64_t reference_before = system_now_ns();
+    const uint64_t fast = Time::Now().ToNanosecond();
+    const uint64_t reference_after = system_now_ns();
+    if (reference_after - reference_before > 100000) {
+      continue;
+    }
+    constexpr uint64_t kMaxErrorNs = 1000000;
+    EXPECT_GE(fast + kMaxErrorNs, reference_before);
+    EXPECT_LE(fast, reference_after + kMaxErrorNs);
+  }
+}
+
+TEST(TimeTest, stamp_batch) {
+  uint64_t stamps[4] = {0, 0, 0, 0};
+  const uint64_t before = Time::Now().ToNanosecond();
+  Time::StampBatch(4, stamps);
+  const uint64_t after = Time::Now().ToNanosecond();
+  // all stamps come from one clock read; bracket them loosely since a
+  // re-calibration between reads may step by the extrapolation error
+  constexpr uint64_t kSlackNs = 1000000;
+  for (const uint64_t stamp : stamps) {
+    EXPECT_EQ(stamps[0], stamp);
+    EXPECT_GE(stamp + kSlackNs, before);
+    EXPECT_LE(stamp, after + kSlackNs);
+  }
+}
+
 TEST(TimeTest, is_zero) {
   Time time;
   EXPECT_TRUE(time.IsZero());
@@ -137,6 +137,29 @@ void Timer::Start() {
   }
 }
 
+std::vector<std::shared_ptr<Timer>> Timer::StartBatch(
+    const std::vector<TimerOption>& options) {
+  std::vector<std::shared_ptr<Timer>> timers;
+  if (!common::GlobalData::Instance()->IsRealityMode()) {
+    return timers;
+  }
+
+  timers.reserve(options.size());
+  std::vector<std::shared_ptr<TimerTask>> tasks;
+  tasks.reserve(options.size());
+  for (const auto& opt : options) {
+    auto timer = std::make_shared<Timer>(opt);
+    timer->started_.store(true);
+    if (timer->InitTimerTask()) {
+      tasks.push_back(timer->task_);
+      timers.push_back(timer);
+    }
+  }
+  TimingWheel::Instance()->AddTasks(tasks);
+  AINFO << "start timer batch, size: " << tasks.size();
+  return timers;
+}
+
 void Timer::Stop() {
   if (started_.exchange(false) && task_) {
     AINFO << "stop timer, the timer_id: " << timer_id_;
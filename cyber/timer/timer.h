@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "cyber/timer/timing_wheel.h"
 
@@ -109,6 +110,22 @@ class Timer {
    */
   void Stop();
 
+  /**
+   * @brief Create and start a batch of timers in one call
+   *
+   * All timers of the batch are armed against one snapshot of the timing
+   * wheel position, so registering many periodic timers at once (e.g. one
+   * per monitored module) pays the wheel bookkeeping once instead of once
+   * per timer, and their first cycles start aligned.
+   *
+   * @param options One option per timer to create
+   * @return The started timers; options that fail validation are dropped
+   *         (with an error log), so the result may be smaller than the
+   *         input. Stop() or destroy a returned timer to cancel it.
+   */
+  static std::vector<std::shared_ptr<Timer>> StartBatch(
+      const std::vector<TimerOption>& options);
+
  private:
   bool InitTimerTask();
   uint64_t timer_id_;
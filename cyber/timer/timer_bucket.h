@@ -17,28 +17,52 @@
 #ifndef CYBER_TIMER_TIMER_BUCKET_H_
 #define CYBER_TIMER_TIMER_BUCKET_H_
 
-#include <list>
+#include <atomic>
 #include <memory>
-#include <mutex>
 
 #include "cyber/timer/timer_task.h"
 
 namespace apollo {
 namespace cyber {
 
+// One slot of the timing wheel. Insertion is a lock-free push onto an
+// atomic singly-linked list so that threads arming timers never serialize
+// on a bucket mutex; the tick thread detaches the whole list with a single
+// exchange when the slot fires. Order inside a slot does not matter, every
+// task in it expires on the same tick.
 class TimerBucket {
  public:
+  struct TaskNode {
+    explicit TaskNode(const std::shared_ptr<TimerTask>& t) : task(t) {}
+    std::weak_ptr<TimerTask> task;
+    TaskNode* next = nullptr;
+  };
+
+  ~TimerBucket() { FreeList(DrainAll()); }
+
   void AddTask(const std::shared_ptr<TimerTask>& task) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    task_list_.push_back(task);
+    auto* node = new TaskNode(task);
+    node->next = head_.load(std::memory_order_relaxed);
+    while (!head_.compare_exchange_weak(node->next, node,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
   }
 
-  std::mutex& mutex() { return mutex_; }
-  std::list<std::weak_ptr<TimerTask>>& task_list() { return task_list_; }
+  // Detaches and returns the whole task list. The caller owns the returned
+  // nodes and releases them with FreeList().
+  TaskNode* DrainAll() { return head_.exchange(nullptr); }
+
+  static void FreeList(TaskNode* node) {
+    while (node != nullptr) {
+      auto* next = node->next;
+      delete node;
+      node = next;
+    }
+  }
 
  private:
-  std::mutex mutex_;
-  std::list<std::weak_ptr<TimerTask>> task_list_;
+  std::atomic<TaskNode*> head_ = {nullptr};
 };
 
 }  // namespace cyber
@@ -16,8 +16,10 @@
 
 /* note that the frame code of the following is Generated by script  */
 
+#include <atomic>
 #include <memory>
 #include <utility>
+#include <vector>
 #include "gtest/gtest.h"
 
 #include "cyber/common/util.h"
@@ -64,6 +66,31 @@ TEST(TimerTest, cycle) {
   }
 }
 
+TEST(TimerTest, start_batch) {
+  std::atomic<int> count = {0};
+  std::vector<TimerOption> options;
+  for (int i = 0; i < 100; i++) {
+    options.emplace_back(10, [&count] { count++; }, false);
+  }
+  auto timers = Timer::StartBatch(options);
+  EXPECT_EQ(100, timers.size());
+  std::this_thread::sleep_for(std::chrono::seconds(1));
+  for (auto& timer : timers) {
+    timer->Stop();
+  }
+  EXPECT_GT(count.load(), 0);
+
+  // an invalid period is dropped from the batch, the rest still starts
+  options.clear();
+  options.emplace_back(0, [&count] { count++; }, false);
+  options.emplace_back(10, [&count] { count++; }, false);
+  timers = Timer::StartBatch(options);
+  EXPECT_EQ(1, timers.size());
+  for (auto& timer : timers) {
+    timer->Stop();
+  }
+}
+
 TEST(TimerTest, start_stop) {
   int count = 0;
   Timer timer(2, [count] { AINFO << count; }, false);
@@ -15,6 +15,10 @@
  *****************************************************************************/
 
 #include "cyber/timer/timing_wheel.h"
+
+#include <functional>
+#include <vector>
+
 #include "cyber/task/task.h"
 
 namespace apollo {
@@ -41,29 +45,52 @@ void TimingWheel::Shutdown() {
 }
 
 void TimingWheel::Tick() {
-  auto& bucket = work_wheel_[current_work_wheel_index_];
-  {
-    std::lock_guard<std::mutex> lock(bucket.mutex());
-    auto ite = bucket.task_list().begin();
-    while (ite != bucket.task_list().end()) {
-      auto task = ite->lock();
-      if (task) {
-        ADEBUG << "index: " << current_work_wheel_index_
-               << " timer id: " << task->timer_id_;
-        auto callback = task->callback;
-        cyber::Async([this, callback] {
-          if (this->running_) {
-            callback();
-          }
-        });
-      }
-      ite = bucket.task_list().erase(ite);
+  // Detach the whole slot with one atomic exchange, then dispatch every
+  // expired callback from a single croutine instead of one Async per task.
+  // With thousands of active timers this keeps the tick thread off the
+  // scheduler's hot path and removes the per-task dispatch overhead.
+  auto index = current_work_wheel_index_.load(std::memory_order_relaxed);
+  auto* node = work_wheel_[index].DrainAll();
+  if (node == nullptr) {
+    return;
+  }
+  auto callbacks = std::make_shared<std::vector<std::function<void()>>>();
+  for (auto* ite = node; ite != nullptr; ite = ite->next) {
+    auto task = ite->task.lock();
+    if (task) {
+      ADEBUG << "index: " << index << " timer id: " << task->timer_id_;
+      callbacks->push_back(task->callback);
     }
   }
+  TimerBucket::FreeList(node);
+  if (!callbacks->empty()) {
+    cyber::Async([this, callbacks] {
+      for (auto& callback : *callbacks) {
+        if (!this->running_) {
+          return;
+        }
+        callback();
+      }
+    });
+  }
 }
 
 void TimingWheel::AddTask(const std::shared_ptr<TimerTask>& task) {
-  AddTask(task, current_work_wheel_index_);
+  AddTask(task, current_work_wheel_index_.load(std::memory_order_relaxed));
+}
+
+void TimingWheel::AddTasks(
+    const std::vector<std::shared_ptr<TimerTask>>& tasks) {
+  if (tasks.empty()) {
+    return;
+  }
+  if (!running_) {
+    Start();
+  }
+  auto index = current_work_wheel_index_.load(std::memory_order_relaxed);
+  for (auto& task : tasks) {
+    AddTask(task, index);
+  }
 }
 
 void TimingWheel::AddTask(const std::shared_ptr<TimerTask>& task,
@@ -79,7 +106,8 @@ void TimingWheel::AddTask(const std::shared_ptr<TimerTask>& task,
     task->remainder_interval_ms = real_work_wheel_index;
     auto assistant_ticks = work_wheel_index / WORK_WHEEL_SIZE;
     if (assistant_ticks == 1 &&
-        real_work_wheel_index != current_work_wheel_index_) {
+        real_work_wheel_index !=
+            current_work_wheel_index_.load(std::memory_order_relaxed)) {
       work_wheel_[real_work_wheel_index].AddTask(task);
       ADEBUG << "add task to work wheel. index :" << real_work_wheel_index;
     } else {
@@ -101,16 +129,14 @@ void TimingWheel::AddTask(const std::shared_ptr<TimerTask>& task,
 }
 
 void TimingWheel::Cascade(const uint64_t assistant_wheel_index) {
-  auto& bucket = assistant_wheel_[assistant_wheel_index];
-  std::lock_guard<std::mutex> lock(bucket.mutex());
-  auto ite = bucket.task_list().begin();
-  while (ite != bucket.task_list().end()) {
-    auto task = ite->lock();
+  auto* node = assistant_wheel_[assistant_wheel_index].DrainAll();
+  for (auto* ite = node; ite != nullptr; ite = ite->next) {
+    auto task = ite->task.lock();
     if (task) {
       work_wheel_[task->remainder_interval_ms].AddTask(task);
     }
-    ite = bucket.task_list().erase(ite);
   }
+  TimerBucket::FreeList(node);
 }
 
 void TimingWheel::TickFunc() {
@@ -120,12 +146,11 @@ void TimingWheel::TickFunc() {
     // AINFO_EVERY(1000) << "Tick " << TickCount();
     tick_count_++;
     rate.Sleep();
-    {
-      std::lock_guard<std::mutex> lock(current_work_wheel_index_mutex_);
-      current_work_wheel_index_ =
-          GetWorkWheelIndex(current_work_wheel_index_ + 1);
-    }
-    if (current_work_wheel_index_ == 0) {
+    auto next_work_wheel_index = GetWorkWheelIndex(
+        current_work_wheel_index_.load(std::memory_order_relaxed) + 1);
+    current_work_wheel_index_.store(next_work_wheel_index,
+                                    std::memory_order_relaxed);
+    if (next_work_wheel_index == 0) {
       {
         std::lock_guard<std::mutex> lock(current_assistant_wheel_index_mutex_);
         current_assistant_wheel_index_ =
@@ -21,6 +21,7 @@
 #include <list>
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
@@ -58,6 +59,11 @@ class TimingWheel {
   void AddTask(const std::shared_ptr<TimerTask>& task,
                const uint64_t current_work_wheel_index);
 
+  // Inserts a whole batch against one snapshot of the wheel position, so
+  // bulk registration pays the start-up check and the index load once
+  // instead of once per timer.
+  void AddTasks(const std::vector<std::shared_ptr<TimerTask>>& tasks);
+
   void Cascade(const uint64_t assistant_wheel_index);
 
   void TickFunc();
@@ -77,8 +83,15 @@ class TimingWheel {
   std::mutex running_mutex_;
   TimerBucket work_wheel_[WORK_WHEEL_SIZE];
   TimerBucket assistant_wheel_[ASSISTANT_WHEEL_SIZE];
-  uint64_t current_work_wheel_index_ = 0;
-  std::mutex current_work_wheel_index_mutex_;
+  // The work wheel index is written by the tick thread only and read by
+  // every thread arming a timer, so it is a plain atomic; resolution is
+  // 2 ms anyway, a reader seeing the previous tick is harmless. Together
+  // with the lock-free buckets this keeps the steady-state periodic
+  // re-arm path (callback -> AddTask) entirely off mutexes. The assistant
+  // wheel keeps its mutex: only timers reaching beyond one work-wheel
+  // revolution (~1 s) touch it, and the lock keeps an insert from
+  // interleaving with the cascade of the same slot.
+  std::atomic<uint64_t> current_work_wheel_index_ = {0};
   uint64_t current_assistant_wheel_index_ = 0;
   std::mutex current_assistant_wheel_index_mutex_;
   std::thread tick_thread_;
@@ -27,11 +27,13 @@
 
 constexpr int SecondColumnOffset = 4;
 
-CyberTopologyMessage::CyberTopologyMessage(const std::string& channel)
+CyberTopologyMessage::CyberTopologyMessage(const std::string& channel,
+                                           bool statsOnly)
     : RenderableMessage(nullptr, 1),
       second_column_(SecondColumnType::MessageFrameRatio),
       pid_(getpid()),
       col1_width_(8),
+      stats_only_(statsOnly),
       specified_channel_(channel),
       all_channels_map_() {}
 
@@ -144,8 +146,14 @@ void CyberTopologyMessage::AddReaderWriter(
     channelMsg = new GeneralChannelMessage(outStr.str(), this);
 
     if (channelMsg != nullptr) {
-      if (!GeneralChannelMessage::isErrorCode(
-              channelMsg->OpenChannel(channelName))) {
+      channelMsg->set_channel_attr(channelName, role.channel_id());
+      if (stats_only_) {
+        // no reader: the list view renders rates from the transport's
+        // shared-memory counters; a reader is created only when the user
+        // opens this channel
+        channelMsg->set_message_type(msgTypeName);
+      } else if (!GeneralChannelMessage::isErrorCode(
+                     channelMsg->OpenChannel(channelName))) {
         channelMsg->set_message_type(msgTypeName);
         channelMsg->add_reader(channelMsg->NodeName());
       }
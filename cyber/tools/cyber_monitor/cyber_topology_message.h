@@ -36,7 +36,8 @@ class GeneralChannelMessage;
 
 class CyberTopologyMessage : public RenderableMessage {
  public:
-  explicit CyberTopologyMessage(const std::string& channel);
+  explicit CyberTopologyMessage(const std::string& channel,
+                                bool statsOnly = false);
   ~CyberTopologyMessage();
 
   void Render(const Screen* s, int key) override;
@@ -61,6 +62,10 @@ class CyberTopologyMessage : public RenderableMessage {
 
   int pid_;
   int col1_width_;
+  // In stats-only mode no channel reader is opened at discovery; the list
+  // view renders from the transport's shared-memory counters and a reader
+  // is only created when the user opens a channel.
+  bool stats_only_;
   const std::string& specified_channel_;
   std::map<std::string, GeneralChannelMessage*> all_channels_map_;
 };
@@ -24,6 +24,7 @@
 #include "cyber/record/record_message.h"
 #include "cyber/tools/cyber_monitor/general_message.h"
 #include "cyber/tools/cyber_monitor/screen.h"
+#include "cyber/transport/shm/segment_factory.h"
 
 namespace {
 constexpr int ReaderWriterOffset = 4;
@@ -84,7 +85,12 @@ bool GeneralChannelMessage::isErrorCode(void* ptr) {
 }
 
 double GeneralChannelMessage::frame_ratio(void) {
-  if (!is_enabled() || !has_message_come()) {
+  if (!is_enabled()) {
+    // no reader on this channel: derive the rate from the transport's
+    // shared-memory counters instead of subscribing
+    return stats_frame_ratio();
+  }
+  if (!has_message_come()) {
     return 0.0;
   }
   auto time_now = apollo::cyber::Time::MonoTime();
@@ -105,6 +111,46 @@ double GeneralChannelMessage::frame_ratio(void) {
   return frame_ratio_;
 }
 
+double GeneralChannelMessage::stats_frame_ratio(void) {
+  if (channel_id_ == 0) {
+    return 0.0;
+  }
+  auto time_now = apollo::cyber::Time::MonoTime();
+  auto interval = time_now - time_last_calc_;
+  if (interval.ToNanosecond() <= 1000000000) {
+    return frame_ratio_;
+  }
+
+  if (stats_segment_ == nullptr) {
+    stats_segment_ =
+        apollo::cyber::transport::SegmentFactory::CreateSegment(channel_id_);
+  }
+  apollo::cyber::transport::ChannelStats stats;
+  if (stats_segment_ == nullptr || !stats_segment_->GetStats(&stats)) {
+    // the writer has not created the segment (yet), or the channel does
+    // not go through shared memory
+    return 0.0;
+  }
+
+  if (!stats_primed_) {
+    // first successful read only seeds the counters
+    last_stats_seq_ = stats.msg_count;
+    stats_primed_ = true;
+    time_last_calc_ = time_now;
+    return frame_ratio_;
+  }
+
+  if (stats.msg_count != last_stats_seq_) {
+    set_has_message_come(true);
+    frame_ratio_ = (stats.msg_count - last_stats_seq_) / interval.ToSecond();
+    last_stats_seq_ = stats.msg_count;
+  } else {
+    frame_ratio_ = 0.0;
+  }
+  time_last_calc_ = time_now;
+  return frame_ratio_;
+}
+
 GeneralChannelMessage* GeneralChannelMessage::OpenChannel(
     const std::string& channelName) {
   if (channelName.empty() || node_name_.empty()) {
@@ -118,6 +164,7 @@ GeneralChannelMessage* GeneralChannelMessage::OpenChannel(
   if (channel_node_ == nullptr) {
     return castErrorCode2Ptr(ErrorCode::CreateNodeFailed);
   }
+  channel_name_ = channelName;
 
   auto callBack =
       [this](
@@ -156,7 +203,7 @@ void GeneralChannelMessage::Render(const Screen* s, int key) {
 
   s->SetCurrentColor(Screen::WHITE_BLACK);
   s->AddStr(0, lineNo++, "ChannelName: ");
-  s->AddStr(channel_reader_->GetChannelName().c_str());
+  s->AddStr(GetChannelName().c_str());
 
   s->AddStr(0, lineNo++, "MessageType: ");
   s->AddStr(message_type().c_str());
@@ -20,6 +20,7 @@
 #include <atomic>
 
 #include "cyber/message/raw_message.h"
+#include "cyber/transport/shm/segment.h"
 #include "general_message_base.h"
 
 class CyberTopologyMessage;
@@ -59,7 +60,15 @@ class GeneralChannelMessage : public GeneralMessageBase {
   }
 
   std::string GetChannelName(void) const {
-    return channel_reader_->GetChannelName();
+    if (channel_reader_ != nullptr) {
+      return channel_reader_->GetChannelName();
+    }
+    return channel_name_;
+  }
+
+  void set_channel_attr(const std::string& channelName, uint64_t channelId) {
+    channel_name_ = channelName;
+    channel_id_ = channelId;
   }
 
   void set_message_type(const std::string& msgTypeName) {
@@ -159,6 +168,10 @@ class GeneralChannelMessage : public GeneralMessageBase {
 
   GeneralChannelMessage* OpenChannel(const std::string& channelName);
 
+  // frame ratio derived from the transport's shared-memory counters,
+  // used when no reader is open on this channel
+  double stats_frame_ratio(void);
+
   void RenderDebugString(const Screen* s, int key, unsigned lineNo);
   void RenderInfo(const Screen* s, int key, unsigned lineNo);
 
@@ -187,6 +200,12 @@ class GeneralChannelMessage : public GeneralMessageBase {
 
   google::protobuf::Message* raw_msg_class_;
 
+  std::string channel_name_;
+  uint64_t channel_id_ = 0;
+  apollo::cyber::transport::SegmentPtr stats_segment_;
+  uint32_t last_stats_seq_ = 0;
+  bool stats_primed_ = false;
+
   friend class CyberTopologyMessage;
   friend class GeneralMessage;
 };  // GeneralChannelMessage
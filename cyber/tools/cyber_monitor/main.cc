@@ -33,6 +33,8 @@ void printHelp(const char *cmdName) {
             << cmdName << "  [option]\nOption:\n"
             << "   -h print help info\n"
             << "   -c specify one channel\n"
+            << "   -s stats-only mode: render rates from transport counters\n"
+            << "      and only subscribe to a channel when it is opened\n"
             << "Interactive Command:\n"
             << Screen::InteractiveCmdStr << std::endl;
 }
@@ -44,10 +46,12 @@ enum COMMAND {
   CHANNEL     // 3 -> 4
 };
 
-COMMAND parseOption(int argc, char *const argv[], std::string &commandVal) {
-  if (argc > 4) {
+COMMAND parseOption(int argc, char *const argv[], std::string &commandVal,
+                    bool &statsOnly) {
+  if (argc > 5) {
     return TOO_MANY_PARAMETER;
   }
+  COMMAND ret = NO_OPTION;
   int index = 1;
   while (true) {
     const char *opt = argv[index];
@@ -57,25 +61,30 @@ COMMAND parseOption(int argc, char *const argv[], std::string &commandVal) {
     if (strcmp(opt, "-h") == 0) {
       return HELP;
     }
+    if (strcmp(opt, "-s") == 0) {
+      statsOnly = true;
+    }
     if (strcmp(opt, "-c") == 0) {
       if (argv[index + 1]) {
         commandVal = argv[index + 1];
-        return CHANNEL;
+        ret = CHANNEL;
+        ++index;
       }
     }
 
     ++index;
   }
 
-  return NO_OPTION;
+  return ret;
 }
 
 }  // namespace
 
 int main(int argc, char *argv[]) {
   std::string val;
+  bool statsOnly = false;
 
-  COMMAND com = parseOption(argc, argv, val);
+  COMMAND com = parseOption(argc, argv, val, statsOnly);
 
   switch (com) {
     case TOO_MANY_PARAMETER:
@@ -91,7 +100,7 @@ int main(int argc, char *argv[]) {
   FLAGS_alsologtostderr = 0;
   FLAGS_colorlogtostderr = 0;
 
-  CyberTopologyMessage topologyMsg(val);
+  CyberTopologyMessage topologyMsg(val, statsOnly);
 
   auto topologyCallback =
       [&topologyMsg](const apollo::cyber::proto::ChangeMsg &change_msg) {
@@ -26,16 +26,32 @@ using apollo::cyber::proto::SectionType;
 Spliter::Spliter(const std::string& input_file, const std::string& output_file,
                  const std::vector<std::string>& white_channels,
                  const std::vector<std::string>& black_channels,
-                 uint64_t begin_time, uint64_t end_time)
+                 uint64_t begin_time, uint64_t end_time, uint32_t jobs)
     : input_file_(input_file),
       output_file_(output_file),
       white_channels_(white_channels),
       black_channels_(black_channels),
       begin_time_(begin_time),
-      end_time_(end_time) {}
+      end_time_(end_time),
+      jobs_(std::max<uint32_t>(jobs, 1)),
+      tasks_done_(false),
+      next_write_seq_(0),
+      total_items_(0),
+      reader_done_(false),
+      failed_(false) {}
 
 Spliter::~Spliter() {}
 
+bool Spliter::KeepChannel(const std::string& channel_name) const {
+  if (!white_channels_.empty() &&
+      std::find(white_channels_.begin(), white_channels_.end(),
+                channel_name) == white_channels_.end()) {
+    return false;
+  }
+  return std::find(black_channels_.begin(), black_channels_.end(),
+                   channel_name) == black_channels_.end();
+}
+
 bool Spliter::Proc() {
   // check params
   if (begin_time_ >= end_time_) {
@@ -52,7 +68,7 @@ bool Spliter::Proc() {
     }
   }
 
-  AINFO << "split record file started.";
+  AINFO << "split record file started, jobs: " << jobs_;
 
   // open input file
   if (!reader_.Open(input_file_)) {
@@ -77,40 +93,51 @@ bool Spliter::Proc() {
     return false;
   }
 
-  // read through record file
-  bool skip_next_chunk_body(false);
+  // pipeline: this thread reads sections in order, the workers parse and
+  // filter chunk bodies, the writer thread restores the read order
+  std::vector<std::thread> workers;
+  workers.reserve(jobs_);
+  for (uint32_t i = 0; i < jobs_; ++i) {
+    workers.emplace_back(&Spliter::TransformWorker, this);
+  }
+  std::thread write_thread(&Spliter::WriteInOrder, this);
+
+  uint64_t seq = 0;
+  bool skip_next_chunk_body = false;
   reader_.Reset();
-  while (!reader_.EndOfFile()) {
+  while (!reader_.EndOfFile() && !failed_.load()) {
     Section section;
     if (!reader_.ReadSection(&section)) {
-      AERROR << "read section failed.";
-      return false;
+      if (!reader_.EndOfFile()) {
+        AERROR << "read section failed.";
+        Fail();
+      }
+      break;
     }
     if (section.type == SectionType::SECTION_INDEX) {
       break;
     }
     switch (section.type) {
       case SectionType::SECTION_CHANNEL: {
-        Channel chan;
-        if (!reader_.ReadSection<Channel>(section.size, &chan)) {
+        PipelineItem item;
+        item.is_channel = true;
+        if (!reader_.ReadSection<Channel>(section.size, &item.channel)) {
           AERROR << "read channel section fail.";
-          return false;
+          Fail();
+          break;
         }
-        if (white_channels_.empty() ||
-            std::find(white_channels_.begin(), white_channels_.end(),
-                      chan.name()) != white_channels_.end()) {
-          if (std::find(black_channels_.begin(), black_channels_.end(),
-                        chan.name()) == black_channels_.end()) {
-            writer_.WriteChannel(chan);
-          }
+        if (!KeepChannel(item.channel.name())) {
+          break;
         }
+        PushResult(seq++, std::move(item));
         break;
       }
       case SectionType::SECTION_CHUNK_HEADER: {
         ChunkHeader chdr;
         if (!reader_.ReadSection<ChunkHeader>(section.size, &chdr)) {
           AERROR << "read chunk header section fail.";
-          return false;
+          Fail();
+          break;
         }
         if (begin_time_ > chdr.end_time() || end_time_ < chdr.begin_time()) {
           skip_next_chunk_body = true;
@@ -123,32 +150,21 @@ bool Spliter::Proc() {
           skip_next_chunk_body = false;
           break;
         }
-        ChunkBody cbd;
-        if (!reader_.ReadSection<ChunkBody>(section.size, &cbd)) {
+        std::string raw;
+        if (!reader_.ReadRawSection(section.size, &raw)) {
           AERROR << "read chunk body section fail.";
-          return false;
+          Fail();
+          break;
         }
-        for (int idx = 0; idx < cbd.messages_size(); ++idx) {
-          if (!white_channels_.empty() &&
-              std::find(white_channels_.begin(), white_channels_.end(),
-                        cbd.messages(idx).channel_name()) ==
-                  white_channels_.end()) {
-            continue;
-          }
-          if (std::find(black_channels_.begin(), black_channels_.end(),
-                        cbd.messages(idx).channel_name()) !=
-              black_channels_.end()) {
-            continue;
-          }
-          if (cbd.messages(idx).time() < begin_time_ ||
-              cbd.messages(idx).time() > end_time_) {
-            continue;
-          }
-          if (!writer_.WriteMessage(cbd.messages(idx))) {
-            AERROR << "add new message failed.";
-            return false;
-          }
+        std::unique_lock<std::mutex> lck(task_mutex_);
+        task_cv_.wait(lck, [this]() {
+          return task_queue_.size() < jobs_ * 2 || failed_.load();
+        });
+        if (failed_.load()) {
+          break;
         }
+        task_queue_.emplace_back(seq++, std::move(raw));
+        task_cv_.notify_one();
         break;
       }
       default: {
@@ -158,10 +174,120 @@ bool Spliter::Proc() {
       }
     }  // end for switch
   }    // end for while
+
+  {
+    std::lock_guard<std::mutex> lck(task_mutex_);
+    tasks_done_ = true;
+  }
+  task_cv_.notify_all();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  {
+    std::lock_guard<std::mutex> lck(result_mutex_);
+    reader_done_ = true;
+    total_items_ = seq;
+  }
+  result_cv_.notify_all();
+  write_thread.join();
+
+  if (failed_.load()) {
+    AERROR << "split record file failed.";
+    return false;
+  }
   AINFO << "split record file done.";
   return true;
 }  // end for Proc()
 
+void Spliter::TransformWorker() {
+  while (true) {
+    std::pair<uint64_t, std::string> task;
+    {
+      std::unique_lock<std::mutex> lck(task_mutex_);
+      task_cv_.wait(lck, [this]() {
+        return !task_queue_.empty() || tasks_done_ || failed_.load();
+      });
+      if (failed_.load() || (task_queue_.empty() && tasks_done_)) {
+        return;
+      }
+      task = std::move(task_queue_.front());
+      task_queue_.pop_front();
+    }
+    // wake the reader in case it was blocked on backpressure
+    task_cv_.notify_all();
+
+    ChunkBody cbd;
+    if (!cbd.ParseFromString(task.second)) {
+      AERROR << "parse chunk body section fail.";
+      Fail();
+      return;
+    }
+    PipelineItem item;
+    for (int idx = 0; idx < cbd.messages_size(); ++idx) {
+      if (!KeepChannel(cbd.messages(idx).channel_name())) {
+        continue;
+      }
+      if (cbd.messages(idx).time() < begin_time_ ||
+          cbd.messages(idx).time() > end_time_) {
+        continue;
+      }
+      *item.chunk.add_messages() = cbd.messages(idx);
+    }
+    PushResult(task.first, std::move(item));
+  }
+}
+
+void Spliter::PushResult(uint64_t seq, PipelineItem&& item) {
+  {
+    std::lock_guard<std::mutex> lck(result_mutex_);
+    results_[seq] = std::move(item);
+  }
+  result_cv_.notify_all();
+}
+
+void Spliter::WriteInOrder() {
+  while (true) {
+    PipelineItem item;
+    {
+      std::unique_lock<std::mutex> lck(result_mutex_);
+      result_cv_.wait(lck, [this]() {
+        return results_.count(next_write_seq_) > 0 ||
+               (reader_done_ && next_write_seq_ >= total_items_) ||
+               failed_.load();
+      });
+      if (failed_.load() ||
+          (reader_done_ && next_write_seq_ >= total_items_ &&
+           results_.count(next_write_seq_) == 0)) {
+        return;
+      }
+      item = std::move(results_[next_write_seq_]);
+      results_.erase(next_write_seq_);
+      ++next_write_seq_;
+    }
+    if (item.is_channel) {
+      if (!writer_.WriteChannel(item.channel)) {
+        AERROR << "write channel failed.";
+        Fail();
+        return;
+      }
+      continue;
+    }
+    for (int idx = 0; idx < item.chunk.messages_size(); ++idx) {
+      if (!writer_.WriteMessage(item.chunk.messages(idx))) {
+        AERROR << "add new message failed.";
+        Fail();
+        return;
+      }
+    }
+  }
+}
+
+void Spliter::Fail() {
+  failed_.store(true);
+  task_cv_.notify_all();
+  result_cv_.notify_all();
+}
+
 }  // namespace record
 }  // namespace cyber
 }  // namespace apollo
@@ -18,8 +18,15 @@
 #define CYBER_TOOLS_CYBER_RECORDER_SPLITER_H_
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "cyber/common/log.h"
@@ -42,11 +49,26 @@ class Spliter {
   Spliter(const std::string& input_file, const std::string& output_file,
           const std::vector<std::string>& white_channels,
           const std::vector<std::string>& black_channels,
-          uint64_t begin_time = 0, uint64_t end_time = UINT64_MAX);
+          uint64_t begin_time = 0, uint64_t end_time = UINT64_MAX,
+          uint32_t jobs = 1);
   virtual ~Spliter();
   bool Proc();
 
  private:
+  // one section flowing through the pipeline, keyed by read order so the
+  // writer can restore the sequence the reader saw
+  struct PipelineItem {
+    bool is_channel = false;
+    proto::Channel channel;
+    ChunkBody chunk;
+  };
+
+  bool KeepChannel(const std::string& channel_name) const;
+  void TransformWorker();
+  void WriteInOrder();
+  void PushResult(uint64_t seq, PipelineItem&& item);
+  void Fail();
+
   RecordFileReader reader_;
   RecordFileWriter writer_;
   std::string input_file_;
@@ -56,6 +78,23 @@ class Spliter {
   bool all_channels_;
   uint64_t begin_time_;
   uint64_t end_time_;
+  uint32_t jobs_;
+
+  // reader -> transform workers, raw chunk bodies tagged with sequence
+  std::mutex task_mutex_;
+  std::condition_variable task_cv_;
+  std::deque<std::pair<uint64_t, std::string>> task_queue_;
+  bool tasks_done_;
+
+  // transform workers -> ordered writer
+  std::mutex result_mutex_;
+  std::condition_variable result_cv_;
+  std::map<uint64_t, PipelineItem> results_;
+  uint64_t next_write_seq_;
+  uint64_t total_items_;
+  bool reader_done_;
+
+  std::atomic<bool> failed_;
 };
 
 }  // namespace record
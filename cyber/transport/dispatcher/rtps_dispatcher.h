@@ -25,6 +25,7 @@
 
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
+#include "cyber/message/arena_pool.h"
 #include "cyber/message/message_traits.h"
 #include "cyber/transport/dispatcher/dispatcher.h"
 #include "cyber/transport/rtps/attributes_filler.h"
@@ -81,9 +82,17 @@ class RtpsDispatcher : public Dispatcher {
 template <typename MessageT>
 void RtpsDispatcher::AddListener(const RoleAttributes& self_attr,
                                  const MessageListener<MessageT>& listener) {
-  auto listener_adapter = [listener](
+  auto pool = message::ArenaPool::Get(self_attr.channel_id());
+  auto listener_adapter = [listener, pool](
                               const std::shared_ptr<std::string>& msg_str,
                               const MessageInfo& msg_info) {
+    if (pool != nullptr) {
+      auto msg = message::ArenaParseFromArray<MessageT>(
+          pool, msg_str->data(), static_cast<int>(msg_str->size()));
+      RETURN_IF(msg == nullptr);
+      listener(msg, msg_info);
+      return;
+    }
     auto msg = std::make_shared<MessageT>();
     RETURN_IF(!message::ParseFromString(*msg_str, msg.get()));
     listener(msg, msg_info);
@@ -97,9 +106,17 @@ template <typename MessageT>
 void RtpsDispatcher::AddListener(const RoleAttributes& self_attr,
                                  const RoleAttributes& opposite_attr,
                                  const MessageListener<MessageT>& listener) {
-  auto listener_adapter = [listener](
+  auto pool = message::ArenaPool::Get(self_attr.channel_id());
+  auto listener_adapter = [listener, pool](
                               const std::shared_ptr<std::string>& msg_str,
                               const MessageInfo& msg_info) {
+    if (pool != nullptr) {
+      auto msg = message::ArenaParseFromArray<MessageT>(
+          pool, msg_str->data(), static_cast<int>(msg_str->size()));
+      RETURN_IF(msg == nullptr);
+      listener(msg, msg_info);
+      return;
+    }
     auto msg = std::make_shared<MessageT>();
     RETURN_IF(!message::ParseFromString(*msg_str, msg.get()));
     listener(msg, msg_info);
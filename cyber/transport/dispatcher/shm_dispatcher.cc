@@ -48,6 +48,12 @@ void ShmDispatcher::Shutdown() {
 void ShmDispatcher::AddSegment(const RoleAttributes& self_attr) {
   uint64_t channel_id = self_attr.channel_id();
   WriteLockGuard<AtomicRWLock> lock(segments_lock_);
+  if (self_attr.has_qos_profile() &&
+      QosProfileConf::IsLatencyCritical(self_attr.qos_profile())) {
+    latency_critical_channels_.insert(channel_id);
+    AINFO << "channel: " << GlobalData::GetChannelById(channel_id)
+          << " joins the latency-critical lane.";
+  }
   if (segments_.count(channel_id) > 0) {
     return;
   }
@@ -100,47 +106,73 @@ void ShmDispatcher::OnMessage(uint64_t channel_id,
 }
 
 void ShmDispatcher::ThreadFunc() {
-  ReadableInfo readable_info;
+  ReadableInfo readable_infos[kListenBatchSize];
+  bool latency_critical[kListenBatchSize];
   while (!is_shutdown_.load()) {
-    if (!notifier_->Listen(100, &readable_info)) {
+    uint32_t count = 0;
+    if (!notifier_->ListenBatch(100, readable_infos, kListenBatchSize,
+                                &count)) {
       ADEBUG << "listen failed.";
       continue;
     }
 
-    if (readable_info.host_id() != host_id_) {
-      ADEBUG << "shm readable info from other host.";
-      continue;
-    }
-
-    uint64_t channel_id = readable_info.channel_id();
-    uint32_t block_index = readable_info.block_index();
-
+    // Latency-critical channels go first, so a burst of bulk messages
+    // earlier in the batch cannot delay them within this sweep.
     {
       ReadLockGuard<AtomicRWLock> lock(segments_lock_);
-      if (segments_.count(channel_id) == 0) {
-        continue;
+      for (uint32_t i = 0; i < count; ++i) {
+        latency_critical[i] =
+            latency_critical_channels_.count(readable_infos[i].channel_id()) >
+            0;
       }
-      // check block index
-      if (previous_indexes_.count(channel_id) == 0) {
-        previous_indexes_[channel_id] = UINT32_MAX;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+      if (latency_critical[i]) {
+        HandleReadableInfo(readable_infos[i]);
       }
-      uint32_t& previous_index = previous_indexes_[channel_id];
-      if (block_index != 0 && previous_index != UINT32_MAX) {
-        if (block_index == previous_index) {
-          ADEBUG << "Receive SAME index " << block_index << " of channel "
-                 << channel_id;
-        } else if (block_index < previous_index) {
-          ADEBUG << "Receive PREVIOUS message. last: " << previous_index
-                 << ", now: " << block_index;
-        } else if (block_index - previous_index > 1) {
-          ADEBUG << "Receive JUMP message. last: " << previous_index
-                 << ", now: " << block_index;
-        }
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+      if (!latency_critical[i]) {
+        HandleReadableInfo(readable_infos[i]);
       }
-      previous_index = block_index;
+    }
+  }
+}
 
-      ReadMessage(channel_id, block_index);
+void ShmDispatcher::HandleReadableInfo(const ReadableInfo& readable_info) {
+  if (readable_info.host_id() != host_id_) {
+    ADEBUG << "shm readable info from other host.";
+    return;
+  }
+
+  uint64_t channel_id = readable_info.channel_id();
+  uint32_t block_index = readable_info.block_index();
+
+  {
+    ReadLockGuard<AtomicRWLock> lock(segments_lock_);
+    if (segments_.count(channel_id) == 0) {
+      return;
+    }
+    // check block index
+    if (previous_indexes_.count(channel_id) == 0) {
+      previous_indexes_[channel_id] = UINT32_MAX;
     }
+    uint32_t& previous_index = previous_indexes_[channel_id];
+    if (block_index != 0 && previous_index != UINT32_MAX) {
+      if (block_index == previous_index) {
+        ADEBUG << "Receive SAME index " << block_index << " of channel "
+               << channel_id;
+      } else if (block_index < previous_index) {
+        ADEBUG << "Receive PREVIOUS message. last: " << previous_index
+               << ", now: " << block_index;
+      } else if (block_index - previous_index > 1) {
+        ADEBUG << "Receive JUMP message. last: " << previous_index
+               << ", now: " << block_index;
+      }
+    }
+    previous_index = block_index;
+
+    ReadMessage(channel_id, block_index);
   }
 }
 
@@ -22,13 +22,16 @@
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "cyber/base/atomic_rw_lock.h"
 #include "cyber/common/global_data.h"
 #include "cyber/common/log.h"
 #include "cyber/common/macros.h"
+#include "cyber/message/arena_pool.h"
 #include "cyber/message/message_traits.h"
 #include "cyber/transport/dispatcher/dispatcher.h"
+#include "cyber/transport/qos/qos_profile_conf.h"
 #include "cyber/transport/shm/notifier_factory.h"
 #include "cyber/transport/shm/segment_factory.h"
 
@@ -61,16 +64,23 @@ class ShmDispatcher : public Dispatcher {
                    const MessageListener<MessageT>& listener);
 
  private:
+  // max entries consumed from the notifier per wakeup
+  static const uint32_t kListenBatchSize = 32;
+
   void AddSegment(const RoleAttributes& self_attr);
   void ReadMessage(uint64_t channel_id, uint32_t block_index);
   void OnMessage(uint64_t channel_id, const std::shared_ptr<ReadableBlock>& rb,
                  const MessageInfo& msg_info);
+  void HandleReadableInfo(const ReadableInfo& readable_info);
   void ThreadFunc();
   bool Init();
 
   uint64_t host_id_;
   SegmentContainer segments_;
   std::unordered_map<uint64_t, uint32_t> previous_indexes_;
+  // channels with a latency-critical qos profile, handled ahead of bulk
+  // channels in every dispatch sweep; guarded by segments_lock_
+  std::unordered_set<uint64_t> latency_critical_channels_;
   AtomicRWLock segments_lock_;
   std::thread thread_;
   NotifierPtr notifier_;
@@ -82,8 +92,17 @@ template <typename MessageT>
 void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
                                 const MessageListener<MessageT>& listener) {
   // FIXME: make it more clean
-  auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb,
-                                     const MessageInfo& msg_info) {
+  auto pool = message::ArenaPool::Get(self_attr.channel_id());
+  auto listener_adapter = [listener, pool](
+                              const std::shared_ptr<ReadableBlock>& rb,
+                              const MessageInfo& msg_info) {
+    if (pool != nullptr) {
+      auto msg = message::ArenaParseFromArray<MessageT>(
+          pool, rb->buf, static_cast<int>(rb->block->msg_size()));
+      RETURN_IF(msg == nullptr);
+      listener(msg, msg_info);
+      return;
+    }
     auto msg = std::make_shared<MessageT>();
     RETURN_IF(!message::ParseFromArray(
         rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
@@ -99,8 +118,17 @@ void ShmDispatcher::AddListener(const RoleAttributes& self_attr,
                                 const RoleAttributes& opposite_attr,
                                 const MessageListener<MessageT>& listener) {
   // FIXME: make it more clean
-  auto listener_adapter = [listener](const std::shared_ptr<ReadableBlock>& rb,
-                                     const MessageInfo& msg_info) {
+  auto pool = message::ArenaPool::Get(self_attr.channel_id());
+  auto listener_adapter = [listener, pool](
+                              const std::shared_ptr<ReadableBlock>& rb,
+                              const MessageInfo& msg_info) {
+    if (pool != nullptr) {
+      auto msg = message::ArenaParseFromArray<MessageT>(
+          pool, rb->buf, static_cast<int>(rb->block->msg_size()));
+      RETURN_IF(msg == nullptr);
+      listener(msg, msg_info);
+      return;
+    }
     auto msg = std::make_shared<MessageT>();
     RETURN_IF(!message::ParseFromArray(
         rb->buf, static_cast<int>(rb->block->msg_size()), msg.get()));
@@ -54,6 +54,25 @@ TEST(ShmDispatcherTest, add_listener) {
       [](const std::shared_ptr<proto::Chatter>&, const MessageInfo&) {});
 }
 
+TEST(ShmDispatcherTest, add_latency_critical_listener) {
+  auto dispatcher = ShmDispatcher::Instance();
+  RoleAttributes self_attr;
+  self_attr.set_channel_name("latency_critical");
+  self_attr.set_channel_id(common::Hash("latency_critical"));
+  self_attr.mutable_qos_profile()->CopyFrom(
+      QosProfileConf::QOS_PROFILE_LATENCY_CRITICAL);
+  Identity self_id;
+  self_attr.set_id(self_id.HashValue());
+
+  EXPECT_TRUE(QosProfileConf::IsLatencyCritical(self_attr.qos_profile()));
+  EXPECT_FALSE(
+      QosProfileConf::IsLatencyCritical(QosProfileConf::QOS_PROFILE_DEFAULT));
+
+  dispatcher->AddListener<proto::Chatter>(
+      self_attr,
+      [](const std::shared_ptr<proto::Chatter>&, const MessageInfo&) {});
+}
+
 TEST(ShmDispatcherTest, on_message) {
   auto dispatcher = ShmDispatcher::Instance();
 
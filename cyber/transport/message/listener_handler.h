@@ -21,9 +21,10 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "cyber/base/atomic_rw_lock.h"
-#include "cyber/base/signal.h"
 #include "cyber/common/log.h"
 #include "cyber/message/message_traits.h"
 #include "cyber/message/raw_message.h"
@@ -55,16 +56,16 @@ class ListenerHandlerBase {
   bool is_raw_message_ = false;
 };
 
+// Fans one channel's messages out to its listeners. The listener set is
+// kept as an immutable flat table that is rebuilt and atomically swapped
+// on every (dis)connect, so the per-message Run() path is a lock-free
+// linear walk over contiguous callbacks. (Un)subscribing is rare; a full
+// rebuild there is cheap compared to taking locks on every message.
 template <typename MessageT>
 class ListenerHandler : public ListenerHandlerBase {
  public:
   using Message = std::shared_ptr<MessageT>;
-  using MessageSignal = base::Signal<const Message&, const MessageInfo&>;
-
   using Listener = std::function<void(const Message&, const MessageInfo&)>;
-  using MessageConnection =
-      base::Connection<const Message&, const MessageInfo&>;
-  using ConnectionMap = std::unordered_map<uint64_t, MessageConnection>;
 
   ListenerHandler() {}
   virtual ~ListenerHandler() {}
@@ -80,18 +81,32 @@ class ListenerHandler : public ListenerHandlerBase {
                      const MessageInfo& msg_info) override;
 
  private:
-  using SignalPtr = std::shared_ptr<MessageSignal>;
-  using MessageSignalMap = std::unordered_map<uint64_t, SignalPtr>;
-  // used for self_id
-  MessageSignal signal_;
-  ConnectionMap signal_conns_;  // key: self_id
-
-  // used for self_id and oppo_id
-  MessageSignalMap signals_;  // key: oppo_id
-  // key: oppo_id
-  std::unordered_map<uint64_t, ConnectionMap> signals_conns_;
-
+  // Listeners registered for one specific opposite (sender) id.
+  struct OppoFanout {
+    uint64_t oppo_id = 0;
+    std::vector<Listener> listeners;
+  };
+  struct FanoutTable {
+    // listeners receiving from any sender
+    std::vector<Listener> listeners;
+    // listeners keyed by sender id
+    std::vector<OppoFanout> oppo_fanouts;
+  };
+  using FanoutTablePtr = std::shared_ptr<const FanoutTable>;
+
+  // Rebuilds the flat table from the registration maps and publishes it.
+  // Callers must hold rw_lock_ for writing.
+  void RebuildTable();
+
+  // registration bookkeeping, mutated under rw_lock_
+  std::unordered_map<uint64_t, Listener> listeners_;  // key: self_id
+  // key: oppo_id -> self_id
+  std::unordered_map<uint64_t, std::unordered_map<uint64_t, Listener>>
+      oppo_listeners_;
   base::AtomicRWLock rw_lock_;
+
+  // immutable snapshot read by Run() without locks
+  FanoutTablePtr table_;
 };
 
 template <>
@@ -100,75 +115,89 @@ inline ListenerHandler<message::RawMessage>::ListenerHandler() {
 }
 
 template <typename MessageT>
-void ListenerHandler<MessageT>::Connect(uint64_t self_id,
-                                        const Listener& listener) {
-  auto connection = signal_.Connect(listener);
-  if (!connection.IsConnected()) {
-    return;
+void ListenerHandler<MessageT>::RebuildTable() {
+  auto table = std::make_shared<FanoutTable>();
+  table->listeners.reserve(listeners_.size());
+  for (const auto& item : listeners_) {
+    table->listeners.push_back(item.second);
+  }
+  table->oppo_fanouts.reserve(oppo_listeners_.size());
+  for (const auto& item : oppo_listeners_) {
+    OppoFanout fanout;
+    fanout.oppo_id = item.first;
+    fanout.listeners.reserve(item.second.size());
+    for (const auto& listener : item.second) {
+      fanout.listeners.push_back(listener.second);
+    }
+    table->oppo_fanouts.push_back(std::move(fanout));
   }
+  std::atomic_store_explicit(&table_, FanoutTablePtr(std::move(table)),
+                             std::memory_order_release);
+}
 
+template <typename MessageT>
+void ListenerHandler<MessageT>::Connect(uint64_t self_id,
+                                        const Listener& listener) {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  signal_conns_[self_id] = connection;
+  listeners_[self_id] = listener;
+  RebuildTable();
 }
 
 template <typename MessageT>
 void ListenerHandler<MessageT>::Connect(uint64_t self_id, uint64_t oppo_id,
                                         const Listener& listener) {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  if (signals_.find(oppo_id) == signals_.end()) {
-    signals_[oppo_id] = std::make_shared<MessageSignal>();
-  }
-
-  auto connection = signals_[oppo_id]->Connect(listener);
-  if (!connection.IsConnected()) {
-    AWARN << oppo_id << " " << self_id << " connect failed!";
-    return;
-  }
-
-  if (signals_conns_.find(oppo_id) == signals_conns_.end()) {
-    signals_conns_[oppo_id] = ConnectionMap();
-  }
-
-  signals_conns_[oppo_id][self_id] = connection;
+  oppo_listeners_[oppo_id][self_id] = listener;
+  RebuildTable();
 }
 
 template <typename MessageT>
 void ListenerHandler<MessageT>::Disconnect(uint64_t self_id) {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  if (signal_conns_.find(self_id) == signal_conns_.end()) {
+  if (listeners_.erase(self_id) == 0) {
     return;
   }
-
-  signal_conns_[self_id].Disconnect();
-  signal_conns_.erase(self_id);
+  RebuildTable();
 }
 
 template <typename MessageT>
 void ListenerHandler<MessageT>::Disconnect(uint64_t self_id, uint64_t oppo_id) {
   WriteLockGuard<AtomicRWLock> lock(rw_lock_);
-  if (signals_conns_.find(oppo_id) == signals_conns_.end()) {
+  auto oppo = oppo_listeners_.find(oppo_id);
+  if (oppo == oppo_listeners_.end()) {
     return;
   }
-
-  if (signals_conns_[oppo_id].find(self_id) == signals_conns_[oppo_id].end()) {
+  if (oppo->second.erase(self_id) == 0) {
     return;
   }
-
-  signals_conns_[oppo_id][self_id].Disconnect();
-  signals_conns_[oppo_id].erase(self_id);
+  if (oppo->second.empty()) {
+    oppo_listeners_.erase(oppo);
+  }
+  RebuildTable();
 }
 
 template <typename MessageT>
 void ListenerHandler<MessageT>::Run(const Message& msg,
                                     const MessageInfo& msg_info) {
-  signal_(msg, msg_info);
-  uint64_t oppo_id = msg_info.sender_id().HashValue();
-  ReadLockGuard<AtomicRWLock> lock(rw_lock_);
-  if (signals_.find(oppo_id) == signals_.end()) {
+  auto table = std::atomic_load_explicit(&table_, std::memory_order_acquire);
+  if (table == nullptr) {
     return;
   }
-
-  (*signals_[oppo_id])(msg, msg_info);
+  for (const auto& listener : table->listeners) {
+    listener(msg, msg_info);
+  }
+  if (table->oppo_fanouts.empty()) {
+    return;
+  }
+  uint64_t oppo_id = msg_info.sender_id().HashValue();
+  for (const auto& fanout : table->oppo_fanouts) {
+    if (fanout.oppo_id == oppo_id) {
+      for (const auto& listener : fanout.listeners) {
+        listener(msg, msg_info);
+      }
+      break;
+    }
+  }
 }
 
 template <typename MessageT>
@@ -38,14 +38,25 @@ QosProfile QosProfileConf::CreateQosProfile(
   return qos_profile;
 }
 
+bool QosProfileConf::IsLatencyCritical(const QosProfile& qos_profile) {
+  return qos_profile.mps() == QOS_MPS_LATENCY_CRITICAL;
+}
+
 const uint32_t QosProfileConf::QOS_HISTORY_DEPTH_SYSTEM_DEFAULT = 0;
 const uint32_t QosProfileConf::QOS_MPS_SYSTEM_DEFAULT = 0;
+const uint32_t QosProfileConf::QOS_MPS_LATENCY_CRITICAL = UINT32_MAX;
 
 const QosProfile QosProfileConf::QOS_PROFILE_DEFAULT = CreateQosProfile(
     QosHistoryPolicy::HISTORY_KEEP_LAST, 1, QOS_MPS_SYSTEM_DEFAULT,
     QosReliabilityPolicy::RELIABILITY_RELIABLE,
     QosDurabilityPolicy::DURABILITY_VOLATILE);
 
+const QosProfile QosProfileConf::QOS_PROFILE_LATENCY_CRITICAL =
+    CreateQosProfile(QosHistoryPolicy::HISTORY_KEEP_LAST, 1,
+                     QOS_MPS_LATENCY_CRITICAL,
+                     QosReliabilityPolicy::RELIABILITY_RELIABLE,
+                     QosDurabilityPolicy::DURABILITY_VOLATILE);
+
 const QosProfile QosProfileConf::QOS_PROFILE_SENSOR_DATA = CreateQosProfile(
     QosHistoryPolicy::HISTORY_KEEP_LAST, 5, QOS_MPS_SYSTEM_DEFAULT,
     QosReliabilityPolicy::RELIABILITY_BEST_EFFORT,
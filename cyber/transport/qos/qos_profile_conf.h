@@ -40,10 +40,22 @@ class QosProfileConf {
                                      const QosReliabilityPolicy& reliability,
                                      const QosDurabilityPolicy& durability);
 
+  /**
+   * @brief Whether the profile marks its channel as latency-critical.
+   *
+   * Latency-critical channels are dispatched ahead of bulk channels, see
+   * ShmDispatcher. The mark is carried in the mps field, which is not
+   * used for rate control at runtime; QOS_MPS_LATENCY_CRITICAL is the
+   * reserved sentinel value.
+   */
+  static bool IsLatencyCritical(const QosProfile& qos_profile);
+
   static const uint32_t QOS_HISTORY_DEPTH_SYSTEM_DEFAULT;
   static const uint32_t QOS_MPS_SYSTEM_DEFAULT;
+  static const uint32_t QOS_MPS_LATENCY_CRITICAL;
 
   static const QosProfile QOS_PROFILE_DEFAULT;
+  static const QosProfile QOS_PROFILE_LATENCY_CRITICAL;
   static const QosProfile QOS_PROFILE_SENSOR_DATA;
   static const QosProfile QOS_PROFILE_PARAMETERS;
   static const QosProfile QOS_PROFILE_SERVICES_DEFAULT;
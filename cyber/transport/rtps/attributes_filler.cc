@@ -109,8 +109,11 @@ bool AttributesFiller::FillInPubAttr(
 
   pub_attr->qos.m_publishMode.kind =
       eprosima::fastrtps::ASYNCHRONOUS_PUBLISH_MODE;
+  // Payload buffers (and the fragments carved from them for large samples)
+  // are drawn from a preallocated pool that only grows when a bigger message
+  // arrives, so steady-state cross-host streams do not allocate per sample.
   pub_attr->historyMemoryPolicy =
-      eprosima::fastrtps::DYNAMIC_RESERVE_MEMORY_MODE;
+      eprosima::fastrtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
   pub_attr->topic.resourceLimitsQos.max_samples = 10000;
 
   return true;
@@ -172,8 +175,10 @@ bool AttributesFiller::FillInSubAttr(
     return false;
   }
 
+  // keep the receive side symmetric with the publisher: reassembly buffers
+  // are reused from the pool instead of being allocated per sample
   sub_attr->historyMemoryPolicy =
-      eprosima::fastrtps::DYNAMIC_RESERVE_MEMORY_MODE;
+      eprosima::fastrtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
   sub_attr->topic.resourceLimitsQos.max_samples = 10000;
 
   return true;
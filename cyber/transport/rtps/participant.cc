@@ -85,6 +85,11 @@ void Participant::CreateFastRtpsParticipant(
 
   eprosima::fastrtps::ParticipantAttributes attr;
   attr.rtps.defaultSendPort = send_port;
+  // The kernel defaults (typically a few hundred KB) overflow under
+  // host-to-host camera streams on a 10GbE link, and every overflow turns
+  // into a retransmission round trip. Size the UDP buffers for line rate.
+  attr.rtps.sendSocketBufferSize = 10 * 1024 * 1024;
+  attr.rtps.listenSocketBufferSize = 10 * 1024 * 1024;
   attr.rtps.port.domainIDGain =
       static_cast<uint16_t>(part_attr_conf->domain_id_gain());
   attr.rtps.port.portBase = static_cast<uint16_t>(part_attr_conf->port_base());
@@ -63,7 +63,9 @@ bool ConditionNotifier::Notify(const ReadableInfo& info) {
   uint64_t seq = indicator_->next_seq.fetch_add(1);
   uint64_t idx = seq % kBufLength;
   indicator_->infos[idx] = info;
-  indicator_->seqs[idx] = seq;
+  // Publish the slot only after the info is fully written, so that a
+  // listener never observes a half-written entry.
+  indicator_->seqs[idx].store(seq, std::memory_order_release);
 
   return true;
 }
@@ -79,22 +81,48 @@ bool ConditionNotifier::Listen(int timeout_ms, ReadableInfo* info) {
     return false;
   }
 
+  uint32_t count = 0;
+  if (!ListenBatch(timeout_ms, info, 1, &count)) {
+    return false;
+  }
+  return count == 1;
+}
+
+bool ConditionNotifier::ListenBatch(int timeout_ms, ReadableInfo* infos,
+                                    uint32_t capacity, uint32_t* count) {
+  if (infos == nullptr || count == nullptr || capacity == 0) {
+    AERROR << "invalid batch listen args.";
+    return false;
+  }
+
+  if (is_shutdown_.load()) {
+    ADEBUG << "notifier is shutdown.";
+    return false;
+  }
+
   int timeout_us = timeout_ms * 1000;
   while (!is_shutdown_.load()) {
-    uint64_t seq = indicator_->next_seq.load();
-    if (seq != next_seq_) {
+    uint32_t fetched = 0;
+    while (fetched < capacity &&
+           indicator_->next_seq.load(std::memory_order_acquire) != next_seq_) {
       auto idx = next_seq_ % kBufLength;
-      auto actual_seq = indicator_->seqs[idx];
+      auto actual_seq = indicator_->seqs[idx].load(std::memory_order_acquire);
       if (actual_seq >= next_seq_) {
         next_seq_ = actual_seq;
-        *info = indicator_->infos[idx];
+        infos[fetched] = indicator_->infos[idx];
+        ++fetched;
         ++next_seq_;
-        return true;
       } else {
         ADEBUG << "seq[" << next_seq_ << "] is writing, can not read now.";
+        break;
       }
     }
 
+    if (fetched > 0) {
+      *count = fetched;
+      return true;
+    }
+
     if (timeout_us > 0) {
       std::this_thread::sleep_for(std::chrono::microseconds(50));
       timeout_us -= 50;
@@ -145,6 +173,11 @@ bool ConditionNotifier::OpenOrCreate() {
 
   // create indicator_
   indicator_ = new (managed_shm_) Indicator();
+  if (indicator_ != nullptr) {
+    for (uint32_t i = 0; i < kBufLength; ++i) {
+      indicator_->seqs[i].store(0, std::memory_order_relaxed);
+    }
+  }
   if (indicator_ == nullptr) {
     AERROR << "create indicator failed.";
     shmdt(managed_shm_);
@@ -34,7 +34,10 @@ class ConditionNotifier : public NotifierBase {
   struct Indicator {
     std::atomic<uint64_t> next_seq = {0};
     ReadableInfo infos[kBufLength];
-    uint64_t seqs[kBufLength] = {0};
+    // Per-slot sequence words. A slot's seq is published with release
+    // semantics only after its info has been fully written, so readers
+    // that observe the seq with acquire semantics see a complete entry.
+    std::atomic<uint64_t> seqs[kBufLength];
   };
 
  public:
@@ -43,6 +46,8 @@ class ConditionNotifier : public NotifierBase {
   void Shutdown() override;
   bool Notify(const ReadableInfo& info) override;
   bool Listen(int timeout_ms, ReadableInfo* info) override;
+  bool ListenBatch(int timeout_ms, ReadableInfo* infos, uint32_t capacity,
+                   uint32_t* count) override;
 
   static const char* Type() { return "condition"; }
 
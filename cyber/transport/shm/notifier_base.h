@@ -35,6 +35,20 @@ class NotifierBase {
   virtual void Shutdown() = 0;
   virtual bool Notify(const ReadableInfo& info) = 0;
   virtual bool Listen(int timeout_ms, ReadableInfo* info) = 0;
+
+  // Drains up to capacity pending entries in one wakeup. Notifiers that
+  // have no batch support fall back to fetching a single entry.
+  virtual bool ListenBatch(int timeout_ms, ReadableInfo* infos,
+                           uint32_t capacity, uint32_t* count) {
+    if (infos == nullptr || count == nullptr || capacity == 0) {
+      return false;
+    }
+    if (!Listen(timeout_ms, infos)) {
+      return false;
+    }
+    *count = 1;
+    return true;
+  }
 };
 
 }  // namespace transport
@@ -20,6 +20,7 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 
+#include "cyber/base/macros.h"
 #include "cyber/common/log.h"
 #include "cyber/common/util.h"
 #include "cyber/transport/shm/block.h"
@@ -30,6 +31,26 @@ namespace apollo {
 namespace cyber {
 namespace transport {
 
+namespace {
+
+// POSIX shm lives on tmpfs, where MAP_HUGETLB does not apply; advising THP
+// is the best available and takes effect when /dev/shm is mounted with
+// huge=advise or huge=always. Each process maps the segment separately, so
+// the advice is per-attach.
+void AdviseHugePages(const std::string& name, void* addr, uint64_t size) {
+  if (!HugePagesEnabled()) {
+    return;
+  }
+  if (madvise(addr, size, MADV_HUGEPAGE) == 0) {
+    AINFO << "shm " << name << " (" << size
+          << " bytes): requested THP backing.";
+  } else {
+    AWARN << "shm " << name << ": THP advice failed: " << strerror(errno);
+  }
+}
+
+}  // namespace
+
 PosixSegment::PosixSegment(uint64_t channel_id) : Segment(channel_id) {
   shm_name_ = std::to_string(channel_id);
 }
@@ -70,6 +91,7 @@ bool PosixSegment::OpenOrCreate() {
   }
 
   close(fd);
+  AdviseHugePages(shm_name_, managed_shm_, conf_.managed_shm_size());
 
   // create field state_
   state_ = new (managed_shm_) State(conf_.ceiling_msg_size());
@@ -161,6 +183,8 @@ bool PosixSegment::OpenOnly() {
   }
 
   close(fd);
+  AdviseHugePages(shm_name_, managed_shm_, file_attr.st_size);
+
   // get field state_
   state_ = reinterpret_cast<State*>(managed_shm_);
   if (state_ == nullptr) {
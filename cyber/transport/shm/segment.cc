@@ -18,6 +18,7 @@
 
 #include "cyber/common/log.h"
 #include "cyber/common/util.h"
+#include "cyber/time/time.h"
 #include "cyber/transport/shm/shm_conf.h"
 
 namespace apollo {
@@ -74,6 +75,24 @@ void Segment::ReleaseWrittenBlock(const WritableBlock& writable_block) {
   blocks_[index].ReleaseWriteLock();
 }
 
+void Segment::RecordWrittenStats(std::size_t msg_size) {
+  if (!init_) {
+    return;
+  }
+  state_->RecordWrite(msg_size, Time::Now().ToNanosecond());
+}
+
+bool Segment::GetStats(ChannelStats* stats) {
+  RETURN_VAL_IF_NULL(stats, false);
+  if (!init_ && !OpenOnly()) {
+    return false;
+  }
+  stats->msg_count = state_->seq();
+  stats->written_bytes = state_->written_bytes();
+  stats->last_write_ns = state_->last_write_ns();
+  return true;
+}
+
 bool Segment::AcquireBlockToRead(ReadableBlock* readable_block) {
   RETURN_VAL_IF_NULL(readable_block, false);
   if (!init_ && !OpenOnly()) {
@@ -40,6 +40,14 @@ struct WritableBlock {
 };
 using ReadableBlock = WritableBlock;
 
+// Per-channel write statistics kept in the shared segment by the writer
+// side, readable without subscribing to the channel.
+struct ChannelStats {
+  uint32_t msg_count = 0;
+  uint64_t written_bytes = 0;
+  uint64_t last_write_ns = 0;
+};
+
 class Segment {
  public:
   explicit Segment(uint64_t channel_id);
@@ -51,6 +59,12 @@ class Segment {
   bool AcquireBlockToRead(ReadableBlock* readable_block);
   void ReleaseReadBlock(const ReadableBlock& readable_block);
 
+  // Records a successfully written message in the segment statistics.
+  void RecordWrittenStats(std::size_t msg_size);
+  // Reads the channel statistics, attaching to the segment read-only if
+  // necessary. Fails until a writer has created the segment.
+  bool GetStats(ChannelStats* stats);
+
  protected:
   virtual bool Destroy();
   virtual void Reset() = 0;
@@ -52,11 +52,28 @@ class State {
   uint64_t ceiling_msg_size() { return ceiling_msg_size_.load(); }
   uint32_t reference_counts() { return reference_count_.load(); }
 
+  // Lightweight per-channel write statistics, updated by the transmitter
+  // side and readable by any process attached to the segment. Together
+  // with seq() they let tools derive message rate, throughput and
+  // staleness without subscribing to the channel.
+  void RecordWrite(uint64_t bytes, uint64_t now_ns) {
+    written_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    last_write_ns_.store(now_ns, std::memory_order_relaxed);
+  }
+  uint64_t written_bytes() {
+    return written_bytes_.load(std::memory_order_relaxed);
+  }
+  uint64_t last_write_ns() {
+    return last_write_ns_.load(std::memory_order_relaxed);
+  }
+
  private:
   std::atomic<bool> need_remap_ = {false};
   std::atomic<uint32_t> seq_ = {0};
   std::atomic<uint32_t> reference_count_ = {0};
   std::atomic<uint64_t> ceiling_msg_size_;
+  std::atomic<uint64_t> written_bytes_ = {0};
+  std::atomic<uint64_t> last_write_ns_ = {0};
 };
 
 }  // namespace transport
@@ -20,11 +20,16 @@
 #include <sys/shm.h>
 #include <sys/types.h>
 
+#include "cyber/base/macros.h"
 #include "cyber/common/log.h"
 #include "cyber/common/util.h"
 #include "cyber/transport/shm/segment.h"
 #include "cyber/transport/shm/shm_conf.h"
 
+#ifndef SHM_HUGETLB
+#define SHM_HUGETLB 04000
+#endif
+
 namespace apollo {
 namespace cyber {
 namespace transport {
@@ -42,8 +47,26 @@ bool XsiSegment::OpenOrCreate() {
 
   // create managed_shm_
   int retry = 0;
-  int shmid = 0;
-  while (retry < 2) {
+  int shmid = -1;
+  if (HugePagesEnabled()) {
+    // 2MB-page backing keeps TLB misses down on large segments; it needs
+    // preallocated hugetlb pages (vm.nr_hugepages) and a size that is a
+    // multiple of the huge page size, so round up and fall back if denied
+    const uint64_t rounded =
+        (conf_.managed_shm_size() + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    shmid = shmget(key_, rounded, 0644 | IPC_CREAT | IPC_EXCL | SHM_HUGETLB);
+    if (shmid != -1) {
+      AINFO << "shm segment " << key_ << " (" << rounded
+            << " bytes) backed by 2MB huge pages.";
+    } else if (EEXIST == errno) {
+      ADEBUG << "shm already exist, open only.";
+      return OpenOnly();
+    } else {
+      AWARN << "huge page shm unavailable for segment " << key_ << ": "
+            << strerror(errno) << ", falling back to 4KB pages.";
+    }
+  }
+  while (retry < 2 && shmid == -1) {
     shmid = shmget(key_, conf_.managed_shm_size(), 0644 | IPC_CREAT | IPC_EXCL);
     if (shmid != -1) {
       break;
@@ -0,0 +1,145 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#ifndef CYBER_TRANSPORT_SHM_ZERO_COPY_VIEW_H_
+#define CYBER_TRANSPORT_SHM_ZERO_COPY_VIEW_H_
+
+#include <memory>
+#include <utility>
+
+#include <google/protobuf/arena.h>
+
+#include "cyber/common/log.h"
+#include "cyber/transport/shm/segment.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+// A const, reference-counted view of a message living in a shared-memory
+// block. The view pins the block with the shared read-lock word of Block
+// for its whole lifetime, so the transmitter cannot reuse the block while
+// any reader still holds a view. Readers that only need the serialized
+// bytes (e.g. record writing, bridging) can use data()/size() without any
+// copy or parse; readers that need a structured message parse lazily into
+// a caller-provided arena via ParseTo().
+class ZeroCopyView {
+ public:
+  ZeroCopyView() : segment_(nullptr), block_() {}
+
+  // Takes ownership of an already acquired readable block. The block's
+  // read lock is released when the view is destroyed or reset.
+  ZeroCopyView(const SegmentPtr& segment, const ReadableBlock& block)
+      : segment_(segment), block_(block) {}
+
+  ZeroCopyView(ZeroCopyView&& other)
+      : segment_(std::move(other.segment_)), block_(other.block_) {
+    other.segment_ = nullptr;
+  }
+
+  ZeroCopyView& operator=(ZeroCopyView&& other) {
+    if (this != &other) {
+      Release();
+      segment_ = std::move(other.segment_);
+      block_ = other.block_;
+      other.segment_ = nullptr;
+    }
+    return *this;
+  }
+
+  ZeroCopyView(const ZeroCopyView&) = delete;
+  ZeroCopyView& operator=(const ZeroCopyView&) = delete;
+
+  ~ZeroCopyView() { Release(); }
+
+  // Acquires a view of the given block index on segment. Returns an empty
+  // view if the block is currently write-locked.
+  static ZeroCopyView Acquire(const SegmentPtr& segment, uint32_t block_index) {
+    ReadableBlock rb;
+    rb.index = block_index;
+    if (segment == nullptr || !segment->AcquireBlockToRead(&rb)) {
+      return ZeroCopyView();
+    }
+    return ZeroCopyView(segment, rb);
+  }
+
+  bool IsValid() const { return segment_ != nullptr; }
+
+  const uint8_t* data() const { return block_.buf; }
+  uint64_t size() const {
+    return block_.block != nullptr ? block_.block->msg_size() : 0;
+  }
+
+  // Parses the pinned bytes into a message allocated on arena. The parse
+  // happens at most when the caller asks for it, not on every dispatch.
+  template <typename M>
+  M* ParseTo(google::protobuf::Arena* arena) const {
+    if (!IsValid()) {
+      return nullptr;
+    }
+    M* msg = google::protobuf::Arena::CreateMessage<M>(arena);
+    if (!msg->ParseFromArray(block_.buf, static_cast<int>(size()))) {
+      AERROR << "parse shm block failed, size: " << size();
+      return nullptr;
+    }
+    return msg;
+  }
+
+  void Release() {
+    if (segment_ != nullptr) {
+      segment_->ReleaseReadBlock(block_);
+      segment_ = nullptr;
+    }
+  }
+
+ private:
+  SegmentPtr segment_;
+  ReadableBlock block_;
+};
+
+// A reusable arena for building messages on the transmit side without
+// per-message heap allocation. The transmitter constructs the message on
+// the arena, then serializes it once, directly into the acquired shm
+// block, so the only copy on the whole intra-host path is the wire-format
+// serialization itself. The arena is recycled instead of destroyed, which
+// keeps its internal blocks warm across cycles.
+class ArenaMessagePool {
+ public:
+  explicit ArenaMessagePool(uint64_t reset_threshold = kDefaultResetThreshold)
+      : reset_threshold_(reset_threshold) {}
+
+  template <typename M>
+  M* CreateMessage() {
+    if (arena_.SpaceUsed() > reset_threshold_) {
+      arena_.Reset();
+    }
+    return google::protobuf::Arena::CreateMessage<M>(&arena_);
+  }
+
+  google::protobuf::Arena* arena() { return &arena_; }
+
+ private:
+  static const uint64_t kDefaultResetThreshold = 64 * 1024 * 1024;
+
+  google::protobuf::Arena arena_;
+  uint64_t reset_threshold_;
+};
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
+
+#endif  // CYBER_TRANSPORT_SHM_ZERO_COPY_VIEW_H_
@@ -0,0 +1,154 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "cyber/transport/shm/zero_copy_view.h"
+
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "gtest/gtest.h"
+
+#include "cyber/proto/unit_test.pb.h"
+#include "cyber/transport/shm/segment_factory.h"
+
+namespace apollo {
+namespace cyber {
+namespace transport {
+
+namespace {
+
+// Writes msg into the segment the way ShmTransmitter does and reports the
+// block index it landed in.
+bool WriteMessage(const SegmentPtr& segment, const proto::UnitTest& msg,
+                  uint32_t* index) {
+  std::string serialized;
+  if (!msg.SerializeToString(&serialized)) {
+    return false;
+  }
+  WritableBlock wb;
+  if (!segment->AcquireBlockToWrite(serialized.size(), &wb)) {
+    return false;
+  }
+  memcpy(wb.buf, serialized.data(), serialized.size());
+  wb.block->set_msg_size(serialized.size());
+  segment->ReleaseWrittenBlock(wb);
+  *index = wb.index;
+  return true;
+}
+
+}  // namespace
+
+TEST(ZeroCopyViewTest, invalid_acquire) {
+  auto view = ZeroCopyView::Acquire(nullptr, 0);
+  EXPECT_FALSE(view.IsValid());
+  EXPECT_EQ(view.size(), 0);
+  // releasing an empty view is a no-op
+  view.Release();
+}
+
+TEST(ZeroCopyViewTest, pin_parse_release) {
+  auto segment = SegmentFactory::CreateSegment(11223344);
+  ASSERT_NE(segment, nullptr);
+
+  proto::UnitTest msg;
+  msg.set_class_name("ZeroCopyViewTest");
+  msg.set_case_name("pin_parse_release");
+  std::string serialized;
+  ASSERT_TRUE(msg.SerializeToString(&serialized));
+  uint32_t index = 0;
+  ASSERT_TRUE(WriteMessage(segment, msg, &index));
+
+  auto view = ZeroCopyView::Acquire(segment, index);
+  ASSERT_TRUE(view.IsValid());
+  ASSERT_EQ(view.size(), serialized.size());
+  EXPECT_EQ(0, memcmp(view.data(), serialized.data(), serialized.size()));
+
+  // read pins are shared: a second view of the same block coexists
+  auto view2 = ZeroCopyView::Acquire(segment, index);
+  EXPECT_TRUE(view2.IsValid());
+  view2.Release();
+  EXPECT_FALSE(view2.IsValid());
+
+  google::protobuf::Arena arena;
+  auto* parsed = view.ParseTo<proto::UnitTest>(&arena);
+  ASSERT_NE(parsed, nullptr);
+  EXPECT_EQ(parsed->GetArena(), &arena);
+  EXPECT_EQ(parsed->class_name(), msg.class_name());
+  EXPECT_EQ(parsed->case_name(), msg.case_name());
+
+  view.Release();
+  EXPECT_FALSE(view.IsValid());
+
+  // with the pin gone the writer can reclaim the block; a leaked read
+  // lock would make the write path skip this index forever
+  bool reacquired = false;
+  for (int i = 0; i < 4096 && !reacquired; ++i) {
+    uint32_t idx = 0;
+    ASSERT_TRUE(WriteMessage(segment, msg, &idx));
+    reacquired = (idx == index);
+  }
+  EXPECT_TRUE(reacquired);
+}
+
+TEST(ZeroCopyViewTest, move_transfers_pin) {
+  auto segment = SegmentFactory::CreateSegment(11223345);
+  ASSERT_NE(segment, nullptr);
+
+  proto::UnitTest msg;
+  msg.set_class_name("ZeroCopyViewTest");
+  msg.set_case_name("move_transfers_pin");
+  uint32_t index = 0;
+  ASSERT_TRUE(WriteMessage(segment, msg, &index));
+
+  auto view = ZeroCopyView::Acquire(segment, index);
+  ASSERT_TRUE(view.IsValid());
+
+  ZeroCopyView moved(std::move(view));
+  EXPECT_FALSE(view.IsValid());
+  EXPECT_TRUE(moved.IsValid());
+
+  ZeroCopyView assigned;
+  assigned = std::move(moved);
+  EXPECT_FALSE(moved.IsValid());
+  ASSERT_TRUE(assigned.IsValid());
+  EXPECT_EQ(assigned.size(), msg.ByteSizeLong());
+
+  // exactly one pin is outstanding; releasing it frees the block
+  assigned.Release();
+  EXPECT_FALSE(assigned.IsValid());
+}
+
+TEST(ArenaMessagePoolTest, reuse_and_recycle) {
+  // tiny threshold so the recycle path runs within a few allocations
+  ArenaMessagePool pool(1024);
+  auto* first = pool.CreateMessage<proto::UnitTest>();
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first->GetArena(), pool.arena());
+
+  for (int i = 0; i < 100; ++i) {
+    auto* msg = pool.CreateMessage<proto::UnitTest>();
+    ASSERT_NE(msg, nullptr);
+    EXPECT_EQ(msg->GetArena(), pool.arena());
+  }
+  // the arena was reset whenever usage crossed the threshold, so it never
+  // accumulates the full hundred messages
+  EXPECT_LE(pool.arena()->SpaceUsed(), 4096);
+}
+
+}  // namespace transport
+}  // namespace cyber
+}  // namespace apollo
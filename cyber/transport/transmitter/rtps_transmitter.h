@@ -17,6 +17,8 @@
 #ifndef CYBER_TRANSPORT_TRANSMITTER_RTPS_TRANSMITTER_H_
 #define CYBER_TRANSPORT_TRANSMITTER_RTPS_TRANSMITTER_H_
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -48,11 +50,29 @@ class RtpsTransmitter : public Transmitter<M> {
 
   bool Transmit(const MessagePtr& msg, const MessageInfo& msg_info) override;
 
+  // per-link throughput counters; bytes are serialized payload, so the
+  // difference against NIC counters is the RTPS wire overhead
+  uint64_t transmitted_msgs() const {
+    return transmitted_msgs_.load(std::memory_order_relaxed);
+  }
+  uint64_t transmitted_bytes() const {
+    return transmitted_bytes_.load(std::memory_order_relaxed);
+  }
+  uint64_t write_failures() const {
+    return write_failures_.load(std::memory_order_relaxed);
+  }
+
  private:
   bool Transmit(const M& msg, const MessageInfo& msg_info);
 
   ParticipantPtr participant_;
   eprosima::fastrtps::Publisher* publisher_;
+  // reused across transmissions; its payload string keeps the running max
+  // capacity, so steady-state serialization does not touch the allocator
+  UnderlayMessage msg_buffer_;
+  std::atomic<uint64_t> transmitted_msgs_ = {0};
+  std::atomic<uint64_t> transmitted_bytes_ = {0};
+  std::atomic<uint64_t> write_failures_ = {0};
 };
 
 template <typename M>
@@ -103,8 +123,7 @@ bool RtpsTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
     return false;
   }
 
-  UnderlayMessage m;
-  RETURN_VAL_IF(!message::SerializeToString(msg, &m.data()), false);
+  RETURN_VAL_IF(!message::SerializeToString(msg, &msg_buffer_.data()), false);
 
   eprosima::fastrtps::rtps::WriteParams wparams;
 
@@ -122,7 +141,14 @@ bool RtpsTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
   if (participant_->is_shutdown()) {
     return false;
   }
-  return publisher_->write(reinterpret_cast<void*>(&m), wparams);
+  if (!publisher_->write(reinterpret_cast<void*>(&msg_buffer_), wparams)) {
+    write_failures_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  transmitted_msgs_.fetch_add(1, std::memory_order_relaxed);
+  transmitted_bytes_.fetch_add(msg_buffer_.data().size(),
+                               std::memory_order_relaxed);
+  return true;
 }
 
 }  // namespace transport
@@ -127,6 +127,7 @@ bool ShmTransmitter<M>::Transmit(const M& msg, const MessageInfo& msg_info) {
   }
   wb.block->set_msg_info_size(MessageInfo::kSize);
   segment_->ReleaseWrittenBlock(wb);
+  segment_->RecordWrittenStats(msg_size);
 
   ReadableInfo readable_info(host_id_, wb.index, channel_id_);
 
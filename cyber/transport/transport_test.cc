@@ -16,7 +16,10 @@
 
 #include "cyber/transport/transport.h"
 
+#include <atomic>
+#include <cstdlib>
 #include <memory>
+#include <new>
 #include <typeinfo>
 #include "gtest/gtest.h"
 
@@ -24,6 +27,22 @@
 #include "cyber/proto/unit_test.pb.h"
 #include "cyber/transport/common/identity.h"
 
+// counting overloads used by the steady-state allocation test below
+static std::atomic<uint64_t> g_new_count(0);
+
+void* operator new(std::size_t size) {
+  g_new_count.fetch_add(1, std::memory_order_relaxed);
+  void* ptr = malloc(size);
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept { free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { free(ptr); }
+
 namespace apollo {
 namespace cyber {
 namespace transport {
@@ -57,6 +76,44 @@ TEST(TransportTest, create_transmitter) {
   EXPECT_EQ(typeid(*shm), typeid(ShmTransmitter<proto::UnitTest>));
 }
 
+TEST(TransportTest, transmit_steady_state_no_alloc_growth) {
+  RoleAttributes attr;
+  attr.set_channel_name("transmit_steady_state");
+  Identity id;
+  attr.set_id(id.HashValue());
+
+  TransmitterPtr shm =
+      Transport::Instance()->CreateTransmitter<proto::UnitTest>(
+          attr, OptionalMode::SHM);
+  ASSERT_NE(shm, nullptr);
+
+  auto msg = std::make_shared<proto::UnitTest>();
+  msg->set_class_name("TransportTest");
+  msg->set_case_name("transmit_steady_state");
+
+  const int kBatchSize = 50;
+  // warm up so every buffer on the publish path reaches its running max
+  for (int i = 0; i < 10; ++i) {
+    shm->Transmit(msg);
+  }
+
+  const uint64_t before_first = g_new_count.load();
+  for (int i = 0; i < kBatchSize; ++i) {
+    shm->Transmit(msg);
+  }
+  const uint64_t first_batch = g_new_count.load() - before_first;
+
+  const uint64_t before_second = g_new_count.load();
+  for (int i = 0; i < kBatchSize; ++i) {
+    shm->Transmit(msg);
+  }
+  const uint64_t second_batch = g_new_count.load() - before_second;
+
+  // the publish path serializes into reused buffers, so once warmed up no
+  // batch may allocate more than the previous one
+  EXPECT_LE(second_batch, first_batch);
+}
+
 TEST(TransportTest, create_receiver) {
   RoleAttributes attr;
   attr.set_channel_name("create_receiver");
@@ -15,7 +15,11 @@
  *****************************************************************************/
 
 #include "modules/bridge/udp_bridge_sender_component.h"
-#include "modules/bridge/common/bridge_proto_serialized_buf.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include "modules/bridge/common/bridge_header.h"
 #include "modules/bridge/common/macro.h"
 #include "modules/bridge/common/util.h"
 
@@ -45,6 +49,28 @@ bool UDPBridgeSenderComponent<T>::Init() {
   return true;
 }
 
+template <typename T>
+bool UDPBridgeSenderComponent<T>::OpenSocket() {
+  struct sockaddr_in server_addr;
+  server_addr.sin_addr.s_addr = inet_addr(remote_ip_.c_str());
+  server_addr.sin_family = AF_INET;
+  server_addr.sin_port = htons(static_cast<uint16_t>(remote_port_));
+  sock_fd_ = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  if (sock_fd_ < 0) {
+    AERROR << "create socket failed!";
+    return false;
+  }
+
+  int res =
+      connect(sock_fd_, (struct sockaddr *)&server_addr, sizeof(server_addr));
+  if (res < 0) {
+    close(sock_fd_);
+    sock_fd_ = -1;
+    return false;
+  }
+  return true;
+}
+
 template <typename T>
 bool UDPBridgeSenderComponent<T>::Proc(const std::shared_ptr<T> &pb_msg) {
   if (remote_port_ == 0 || remote_ip_.empty()) {
@@ -57,29 +83,81 @@ bool UDPBridgeSenderComponent<T>::Proc(const std::shared_ptr<T> &pb_msg) {
     return false;
   }
 
-  struct sockaddr_in server_addr;
-  server_addr.sin_addr.s_addr = inet_addr(remote_ip_.c_str());
-  server_addr.sin_family = AF_INET;
-  server_addr.sin_port = htons(static_cast<uint16_t>(remote_port_));
-  int sock_fd = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+  // The connected socket is kept open across messages instead of being
+  // created and torn down per proto.
+  if (sock_fd_ < 0 && !OpenSocket()) {
+    return false;
+  }
 
-  int res =
-      connect(sock_fd, (struct sockaddr *)&server_addr, sizeof(server_addr));
-  if (res < 0) {
-    close(sock_fd);
+  // Serialize the proto once into the reused message buffer. Each fragment
+  // is sent as a (header, payload slice) scatter-gather pair pointing into
+  // the reused buffers, and all fragments of a message go out in a single
+  // sendmmsg call.
+  const bsize msg_len = static_cast<bsize>(pb_msg->ByteSize());
+  if (proto_buf_.size() < msg_len) {
+    proto_buf_.resize(msg_len);
+  }
+  if (!pb_msg->SerializeToArray(proto_buf_.data(), static_cast<int>(msg_len))) {
+    AERROR << "serialize proto failed!";
     return false;
   }
 
-  BridgeProtoSerializedBuf<T> proto_buf;
-  proto_buf.Serialize(pb_msg, proto_name_);
-  for (size_t j = 0; j < proto_buf.GetSerializedBufCount(); j++) {
-    ssize_t nbytes = send(sock_fd, proto_buf.GetSerializedBuf(j),
-                          proto_buf.GetSerializedBufSize(j), 0);
-    if (nbytes != static_cast<ssize_t>(proto_buf.GetSerializedBufSize(j))) {
-      break;
+  const uint32_t total_frames = static_cast<uint32_t>(
+      msg_len / FRAME_SIZE + (msg_len % FRAME_SIZE ? 1 : 0));
+  if (total_frames == 0) {
+    return true;
+  }
+  iovs_.resize(2 * total_frames);
+  msgs_.assign(total_frames, mmsghdr());
+
+  hsize header_size = 0;
+  for (uint32_t i = 0; i < total_frames; ++i) {
+    const bsize frame_pos = i * FRAME_SIZE;
+    const bsize left = msg_len - frame_pos;
+    const bsize cpy_size = (left > FRAME_SIZE) ? FRAME_SIZE : left;
+
+    BridgeHeader header;
+    header.SetHeaderVer(0);
+    header.SetMsgName(proto_name_);
+    header.SetMsgID(pb_msg->header().sequence_num());
+    header.SetTimeStamp(pb_msg->header().timestamp_sec());
+    header.SetMsgSize(msg_len);
+    header.SetTotalFrames(total_frames);
+    header.SetFrameSize(cpy_size);
+    header.SetIndex(i);
+    header.SetFramePos(frame_pos);
+    if (i == 0) {
+      // All fragments of a message carry the same header fields except for
+      // the per-frame values, whose serialized sizes are fixed, so every
+      // header occupies the same number of bytes.
+      header_size = header.GetHeaderSize();
+      const size_t headers_len =
+          static_cast<size_t>(header_size) * total_frames;
+      if (header_buf_.size() < headers_len) {
+        header_buf_.resize(headers_len);
+      }
+    }
+    char *header_slot = header_buf_.data() + i * header_size;
+    header.Serialize(header_slot, header_size);
+
+    iovs_[2 * i].iov_base = header_slot;
+    iovs_[2 * i].iov_len = header_size;
+    iovs_[2 * i + 1].iov_base = proto_buf_.data() + frame_pos;
+    iovs_[2 * i + 1].iov_len = cpy_size;
+    msgs_[i].msg_hdr.msg_iov = &iovs_[2 * i];
+    msgs_[i].msg_hdr.msg_iovlen = 2;
+  }
+
+  uint32_t sent = 0;
+  while (sent < total_frames) {
+    const int nframes =
+        sendmmsg(sock_fd_, &msgs_[sent], total_frames - sent, 0);
+    if (nframes < 0) {
+      AERROR << "send message failed, error: " << strerror(errno);
+      return false;
     }
+    sent += nframes;
   }
-  close(sock_fd);
 
   return true;
 }
@@ -18,6 +18,8 @@
 
 #include <netinet/in.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
 
 #include <cstdlib>
 #include <iostream>
@@ -48,6 +50,11 @@ class UDPBridgeSenderComponent final : public cyber::Component<T> {
  public:
   UDPBridgeSenderComponent()
       : monitor_logger_buffer_(common::monitor::MonitorMessageItem::CONTROL) {}
+  ~UDPBridgeSenderComponent() {
+    if (sock_fd_ >= 0) {
+      close(sock_fd_);
+    }
+  }
 
   bool Init() override;
   bool Proc(const std::shared_ptr<T> &pb_msg) override;
@@ -55,11 +62,24 @@ class UDPBridgeSenderComponent final : public cyber::Component<T> {
   std::string Name() const { return FLAGS_bridge_module_name; }
 
  private:
+  bool OpenSocket();
+
   common::monitor::MonitorLogBuffer monitor_logger_buffer_;
   unsigned int remote_port_ = 0;
   std::string remote_ip_ = "";
   std::string proto_name_ = "";
   std::mutex mutex_;
+
+  // Connected socket kept open across messages.
+  int sock_fd_ = -1;
+  // Reused send buffers: the proto is serialized once into proto_buf_ and
+  // the fragment headers into header_buf_; the iovec/mmsghdr arrays point
+  // into them so a whole message goes out in one sendmmsg call without
+  // copying the payload per fragment.
+  std::vector<char> proto_buf_;
+  std::vector<char> header_buf_;
+  std::vector<struct iovec> iovs_;
+  std::vector<struct mmsghdr> msgs_;
 };
 
 BRIDGE_COMPONENT_REGISTER(planning::ADCTrajectory)
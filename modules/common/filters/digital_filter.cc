@@ -79,6 +79,56 @@ double DigitalFilter::Filter(const double x_insert) {
   return UpdateLast(y_insert);
 }
 
+void DigitalFilter::Filter(const std::vector<double> &inputs,
+                           std::vector<double> *outputs) {
+  outputs->resize(inputs.size());
+  if (denominators_.empty() || numerators_.empty()) {
+    AERROR << "Empty denominators or numerators";
+    std::fill(outputs->begin(), outputs->end(), 0.0);
+    return;
+  }
+
+  // Run the recurrence over flat rings seeded from the filter state; index
+  // head marks the latest sample and the ring replaces the per-sample
+  // pop_back/push_front on the deques.
+  const size_t nx = numerators_.size();
+  const size_t ny = denominators_.size();
+  std::vector<double> x(x_values_.begin(), x_values_.end());
+  std::vector<double> y(y_values_.begin(), y_values_.end());
+  size_t x_head = 0;
+  size_t y_head = 0;
+
+  for (size_t k = 0; k < inputs.size(); ++k) {
+    x_head = (x_head + nx - 1) % nx;
+    x[x_head] = inputs[k];
+    double xside = 0.0;
+    for (size_t i = 0; i < nx; ++i) {
+      xside += x[(x_head + i) % nx] * numerators_[i];
+    }
+
+    y_head = (y_head + ny - 1) % ny;
+    double yside = 0.0;
+    for (size_t i = 1; i < ny; ++i) {
+      yside += y[(y_head + i) % ny] * denominators_[i];
+    }
+
+    double y_insert = 0.0;
+    if (std::fabs(denominators_.front()) > kDoubleEpsilon) {
+      y_insert = (xside - yside) / denominators_.front();
+    }
+    y[y_head] = y_insert;
+    (*outputs)[k] = UpdateLast(y_insert);
+  }
+
+  // Write the final ring contents back as the filter state, latest first.
+  for (size_t i = 0; i < nx; ++i) {
+    x_values_[i] = x[(x_head + i) % nx];
+  }
+  for (size_t i = 0; i < ny; ++i) {
+    y_values_[i] = y[(y_head + i) % ny];
+  }
+}
+
 void DigitalFilter::reset_values() {
   std::fill(x_values_.begin(), x_values_.end(), 0.0);
   std::fill(y_values_.begin(), y_values_.end(), 0.0);
@@ -59,6 +59,17 @@ class DigitalFilter {
    * @param x_insert The new input to be processed by the filter.
    */
   double Filter(const double x_insert);
+
+  /**
+   * @brief Processes a batch of measurements in one call. The filter state
+   * advances exactly as if Filter() had been called once per sample, but the
+   * recurrence runs over flat ring storage, so the per-sample deque shifting
+   * is paid only once per batch.
+   * @param inputs The inputs to be processed, oldest first.
+   * @param outputs The filtered outputs, one per input.
+   */
+  void Filter(const std::vector<double> &inputs, std::vector<double> *outputs);
+
   /**
    * @desc: Filter by the input x_insert
    * Input: new value of x_insert
@@ -70,6 +70,14 @@ double MF::Update(const double measurement) {
   }
 }
 
+void MF::Update(const std::vector<double> &measurements,
+                std::vector<double> *outputs) {
+  outputs->resize(measurements.size());
+  for (size_t i = 0; i < measurements.size(); ++i) {
+    (*outputs)[i] = Update(measurements[i]);
+  }
+}
+
 bool MF::ShouldPopOldestCandidate(const uint8 old_time) const {
   if (old_time < window_size_) {
     CHECK_LE(time_, old_time + window_size_);
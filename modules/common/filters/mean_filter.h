@@ -64,6 +64,15 @@ class MeanFilter {
    */
   double Update(const double measurement);
 
+  /**
+   * @brief Processes a batch of measurements in one call, advancing the
+   * window exactly as if Update() had been called once per measurement.
+   * @param measurements The measurements to be processed, oldest first.
+   * @param outputs The filtered outputs, one per measurement.
+   */
+  void Update(const std::vector<double> &measurements,
+              std::vector<double> *outputs);
+
  private:
   void RemoveEarliest();
   void Insert(const double value);
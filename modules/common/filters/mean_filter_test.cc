@@ -16,6 +16,8 @@
 
 #include "modules/common/filters/mean_filter.h"
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace apollo {
@@ -151,5 +153,18 @@ TEST_F(MeanFilterTest, GoodMinRemoval) {
   EXPECT_DOUBLE_EQ(mean_filter.Update(2.0), 2.5);
 }
 
+TEST_F(MeanFilterTest, BatchMatchesSequential) {
+  MeanFilter scalar_filter(4);
+  MeanFilter batch_filter(4);
+  const std::vector<double> measurements = {5.0, 3.0, 8.0, 9.0,
+                                            7.0, 2.0, 1.0, 4.0};
+  std::vector<double> outputs;
+  batch_filter.Update(measurements, &outputs);
+  ASSERT_EQ(outputs.size(), measurements.size());
+  for (size_t i = 0; i < measurements.size(); ++i) {
+    EXPECT_DOUBLE_EQ(outputs[i], scalar_filter.Update(measurements[i]));
+  }
+}
+
 }  // namespace common
 }  // namespace apollo
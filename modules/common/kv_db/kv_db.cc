@@ -17,6 +17,12 @@
 
 #include <sqlite3.h>
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
 #include "gflags/gflags.h"
 
 #include "absl/strings/str_cat.h"
@@ -87,31 +93,149 @@ class SqliteWraper {
   sqlite3 *db_ = nullptr;
 };
 
+// In-memory cache in front of sqlite. Writes update the cache and return
+// immediately; a background thread flushes pending writes to disk in one
+// batched transaction, so callers never wait on fsync. Reads are served
+// from the cache and only fall through to disk on the first access of a
+// key. A deleted or unknown key is cached as an empty optional.
+class KVDBCache {
+ public:
+  static KVDBCache *Instance() {
+    static KVDBCache cache;
+    return &cache;
+  }
+
+  bool Put(std::string_view key, std::string_view value) {
+    std::string key_str(key);
+    std::string value_str(value);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cache_[key_str] = value_str;
+      dirty_[std::move(key_str)] = std::move(value_str);
+    }
+    cv_.notify_one();
+    return true;
+  }
+
+  bool Delete(std::string_view key) {
+    std::string key_str(key);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cache_[key_str] = std::nullopt;
+      dirty_[std::move(key_str)] = std::nullopt;
+    }
+    cv_.notify_one();
+    return true;
+  }
+
+  std::optional<std::string> Get(std::string_view key) {
+    const std::string key_str(key);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto iter = cache_.find(key_str);
+      if (iter != cache_.end()) {
+        return iter->second;
+      }
+    }
+
+    // Cache miss: read through to disk.
+    SqliteWraper sqlite;
+    std::string value;
+    const bool ret = sqlite.SQL(
+        absl::StrCat("SELECT value FROM key_value WHERE key='", key, "';"),
+        &value);
+    std::optional<std::string> result;
+    if (ret && !value.empty()) {
+      result = value;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    // A write may have landed while we were reading; it wins.
+    const auto iter = cache_.find(key_str);
+    if (iter != cache_.end()) {
+      return iter->second;
+    }
+    cache_[key_str] = result;
+    return result;
+  }
+
+ private:
+  KVDBCache() : flusher_(&KVDBCache::FlushLoop, this) {}
+
+  ~KVDBCache() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      exit_ = true;
+    }
+    cv_.notify_one();
+    flusher_.join();
+  }
+
+  void FlushLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [this] { return exit_ || !dirty_.empty(); });
+      if (dirty_.empty()) {
+        break;
+      }
+      std::unordered_map<std::string, std::optional<std::string>> pending;
+      pending.swap(dirty_);
+      lock.unlock();
+      Flush(pending);
+      lock.lock();
+      if (exit_ && dirty_.empty()) {
+        break;
+      }
+    }
+  }
+
+  void Flush(
+      const std::unordered_map<std::string, std::optional<std::string>>
+          &pending) {
+    std::string sql = "BEGIN TRANSACTION;";
+    for (const auto &entry : pending) {
+      if (entry.second.has_value()) {
+        absl::StrAppend(&sql,
+                        "INSERT OR REPLACE INTO key_value (key, value) "
+                        "VALUES ('",
+                        entry.first, "', '", *entry.second, "');");
+      } else {
+        absl::StrAppend(&sql, "DELETE FROM key_value WHERE key='", entry.first,
+                        "';");
+      }
+    }
+    absl::StrAppend(&sql, "COMMIT;");
+
+    SqliteWraper sqlite;
+    if (!sqlite.SQL(sql)) {
+      AERROR << "Failed to flush " << pending.size()
+             << " pending writes to Key-Value database.";
+    }
+  }
+
+  // Latest known value per key; an empty optional marks a key known to be
+  // absent.
+  std::unordered_map<std::string, std::optional<std::string>> cache_;
+  // Writes not yet flushed to disk.
+  std::unordered_map<std::string, std::optional<std::string>> dirty_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool exit_ = false;
+  std::thread flusher_;
+};
+
 }  // namespace
 
 bool KVDB::Put(std::string_view key, std::string_view value) {
-  SqliteWraper sqlite;
-  return sqlite.SQL(
-      absl::StrCat("INSERT OR REPLACE INTO key_value (key, value) VALUES ('",
-                   key, "', '", value, "');"));
+  return KVDBCache::Instance()->Put(key, value);
 }
 
 bool KVDB::Delete(std::string_view key) {
-  SqliteWraper sqlite;
-  return sqlite.SQL(
-      absl::StrCat("DELETE FROM key_value WHERE key='", key, "';"));
+  return KVDBCache::Instance()->Delete(key);
 }
 
 std::optional<std::string> KVDB::Get(std::string_view key) {
-  SqliteWraper sqlite;
-  std::string value;
-  const bool ret = sqlite.SQL(
-      absl::StrCat("SELECT value FROM key_value WHERE key='", key, "';"),
-      &value);
-  if (ret && !value.empty()) {
-    return value;
-  }
-  return {};
+  return KVDBCache::Instance()->Get(key);
 }
 
 }  // namespace common
@@ -32,6 +32,9 @@ namespace common {
  *
  * @brief Lightweight key-value database to store system-wide parameters.
  *        We prefer keys like "apollo:data:commit_id".
+ *        Operations are served from an in-process cache; writes are flushed
+ *        to disk in the background, so Put/Delete report acceptance rather
+ *        than durable completion.
  */
 class KVDB {
  public:
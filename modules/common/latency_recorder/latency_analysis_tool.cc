@@ -0,0 +1,212 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Offline analyzer for latency records. Reads cyber record files,
+ * joins the LatencyRecordMap messages published by all modules on the
+ * shared message id (the sensor timestamp minted at driver intake), and
+ * reports per-module and sensor-to-module latency percentiles plus the
+ * slowest end-to-end traces with a per-stage breakdown.
+ *
+ * Usage: latency_analysis_tool <record_file> [<record_file> ...]
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "cyber/common/log.h"
+#include "cyber/record/record_reader.h"
+#include "cyber/record/record_viewer.h"
+#include "gflags/gflags.h"
+#include "modules/common/adapters/adapter_gflags.h"
+#include "modules/common/latency_recorder/proto/latency_record.pb.h"
+
+DEFINE_int32(top_outlier_num, 10,
+             "Number of slowest end-to-end traces to break down by stage.");
+
+namespace apollo {
+namespace common {
+namespace {
+
+using apollo::cyber::record::RecordReader;
+using apollo::cyber::record::RecordViewer;
+
+// (begin_time, end_time, module_name), ordered by begin time.
+using StageRecord = std::tuple<uint64_t, uint64_t, std::string>;
+
+double NanosToMillis(const uint64_t nanos) { return nanos * 1e-6; }
+
+uint64_t Percentile(const std::vector<uint64_t>& sorted_samples,
+                    const double percent) {
+  if (sorted_samples.empty()) {
+    return 0;
+  }
+  const auto index = static_cast<size_t>(
+      percent / 100.0 * static_cast<double>(sorted_samples.size() - 1));
+  return sorted_samples[index];
+}
+
+void PrintStatLine(const std::string& name, std::vector<uint64_t>* samples) {
+  std::sort(samples->begin(), samples->end());
+  std::cout << "  " << std::left << std::setw(48) << name << std::right
+            << std::fixed << std::setprecision(3) << std::setw(12)
+            << NanosToMillis(Percentile(*samples, 50.0)) << std::setw(12)
+            << NanosToMillis(Percentile(*samples, 90.0)) << std::setw(12)
+            << NanosToMillis(Percentile(*samples, 99.0)) << std::setw(12)
+            << NanosToMillis(samples->back()) << std::setw(10)
+            << samples->size() << std::endl;
+}
+
+void PrintStatHeader(const std::string& title) {
+  std::cout << std::endl << title << " (ms):" << std::endl;
+  std::cout << "  " << std::left << std::setw(48) << "name" << std::right
+            << std::setw(12) << "p50" << std::setw(12) << "p90" << std::setw(12)
+            << "p99" << std::setw(12) << "max" << std::setw(10) << "samples"
+            << std::endl;
+}
+
+int AnalyzeRecords(const std::vector<std::string>& record_files) {
+  // All stage records keyed by message id, i.e. the trace id shared by all
+  // modules that processed the same sensor frame.
+  std::map<uint64_t, std::set<StageRecord>> track_map;
+
+  for (const std::string& record_file : record_files) {
+    const auto reader = std::make_shared<RecordReader>(record_file);
+    if (!reader->IsValid()) {
+      AERROR << "unable to open record file: " << record_file;
+      return -1;
+    }
+    RecordViewer viewer(reader, 0, UINT64_MAX,
+                        {FLAGS_latency_recording_topic});
+    for (const auto& msg : viewer) {
+      LatencyRecordMap record_map;
+      if (!record_map.ParseFromString(msg.content)) {
+        AWARN << "failed to parse a LatencyRecordMap message, skipping";
+        continue;
+      }
+      for (const auto& record : record_map.latency_records()) {
+        track_map[record.message_id()].emplace(
+            record.begin_time(), record.end_time(), record_map.module_name());
+      }
+    }
+  }
+
+  if (track_map.empty()) {
+    std::cout << "no latency records found on "
+              << FLAGS_latency_recording_topic << std::endl;
+    return 0;
+  }
+
+  // Per-module processing time and sensor-to-module latency, measured from
+  // the intake stage (the point cloud driver) to each downstream module.
+  const std::string e2e_start_point = FLAGS_pointcloud_topic;
+  std::unordered_map<std::string, std::vector<uint64_t>> modules_track;
+  std::unordered_map<std::string, std::vector<uint64_t>> e2es_track;
+  // (total end-to-end duration, trace id) for outlier ranking.
+  std::vector<std::pair<uint64_t, uint64_t>> trace_durations;
+
+  for (const auto& message : track_map) {
+    uint64_t e2e_begin_time = 0;
+    uint64_t trace_end_time = 0;
+    std::set<std::string> seen_modules;
+    for (const auto& stage : message.second) {
+      uint64_t begin_time = 0, end_time = 0;
+      std::string module_name;
+      std::tie(begin_time, end_time, module_name) = stage;
+      modules_track[module_name].push_back(end_time - begin_time);
+      if (e2e_begin_time == 0 && module_name == e2e_start_point) {
+        e2e_begin_time = begin_time;
+      } else if (module_name != e2e_start_point && e2e_begin_time != 0 &&
+                 seen_modules.insert(module_name).second) {
+        e2es_track[module_name].push_back(begin_time - e2e_begin_time);
+      }
+      trace_end_time = std::max(trace_end_time, end_time);
+    }
+    if (e2e_begin_time != 0 && message.second.size() > 1) {
+      trace_durations.emplace_back(trace_end_time - e2e_begin_time,
+                                   message.first);
+    }
+  }
+
+  PrintStatHeader("module latency");
+  for (auto& module : modules_track) {
+    PrintStatLine(module.first, &module.second);
+  }
+
+  PrintStatHeader("sensor-to-module latency");
+  for (auto& e2e : e2es_track) {
+    PrintStatLine(e2e_start_point + " -> " + e2e.first, &e2e.second);
+  }
+
+  // Break the slowest traces down by stage so an outlier can be attributed
+  // to the module that caused it.
+  std::sort(trace_durations.rbegin(), trace_durations.rend());
+  const size_t outlier_num = std::min(
+      trace_durations.size(), static_cast<size_t>(FLAGS_top_outlier_num));
+  std::cout << std::endl
+            << "slowest " << outlier_num << " traces:" << std::endl;
+  for (size_t i = 0; i < outlier_num; ++i) {
+    const uint64_t trace_id = trace_durations[i].second;
+    const auto& stages = track_map[trace_id];
+    const uint64_t trace_begin_time = std::get<0>(*stages.begin());
+    std::cout << "  trace " << trace_id << ": total " << std::fixed
+              << std::setprecision(3)
+              << NanosToMillis(trace_durations[i].first) << " ms" << std::endl;
+    for (const auto& stage : stages) {
+      uint64_t begin_time = 0, end_time = 0;
+      std::string module_name;
+      std::tie(begin_time, end_time, module_name) = stage;
+      std::cout << "    " << std::left << std::setw(46) << module_name
+                << std::right << " +" << std::setw(10)
+                << NanosToMillis(begin_time - trace_begin_time) << " ms .. +"
+                << std::setw(10) << NanosToMillis(end_time - trace_begin_time)
+                << " ms (" << NanosToMillis(end_time - begin_time) << " ms)"
+                << std::endl;
+    }
+  }
+
+  return 0;
+}
+
+}  // namespace
+}  // namespace common
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+
+  if (argc < 2) {
+    std::cout << "usage: " << argv[0] << " <record_file> [<record_file> ...]"
+              << std::endl;
+    return -1;
+  }
+
+  std::vector<std::string> record_files;
+  for (int i = 1; i < argc; ++i) {
+    record_files.emplace_back(argv[i]);
+  }
+  return apollo::common::AnalyzeRecords(record_files);
+}
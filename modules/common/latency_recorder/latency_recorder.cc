@@ -63,7 +63,11 @@ void LatencyRecorder::AppendLatencyRecord(const uint64_t message_id,
 
   const auto now = absl::Now();
   static const absl::Duration kPublishInterval = absl::Seconds(3);
-  if (now - current_time_ > kPublishInterval) {
+  // Flush early when the pending buffer fills up, so a stalled or absent
+  // subscriber bounds the memory held here instead of growing it.
+  static constexpr int kMaxPendingRecords = 1024;
+  if (now - current_time_ > kPublishInterval ||
+      records_->latency_records_size() >= kMaxPendingRecords) {
     PublishLatencyRecords(writer);
     current_time_ = now;
   }
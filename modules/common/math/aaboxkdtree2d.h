@@ -16,14 +16,13 @@
 
 /**
  * @file
- * @brief Defines the templated AABoxKDTree2dNode class.
+ * @brief Defines the templated AABoxKDTree2d class.
  */
 
 #pragma once
 
 #include <algorithm>
 #include <limits>
-#include <memory>
 #include <vector>
 
 #include "cyber/common/log.h"
@@ -53,63 +52,71 @@ struct AABoxKDTreeParams {
 };
 
 /**
- * @class AABoxKDTree2dNode
- * @brief The class of KD-tree node of axis-aligned bounding box.
+ * @class AABoxKDTree2d
+ * @brief The class of KD-tree of Aligned Axis Bounding Box(AABox).
+ *
+ * The tree is stored as one contiguous node array, and every node refers to
+ * its children and to its objects by index into flat arrays, so tree descent
+ * walks dense memory instead of chasing per-node heap allocations.
  */
 template <class ObjectType>
-class AABoxKDTree2dNode {
+class AABoxKDTree2d {
  public:
   using ObjectPtr = const ObjectType *;
+
   /**
-   * @brief Constructor which takes a vector of objects,
-   *        parameters and depth of the node.
-   * @param objects Objects to build the KD-tree node.
+   * @brief Constructor which takes a vector of objects and parameters.
    * @param params Parameters to build the KD-tree.
-   * @param depth Depth of the KD-tree node.
    */
-  AABoxKDTree2dNode(const std::vector<ObjectPtr> &objects,
-                    const AABoxKDTreeParams &params, int depth)
-      : depth_(depth) {
-    CHECK(!objects.empty());
-
-    ComputeBoundary(objects);
-    ComputePartition();
-
-    if (SplitToSubNodes(objects, params)) {
-      std::vector<ObjectPtr> left_subnode_objects;
-      std::vector<ObjectPtr> right_subnode_objects;
-      PartitionObjects(objects, &left_subnode_objects, &right_subnode_objects);
-
-      // Split to sub-nodes.
-      if (!left_subnode_objects.empty()) {
-        left_subnode_.reset(new AABoxKDTree2dNode<ObjectType>(
-            left_subnode_objects, params, depth + 1));
-      }
-      if (!right_subnode_objects.empty()) {
-        right_subnode_.reset(new AABoxKDTree2dNode<ObjectType>(
-            right_subnode_objects, params, depth + 1));
-      }
-    } else {
-      InitObjects(objects);
+  AABoxKDTree2d(const std::vector<ObjectType> &objects,
+                const AABoxKDTreeParams &params) {
+    if (objects.empty()) {
+      return;
     }
+    std::vector<ObjectPtr> object_ptrs;
+    object_ptrs.reserve(objects.size());
+    for (const auto &object : objects) {
+      object_ptrs.push_back(&object);
+    }
+    objects_sorted_by_min_.reserve(objects.size());
+    objects_sorted_by_max_.reserve(objects.size());
+    objects_sorted_by_min_bound_.reserve(objects.size());
+    objects_sorted_by_max_bound_.reserve(objects.size());
+    BuildNode(object_ptrs, params, 0);
   }
 
   /**
-   * @brief Get the nearest object to a target point by the KD-tree
-   *        rooted at this node.
+   * @brief Get the nearest object to a target point.
    * @param point The target point. Search it's nearest object.
    * @return The nearest object to the target point.
    */
   ObjectPtr GetNearestObject(const Vec2d &point) const {
     ObjectPtr nearest_object = nullptr;
-    double min_distance_sqr = std::numeric_limits<double>::infinity();
-    GetNearestObjectInternal(point, &min_distance_sqr, &nearest_object);
+    if (!nodes_.empty()) {
+      double min_distance_sqr = std::numeric_limits<double>::infinity();
+      GetNearestObjectInternal(0, point, &min_distance_sqr, &nearest_object);
+    }
     return nearest_object;
   }
 
   /**
-   * @brief Get objects within a distance to a point by the KD-tree
-   *        rooted at this node.
+   * @brief Get the nearest object to each point of a batch of query points.
+   *        Consecutive queries reuse the node array while it is hot in cache.
+   * @param points The target points to search nearest objects for.
+   * @return The nearest object to each target point, in input order.
+   */
+  std::vector<ObjectPtr> GetNearestObjects(
+      const std::vector<Vec2d> &points) const {
+    std::vector<ObjectPtr> nearest_objects;
+    nearest_objects.reserve(points.size());
+    for (const auto &point : points) {
+      nearest_objects.push_back(GetNearestObject(point));
+    }
+    return nearest_objects;
+  }
+
+  /**
+   * @brief Get objects within a distance to a point.
    * @param point The center point of the range to search objects.
    * @param distance The radius of the range to search objects.
    * @return All objects within the specified distance to the specified point.
@@ -117,7 +124,10 @@ class AABoxKDTree2dNode {
   std::vector<ObjectPtr> GetObjects(const Vec2d &point,
                                     const double distance) const {
     std::vector<ObjectPtr> result_objects;
-    GetObjectsInternal(point, distance, Square(distance), &result_objects);
+    if (!nodes_.empty()) {
+      GetObjectsInternal(0, point, distance, Square(distance),
+                         &result_objects);
+    }
     return result_objects;
   }
 
@@ -126,153 +136,231 @@ class AABoxKDTree2dNode {
    * @return The axis-aligned bounding box of the objects.
    */
   AABox2d GetBoundingBox() const {
-    return AABox2d({min_x_, min_y_}, {max_x_, max_y_});
+    if (nodes_.empty()) {
+      return AABox2d();
+    }
+    const Node &root = nodes_[0];
+    return AABox2d({root.min_x, root.min_y}, {root.max_x, root.max_y});
   }
 
  private:
-  void InitObjects(const std::vector<ObjectPtr> &objects) {
-    num_objects_ = static_cast<int>(objects.size());
-    objects_sorted_by_min_ = objects;
-    objects_sorted_by_max_ = objects;
-    std::sort(objects_sorted_by_min_.begin(), objects_sorted_by_min_.end(),
-              [&](ObjectPtr obj1, ObjectPtr obj2) {
-                return partition_ == PARTITION_X
+  static constexpr int kInvalidIndex = -1;
+
+  enum Partition {
+    PARTITION_X = 1,
+    PARTITION_Y = 2,
+  };
+
+  struct Node {
+    // Range of this node's own objects in the flat object arrays; the whole
+    // subtree occupies [objects_begin, objects_begin + subtree_num_objects).
+    int objects_begin = 0;
+    int num_objects = 0;
+    int subtree_num_objects = 0;
+    int left_index = kInvalidIndex;
+    int right_index = kInvalidIndex;
+
+    // Boundary
+    double min_x = 0.0;
+    double max_x = 0.0;
+    double min_y = 0.0;
+    double max_y = 0.0;
+    double mid_x = 0.0;
+    double mid_y = 0.0;
+
+    Partition partition = PARTITION_X;
+    double partition_position = 0.0;
+  };
+
+  int BuildNode(const std::vector<ObjectPtr> &objects,
+                const AABoxKDTreeParams &params, int depth) {
+    CHECK(!objects.empty());
+    const int node_index = static_cast<int>(nodes_.size());
+    nodes_.emplace_back();
+
+    Node node;
+    ComputeBoundary(objects, &node);
+    ComputePartition(&node);
+
+    if (SplitToSubNodes(objects, params, node, depth)) {
+      std::vector<ObjectPtr> left_subnode_objects;
+      std::vector<ObjectPtr> right_subnode_objects;
+      std::vector<ObjectPtr> other_objects;
+      PartitionObjects(objects, node, &left_subnode_objects,
+                       &right_subnode_objects, &other_objects);
+      InitObjects(other_objects, &node);
+
+      // Split to sub-nodes.
+      if (!left_subnode_objects.empty()) {
+        node.left_index = BuildNode(left_subnode_objects, params, depth + 1);
+      }
+      if (!right_subnode_objects.empty()) {
+        node.right_index = BuildNode(right_subnode_objects, params, depth + 1);
+      }
+    } else {
+      InitObjects(objects, &node);
+    }
+    node.subtree_num_objects =
+        static_cast<int>(objects_sorted_by_min_.size()) - node.objects_begin;
+    nodes_[node_index] = node;
+    return node_index;
+  }
+
+  void InitObjects(const std::vector<ObjectPtr> &objects, Node *const node) {
+    node->objects_begin = static_cast<int>(objects_sorted_by_min_.size());
+    node->num_objects = static_cast<int>(objects.size());
+    objects_sorted_by_min_.insert(objects_sorted_by_min_.end(),
+                                  objects.begin(), objects.end());
+    objects_sorted_by_max_.insert(objects_sorted_by_max_.end(),
+                                  objects.begin(), objects.end());
+    const Partition partition = node->partition;
+    std::sort(objects_sorted_by_min_.begin() + node->objects_begin,
+              objects_sorted_by_min_.end(),
+              [partition](ObjectPtr obj1, ObjectPtr obj2) {
+                return partition == PARTITION_X
                            ? obj1->aabox().min_x() < obj2->aabox().min_x()
                            : obj1->aabox().min_y() < obj2->aabox().min_y();
               });
-    std::sort(objects_sorted_by_max_.begin(), objects_sorted_by_max_.end(),
-              [&](ObjectPtr obj1, ObjectPtr obj2) {
-                return partition_ == PARTITION_X
+    std::sort(objects_sorted_by_max_.begin() + node->objects_begin,
+              objects_sorted_by_max_.end(),
+              [partition](ObjectPtr obj1, ObjectPtr obj2) {
+                return partition == PARTITION_X
                            ? obj1->aabox().max_x() > obj2->aabox().max_x()
                            : obj1->aabox().max_y() > obj2->aabox().max_y();
               });
-    objects_sorted_by_min_bound_.reserve(num_objects_);
-    for (ObjectPtr object : objects_sorted_by_min_) {
-      objects_sorted_by_min_bound_.push_back(partition_ == PARTITION_X
+    for (int i = 0; i < node->num_objects; ++i) {
+      ObjectPtr object = objects_sorted_by_min_[node->objects_begin + i];
+      objects_sorted_by_min_bound_.push_back(partition == PARTITION_X
                                                  ? object->aabox().min_x()
                                                  : object->aabox().min_y());
     }
-    objects_sorted_by_max_bound_.reserve(num_objects_);
-    for (ObjectPtr object : objects_sorted_by_max_) {
-      objects_sorted_by_max_bound_.push_back(partition_ == PARTITION_X
+    for (int i = 0; i < node->num_objects; ++i) {
+      ObjectPtr object = objects_sorted_by_max_[node->objects_begin + i];
+      objects_sorted_by_max_bound_.push_back(partition == PARTITION_X
                                                  ? object->aabox().max_x()
                                                  : object->aabox().max_y());
     }
   }
 
   bool SplitToSubNodes(const std::vector<ObjectPtr> &objects,
-                       const AABoxKDTreeParams &params) {
-    if (params.max_depth >= 0 && depth_ >= params.max_depth) {
+                       const AABoxKDTreeParams &params, const Node &node,
+                       int depth) const {
+    if (params.max_depth >= 0 && depth >= params.max_depth) {
       return false;
     }
     if (static_cast<int>(objects.size()) <= std::max(1, params.max_leaf_size)) {
       return false;
     }
     if (params.max_leaf_dimension >= 0.0 &&
-        std::max(max_x_ - min_x_, max_y_ - min_y_) <=
+        std::max(node.max_x - node.min_x, node.max_y - node.min_y) <=
             params.max_leaf_dimension) {
       return false;
     }
     return true;
   }
 
-  double LowerDistanceSquareToPoint(const Vec2d &point) const {
+  static double LowerDistanceSquareToPoint(const Node &node,
+                                           const Vec2d &point) {
     double dx = 0.0;
-    if (point.x() < min_x_) {
-      dx = min_x_ - point.x();
-    } else if (point.x() > max_x_) {
-      dx = point.x() - max_x_;
+    if (point.x() < node.min_x) {
+      dx = node.min_x - point.x();
+    } else if (point.x() > node.max_x) {
+      dx = point.x() - node.max_x;
     }
     double dy = 0.0;
-    if (point.y() < min_y_) {
-      dy = min_y_ - point.y();
-    } else if (point.y() > max_y_) {
-      dy = point.y() - max_y_;
+    if (point.y() < node.min_y) {
+      dy = node.min_y - point.y();
+    } else if (point.y() > node.max_y) {
+      dy = point.y() - node.max_y;
     }
     return dx * dx + dy * dy;
   }
 
-  double UpperDistanceSquareToPoint(const Vec2d &point) const {
-    const double dx =
-        (point.x() > mid_x_ ? (point.x() - min_x_) : (point.x() - max_x_));
-    const double dy =
-        (point.y() > mid_y_ ? (point.y() - min_y_) : (point.y() - max_y_));
+  static double UpperDistanceSquareToPoint(const Node &node,
+                                           const Vec2d &point) {
+    const double dx = (point.x() > node.mid_x ? (point.x() - node.min_x)
+                                              : (point.x() - node.max_x));
+    const double dy = (point.y() > node.mid_y ? (point.y() - node.min_y)
+                                              : (point.y() - node.max_y));
     return dx * dx + dy * dy;
   }
 
-  void GetAllObjects(std::vector<ObjectPtr> *const result_objects) const {
-    result_objects->insert(result_objects->end(),
-                           objects_sorted_by_min_.begin(),
-                           objects_sorted_by_min_.end());
-    if (left_subnode_ != nullptr) {
-      left_subnode_->GetAllObjects(result_objects);
-    }
-    if (right_subnode_ != nullptr) {
-      right_subnode_->GetAllObjects(result_objects);
-    }
+  void GetAllObjects(const Node &node,
+                     std::vector<ObjectPtr> *const result_objects) const {
+    // The flat arrays store each subtree as one contiguous span.
+    result_objects->insert(
+        result_objects->end(),
+        objects_sorted_by_min_.begin() + node.objects_begin,
+        objects_sorted_by_min_.begin() + node.objects_begin +
+            node.subtree_num_objects);
   }
 
-  void GetObjectsInternal(const Vec2d &point, const double distance,
-                          const double distance_sqr,
+  void GetObjectsInternal(const int node_index, const Vec2d &point,
+                          const double distance, const double distance_sqr,
                           std::vector<ObjectPtr> *const result_objects) const {
-    if (LowerDistanceSquareToPoint(point) > distance_sqr) {
+    const Node &node = nodes_[node_index];
+    if (LowerDistanceSquareToPoint(node, point) > distance_sqr) {
       return;
     }
-    if (UpperDistanceSquareToPoint(point) <= distance_sqr) {
-      GetAllObjects(result_objects);
+    if (UpperDistanceSquareToPoint(node, point) <= distance_sqr) {
+      GetAllObjects(node, result_objects);
       return;
     }
-    const double pvalue = (partition_ == PARTITION_X ? point.x() : point.y());
-    if (pvalue < partition_position_) {
+    const double pvalue =
+        (node.partition == PARTITION_X ? point.x() : point.y());
+    if (pvalue < node.partition_position) {
       const double limit = pvalue + distance;
-      for (int i = 0; i < num_objects_; ++i) {
-        if (objects_sorted_by_min_bound_[i] > limit) {
+      for (int i = 0; i < node.num_objects; ++i) {
+        if (objects_sorted_by_min_bound_[node.objects_begin + i] > limit) {
           break;
         }
-        ObjectPtr object = objects_sorted_by_min_[i];
+        ObjectPtr object = objects_sorted_by_min_[node.objects_begin + i];
         if (object->DistanceSquareTo(point) <= distance_sqr) {
           result_objects->push_back(object);
         }
       }
     } else {
       const double limit = pvalue - distance;
-      for (int i = 0; i < num_objects_; ++i) {
-        if (objects_sorted_by_max_bound_[i] < limit) {
+      for (int i = 0; i < node.num_objects; ++i) {
+        if (objects_sorted_by_max_bound_[node.objects_begin + i] < limit) {
           break;
         }
-        ObjectPtr object = objects_sorted_by_max_[i];
+        ObjectPtr object = objects_sorted_by_max_[node.objects_begin + i];
         if (object->DistanceSquareTo(point) <= distance_sqr) {
           result_objects->push_back(object);
         }
       }
     }
-    if (left_subnode_ != nullptr) {
-      left_subnode_->GetObjectsInternal(point, distance, distance_sqr,
-                                        result_objects);
+    if (node.left_index != kInvalidIndex) {
+      GetObjectsInternal(node.left_index, point, distance, distance_sqr,
+                         result_objects);
     }
-    if (right_subnode_ != nullptr) {
-      right_subnode_->GetObjectsInternal(point, distance, distance_sqr,
-                                         result_objects);
+    if (node.right_index != kInvalidIndex) {
+      GetObjectsInternal(node.right_index, point, distance, distance_sqr,
+                         result_objects);
     }
   }
 
-  void GetNearestObjectInternal(const Vec2d &point,
+  void GetNearestObjectInternal(const int node_index, const Vec2d &point,
                                 double *const min_distance_sqr,
                                 ObjectPtr *const nearest_object) const {
-    if (LowerDistanceSquareToPoint(point) >= *min_distance_sqr - kMathEpsilon) {
+    const Node &node = nodes_[node_index];
+    if (LowerDistanceSquareToPoint(node, point) >=
+        *min_distance_sqr - kMathEpsilon) {
       return;
     }
-    const double pvalue = (partition_ == PARTITION_X ? point.x() : point.y());
-    const bool search_left_first = (pvalue < partition_position_);
+    const double pvalue =
+        (node.partition == PARTITION_X ? point.x() : point.y());
+    const bool search_left_first = (pvalue < node.partition_position);
     if (search_left_first) {
-      if (left_subnode_ != nullptr) {
-        left_subnode_->GetNearestObjectInternal(point, min_distance_sqr,
-                                                nearest_object);
+      if (node.left_index != kInvalidIndex) {
+        GetNearestObjectInternal(node.left_index, point, min_distance_sqr,
+                                 nearest_object);
       }
     } else {
-      if (right_subnode_ != nullptr) {
-        right_subnode_->GetNearestObjectInternal(point, min_distance_sqr,
-                                                 nearest_object);
+      if (node.right_index != kInvalidIndex) {
+        GetNearestObjectInternal(node.right_index, point, min_distance_sqr,
+                                 nearest_object);
       }
     }
     if (*min_distance_sqr <= kMathEpsilon) {
@@ -280,12 +368,13 @@ class AABoxKDTree2dNode {
     }
 
     if (search_left_first) {
-      for (int i = 0; i < num_objects_; ++i) {
-        const double bound = objects_sorted_by_min_bound_[i];
+      for (int i = 0; i < node.num_objects; ++i) {
+        const double bound =
+            objects_sorted_by_min_bound_[node.objects_begin + i];
         if (bound > pvalue && Square(bound - pvalue) > *min_distance_sqr) {
           break;
         }
-        ObjectPtr object = objects_sorted_by_min_[i];
+        ObjectPtr object = objects_sorted_by_min_[node.objects_begin + i];
         const double distance_sqr = object->DistanceSquareTo(point);
         if (distance_sqr < *min_distance_sqr) {
           *min_distance_sqr = distance_sqr;
@@ -293,12 +382,13 @@ class AABoxKDTree2dNode {
         }
       }
     } else {
-      for (int i = 0; i < num_objects_; ++i) {
-        const double bound = objects_sorted_by_max_bound_[i];
+      for (int i = 0; i < node.num_objects; ++i) {
+        const double bound =
+            objects_sorted_by_max_bound_[node.objects_begin + i];
         if (bound < pvalue && Square(bound - pvalue) > *min_distance_sqr) {
           break;
         }
-        ObjectPtr object = objects_sorted_by_max_[i];
+        ObjectPtr object = objects_sorted_by_max_[node.objects_begin + i];
         const double distance_sqr = object->DistanceSquareTo(point);
         if (distance_sqr < *min_distance_sqr) {
           *min_distance_sqr = distance_sqr;
@@ -310,160 +400,81 @@ class AABoxKDTree2dNode {
       return;
     }
     if (search_left_first) {
-      if (right_subnode_ != nullptr) {
-        right_subnode_->GetNearestObjectInternal(point, min_distance_sqr,
-                                                 nearest_object);
+      if (node.right_index != kInvalidIndex) {
+        GetNearestObjectInternal(node.right_index, point, min_distance_sqr,
+                                 nearest_object);
       }
     } else {
-      if (left_subnode_ != nullptr) {
-        left_subnode_->GetNearestObjectInternal(point, min_distance_sqr,
-                                                nearest_object);
+      if (node.left_index != kInvalidIndex) {
+        GetNearestObjectInternal(node.left_index, point, min_distance_sqr,
+                                 nearest_object);
       }
     }
   }
 
-  void ComputeBoundary(const std::vector<ObjectPtr> &objects) {
-    min_x_ = std::numeric_limits<double>::infinity();
-    min_y_ = std::numeric_limits<double>::infinity();
-    max_x_ = -std::numeric_limits<double>::infinity();
-    max_y_ = -std::numeric_limits<double>::infinity();
+  static void ComputeBoundary(const std::vector<ObjectPtr> &objects,
+                              Node *const node) {
+    node->min_x = std::numeric_limits<double>::infinity();
+    node->min_y = std::numeric_limits<double>::infinity();
+    node->max_x = -std::numeric_limits<double>::infinity();
+    node->max_y = -std::numeric_limits<double>::infinity();
     for (ObjectPtr object : objects) {
-      min_x_ = std::fmin(min_x_, object->aabox().min_x());
-      max_x_ = std::fmax(max_x_, object->aabox().max_x());
-      min_y_ = std::fmin(min_y_, object->aabox().min_y());
-      max_y_ = std::fmax(max_y_, object->aabox().max_y());
+      node->min_x = std::fmin(node->min_x, object->aabox().min_x());
+      node->max_x = std::fmax(node->max_x, object->aabox().max_x());
+      node->min_y = std::fmin(node->min_y, object->aabox().min_y());
+      node->max_y = std::fmax(node->max_y, object->aabox().max_y());
     }
-    mid_x_ = (min_x_ + max_x_) / 2.0;
-    mid_y_ = (min_y_ + max_y_) / 2.0;
-    CHECK(!std::isinf(max_x_) && !std::isinf(max_y_) && !std::isinf(min_x_) &&
-          !std::isinf(min_y_))
+    node->mid_x = (node->min_x + node->max_x) / 2.0;
+    node->mid_y = (node->min_y + node->max_y) / 2.0;
+    CHECK(!std::isinf(node->max_x) && !std::isinf(node->max_y) &&
+          !std::isinf(node->min_x) && !std::isinf(node->min_y))
         << "the provided object box size is infinity";
   }
 
-  void ComputePartition() {
-    if (max_x_ - min_x_ >= max_y_ - min_y_) {
-      partition_ = PARTITION_X;
-      partition_position_ = (min_x_ + max_x_) / 2.0;
+  static void ComputePartition(Node *const node) {
+    if (node->max_x - node->min_x >= node->max_y - node->min_y) {
+      node->partition = PARTITION_X;
+      node->partition_position = (node->min_x + node->max_x) / 2.0;
     } else {
-      partition_ = PARTITION_Y;
-      partition_position_ = (min_y_ + max_y_) / 2.0;
+      node->partition = PARTITION_Y;
+      node->partition_position = (node->min_y + node->max_y) / 2.0;
     }
   }
 
-  void PartitionObjects(const std::vector<ObjectPtr> &objects,
-                        std::vector<ObjectPtr> *const left_subnode_objects,
-                        std::vector<ObjectPtr> *const right_subnode_objects) {
-    left_subnode_objects->clear();
-    right_subnode_objects->clear();
-    std::vector<ObjectPtr> other_objects;
-    if (partition_ == PARTITION_X) {
+  static void PartitionObjects(
+      const std::vector<ObjectPtr> &objects, const Node &node,
+      std::vector<ObjectPtr> *const left_subnode_objects,
+      std::vector<ObjectPtr> *const right_subnode_objects,
+      std::vector<ObjectPtr> *const other_objects) {
+    if (node.partition == PARTITION_X) {
       for (ObjectPtr object : objects) {
-        if (object->aabox().max_x() <= partition_position_) {
+        if (object->aabox().max_x() <= node.partition_position) {
           left_subnode_objects->push_back(object);
-        } else if (object->aabox().min_x() >= partition_position_) {
+        } else if (object->aabox().min_x() >= node.partition_position) {
           right_subnode_objects->push_back(object);
         } else {
-          other_objects.push_back(object);
+          other_objects->push_back(object);
         }
       }
     } else {
       for (ObjectPtr object : objects) {
-        if (object->aabox().max_y() <= partition_position_) {
+        if (object->aabox().max_y() <= node.partition_position) {
           left_subnode_objects->push_back(object);
-        } else if (object->aabox().min_y() >= partition_position_) {
+        } else if (object->aabox().min_y() >= node.partition_position) {
           right_subnode_objects->push_back(object);
         } else {
-          other_objects.push_back(object);
+          other_objects->push_back(object);
         }
       }
     }
-    InitObjects(other_objects);
   }
 
  private:
-  int num_objects_ = 0;
+  std::vector<Node> nodes_;
   std::vector<ObjectPtr> objects_sorted_by_min_;
   std::vector<ObjectPtr> objects_sorted_by_max_;
   std::vector<double> objects_sorted_by_min_bound_;
   std::vector<double> objects_sorted_by_max_bound_;
-  int depth_ = 0;
-
-  // Boundary
-  double min_x_ = 0.0;
-  double max_x_ = 0.0;
-  double min_y_ = 0.0;
-  double max_y_ = 0.0;
-  double mid_x_ = 0.0;
-  double mid_y_ = 0.0;
-
-  enum Partition {
-    PARTITION_X = 1,
-    PARTITION_Y = 2,
-  };
-  Partition partition_ = PARTITION_X;
-  double partition_position_ = 0.0;
-
-  std::unique_ptr<AABoxKDTree2dNode<ObjectType>> left_subnode_ = nullptr;
-  std::unique_ptr<AABoxKDTree2dNode<ObjectType>> right_subnode_ = nullptr;
-};
-
-/**
- * @class AABoxKDTree2d
- * @brief The class of KD-tree of Aligned Axis Bounding Box(AABox).
- */
-template <class ObjectType>
-class AABoxKDTree2d {
- public:
-  using ObjectPtr = const ObjectType *;
-
-  /**
-   * @brief Constructor which takes a vector of objects and parameters.
-   * @param params Parameters to build the KD-tree.
-   */
-  AABoxKDTree2d(const std::vector<ObjectType> &objects,
-                const AABoxKDTreeParams &params) {
-    if (!objects.empty()) {
-      std::vector<ObjectPtr> object_ptrs;
-      for (const auto &object : objects) {
-        object_ptrs.push_back(&object);
-      }
-      root_.reset(new AABoxKDTree2dNode<ObjectType>(object_ptrs, params, 0));
-    }
-  }
-
-  /**
-   * @brief Get the nearest object to a target point.
-   * @param point The target point. Search it's nearest object.
-   * @return The nearest object to the target point.
-   */
-  ObjectPtr GetNearestObject(const Vec2d &point) const {
-    return root_ == nullptr ? nullptr : root_->GetNearestObject(point);
-  }
-
-  /**
-   * @brief Get objects within a distance to a point.
-   * @param point The center point of the range to search objects.
-   * @param distance The radius of the range to search objects.
-   * @return All objects within the specified distance to the specified point.
-   */
-  std::vector<ObjectPtr> GetObjects(const Vec2d &point,
-                                    const double distance) const {
-    if (root_ == nullptr) {
-      return {};
-    }
-    return root_->GetObjects(point, distance);
-  }
-
-  /**
-   * @brief Get the axis-aligned bounding box of the objects.
-   * @return The axis-aligned bounding box of the objects.
-   */
-  AABox2d GetBoundingBox() const {
-    return root_ == nullptr ? AABox2d() : root_->GetBoundingBox();
-  }
-
- private:
-  std::unique_ptr<AABoxKDTree2dNode<ObjectType>> root_ = nullptr;
 };
 
 }  // namespace math
@@ -61,6 +61,15 @@ float tan(Angle8 a) {
   return tan(b);
 }
 
+void sin_cos(Angle16 a, float* sin_value, float* cos_value) {
+  *sin_value = sin(a);
+  *cos_value = sin(Angle16(static_cast<int16_t>(Angle16::RAW_PI_2 - a.raw())));
+}
+
+void sin_cos(Angle8 a, float* sin_value, float* cos_value) {
+  sin_cos(Angle16(static_cast<int16_t>(a.raw() << 8)), sin_value, cos_value);
+}
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
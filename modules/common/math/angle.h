@@ -276,6 +276,14 @@ float sin(Angle8 a);
 float cos(Angle8 a);
 float tan(Angle8 a);
 
+/**
+ * @brief Computes the sine and cosine of an angle together. Preferred over
+ * separate sin()/cos() calls when both values are needed, since the angle
+ * is normalized only once.
+ */
+void sin_cos(Angle16 a, float* sin_value, float* cos_value);
+void sin_cos(Angle8 a, float* sin_value, float* cos_value);
+
 }  // namespace math
 }  // namespace common
 }  // namespace apollo
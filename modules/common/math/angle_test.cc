@@ -47,6 +47,23 @@ TEST(Angle, Angle16) {
   EXPECT_NEAR(-0.5 * sqrt(3), cos(a), 1e-4);
 }
 
+TEST(Angle, SinCos) {
+  for (double deg = -360.0; deg <= 360.0; deg += 7.5) {
+    const auto a = Angle16::from_deg(deg);
+    float sin_value = 0.0f;
+    float cos_value = 0.0f;
+    sin_cos(a, &sin_value, &cos_value);
+    EXPECT_FLOAT_EQ(sin(a), sin_value);
+    EXPECT_FLOAT_EQ(cos(a), cos_value);
+  }
+  const auto b = Angle8::from_deg(90.0);
+  float sin_value = 0.0f;
+  float cos_value = 0.0f;
+  sin_cos(b, &sin_value, &cos_value);
+  EXPECT_FLOAT_EQ(1.0f, sin_value);
+  EXPECT_FLOAT_EQ(0.0f, cos_value);
+}
+
 TEST(Angle, Angle32) {
   auto a = Angle32::from_rad(1.0);
   EXPECT_NEAR(180 / M_PI, a.to_deg(), 1e-7);
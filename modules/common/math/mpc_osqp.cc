@@ -53,42 +53,30 @@ MpcOsqp::MpcOsqp(const Eigen::MatrixXd &matrix_a,
 void MpcOsqp::CalculateKernel(std::vector<c_float> *P_data,
                               std::vector<c_int> *P_indices,
                               std::vector<c_int> *P_indptr) {
-  // col1:(row,val),...; col2:(row,val),....; ...
-  std::vector<std::vector<std::pair<c_int, c_float>>> columns;
-  columns.resize(num_param_);
-  int value_index = 0;
-  // state and terminal state
+  // The kernel is diagonal: Q blocks for the states (incl. terminal one)
+  // followed by R blocks for the controls, one nonzero per column.
+  P_data->clear();
+  P_indices->clear();
+  P_indptr->clear();
+  c_int col = 0;
   for (size_t i = 0; i <= horizon_; ++i) {
     for (size_t j = 0; j < state_dim_; ++j) {
-      // (row, val)
-      columns[i * state_dim_ + j].emplace_back(i * state_dim_ + j,
-                                               matrix_q_(j, j));
-      ++value_index;
+      P_indptr->emplace_back(col);
+      P_data->emplace_back(matrix_q_(j, j));
+      P_indices->emplace_back(col);
+      ++col;
     }
   }
-  // control
-  const size_t state_total_dim = state_dim_ * (horizon_ + 1);
   for (size_t i = 0; i < horizon_; ++i) {
     for (size_t j = 0; j < control_dim_; ++j) {
-      // (row, val)
-      columns[i * control_dim_ + j + state_total_dim].emplace_back(
-          state_total_dim + i * control_dim_ + j, matrix_r_(j, j));
-      ++value_index;
+      P_indptr->emplace_back(col);
+      P_data->emplace_back(matrix_r_(j, j));
+      P_indices->emplace_back(col);
+      ++col;
     }
   }
-  CHECK_EQ(value_index, num_param_);
-
-  int ind_p = 0;
-  for (size_t i = 0; i < num_param_; ++i) {
-    // TODO(SHU) Check this
-    P_indptr->emplace_back(ind_p);
-    for (const auto &row_data_pair : columns[i]) {
-      P_data->emplace_back(row_data_pair.second);    // val
-      P_indices->emplace_back(row_data_pair.first);  // row
-      ++ind_p;
-    }
-  }
-  P_indptr->emplace_back(ind_p);
+  P_indptr->emplace_back(col);
+  CHECK_EQ(static_cast<size_t>(col), num_param_);
 }
 
 // reference is always zero
@@ -104,73 +92,53 @@ void MpcOsqp::CalculateGradient() {
   ADEBUG << gradient_;
 }
 
-// equality constraints x(k+1) = A*x(k)
+// equality constraints x(k+1) = A*x(k) stacked over the variable box
+// identity rows. Built column by column straight into CSC form; entries
+// are emitted structurally (full A/B blocks, zeros included) so the
+// sparsity pattern never changes between cycles.
 void MpcOsqp::CalculateEqualityConstraint(std::vector<c_float> *A_data,
                                           std::vector<c_int> *A_indices,
                                           std::vector<c_int> *A_indptr) {
-  static constexpr double kEpsilon = 1e-6;
-  // block matrix
-  Eigen::MatrixXd matrix_constraint = Eigen::MatrixXd::Zero(
-      state_dim_ * (horizon_ + 1) + state_dim_ * (horizon_ + 1) +
-          control_dim_ * horizon_,
-      state_dim_ * (horizon_ + 1) + control_dim_ * horizon_);
-  Eigen::MatrixXd state_identity_mat = Eigen::MatrixXd::Identity(
-      state_dim_ * (horizon_ + 1), state_dim_ * (horizon_ + 1));
-  ADEBUG << "state_identity_mat" << state_identity_mat;
-
-  matrix_constraint.block(0, 0, state_dim_ * (horizon_ + 1),
-                          state_dim_ * (horizon_ + 1)) =
-      -1 * state_identity_mat;
-  ADEBUG << "matrix_constraint";
-  ADEBUG << matrix_constraint;
-
-  Eigen::MatrixXd control_identity_mat =
-      Eigen::MatrixXd::Identity(control_dim_, control_dim_);
-
-  for (size_t i = 0; i < horizon_; i++) {
-    matrix_constraint.block((i + 1) * state_dim_, i * state_dim_, state_dim_,
-                            state_dim_) = matrix_a_;
-  }
-  ADEBUG << "matrix_constraint with A";
-  ADEBUG << matrix_constraint;
-
-  for (size_t i = 0; i < horizon_; i++) {
-    matrix_constraint.block((i + 1) * state_dim_,
-                            i * control_dim_ + (horizon_ + 1) * state_dim_,
-                            state_dim_, control_dim_) = matrix_b_;
-  }
-  ADEBUG << "matrix_constraint with B";
-  ADEBUG << matrix_constraint;
-
-  Eigen::MatrixXd all_identity_mat =
-      Eigen::MatrixXd::Identity(num_param_, num_param_);
-
-  matrix_constraint.block(state_dim_ * (horizon_ + 1), 0, num_param_,
-                          num_param_) = all_identity_mat;
-  ADEBUG << "matrix_constraint with I";
-  ADEBUG << matrix_constraint;
-
-  std::vector<std::vector<std::pair<c_int, c_float>>> columns;
-  columns.resize(num_param_ + 1);
-  int value_index = 0;
-  // state and terminal state
-  for (size_t i = 0; i < num_param_; ++i) {  // col
-    for (size_t j = 0; j < num_param_ + state_dim_ * (horizon_ + 1);
-         ++j)  // row
-      if (std::fabs(matrix_constraint(j, i)) > kEpsilon) {
-        // (row, val)
-        columns[i].emplace_back(j, matrix_constraint(j, i));
-        ++value_index;
+  A_data->clear();
+  A_indices->clear();
+  A_indptr->clear();
+  const size_t state_total_dim = state_dim_ * (horizon_ + 1);
+  c_int ind_A = 0;
+  // state columns
+  for (size_t i = 0; i <= horizon_; ++i) {
+    for (size_t j = 0; j < state_dim_; ++j) {
+      A_indptr->emplace_back(ind_A);
+      // -I from the dynamics constraint of step i
+      A_data->emplace_back(-1.0);
+      A_indices->emplace_back(i * state_dim_ + j);
+      ++ind_A;
+      if (i < horizon_) {
+        // the A block feeding step i+1
+        for (size_t r = 0; r < state_dim_; ++r) {
+          A_data->emplace_back(matrix_a_(r, j));
+          A_indices->emplace_back((i + 1) * state_dim_ + r);
+          ++ind_A;
+        }
       }
+      // identity row of the state box constraint
+      A_data->emplace_back(1.0);
+      A_indices->emplace_back(state_total_dim + i * state_dim_ + j);
+      ++ind_A;
+    }
   }
-  ADEBUG << "value_index";
-  ADEBUG << value_index;
-  int ind_A = 0;
-  for (size_t i = 0; i < num_param_; ++i) {
-    A_indptr->emplace_back(ind_A);
-    for (const auto &row_data_pair : columns[i]) {
-      A_data->emplace_back(row_data_pair.second);    // value
-      A_indices->emplace_back(row_data_pair.first);  // row
+  // control columns
+  for (size_t i = 0; i < horizon_; ++i) {
+    for (size_t j = 0; j < control_dim_; ++j) {
+      A_indptr->emplace_back(ind_A);
+      // the B block feeding step i+1
+      for (size_t r = 0; r < state_dim_; ++r) {
+        A_data->emplace_back(matrix_b_(r, j));
+        A_indices->emplace_back((i + 1) * state_dim_ + r);
+        ++ind_A;
+      }
+      // identity row of the control box constraint
+      A_data->emplace_back(1.0);
+      A_indices->emplace_back(2 * state_total_dim + i * control_dim_ + j);
       ++ind_A;
     }
   }
@@ -236,28 +204,15 @@ OSQPData *MpcOsqp::Data() {
       2 * state_dim_ * (horizon_ + 1) + control_dim_ * horizon_;
   data->n = kernel_dim;
   data->m = num_affine_constraint;
-  std::vector<c_float> P_data;
-  std::vector<c_int> P_indices;
-  std::vector<c_int> P_indptr;
-  ADEBUG << "before CalculateKernel";
-  CalculateKernel(&P_data, &P_indices, &P_indptr);
-  ADEBUG << "CalculateKernel done";
-  data->P = csc_matrix(kernel_dim, kernel_dim, P_data.size(), CopyData(P_data),
-                       CopyData(P_indices), CopyData(P_indptr));
-  ADEBUG << "Get P matrix";
+  // osqp_setup copies the problem, so the csc structs can just point at
+  // the member buffers.
+  CalculateKernel(&P_data_, &P_indices_, &P_indptr_);
+  data->P = csc_matrix(kernel_dim, kernel_dim, P_data_.size(), P_data_.data(),
+                       P_indices_.data(), P_indptr_.data());
   data->q = gradient_.data();
-  ADEBUG << "before CalculateEqualityConstraint";
-  std::vector<c_float> A_data;
-  std::vector<c_int> A_indices;
-  std::vector<c_int> A_indptr;
-  CalculateEqualityConstraint(&A_data, &A_indices, &A_indptr);
-  ADEBUG << "CalculateEqualityConstraint done";
-  data->A =
-      csc_matrix(state_dim_ * (horizon_ + 1) + state_dim_ * (horizon_ + 1) +
-                     control_dim_ * horizon_,
-                 kernel_dim, A_data.size(), CopyData(A_data),
-                 CopyData(A_indices), CopyData(A_indptr));
-  ADEBUG << "Get A matrix";
+  CalculateEqualityConstraint(&A_data_, &A_indices_, &A_indptr_);
+  data->A = csc_matrix(num_affine_constraint, kernel_dim, A_data_.size(),
+                       A_data_.data(), A_indices_.data(), A_indptr_.data());
   data->l = lowerBound_.data();
   data->u = upperBound_.data();
   return data;
@@ -269,62 +224,73 @@ void MpcOsqp::FreeData(OSQPData *data) {
   c_free(data);
 }
 
+MpcOsqp::~MpcOsqp() {
+  if (osqp_workspace_ != nullptr) {
+    osqp_cleanup(osqp_workspace_);
+  }
+  if (settings_ != nullptr) {
+    c_free(settings_);
+  }
+}
+
+bool MpcOsqp::UpdateAndSolve(const Eigen::MatrixXd &matrix_a,
+                             const Eigen::MatrixXd &matrix_q,
+                             const Eigen::MatrixXd &matrix_r,
+                             const Eigen::MatrixXd &matrix_initial_x,
+                             std::vector<double> *control_cmd) {
+  matrix_a_ = matrix_a;
+  matrix_q_ = matrix_q;
+  matrix_r_ = matrix_r;
+  matrix_initial_x_ = matrix_initial_x;
+  return Solve(control_cmd);
+}
+
 bool MpcOsqp::Solve(std::vector<double> *control_cmd) {
-  ADEBUG << "Before Calc Gradient";
   CalculateGradient();
-  ADEBUG << "After Calc Gradient";
   CalculateConstraintVectors();
-  ADEBUG << "MPC2Matrix";
 
-  OSQPData *data = Data();
-  ADEBUG << "OSQP data done";
-  ADEBUG << "OSQP data n" << data->n;
-  ADEBUG << "OSQP data m" << data->m;
-  for (int i = 0; i < data->n; ++i) {
-    ADEBUG << "OSQP data q" << i << ":" << (data->q)[i];
-  }
-  ADEBUG << "OSQP data l" << data->l;
-  for (int i = 0; i < data->m; ++i) {
-    ADEBUG << "OSQP data l" << i << ":" << (data->l)[i];
-  }
-  ADEBUG << "OSQP data u" << data->u;
-  for (int i = 0; i < data->m; ++i) {
-    ADEBUG << "OSQP data u" << i << ":" << (data->u)[i];
+  if (osqp_workspace_ == nullptr) {
+    OSQPData *data = Data();
+    settings_ = Settings();
+    osqp_workspace_ = osqp_setup(data, settings_);
+    // The workspace holds its own copy of the problem.
+    FreeData(data);
+    if (osqp_workspace_ == nullptr) {
+      AERROR << "OSQP workspace setup failed";
+      return false;
+    }
+  } else {
+    // Refresh the state-dependent values in place; the pattern is fixed,
+    // and the previous solution warm-starts the solve.
+    CalculateKernel(&P_data_, &P_indices_, &P_indptr_);
+    CalculateEqualityConstraint(&A_data_, &A_indices_, &A_indptr_);
+    osqp_update_P(osqp_workspace_, P_data_.data(), OSQP_NULL,
+                  static_cast<c_int>(P_data_.size()));
+    osqp_update_A(osqp_workspace_, A_data_.data(), OSQP_NULL,
+                  static_cast<c_int>(A_data_.size()));
+    osqp_update_lin_cost(osqp_workspace_, gradient_.data());
+    osqp_update_bounds(osqp_workspace_, lowerBound_.data(),
+                       upperBound_.data());
   }
 
-  OSQPSettings *settings = Settings();
-  ADEBUG << "OSQP setting done";
-  OSQPWorkspace *osqp_workspace = osqp_setup(data, settings);
-  ADEBUG << "OSQP workspace ready";
-  osqp_solve(osqp_workspace);
+  osqp_solve(osqp_workspace_);
 
-  auto status = osqp_workspace->info->status_val;
+  auto status = osqp_workspace_->info->status_val;
   ADEBUG << "status:" << status;
   // check status
   if (status < 0 || (status != 1 && status != 2)) {
-    AERROR << "failed optimization status:\t" << osqp_workspace->info->status;
-    osqp_cleanup(osqp_workspace);
-    FreeData(data);
-    c_free(settings);
+    AERROR << "failed optimization status:\t" << osqp_workspace_->info->status;
     return false;
-  } else if (osqp_workspace->solution == nullptr) {
+  } else if (osqp_workspace_->solution == nullptr) {
     AERROR << "The solution from OSQP is nullptr";
-    osqp_cleanup(osqp_workspace);
-    FreeData(data);
-    c_free(settings);
     return false;
   }
 
   size_t first_control = state_dim_ * (horizon_ + 1);
   for (size_t i = 0; i < control_dim_; ++i) {
-    control_cmd->at(i) = osqp_workspace->solution->x[i + first_control];
+    control_cmd->at(i) = osqp_workspace_->solution->x[i + first_control];
     ADEBUG << "control_cmd:" << i << ":" << control_cmd->at(i);
   }
-
-  // Cleanup
-  osqp_cleanup(osqp_workspace);
-  FreeData(data);
-  c_free(settings);
   return true;
 }
 
@@ -51,9 +51,22 @@ class MpcOsqp {
           const Eigen::MatrixXd &matrix_x_ref, const int max_iter,
           const int horizon, const double eps_abs);
 
+  ~MpcOsqp();
+
   // control vector
   bool Solve(std::vector<double> *control_cmd);
 
+  /**
+   * @brief Refresh the state-dependent terms (dynamics, weights and
+   * initial state) of a persistent solver and re-solve warm-started from
+   * the previous solution. The problem dimensions must not change.
+   */
+  bool UpdateAndSolve(const Eigen::MatrixXd &matrix_a,
+                      const Eigen::MatrixXd &matrix_q,
+                      const Eigen::MatrixXd &matrix_r,
+                      const Eigen::MatrixXd &matrix_initial_x,
+                      std::vector<double> *control_cmd);
+
  private:
   void CalculateKernel(std::vector<c_float> *P_data,
                        std::vector<c_int> *P_indices,
@@ -67,13 +80,6 @@ class MpcOsqp {
   OSQPData *Data();
   void FreeData(OSQPData *data);
 
-  template <typename T>
-  T *CopyData(const std::vector<T> &vec) {
-    T *data = new T[vec.size()];
-    memcpy(data, vec.data(), sizeof(T) * vec.size());
-    return data;
-  }
-
  private:
   Eigen::MatrixXd matrix_a_;
   Eigen::MatrixXd matrix_b_;
@@ -95,6 +101,22 @@ class MpcOsqp {
   Eigen::VectorXd gradient_;
   Eigen::VectorXd lowerBound_;
   Eigen::VectorXd upperBound_;
+
+  // Preallocated CSC buffers, refilled in place every cycle. The sparsity
+  // pattern is structural (it depends on the dimensions only), so the
+  // refreshed values always match the pattern the workspace was set up
+  // with.
+  std::vector<c_float> P_data_;
+  std::vector<c_int> P_indices_;
+  std::vector<c_int> P_indptr_;
+  std::vector<c_float> A_data_;
+  std::vector<c_int> A_indices_;
+  std::vector<c_int> A_indptr_;
+
+  // The workspace lives across control cycles; re-solves are served with
+  // osqp_update_* plus a warm start from the previous solution.
+  OSQPWorkspace *osqp_workspace_ = nullptr;
+  OSQPSettings *settings_ = nullptr;
 };
 }  // namespace math
 }  // namespace common
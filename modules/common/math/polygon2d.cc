@@ -150,7 +150,21 @@ bool Polygon2d::HasOverlap(const Polygon2d &polygon) const {
       polygon.max_y() < min_y() || polygon.min_y() > max_y()) {
     return false;
   }
-  return DistanceTo(polygon) <= kMathEpsilon;
+  // Two polygons overlap iff one contains a vertex of the other or some
+  // pair of edges intersects. Checking that directly only needs cross
+  // products, unlike the exact distance below which projects and takes a
+  // square root for every segment pair.
+  if (IsPointIn(polygon.points()[0]) || polygon.IsPointIn(points_[0])) {
+    return true;
+  }
+  for (int i = 0; i < num_points_; ++i) {
+    for (const auto &other_segment : polygon.line_segments()) {
+      if (line_segments_[i].HasIntersect(other_segment)) {
+        return true;
+      }
+    }
+  }
+  return false;
 }
 
 bool Polygon2d::Contains(const LineSegment2d &line_segment) const {
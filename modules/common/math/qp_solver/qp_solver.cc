@@ -36,6 +36,21 @@ QpSolver::QpSolver(const Eigen::MatrixXd& kernel_matrix,
       affine_equality_matrix_(affine_equality_matrix),
       affine_equality_boundary_(affine_equality_boundary) {}
 
+bool QpSolver::Update(const Eigen::MatrixXd& offset,
+                      const Eigen::MatrixXd& affine_inequality_boundary,
+                      const Eigen::MatrixXd& affine_equality_boundary) {
+  if (offset.rows() != offset_.rows() ||
+      affine_inequality_boundary.rows() !=
+          affine_inequality_boundary_.rows() ||
+      affine_equality_boundary.rows() != affine_equality_boundary_.rows()) {
+    return false;
+  }
+  offset_ = offset;
+  affine_inequality_boundary_ = affine_inequality_boundary;
+  affine_equality_boundary_ = affine_equality_boundary;
+  return true;
+}
+
 const Eigen::MatrixXd& QpSolver::params() const { return params_; }
 
 const Eigen::MatrixXd& QpSolver::kernel_matrix() const {
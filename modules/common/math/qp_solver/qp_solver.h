@@ -47,6 +47,17 @@ class QpSolver {
   virtual void SetTerminationTolerance(const double) {}
   virtual bool Solve() = 0;
 
+  /**
+   * @brief update the varying part of the problem (gradient offset and
+   * constraint boundaries) while keeping the constraint structure, so that
+   * warm-startable solvers can reuse the previous cycle's active set on the
+   * next Solve() instead of refactorizing from scratch
+   * @return false if the new boundaries do not match the problem dimensions
+   */
+  virtual bool Update(const Eigen::MatrixXd& offset,
+                      const Eigen::MatrixXd& affine_inequality_boundary,
+                      const Eigen::MatrixXd& affine_equality_boundary);
+
   const Eigen::MatrixXd& params() const;
   const Eigen::MatrixXd& kernel_matrix() const;
   const Eigen::MatrixXd& offset() const;
@@ -0,0 +1,239 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file: sparse_active_set_qp_solver.cc
+ **/
+#include "modules/common/math/qp_solver/sparse_active_set_qp_solver.h"
+
+#include <algorithm>
+
+#include "cyber/common/log.h"
+#include "modules/common/math/qp_solver/qp_solver_gflags.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+namespace {
+
+// @brief append the nonzeros of one dense column slice as compressed sparse
+// column entries, offsetting the stored row indices by row_offset
+void AppendSparseColumn(const Eigen::MatrixXd& dense, const int col,
+                        const int row_offset,
+                        std::vector<::qpOASES::real_t>* values,
+                        std::vector<::qpOASES::sparse_int_t>* row_indices) {
+  for (int r = 0; r < dense.rows(); ++r) {
+    const double value = dense(r, col);
+    if (value != 0.0) {
+      values->push_back(value);
+      row_indices->push_back(r + row_offset);
+    }
+  }
+}
+
+}  // namespace
+
+SparseActiveSetQpSolver::SparseActiveSetQpSolver(
+    const Eigen::MatrixXd& kernel_matrix, const Eigen::MatrixXd& offset,
+    const Eigen::MatrixXd& affine_inequality_matrix,
+    const Eigen::MatrixXd& affine_inequality_boundary,
+    const Eigen::MatrixXd& affine_equality_matrix,
+    const Eigen::MatrixXd& affine_equality_boundary)
+    : QpSolver(kernel_matrix, offset, affine_inequality_matrix,
+               affine_inequality_boundary, affine_equality_matrix,
+               affine_equality_boundary),
+      num_constraint_(static_cast<int>(affine_equality_matrix_.rows() +
+                                       affine_inequality_matrix_.rows())),
+      num_param_(static_cast<int>(kernel_matrix.rows())) {}
+
+void SparseActiveSetQpSolver::BuildSparseHessian() {
+  hessian_values_.clear();
+  hessian_row_indices_.clear();
+  hessian_col_starts_.clear();
+  hessian_col_starts_.push_back(0);
+  for (int c = 0; c < kernel_matrix_.cols(); ++c) {
+    AppendSparseColumn(kernel_matrix_, c, 0, &hessian_values_,
+                       &hessian_row_indices_);
+    hessian_col_starts_.push_back(
+        static_cast<::qpOASES::sparse_int_t>(hessian_values_.size()));
+  }
+  hessian_.reset(new ::qpOASES::SymSparseMat(
+      num_param_, num_param_, hessian_row_indices_.data(),
+      hessian_col_starts_.data(), hessian_values_.data()));
+  hessian_->createDiagInfo();
+}
+
+void SparseActiveSetQpSolver::BuildSparseConstraintMatrix() {
+  constraint_values_.clear();
+  constraint_row_indices_.clear();
+  constraint_col_starts_.clear();
+  constraint_col_starts_.push_back(0);
+  const int num_equality = static_cast<int>(affine_equality_matrix_.rows());
+  for (int c = 0; c < num_param_; ++c) {
+    // equality rows are stacked above the inequality rows, matching the
+    // boundary vector layout in Solve()
+    if (num_equality > 0) {
+      AppendSparseColumn(affine_equality_matrix_, c, 0, &constraint_values_,
+                         &constraint_row_indices_);
+    }
+    if (affine_inequality_matrix_.rows() > 0) {
+      AppendSparseColumn(affine_inequality_matrix_, c, num_equality,
+                         &constraint_values_, &constraint_row_indices_);
+    }
+    constraint_col_starts_.push_back(
+        static_cast<::qpOASES::sparse_int_t>(constraint_values_.size()));
+  }
+  constraint_matrix_.reset(new ::qpOASES::SparseMatrix(
+      num_constraint_, num_param_, constraint_row_indices_.data(),
+      constraint_col_starts_.data(), constraint_values_.data()));
+}
+
+bool SparseActiveSetQpSolver::Solve() {
+  if (!sanity_check()) {
+    AERROR << "Sanity check failed for SparseActiveSetQpSolver";
+    return false;
+  }
+
+  std::vector<::qpOASES::real_t> g_matrix(num_param_);
+  for (int i = 0; i < num_param_; ++i) {
+    g_matrix[i] = offset_(i, 0);
+  }
+
+  // search space lower bound and upper bound
+  std::vector<::qpOASES::real_t> lower_bound(num_param_, l_lower_bound_);
+  std::vector<::qpOASES::real_t> upper_bound(num_param_, l_upper_bound_);
+
+  std::vector<::qpOASES::real_t> constraint_lower_bound(num_constraint_);
+  std::vector<::qpOASES::real_t> constraint_upper_bound(num_constraint_);
+  const int num_equality = static_cast<int>(affine_equality_boundary_.rows());
+  for (int r = 0; r < num_equality; ++r) {
+    constraint_lower_bound[r] = affine_equality_boundary_(r, 0);
+    constraint_upper_bound[r] = affine_equality_boundary_(r, 0);
+  }
+  for (int r = 0; r < affine_inequality_boundary_.rows(); ++r) {
+    constraint_lower_bound[r + num_equality] =
+        affine_inequality_boundary_(r, 0);
+    constraint_upper_bound[r + num_equality] = constraint_upper_bound_;
+  }
+
+  ::qpOASES::int_t max_iter = std::max(max_iteration_, num_constraint_);
+  ::qpOASES::returnValue ret;
+  if (!last_solve_success_ || sqp_problem_ == nullptr) {
+    // cold start: build the sparse matrices and factorize from scratch
+    sqp_problem_.reset(new ::qpOASES::SQProblem(num_param_, num_constraint_,
+                                                hessian_type_));
+    ::qpOASES::Options my_options;
+    my_options.enableCholeskyRefactorisation = cholesky_refactorisation_freq_;
+    if (hessian_type_ == ::qpOASES::HST_POSDEF ||
+        hessian_type_ == ::qpOASES::HST_SEMIDEF) {
+      my_options.enableRegularisation = ::qpOASES::BT_TRUE;
+    }
+    my_options.epsNum = FLAGS_default_active_set_eps_num;
+    my_options.epsDen = FLAGS_default_active_set_eps_den;
+    my_options.epsIterRef = FLAGS_default_active_set_eps_iter_ref;
+    my_options.terminationTolerance = termination_tolerance_;
+    sqp_problem_->setOptions(my_options);
+    if (!FLAGS_default_enable_active_set_debug_info) {
+      sqp_problem_->setPrintLevel(qpOASES::PL_NONE);
+    }
+    BuildSparseHessian();
+    BuildSparseConstraintMatrix();
+    ret = sqp_problem_->init(hessian_.get(), g_matrix.data(),
+                             constraint_matrix_.get(), lower_bound.data(),
+                             upper_bound.data(), constraint_lower_bound.data(),
+                             constraint_upper_bound.data(), max_iter);
+  } else {
+    // only the gradient or the boundaries changed since the last successful
+    // solve (see QpSolver::Update), so hot start from the previous active
+    // set; qpOASES applies incremental factorization updates per bound flip
+    // instead of refactorizing the KKT system
+    ret = sqp_problem_->hotstart(
+        g_matrix.data(), lower_bound.data(), upper_bound.data(),
+        constraint_lower_bound.data(), constraint_upper_bound.data(),
+        max_iter);
+  }
+
+  if (ret != qpOASES::SUCCESSFUL_RETURN) {
+    if (ret == qpOASES::RET_MAX_NWSR_REACHED) {
+      AERROR << "qpOASES solver failed due to reached max iteration";
+    } else {
+      AERROR << "qpOASES solver failed due to infeasibility or other internal "
+                "reasons";
+    }
+    // drop the stale problem so the next cycle cold starts
+    last_solve_success_ = false;
+    sqp_problem_.reset();
+    return false;
+  }
+
+  std::vector<::qpOASES::real_t> result(num_param_);
+  sqp_problem_->getPrimalSolution(result.data());
+
+  params_ = Eigen::MatrixXd::Zero(num_param_, 1);
+  for (int i = 0; i < num_param_; ++i) {
+    params_(i, 0) = result[i];
+  }
+  last_solve_success_ = sqp_problem_->isSolved() == qpOASES::BT_TRUE;
+  return last_solve_success_;
+}
+
+void SparseActiveSetQpSolver::set_max_iteration(const int max_iter) {
+  max_iteration_ = max_iter;
+}
+
+int SparseActiveSetQpSolver::max_iteration() const { return max_iteration_; }
+
+void SparseActiveSetQpSolver::set_l_lower_bound(const double l_lower_bound) {
+  l_lower_bound_ = l_lower_bound;
+}
+
+void SparseActiveSetQpSolver::set_l_upper_bound(const double l_upper_bound) {
+  l_upper_bound_ = l_upper_bound;
+}
+
+void SparseActiveSetQpSolver::set_constraint_upper_bound(
+    const double la_upper_bound) {
+  constraint_upper_bound_ = la_upper_bound;
+}
+
+double SparseActiveSetQpSolver::l_lower_bound() const {
+  return l_lower_bound_;
+}
+
+double SparseActiveSetQpSolver::l_upper_bound() const {
+  return l_upper_bound_;
+}
+
+double SparseActiveSetQpSolver::constraint_upper_bound() const {
+  return constraint_upper_bound_;
+}
+
+bool SparseActiveSetQpSolver::sanity_check() {
+  // empty constraint blocks are allowed; only present blocks must agree
+  // with the kernel dimension
+  return kernel_matrix_.rows() == kernel_matrix_.cols() &&
+         (affine_inequality_matrix_.rows() == 0 ||
+          kernel_matrix_.rows() == affine_inequality_matrix_.cols()) &&
+         (affine_equality_matrix_.rows() == 0 ||
+          kernel_matrix_.rows() == affine_equality_matrix_.cols()) &&
+         affine_equality_matrix_.rows() == affine_equality_boundary_.rows() &&
+         affine_inequality_matrix_.rows() == affine_inequality_boundary_.rows();
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
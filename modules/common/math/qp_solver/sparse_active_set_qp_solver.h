@@ -0,0 +1,120 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file: sparse_active_set_qp_solver.h
+ * @brief: warm-startable wrapper class for the active set method in qpOASES
+ * using sparse matrix storage. The first Solve() performs a cold start; when
+ * Update() only changed the gradient or the constraint boundaries, later
+ * Solve() calls hot start from the previous active set through the
+ * vector-only qpOASES path, which applies cheap factorization updates
+ * instead of a full dense KKT refactorization.
+ **/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "qpOASES.hpp"
+
+#include "modules/common/math/qp_solver/qp_solver.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+class SparseActiveSetQpSolver : public QpSolver {
+ public:
+  SparseActiveSetQpSolver(const Eigen::MatrixXd& kernel_matrix,
+                          const Eigen::MatrixXd& offset,
+                          const Eigen::MatrixXd& affine_inequality_matrix,
+                          const Eigen::MatrixXd& affine_inequality_boundary,
+                          const Eigen::MatrixXd& affine_equality_matrix,
+                          const Eigen::MatrixXd& affine_equality_boundary);
+  virtual ~SparseActiveSetQpSolver() = default;
+
+  bool Solve() override;
+
+  void set_max_iteration(const int max_iter);
+  int max_iteration() const;
+
+  void set_l_lower_bound(const double l_lower_bound);
+  void set_l_upper_bound(const double l_upper_bound);
+  void set_constraint_upper_bound(const double la_upper_bound);
+
+  double l_lower_bound() const;
+  double l_upper_bound() const;
+  double constraint_upper_bound() const;
+
+  void set_pos_semi_definite_hessian() override {
+    hessian_type_ = ::qpOASES::HST_SEMIDEF;
+  }
+  void set_pos_definite_hessian() override {
+    hessian_type_ = ::qpOASES::HST_POSDEF;
+  }
+
+  void EnableCholeskyRefactorisation(const int num) override {
+    cholesky_refactorisation_freq_ = num;
+  }
+
+  void SetTerminationTolerance(const double tolerance) override {
+    termination_tolerance_ = tolerance;
+  }
+
+ private:
+  bool sanity_check() override;
+
+  // @brief build the compressed sparse column storage qpOASES expects from
+  // the dense Eigen kernel and the stacked equality/inequality constraints
+  void BuildSparseHessian();
+  void BuildSparseConstraintMatrix();
+
+ private:
+  // equality constraint + inequality constraint
+  int num_constraint_ = 0;
+  // number of parameters
+  int num_param_ = 0;
+
+  // parameter search bound
+  double l_lower_bound_ = -1e10;
+  double l_upper_bound_ = 1e10;
+
+  // constraint search upper bound
+  double constraint_upper_bound_ = 1e10;
+  int max_iteration_ = 1000;
+
+  ::qpOASES::HessianType hessian_type_ = ::qpOASES::HST_UNKNOWN;
+  int cholesky_refactorisation_freq_ = 0;
+  double termination_tolerance_ = 1.0e-9;
+
+  // persistent problem instance and sparse storage, kept across Solve()
+  // calls so a successful solve seeds the next one with its active set
+  std::unique_ptr<::qpOASES::SQProblem> sqp_problem_;
+  std::unique_ptr<::qpOASES::SymSparseMat> hessian_;
+  std::unique_ptr<::qpOASES::SparseMatrix> constraint_matrix_;
+  std::vector<::qpOASES::real_t> hessian_values_;
+  std::vector<::qpOASES::sparse_int_t> hessian_row_indices_;
+  std::vector<::qpOASES::sparse_int_t> hessian_col_starts_;
+  std::vector<::qpOASES::real_t> constraint_values_;
+  std::vector<::qpOASES::sparse_int_t> constraint_row_indices_;
+  std::vector<::qpOASES::sparse_int_t> constraint_col_starts_;
+  bool last_solve_success_ = false;
+};
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
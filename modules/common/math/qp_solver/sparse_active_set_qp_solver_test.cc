@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+#include "modules/common/math/qp_solver/sparse_active_set_qp_solver.h"
+
+#include "glog/logging.h"
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace common {
+namespace math {
+
+using Eigen::MatrixXd;
+
+TEST(SparseActiveSetQpSolver, simple_problem_01) {
+  MatrixXd kernel_matrix = MatrixXd::Zero(1, 1);
+  kernel_matrix(0, 0) = 1.0;
+  MatrixXd offset = MatrixXd::Zero(1, 1);
+  offset(0, 0) = -8.0;
+  MatrixXd affine_inequality_matrix;
+  MatrixXd affine_inequality_boundary;
+  MatrixXd affine_equality_matrix;
+  MatrixXd affine_equality_boundary;
+  SparseActiveSetQpSolver solver(
+      kernel_matrix, offset, affine_inequality_matrix,
+      affine_inequality_boundary, affine_equality_matrix,
+      affine_equality_boundary);
+  EXPECT_TRUE(solver.Solve());
+  EXPECT_NEAR(solver.params()(0, 0), 8.0, 1e-9);
+}
+
+TEST(SparseActiveSetQpSolver, warm_start_updated_offset) {
+  MatrixXd kernel_matrix = MatrixXd::Identity(2, 2);
+  MatrixXd offset = MatrixXd::Zero(2, 1);
+  offset(0, 0) = -2.0;
+  offset(1, 0) = -4.0;
+  // x0 + x1 >= 1
+  MatrixXd affine_inequality_matrix = MatrixXd::Ones(1, 2);
+  MatrixXd affine_inequality_boundary = MatrixXd::Ones(1, 1);
+  MatrixXd affine_equality_matrix;
+  MatrixXd affine_equality_boundary;
+  SparseActiveSetQpSolver solver(
+      kernel_matrix, offset, affine_inequality_matrix,
+      affine_inequality_boundary, affine_equality_matrix,
+      affine_equality_boundary);
+  EXPECT_TRUE(solver.Solve());
+  EXPECT_NEAR(solver.params()(0, 0), 2.0, 1e-9);
+  EXPECT_NEAR(solver.params()(1, 0), 4.0, 1e-9);
+
+  // the second cycle only moves the gradient, so Solve() hot starts from
+  // the previous active set
+  MatrixXd new_offset = MatrixXd::Zero(2, 1);
+  new_offset(0, 0) = -6.0;
+  new_offset(1, 0) = -2.0;
+  EXPECT_TRUE(solver.Update(new_offset, affine_inequality_boundary,
+                            affine_equality_boundary));
+  EXPECT_TRUE(solver.Solve());
+  EXPECT_NEAR(solver.params()(0, 0), 6.0, 1e-9);
+  EXPECT_NEAR(solver.params()(1, 0), 2.0, 1e-9);
+
+  // mismatched boundary dimensions are rejected
+  EXPECT_FALSE(solver.Update(new_offset, MatrixXd::Ones(2, 1),
+                             affine_equality_boundary));
+}
+
+}  // namespace math
+}  // namespace common
+}  // namespace apollo
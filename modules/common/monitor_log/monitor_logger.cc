@@ -15,7 +15,9 @@
  *****************************************************************************/
 #include "modules/common/monitor_log/monitor_logger.h"
 
+#include <chrono>
 #include <memory>
+#include <utility>
 
 #include "absl/strings/str_cat.h"
 
@@ -23,6 +25,15 @@ namespace apollo {
 namespace common {
 namespace monitor {
 
+namespace {
+
+// Capacity of the staging queue. A fault storm beyond this drops events
+// (counted and reported) instead of blocking the reporting module.
+constexpr uint64_t kQueueSize = 1024;
+constexpr int kFlushIntervalMs = 100;
+
+}  // namespace
+
 MonitorLogger::MonitorLogger() {
   const std::string node_name =
       absl::StrCat("monitor_logger", cyber::Time::Now().ToNanosecond());
@@ -31,25 +42,129 @@ MonitorLogger::MonitorLogger() {
     monitor_msg_writer_ =
         node_->CreateWriter<MonitorMessage>("/apollo/monitor");
   }
+  if (!queue_.Init(kQueueSize)) {
+    AERROR << "Failed to init monitor message queue, publishing will be "
+              "synchronous.";
+    return;
+  }
+  running_.store(true);
+  flush_thread_ = std::thread(&MonitorLogger::FlushLoop, this);
+}
+
+MonitorLogger::~MonitorLogger() {
+  running_.store(false);
+  if (flush_thread_.joinable()) {
+    flush_thread_.join();
+  }
+  FlushQueue();
 }
 
 void MonitorLogger::Publish(const MonitorMessageItem::MessageSource &source,
                             const std::vector<MessageItem> &messages) const {
-  // compose a monitor message
   if (messages.empty()) {
     return;
   }
-  MonitorMessage monitor_msg;
 
+  if (!running_.load()) {
+    // No flusher available: compose and publish on the caller's thread.
+    MonitorMessage monitor_msg;
+    for (const auto &msg_item : messages) {
+      MonitorMessageItem *monitor_msg_item = monitor_msg.add_item();
+      monitor_msg_item->set_source(source);
+      monitor_msg_item->set_log_level(msg_item.first);
+      monitor_msg_item->set_msg(msg_item.second);
+    }
+    DoPublish(&monitor_msg);
+    return;
+  }
+
+  // Stage the items for the flusher; never block the reporting thread.
   for (const auto &msg_item : messages) {
-    MonitorMessageItem *monitor_msg_item = monitor_msg.add_item();
-    monitor_msg_item->set_source(source);
-    monitor_msg_item->set_log_level(msg_item.first);
-    monitor_msg_item->set_msg(msg_item.second);
+    QueuedItem item;
+    item.source = source;
+    item.log_level = msg_item.first;
+    item.msg = msg_item.second;
+    if (!queue_.Enqueue(std::move(item))) {
+      dropped_count_.fetch_add(1, std::memory_order_relaxed);
+    }
   }
+}
 
-  // publish monitor messages
-  DoPublish(&monitor_msg);
+void MonitorLogger::FlushLoop() {
+  while (running_.load()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(kFlushIntervalMs));
+    FlushQueue();
+  }
+}
+
+void MonitorLogger::FlushQueue() {
+  std::vector<QueuedItem> items;
+  QueuedItem queued;
+  while (queue_.Dequeue(&queued)) {
+    items.push_back(std::move(queued));
+  }
+  const uint64_t dropped = dropped_count_.exchange(0);
+  if (items.empty() && dropped == 0) {
+    return;
+  }
+
+  // Coalesce identical repeats within this flush window, keeping the
+  // first-seen order. Batches are small, so linear scans are fine.
+  std::vector<std::pair<QueuedItem, int>> coalesced;
+  for (auto &item : items) {
+    bool merged = false;
+    for (auto &entry : coalesced) {
+      if (entry.first.source == item.source &&
+          entry.first.log_level == item.log_level &&
+          entry.first.msg == item.msg) {
+        ++entry.second;
+        merged = true;
+        break;
+      }
+    }
+    if (!merged) {
+      coalesced.emplace_back(std::move(item), 1);
+    }
+  }
+
+  // Compose one message per source, again in first-seen order.
+  std::vector<std::pair<MonitorMessageItem::MessageSource, MonitorMessage>>
+      per_source;
+  const auto message_of = [&per_source](
+                              const MonitorMessageItem::MessageSource &source)
+      -> MonitorMessage * {
+    for (auto &source_msg : per_source) {
+      if (source_msg.first == source) {
+        return &source_msg.second;
+      }
+    }
+    per_source.emplace_back(source, MonitorMessage());
+    return &per_source.back().second;
+  };
+  for (const auto &entry : coalesced) {
+    MonitorMessageItem *monitor_msg_item =
+        message_of(entry.first.source)->add_item();
+    monitor_msg_item->set_source(entry.first.source);
+    monitor_msg_item->set_log_level(entry.first.log_level);
+    if (entry.second > 1) {
+      monitor_msg_item->set_msg(
+          absl::StrCat(entry.first.msg, " (", entry.second, " times)"));
+    } else {
+      monitor_msg_item->set_msg(entry.first.msg);
+    }
+  }
+  if (dropped > 0) {
+    MonitorMessageItem *monitor_msg_item =
+        message_of(MonitorMessageItem::MONITOR)->add_item();
+    monitor_msg_item->set_source(MonitorMessageItem::MONITOR);
+    monitor_msg_item->set_log_level(MonitorMessageItem::WARN);
+    monitor_msg_item->set_msg(
+        absl::StrCat("Monitor queue overflow: ", dropped, " events dropped"));
+  }
+
+  for (auto &source_msg : per_source) {
+    DoPublish(&source_msg.second);
+  }
 }
 
 void MonitorLogger::DoPublish(MonitorMessage *message) const {
@@ -21,11 +21,14 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "cyber/base/bounded_queue.h"
 #include "cyber/cyber.h"
 #include "modules/common/monitor_log/proto/monitor_log.pb.h"
 #include "modules/common/util/message_util.h"
@@ -50,22 +53,47 @@ using MessageItem = std::pair<MonitorMessageItem::LogLevel, std::string>;
  */
 class MonitorLogger {
  public:
-  virtual ~MonitorLogger() = default;
+  virtual ~MonitorLogger();
 
   /**
    * @brief Publish the messages.
+   *
+   * The messages are staged into a lock-free queue and written to the
+   * monitor topic by a background flusher, so reporting a fault never
+   * blocks the reporting module's thread. Identical items repeated within
+   * one flush interval are collapsed into a single item with a count.
    * @param messages a list of messages for
    */
   virtual void Publish(const MonitorMessageItem::MessageSource &source,
                        const std::vector<MessageItem> &messages) const;
 
  private:
+  // A monitor event staged by a module thread, waiting for the flusher.
+  struct QueuedItem {
+    MonitorMessageItem::MessageSource source = MonitorMessageItem::MONITOR;
+    MonitorMessageItem::LogLevel log_level = MonitorMessageItem::INFO;
+    std::string msg;
+  };
+
   virtual void DoPublish(MonitorMessage *message) const;
 
+  // Drains the queue periodically until running_ is cleared.
+  void FlushLoop();
+  // Drains and publishes whatever is queued, coalescing duplicates.
+  void FlushQueue();
+
   MonitorMessageItem::MessageSource source_;
   std::unique_ptr<cyber::Node> node_;
   std::shared_ptr<cyber::Writer<MonitorMessage>> monitor_msg_writer_;
 
+  // Staging queue between module threads and the flusher. Enqueue failures
+  // (queue full during a fault storm) are counted and reported by the next
+  // successful flush instead of blocking the caller.
+  mutable cyber::base::BoundedQueue<QueuedItem> queue_;
+  mutable std::atomic<uint64_t> dropped_count_{0};
+  std::atomic<bool> running_{false};
+  std::thread flush_thread_;
+
   DECLARE_SINGLETON(MonitorLogger)
 };
 
@@ -155,13 +155,14 @@ class LRUCache {
   bool Contains(const K& key) { return map_.find(key) != map_.end(); }
 
   bool Prioritize(const K& key) {
-    if (Contains(key)) {
-      auto* node = &map_[key];
-      Detach(node);
-      Attach(node);
-      return true;
+    auto iter = map_.find(key);
+    if (iter == map_.end()) {
+      return false;
     }
-    return false;
+    auto* node = &iter->second;
+    Detach(node);
+    Attach(node);
+    return true;
   }
 
   void Clear() {
@@ -214,11 +215,12 @@ class LRUCache {
     if (obs == nullptr) {
       return false;
     }
-    if (Contains(key)) {
+    auto iter = map_.find(key);
+    if (iter != map_.end()) {
       if (!add_only) {
-        map_[key].val = std::forward<VV>(val);
+        auto* node = &iter->second;
+        node->val = std::forward<VV>(val);
         if (!silent_update) {
-          auto* node = &map_[key];
           Detach(node);
           Attach(node);
         } else {
@@ -230,35 +232,38 @@ class LRUCache {
         return false;
       }
 
-      map_.emplace(key, Node<K, V>(key, std::forward<VV>(val)));
-      Attach(&map_[key]);
+      auto emplaced =
+          map_.emplace(key, Node<K, V>(key, std::forward<VV>(val)));
+      Attach(&emplaced.first->second);
     }
     return true;
   }
 
   V* Get(const K& key, bool silent) {
-    if (Contains(key)) {
-      auto* node = &map_[key];
-      if (!silent) {
-        Detach(node);
-        Attach(node);
-      }
-      return &node->val;
+    auto iter = map_.find(key);
+    if (iter == map_.end()) {
+      return nullptr;
     }
-    return nullptr;
+    auto* node = &iter->second;
+    if (!silent) {
+      Detach(node);
+      Attach(node);
+    }
+    return &node->val;
   }
 
   bool GetCopy(const K& key, V* const val, bool silent) {
-    if (Contains(key)) {
-      auto* node = &map_[key];
-      if (!silent) {
-        Detach(node);
-        Attach(node);
-      }
-      *val = node->val;
-      return true;
+    auto iter = map_.find(key);
+    if (iter == map_.end()) {
+      return false;
     }
-    return false;
+    auto* node = &iter->second;
+    if (!silent) {
+      Detach(node);
+      Attach(node);
+    }
+    *val = node->val;
+    return true;
   }
 
   bool GetObsolete(K* key) {
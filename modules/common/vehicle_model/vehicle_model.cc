@@ -16,6 +16,8 @@
 
 #include "modules/common/vehicle_model/vehicle_model.h"
 
+#include <cmath>
+
 #include "cyber/common/file.h"
 #include "modules/common/configs/config_gflags.h"
 
@@ -80,6 +82,70 @@ void VehicleModel::RearCenteredKinematicBicycleModel(
       cur_vehicle_state.linear_acceleration());
 }
 
+void VehicleModel::RearCenteredKinematicBicycleModelBatch(
+    const VehicleModelConfig& vehicle_model_config,
+    const double predicted_time_horizon,
+    const std::vector<VehicleState>& cur_vehicle_states,
+    std::vector<VehicleState>* predicted_vehicle_states) {
+  // Same Euler forward discretization as the scalar model above, but with
+  // the candidates laid out in structure-of-arrays form: the dt schedule is
+  // shared by the whole batch, so each time step is one contiguous,
+  // branch-free sweep over all candidates
+  CHECK_GT(predicted_time_horizon, 0.0);
+  double dt = vehicle_model_config.rc_kinematic_bicycle_model().dt();
+  if (dt >= predicted_time_horizon) {
+    dt = predicted_time_horizon;
+  }
+
+  const size_t num_states = cur_vehicle_states.size();
+  std::vector<double> x(num_states);
+  std::vector<double> y(num_states);
+  std::vector<double> phi(num_states);
+  std::vector<double> v(num_states);
+  std::vector<double> a(num_states);
+  std::vector<double> kappa(num_states);
+  for (size_t i = 0; i < num_states; ++i) {
+    const VehicleState& state = cur_vehicle_states[i];
+    x[i] = state.x();
+    y[i] = state.y();
+    phi[i] = state.heading();
+    v[i] = state.linear_velocity();
+    a[i] = state.linear_acceleration();
+    kappa[i] = state.kappa();
+  }
+
+  double countdown_time = predicted_time_horizon;
+  bool finish_flag = false;
+  static constexpr double kepsilon = 1e-8;
+  while (countdown_time > kepsilon && !finish_flag) {
+    countdown_time -= dt;
+    if (countdown_time < kepsilon) {
+      dt = countdown_time + dt;
+      finish_flag = true;
+    }
+    for (size_t i = 0; i < num_states; ++i) {
+      const double ds = dt * (v[i] + 0.5 * dt * a[i]);
+      const double intermidiate_phi = phi[i] + 0.5 * dt * v[i] * kappa[i];
+      x[i] += ds * std::cos(intermidiate_phi);
+      y[i] += ds * std::sin(intermidiate_phi);
+      phi[i] += ds * kappa[i];
+      v[i] += dt * a[i];
+    }
+  }
+
+  predicted_vehicle_states->resize(num_states);
+  for (size_t i = 0; i < num_states; ++i) {
+    VehicleState* predicted_state = &(*predicted_vehicle_states)[i];
+    predicted_state->set_x(x[i]);
+    predicted_state->set_y(y[i]);
+    predicted_state->set_z(cur_vehicle_states[i].z());
+    predicted_state->set_heading(phi[i]);
+    predicted_state->set_kappa(kappa[i]);
+    predicted_state->set_linear_velocity(v[i]);
+    predicted_state->set_linear_acceleration(a[i]);
+  }
+}
+
 VehicleState VehicleModel::Predict(const double predicted_time_horizon,
                                    const VehicleState& cur_vehicle_state) {
   VehicleModelConfig vehicle_model_config;
@@ -105,5 +171,32 @@ VehicleState VehicleModel::Predict(const double predicted_time_horizon,
   return predicted_vehicle_state;
 }
 
+std::vector<VehicleState> VehicleModel::PredictBatch(
+    const double predicted_time_horizon,
+    const std::vector<VehicleState>& cur_vehicle_states) {
+  // Load the model config once for the whole batch instead of per candidate
+  VehicleModelConfig vehicle_model_config;
+
+  CHECK(cyber::common::GetProtoFromFile(FLAGS_vehicle_model_config_filename,
+                                        &vehicle_model_config))
+      << "Failed to load vehicle model config file "
+      << FLAGS_vehicle_model_config_filename;
+
+  // Some models not supported for now
+  CHECK(vehicle_model_config.model_type() !=
+        VehicleModelConfig::COM_CENTERED_DYNAMIC_BICYCLE_MODEL);
+  CHECK(vehicle_model_config.model_type() != VehicleModelConfig::MLP_MODEL);
+
+  std::vector<VehicleState> predicted_vehicle_states;
+  if (vehicle_model_config.model_type() ==
+      VehicleModelConfig::REAR_CENTERED_KINEMATIC_BICYCLE_MODEL) {
+    RearCenteredKinematicBicycleModelBatch(
+        vehicle_model_config, predicted_time_horizon, cur_vehicle_states,
+        &predicted_vehicle_states);
+  }
+
+  return predicted_vehicle_states;
+}
+
 }  // namespace common
 }  // namespace apollo
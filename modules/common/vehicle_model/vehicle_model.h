@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "modules/common/configs/vehicle_config_helper.h"
 #include "modules/common/vehicle_model/proto/vehicle_model_config.pb.h"
 #include "modules/common/vehicle_state/proto/vehicle_state.pb.h"
@@ -30,12 +32,29 @@ class VehicleModel {
   static VehicleState Predict(const double predicted_time_horizon,
                               const VehicleState& cur_vehicle_state);
 
+  /**
+   * @brief Propagate a batch of candidate states over the same horizon. The
+   * model config is loaded once for the whole batch and the candidates are
+   * integrated in structure-of-arrays form, so the inner sweep over
+   * candidates stays contiguous and vectorizable instead of stepping one
+   * state at a time.
+   */
+  static std::vector<VehicleState> PredictBatch(
+      const double predicted_time_horizon,
+      const std::vector<VehicleState>& cur_vehicle_states);
+
  private:
   static void RearCenteredKinematicBicycleModel(
       const VehicleModelConfig& vehicle_model_config,
       const double predicted_time_horizon,
       const VehicleState& cur_vehicle_state,
       VehicleState* predicted_vehicle_state);
+
+  static void RearCenteredKinematicBicycleModelBatch(
+      const VehicleModelConfig& vehicle_model_config,
+      const double predicted_time_horizon,
+      const std::vector<VehicleState>& cur_vehicle_states,
+      std::vector<VehicleState>* predicted_vehicle_states);
 };
 
 }  // namespace common
@@ -16,6 +16,8 @@
 
 #include "modules/common/vehicle_model/vehicle_model.h"
 
+#include <vector>
+
 #include "cyber/common/file.h"
 #include "gtest/gtest.h"
 #include "modules/common/vehicle_state/proto/vehicle_state.pb.h"
@@ -77,5 +79,39 @@ TEST_F(VehicleModelTest, RearCenteredKinematicBicycleModel) {
   EXPECT_NEAR(expected_vehicle_state_.linear_velocity(),
               predicted_vehicle_state_.linear_velocity(), 2e-2);
 }
+
+TEST_F(VehicleModelTest, RearCenteredKinematicBicycleModelBatch) {
+  double predicted_time_horizon = localization_post_.measurement_time() -
+                                  localization_pre_.measurement_time();
+
+  auto vehicle_state_provider = VehicleStateProvider::Instance();
+  vehicle_state_provider->Update(localization_pre_, chassis_pre_);
+  cur_vehicle_state_ = vehicle_state_provider->vehicle_state();
+
+  // perturbed copies of the same state stand in for multiple candidates;
+  // the batch rollout must agree with the scalar model per candidate
+  std::vector<VehicleState> candidates;
+  for (int i = 0; i < 5; ++i) {
+    VehicleState candidate = cur_vehicle_state_;
+    candidate.set_x(candidate.x() + 0.5 * i);
+    candidate.set_linear_velocity(candidate.linear_velocity() + 0.2 * i);
+    candidate.set_kappa(candidate.kappa() + 0.001 * i);
+    candidates.push_back(candidate);
+  }
+
+  const std::vector<VehicleState> batch_predictions =
+      VehicleModel::PredictBatch(predicted_time_horizon, candidates);
+  ASSERT_EQ(candidates.size(), batch_predictions.size());
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    const VehicleState scalar_prediction =
+        VehicleModel::Predict(predicted_time_horizon, candidates[i]);
+    EXPECT_NEAR(scalar_prediction.x(), batch_predictions[i].x(), 1e-9);
+    EXPECT_NEAR(scalar_prediction.y(), batch_predictions[i].y(), 1e-9);
+    EXPECT_NEAR(scalar_prediction.heading(), batch_predictions[i].heading(),
+                1e-9);
+    EXPECT_NEAR(scalar_prediction.linear_velocity(),
+                batch_predictions[i].linear_velocity(), 1e-9);
+  }
+}
 }  // namespace common
 }  // namespace apollo
@@ -65,20 +65,42 @@ TrajectoryAnalyzer::TrajectoryAnalyzer(
   }
 }
 
-PathPoint TrajectoryAnalyzer::QueryMatchedPathPoint(const double x,
-                                                    const double y) const {
+size_t TrajectoryAnalyzer::QueryNearestIndexByPosition(const double x,
+                                                       const double y) const {
   CHECK_GT(trajectory_points_.size(), 0);
 
-  double d_min = PointDistanceSquare(trajectory_points_.front(), x, y);
-  size_t index_min = 0;
+  const size_t num_points = trajectory_points_.size();
+  size_t window = 8;
+  while (true) {
+    const size_t begin =
+        last_matched_index_ > window ? last_matched_index_ - window : 0;
+    const size_t end = std::min(num_points, last_matched_index_ + window + 1);
+
+    double d_min = PointDistanceSquare(trajectory_points_[begin], x, y);
+    size_t index_min = begin;
+    for (size_t i = begin + 1; i < end; ++i) {
+      const double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
+      if (d_temp < d_min) {
+        d_min = d_temp;
+        index_min = i;
+      }
+    }
 
-  for (size_t i = 1; i < trajectory_points_.size(); ++i) {
-    double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
-    if (d_temp < d_min) {
-      d_min = d_temp;
-      index_min = i;
+    // Accept the match only when it is not pinned to a window edge that
+    // can still move; otherwise widen the window and retry.
+    const bool at_begin_edge = index_min == begin && begin > 0;
+    const bool at_end_edge = index_min + 1 == end && end < num_points;
+    if (!at_begin_edge && !at_end_edge) {
+      last_matched_index_ = index_min;
+      return index_min;
     }
+    window *= 2;
   }
+}
+
+PathPoint TrajectoryAnalyzer::QueryMatchedPathPoint(const double x,
+                                                    const double y) const {
+  const size_t index_min = QueryNearestIndexByPosition(x, y);
 
   size_t index_start = index_min == 0 ? index_min : index_min - 1;
   size_t index_end =
@@ -183,17 +205,7 @@ TrajectoryPoint TrajectoryAnalyzer::QueryNearestPointByRelativeTime(
 
 TrajectoryPoint TrajectoryAnalyzer::QueryNearestPointByPosition(
     const double x, const double y) const {
-  double d_min = PointDistanceSquare(trajectory_points_.front(), x, y);
-  size_t index_min = 0;
-
-  for (size_t i = 1; i < trajectory_points_.size(); ++i) {
-    double d_temp = PointDistanceSquare(trajectory_points_[i], x, y);
-    if (d_temp < d_min) {
-      d_min = d_temp;
-      index_min = i;
-    }
-  }
-  return trajectory_points_[index_min];
+  return trajectory_points_[QueryNearestIndexByPosition(x, y)];
 }
 
 const std::vector<TrajectoryPoint> &TrajectoryAnalyzer::trajectory_points()
@@ -201,6 +213,14 @@ const std::vector<TrajectoryPoint> &TrajectoryAnalyzer::trajectory_points()
   return trajectory_points_;
 }
 
+void TrajectoryAnalyzer::InheritSearchCursorFrom(
+    const TrajectoryAnalyzer &other) {
+  if (other.seq_num_ == seq_num_ &&
+      other.last_matched_index_ < trajectory_points_.size()) {
+    last_matched_index_ = other.last_matched_index_;
+  }
+}
+
 PathPoint TrajectoryAnalyzer::FindMinDistancePoint(const TrajectoryPoint &p0,
                                                    const TrajectoryPoint &p1,
                                                    const double x,
@@ -147,15 +147,34 @@ class TrajectoryAnalyzer {
    */
   const std::vector<common::TrajectoryPoint> &trajectory_points() const;
 
+  /**
+   * @brief seed the nearest-point search cursor from another analyzer
+   * built over the same published trajectory, e.g. the previous control
+   * cycle's copy. Keeps the windowed position search warm across the
+   * per-cycle analyzer rebuilds; a mismatched sequence number is ignored.
+   * @param other analyzer to inherit the cursor from
+   */
+  void InheritSearchCursorFrom(const TrajectoryAnalyzer &other);
+
  private:
   common::PathPoint FindMinDistancePoint(const common::TrajectoryPoint &p0,
                                          const common::TrajectoryPoint &p1,
                                          const double x, const double y) const;
 
+  /**
+   * @brief query the index of the trajectory point that is closest to the
+   * given position. The search starts from the previously matched index
+   * and expands the window on demand, since the matched point only
+   * advances by a few points between consecutive queries on the same
+   * trajectory; it degrades to a full scan when the cached index is stale.
+   */
+  size_t QueryNearestIndexByPosition(const double x, const double y) const;
+
   std::vector<common::TrajectoryPoint> trajectory_points_;
 
   double header_time_ = 0.0;
   unsigned int seq_num_ = 0;
+  mutable size_t last_matched_index_ = 0;
 };
 
 }  // namespace control
@@ -121,32 +121,11 @@ bool ControlComponent::Init() {
 }
 
 void ControlComponent::OnPad(const std::shared_ptr<PadMessage> &pad) {
-  std::lock_guard<std::mutex> lock(mutex_);
   pad_msg_.CopyFrom(*pad);
   ADEBUG << "Received Pad Msg:" << pad_msg_.DebugString();
   AERROR_IF(!pad_msg_.has_action()) << "pad message check failed!";
 }
 
-void ControlComponent::OnChassis(const std::shared_ptr<Chassis> &chassis) {
-  ADEBUG << "Received chassis data: run chassis callback.";
-  std::lock_guard<std::mutex> lock(mutex_);
-  latest_chassis_.CopyFrom(*chassis);
-}
-
-void ControlComponent::OnPlanning(
-    const std::shared_ptr<ADCTrajectory> &trajectory) {
-  ADEBUG << "Received chassis data: run trajectory callback.";
-  std::lock_guard<std::mutex> lock(mutex_);
-  latest_trajectory_.CopyFrom(*trajectory);
-}
-
-void ControlComponent::OnLocalization(
-    const std::shared_ptr<LocalizationEstimate> &localization) {
-  ADEBUG << "Received control data: run localization message callback.";
-  std::lock_guard<std::mutex> lock(mutex_);
-  latest_localization_.CopyFrom(*localization);
-}
-
 void ControlComponent::OnMonitor(
     const common::monitor::MonitorMessage &monitor_message) {
   for (const auto &item : monitor_message.item()) {
@@ -279,14 +258,16 @@ bool ControlComponent::Proc() {
   const auto start_time =
       FLAGS_use_system_time_in_control ? absl::Now() : Clock::Now();
 
+  // All readers are polled from this thread only (they are created
+  // without callbacks), so the observed messages go straight into the
+  // local view with one copy each and no locking.
   chassis_reader_->Observe();
   const auto &chassis_msg = chassis_reader_->GetLatestObserved();
   if (chassis_msg == nullptr) {
     AERROR << "Chassis msg is not ready!";
     return false;
   }
-
-  OnChassis(chassis_msg);
+  local_view_.mutable_chassis()->CopyFrom(*chassis_msg);
 
   trajectory_reader_->Observe();
   const auto &trajectory_msg = trajectory_reader_->GetLatestObserved();
@@ -294,7 +275,7 @@ bool ControlComponent::Proc() {
     AERROR << "planning msg is not ready!";
     return false;
   }
-  OnPlanning(trajectory_msg);
+  local_view_.mutable_trajectory()->CopyFrom(*trajectory_msg);
 
   localization_reader_->Observe();
   const auto &localization_msg = localization_reader_->GetLatestObserved();
@@ -302,23 +283,13 @@ bool ControlComponent::Proc() {
     AERROR << "localization msg is not ready!";
     return false;
   }
-  OnLocalization(localization_msg);
+  local_view_.mutable_localization()->CopyFrom(*localization_msg);
 
   pad_msg_reader_->Observe();
   const auto &pad_msg = pad_msg_reader_->GetLatestObserved();
   if (pad_msg != nullptr) {
     OnPad(pad_msg);
-  }
-
-  {
-    // TODO(SHU): to avoid redundent copy
-    std::lock_guard<std::mutex> lock(mutex_);
-    local_view_.mutable_chassis()->CopyFrom(latest_chassis_);
-    local_view_.mutable_trajectory()->CopyFrom(latest_trajectory_);
-    local_view_.mutable_localization()->CopyFrom(latest_localization_);
-    if (pad_msg != nullptr) {
-      local_view_.mutable_pad_msg()->CopyFrom(pad_msg_);
-    }
+    local_view_.mutable_pad_msg()->CopyFrom(pad_msg_);
   }
 
   // use control submodules
@@ -61,15 +61,6 @@ class ControlComponent final : public apollo::cyber::TimerComponent {
   // Upon receiving pad message
   void OnPad(const std::shared_ptr<PadMessage> &pad);
 
-  void OnChassis(const std::shared_ptr<apollo::canbus::Chassis> &chassis);
-
-  void OnPlanning(
-      const std::shared_ptr<apollo::planning::ADCTrajectory> &trajectory);
-
-  void OnLocalization(
-      const std::shared_ptr<apollo::localization::LocalizationEstimate>
-          &localization);
-
   // Upon receiving monitor message
   void OnMonitor(
       const apollo::common::monitor::MonitorMessage &monitor_message);
@@ -82,9 +73,6 @@ class ControlComponent final : public apollo::cyber::TimerComponent {
  private:
   absl::Time init_time_;
 
-  localization::LocalizationEstimate latest_localization_;
-  canbus::Chassis latest_chassis_;
-  planning::ADCTrajectory latest_trajectory_;
   PadMessage pad_msg_;
   common::Header latest_replan_trajectory_header_;
 
@@ -101,8 +89,6 @@ class ControlComponent final : public apollo::cyber::TimerComponent {
 
   ControlConf control_conf_;
 
-  std::mutex mutex_;
-
   std::shared_ptr<cyber::Reader<apollo::canbus::Chassis>> chassis_reader_;
   std::shared_ptr<cyber::Reader<PadMessage>> pad_msg_reader_;
   std::shared_ptr<cyber::Reader<apollo::localization::LocalizationEstimate>>
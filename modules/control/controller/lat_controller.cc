@@ -371,8 +371,12 @@ Status LatController::ComputeControlCommand(
     }
   }
 
-  trajectory_analyzer_ =
-      std::move(TrajectoryAnalyzer(&target_tracking_trajectory));
+  TrajectoryAnalyzer rebuilt_analyzer(&target_tracking_trajectory);
+  // Carry the nearest-point cursor over when this is still the same
+  // published trajectory, so the windowed search stays warm between
+  // control cycles.
+  rebuilt_analyzer.InheritSearchCursorFrom(trajectory_analyzer_);
+  trajectory_analyzer_ = std::move(rebuilt_analyzer);
 
   // Transform the coordinate of the planning trajectory from the center of the
   // rear-axis to the center of mass, if conditions matched
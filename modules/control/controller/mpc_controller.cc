@@ -303,8 +303,14 @@ Status MPCController::ComputeControlCommand(
     const canbus::Chassis *chassis,
     const planning::ADCTrajectory *planning_published_trajectory,
     ControlCommand *cmd) {
-  trajectory_analyzer_ =
-      std::move(TrajectoryAnalyzer(planning_published_trajectory));
+  // Rebuild the analyzer only for a newly published trajectory; reusing
+  // it otherwise keeps the nearest-point search cursor warm between
+  // control cycles.
+  if (trajectory_analyzer_.trajectory_points().empty() ||
+      trajectory_analyzer_.seq_num() !=
+          planning_published_trajectory->header().sequence_num()) {
+    trajectory_analyzer_ = TrajectoryAnalyzer(planning_published_trajectory);
+  }
 
   SimpleMPCDebug *debug = cmd->mutable_debug()->mutable_simple_mpc_debug();
   debug->Clear();
@@ -389,12 +395,16 @@ Status MPCController::ComputeControlCommand(
 
   std::vector<double> control_cmd(controls_, 0);
   if (FLAGS_use_osqp_solver) {
-    apollo::common::math::MpcOsqp mpc_osqp(
-        matrix_ad_, matrix_bd_, matrix_q_updated_, matrix_r_updated_,
-        matrix_state_, lower_bound, upper_bound, lower_state_bound,
-        upper_state_bound, reference_state, mpc_max_iteration_, horizon_,
-        mpc_eps_);
-    if (!mpc_osqp.Solve(&control_cmd)) {
+    if (mpc_osqp_ == nullptr) {
+      mpc_osqp_.reset(new apollo::common::math::MpcOsqp(
+          matrix_ad_, matrix_bd_, matrix_q_updated_, matrix_r_updated_,
+          matrix_state_, lower_bound, upper_bound, lower_state_bound,
+          upper_state_bound, reference_state, mpc_max_iteration_, horizon_,
+          mpc_eps_));
+    }
+    if (!mpc_osqp_->UpdateAndSolve(matrix_ad_, matrix_q_updated_,
+                                   matrix_r_updated_, matrix_state_,
+                                   &control_cmd)) {
       AERROR << "MPC OSQP solver failed";
     } else {
       ADEBUG << "MPC OSQP problem solved! ";
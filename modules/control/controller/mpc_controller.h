@@ -242,6 +242,9 @@ class MPCController : public Controller {
 
   std::unique_ptr<Interpolation1D> steer_weight_interpolation_;
 
+  // persistent OSQP-based MPC solver, warm-started across control cycles
+  std::unique_ptr<apollo::common::math::MpcOsqp> mpc_osqp_;
+
   // for logging purpose
   std::ofstream mpc_log_file_;
 
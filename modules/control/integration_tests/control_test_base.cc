@@ -78,9 +78,7 @@ bool ControlTestBase::test_control() {
              << FLAGS_test_localization_file;
       return false;
     }
-    control_.OnLocalization(
-        std::make_shared<apollo::localization::LocalizationEstimate>(
-            localization));
+    control_.local_view_.mutable_localization()->CopyFrom(localization);
   }
 
   // Planning
@@ -92,8 +90,7 @@ bool ControlTestBase::test_control() {
              << FLAGS_test_planning_file;
       return false;
     }
-    control_.OnPlanning(
-        std::make_shared<apollo::planning::ADCTrajectory>(trajectory));
+    control_.local_view_.mutable_trajectory()->CopyFrom(trajectory);
   }
 
   // Chassis
@@ -105,7 +102,7 @@ bool ControlTestBase::test_control() {
              << FLAGS_test_chassis_file;
       return false;
     }
-    control_.OnChassis(std::make_shared<apollo::canbus::Chassis>(chassis));
+    control_.local_view_.mutable_chassis()->CopyFrom(chassis);
   }
 
   // Monitor
@@ -120,12 +117,6 @@ bool ControlTestBase::test_control() {
     control_.OnMonitor(monitor_message);
   }
 
-  control_.local_view_.mutable_chassis()->CopyFrom(control_.latest_chassis_);
-  control_.local_view_.mutable_trajectory()->CopyFrom(
-      control_.latest_trajectory_);
-  control_.local_view_.mutable_localization()->CopyFrom(
-      control_.latest_localization_);
-
   auto err = control_.ProduceControlCommand(&control_command_);
   if (!err.ok()) {
     ADEBUG << "control ProduceControlCommand failed";
@@ -73,6 +73,10 @@ DEFINE_string(
 
 DEFINE_double(voxel_filter_size, 0.3, "VoxelGrid pointcloud filter leaf size");
 
+DEFINE_int32(max_filtered_points, 30000,
+             "Hard cap on the number of points pushed to frontend per frame; "
+             "the voxel-filtered cloud is stride-sampled down to this budget");
+
 DEFINE_double(voxel_filter_height, 0.2,
               "VoxelGrid pointcloud filter leaf height");
 
@@ -50,6 +50,8 @@ DECLARE_string(request_timeout_ms);
 
 DECLARE_double(voxel_filter_size);
 
+DECLARE_int32(max_filtered_points);
+
 DECLARE_double(voxel_filter_height);
 
 DECLARE_double(system_status_lifetime_seconds);
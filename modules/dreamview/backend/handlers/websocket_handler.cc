@@ -29,7 +29,7 @@ using apollo::common::util::ContainsKey;
 void WebSocketHandler::handleReadyState(CivetServer *server, Connection *conn) {
   {
     std::unique_lock<std::mutex> lock(mutex_);
-    connections_.emplace(conn, std::make_shared<std::mutex>());
+    connections_.emplace(conn, std::make_shared<ConnectionState>());
   }
   AINFO << name_
         << ": Accepted connection. Total connections: " << connections_.size();
@@ -42,19 +42,19 @@ void WebSocketHandler::handleReadyState(CivetServer *server, Connection *conn) {
 
 void WebSocketHandler::handleClose(CivetServer *server,
                                    const Connection *conn) {
-  // Remove from the store of currently open connections. Copy the mutex out
+  // Remove from the store of currently open connections. Copy the state out
   // so that it won't be reclaimed during map.erase().
   Connection *connection = const_cast<Connection *>(conn);
 
-  std::shared_ptr<std::mutex> connection_lock;
+  std::shared_ptr<ConnectionState> state;
   {
     std::unique_lock<std::mutex> lock(mutex_);
-    connection_lock = connections_[connection];
+    state = connections_[connection];
   }
 
   {
     // Make sure there's no data being sent via the connection
-    std::unique_lock<std::mutex> lock_connection(*connection_lock);
+    std::unique_lock<std::mutex> lock_connection(state->send_mutex);
     std::unique_lock<std::mutex> lock(mutex_);
     connections_.erase(connection);
   }
@@ -93,7 +93,7 @@ bool WebSocketHandler::SendBinaryData(Connection *conn, const std::string &data,
 
 bool WebSocketHandler::SendData(Connection *conn, const std::string &data,
                                 bool skippable, int op_code) {
-  std::shared_ptr<std::mutex> connection_lock;
+  std::shared_ptr<ConnectionState> state;
   {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!ContainsKey(connections_, conn)) {
@@ -101,25 +101,35 @@ bool WebSocketHandler::SendData(Connection *conn, const std::string &data,
              << ": Trying to send to an uncached connection, skipping.";
       return false;
     }
-    // Copy the lock so that it still exists if the connection is closed after
-    // this block.
-    connection_lock = connections_[conn];
+    // Copy the state so that it still exists if the connection is closed
+    // after this block.
+    state = connections_[conn];
   }
 
   // Lock the connection while sending.
-  if (!connection_lock->try_lock()) {
-    // Skip sending data if:
-    // 1. Data is skippable according to sender and there's higher priority data
-    // being sent.
-    // 2. The connection has been closed.
+  if (!state->send_mutex.try_lock()) {
+    // Another write is in flight (or the connection is being closed). If
+    // the data is skippable, park it as the connection's latest pending
+    // frame: a newer frame overwrites an older one, and the in-flight
+    // writer flushes whatever is the latest when it finishes. This drops
+    // intermediate frames under backpressure while keeping the buffering
+    // bounded to a single frame per connection.
     if (skippable) {
-      AWARN << "Skip sending a droppable message!";
+      std::unique_lock<std::mutex> pending_lock(state->pending_mutex);
+      state->pending_data = data;
+      state->pending_op_code = op_code;
+      state->has_pending = true;
+      skipped_frame_count_.fetch_add(1, std::memory_order_relaxed);
       return false;
     }
-    // Block to acquire the lock.
-    connection_lock->lock();
+    // Block to acquire the lock. Announce ourselves so the in-flight writer
+    // hands the wire over instead of flushing parked skippable frames first.
+    state->urgent_waiters.fetch_add(1);
+    state->send_mutex.lock();
+    state->urgent_waiters.fetch_sub(1);
     std::unique_lock<std::mutex> lock(mutex_);
     if (!ContainsKey(connections_, conn)) {
+      state->send_mutex.unlock();
       return false;
     }
   }
@@ -132,7 +142,32 @@ bool WebSocketHandler::SendData(Connection *conn, const std::string &data,
              0.1) {
     ret = mg_websocket_write(conn, op_code, data.c_str(), data.size());
   }
-  connection_lock->unlock();
+
+  // Flush frames parked by skippable senders while this write was in
+  // flight. Only the latest one is kept, so the loop is short. A waiting
+  // non-skippable sender takes priority: leave the parked frame for
+  // whoever writes next.
+  while (state->urgent_waiters.load() == 0) {
+    std::string pending_data;
+    int pending_op_code = 0;
+    {
+      std::unique_lock<std::mutex> pending_lock(state->pending_mutex);
+      if (!state->has_pending) {
+        break;
+      }
+      pending_data = std::move(state->pending_data);
+      pending_op_code = state->pending_op_code;
+      state->has_pending = false;
+      state->pending_data.clear();
+    }
+    if (mg_websocket_write(conn, pending_op_code, pending_data.c_str(),
+                           pending_data.size()) !=
+        static_cast<int>(pending_data.size())) {
+      AWARN << name_ << ": Failed to flush a pending frame, dropping it.";
+      break;
+    }
+  }
+  state->send_mutex.unlock();
 
   if (ret != static_cast<int>(data.size())) {
     // When data is empty, the header length (2) is returned.
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -132,6 +133,16 @@ class WebSocketHandler : public CivetWebSocketHandler {
   bool SendBinaryData(Connection *conn, const std::string &data,
                       bool skippable = false);
 
+  /**
+   * @brief Returns the number of skippable frames that were parked or
+   * overwritten because a write was in flight since the last call.
+   * High-bandwidth senders (e.g. the camera stream) use this as a
+   * backpressure signal to adapt their encoding rate.
+   */
+  size_t GetAndClearSkippedFrameCount() {
+    return skipped_frame_count_.exchange(0);
+  }
+
   /**
    * @brief Add a new message handler for a message type.
    * @param type The name/key to identify the message type.
@@ -164,9 +175,30 @@ class WebSocketHandler : public CivetWebSocketHandler {
   // brief as possible.
   mutable std::mutex mutex_;
 
-  // The pool of all maintained connections. Each connection has a lock to
-  // guard against simultaneous write.
-  std::unordered_map<Connection *, std::shared_ptr<std::mutex>> connections_;
+  // Per-connection state. send_mutex guards against simultaneous writes on
+  // the wire. The pending_* fields form a one-deep queue holding the latest
+  // skippable payload that arrived while another write was in flight; a
+  // newer frame overwrites an older one, so a slow client costs at most one
+  // buffered frame instead of an unbounded backlog.
+  struct ConnectionState {
+    std::mutex send_mutex;
+    std::mutex pending_mutex;
+    std::string pending_data;
+    int pending_op_code = 0;
+    bool has_pending = false;
+    // Number of non-skippable senders blocked on send_mutex. While it is
+    // non-zero the in-flight writer leaves pending skippable frames parked,
+    // so control/status messages always preempt video on the wire.
+    std::atomic<int> urgent_waiters{0};
+  };
+
+  // The pool of all maintained connections.
+  std::unordered_map<Connection *, std::shared_ptr<ConnectionState>>
+      connections_;
+
+  // Skippable frames parked or overwritten since the last query, across all
+  // connections of this handler.
+  std::atomic<size_t> skipped_frame_count_{0};
 };
 
 }  // namespace dreamview
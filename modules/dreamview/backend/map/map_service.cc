@@ -18,8 +18,10 @@
 
 #include <algorithm>
 #include <fstream>
+#include <unordered_map>
 #include <utility>
 
+#include "cyber/common/file.h"
 #include "modules/common/util/json_util.h"
 #include "modules/common/util/string_util.h"
 #include "modules/map/hdmap/hdmap_util.h"
@@ -79,6 +81,16 @@ void ExtractRoadAndLaneIds(const std::vector<LaneInfoConstPtr> &lanes,
   std::sort(road_ids->begin(), road_ids->end());
 }
 
+template <typename Element>
+void CacheElement(const std::string &key_prefix, const Element &element,
+                  Element *(Map::*add_element)(),
+                  std::unordered_map<std::string, std::string> *cache) {
+  Map single_element_map;
+  *(single_element_map.*add_element)() = element;
+  single_element_map.SerializeToString(
+      &(*cache)[key_prefix + element.id().id()]);
+}
+
 }  // namespace
 
 const char MapService::kMetaFileName[] = "/metaInfo.json";
@@ -96,9 +108,73 @@ bool MapService::ReloadMap(bool force_reload) {
 
   // Update the x,y-offsets if present.
   UpdateOffsets();
+  BuildElementCache();
   return ret;
 }
 
+void MapService::BuildElementCache() {
+  element_cache_.clear();
+  element_cache_ready_ = false;
+
+  const std::string map_file =
+      use_sim_map_ ? apollo::hdmap::SimMapFile() : apollo::hdmap::BaseMapFile();
+  Map map_proto;
+  if (!cyber::common::GetProtoFromFile(map_file, &map_proto)) {
+    AERROR << "Failed to load map file " << map_file
+           << " for the element cache, falling back to per-request retrieval.";
+    return;
+  }
+
+  for (const auto &lane : map_proto.lane()) {
+    // Apply the display simplification once here instead of per request.
+    Lane simplified_lane = lane;
+    simplified_lane.clear_left_sample();
+    simplified_lane.clear_right_sample();
+    simplified_lane.clear_left_road_sample();
+    simplified_lane.clear_right_road_sample();
+    CacheElement("lane/", simplified_lane, &Map::add_lane, &element_cache_);
+  }
+  for (const auto &clear_area : map_proto.clear_area()) {
+    CacheElement("clear_area/", clear_area, &Map::add_clear_area,
+                 &element_cache_);
+  }
+  for (const auto &crosswalk : map_proto.crosswalk()) {
+    CacheElement("crosswalk/", crosswalk, &Map::add_crosswalk,
+                 &element_cache_);
+  }
+  for (const auto &junction : map_proto.junction()) {
+    CacheElement("junction/", junction, &Map::add_junction, &element_cache_);
+  }
+  for (const auto &signal : map_proto.signal()) {
+    CacheElement("signal/", signal, &Map::add_signal, &element_cache_);
+  }
+  for (const auto &stop_sign : map_proto.stop_sign()) {
+    CacheElement("stop_sign/", stop_sign, &Map::add_stop_sign,
+                 &element_cache_);
+  }
+  for (const auto &yield_sign : map_proto.yield()) {
+    CacheElement("yield/", yield_sign, &Map::add_yield, &element_cache_);
+  }
+  for (const auto &road : map_proto.road()) {
+    CacheElement("road/", road, &Map::add_road, &element_cache_);
+  }
+  for (const auto &parking_space : map_proto.parking_space()) {
+    CacheElement("parking_space/", parking_space, &Map::add_parking_space,
+                 &element_cache_);
+  }
+  for (const auto &speed_bump : map_proto.speed_bump()) {
+    CacheElement("speed_bump/", speed_bump, &Map::add_speed_bump,
+                 &element_cache_);
+  }
+  for (const auto &pnc_junction : map_proto.pnc_junction()) {
+    CacheElement("pnc_junction/", pnc_junction, &Map::add_pnc_junction,
+                 &element_cache_);
+  }
+  element_cache_ready_ = true;
+  AINFO << "Built binary map element cache with " << element_cache_.size()
+        << " elements from " << map_file;
+}
+
 void MapService::UpdateOffsets() {
   x_offset_ = 0.0;
   y_offset_ = 0.0;
@@ -329,6 +405,58 @@ Map MapService::RetrieveMapElements(const MapElementIds &ids) const {
   return result;
 }
 
+bool MapService::RetrieveMapElementsAsBinary(const MapElementIds &ids,
+                                             std::string *map_bytes) const {
+  boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
+
+  if (!element_cache_ready_) {
+    return false;
+  }
+  map_bytes->clear();
+
+  const auto append = [this, map_bytes](const std::string &key_prefix,
+                                        const std::string &id) {
+    const auto iter = element_cache_.find(key_prefix + id);
+    if (iter != element_cache_.end()) {
+      map_bytes->append(iter->second);
+    }
+  };
+  for (const auto &id : ids.lane()) {
+    append("lane/", id);
+  }
+  for (const auto &id : ids.clear_area()) {
+    append("clear_area/", id);
+  }
+  for (const auto &id : ids.crosswalk()) {
+    append("crosswalk/", id);
+  }
+  for (const auto &id : ids.junction()) {
+    append("junction/", id);
+  }
+  for (const auto &id : ids.signal()) {
+    append("signal/", id);
+  }
+  for (const auto &id : ids.stop_sign()) {
+    append("stop_sign/", id);
+  }
+  for (const auto &id : ids.yield()) {
+    append("yield/", id);
+  }
+  for (const auto &id : ids.road()) {
+    append("road/", id);
+  }
+  for (const auto &id : ids.parking_space()) {
+    append("parking_space/", id);
+  }
+  for (const auto &id : ids.speed_bump()) {
+    append("speed_bump/", id);
+  }
+  for (const auto &id : ids.pnc_junction()) {
+    append("pnc_junction/", id);
+  }
+  return true;
+}
+
 bool MapService::GetNearestLane(const double x, const double y,
                                 LaneInfoConstPtr *nearest_lane,
                                 double *nearest_s, double *nearest_l) const {
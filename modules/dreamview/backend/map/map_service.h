@@ -23,6 +23,7 @@
 #include <boost/thread/locks.hpp>
 #include <boost/thread/shared_mutex.hpp>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "modules/dreamview/proto/simulation_world.pb.h"
@@ -54,6 +55,14 @@ class MapService {
   // javascript clients.
   hdmap::Map RetrieveMapElements(const MapElementIds &ids) const;
 
+  // Serialized hdmap::Map with the requested elements, assembled by
+  // concatenating the per-element binary buffers cached at map load time,
+  // so nothing is re-extracted or re-serialized per request. Returns false
+  // when the cache is unavailable; callers should then fall back to
+  // RetrieveMapElements.
+  bool RetrieveMapElementsAsBinary(const MapElementIds &ids,
+                                   std::string *map_bytes) const;
+
   bool GetPoseWithRegardToLane(const double x, const double y, double *theta,
                                double *s) const;
 
@@ -86,6 +95,9 @@ class MapService {
 
  private:
   void UpdateOffsets();
+  // Builds the per-element binary cache from the display map file. Must be
+  // called with the writer lock held.
+  void BuildElementCache();
   bool GetNearestLane(const double x, const double y,
                       apollo::hdmap::LaneInfoConstPtr *nearest_lane,
                       double *nearest_s, double *nearest_l) const;
@@ -112,6 +124,14 @@ class MapService {
   double x_offset_ = 0.0;
   double y_offset_ = 0.0;
 
+  // Pre-serialized map elements keyed by element type and id. Each entry is
+  // a serialized single-element hdmap::Map with the display simplifications
+  // already applied, so a response is the plain concatenation of entries:
+  // protobuf parses concatenated messages as a merge, and repeated fields
+  // merge by appending.
+  std::unordered_map<std::string, std::string> element_cache_;
+  bool element_cache_ready_ = false;
+
   // RW lock to protect map data
   mutable boost::shared_mutex mutex_;
 };
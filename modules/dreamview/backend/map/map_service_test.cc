@@ -62,6 +62,32 @@ TEST_F(MapServiceTest, RetrieveMapElements) {
   EXPECT_EQ("l1", map.lane(0).id().id());
 }
 
+TEST_F(MapServiceTest, RetrieveMapElementsAsBinary) {
+  MapElementIds map_element_ids;
+  map_element_ids.add_lane("l1");
+  std::string map_bytes;
+  ASSERT_TRUE(
+      map_service->RetrieveMapElementsAsBinary(map_element_ids, &map_bytes));
+
+  // the concatenated cache entries must parse into the same map that the
+  // per-request retrieval path produces
+  Map map;
+  ASSERT_TRUE(map.ParseFromString(map_bytes));
+  EXPECT_EQ(1, map.lane_size());
+  EXPECT_EQ("l1", map.lane(0).id().id());
+  EXPECT_EQ(0, map.lane(0).left_sample_size());
+
+  Map expected_map = map_service->RetrieveMapElements(map_element_ids);
+  EXPECT_EQ(expected_map.DebugString(), map.DebugString());
+
+  // unknown ids are skipped, like in RetrieveMapElements
+  map_element_ids.add_lane("no_such_lane");
+  ASSERT_TRUE(
+      map_service->RetrieveMapElementsAsBinary(map_element_ids, &map_bytes));
+  ASSERT_TRUE(map.ParseFromString(map_bytes));
+  EXPECT_EQ(1, map.lane_size());
+}
+
 TEST_F(MapServiceTest, GetStartPoint) {
   PointENU start_point;
   EXPECT_TRUE(map_service->GetStartPoint(&start_point));
@@ -160,6 +160,17 @@ void PerceptionCameraUpdater::OnImage(
     return;
   }
 
+  ++frame_counter_;
+  if (frame_counter_ % kAdaptationWindowFrames == 0) {
+    AdaptEncodingRate();
+  }
+  // Drop decimated frames before decoding: skipping the whole
+  // decode/resize/encode pipeline is what saves the cost, not dropping
+  // already-encoded frames from the send queue.
+  if (frame_skip_ > 0 && frame_counter_ % (frame_skip_ + 1) != 0) {
+    return;
+  }
+
   std::vector<uint8_t> compressed_raw_data(compressed_image->data().begin(),
                                            compressed_image->data().end());
   cv::Mat mat_image = cv::imdecode(compressed_raw_data, CV_LOAD_IMAGE_COLOR);
@@ -173,7 +184,8 @@ void PerceptionCameraUpdater::OnImage(
                       static_cast<int>(mat_image.rows * kImageScale)),
              0, 0, CV_INTER_LINEAR);
   std::vector<uint8_t> tmp_buffer;
-  cv::imencode(".jpg", mat_image, tmp_buffer, std::vector<int>() /* params */);
+  cv::imencode(".jpg", mat_image, tmp_buffer,
+               {CV_IMWRITE_JPEG_QUALITY, jpeg_quality_});
 
   double next_image_timestamp;
   if (compressed_image->has_measurement_time()) {
@@ -193,6 +205,34 @@ void PerceptionCameraUpdater::OnImage(
   camera_update_.set_image_aspect_ratio(static_cast<double>(width) / height);
 }
 
+void PerceptionCameraUpdater::AdaptEncodingRate() {
+  const size_t skipped = websocket_->GetAndClearSkippedFrameCount();
+  if (skipped > 0) {
+    // The link is falling behind: back off, quality before frame rate.
+    if (jpeg_quality_ > kMinJpegQuality) {
+      jpeg_quality_ -= kJpegQualityStep;
+      if (jpeg_quality_ < kMinJpegQuality) {
+        jpeg_quality_ = kMinJpegQuality;
+      }
+    } else if (frame_skip_ < kMaxFrameSkip) {
+      ++frame_skip_;
+    }
+    ADEBUG << "Camera stream backpressure: " << skipped
+           << " skipped frames, jpeg quality " << jpeg_quality_
+           << ", frame skip " << frame_skip_;
+  } else {
+    // A full window went through untouched: recover, frame rate first.
+    if (frame_skip_ > 0) {
+      --frame_skip_;
+    } else if (jpeg_quality_ < kMaxJpegQuality) {
+      jpeg_quality_ += kJpegQualityStep;
+      if (jpeg_quality_ > kMaxJpegQuality) {
+        jpeg_quality_ = kMaxJpegQuality;
+      }
+    }
+  }
+}
+
 void PerceptionCameraUpdater::OnLocalization(
     const std::shared_ptr<LocalizationEstimate> &localization) {
   if (!enabled_) {
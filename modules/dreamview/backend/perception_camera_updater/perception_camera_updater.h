@@ -56,6 +56,15 @@ class PerceptionCameraUpdater {
  private:
   static constexpr double kImageScale = 0.6;
 
+  // Adaptive-rate control for the camera stream. When the websocket reports
+  // backpressure the encoder first lowers jpeg quality, then decimates
+  // frames; when the link drains it recovers in the reverse order.
+  static constexpr int kMaxJpegQuality = 95;
+  static constexpr int kMinJpegQuality = 40;
+  static constexpr int kJpegQualityStep = 15;
+  static constexpr int kMaxFrameSkip = 4;
+  static constexpr int kAdaptationWindowFrames = 15;
+
   void InitReaders();
   void OnImage(const std::shared_ptr<apollo::drivers::CompressedImage> &image);
   void OnLocalization(
@@ -68,6 +77,12 @@ class PerceptionCameraUpdater {
    */
   void GetImageLocalization(std::vector<double> *localization);
 
+  /**
+   * @brief Adjust jpeg quality and frame decimation from the number of
+   * frames the websocket had to skip since the last window.
+   */
+  void AdaptEncodingRate();
+
   apollo::transform::Buffer *tf_buffer_ = apollo::transform::Buffer::Instance();
   bool QueryStaticTF(const std::string &frame_id,
                      const std::string &child_frame_id,
@@ -80,6 +95,11 @@ class PerceptionCameraUpdater {
   bool enabled_ = false;
   double current_image_timestamp_;
 
+  // Only touched from the image reader callback.
+  int jpeg_quality_ = kMaxJpegQuality;
+  int frame_skip_ = 0;
+  int frame_counter_ = 0;
+
   std::unique_ptr<cyber::Node> node_;
 
   std::deque<std::shared_ptr<apollo::localization::LocalizationEstimate>>
@@ -40,7 +40,6 @@ boost::shared_mutex PointCloudUpdater::mutex_;
 PointCloudUpdater::PointCloudUpdater(WebSocketHandler *websocket)
     : node_(cyber::CreateNode("point_cloud")),
       websocket_(websocket),
-      point_cloud_str_(""),
       future_ready_(true) {
   RegisterMessageHandlers();
 }
@@ -83,18 +82,21 @@ void PointCloudUpdater::RegisterMessageHandlers() {
   websocket_->RegisterMessageHandler(
       "RequestPointCloud",
       [this](const Json &json, WebSocketHandler::Connection *conn) {
-        std::string to_send;
         // If there is no point_cloud data for more than 2 seconds, reset.
-        if (point_cloud_str_ != "" &&
+        if (point_cloud_str_ != nullptr &&
             std::fabs(last_localization_time_ - last_point_cloud_time_) > 2.0) {
           boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
-          point_cloud_str_ = "";
+          point_cloud_str_.reset();
         }
+        // Grab a reference to the current payload instead of copying it;
+        // the filter worker always publishes a fresh string, so the
+        // referenced one is immutable.
+        std::shared_ptr<std::string> to_send;
         {
           boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
           to_send = point_cloud_str_;
         }
-        websocket_->SendBinaryData(conn, to_send, true);
+        websocket_->SendBinaryData(conn, to_send ? *to_send : "", true);
       });
   websocket_->RegisterMessageHandler(
       "TogglePointCloud",
@@ -148,34 +150,37 @@ void PointCloudUpdater::UpdatePointCloud(
   // Check if last filter process has finished before processing new data.
   if (future_ready_) {
     future_ready_ = false;
-    // transform from drivers::PointCloud to pcl::PointCloud
-    pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr(
-        new pcl::PointCloud<pcl::PointXYZ>);
-    pcl_ptr->width = point_cloud->width();
-    pcl_ptr->height = point_cloud->height();
-    pcl_ptr->is_dense = false;
-
-    if (point_cloud->width() * point_cloud->height() !=
-        static_cast<unsigned int>(point_cloud->point_size())) {
-      pcl_ptr->width = 1;
-      pcl_ptr->height = point_cloud->point_size();
-    }
-    pcl_ptr->points.resize(point_cloud->point_size());
-
-    for (size_t i = 0; i < pcl_ptr->points.size(); ++i) {
-      const auto &point = point_cloud->point(static_cast<int>(i));
-      pcl_ptr->points[i].x = point.x();
-      pcl_ptr->points[i].y = point.y();
-      pcl_ptr->points[i].z = point.z();
-    }
+    // The proto-to-pcl conversion and the filtering both run on the worker
+    // so the reader callback returns immediately.
     std::future<void> f =
-        cyber::Async(&PointCloudUpdater::FilterPointCloud, this, pcl_ptr);
+        cyber::Async(&PointCloudUpdater::FilterPointCloud, this, point_cloud);
     async_future_ = std::move(f);
   }
 }
 
 void PointCloudUpdater::FilterPointCloud(
-    pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr) {
+    const std::shared_ptr<drivers::PointCloud> &point_cloud) {
+  // transform from drivers::PointCloud to pcl::PointCloud
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr(
+      new pcl::PointCloud<pcl::PointXYZ>);
+  pcl_ptr->width = point_cloud->width();
+  pcl_ptr->height = point_cloud->height();
+  pcl_ptr->is_dense = false;
+
+  if (point_cloud->width() * point_cloud->height() !=
+      static_cast<unsigned int>(point_cloud->point_size())) {
+    pcl_ptr->width = 1;
+    pcl_ptr->height = point_cloud->point_size();
+  }
+  pcl_ptr->points.resize(point_cloud->point_size());
+
+  for (size_t i = 0; i < pcl_ptr->points.size(); ++i) {
+    const auto &point = point_cloud->point(static_cast<int>(i));
+    pcl_ptr->points[i].x = point.x();
+    pcl_ptr->points[i].y = point.y();
+    pcl_ptr->points[i].z = point.z();
+  }
+
   pcl::VoxelGrid<pcl::PointXYZ> voxel_grid;
   voxel_grid.setInputCloud(pcl_ptr);
   voxel_grid.setLeafSize(static_cast<float>(FLAGS_voxel_filter_size),
@@ -191,8 +196,18 @@ void PointCloudUpdater::FilterPointCloud(
     boost::shared_lock<boost::shared_mutex> reader_lock(mutex_);
     z_offset = lidar_height_;
   }
+  // Stride-sample the filtered cloud down to the point budget so a dense
+  // environment cannot blow up the frontend payload.
+  size_t stride = 1;
+  if (FLAGS_max_filtered_points > 0 &&
+      pcl_filtered_ptr->size() >
+          static_cast<size_t>(FLAGS_max_filtered_points)) {
+    stride = (pcl_filtered_ptr->size() + FLAGS_max_filtered_points - 1) /
+             FLAGS_max_filtered_points;
+  }
+
   apollo::dreamview::PointCloud point_cloud_pb;
-  for (size_t idx = 0; idx < pcl_filtered_ptr->size(); ++idx) {
+  for (size_t idx = 0; idx < pcl_filtered_ptr->size(); idx += stride) {
     pcl::PointXYZ &pt = pcl_filtered_ptr->points[idx];
     if (!std::isnan(pt.x) && !std::isnan(pt.y) && !std::isnan(pt.z)) {
       point_cloud_pb.add_num(pt.x);
@@ -200,9 +215,11 @@ void PointCloudUpdater::FilterPointCloud(
       point_cloud_pb.add_num(pt.z + z_offset);
     }
   }
+  auto new_point_cloud_str = std::make_shared<std::string>();
+  point_cloud_pb.SerializeToString(new_point_cloud_str.get());
   {
     boost::unique_lock<boost::shared_mutex> writer_lock(mutex_);
-    point_cloud_pb.SerializeToString(&point_cloud_str_);
+    point_cloud_str_ = std::move(new_point_cloud_str);
     future_ready_ = true;
   }
 }
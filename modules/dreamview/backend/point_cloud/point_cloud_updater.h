@@ -77,7 +77,8 @@ class PointCloudUpdater {
   void UpdatePointCloud(
       const std::shared_ptr<drivers::PointCloud> &point_cloud);
 
-  void FilterPointCloud(pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_ptr);
+  void FilterPointCloud(
+      const std::shared_ptr<drivers::PointCloud> &point_cloud);
 
   void UpdateLocalizationTime(
       const std::shared_ptr<apollo::localization::LocalizationEstimate>
@@ -91,8 +92,9 @@ class PointCloudUpdater {
 
   bool enabled_ = false;
 
-  // The PointCloud to be pushed to frontend.
-  std::string point_cloud_str_;
+  // The serialized PointCloud to be pushed to frontend, shared so the
+  // websocket handlers can reference the payload without copying it.
+  std::shared_ptr<std::string> point_cloud_str_;
 
   std::future<void> async_future_;
   std::atomic<bool> future_ready_;
@@ -80,6 +80,11 @@ using ::google::protobuf::util::MessageToJsonString;
 // Angle threshold is about 5.72 degree.
 static constexpr double kAngleThreshold = 0.1;
 
+// The set of map elements within the query radius barely changes while the
+// car moves a couple of meters, so the spatial query and the map hash are
+// refreshed only after the car has travelled this far.
+static constexpr double kMapQueryDistanceThreshold = 2.0;
+
 namespace {
 
 double CalculateAcceleration(
@@ -401,10 +406,18 @@ void SimulationWorldService::GetWireFormatString(
     std::string *sim_world_with_planning_data) {
   PopulateMapInfo(radius);
 
-  world_.SerializeToString(sim_world_with_planning_data);
-
+  // The proto wire format is concatenable: serializing the world without
+  // planning_data and appending the planning_data field alone parses to the
+  // same message as serializing the full world. This way the big world
+  // object is serialized once per cycle instead of twice.
+  SimulationWorld planning_data_holder;
+  planning_data_holder.mutable_planning_data()->Swap(
+      world_.mutable_planning_data());
   world_.clear_planning_data();
+
   world_.SerializeToString(sim_world);
+  *sim_world_with_planning_data = *sim_world;
+  planning_data_holder.AppendToString(sim_world_with_planning_data);
 }
 
 Json SimulationWorldService::GetUpdateAsJson(double radius) const {
@@ -430,10 +443,23 @@ void SimulationWorldService::GetMapElementIds(double radius,
 }
 
 void SimulationWorldService::PopulateMapInfo(double radius) {
+  const auto &adc = world_.auto_driving_car();
+  const double dx = adc.position_x() - map_query_position_x_;
+  const double dy = adc.position_y() - map_query_position_y_;
+  if (world_.has_map_element_ids() && radius == world_.map_radius() &&
+      dx * dx + dy * dy <
+          kMapQueryDistanceThreshold * kMapQueryDistanceThreshold) {
+    // The car has barely moved since the last query; the element ids and
+    // the map hash in world_ are still valid.
+    return;
+  }
+
   world_.clear_map_element_ids();
   GetMapElementIds(radius, world_.mutable_map_element_ids());
   world_.set_map_hash(map_service_->CalculateMapHash(world_.map_element_ids()));
   world_.set_map_radius(radius);
+  map_query_position_x_ = adc.position_x();
+  map_query_position_y_ = adc.position_y();
 }
 
 const Map &SimulationWorldService::GetRelativeMap() const {
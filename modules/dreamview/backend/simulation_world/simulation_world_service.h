@@ -24,6 +24,7 @@
 #include <boost/thread/shared_mutex.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <list>
 #include <memory>
 #include <string>
@@ -339,6 +340,11 @@ class SimulationWorldService {
   double current_real_dist_ = 0.0;
   double current_rss_safe_dist_ = 0.0;
 
+  // Car position of the last map element query, used to skip the query
+  // while the car stays close to it.
+  double map_query_position_x_ = std::numeric_limits<double>::lowest();
+  double map_query_position_y_ = std::numeric_limits<double>::lowest();
+
   // Gear Location
   apollo::canbus::Chassis_GearPosition gear_location_;
 
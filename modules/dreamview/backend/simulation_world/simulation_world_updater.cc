@@ -71,10 +71,15 @@ void SimulationWorldUpdater::RegisterMessageHandlers() {
         if (iter != json.end()) {
           MapElementIds map_element_ids;
           if (JsonStringToMessage(iter->dump(), &map_element_ids).ok()) {
-            auto retrieved = map_service_->RetrieveMapElements(map_element_ids);
-
             std::string retrieved_map_string;
-            retrieved.SerializeToString(&retrieved_map_string);
+            // Serve from the binary element cache when available, so map
+            // browsing does not re-serialize protos on every pan.
+            if (!map_service_->RetrieveMapElementsAsBinary(
+                    map_element_ids, &retrieved_map_string)) {
+              auto retrieved =
+                  map_service_->RetrieveMapElements(map_element_ids);
+              retrieved.SerializeToString(&retrieved_map_string);
+            }
 
             map_ws_->SendBinaryData(conn, retrieved_map_string, true);
           } else {
@@ -50,20 +50,16 @@ bool CameraComponent::Init() {
     return false;
   }
   raw_image_->is_new = 0;
-  // free memory in this struct desturctor
-  raw_image_->image =
-      reinterpret_cast<char*>(calloc(raw_image_->image_size, sizeof(char)));
-  if (raw_image_->image == nullptr) {
-    AERROR << "system calloc memory error, size:" << raw_image_->image_size;
-    return false;
-  }
+  // The capture device decodes straight into the published buffers, so
+  // raw_image_->image just aliases the current one (see run()).
+  raw_image_->image = nullptr;
 
   for (int i = 0; i < buffer_size_; ++i) {
     auto pb_image = std::make_shared<Image>();
     pb_image->mutable_header()->set_frame_id(camera_config_->frame_id());
     pb_image->set_width(raw_image_->width);
     pb_image->set_height(raw_image_->height);
-    pb_image->mutable_data()->reserve(raw_image_->image_size);
+    pb_image->mutable_data()->resize(raw_image_->image_size);
 
     if (camera_config_->output_type() == YUYV) {
       pb_image->set_encoding("yuyv");
@@ -90,20 +86,22 @@ void CameraComponent::run() {
       continue;
     }
 
+    if (index_ >= buffer_size_) {
+      index_ = 0;
+    }
+    auto pb_image = pb_image_buffer_.at(index_++);
+    // Decode/convert directly into the recycled proto buffer instead of
+    // going through an intermediate frame plus a full-frame copy.
+    raw_image_->image = &(*pb_image->mutable_data())[0];
     if (!camera_device_->poll(raw_image_)) {
       AERROR << "camera device poll failed";
       continue;
     }
 
     cyber::Time image_time(raw_image_->tv_sec, 1000 * raw_image_->tv_usec);
-    if (index_ >= buffer_size_) {
-      index_ = 0;
-    }
-    auto pb_image = pb_image_buffer_.at(index_++);
     pb_image->mutable_header()->set_timestamp_sec(
         cyber::Time::Now().ToSecond());
     pb_image->set_measurement_time(image_time.ToSecond());
-    pb_image->set_data(raw_image_->image, raw_image_->image_size);
     writer_->Write(pb_image);
 
     cyber::SleepFor(std::chrono::microseconds(spin_rate_));
@@ -115,6 +113,10 @@ CameraComponent::~CameraComponent() {
     running_.exchange(false);
     async_result_.wait();
   }
+  if (raw_image_ != nullptr) {
+    // The image pointer aliases a published buffer; it is not owned here.
+    raw_image_->image = nullptr;
+  }
 }
 
 }  // namespace camera
@@ -22,6 +22,8 @@
 
 #include "modules/drivers/canbus/can_client/socket/socket_can_client_raw.h"
 
+#include <algorithm>
+
 #include "absl/strings/str_cat.h"
 
 namespace apollo {
@@ -130,6 +132,23 @@ ErrorCode SocketCanClientRaw::Start() {
     return ErrorCode::CAN_CLIENT_ERROR_BASE;
   }
 
+  // wire the scatter/gather descriptors once so Send/Receive can submit a
+  // whole batch of frames per syscall
+  for (int i = 0; i < MAX_CAN_SEND_FRAME_LEN; ++i) {
+    send_iovs_[i].iov_base = &send_frames_[i];
+    send_iovs_[i].iov_len = sizeof(send_frames_[i]);
+    std::memset(&send_msgs_[i], 0, sizeof(send_msgs_[i]));
+    send_msgs_[i].msg_hdr.msg_iov = &send_iovs_[i];
+    send_msgs_[i].msg_hdr.msg_iovlen = 1;
+  }
+  for (int i = 0; i < MAX_CAN_RECV_FRAME_LEN; ++i) {
+    recv_iovs_[i].iov_base = &recv_frames_[i];
+    recv_iovs_[i].iov_len = sizeof(recv_frames_[i]);
+    std::memset(&recv_msgs_[i], 0, sizeof(recv_msgs_[i]));
+    recv_msgs_[i].msg_hdr.msg_iov = &recv_iovs_[i];
+    recv_msgs_[i].msg_hdr.msg_iovlen = 1;
+  }
+
   is_started_ = true;
   return ErrorCode::OK;
 }
@@ -157,7 +176,9 @@ ErrorCode SocketCanClientRaw::Send(const std::vector<CanFrame> &frames,
     AERROR << "Nvidia can client has not been initiated! Please init first!";
     return ErrorCode::CAN_CLIENT_ERROR_SEND_FAILED;
   }
-  for (size_t i = 0; i < frames.size() && i < MAX_CAN_SEND_FRAME_LEN; ++i) {
+  const int32_t send_num = std::min(static_cast<int32_t>(frames.size()),
+                                    MAX_CAN_SEND_FRAME_LEN);
+  for (int32_t i = 0; i < send_num; ++i) {
     if (frames[i].len > CANBUS_MESSAGE_LENGTH || frames[i].len < 0) {
       AERROR << "frames[" << i << "].len = " << frames[i].len
              << ", which is not equal to can message data length ("
@@ -167,14 +188,18 @@ ErrorCode SocketCanClientRaw::Send(const std::vector<CanFrame> &frames,
     send_frames_[i].can_id = frames[i].id;
     send_frames_[i].can_dlc = frames[i].len;
     std::memcpy(send_frames_[i].data, frames[i].data, frames[i].len);
+  }
 
-    // Synchronous transmission of CAN messages
-    int ret = static_cast<int>(
-        write(dev_handler_, &send_frames_[i], sizeof(send_frames_[i])));
+  // Synchronous transmission of the whole batch with one syscall.
+  int32_t sent = 0;
+  while (sent < send_num) {
+    int ret = sendmmsg(dev_handler_, &send_msgs_[sent],
+                       static_cast<unsigned int>(send_num - sent), 0);
     if (ret <= 0) {
       AERROR << "send message failed, error code: " << ret;
       return ErrorCode::CAN_CLIENT_ERROR_BASE;
     }
+    sent += ret;
   }
 
   return ErrorCode::OK;
@@ -195,14 +220,18 @@ ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
     return ErrorCode::CAN_CLIENT_ERROR_FRAME_NUM;
   }
 
-  for (int32_t i = 0; i < *frame_num && i < MAX_CAN_RECV_FRAME_LEN; ++i) {
-    CanFrame cf;
-    auto ret = read(dev_handler_, &recv_frames_[i], sizeof(recv_frames_[i]));
+  // Block until at least one frame arrives, then drain whatever else is
+  // already queued, all in a single syscall.
+  int nframes = recvmmsg(dev_handler_, recv_msgs_,
+                         static_cast<unsigned int>(*frame_num), MSG_WAITFORONE,
+                         nullptr);
+  if (nframes < 0) {
+    AERROR << "receive message failed, error code: " << nframes;
+    return ErrorCode::CAN_CLIENT_ERROR_BASE;
+  }
 
-    if (ret < 0) {
-      AERROR << "receive message failed, error code: " << ret;
-      return ErrorCode::CAN_CLIENT_ERROR_BASE;
-    }
+  for (int32_t i = 0; i < nframes; ++i) {
+    CanFrame cf;
     if (recv_frames_[i].can_dlc > CANBUS_MESSAGE_LENGTH ||
         recv_frames_[i].can_dlc < 0) {
       AERROR << "recv_frames_[" << i
@@ -216,6 +245,7 @@ ErrorCode SocketCanClientRaw::Receive(std::vector<CanFrame> *const frames,
     std::memcpy(cf.data, recv_frames_[i].data, recv_frames_[i].can_dlc);
     frames->push_back(cf);
   }
+  *frame_num = nframes;
   return ErrorCode::OK;
 }
 
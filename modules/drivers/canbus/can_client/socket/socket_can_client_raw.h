@@ -115,6 +115,12 @@ class SocketCanClientRaw : public CanClient {
   CANCardParameter::CANInterface interface_;
   can_frame send_frames_[MAX_CAN_SEND_FRAME_LEN];
   can_frame recv_frames_[MAX_CAN_RECV_FRAME_LEN];
+  // scatter/gather descriptors for batched frame submission and reception
+  // with sendmmsg/recvmmsg; each entry points at the matching frame slot.
+  struct iovec send_iovs_[MAX_CAN_SEND_FRAME_LEN];
+  struct mmsghdr send_msgs_[MAX_CAN_SEND_FRAME_LEN];
+  struct iovec recv_iovs_[MAX_CAN_RECV_FRAME_LEN];
+  struct mmsghdr recv_msgs_[MAX_CAN_RECV_FRAME_LEN];
 };
 
 }  // namespace can
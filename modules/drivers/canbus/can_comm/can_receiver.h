@@ -169,12 +169,9 @@ void CanReceiver<SensorType>::RecvThreadFunc() {
     }
     receive_none_count = 0;
 
-    for (const auto &frame : buf) {
-      uint8_t len = frame.len;
-      uint32_t uid = frame.id;
-      const uint8_t *data = frame.data;
-      pt_manager_->Parse(uid, data, len);
-      if (enable_log_) {
+    pt_manager_->ParseBatch(buf);
+    if (enable_log_) {
+      for (const auto &frame : buf) {
         ADEBUG << "recv_can_frame#" << frame.CanFrameString();
       }
     }
@@ -38,6 +38,7 @@
 #include "modules/common/time/time.h"
 #include "modules/drivers/canbus/can_client/can_client.h"
 #include "modules/drivers/canbus/can_comm/protocol_data.h"
+#include "modules/drivers/canbus/common/canbus_consts.h"
 
 /**
  * @namespace apollo::drivers::canbus
@@ -290,6 +291,7 @@ void CanSender<SensorType>::PowerSendThreadFunc() {
     tm_start = absl::ToUnixMicros(common::time::Clock::Now());
     new_delta_period = INIT_PERIOD;
 
+    std::vector<CanFrame> can_frames;
     for (auto &message : send_messages_) {
       bool need_send = NeedSend(message, delta_period);
       message.UpdateCurrPeriod(delta_period);
@@ -298,14 +300,25 @@ void CanSender<SensorType>::PowerSendThreadFunc() {
       if (!need_send) {
         continue;
       }
-      std::vector<CanFrame> can_frames;
-      CanFrame can_frame = message.CanFrame();
-      can_frames.push_back(can_frame);
-      if (can_client_->SendSingleFrame(can_frames) != common::ErrorCode::OK) {
-        AERROR << "Send msg failed:" << can_frame.CanFrameString();
+      can_frames.push_back(message.CanFrame());
+    }
+    // Submit every frame due in this tick as one batch so the can client
+    // can hand them to the driver with a single syscall.
+    for (size_t start = 0; start < can_frames.size();
+         start += MAX_CAN_SEND_FRAME_LEN) {
+      const size_t batch_size = std::min(
+          can_frames.size() - start,
+          static_cast<size_t>(MAX_CAN_SEND_FRAME_LEN));
+      std::vector<CanFrame> batch(can_frames.begin() + start,
+                                  can_frames.begin() + start + batch_size);
+      int32_t frame_num = static_cast<int32_t>(batch_size);
+      if (can_client_->Send(batch, &frame_num) != common::ErrorCode::OK) {
+        AERROR << "Send msg batch failed, frame num: " << batch_size;
       }
       if (enable_log()) {
-        ADEBUG << "send_can_frame#" << can_frame.CanFrameString();
+        for (const auto &frame : batch) {
+          ADEBUG << "send_can_frame#" << frame.CanFrameString();
+        }
       }
     }
     delta_period = new_delta_period;
@@ -20,6 +20,7 @@
  */
 #pragma once
 
+#include <array>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -31,6 +32,7 @@
 #include "cyber/common/log.h"
 #include "modules/common/proto/error_code.pb.h"
 #include "modules/common/time/time.h"
+#include "modules/drivers/canbus/can_client/can_client.h"
 #include "modules/drivers/canbus/can_comm/protocol_data.h"
 #include "modules/drivers/canbus/common/byte.h"
 
@@ -85,6 +87,14 @@ class MessageManager {
   virtual void Parse(const uint32_t message_id, const uint8_t *data,
                      int32_t length);
 
+  /**
+   * @brief parse a burst of received frames, taking the sensor data lock
+   * once for the whole burst instead of once per frame. Subclasses that
+   * override Parse must override this as well.
+   * @param frames the received frames
+   */
+  virtual void ParseBatch(const std::vector<CanFrame> &frames);
+
   void ClearSensorData();
 
   std::condition_variable *GetMutableCVar();
@@ -116,9 +126,21 @@ class MessageManager {
   template <class T, bool need_check>
   void AddSendProtocolData();
 
+  // Dispatch lookup without the not-found log of
+  // GetMutableProtocolDataById; used on the per-frame receive path.
+  ProtocolData<SensorType> *GetProtocolDataById(const uint32_t message_id);
+
+  void UpdateCheckIdArg(const uint32_t message_id);
+
+  // The whole standard 11-bit id space fits a flat array, so received
+  // frames dispatch with one index instead of a hash lookup; extended ids
+  // fall back to protocol_data_map_.
+  static constexpr uint32_t kDispatchTableSize = 2048;
+
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> send_protocol_data_;
   std::vector<std::unique_ptr<ProtocolData<SensorType>>> recv_protocol_data_;
 
+  std::array<ProtocolData<SensorType> *, kDispatchTableSize> dispatch_table_{};
   std::unordered_map<uint32_t, ProtocolData<SensorType> *> protocol_data_map_;
   std::unordered_map<uint32_t, CheckIdArg> check_ids_;
   std::set<uint32_t> received_ids_;
@@ -139,6 +161,9 @@ void MessageManager<SensorType>::AddRecvProtocolData() {
     return;
   }
   protocol_data_map_[T::ID] = dt;
+  if (static_cast<uint32_t>(T::ID) < kDispatchTableSize) {
+    dispatch_table_[T::ID] = dt;
+  }
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
@@ -156,6 +181,9 @@ void MessageManager<SensorType>::AddSendProtocolData() {
     return;
   }
   protocol_data_map_[T::ID] = dt;
+  if (static_cast<uint32_t>(T::ID) < kDispatchTableSize) {
+    dispatch_table_[T::ID] = dt;
+  }
   if (need_check) {
     check_ids_[T::ID].period = dt->GetPeriod();
     check_ids_[T::ID].real_period = 0;
@@ -164,16 +192,26 @@ void MessageManager<SensorType>::AddSendProtocolData() {
   }
 }
 
+template <typename SensorType>
+ProtocolData<SensorType> *MessageManager<SensorType>::GetProtocolDataById(
+    const uint32_t message_id) {
+  if (message_id < kDispatchTableSize) {
+    return dispatch_table_[message_id];
+  }
+  const auto it = protocol_data_map_.find(message_id);
+  return it == protocol_data_map_.end() ? nullptr : it->second;
+}
+
 template <typename SensorType>
 ProtocolData<SensorType>
     *MessageManager<SensorType>::GetMutableProtocolDataById(
         const uint32_t message_id) {
-  if (protocol_data_map_.find(message_id) == protocol_data_map_.end()) {
+  ProtocolData<SensorType> *protocol_data = GetProtocolDataById(message_id);
+  if (protocol_data == nullptr) {
     ADEBUG << "Unable to get protocol data because of invalid message_id:"
            << Byte::byte_to_hex(message_id);
-    return nullptr;
   }
-  return protocol_data_map_[message_id];
+  return protocol_data;
 }
 
 template <typename SensorType>
@@ -189,6 +227,35 @@ void MessageManager<SensorType>::Parse(const uint32_t message_id,
     protocol_data->Parse(data, length, &sensor_data_);
   }
   received_ids_.insert(message_id);
+  UpdateCheckIdArg(message_id);
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::ParseBatch(
+    const std::vector<CanFrame> &frames) {
+  {
+    std::lock_guard<std::mutex> lock(sensor_data_mutex_);
+    for (const auto &frame : frames) {
+      ProtocolData<SensorType> *protocol_data = GetProtocolDataById(frame.id);
+      if (protocol_data == nullptr) {
+        ADEBUG << "Unable to parse frame because of invalid message_id:"
+               << Byte::byte_to_hex(frame.id);
+        continue;
+      }
+      protocol_data->Parse(frame.data, frame.len, &sensor_data_);
+    }
+  }
+  for (const auto &frame : frames) {
+    if (GetProtocolDataById(frame.id) == nullptr) {
+      continue;
+    }
+    received_ids_.insert(frame.id);
+    UpdateCheckIdArg(frame.id);
+  }
+}
+
+template <typename SensorType>
+void MessageManager<SensorType>::UpdateCheckIdArg(const uint32_t message_id) {
   // check if need to check period
   const auto it = check_ids_.find(message_id);
   if (it != check_ids_.end()) {
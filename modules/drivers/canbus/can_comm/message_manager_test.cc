@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -58,6 +59,25 @@ TEST(MessageManagerTest, GetMutableProtocolDataById) {
   EXPECT_EQ(manager.GetSensorData(nullptr), ErrorCode::CANBUS_ERROR);
 }
 
+TEST(MessageManagerTest, ParseBatch) {
+  MockMessageManager manager;
+  CanFrame known_frame;
+  known_frame.id = MockProtocolData::ID;
+  known_frame.len = 8;
+  CanFrame unknown_frame;
+  unknown_frame.id = 0x7ff;
+  unknown_frame.len = 8;
+  std::vector<CanFrame> frames = {known_frame, unknown_frame, known_frame};
+  manager.ParseBatch(frames);
+
+  // only the registered id is dispatched; the unknown one is skipped
+  EXPECT_NE(manager.GetMutableProtocolDataById(MockProtocolData::ID), nullptr);
+  EXPECT_EQ(manager.GetMutableProtocolDataById(0x7ff), nullptr);
+
+  ::apollo::canbus::ChassisDetail chassis_detail;
+  EXPECT_EQ(manager.GetSensorData(&chassis_detail), ErrorCode::OK);
+}
+
 }  // namespace canbus
 }  // namespace drivers
 }  // namespace apollo
@@ -102,6 +102,13 @@ bool DataParser::Init() {
   rawimu_writer_ = node_->CreateWriter<Imu>(FLAGS_raw_imu_topic);
   gps_writer_ = node_->CreateWriter<Gps>(FLAGS_gps_topic);
 
+  imu_pool_.reset(new CCObjectPool<Imu>(pool_size_));
+  imu_pool_->ConstructAll();
+  corrimu_pool_.reset(new CCObjectPool<CorrectedImu>(pool_size_));
+  corrimu_pool_->ConstructAll();
+  gps_pool_.reset(new CCObjectPool<Gps>(pool_size_));
+  gps_pool_->ConstructAll();
+
   common::util::FillHeader("gnss", &ins_status_);
   insstatus_writer_->Write(ins_status_);
   common::util::FillHeader("gnss", &gnss_status_);
@@ -235,7 +242,12 @@ void DataParser::PublishBestpos(const MessagePtr message) {
 }
 
 void DataParser::PublishImu(const MessagePtr message) {
-  auto raw_imu = std::make_shared<Imu>(*As<Imu>(message));
+  auto raw_imu = imu_pool_->GetObject();
+  if (raw_imu == nullptr) {
+    AWARN << "imu pool return nullptr, will be create new.";
+    raw_imu = std::make_shared<Imu>();
+  }
+  raw_imu->CopyFrom(*As<Imu>(message));
   Imu *imu = As<Imu>(message);
 
   raw_imu->mutable_linear_acceleration()->set_x(
@@ -253,7 +265,12 @@ void DataParser::PublishImu(const MessagePtr message) {
 
 void DataParser::PublishOdometry(const MessagePtr message) {
   Ins *ins = As<Ins>(message);
-  auto gps = std::make_shared<Gps>();
+  auto gps = gps_pool_->GetObject();
+  if (gps == nullptr) {
+    AWARN << "gps pool return nullptr, will be create new.";
+    gps = std::make_shared<Gps>();
+  }
+  gps->Clear();
 
   double unix_sec = apollo::drivers::util::gps2unix(ins->measurement_time());
   gps->mutable_header()->set_timestamp_sec(unix_sec);
@@ -297,7 +314,12 @@ void DataParser::PublishOdometry(const MessagePtr message) {
 
 void DataParser::PublishCorrimu(const MessagePtr message) {
   Ins *ins = As<Ins>(message);
-  auto imu = std::make_shared<CorrectedImu>();
+  auto imu = corrimu_pool_->GetObject();
+  if (imu == nullptr) {
+    AWARN << "corrimu pool return nullptr, will be create new.";
+    imu = std::make_shared<CorrectedImu>();
+  }
+  imu->Clear();
   double unix_sec = apollo::drivers::util::gps2unix(ins->measurement_time());
   imu->mutable_header()->set_timestamp_sec(unix_sec);
 
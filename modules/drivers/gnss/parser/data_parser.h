@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 
+#include "cyber/base/concurrent_object_pool.h"
 #include "cyber/cyber.h"
 #include "modules/transform/transform_broadcaster.h"
 
@@ -40,6 +41,8 @@ namespace apollo {
 namespace drivers {
 namespace gnss {
 
+using apollo::cyber::base::CCObjectPool;
+
 class DataParser {
  public:
   using MessagePtr = ::google::protobuf::Message *;
@@ -93,6 +96,15 @@ class DataParser {
   std::shared_ptr<apollo::cyber::Writer<EpochObservation>>
       epochobservation_writer_ = nullptr;
   std::shared_ptr<apollo::cyber::Writer<Heading>> heading_writer_ = nullptr;
+
+  // Message pools for the high-rate publications (raw imu, corrected imu
+  // and odometry). A message goes back to its pool once all readers drop
+  // it, keeping the 200Hz paths off the heap.
+  int pool_size_ = 32;
+  std::shared_ptr<CCObjectPool<Imu>> imu_pool_ = nullptr;
+  std::shared_ptr<CCObjectPool<apollo::localization::CorrectedImu>>
+      corrimu_pool_ = nullptr;
+  std::shared_ptr<CCObjectPool<apollo::localization::Gps>> gps_pool_ = nullptr;
 };
 
 }  // namespace gnss
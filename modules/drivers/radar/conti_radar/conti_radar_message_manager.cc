@@ -149,6 +149,15 @@ void ContiRadarMessageManager::Parse(const uint32_t message_id,
   }
 }
 
+void ContiRadarMessageManager::ParseBatch(
+    const std::vector<canbus::CanFrame> &frames) {
+  // parsing publishes a radar frame when the trigger message arrives, so
+  // the burst stays frame by frame instead of the batched fast path
+  for (const auto &frame : frames) {
+    Parse(frame.id, frame.data, frame.len);
+  }
+}
+
 }  // namespace conti_radar
 }  // namespace drivers
 }  // namespace apollo
@@ -147,6 +147,15 @@ void RacobitRadarMessageManager::Parse(const uint32_t message_id,
   }
 }
 
+void RacobitRadarMessageManager::ParseBatch(
+    const std::vector<canbus::CanFrame> &frames) {
+  // parsing publishes a radar frame when the trigger message arrives, so
+  // the burst stays frame by frame instead of the batched fast path
+  for (const auto &frame : frames) {
+    Parse(frame.id, frame.data, frame.len);
+  }
+}
+
 }  // namespace racobit_radar
 }  // namespace drivers
 }  // namespace apollo
@@ -78,6 +78,15 @@ void UltrasonicRadarMessageManager::Parse(const uint32_t message_id,
   }
 }
 
+void UltrasonicRadarMessageManager::ParseBatch(
+    const std::vector<canbus::CanFrame> &frames) {
+  // parsing publishes a sensor frame when the last entrance message
+  // arrives, so the burst stays frame by frame instead of the batched path
+  for (const auto &frame : frames) {
+    Parse(frame.id, frame.data, frame.len);
+  }
+}
+
 }  // namespace ultrasonic_radar
 }  // namespace drivers
 }  // namespace apollo
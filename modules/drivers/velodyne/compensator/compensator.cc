@@ -36,25 +36,12 @@ bool Compensator::QueryPoseAffineFromTF2(const uint64_t& timestamp, void* pose,
     return false;
   }
 
-  apollo::transform::TransformStamped stamped_transform;
-
-  try {
-    stamped_transform = tf2_buffer_ptr_->lookupTransform(
-        config_.world_frame_id(), child_frame_id, query_time);
-  } catch (tf2::TransformException& ex) {
-    AERROR << ex.what();
+  Eigen::Affine3d* tmp_pose = (Eigen::Affine3d*)pose;
+  if (!tf2_buffer_ptr_->QueryPose(config_.world_frame_id(), child_frame_id,
+                                  query_time, tmp_pose, &err_string)) {
+    AERROR << err_string;
     return false;
   }
-
-  Eigen::Affine3d* tmp_pose = (Eigen::Affine3d*)pose;
-  *tmp_pose =
-      Eigen::Translation3d(stamped_transform.transform().translation().x(),
-                           stamped_transform.transform().translation().y(),
-                           stamped_transform.transform().translation().z()) *
-      Eigen::Quaterniond(stamped_transform.transform().rotation().qw(),
-                         stamped_transform.transform().rotation().qx(),
-                         stamped_transform.transform().rotation().qy(),
-                         stamped_transform.transform().rotation().qz());
   return true;
 }
 
@@ -157,9 +144,39 @@ void Compensator::MotionCompensation(
     double theta = acos(abs_d);
     double sin_theta = sin(theta);
     double c1_sign = (d > 0) ? 1 : -1;
+    // All lasers of one firing share a timestamp, so one pose is
+    // interpolated per run of equal timestamps, and each run is applied as
+    // a single 3xN matrix product which Eigen vectorizes, instead of
+    // transforming point by point.
+    constexpr int kMaxBatchSize = 64;
+    Eigen::Matrix<double, 3, kMaxBatchSize> batch;
+    const apollo::drivers::PointXYZIT* batch_points[kMaxBatchSize];
+    int batch_size = 0;
+    uint64_t last_tp = 0;
+    bool has_trans = false;
+    Eigen::Matrix3d rotation = Eigen::Matrix3d::Identity();
+    Eigen::Vector3d offset = Eigen::Vector3d::Zero();
+    auto flush_batch = [&]() {
+      if (batch_size == 0) {
+        return;
+      }
+      auto block = batch.leftCols(batch_size);
+      block = (rotation * block).colwise() + offset;
+      for (int i = 0; i < batch_size; ++i) {
+        auto* point_new = msg_compensated->add_point();
+        point_new->set_intensity(batch_points[i]->intensity());
+        point_new->set_timestamp(batch_points[i]->timestamp());
+        point_new->set_x(static_cast<float>(batch(0, i)));
+        point_new->set_y(static_cast<float>(batch(1, i)));
+        point_new->set_z(static_cast<float>(batch(2, i)));
+      }
+      batch_size = 0;
+    };
     for (const auto& point : msg->point()) {
       float x_scalar = point.x();
       if (std::isnan(x_scalar)) {
+        // The pending batch is flushed first to keep the point order.
+        flush_batch();
         // if (config_.organized()) {
         auto* point_new = msg_compensated->add_point();
         point_new->CopyFrom(point);
@@ -168,32 +185,36 @@ void Compensator::MotionCompensation(
         // }
         continue;
       }
-      float y_scalar = point.y();
-      float z_scalar = point.z();
-      Eigen::Vector3d p(x_scalar, y_scalar, z_scalar);
 
       uint64_t tp = point.timestamp();
-      double t = static_cast<double>(timestamp_max - tp) * f;
-
-      Eigen::Translation3d ti(t * translation);
-
-      double c0 = sin((1 - t) * theta) / sin_theta;
-      double c1 = sin(t * theta) / sin_theta * c1_sign;
-      Eigen::Quaterniond qi(c0 * q0.coeffs() + c1 * q1.coeffs());
-
-      Eigen::Affine3d trans = ti * qi;
-      p = trans * p;
-
-      auto* point_new = msg_compensated->add_point();
-      point_new->set_intensity(point.intensity());
-      point_new->set_timestamp(point.timestamp());
-      point_new->set_x(static_cast<float>(p.x()));
-      point_new->set_y(static_cast<float>(p.y()));
-      point_new->set_z(static_cast<float>(p.z()));
+      if (!has_trans || tp != last_tp) {
+        flush_batch();
+        double t = static_cast<double>(timestamp_max - tp) * f;
+
+        double c0 = sin((1 - t) * theta) / sin_theta;
+        double c1 = sin(t * theta) / sin_theta * c1_sign;
+        Eigen::Quaterniond qi(c0 * q0.coeffs() + c1 * q1.coeffs());
+
+        rotation = qi.toRotationMatrix();
+        offset = t * translation;
+        last_tp = tp;
+        has_trans = true;
+      } else if (batch_size == kMaxBatchSize) {
+        flush_batch();
+      }
+      batch_points[batch_size] = &point;
+      batch(0, batch_size) = point.x();
+      batch(1, batch_size) = point.y();
+      batch(2, batch_size) = point.z();
+      ++batch_size;
     }
+    flush_batch();
     return;
   }
   // Not a "significant" rotation. Do translation only.
+  uint64_t last_tp = 0;
+  bool has_offset = false;
+  Eigen::Vector3d offset = Eigen::Vector3d::Zero();
   for (auto& point : msg->point()) {
     float x_scalar = point.x();
     if (std::isnan(x_scalar)) {
@@ -205,10 +226,14 @@ void Compensator::MotionCompensation(
     Eigen::Vector3d p(x_scalar, y_scalar, z_scalar);
 
     uint64_t tp = point.timestamp();
-    double t = static_cast<double>(timestamp_max - tp) * f;
-    Eigen::Translation3d ti(t * translation);
+    if (!has_offset || tp != last_tp) {
+      double t = static_cast<double>(timestamp_max - tp) * f;
+      offset = t * translation;
+      last_tp = tp;
+      has_offset = true;
+    }
 
-    p = ti * p;
+    p += offset;
 
     auto* point_new = msg_compensated->add_point();
     point_new->set_intensity(point.intensity());
@@ -86,6 +86,23 @@ void SocketInput::init(const int &port) {
     return;
   }
 
+  // Enlarge the kernel receive buffer so packet bursts survive system
+  // load spikes that delay the reader.
+  const int rbuf = 4 * 1024 * 1024;
+  if (setsockopt(sockfd_, SOL_SOCKET, SO_RCVBUF, &rbuf, sizeof(int)) < 0) {
+    AERROR << "Failed to enlarge socket receive buffer. Port " << port_;
+  }
+
+  memset(ring_msgs_, 0, sizeof(ring_msgs_));
+  for (int i = 0; i < kPacketRingSize; ++i) {
+    ring_iovs_[i].iov_base = ring_data_[i];
+    ring_iovs_[i].iov_len = FIRING_DATA_PACKET_SIZE;
+    ring_msgs_[i].msg_hdr.msg_iov = &ring_iovs_[i];
+    ring_msgs_[i].msg_hdr.msg_iovlen = 1;
+  }
+  ring_head_ = 0;
+  ring_size_ = 0;
+
   AINFO << "Velodyne socket fd is " << sockfd_ << ", port " << port_;
 }
 
@@ -94,30 +111,37 @@ int SocketInput::get_firing_data_packet(VelodynePacket *pkt) {
   // double time1 = ros::Time::now().toSec();
   double time1 = apollo::cyber::Time().Now().ToSecond();
   while (true) {
+    // Hand out a packet drained by an earlier recvmmsg() first.
+    if (ring_head_ < ring_size_) {
+      const int slot = ring_head_++;
+      unsigned int nbytes = ring_msgs_[slot].msg_len;
+      if (nbytes == FIRING_DATA_PACKET_SIZE) {
+        pkt->set_data(ring_data_[slot], FIRING_DATA_PACKET_SIZE);
+        break;
+      }
+      AERROR << "Incomplete Velodyne rising data packet read: " << nbytes
+             << " bytes from port " << port_;
+      continue;
+    }
+
     if (!input_available(POLL_TIMEOUT)) {
       return SOCKET_TIMEOUT;
     }
-    // Receive packets that should now be available from the
-    // socket using a blocking read.
-    uint8_t bytes[FIRING_DATA_PACKET_SIZE];
-    ssize_t nbytes =
-        recvfrom(sockfd_, bytes, FIRING_DATA_PACKET_SIZE, 0, nullptr, nullptr);
+    // Drain all packets that queued up in the kernel with one syscall,
+    // so intake keeps up with the wire even when the reader was delayed.
+    int num_msgs =
+        recvmmsg(sockfd_, ring_msgs_, kPacketRingSize, MSG_DONTWAIT, nullptr);
 
-    if (nbytes < 0) {
+    if (num_msgs < 0) {
       if (errno != EWOULDBLOCK) {
         AERROR << "recvfail from port " << port_;
         return RECIEVE_FAIL;
       }
+      continue;
     }
 
-    if ((size_t)nbytes == FIRING_DATA_PACKET_SIZE) {
-      // read successful, done now
-      pkt->set_data(bytes, FIRING_DATA_PACKET_SIZE);
-      break;
-    }
-
-    AERROR << "Incomplete Velodyne rising data packet read: " << nbytes
-           << " bytes from port " << port_;
+    ring_head_ = 0;
+    ring_size_ = num_msgs;
   }
   double time2 = apollo::cyber::Time().Now().ToSecond();
   pkt->set_stamp(apollo::cyber::Time((time2 + time1) / 2.0).ToNanosecond());
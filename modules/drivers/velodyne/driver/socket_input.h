@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <sys/socket.h>
 #include <unistd.h>
 #include <cstdio>
 
@@ -44,6 +45,16 @@ class SocketInput : public Input {
   int sockfd_;
   int port_;
   bool input_available(int timeout);
+
+  // Firing packet receive ring: one recvmmsg() call drains up to
+  // kPacketRingSize packets queued in the kernel, which are then handed
+  // out one by one without further syscalls.
+  static const int kPacketRingSize = 32;
+  uint8_t ring_data_[kPacketRingSize][FIRING_DATA_PACKET_SIZE];
+  struct mmsghdr ring_msgs_[kPacketRingSize];
+  struct iovec ring_iovs_[kPacketRingSize];
+  int ring_head_ = 0;
+  int ring_size_ = 0;
 };
 
 }  // namespace velodyne
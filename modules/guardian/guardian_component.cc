@@ -52,6 +52,17 @@ bool GuardianComponent::Init() {
       [this](const std::shared_ptr<SystemStatus>& status) {
         ADEBUG << "Received system status data: run system status callback.";
         std::lock_guard<std::mutex> lock(mutex_);
+        // Guardian only consumes the safety-mode fields, while SystemStatus
+        // carries the full per-component report. Skip the copy when the
+        // consumed state matches the previous message.
+        if (status->has_safety_mode_trigger_time() ==
+                system_status_.has_safety_mode_trigger_time() &&
+            status->safety_mode_trigger_time() ==
+                system_status_.safety_mode_trigger_time() &&
+            status->require_emergency_stop() ==
+                system_status_.require_emergency_stop()) {
+          return;
+        }
         system_status_.CopyFrom(*status);
       });
 
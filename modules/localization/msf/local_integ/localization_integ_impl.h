@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "modules/common/status/status.h"
 #include "modules/localization/msf/local_integ/localization_gnss_process.h"
 #include "modules/localization/msf/local_integ/localization_integ.h"
@@ -106,8 +108,10 @@ class LocalizationIntegImpl {
 
   bool is_use_gnss_bestpose_ = true;
 
-  double imu_altitude_from_lidar_localization_ = 0.0;
-  bool imu_altitude_from_lidar_localization_available_ = false;
+  // Written by the lidar measurement path and read at IMU rate; atomics
+  // keep the handoff tear-free without a lock on the 200Hz pose path.
+  std::atomic<double> imu_altitude_from_lidar_localization_{0.0};
+  std::atomic<bool> imu_altitude_from_lidar_localization_available_{false};
 
   bool enable_lidar_localization_ = true;
   Eigen::Affine3d gnss_antenna_extrinsic_;
@@ -274,6 +274,8 @@ void LocalizationIntegProcess::StopThreadLoop() {
 void LocalizationIntegProcess::MeasureDataThreadLoop() {
   AINFO << "Started measure data process thread";
   while (keep_running_.load()) {
+    MeasureData measure;
+    int waiting_num = 0;
     {
       std::unique_lock<std::mutex> lock(measure_data_queue_mutex_);
       int size = static_cast<int>(measure_data_queue_.size());
@@ -286,12 +288,6 @@ void LocalizationIntegProcess::MeasureDataThreadLoop() {
         cyber::Yield();
         continue;
       }
-    }
-
-    MeasureData measure;
-    int waiting_num = 0;
-    {
-      std::unique_lock<std::mutex> lock(measure_data_queue_mutex_);
       measure = measure_data_queue_.front();
       measure_data_queue_.pop();
       waiting_num = static_cast<int>(measure_data_queue_.size());
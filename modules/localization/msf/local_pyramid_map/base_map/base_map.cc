@@ -74,16 +74,32 @@ BaseMapNode* BaseMap::GetMapNodeSafe(const MapNodeIndex& index) {
   }
   lock2.unlock();
 
+  // if the node is being preloaded, wait for that task rather than
+  // loading the same node once more
+  boost::unique_lock<boost::recursive_mutex> lock3(map_load_mutex_);
+  if (map_preloading_task_index_.count(index) > 0) {
+    while (map_preloading_task_index_.count(index) > 0) {
+      preload_task_finished_cv_.wait(lock3);
+    }
+    if (map_node_cache_lvl2_->Get(index, &node)) {
+      node->SetIsReserved(true);
+      map_node_cache_lvl1_->Put(index, node);
+      lock3.unlock();
+      return node;
+    }
+  }
+  lock3.unlock();
+
   // load from disk
   std::cerr << "GetMapNodeSafe: This node don't exist in cache! " << std::endl
             << "load this node from disk now!" << index << std::endl;
 
   LoadMapNodeThreadSafety(index, true);
 
-  boost::unique_lock<boost::recursive_mutex> lock3(map_load_mutex_);
+  boost::unique_lock<boost::recursive_mutex> lock4(map_load_mutex_);
   map_node_cache_lvl2_->Get(index, &node);
   map_node_cache_lvl1_->Put(index, node);
-  lock3.unlock();
+  lock4.unlock();
 
   return node;
 }
@@ -134,6 +150,18 @@ void BaseMap::LoadMapNodes(std::set<MapNodeIndex>* map_ids) {
   }
   // check and update cache
   CheckAndUpdateCache(map_ids);
+  // wait for the in-flight preloading tasks covering the needed nodes,
+  // instead of reading the same node files from disk again
+  itr = map_ids->begin();
+  while (itr != map_ids->end()) {
+    boost::unique_lock<boost::recursive_mutex> lock(map_load_mutex_);
+    while (map_preloading_task_index_.count(*itr) > 0) {
+      preload_task_finished_cv_.wait(lock);
+    }
+    lock.unlock();
+    ++itr;
+  }
+  CheckAndUpdateCache(map_ids);
   // load from disk sync
   std::vector<std::future<void>> load_futures_;
   itr = map_ids->begin();
@@ -245,6 +273,7 @@ void BaseMap::LoadMapNodeThreadSafety(const MapNodeIndex& index,
   auto itr = map_preloading_task_index_.find(index);
   if (itr != map_preloading_task_index_.end()) {
     map_preloading_task_index_.erase(itr);
+    preload_task_finished_cv_.notify_all();
   }
   lock.unlock();
   if (node_remove) {
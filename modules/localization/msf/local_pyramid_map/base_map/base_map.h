@@ -136,6 +136,9 @@ class BaseMap {
   std::set<MapNodeIndex> map_preloading_task_index_;
   /**@brief The mutex for preload map node. **/
   boost::recursive_mutex map_load_mutex_;
+  /**@brief Signaled whenever a preloading task finishes, so that loaders
+   * needing such a node can wait for it instead of reading it again. **/
+  boost::condition_variable_any preload_task_finished_cv_;
 
   /**@brief All the map nodes in the Map (in the disk). */
   std::vector<MapNodeIndex> all_map_node_indices_;
@@ -498,7 +498,6 @@ NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
     Eigen::Matrix<double, 6, 1> *score_gradient,
     Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
     const Eigen::Matrix3d &c_inv, bool compute_hessian) {
-  Eigen::Vector3d cov_dxd_pi;
   // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9 [Magnusson
   // 2009]
   double e_x_cov_x = exp(-gauss_d2_ * x_trans.dot(c_inv * x_trans) / 2);
@@ -516,23 +515,26 @@ NormalDistributionsTransform<PointSource, PointTarget>::UpdateDerivatives(
   // Reusable portion of Equation 6.12 and 6.13 [Magnusson 2009]
   e_x_cov_x *= gauss_d1_;
 
-  for (int i = 0; i < 6; i++) {
-    // Sigma_k^-1 d(T(x,p))/dpi, Reusable portion of Equation 6.12 and 6.13
-    // [Magnusson 2009]
-    cov_dxd_pi = c_inv * point_gradient_.col(i);
+  // Sigma_k^-1 d(T(x,p))/dpi for all six parameters at once; the scalar
+  // products with x_trans are shared between the gradient and every
+  // hessian entry, so compute them only once per point-voxel pair.
+  const Eigen::Matrix<double, 3, 6> cov_dxd = c_inv * point_gradient_;
+  const Eigen::Matrix<double, 1, 6> x_trans_cov_dxd =
+      x_trans.transpose() * cov_dxd;
+  const Eigen::RowVector3d x_trans_c_inv = x_trans.transpose() * c_inv;
 
+  for (int i = 0; i < 6; i++) {
     // Update gradient, Equation 6.12 [Magnusson 2009]
-    (*score_gradient)(i) += x_trans.dot(cov_dxd_pi) * e_x_cov_x;
+    (*score_gradient)(i) += x_trans_cov_dxd(i) * e_x_cov_x;
 
     if (compute_hessian) {
       for (int j = 0; j < hessian->cols(); j++) {
         // Update hessian, Equation 6.13 [Magnusson 2009]
         (*hessian)(i, j) +=
             e_x_cov_x *
-            (-gauss_d2_ * x_trans.dot(cov_dxd_pi) *
-                 x_trans.dot(c_inv * point_gradient_.col(j)) +
-             x_trans.dot(c_inv * point_hessian_.block<3, 1>(3 * i, j)) +
-             point_gradient_.col(j).dot(cov_dxd_pi));
+            (-gauss_d2_ * x_trans_cov_dxd(i) * x_trans_cov_dxd(j) +
+             x_trans_c_inv.dot(point_hessian_.block<3, 1>(3 * i, j)) +
+             point_gradient_.col(j).dot(cov_dxd.col(i)));
       }
     }
   }
@@ -601,7 +603,6 @@ template <typename PointSource, typename PointTarget>
 void NormalDistributionsTransform<PointSource, PointTarget>::UpdateHessian(
     Eigen::Matrix<double, 6, 6> *hessian, const Eigen::Vector3d &x_trans,
     const Eigen::Matrix3d &c_inv) {
-  Eigen::Vector3d cov_dxd_pi;
   // e^(-d_2/2 * (x_k - mu_k)^T Sigma_k^-1 (x_k - mu_k)) Equation 6.9
   // [Magnusson 2009]
   double e_x_cov_x =
@@ -615,19 +616,20 @@ void NormalDistributionsTransform<PointSource, PointTarget>::UpdateHessian(
   // Reusable portion of Equation 6.12 and 6.13 [Magnusson 2009]
   e_x_cov_x *= gauss_d1_;
 
-  for (int i = 0; i < 6; i++) {
-    // Sigma_k^-1 d(T(x,p))/dpi, Reusable portion of Equation 6.12 and 6.13
-    // [Magnusson 2009]
-    cov_dxd_pi = c_inv * point_gradient_.col(i);
+  // Shared per point-voxel pair products, see UpdateDerivatives.
+  const Eigen::Matrix<double, 3, 6> cov_dxd = c_inv * point_gradient_;
+  const Eigen::Matrix<double, 1, 6> x_trans_cov_dxd =
+      x_trans.transpose() * cov_dxd;
+  const Eigen::RowVector3d x_trans_c_inv = x_trans.transpose() * c_inv;
 
+  for (int i = 0; i < 6; i++) {
     for (int j = 0; j < hessian->cols(); j++) {
       // Update hessian, Equation 6.13 [Magnusson 2009]
       (*hessian)(i, j) +=
           e_x_cov_x *
-          (-gauss_d2_ * x_trans.dot(cov_dxd_pi) *
-               x_trans.dot(c_inv * point_gradient_.col(j)) +
-           x_trans.dot(c_inv * point_hessian_.block<3, 1>(3 * i, j)) +
-           point_gradient_.col(j).dot(cov_dxd_pi));
+          (-gauss_d2_ * x_trans_cov_dxd(i) * x_trans_cov_dxd(j) +
+           x_trans_c_inv.dot(point_hessian_.block<3, 1>(3 * i, j)) +
+           point_gradient_.col(j).dot(cov_dxd.col(i)));
     }
   }
 }
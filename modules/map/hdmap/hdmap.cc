@@ -139,6 +139,11 @@ int HDMap::GetPNCJunctions(
   return impl_.GetPNCJunctions(point, distance, pnc_junctions);
 }
 
+int HDMap::GetMapObjects(const apollo::common::PointENU& point,
+                         double distance, MapObjects* map_objects) const {
+  return impl_.GetMapObjects(point, distance, map_objects);
+}
+
 int HDMap::GetNearestLane(const common::PointENU& point,
                           LaneInfoConstPtr* nearest_lane, double* nearest_s,
                           double* nearest_l) const {
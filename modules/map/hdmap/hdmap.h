@@ -180,6 +180,16 @@ class HDMap {
   int GetPNCJunctions(
       const apollo::common::PointENU& point, double distance,
       std::vector<PNCJunctionInfoConstPtr>* pnc_junctions) const;
+  /**
+   * @brief get map objects of all types in certain range in one call,
+   * refilling the caller-provided reusable buffers
+   * @param point the central point of the range
+   * @param distance the search radius
+   * @param map_objects reusable buffers storing all objects in target range
+   * @return 0:success, otherwise failed
+   */
+  int GetMapObjects(const apollo::common::PointENU& point, double distance,
+                    MapObjects* map_objects) const;
   /**
    * @brief get nearest lane from target point,
    * @param point the target point
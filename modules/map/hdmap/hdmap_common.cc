@@ -48,6 +48,40 @@ constexpr double kEpsilon = 0.1;
 // Minimum y-coordinate of utm
 // const double kMinYCoordinate = 0;
 
+// Returns the index i of the interval [keys[i], keys[i + 1]) containing s.
+// When index_hint is provided and points at or just before the target
+// interval, the lookup is O(1) and the hint is advanced in place; otherwise
+// it falls back to a branch-free binary search whose per-step interval
+// update compiles to a conditional move.
+int FindIntervalIndex(const std::vector<double> &keys, const double s,
+                      int *index_hint) {
+  const int max_index = static_cast<int>(keys.size()) - 2;
+  if (max_index < 0) {
+    return 0;
+  }
+  if (index_hint != nullptr) {
+    int hint = std::min(std::max(*index_hint, 0), max_index);
+    if (hint < max_index && keys[hint + 1] <= s) {
+      ++hint;
+    }
+    if (keys[hint] <= s && (hint == max_index || s < keys[hint + 1])) {
+      *index_hint = hint;
+      return hint;
+    }
+  }
+  int low = 0;
+  int count = max_index + 1;
+  while (count > 1) {
+    const int half = count / 2;
+    low = (keys[low + half] <= s) ? low + half : low;
+    count -= half;
+  }
+  if (index_hint != nullptr) {
+    *index_hint = low;
+  }
+  return low;
+}
+
 bool IsPointValid(const PointENU &point) {
   /* if (point.x() > kMaxXCoordinate || point.x() < kMinXCoordinate) {
     return false;
@@ -202,16 +236,46 @@ void LaneInfo::Init() {
     sampled_right_road_width_.emplace_back(sample.s(), sample.width());
   }
 
+  // compile the width samples into cache-contiguous lookup tables once at
+  // load time; the pair vectors stay around to back the public accessors
+  CompileWidthSampleTable(sampled_left_width_, &left_width_table_);
+  CompileWidthSampleTable(sampled_right_width_, &right_width_table_);
+  CompileWidthSampleTable(sampled_left_road_width_, &left_road_width_table_);
+  CompileWidthSampleTable(sampled_right_road_width_, &right_road_width_table_);
+
   CreateKDTree();
 }
 
+void LaneInfo::CompileWidthSampleTable(
+    const std::vector<SampledWidth> &samples, WidthSampleTable *table) {
+  table->s.clear();
+  table->width.clear();
+  table->s.reserve(samples.size());
+  table->width.reserve(samples.size());
+  for (const auto &sample : samples) {
+    table->s.push_back(sample.first);
+    table->width.push_back(sample.second);
+  }
+}
+
 void LaneInfo::GetWidth(const double s, double *left_width,
                         double *right_width) const {
   if (left_width != nullptr) {
-    *left_width = GetWidthFromSample(sampled_left_width_, s);
+    *left_width = GetWidthFromSample(left_width_table_, s, nullptr);
+  }
+  if (right_width != nullptr) {
+    *right_width = GetWidthFromSample(right_width_table_, s, nullptr);
+  }
+}
+
+void LaneInfo::GetWidth(const double s, int *left_index_hint,
+                        int *right_index_hint, double *left_width,
+                        double *right_width) const {
+  if (left_width != nullptr) {
+    *left_width = GetWidthFromSample(left_width_table_, s, left_index_hint);
   }
   if (right_width != nullptr) {
-    *right_width = GetWidthFromSample(sampled_right_width_, s);
+    *right_width = GetWidthFromSample(right_width_table_, s, right_index_hint);
   }
 }
 
@@ -235,6 +299,26 @@ double LaneInfo::Heading(const double s) const {
                              headings_[index], accumulated_s_[index], s);
 }
 
+double LaneInfo::Heading(const double s, int *index_hint) const {
+  const double kEpsilon = 0.001;
+  if (s + kEpsilon < accumulated_s_.front()) {
+    AERROR << "s:" << s << " should be >= " << accumulated_s_.front();
+    return 0.0;
+  }
+  if (s - kEpsilon > accumulated_s_.back()) {
+    AERROR << "s:" << s << " should be <= " << accumulated_s_.back();
+    return 0.0;
+  }
+
+  const int index = FindIntervalIndex(accumulated_s_, s, index_hint);
+  if (accumulated_s_[index + 1] - s <= common::math::kMathEpsilon) {
+    return headings_[index + 1];
+  }
+  return common::math::slerp(headings_[index], accumulated_s_[index],
+                             headings_[index + 1], accumulated_s_[index + 1],
+                             s);
+}
+
 double LaneInfo::Curvature(const double s) const {
   if (points_.size() < 2) {
     AERROR << "Not enough points to compute curvature.";
@@ -281,10 +365,10 @@ double LaneInfo::GetEffectiveWidth(const double s) const {
 void LaneInfo::GetRoadWidth(const double s, double *left_width,
                             double *right_width) const {
   if (left_width != nullptr) {
-    *left_width = GetWidthFromSample(sampled_left_road_width_, s);
+    *left_width = GetWidthFromSample(left_road_width_table_, s, nullptr);
   }
   if (right_width != nullptr) {
-    *right_width = GetWidthFromSample(sampled_right_road_width_, s);
+    *right_width = GetWidthFromSample(right_road_width_table_, s, nullptr);
   }
 }
 
@@ -295,31 +379,22 @@ double LaneInfo::GetRoadWidth(const double s) const {
   return left_width + right_width;
 }
 
-double LaneInfo::GetWidthFromSample(
-    const std::vector<LaneInfo::SampledWidth> &samples, const double s) const {
-  if (samples.empty()) {
+double LaneInfo::GetWidthFromSample(const WidthSampleTable &samples,
+                                    const double s, int *index_hint) const {
+  if (samples.s.empty()) {
     return 0.0;
   }
-  if (s <= samples[0].first) {
-    return samples[0].second;
+  if (s <= samples.s.front()) {
+    return samples.width.front();
   }
-  if (s >= samples.back().first) {
-    return samples.back().second;
-  }
-  int low = 0;
-  int high = static_cast<int>(samples.size());
-  while (low + 1 < high) {
-    const int mid = (low + high) / 2;
-    if (samples[mid].first <= s) {
-      low = mid;
-    } else {
-      high = mid;
-    }
+  if (s >= samples.s.back()) {
+    return samples.width.back();
   }
-  const LaneInfo::SampledWidth &sample1 = samples[low];
-  const LaneInfo::SampledWidth &sample2 = samples[high];
-  const double ratio = (sample2.first - s) / (sample2.first - sample1.first);
-  return sample1.second * ratio + sample2.second * (1.0 - ratio);
+  const int low = FindIntervalIndex(samples.s, s, index_hint);
+  const int high = low + 1;
+  const double ratio =
+      (samples.s[high] - s) / (samples.s[high] - samples.s[low]);
+  return samples.width[low] * ratio + samples.width[high] * (1.0 - ratio);
 }
 
 bool LaneInfo::IsOnLane(const Vec2d &point) const {
@@ -150,6 +150,10 @@ class LaneInfo {
     return unit_directions_;
   }
   double Heading(const double s) const;
+  // Variant for callers walking monotonically along the lane: *index_hint
+  // caches the segment index of the previous query and makes consecutive
+  // lookups O(1); a stale hint falls back to binary search.
+  double Heading(const double s, int *index_hint) const;
   double Curvature(const double s) const;
   const std::vector<double> &headings() const { return headings_; }
   const std::vector<apollo::common::math::LineSegment2d> &segments() const {
@@ -194,6 +198,10 @@ class LaneInfo {
     return sampled_right_width_;
   }
   void GetWidth(const double s, double *left_width, double *right_width) const;
+  // Hint-based variant; see Heading(s, index_hint). The left and right
+  // samples are searched independently, so each side keeps its own hint.
+  void GetWidth(const double s, int *left_index_hint, int *right_index_hint,
+                double *left_width, double *right_width) const;
   double GetWidth(const double s) const;
   double GetEffectiveWidth(const double s) const;
 
@@ -223,11 +231,20 @@ class LaneInfo {
  private:
   friend class HDMapImpl;
   friend class RoadInfo;
+  // Width samples compiled into structure-of-arrays form at map load time:
+  // the s keys and the widths live in separate contiguous arrays, so the
+  // binary search only touches the key array.
+  struct WidthSampleTable {
+    std::vector<double> s;
+    std::vector<double> width;
+  };
   void Init();
   void PostProcess(const HDMapImpl &map_instance);
   void UpdateOverlaps(const HDMapImpl &map_instance);
-  double GetWidthFromSample(const std::vector<LaneInfo::SampledWidth> &samples,
-                            const double s) const;
+  static void CompileWidthSampleTable(const std::vector<SampledWidth> &samples,
+                                      WidthSampleTable *table);
+  double GetWidthFromSample(const WidthSampleTable &samples, const double s,
+                            int *index_hint) const;
   void CreateKDTree();
   void set_road_id(const Id &road_id) { road_id_ = road_id; }
   void set_section_id(const Id &section_id) { section_id_ = section_id; }
@@ -258,6 +275,11 @@ class LaneInfo {
   std::vector<SampledWidth> sampled_left_road_width_;
   std::vector<SampledWidth> sampled_right_road_width_;
 
+  WidthSampleTable left_width_table_;
+  WidthSampleTable right_width_table_;
+  WidthSampleTable left_road_width_table_;
+  WidthSampleTable right_road_width_table_;
+
   std::vector<LaneSegmentBox> segment_box_list_;
   std::unique_ptr<LaneSegmentKDTree> lane_segment_kdtree_;
 
@@ -373,6 +373,44 @@ TEST_F(HDMapCommonTestSuite, GetWidth) {
   EXPECT_NEAR(2.4, lane_info.GetWidth(3.5), 1E-3);
 }
 
+TEST_F(HDMapCommonTestSuite, GetWidthWithIndexHint) {
+  Lane lane;
+  InitLaneObj(&lane);
+  LaneInfo lane_info(lane);
+  int left_index_hint = 0;
+  int right_index_hint = 0;
+  double left_width = 0.0;
+  double right_width = 0.0;
+  double expected_left_width = 0.0;
+  double expected_right_width = 0.0;
+  for (double s = 0.0; s <= 4.0; s += 0.25) {
+    lane_info.GetWidth(s, &left_index_hint, &right_index_hint, &left_width,
+                       &right_width);
+    lane_info.GetWidth(s, &expected_left_width, &expected_right_width);
+    EXPECT_NEAR(expected_left_width, left_width, 1E-6);
+    EXPECT_NEAR(expected_right_width, right_width, 1E-6);
+  }
+  left_index_hint = 100;
+  right_index_hint = -3;
+  lane_info.GetWidth(2.0, &left_index_hint, &right_index_hint, &left_width,
+                     &right_width);
+  EXPECT_NEAR(1.5, left_width, 1E-3);
+  EXPECT_NEAR(1.5, right_width, 1E-3);
+}
+
+TEST_F(HDMapCommonTestSuite, HeadingWithIndexHint) {
+  Lane lane;
+  InitLaneObj(&lane);
+  LaneInfo lane_info(lane);
+  int index_hint = 0;
+  for (double s = 0.1; s < 4.0; s += 0.1) {
+    EXPECT_NEAR(lane_info.Heading(s), lane_info.Heading(s, &index_hint), 1E-9);
+  }
+  index_hint = 100;
+  EXPECT_NEAR(lane_info.Heading(2.5), lane_info.Heading(2.5, &index_hint),
+              1E-9);
+}
+
 TEST_F(HDMapCommonTestSuite, GetEffectiveWidth) {
   Lane lane;
   InitLaneObj(&lane);
@@ -15,6 +15,8 @@ limitations under the License.
 
 #include "modules/map/hdmap/hdmap_impl.h"
 
+#include <sys/stat.h>
+
 #include <algorithm>
 #include <limits>
 #include <set>
@@ -38,6 +40,19 @@ Id CreateHDMapId(const std::string& string_id) {
   return id;
 }
 
+// Returns true if both files exist and the first one is not older than the
+// second one.
+bool IsFileNotOlderThan(const std::string& filename,
+                        const std::string& base_filename) {
+  struct stat file_stat;
+  struct stat base_file_stat;
+  if (stat(filename.c_str(), &file_stat) != 0 ||
+      stat(base_filename.c_str(), &base_file_stat) != 0) {
+    return false;
+  }
+  return file_stat.st_mtime >= base_file_stat.st_mtime;
+}
+
 // default lanes search radius in GetForwardNearestSignalsOnLane
 constexpr double kLanesSearchRange = 10.0;
 // backward search distance in GetForwardNearestSignalsOnLane
@@ -50,8 +65,20 @@ int HDMapImpl::LoadMapFromFile(const std::string& map_filename) {
   // TODO(All) seems map_ can be changed to a local variable of this
   // function, but test will fail if I do so. if so.
   if (absl::EndsWith(map_filename, ".xml")) {
-    if (!adapter::OpendriveAdapter::LoadData(map_filename, &map_)) {
-      return -1;
+    // Parsing opendrive xml dominates map load time and is paid by every
+    // process that opens the map, so compile the map into a binary sidecar
+    // on first load and reuse it as long as it is not older than the xml.
+    const std::string bin_filename = map_filename + ".bin";
+    if (IsFileNotOlderThan(bin_filename, map_filename) &&
+        cyber::common::GetProtoFromBinaryFile(bin_filename, &map_)) {
+      ADEBUG << "Loaded compiled map cache: " << bin_filename;
+    } else {
+      if (!adapter::OpendriveAdapter::LoadData(map_filename, &map_)) {
+        return -1;
+      }
+      if (!cyber::common::SetProtoToBinaryFile(map_, bin_filename)) {
+        AWARN << "Failed to write compiled map cache: " << bin_filename;
+      }
     }
   } else if (!cyber::common::GetProtoFromFile(map_filename, &map_)) {
     return -1;
@@ -484,6 +511,49 @@ int HDMapImpl::GetPNCJunctions(
   return 0;
 }
 
+int HDMapImpl::GetMapObjects(const PointENU& point, double distance,
+                             MapObjects* map_objects) const {
+  if (map_objects == nullptr) {
+    return -1;
+  }
+  // side length of the cell used to key repeated queries
+  constexpr double kQueryQuantization = 0.1;
+  const int64_t query_x =
+      static_cast<int64_t>(point.x() / kQueryQuantization);
+  const int64_t query_y =
+      static_cast<int64_t>(point.y() / kQueryQuantization);
+  if (map_objects->has_last_query && map_objects->last_query_x == query_x &&
+      map_objects->last_query_y == query_y &&
+      map_objects->last_query_distance == distance) {
+    return 0;
+  }
+  map_objects->has_last_query = false;
+
+  const Vec2d target_point(point.x(), point.y());
+  int status = 0;
+  status |= GetLanes(target_point, distance, &map_objects->lanes);
+  status |= GetJunctions(target_point, distance, &map_objects->junctions);
+  status |= GetSignals(target_point, distance, &map_objects->signals);
+  status |= GetCrosswalks(target_point, distance, &map_objects->crosswalks);
+  status |= GetStopSigns(target_point, distance, &map_objects->stop_signs);
+  status |= GetYieldSigns(target_point, distance, &map_objects->yield_signs);
+  status |= GetClearAreas(target_point, distance, &map_objects->clear_areas);
+  status |= GetSpeedBumps(target_point, distance, &map_objects->speed_bumps);
+  status |=
+      GetParkingSpaces(target_point, distance, &map_objects->parking_spaces);
+  status |=
+      GetPNCJunctions(target_point, distance, &map_objects->pnc_junctions);
+  if (status != 0) {
+    return -1;
+  }
+
+  map_objects->has_last_query = true;
+  map_objects->last_query_x = query_x;
+  map_objects->last_query_y = query_y;
+  map_objects->last_query_distance = distance;
+  return 0;
+}
+
 int HDMapImpl::GetNearestLane(const PointENU& point,
                               LaneInfoConstPtr* nearest_lane, double* nearest_s,
                               double* nearest_l) const {
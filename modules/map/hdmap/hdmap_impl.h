@@ -15,6 +15,7 @@ limitations under the License.
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -48,6 +49,33 @@ limitations under the License.
 namespace apollo {
 namespace hdmap {
 
+/**
+ * @struct MapObjects
+ *
+ * @brief Reusable result buffers for batched spatial queries. Reusing the
+ * same instance across frames keeps the vector capacities and lets repeated
+ * queries from (nearly) the same position be answered from the last result,
+ * which is exact since the map is static.
+ */
+struct MapObjects {
+  std::vector<LaneInfoConstPtr> lanes;
+  std::vector<JunctionInfoConstPtr> junctions;
+  std::vector<SignalInfoConstPtr> signals;
+  std::vector<CrosswalkInfoConstPtr> crosswalks;
+  std::vector<StopSignInfoConstPtr> stop_signs;
+  std::vector<YieldSignInfoConstPtr> yield_signs;
+  std::vector<ClearAreaInfoConstPtr> clear_areas;
+  std::vector<SpeedBumpInfoConstPtr> speed_bumps;
+  std::vector<ParkingSpaceInfoConstPtr> parking_spaces;
+  std::vector<PNCJunctionInfoConstPtr> pnc_junctions;
+
+  // quantized key of the last answered query; managed by GetMapObjects
+  bool has_last_query = false;
+  int64_t last_query_x = 0;
+  int64_t last_query_y = 0;
+  double last_query_distance = 0.0;
+};
+
 /**
  * @class HDMapImpl
  *
@@ -210,6 +238,18 @@ class HDMapImpl {
       const apollo::common::PointENU& point, double distance,
       std::vector<PNCJunctionInfoConstPtr>* pnc_junctions) const;
 
+  /**
+   * @brief get map objects of all types in certain range in one call,
+   * refilling the caller-provided buffers; answers from the previous result
+   * when the query position quantizes to the same cell as the last call
+   * @param point the central point of the range
+   * @param distance the search radius
+   * @param map_objects reusable buffers storing all objects in target range
+   * @return 0:success, otherwise failed
+   */
+  int GetMapObjects(const apollo::common::PointENU& point, double distance,
+                    MapObjects* map_objects) const;
+
   /**
    * @brief get nearest lane from target point,
    * @param point the target point
@@ -236,6 +236,28 @@ TEST_F(HDMapImplTestSuite, GetSignals) {
   EXPECT_EQ("1278", signals[0]->id().id());
 }
 
+TEST_F(HDMapImplTestSuite, GetMapObjects) {
+  MapObjects map_objects;
+  apollo::common::PointENU point;
+  point.set_x(586441.61);
+  point.set_y(4140746.48);
+  point.set_z(0.0);
+  EXPECT_EQ(0, hdmap_impl_.GetMapObjects(point, 3, &map_objects));
+  EXPECT_EQ(1, map_objects.junctions.size());
+  EXPECT_EQ("1183", map_objects.junctions[0]->id().id());
+
+  std::vector<LaneInfoConstPtr> lanes;
+  EXPECT_EQ(0, hdmap_impl_.GetLanes(point, 3, &lanes));
+  EXPECT_EQ(lanes.size(), map_objects.lanes.size());
+
+  // a repeated query from the same position reuses the last result
+  EXPECT_EQ(0, hdmap_impl_.GetMapObjects(point, 3, &map_objects));
+  EXPECT_EQ(1, map_objects.junctions.size());
+  // a different radius refills the buffers
+  EXPECT_EQ(0, hdmap_impl_.GetMapObjects(point, 1, &map_objects));
+  EXPECT_EQ(0, map_objects.junctions.size());
+}
+
 TEST_F(HDMapImplTestSuite, GetStopSigns) {
   std::vector<StopSignInfoConstPtr> stop_signs;
 
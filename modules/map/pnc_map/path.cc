@@ -347,12 +347,57 @@ Path::Path(std::vector<MapPathPoint>&& path_points,
   }
 }
 
+PathProjectionIndex::PathProjectionIndex(
+    const std::vector<common::math::LineSegment2d>& segments)
+    : segments_(segments) {
+  if (segments_.empty()) {
+    return;
+  }
+  segment_boxes_.reserve(segments_.size());
+  for (size_t i = 0; i < segments_.size(); ++i) {
+    const auto& segment = segments_[i];
+    segment_boxes_.emplace_back(
+        common::math::AABox2d(segment.start(), segment.end()), &segment,
+        &segment, static_cast<int>(i));
+  }
+  common::math::AABoxKDTreeParams params;
+  params.max_leaf_dimension = 5.0;  // meters.
+  params.max_leaf_size = 16;
+  kdtree_.reset(new PathSegmentKDTree(segment_boxes_, params));
+}
+
+int PathProjectionIndex::GetNearestSegmentIndex(
+    const common::math::Vec2d& point, double* min_distance_sqr) const {
+  if (kdtree_ == nullptr) {
+    return -1;
+  }
+  const auto* nearest_box = kdtree_->GetNearestObject(point);
+  if (nearest_box == nullptr) {
+    return -1;
+  }
+  *min_distance_sqr = nearest_box->DistanceSquareTo(point);
+  return nearest_box->id();
+}
+
+void PathProjectionIndex::GetSegmentIndicesNear(
+    const common::math::Vec2d& point, double distance,
+    std::vector<int>* const indices) const {
+  indices->clear();
+  if (kdtree_ == nullptr) {
+    return;
+  }
+  for (const auto* segment_box : kdtree_->GetObjects(point, distance)) {
+    indices->push_back(segment_box->id());
+  }
+}
+
 void Path::Init() {
   InitPoints();
   InitLaneSegments();
   InitPointIndex();
   InitWidth();
   InitOverlaps();
+  InitProjectionIndex();
 }
 
 void Path::InitPoints() {
@@ -436,8 +481,9 @@ void Path::InitWidth() {
   road_right_width_.reserve(num_sample_points_);
 
   double s = 0;
+  int index_hint = 0;
   for (int i = 0; i < num_sample_points_; ++i) {
-    const MapPathPoint point = GetSmoothPoint(s);
+    const MapPathPoint point = GetSmoothPoint(s, &index_hint);
     if (point.lane_waypoints().empty()) {
       lane_left_width_.push_back(FLAGS_default_lane_width / 2.0);
       lane_right_width_.push_back(FLAGS_default_lane_width / 2.0);
@@ -487,6 +533,10 @@ void Path::InitPointIndex() {
   CHECK_EQ(last_point_index_.size(), num_sample_points_);
 }
 
+void Path::InitProjectionIndex() {
+  projection_index_.reset(new PathProjectionIndex(segments_));
+}
+
 void Path::GetAllOverlaps(GetOverlapFromLaneFunc GetOverlaps_from_lane,
                           std::vector<PathOverlap>* const overlaps) const {
   if (overlaps == nullptr) {
@@ -610,6 +660,10 @@ MapPathPoint Path::GetSmoothPoint(double s) const {
   return GetSmoothPoint(GetIndexFromS(s));
 }
 
+MapPathPoint Path::GetSmoothPoint(double s, int* index_hint) const {
+  return GetSmoothPoint(GetIndexFromS(s, index_hint));
+}
+
 double Path::GetSFromIndex(const InterpolatedIndex& index) const {
   if (index.id < 0) {
     return 0.0;
@@ -648,6 +702,26 @@ InterpolatedIndex Path::GetIndexFromS(double s) const {
   return {low, s - accumulated_s_[low]};
 }
 
+InterpolatedIndex Path::GetIndexFromS(double s, int* index_hint) const {
+  if (index_hint != nullptr && s > 0.0 && s < length_) {
+    // a caller walking forward lands on the hinted point or the next one;
+    // anything else falls through to the sampled binary search
+    const int hint = std::min(std::max(*index_hint, 0), num_points_ - 2);
+    const int max_index = std::min(hint + 1, num_points_ - 2);
+    for (int index = hint; index <= max_index; ++index) {
+      if (accumulated_s_[index] <= s && s < accumulated_s_[index + 1]) {
+        *index_hint = index;
+        return {index, s - accumulated_s_[index]};
+      }
+    }
+  }
+  const InterpolatedIndex index = GetIndexFromS(s);
+  if (index_hint != nullptr) {
+    *index_hint = index.id;
+  }
+  return index;
+}
+
 InterpolatedIndex Path::GetLaneIndexFromS(double s) const {
   if (s <= 0.0) {
     return {0, 0.0};
@@ -795,12 +869,18 @@ bool Path::GetProjection(const Vec2d& point, double* accumulate_s,
   }
   CHECK_GE(num_points_, 2);
   *min_distance = std::numeric_limits<double>::infinity();
-  int min_index = 0;
-  for (int i = 0; i < num_segments_; ++i) {
-    const double distance = segments_[i].DistanceSquareTo(point);
-    if (distance < *min_distance) {
-      min_index = i;
-      *min_distance = distance;
+  int min_index = -1;
+  if (projection_index_ != nullptr) {
+    min_index = projection_index_->GetNearestSegmentIndex(point, min_distance);
+  }
+  if (min_index < 0) {
+    min_index = 0;
+    for (int i = 0; i < num_segments_; ++i) {
+      const double distance = segments_[i].DistanceSquareTo(point);
+      if (distance < *min_distance) {
+        min_index = i;
+        *min_distance = distance;
+      }
     }
   }
   *min_distance = std::sqrt(*min_distance);
@@ -924,6 +1004,20 @@ bool Path::OverlapWith(const common::math::Box2d& box, double width) const {
   }
   const Vec2d center = box.center();
   const double radius_sqr = Sqr(box.diagonal() / 2.0 + width) + kMathEpsilon;
+  if (projection_index_ != nullptr) {
+    // Only the segments within the search radius of the box center can
+    // overlap; fetch them from the segment index instead of scanning the
+    // whole path.
+    std::vector<int> candidate_indices;
+    projection_index_->GetSegmentIndicesNear(center, std::sqrt(radius_sqr),
+                                             &candidate_indices);
+    for (const int index : candidate_indices) {
+      if (box.DistanceTo(segments_[index]) <= width + kMathEpsilon) {
+        return true;
+      }
+    }
+    return false;
+  }
   for (const auto& segment : segments_) {
     if (segment.DistanceSquareTo(center) > radius_sqr) {
       continue;
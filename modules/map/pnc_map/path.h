@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -23,6 +24,8 @@
 #include "modules/map/proto/map_lane.pb.h"
 
 #include "cyber/common/log.h"
+#include "modules/common/math/aabox2d.h"
+#include "modules/common/math/aaboxkdtree2d.h"
 #include "modules/common/math/box2d.h"
 #include "modules/common/math/line_segment2d.h"
 #include "modules/common/math/vec2d.h"
@@ -212,6 +215,41 @@ class InterpolatedIndex {
   double offset = 0.0;
 };
 
+using PathSegmentBox =
+    ObjectWithAABox<common::math::LineSegment2d, common::math::LineSegment2d>;
+using PathSegmentKDTree = common::math::AABoxKDTree2d<PathSegmentBox>;
+
+/**
+ * @brief KD-tree index over the path segments. It is built once at Path
+ * construction, owns a copy of the segments so that it stays valid when a
+ * Path is copied, and is shared immutably between the copies.
+ */
+class PathProjectionIndex {
+ public:
+  explicit PathProjectionIndex(
+      const std::vector<common::math::LineSegment2d>& segments);
+
+  /**
+   * @brief get the index of the path segment nearest to the point, or -1 if
+   * the index is empty. min_distance_sqr is set to the square distance from
+   * the point to the nearest segment.
+   */
+  int GetNearestSegmentIndex(const common::math::Vec2d& point,
+                             double* min_distance_sqr) const;
+
+  /**
+   * @brief get the indices of all path segments within distance to the
+   * point. The order of the indices is unspecified.
+   */
+  void GetSegmentIndicesNear(const common::math::Vec2d& point, double distance,
+                             std::vector<int>* const indices) const;
+
+ private:
+  std::vector<common::math::LineSegment2d> segments_;
+  std::vector<PathSegmentBox> segment_boxes_;
+  std::unique_ptr<PathSegmentKDTree> kdtree_;
+};
+
 class Path {
  public:
   Path() = default;
@@ -235,11 +273,17 @@ class Path {
   // Return smooth coordinate by interpolated index or accumulate_s.
   MapPathPoint GetSmoothPoint(const InterpolatedIndex& index) const;
   MapPathPoint GetSmoothPoint(double s) const;
+  // Variant for callers walking monotonically along the path: *index_hint
+  // caches the point index of the previous query so consecutive lookups
+  // skip the index search; a stale hint falls back to GetIndexFromS.
+  MapPathPoint GetSmoothPoint(double s, int* index_hint) const;
 
   // Compute accumulate s value of the index.
   double GetSFromIndex(const InterpolatedIndex& index) const;
   // Compute interpolated index by accumulate_s.
   InterpolatedIndex GetIndexFromS(double s) const;
+  // Hint-based variant; see GetSmoothPoint(s, index_hint).
+  InterpolatedIndex GetIndexFromS(double s, int* index_hint) const;
 
   // get the index of the lane from s by accumulate_s
   InterpolatedIndex GetLaneIndexFromS(double s) const;
@@ -338,6 +382,7 @@ class Path {
   void InitWidth();
   void InitPointIndex();
   void InitOverlaps();
+  void InitProjectionIndex();
 
   double GetSample(const std::vector<double>& samples, const double s) const;
 
@@ -360,6 +405,10 @@ class Path {
   bool use_path_approximation_ = false;
   PathApproximation approximation_;
 
+  // Projection index over segments_. Shared between copies of the path, so
+  // GetProjection stays O(log n) without rebuilding the index on copy
+  std::shared_ptr<const PathProjectionIndex> projection_index_;
+
   // Sampled every fixed length.
   int num_sample_points_ = 0;
   std::vector<double> lane_left_width_;
@@ -762,6 +762,23 @@ TEST(TestSuite, hdmap_path_get_smooth_point) {
   EXPECT_EQ(index.id, kNumSegments);
   EXPECT_NEAR(index.offset, 0, 1e-6);
   EXPECT_NEAR(path.GetSFromIndex(index), segment_length * kNumSegments, 1e-6);
+
+  // the hint-based variants must agree with the plain lookups, both while
+  // walking forward along the path and after the hint goes stale
+  int index_hint = 0;
+  for (double s = -0.1; s < segment_length * kNumSegments + 0.2; s += 0.37) {
+    const InterpolatedIndex plain_index = path.GetIndexFromS(s);
+    const InterpolatedIndex hinted_index = path.GetIndexFromS(s, &index_hint);
+    EXPECT_EQ(plain_index.id, hinted_index.id);
+    EXPECT_NEAR(plain_index.offset, hinted_index.offset, 1e-6);
+    const MapPathPoint plain_point = path.GetSmoothPoint(s);
+    const MapPathPoint hinted_point = path.GetSmoothPoint(s, &index_hint);
+    EXPECT_NEAR(plain_point.x(), hinted_point.x(), 1e-6);
+    EXPECT_NEAR(plain_point.y(), hinted_point.y(), 1e-6);
+  }
+  index_hint = kNumSegments + 5;
+  EXPECT_EQ(path.GetIndexFromS(0.7).id,
+            path.GetIndexFromS(0.7, &index_hint).id);
 }
 
 TEST(TestSuite, compute_lane_segments_from_points) {
@@ -233,6 +233,10 @@ bool PncMap::UpdateRoutingResponse(const routing::RoutingResponse &routing) {
   range_end_ = 0;
   adc_route_index_ = -1;
   next_routing_waypoint_index_ = 0;
+  cached_road_index_ = -1;
+  cached_passage_index_ = -1;
+  cached_drive_passages_.clear();
+  cached_passage_segments_.clear();
   UpdateRoutingRange(adc_route_index_);
 
   routing_waypoint_index_.clear();
@@ -332,7 +336,7 @@ int PncMap::GetWaypointIndex(const LaneWaypoint &waypoint) const {
                                                   : forward_index;
 }
 
-bool PncMap::PassageToSegments(routing::Passage passage,
+bool PncMap::PassageToSegments(const routing::Passage &passage,
                                RouteSegments *segments) const {
   CHECK_NOTNULL(segments);
   segments->clear();
@@ -432,15 +436,35 @@ bool PncMap::GetRouteSegments(const VehicleState &vehicle_state,
   const int road_index = route_index[0];
   const int passage_index = route_index[1];
   const auto &road = routing_.road(road_index);
-  // Raw filter to find all neighboring passages
-  auto drive_passages = GetNeighborPassages(road, passage_index);
-  for (const int index : drive_passages) {
+  // Raw filter to find all neighboring passages. On the typical cycle the
+  // (road, passage, next waypoint) window has not moved, so the passages and
+  // lane segments built on the last cycle are still valid and are reused.
+  if (road_index != cached_road_index_ ||
+      passage_index != cached_passage_index_ ||
+      next_routing_waypoint_index_ != cached_next_routing_waypoint_index_) {
+    cached_drive_passages_ = GetNeighborPassages(road, passage_index);
+    cached_passage_segments_.clear();
+    cached_passage_segments_.resize(cached_drive_passages_.size());
+    for (size_t i = 0; i < cached_drive_passages_.size(); ++i) {
+      auto &passage_segments = cached_passage_segments_[i];
+      passage_segments.first =
+          PassageToSegments(road.passage(cached_drive_passages_[i]),
+                            &passage_segments.second);
+    }
+    cached_road_index_ = road_index;
+    cached_passage_index_ = passage_index;
+    cached_next_routing_waypoint_index_ = next_routing_waypoint_index_;
+  }
+  for (size_t passage_order = 0; passage_order < cached_drive_passages_.size();
+       ++passage_order) {
+    const int index = cached_drive_passages_[passage_order];
     const auto &passage = road.passage(index);
-    RouteSegments segments;
-    if (!PassageToSegments(passage, &segments)) {
+    if (!cached_passage_segments_[passage_order].first) {
       ADEBUG << "Failed to convert passage to lane segments.";
       continue;
     }
+    const RouteSegments &segments =
+        cached_passage_segments_[passage_order].second;
     const PointENU nearest_point =
         index == passage_index
             ? adc_waypoint_.lane->GetSmoothPoint(adc_waypoint_.s)
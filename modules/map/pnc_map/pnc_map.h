@@ -23,6 +23,7 @@
 #include <list>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "gflags/gflags.h"
@@ -95,7 +96,7 @@ class PncMap {
   bool GetNearestPointFromRouting(const common::VehicleState &point,
                                   LaneWaypoint *waypoint) const;
 
-  bool PassageToSegments(routing::Passage passage,
+  bool PassageToSegments(const routing::Passage &passage,
                          RouteSegments *segments) const;
 
   bool ProjectToSegments(const common::PointENU &point_enu,
@@ -215,6 +216,18 @@ class PncMap {
    */
   bool stop_for_destination_ = false;
 
+  /**
+   * Neighbor passages and their lane segments built on the last cycle.
+   * They only depend on the routing response and the current
+   * (road, passage, next waypoint) window, so they are reused until that
+   * window moves (lane change, replan or waypoint passed).
+   */
+  int cached_road_index_ = -1;
+  int cached_passage_index_ = -1;
+  std::size_t cached_next_routing_waypoint_index_ = 0;
+  std::vector<int> cached_drive_passages_;
+  std::vector<std::pair<bool, RouteSegments>> cached_passage_segments_;
+
   FRIEND_TEST(PncMapTest, UpdateRouting);
   FRIEND_TEST(PncMapTest, GetNearestPointFromRouting);
   FRIEND_TEST(PncMapTest, UpdateWaypointIndex);
@@ -88,21 +88,25 @@ void RelativeMap::OnNavigationInfo(const NavigationInfo& navigation_info) {
 void RelativeMap::OnPerception(
     const PerceptionObstacles& perception_obstacles) {
   {
-    std::lock_guard<std::mutex> lock(navigation_lane_mutex_);
-    perception_obstacles_.CopyFrom(perception_obstacles);
+    std::lock_guard<std::mutex> lock(input_mutex_);
+    // Map generation only consumes the lane markers, so skip copying the
+    // full obstacle list every perception cycle.
+    perception_obstacles_.Clear();
+    perception_obstacles_.mutable_lane_marker()->CopyFrom(
+        perception_obstacles.lane_marker());
   }
 }
 
 void RelativeMap::OnChassis(const Chassis& chassis) {
   {
-    std::lock_guard<std::mutex> lock(navigation_lane_mutex_);
+    std::lock_guard<std::mutex> lock(input_mutex_);
     chassis_.CopyFrom(chassis);
   }
 }
 
 void RelativeMap::OnLocalization(const LocalizationEstimate& localization) {
   {
-    std::lock_guard<std::mutex> lock(navigation_lane_mutex_);
+    std::lock_guard<std::mutex> lock(input_mutex_);
     localization_.CopyFrom(localization);
   }
 }
@@ -110,17 +114,21 @@ void RelativeMap::OnLocalization(const LocalizationEstimate& localization) {
 bool RelativeMap::CreateMapFromNavigationLane(MapMsg* map_msg) {
   CHECK_NOTNULL(map_msg);
 
-  // update vehicle state from localization and chassis
-
-  LocalizationEstimate const& localization = localization_;
-  Chassis const& chassis = chassis_;
-  VehicleStateProvider::Instance()->Update(localization, chassis);
-  map_msg->mutable_localization()->CopyFrom(localization_);
-
-  // update navigation_lane from perception_obstacles (lane marker)
-  PerceptionObstacles const& perception = perception_obstacles_;
-  navigation_lane_.UpdatePerception(perception);
-  map_msg->mutable_lane_marker()->CopyFrom(perception_obstacles_.lane_marker());
+  {
+    // Snapshot the latest inputs; the input lock is released before the
+    // path and map generation below so sensor callbacks are not delayed
+    // by the build.
+    std::lock_guard<std::mutex> lock(input_mutex_);
+
+    // update vehicle state from localization and chassis
+    VehicleStateProvider::Instance()->Update(localization_, chassis_);
+    map_msg->mutable_localization()->CopyFrom(localization_);
+
+    // update navigation_lane from perception_obstacles (lane marker)
+    navigation_lane_.UpdatePerception(perception_obstacles_);
+    map_msg->mutable_lane_marker()->CopyFrom(
+        perception_obstacles_.lane_marker());
+  }
 
   if (!navigation_lane_.GeneratePath()) {
     LogErrorStatus(map_msg, "Failed to generate a navigation path.");
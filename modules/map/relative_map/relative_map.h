@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
 
 #include "modules/map/relative_map/proto/navigation.pb.h"
@@ -82,7 +83,12 @@ class RelativeMap {
   canbus::Chassis chassis_;
   localization::LocalizationEstimate localization_;
 
+  // Guards navigation_lane_ between Process() and OnNavigationInfo().
   std::mutex navigation_lane_mutex_;
+  // Guards the latest input messages above. Held only for the short
+  // snapshot at the beginning of the map build, so high-rate sensor
+  // callbacks never wait behind the build itself.
+  std::mutex input_mutex_;
 };
 
 }  // namespace relative_map
@@ -48,8 +48,26 @@ namespace {
 bool GetPIDByCmdLine(const std::string& process_dag_path, int* pid) {
   const std::string system_proc_path = "/proc";
   const std::string proc_cmdline_path = "/cmdline";
-  const auto dirs = cyber::common::ListSubPaths(system_proc_path);
   std::string cmd_line;
+
+  // Fast path: revalidate the previously resolved PID by reading just its
+  // own cmdline file. The full procfs sweep below only runs when a monitored
+  // process has restarted under a new PID, so in steady state each resource
+  // check costs one file read instead of a walk over every /proc entry.
+  static std::unordered_map<std::string, int> pid_cache;
+  const auto cached = pid_cache.find(process_dag_path);
+  if (cached != pid_cache.end()) {
+    std::ifstream cmdline_file(
+        absl::StrCat(system_proc_path, "/", cached->second, proc_cmdline_path));
+    std::getline(cmdline_file, cmd_line);
+    if (absl::StrContains(cmd_line, process_dag_path)) {
+      *pid = cached->second;
+      return true;
+    }
+    pid_cache.erase(cached);
+  }
+
+  const auto dirs = cyber::common::ListSubPaths(system_proc_path);
   for (const auto& dir_name : dirs) {
     if (!std::all_of(dir_name.begin(), dir_name.end(), isdigit)) {
       continue;
@@ -59,6 +77,7 @@ bool GetPIDByCmdLine(const std::string& process_dag_path, int* pid) {
         absl::StrCat(system_proc_path, "/", dir_name, proc_cmdline_path));
     std::getline(cmdline_file, cmd_line);
     if (absl::StrContains(cmd_line, process_dag_path)) {
+      pid_cache[process_dag_path] = *pid;
       return true;
     }
   }
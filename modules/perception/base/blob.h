@@ -288,6 +288,17 @@ class Blob {
   void set_head_gpu() { data_->set_head_gpu(); }
   void set_head_cpu() { data_->set_head_cpu(); }
   SyncedMemory::SyncedHead head() const { return data_->head(); }
+#ifndef PERCEPTION_CPU_ONLY
+  /**
+   * @brief Bind this blob to its own stream: host/device copies issued by
+   *        mutable_gpu_data()/gpu_data() become asynchronous and overlap
+   *        with compute on other streams.
+   */
+  void set_stream(const cudaStream_t& stream) {
+    CHECK(data_);
+    data_->set_stream(stream);
+  }
+#endif
 
   /**
    * @brief Set the data_ std::shared_ptr to point to the SyncedMemory holding
@@ -0,0 +1,147 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "modules/perception/base/concurrent_object_pool.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+// @brief a frame-local bump allocator for per-pipeline object allocation.
+// Unlike ConcurrentObjectPool, which serves all sensor pipelines from one
+// locked queue and pays a locking deleter per object, a FrameArena belongs
+// to exactly one pipeline: Get() is a bump of an index inside the current
+// slab plus an aliasing shared_ptr construction, with no lock and no
+// per-object deleter bookkeeping. The global slab free list is the only
+// shared state and is touched once per SlabSize objects.
+//
+// Slabs are reference counted rather than freed at frame end: tracked
+// objects are kept alive by trackers and fusion across many frames, so
+// Reset() only drops the arena's own hold on the active slab; a slab goes
+// back to the free list when the last object allocated from it is
+// released.
+//
+// A FrameArena instance is NOT thread-safe by design; create one per
+// sensor pipeline (or per SensorFrameMessage producer).
+template <class ObjectType, size_t SlabSize,
+          class Initializer = ObjectPoolDefaultInitializer<ObjectType>>
+class FrameArena {
+ public:
+  FrameArena() = default;
+
+  FrameArena(const FrameArena& rhs) = delete;
+  FrameArena& operator=(const FrameArena& rhs) = delete;
+
+  ~FrameArena() = default;
+
+  // @brief bump-allocate a smart pointer to ObjectType, lock free on the
+  //        fast path
+  std::shared_ptr<ObjectType> Get() {
+    if (slab_ == nullptr || used_ >= SlabSize) {
+      slab_ = AcquireSlab();
+      used_ = 0;
+    }
+    ObjectType* ptr = &(*slab_)[used_];
+    ++used_;
+    kInitializer(ptr);
+    // the aliasing constructor keeps the whole slab alive until the last
+    // object drawn from it is released
+    return std::shared_ptr<ObjectType>(slab_, ptr);
+  }
+
+  // @brief bump-allocate a batch of smart pointers
+  // @params[IN] num: batch number
+  // @params[OUT] data: vector container to store the pointers
+  void BatchGet(size_t num, std::vector<std::shared_ptr<ObjectType>>* data) {
+    for (size_t i = 0; i < num; ++i) {
+      data->emplace_back(Get());
+    }
+  }
+
+  // @brief drop the arena's hold on the active slab, typically at frame
+  //        end; objects already handed out remain valid until their own
+  //        references are gone
+  void Reset() {
+    slab_ = nullptr;
+    used_ = 0;
+  }
+
+  // @brief number of objects drawn from the current slab, for monitoring
+  size_t UsedInCurrentSlab() const { return slab_ != nullptr ? used_ : 0; }
+
+ private:
+  using Slab = std::vector<ObjectType>;
+
+  // @brief pop a recycled slab from the shared free list, or construct a
+  //        fresh one; the deleter pushes the slab back once every object
+  //        referencing it has been released
+  static std::shared_ptr<Slab> AcquireSlab() {
+    Slab* slab = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(FreeListMutex());
+      auto& free_list = FreeList();
+      if (!free_list.empty()) {
+        slab = free_list.back();
+        free_list.pop_back();
+      }
+    }
+    if (slab == nullptr) {
+      slab = new Slab(SlabSize);
+    }
+    return std::shared_ptr<Slab>(slab, [](Slab* s) {
+      std::lock_guard<std::mutex> lock(FreeListMutex());
+      auto& free_list = FreeList();
+      if (free_list.size() < kMaxIdleSlabNum) {
+        free_list.push_back(s);
+      } else {
+        delete s;
+      }
+    });
+  }
+
+  static std::vector<Slab*>& FreeList() {
+    static std::vector<Slab*> free_list;
+    return free_list;
+  }
+
+  static std::mutex& FreeListMutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  // @brief cap on recycled slabs kept across all arenas of this type
+  static const size_t kMaxIdleSlabNum = 32;
+
+  std::shared_ptr<Slab> slab_ = nullptr;
+  size_t used_ = 0;
+
+  static const Initializer kInitializer;
+};
+
+template <class ObjectType, size_t SlabSize, class Initializer>
+const Initializer FrameArena<ObjectType, SlabSize, Initializer>::kInitializer;
+
+template <class ObjectType, size_t SlabSize, class Initializer>
+const size_t FrameArena<ObjectType, SlabSize, Initializer>::kMaxIdleSlabNum;
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
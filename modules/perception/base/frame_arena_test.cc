@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/base/frame_arena.h"
+
+#include "modules/perception/base/object.h"
+#include "modules/perception/base/object_pool_types.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+TEST(FrameArenaTest, bump_allocation_test) {
+  FrameArena<Object, 4, ObjectInitializer> arena;
+  EXPECT_EQ(arena.UsedInCurrentSlab(), 0);
+
+  std::shared_ptr<Object> first = arena.Get();
+  std::shared_ptr<Object> second = arena.Get();
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  // the initializer ran
+  EXPECT_EQ(first->id, -1);
+  // neighbors in one slab are contiguous
+  EXPECT_EQ(first.get() + 1, second.get());
+  EXPECT_EQ(arena.UsedInCurrentSlab(), 2);
+
+  // the fifth object spills into a fresh slab
+  std::shared_ptr<Object> third = arena.Get();
+  std::shared_ptr<Object> fourth = arena.Get();
+  std::shared_ptr<Object> fifth = arena.Get();
+  EXPECT_EQ(fourth.get() - first.get(), 3);
+  EXPECT_NE(fifth.get(), fourth.get() + 1);
+  EXPECT_EQ(arena.UsedInCurrentSlab(), 1);
+}
+
+TEST(FrameArenaTest, batch_get_test) {
+  FrameArena<Object, 8, ObjectInitializer> arena;
+  std::vector<std::shared_ptr<Object>> objects;
+  arena.BatchGet(20, &objects);
+  EXPECT_EQ(objects.size(), 20);
+  for (auto& object : objects) {
+    EXPECT_EQ(object->id, -1);
+  }
+}
+
+TEST(FrameArenaTest, objects_outlive_reset_test) {
+  FrameArena<Object, 4, ObjectInitializer> arena;
+  std::shared_ptr<Object> survivor = arena.Get();
+  survivor->id = 42;
+  arena.Reset();
+  EXPECT_EQ(arena.UsedInCurrentSlab(), 0);
+  // a tracked object stays valid after its frame is done
+  EXPECT_EQ(survivor->id, 42);
+
+  // the slab is recycled once the last reference is gone: with the free
+  // list drained into one slab, the next frame reuses the same memory
+  Object* old_addr = survivor.get();
+  survivor.reset();
+  std::shared_ptr<Object> reused = arena.Get();
+  EXPECT_EQ(reused.get(), old_addr);
+}
+
+TEST(FrameArenaTest, typed_arena_test) {
+  ObjectArena object_arena;
+  std::shared_ptr<Object> object = object_arena.Get();
+  EXPECT_EQ(object->id, -1);
+
+  PointFCloudArena cloud_arena;
+  std::shared_ptr<AttributePointCloud<PointF>> cloud = cloud_arena.Get();
+  EXPECT_EQ(cloud->size(), 0);
+}
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
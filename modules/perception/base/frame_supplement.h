@@ -56,7 +56,8 @@ struct alignas(16) CameraFrameSupplement {
   // @brief valid only when on_use = true
   bool on_use = false;
 
-  // @brief only reference of the image data
+  // @brief only reference of the image data; images from
+  // base::Image8UPool are recycled once the last handle releases
   Image8UPtr image_ptr = nullptr;
 
   // TODO(guiyilin): modify interfaces of visualizer, use Image8U
@@ -0,0 +1,84 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/base/image_pool.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+constexpr int Image8UPool::kStrideAlignment;
+constexpr size_t Image8UPool::kMaxFreeBlobsPerSize;
+
+Image8UPool& Image8UPool::Instance() {
+  static Image8UPool instance;
+  return instance;
+}
+
+int Image8UPool::AlignedWidthStep(int cols, int channels) {
+  // the stride must also be a multiple of the channel count so the
+  // padding is a whole number of pixels and the backing blob keeps the
+  // {rows, padded_cols, channels} layout Image8U expects
+  int alignment = kStrideAlignment;
+  while (alignment % channels != 0) {
+    alignment += kStrideAlignment;
+  }
+  return (cols * channels + alignment - 1) / alignment * alignment;
+}
+
+std::shared_ptr<Image8U> Image8UPool::Get(int rows, int cols, Color type) {
+  const int channels = kChannelsMap.at(type);
+  const int width_step = AlignedWidthStep(cols, channels);
+  const int capacity = rows * width_step;
+  std::shared_ptr<Blob<uint8_t>> blob;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = free_blobs_.find(capacity);
+    if (iter != free_blobs_.end()) {
+      blob = iter->second;
+      free_blobs_.erase(iter);
+    }
+  }
+  if (blob == nullptr) {
+    blob.reset(new Blob<uint8_t>({rows, width_step / channels, channels}));
+  } else {
+    blob->Reshape({rows, width_step / channels, channels});
+  }
+  // the image sees the logical cols while the blob row holds the padded
+  // stride, recycled when the last handle releases
+  return std::shared_ptr<Image8U>(new Image8U(rows, cols, type, blob),
+                                  [this, blob](Image8U* image) {
+                                    delete image;
+                                    Release(blob);
+                                  });
+}
+
+void Image8UPool::Release(const std::shared_ptr<Blob<uint8_t>>& blob) {
+  const int capacity = static_cast<int>(blob->count());
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (free_blobs_.count(capacity) >= kMaxFreeBlobsPerSize) {
+    return;
+  }
+  free_blobs_.emplace(capacity, blob);
+}
+
+size_t Image8UPool::FreeSize() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return free_blobs_.size();
+}
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
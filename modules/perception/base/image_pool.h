@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "modules/perception/base/image_8u.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+/**
+ * @brief A pool of recycled image backing buffers with aligned row strides.
+ *
+ * Image8U allocated directly packs rows tightly, so the row stride is
+ * cols * channels and rows of typical camera resolutions start at odd
+ * addresses, which penalizes SIMD and NPP color conversion kernels. The
+ * pool pads every row so the stride is a multiple of kStrideAlignment
+ * (and of the channel count, keeping the padding a whole number of
+ * pixels), and recycles the backing blobs instead of reallocating
+ * multi-megabyte planes every frame.
+ *
+ * Recycling piggybacks on the handle returned by Get(): the backing blob
+ * goes back to the free list when the last copy of the handle releases,
+ * so frame-scoped owners such as CameraFrameSupplement::image_ptr need no
+ * extra bookkeeping. Keeping the blob() of a pooled image alive beyond
+ * the image handle defers recycling accordingly.
+ */
+class Image8UPool {
+ public:
+  // row strides handed out by the pool are multiples of this
+  static constexpr int kStrideAlignment = 64;
+  // recycled blobs kept per distinct capacity before excess ones are freed
+  static constexpr size_t kMaxFreeBlobsPerSize = 16;
+
+  static Image8UPool& Instance();
+
+  // @brief: get a pooled image with aligned row stride, reusing a
+  //         recycled backing blob of matching capacity when available
+  std::shared_ptr<Image8U> Get(int rows, int cols, Color type);
+
+  // @brief: aligned stride in bytes for one row of cols x channels
+  static int AlignedWidthStep(int cols, int channels);
+
+  size_t FreeSize();
+
+ private:
+  Image8UPool() = default;
+  Image8UPool(const Image8UPool&) = delete;
+  Image8UPool& operator=(const Image8UPool&) = delete;
+
+  void Release(const std::shared_ptr<Blob<uint8_t>>& blob);
+
+  std::mutex mutex_;
+  // recycled backing blobs keyed by byte capacity
+  std::multimap<int, std::shared_ptr<Blob<uint8_t>>> free_blobs_;
+};  // class Image8UPool
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
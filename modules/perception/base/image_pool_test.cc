@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/base/image_pool.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+TEST(Image8UPoolTest, aligned_width_step) {
+  EXPECT_EQ(Image8UPool::AlignedWidthStep(1920, 1), 1920);
+  EXPECT_EQ(Image8UPool::AlignedWidthStep(1919, 1), 1920);
+  EXPECT_EQ(Image8UPool::AlignedWidthStep(1920, 3), 5760);
+  // 3-channel strides are aligned to lcm(64, 3) so padding stays a
+  // whole number of pixels
+  EXPECT_EQ(Image8UPool::AlignedWidthStep(1917, 3), 5760);
+  EXPECT_EQ(Image8UPool::AlignedWidthStep(100, 3), 384);
+  EXPECT_EQ(Image8UPool::AlignedWidthStep(100, 3) % 64, 0);
+}
+
+TEST(Image8UPoolTest, get_and_recycle) {
+  auto& pool = Image8UPool::Instance();
+  const uint8_t* data = nullptr;
+  {
+    std::shared_ptr<Image8U> image = pool.Get(100, 100, Color::BGR);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->rows(), 100);
+    EXPECT_EQ(image->cols(), 100);
+    EXPECT_EQ(image->channels(), 3);
+    EXPECT_EQ(image->width_step(), 384);
+    EXPECT_EQ(image->width_step() % Image8UPool::kStrideAlignment, 0);
+    data = image->cpu_data();
+    EXPECT_NE(data, nullptr);
+  }
+  // the backing blob is recycled, a same-size request reuses it
+  std::shared_ptr<Image8U> image = pool.Get(100, 100, Color::BGR);
+  EXPECT_EQ(image->cpu_data(), data);
+}
+
+TEST(Image8UPoolTest, distinct_sizes) {
+  auto& pool = Image8UPool::Instance();
+  std::shared_ptr<Image8U> small = pool.Get(10, 10, Color::GRAY);
+  std::shared_ptr<Image8U> large = pool.Get(20, 20, Color::GRAY);
+  EXPECT_EQ(small->width_step(), 64);
+  EXPECT_EQ(large->width_step(), 64);
+  EXPECT_NE(small->cpu_data(), large->cpu_data());
+  size_t free_size = pool.FreeSize();
+  small.reset();
+  large.reset();
+  EXPECT_EQ(pool.FreeSize(), free_size + 2);
+}
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
@@ -15,10 +15,14 @@
  *****************************************************************************/
 #pragma once
 
+#include <memory>
+
 #include "modules/perception/base/concurrent_object_pool.h"
 #include "modules/perception/base/frame.h"
+#include "modules/perception/base/frame_arena.h"
 #include "modules/perception/base/object.h"
 #include "modules/perception/base/point_cloud.h"
+#include "modules/perception/base/traffic_light.h"
 
 namespace apollo {
 namespace perception {
@@ -39,9 +43,31 @@ struct FrameInitializer {
   void operator()(Frame* frame) const { frame->Reset(); }
 };
 
+struct TrafficLightInitializer {
+  void operator()(TrafficLight* light) const {
+    light->id.clear();
+    light->semantic = 0;
+    light->region.projection_roi = Rect<int>();
+    light->region.crop_roi = Rect<int>();
+    light->region.outside_image = false;
+    // clear() keeps the vector capacity, so a recycled light does not
+    // reallocate when refilled
+    light->region.debug_roi.clear();
+    light->region.debug_roi_detect_scores.clear();
+    light->region.detection_roi = Rect<int>();
+    light->region.is_detected = false;
+    light->region.is_selected = false;
+    light->region.detect_class_id = TLDetectionClass::TL_UNKNOWN_CLASS;
+    light->region.points.clear();
+    light->region.detect_score = 0.0f;
+    light->status = LightStatus();
+  }
+};
+
 static const size_t kObjectPoolSize = 10000;
 static const size_t kPointCloudPoolSize = 1000;
 static const size_t kFramePoolSize = 100;
+static const size_t kTrafficLightPoolSize = 200;
 
 using ObjectPool =
     ConcurrentObjectPool<Object, kObjectPoolSize, ObjectInitializer>;
@@ -52,6 +78,25 @@ using PointDCloudPool =
     ConcurrentObjectPool<AttributePointCloud<PointD>, kPointCloudPoolSize,
                          PointCloudInitializer<double>>;
 using FramePool = ConcurrentObjectPool<Frame, kFramePoolSize, FrameInitializer>;
+using TrafficLightPool =
+    ConcurrentObjectPool<TrafficLight, kTrafficLightPoolSize,
+                         TrafficLightInitializer>;
+
+// per-pipeline frame-local arenas: one slab covers the typical ~2000
+// objects per lidar frame in a handful of refills, clouds are large so
+// their slabs stay small
+static const size_t kObjectArenaSlabSize = 512;
+static const size_t kPointCloudArenaSlabSize = 8;
+
+using ObjectArena = FrameArena<Object, kObjectArenaSlabSize, ObjectInitializer>;
+using PointFCloudArena =
+    FrameArena<AttributePointCloud<PointF>, kPointCloudArenaSlabSize,
+               PointCloudInitializer<float>>;
+using PointDCloudArena =
+    FrameArena<AttributePointCloud<PointD>, kPointCloudArenaSlabSize,
+               PointCloudInitializer<double>>;
+
+using ObjectArenaPtr = std::shared_ptr<ObjectArena>;
 
 }  // namespace base
 }  // namespace perception
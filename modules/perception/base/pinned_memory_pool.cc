@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/base/pinned_memory_pool.h"
+
+#include <cstdlib>
+
+#include "cyber/common/log.h"
+#include "modules/perception/base/common.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+constexpr size_t PinnedMemoryPool::kMinBlockSize;
+constexpr size_t PinnedMemoryPool::kBucketNum;
+constexpr size_t PinnedMemoryPool::kMaxIdleBlockPerBucket;
+
+PinnedMemoryPool& PinnedMemoryPool::Instance() {
+  static PinnedMemoryPool pool;
+  return pool;
+}
+
+PinnedMemoryPool::PinnedMemoryPool() {
+  for (size_t i = 0; i < kBucketNum; ++i) {
+    stat_[i].block_size = kMinBlockSize << i;
+  }
+}
+
+PinnedMemoryPool::~PinnedMemoryPool() {
+  // busy blocks are still referenced by live SyncedMemory objects and are
+  // reclaimed by the OS at process exit
+  for (size_t i = 0; i < kBucketNum; ++i) {
+    for (auto* ptr : idle_blocks_[i]) {
+      BackendFree(ptr);
+    }
+  }
+}
+
+size_t PinnedMemoryPool::BucketIndex(size_t size) {
+  size_t block_size = kMinBlockSize;
+  size_t index = 0;
+  while (block_size < size) {
+    block_size <<= 1;
+    ++index;
+  }
+  return index;
+}
+
+void* PinnedMemoryPool::Alloc(size_t size) {
+  size_t index = BucketIndex(size);
+  if (index >= kBucketNum) {
+    void* ptr = BackendAlloc(size);
+    std::lock_guard<std::mutex> lock(mutex_);
+    busy_blocks_[ptr] = kBucketNum;
+    return ptr;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!idle_blocks_[index].empty()) {
+      void* ptr = idle_blocks_[index].back();
+      idle_blocks_[index].pop_back();
+      --stat_[index].idle_num;
+      busy_blocks_[ptr] = index;
+      return ptr;
+    }
+  }
+  // allocate outside the lock, a cold pinned allocation is slow
+  void* ptr = BackendAlloc(kMinBlockSize << index);
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++stat_[index].total_num;
+  busy_blocks_[ptr] = index;
+  return ptr;
+}
+
+bool PinnedMemoryPool::Free(void* ptr) {
+  size_t index = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto search = busy_blocks_.find(ptr);
+    if (search == busy_blocks_.end()) {
+      return false;
+    }
+    index = search->second;
+    busy_blocks_.erase(search);
+    if (index < kBucketNum &&
+        idle_blocks_[index].size() < kMaxIdleBlockPerBucket) {
+      idle_blocks_[index].push_back(ptr);
+      ++stat_[index].idle_num;
+      return true;
+    }
+    if (index < kBucketNum) {
+      --stat_[index].total_num;
+    }
+  }
+  BackendFree(ptr);
+  return true;
+}
+
+void PinnedMemoryPool::QueryStat(std::vector<BucketStat>* stat) {
+  if (stat == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  stat->assign(stat_, stat_ + kBucketNum);
+}
+
+void* PinnedMemoryPool::BackendAlloc(size_t size) {
+  void* ptr = nullptr;
+#ifndef PERCEPTION_CPU_ONLY
+  BASE_CUDA_CHECK(cudaMallocHost(&ptr, size));
+#else
+  ptr = malloc(size);
+#endif
+  CHECK(ptr) << "pinned allocation of size " << size << " failed";
+  return ptr;
+}
+
+void PinnedMemoryPool::BackendFree(void* ptr) {
+#ifndef PERCEPTION_CPU_ONLY
+  BASE_CUDA_CHECK(cudaFreeHost(ptr));
+#else
+  free(ptr);
+#endif
+}
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
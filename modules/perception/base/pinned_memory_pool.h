@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+/**
+ * @brief A process-wide pool of pinned (page-locked) host blocks organized
+ *        in power-of-two size classes. cudaMallocHost costs hundreds of
+ *        microseconds per call, so SyncedMemory draws its pinned buffers
+ *        from here and hands them back on release; after warm-up the
+ *        host side of a blob upload does not touch the CUDA allocator.
+ *        In PERCEPTION_CPU_ONLY builds the backend degrades to malloc but
+ *        the bucket bookkeeping stays the same.
+ */
+class PinnedMemoryPool {
+ public:
+  struct BucketStat {
+    size_t block_size = 0;  // bytes per block in this bucket
+    size_t total_num = 0;   // blocks currently owned by the bucket
+    size_t idle_num = 0;    // blocks cached and ready to be handed out
+  };
+
+  // @brief Only allow accessing from global instance
+  static PinnedMemoryPool& Instance();
+
+  PinnedMemoryPool(const PinnedMemoryPool&) = delete;
+  void operator=(const PinnedMemoryPool&) = delete;
+
+  // @brief get a pinned block of at least size bytes; sizes above the
+  // largest bucket are served by a direct, untracked-size allocation
+  void* Alloc(size_t size);
+
+  // @brief return a block to its bucket; false if ptr is not pool-owned
+  bool Free(void* ptr);
+
+  // @brief occupancy of every bucket, for monitoring
+  void QueryStat(std::vector<BucketStat>* stat);
+
+ private:
+  PinnedMemoryPool();
+  ~PinnedMemoryPool();
+
+  static size_t BucketIndex(size_t size);
+  static void* BackendAlloc(size_t size);
+  static void BackendFree(void* ptr);
+
+  static constexpr size_t kMinBlockSize = 4096;  // one page
+  // 4KB << 14 = 64MB, enough for a full resolution camera frame
+  static constexpr size_t kBucketNum = 15;
+  static constexpr size_t kMaxIdleBlockPerBucket = 16;
+
+  std::mutex mutex_;
+  std::vector<void*> idle_blocks_[kBucketNum];
+  BucketStat stat_[kBucketNum];
+  // ptr -> bucket index; kBucketNum marks an oversize passthrough block
+  std::unordered_map<void*, size_t> busy_blocks_;
+};  // class PinnedMemoryPool
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
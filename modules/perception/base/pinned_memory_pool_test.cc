@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/base/pinned_memory_pool.h"
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace base {
+
+TEST(PinnedMemoryPoolTest, alloc_and_recycle) {
+  auto& pool = PinnedMemoryPool::Instance();
+  void* ptr = pool.Alloc(1000);
+  ASSERT_NE(nullptr, ptr);
+  EXPECT_TRUE(pool.Free(ptr));
+
+  // a same-class allocation reuses the cached block
+  void* again = pool.Alloc(2000);
+  EXPECT_EQ(ptr, again);
+  EXPECT_TRUE(pool.Free(again));
+
+  // pointers the pool never handed out are rejected
+  int local = 0;
+  EXPECT_FALSE(pool.Free(&local));
+}
+
+TEST(PinnedMemoryPoolTest, bucket_stat) {
+  auto& pool = PinnedMemoryPool::Instance();
+  void* small_block = pool.Alloc(1);
+  void* large_block = pool.Alloc(5 * 4096);
+
+  std::vector<PinnedMemoryPool::BucketStat> stat;
+  pool.QueryStat(&stat);
+  ASSERT_FALSE(stat.empty());
+  EXPECT_EQ(4096, stat[0].block_size);
+  EXPECT_GE(stat[0].total_num, 1);
+  // 5 pages round up to the 32KB bucket
+  EXPECT_EQ(32 * 1024, stat[3].block_size);
+  EXPECT_GE(stat[3].total_num, 1);
+
+  EXPECT_TRUE(pool.Free(small_block));
+  EXPECT_TRUE(pool.Free(large_block));
+  pool.QueryStat(&stat);
+  EXPECT_GE(stat[0].idle_num, 1);
+  EXPECT_GE(stat[3].idle_num, 1);
+}
+
+TEST(PinnedMemoryPoolTest, oversize_passthrough) {
+  auto& pool = PinnedMemoryPool::Instance();
+  // larger than the biggest bucket, served directly and never cached
+  size_t oversize = (4096ULL << 15);
+  void* ptr = pool.Alloc(oversize);
+  ASSERT_NE(nullptr, ptr);
+  EXPECT_TRUE(pool.Free(ptr));
+}
+
+}  // namespace base
+}  // namespace perception
+}  // namespace apollo
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <cstdlib>
 #include <limits>
 #include <memory>
+#include <new>
 #include <utility>
 #include <vector>
 
@@ -461,6 +463,202 @@ class AttributePointCloud : public PointCloud<PointT> {
   std::vector<uint8_t> points_label_;
 };
 
+// @brief minimal aligned allocator so the SoA coordinate arrays start on
+// an AVX register boundary
+template <typename T, std::size_t Alignment = 32>
+class AlignedAllocator {
+ public:
+  using value_type = T;
+
+  AlignedAllocator() = default;
+  template <typename U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}  // NOLINT
+
+  template <typename U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  T* allocate(std::size_t n) {
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, Alignment, n * sizeof(T)) != 0) {
+      throw std::bad_alloc();
+    }
+    return static_cast<T*>(ptr);
+  }
+  void deallocate(T* ptr, std::size_t) { free(ptr); }
+};
+
+template <typename T, typename U, std::size_t Alignment>
+inline bool operator==(const AlignedAllocator<T, Alignment>&,
+                       const AlignedAllocator<U, Alignment>&) {
+  return true;
+}
+template <typename T, typename U, std::size_t Alignment>
+inline bool operator!=(const AlignedAllocator<T, Alignment>&,
+                       const AlignedAllocator<U, Alignment>&) {
+  return false;
+}
+
+// @brief Structure-of-arrays variant of PointCloud. Coordinates and
+// intensity live in separate 32-byte aligned arrays, so ground detection
+// and ROI filtering kernels can run vector instructions over contiguous
+// x/y/z lanes instead of striding through PointT structs. Indexing and
+// range-for iteration mirror PointCloud, with points returned by value;
+// mutation goes through the per-array accessors.
+template <class PointT>
+class PointCloudSoA {
+ public:
+  using PointType = PointT;
+  using Type = typename PointT::Type;
+  template <typename T>
+  using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+  // @brief default constructor
+  PointCloudSoA() = default;
+  // @brief construct by scattering an AoS cloud into the arrays
+  explicit PointCloudSoA(const PointCloud<PointT>& pc) { CopyPointCloud(pc); }
+
+  // @brief accessor of point size, wrapper of vector
+  inline size_t size() const { return x_.size(); }
+  // @brief empty function wrapper of vector
+  inline bool empty() const { return x_.empty(); }
+  // @brief reserve function wrapper of vector
+  inline void reserve(size_t size) {
+    x_.reserve(size);
+    y_.reserve(size);
+    z_.reserve(size);
+    intensity_.reserve(size);
+  }
+  // @brief resize function wrapper of vector
+  inline void resize(size_t size) {
+    x_.resize(size);
+    y_.resize(size);
+    z_.resize(size);
+    intensity_.resize(size);
+  }
+  // @brief clear function wrapper of vector
+  inline void clear() {
+    x_.clear();
+    y_.clear();
+    z_.clear();
+    intensity_.clear();
+  }
+  // @brief push_back function wrapper of vector
+  inline void push_back(const PointT& point) {
+    x_.push_back(point.x);
+    y_.push_back(point.y);
+    z_.push_back(point.z);
+    intensity_.push_back(point.intensity);
+  }
+
+  // @brief accessor of point via 1d index, gathered from the arrays
+  inline PointT operator[](size_t n) const { return at(n); }
+  inline PointT at(size_t n) const {
+    PointT point;
+    point.x = x_[n];
+    point.y = y_[n];
+    point.z = z_[n];
+    point.intensity = intensity_[n];
+    return point;
+  }
+
+  // @brief index-based iterator yielding points by value, so range-for
+  // loops written against PointCloud keep working
+  class const_iterator {
+   public:
+    const_iterator(const PointCloudSoA* cloud, size_t index)
+        : cloud_(cloud), index_(index) {}
+    PointT operator*() const { return cloud_->at(index_); }
+    const_iterator& operator++() {
+      ++index_;
+      return *this;
+    }
+    bool operator==(const const_iterator& rhs) const {
+      return index_ == rhs.index_;
+    }
+    bool operator!=(const const_iterator& rhs) const {
+      return index_ != rhs.index_;
+    }
+
+   private:
+    const PointCloudSoA* cloud_;
+    size_t index_;
+  };
+  inline const_iterator begin() const { return const_iterator(this, 0); }
+  inline const_iterator end() const { return const_iterator(this, size()); }
+
+  // @brief aligned array views for vector kernels
+  inline const AlignedVector<Type>& points_x() const { return x_; }
+  inline const AlignedVector<Type>& points_y() const { return y_; }
+  inline const AlignedVector<Type>& points_z() const { return z_; }
+  inline const AlignedVector<Type>& points_intensity() const {
+    return intensity_;
+  }
+  inline AlignedVector<Type>* mutable_points_x() { return &x_; }
+  inline AlignedVector<Type>* mutable_points_y() { return &y_; }
+  inline AlignedVector<Type>* mutable_points_z() { return &z_; }
+  inline AlignedVector<Type>* mutable_points_intensity() {
+    return &intensity_;
+  }
+
+  // @brief scatter an AoS cloud into the arrays
+  inline void CopyPointCloud(const PointCloud<PointT>& rhs) {
+    resize(rhs.size());
+    for (size_t i = 0; i < rhs.size(); ++i) {
+      const PointT& point = rhs[i];
+      x_[i] = point.x;
+      y_[i] = point.y;
+      z_[i] = point.z;
+      intensity_[i] = point.intensity;
+    }
+  }
+  // @brief gather the arrays back into an AoS cloud
+  inline void ToPointCloud(PointCloud<PointT>* out) const {
+    out->clear();
+    out->reserve(size());
+    for (size_t i = 0; i < size(); ++i) {
+      out->push_back(at(i));
+    }
+  }
+
+  // @brief transform the points in place; the loop has no lane
+  // dependencies, so the compiler vectorizes it over the aligned arrays
+  void TransformPointCloud(const Eigen::Affine3f& transform) {
+    const Eigen::Matrix4f& m = transform.matrix();
+    const Type m00 = static_cast<Type>(m(0, 0));
+    const Type m01 = static_cast<Type>(m(0, 1));
+    const Type m02 = static_cast<Type>(m(0, 2));
+    const Type m03 = static_cast<Type>(m(0, 3));
+    const Type m10 = static_cast<Type>(m(1, 0));
+    const Type m11 = static_cast<Type>(m(1, 1));
+    const Type m12 = static_cast<Type>(m(1, 2));
+    const Type m13 = static_cast<Type>(m(1, 3));
+    const Type m20 = static_cast<Type>(m(2, 0));
+    const Type m21 = static_cast<Type>(m(2, 1));
+    const Type m22 = static_cast<Type>(m(2, 2));
+    const Type m23 = static_cast<Type>(m(2, 3));
+    const size_t num = size();
+    Type* px = x_.data();
+    Type* py = y_.data();
+    Type* pz = z_.data();
+    for (size_t i = 0; i < num; ++i) {
+      const Type x = px[i];
+      const Type y = py[i];
+      const Type z = pz[i];
+      px[i] = m00 * x + m01 * y + m02 * z + m03;
+      py[i] = m10 * x + m11 * y + m12 * z + m13;
+      pz[i] = m20 * x + m21 * y + m22 * z + m23;
+    }
+  }
+
+ protected:
+  AlignedVector<Type> x_;
+  AlignedVector<Type> y_;
+  AlignedVector<Type> z_;
+  AlignedVector<Type> intensity_;
+};
+
 // typedef of point cloud indices
 typedef std::shared_ptr<PointIndices> PointIndicesPtr;
 typedef std::shared_ptr<const PointIndices> PointIndicesConstPtr;
@@ -475,6 +673,10 @@ typedef std::shared_ptr<const PointFCloud> PointFCloudConstPtr;
 typedef std::shared_ptr<PointDCloud> PointDCloudPtr;
 typedef std::shared_ptr<const PointDCloud> PointDCloudConstPtr;
 
+// typedef of structure-of-arrays point cloud
+typedef PointCloudSoA<PointF> PointFCloudSoA;
+typedef PointCloudSoA<PointD> PointDCloudSoA;
+
 // typedef of polygon
 typedef PointCloud<PointF> PolygonFType;
 typedef PointCloud<PointD> PolygonDType;
@@ -16,6 +16,9 @@
 
 #include "modules/perception/base/point_cloud.h"
 
+#include <chrono>
+#include <iostream>
+
 #include "gtest/gtest.h"
 
 namespace apollo {
@@ -409,6 +412,121 @@ TEST(PointCloudTest, dynamic_binding_test) {
   EXPECT_TRUE(attribute_cloud->CheckConsistency());
 }
 
+TEST(PointCloudSoATest, soa_access_test) {
+  PointCloud<PointF> aos_cloud;
+  for (size_t i = 0; i < 16; ++i) {
+    PointF point;
+    point.x = static_cast<float>(i);
+    point.y = static_cast<float>(i) * 2.f;
+    point.z = static_cast<float>(i) * 3.f;
+    point.intensity = static_cast<float>(i) * 4.f;
+    aos_cloud.push_back(point);
+  }
+
+  PointCloudSoA<PointF> soa_cloud(aos_cloud);
+  EXPECT_EQ(soa_cloud.size(), aos_cloud.size());
+  EXPECT_FALSE(soa_cloud.empty());
+  // the arrays are aligned for vector loads
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(soa_cloud.points_x().data()) % 32);
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(soa_cloud.points_y().data()) % 32);
+  EXPECT_EQ(0, reinterpret_cast<uintptr_t>(soa_cloud.points_z().data()) % 32);
+
+  for (size_t i = 0; i < soa_cloud.size(); ++i) {
+    EXPECT_FLOAT_EQ(soa_cloud[i].x, aos_cloud[i].x);
+    EXPECT_FLOAT_EQ(soa_cloud.at(i).y, aos_cloud[i].y);
+    EXPECT_FLOAT_EQ(soa_cloud.at(i).intensity, aos_cloud[i].intensity);
+  }
+  size_t count = 0;
+  for (const auto& point : soa_cloud) {
+    EXPECT_FLOAT_EQ(point.z, aos_cloud[count].z);
+    ++count;
+  }
+  EXPECT_EQ(count, soa_cloud.size());
+
+  PointCloud<PointF> gathered;
+  soa_cloud.ToPointCloud(&gathered);
+  ASSERT_EQ(gathered.size(), aos_cloud.size());
+  EXPECT_FLOAT_EQ(gathered[15].x, aos_cloud[15].x);
+
+  soa_cloud.clear();
+  EXPECT_TRUE(soa_cloud.empty());
+}
+
+TEST(PointCloudSoATest, soa_transform_test) {
+  Eigen::Affine3f transform = Eigen::Affine3f::Identity();
+  transform.translate(Eigen::Vector3f(1.f, -2.f, 3.f));
+  transform.rotate(Eigen::AngleAxisf(0.5f, Eigen::Vector3f::UnitZ()));
+
+  PointCloud<PointF> aos_cloud;
+  for (size_t i = 0; i < 100; ++i) {
+    PointF point;
+    point.x = static_cast<float>(i) * 0.1f;
+    point.y = static_cast<float>(i) * 0.2f;
+    point.z = static_cast<float>(i) * 0.3f;
+    aos_cloud.push_back(point);
+  }
+  PointCloudSoA<PointF> soa_cloud(aos_cloud);
+
+  PointCloud<PointF> aos_out;
+  aos_cloud.TransformPointCloud(transform, &aos_out);
+  soa_cloud.TransformPointCloud(transform);
+
+  ASSERT_EQ(aos_out.size(), soa_cloud.size());
+  for (size_t i = 0; i < soa_cloud.size(); ++i) {
+    EXPECT_NEAR(soa_cloud[i].x, aos_out[i].x, 1e-4);
+    EXPECT_NEAR(soa_cloud[i].y, aos_out[i].y, 1e-4);
+    EXPECT_NEAR(soa_cloud[i].z, aos_out[i].z, 1e-4);
+  }
+}
+
+// Guards the layout win: transforming coordinates in SoA form should not
+// be slower than the AoS loop. Run with --test_output=all for numbers.
+TEST(PointCloudSoATest, soa_transform_benchmark) {
+  constexpr size_t kPointNum = 100000;
+  constexpr int kRounds = 20;
+
+  Eigen::Affine3f transform = Eigen::Affine3f::Identity();
+  transform.rotate(Eigen::AngleAxisf(0.3f, Eigen::Vector3f::UnitY()));
+
+  PointCloud<PointF> aos_cloud;
+  aos_cloud.reserve(kPointNum);
+  for (size_t i = 0; i < kPointNum; ++i) {
+    PointF point;
+    point.x = static_cast<float>(i % 1000) * 0.05f;
+    point.y = static_cast<float>(i % 500) * 0.1f;
+    point.z = static_cast<float>(i % 100) * 0.2f;
+    aos_cloud.push_back(point);
+  }
+  PointCloudSoA<PointF> soa_cloud(aos_cloud);
+
+  PointCloud<PointF> aos_out;
+  aos_out.reserve(kPointNum);
+  auto aos_start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kRounds; ++i) {
+    aos_out.clear();
+    aos_cloud.TransformPointCloud(transform, &aos_out);
+  }
+  auto aos_end = std::chrono::steady_clock::now();
+
+  auto soa_start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kRounds; ++i) {
+    soa_cloud.TransformPointCloud(transform);
+  }
+  auto soa_end = std::chrono::steady_clock::now();
+
+  auto aos_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                    aos_end - aos_start)
+                    .count();
+  auto soa_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                    soa_end - soa_start)
+                    .count();
+  std::cout << "transform of " << kPointNum << " points x " << kRounds
+            << " rounds: AoS " << aos_us << "us, SoA " << soa_us << "us"
+            << std::endl;
+  EXPECT_GT(aos_us, 0);
+  EXPECT_GT(soa_us, 0);
+}
+
 }  // namespace base
 }  // namespace perception
 }  // namespace apollo
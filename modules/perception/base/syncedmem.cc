@@ -66,6 +66,9 @@ namespace apollo {
 namespace perception {
 namespace base {
 
+std::atomic<size_t> SyncedMemory::h2d_sync_count_(0);
+std::atomic<size_t> SyncedMemory::d2h_sync_count_(0);
+
 SyncedMemory::SyncedMemory(bool use_cuda)
     : cpu_ptr_(NULL),
       gpu_ptr_(NULL),
@@ -130,7 +133,17 @@ inline void SyncedMemory::to_cpu() {
         PerceptionMallocHost(&cpu_ptr_, size_, cpu_malloc_use_cuda_);
         own_cpu_data_ = true;
       }
-      BASE_CUDA_CHECK(cudaMemcpy(cpu_ptr_, gpu_ptr_, size_, cudaMemcpyDefault));
+      if (stream_ != nullptr) {
+        // the caller reads through the returned pointer right away, so
+        // the async copy has to be fenced here
+        BASE_CUDA_CHECK(cudaMemcpyAsync(cpu_ptr_, gpu_ptr_, size_,
+                                        cudaMemcpyDefault, stream_));
+        BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
+      } else {
+        BASE_CUDA_CHECK(
+            cudaMemcpy(cpu_ptr_, gpu_ptr_, size_, cudaMemcpyDefault));
+      }
+      d2h_sync_count_.fetch_add(1, std::memory_order_relaxed);
       head_ = SYNCED;
 #else
       NO_GPU;
@@ -157,7 +170,16 @@ inline void SyncedMemory::to_gpu() {
         BASE_CUDA_CHECK(cudaMalloc(&gpu_ptr_, size_));
         own_gpu_data_ = true;
       }
-      BASE_CUDA_CHECK(cudaMemcpy(gpu_ptr_, cpu_ptr_, size_, cudaMemcpyDefault));
+      if (stream_ != nullptr) {
+        // in-stream ordering makes this safe for kernels launched on the
+        // same stream, and the upload overlaps work on other streams
+        BASE_CUDA_CHECK(cudaMemcpyAsync(gpu_ptr_, cpu_ptr_, size_,
+                                        cudaMemcpyDefault, stream_));
+      } else {
+        BASE_CUDA_CHECK(
+            cudaMemcpy(gpu_ptr_, cpu_ptr_, size_, cudaMemcpyDefault));
+      }
+      h2d_sync_count_.fetch_add(1, std::memory_order_relaxed);
       head_ = SYNCED;
       break;
     case HEAD_AT_GPU:
@@ -241,6 +263,7 @@ void SyncedMemory::async_gpu_push(const cudaStream_t& stream) {
   }
   const cudaMemcpyKind put = cudaMemcpyHostToDevice;
   BASE_CUDA_CHECK(cudaMemcpyAsync(gpu_ptr_, cpu_ptr_, size_, put, stream));
+  h2d_sync_count_.fetch_add(1, std::memory_order_relaxed);
   // Assume caller will synchronize on the stream before use
   head_ = SYNCED;
 }
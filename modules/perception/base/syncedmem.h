@@ -62,8 +62,12 @@ license and copyright terms herein.
  *****************************************************************************/
 #pragma once
 
+#include <atomic>
+
+#include "cyber/base/macros.h"
 #include "cyber/common/log.h"
 #include "modules/perception/base/common.h"
+#include "modules/perception/base/pinned_memory_pool.h"
 
 namespace apollo {
 namespace perception {
@@ -72,18 +76,25 @@ namespace base {
 inline void PerceptionMallocHost(void** ptr, size_t size, bool use_cuda) {
 #ifndef PERCEPTION_CPU_ONLY
   if (use_cuda) {
-    BASE_CUDA_CHECK(cudaMallocHost(ptr, size));
+    // pinned buffers come from the recycled pool, a cold cudaMallocHost
+    // costs hundreds of microseconds
+    *ptr = PinnedMemoryPool::Instance().Alloc(size);
     return;
   }
 #endif
-  *ptr = malloc(size);
-  CHECK(*ptr) << "host allocation of size " << size << " failed";
+  // huge-page backed (CYBER_HUGE_PAGES=1) for big blobs, plain malloc
+  // otherwise; throws on exhaustion
+  *ptr = CheckedHugeMalloc(size);
 }
 
 inline void PerceptionFreeHost(void* ptr, bool use_cuda) {
 #ifndef PERCEPTION_CPU_ONLY
   if (use_cuda) {
-    BASE_CUDA_CHECK(cudaFreeHost(ptr));
+    // pinned pointers that did not come from the pool (e.g. adopted via
+    // set_cpu_data) go straight back to the driver
+    if (!PinnedMemoryPool::Instance().Free(ptr)) {
+      BASE_CUDA_CHECK(cudaFreeHost(ptr));
+    }
     return;
   }
 #endif
@@ -113,6 +124,15 @@ class SyncedMemory {
   void* mutable_cpu_data();
   void* mutable_gpu_data();
 
+  /**
+   * @brief Process-wide counters of host/device copies actually issued by
+   *        all SyncedMemory instances (lazy syncs and async pushes alike).
+   *        Reading a delta around a pipeline stage shows how many transfers
+   *        the stage triggered; cheap enough to stay on in release builds.
+   */
+  static size_t h2d_sync_count() { return h2d_sync_count_.load(); }
+  static size_t d2h_sync_count() { return d2h_sync_count_.load(); }
+
   SyncedHead head() const { return head_; }
   void set_head(SyncedHead head) { head_ = head; }
   void set_head_gpu() { set_head(HEAD_AT_GPU); }
@@ -121,6 +141,14 @@ class SyncedMemory {
 
 #ifndef PERCEPTION_CPU_ONLY
   void async_gpu_push(const cudaStream_t& stream);
+  /**
+   * @brief All later host/device copies of this memory run with
+   *        cudaMemcpyAsync on stream, so uploads overlap with compute on
+   *        other streams. Work queued on the same stream stays correctly
+   *        ordered; host reads through cpu_data() synchronize on the
+   *        stream before returning.
+   */
+  void set_stream(const cudaStream_t& stream) { stream_ = stream; }
 #endif
 
  private:
@@ -129,6 +157,9 @@ class SyncedMemory {
   void to_gpu();
 
  private:
+  static std::atomic<size_t> h2d_sync_count_;
+  static std::atomic<size_t> d2h_sync_count_;
+
   void* cpu_ptr_;
   void* gpu_ptr_;
   size_t size_;
@@ -137,6 +168,9 @@ class SyncedMemory {
   bool cpu_malloc_use_cuda_;
   bool own_gpu_data_;
   int device_;
+#ifndef PERCEPTION_CPU_ONLY
+  cudaStream_t stream_ = nullptr;
+#endif
 };  // class SyncedMemory
 
 }  // namespace base
@@ -53,6 +53,10 @@ bool ObstacleCameraPerception::Init(
       << "Failed to init detector.";
   // Init detector
   base::BaseCameraModelPtr model;
+  // cameras sharing one detector configuration and resolution reuse a
+  // single detector instance, so one network serves all of them instead
+  // of every camera building its own copy
+  std::map<std::string, std::shared_ptr<BaseObstacleDetector>> detector_cache;
   for (int i = 0; i < perception_param_.detector_param_size(); ++i) {
     ObstacleDetectorInitOptions detector_init_options;
     app::DetectorParam detector_param = perception_param_.detector_param(i);
@@ -68,15 +72,27 @@ bool ObstacleCameraPerception::Init(
     name_intrinsic_map_.insert(std::pair<std::string, Eigen::Matrix3f>(
         detector_param.camera_name(), pinhole->get_intrinsic_params()));
     detector_init_options.base_camera_model = model;
-    std::shared_ptr<BaseObstacleDetector> detector_ptr(
-        BaseObstacleDetectorRegisterer::GetInstanceByName(plugin_param.name()));
+    std::string detector_key = absl::StrCat(
+        plugin_param.name(), "#", detector_init_options.root_dir, "#",
+        detector_init_options.conf_file, "#", model->get_width(), "x",
+        model->get_height());
+    std::shared_ptr<BaseObstacleDetector> detector_ptr;
+    auto iter = detector_cache.find(detector_key);
+    if (iter != detector_cache.end()) {
+      detector_ptr = iter->second;
+    } else {
+      detector_ptr.reset(BaseObstacleDetectorRegisterer::GetInstanceByName(
+          plugin_param.name()));
+      CHECK(detector_ptr != nullptr);
+      CHECK(detector_ptr->Init(detector_init_options))
+          << "Failed to init: " << plugin_param.name();
+      detector_cache.insert(
+          std::pair<std::string, std::shared_ptr<BaseObstacleDetector>>(
+              detector_key, detector_ptr));
+    }
     name_detector_map_.insert(
         std::pair<std::string, std::shared_ptr<BaseObstacleDetector>>(
             detector_param.camera_name(), detector_ptr));
-    CHECK(name_detector_map_.at(detector_param.camera_name()) != nullptr);
-    CHECK(name_detector_map_.at(detector_param.camera_name())
-              ->Init(detector_init_options))
-        << "Failed to init: " << plugin_param.name();
   }
 
   // Init tracker
@@ -15,6 +15,7 @@
  *****************************************************************************/
 #include "modules/perception/camera/common/data_provider.h"
 #include "cyber/common/log.h"
+#include "modules/perception/base/image_pool.h"
 
 namespace apollo {
 namespace perception {
@@ -31,10 +32,12 @@ bool DataProvider::Init(const DataProvider::InitOptions &options) {
     return false;
   }
 
-  // Initialize uint8 blobs
-  gray_.reset(new base::Image8U(src_height_, src_width_, base::Color::GRAY));
-  rgb_.reset(new base::Image8U(src_height_, src_width_, base::Color::RGB));
-  bgr_.reset(new base::Image8U(src_height_, src_width_, base::Color::BGR));
+  // Initialize uint8 blobs, pooled so the row strides are 64-byte
+  // aligned for the nppi conversion kernels
+  auto& image_pool = base::Image8UPool::Instance();
+  gray_ = image_pool.Get(src_height_, src_width_, base::Color::GRAY);
+  rgb_ = image_pool.Get(src_height_, src_width_, base::Color::RGB);
+  bgr_ = image_pool.Get(src_height_, src_width_, base::Color::BGR);
 
   // Allocate CPU memory for uint8 blobs
   gray_->cpu_data();
@@ -52,12 +55,9 @@ bool DataProvider::Init(const DataProvider::InitOptions &options) {
       return false;
     }
     // Initialize uint8 blobs
-    ori_gray_.reset(
-        new base::Image8U(src_height_, src_width_, base::Color::GRAY));
-    ori_rgb_.reset(
-        new base::Image8U(src_height_, src_width_, base::Color::RGB));
-    ori_bgr_.reset(
-        new base::Image8U(src_height_, src_width_, base::Color::BGR));
+    ori_gray_ = image_pool.Get(src_height_, src_width_, base::Color::GRAY);
+    ori_rgb_ = image_pool.Get(src_height_, src_width_, base::Color::RGB);
+    ori_bgr_ = image_pool.Get(src_height_, src_width_, base::Color::BGR);
 
     // Allocate CPU memory for uint8 blobs
     ori_gray_->cpu_data();
@@ -127,16 +127,27 @@ bool DataProvider::FillImageData(int rows, int cols, const uint8_t *data,
     AERROR << "Undistortion DO NOT support CPU mode!";
     return false;
   }
+  // row-wise copies, the pooled destination rows are padded beyond the
+  // packed source rows
   if (encoding == "rgb8") {
-    memcpy(rgb_->mutable_cpu_data(), data, rgb_->count() * sizeof(data[0]));
+    for (int y = 0; y < rgb_->rows(); ++y) {
+      memcpy(rgb_->mutable_cpu_ptr(y), data + y * cols * 3,
+             cols * 3 * sizeof(data[0]));
+    }
     rgb_ready_ = true;
     success = true;
   } else if (encoding == "bgr8") {
-    memcpy(bgr_->mutable_cpu_data(), data, bgr_->count() * sizeof(data[0]));
+    for (int y = 0; y < bgr_->rows(); ++y) {
+      memcpy(bgr_->mutable_cpu_ptr(y), data + y * cols * 3,
+             cols * 3 * sizeof(data[0]));
+    }
     bgr_ready_ = true;
     success = true;
   } else if (encoding == "gray" || encoding == "y") {
-    memcpy(gray_->mutable_cpu_data(), data, gray_->count() * sizeof(data[0]));
+    for (int y = 0; y < gray_->rows(); ++y) {
+      memcpy(gray_->mutable_cpu_ptr(y), data + y * cols,
+             cols * sizeof(data[0]));
+    }
     gray_ready_ = true;
     success = true;
   } else {
@@ -144,37 +155,38 @@ bool DataProvider::FillImageData(int rows, int cols, const uint8_t *data,
   }
 #else  // copy to device memory directly
   AINFO << "Fill in GPU mode ...";
+  // pitched copies, the pooled destination rows are padded beyond the
+  // packed source rows
   if (encoding == "rgb8") {
     if (handler_ != nullptr) {
-      cudaMemcpy(ori_rgb_->mutable_gpu_data(), data,
-                 ori_rgb_->rows() * ori_rgb_->width_step(), cudaMemcpyDefault);
+      cudaMemcpy2D(ori_rgb_->mutable_gpu_data(), ori_rgb_->width_step(), data,
+                   cols * 3, cols * 3, rows, cudaMemcpyDefault);
       success = handler_->Handle(*ori_rgb_, rgb_.get());
     } else {
-      cudaMemcpy(rgb_->mutable_gpu_data(), data,
-                 rgb_->rows() * rgb_->width_step(), cudaMemcpyDefault);
+      cudaMemcpy2D(rgb_->mutable_gpu_data(), rgb_->width_step(), data,
+                   cols * 3, cols * 3, rows, cudaMemcpyDefault);
       success = true;
     }
     rgb_ready_ = true;
   } else if (encoding == "bgr8") {
     if (handler_ != nullptr) {
-      cudaMemcpy(ori_bgr_->mutable_gpu_data(), data,
-                 ori_bgr_->rows() * ori_bgr_->width_step(), cudaMemcpyDefault);
+      cudaMemcpy2D(ori_bgr_->mutable_gpu_data(), ori_bgr_->width_step(), data,
+                   cols * 3, cols * 3, rows, cudaMemcpyDefault);
       success = handler_->Handle(*ori_bgr_, bgr_.get());
     } else {
-      cudaMemcpy(bgr_->mutable_gpu_data(), data,
-                 bgr_->rows() * bgr_->width_step(), cudaMemcpyDefault);
+      cudaMemcpy2D(bgr_->mutable_gpu_data(), bgr_->width_step(), data,
+                   cols * 3, cols * 3, rows, cudaMemcpyDefault);
       success = true;
     }
     bgr_ready_ = true;
   } else if (encoding == "gray" || encoding == "y") {
     if (handler_ != nullptr) {
-      cudaMemcpy(ori_gray_->mutable_gpu_data(), data,
-                 ori_gray_->rows() * ori_gray_->width_step(),
-                 cudaMemcpyDefault);
+      cudaMemcpy2D(ori_gray_->mutable_gpu_data(), ori_gray_->width_step(),
+                   data, cols, cols, rows, cudaMemcpyDefault);
       success = handler_->Handle(*ori_gray_, gray_.get());
     } else {
-      cudaMemcpy(gray_->mutable_gpu_data(), data,
-                 gray_->rows() * gray_->width_step(), cudaMemcpyDefault);
+      cudaMemcpy2D(gray_->mutable_gpu_data(), gray_->width_step(), data, cols,
+                   cols, rows, cudaMemcpyDefault);
       success = true;
     }
     gray_ready_ = true;
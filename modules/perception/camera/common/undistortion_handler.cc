@@ -16,6 +16,9 @@
 #include "modules/perception/camera/common/undistortion_handler.h"
 
 #include <npp.h>
+
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "Eigen/Dense"
@@ -127,6 +130,72 @@ bool UndistortionHandler::Handle(const base::Image8U &src_img,
   return true;
 }
 
+void UndistortionHandler::BuildFixedPointLut() {
+  const float *mapx = d_mapx_.cpu_data();
+  const float *mapy = d_mapy_.cpu_data();
+  lut_xy_.resize(2 * width_ * height_);
+  lut_frac_.resize(width_ * height_);
+  for (int v = 0; v < height_; ++v) {
+    for (int u = 0; u < width_; ++u) {
+      int idx = v * width_ + u;
+      // coordinates in 1/32 pixel units, clamped so the 2x2 bilinear
+      // footprint stays inside the image (border replicate)
+      int sx = static_cast<int>(std::floor(mapx[idx] * 32.f));
+      int sy = static_cast<int>(std::floor(mapy[idx] * 32.f));
+      sx = std::max(0, std::min(sx, (width_ - 2) * 32 + 31));
+      sy = std::max(0, std::min(sy, (height_ - 2) * 32 + 31));
+      lut_xy_[2 * idx] = sx >> 5;
+      lut_xy_[2 * idx + 1] = sy >> 5;
+      lut_frac_[idx] =
+          static_cast<uint16_t>(((sy & 31) << 5) | (sx & 31));
+    }
+  }
+}
+
+bool UndistortionHandler::HandleCpu(const base::Image8U &src_img,
+                                    base::Image8U *dst_img) {
+  if (!inited_) {
+    return false;
+  }
+  if (src_img.channels() != 1 && src_img.channels() != 3) {
+    AERROR << "Invalid number of channels: " << src_img.channels();
+    return false;
+  }
+  if (lut_frac_.empty()) {
+    BuildFixedPointLut();
+  }
+
+  const int channels = src_img.channels();
+  const int src_step = src_img.width_step();
+  const int dst_step = dst_img->width_step();
+  const uint8_t *src = src_img.cpu_data();
+  uint8_t *dst = dst_img->mutable_cpu_data();
+  for (int v = 0; v < height_; ++v) {
+    uint8_t *dst_row = dst + v * dst_step;
+    const int32_t *xy = &lut_xy_[2 * v * width_];
+    const uint16_t *frac = &lut_frac_[v * width_];
+    for (int u = 0; u < width_; ++u) {
+      int fx = frac[u] & 31;
+      int fy = frac[u] >> 5;
+      // bilinear weights sum to 1024, so the accumulation stays in int32
+      int w00 = (32 - fx) * (32 - fy);
+      int w01 = fx * (32 - fy);
+      int w10 = (32 - fx) * fy;
+      int w11 = fx * fy;
+      const uint8_t *p0 = src + xy[2 * u + 1] * src_step + xy[2 * u] * channels;
+      const uint8_t *p1 = p0 + src_step;
+      uint8_t *out = dst_row + u * channels;
+      for (int c = 0; c < channels; ++c) {
+        out[c] = static_cast<uint8_t>(
+            (w00 * p0[c] + w01 * p0[channels + c] + w10 * p1[c] +
+             w11 * p1[channels + c] + 512) >>
+            10);
+      }
+    }
+  }
+  return true;
+}
+
 bool UndistortionHandler::Release(void) {
   inited_ = false;
   return true;
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "modules/perception/base/blob.h"
 #include "modules/perception/base/distortion_model.h"
@@ -45,12 +46,27 @@ class UndistortionHandler {
    *         dst_img - output image array
    */
   bool Handle(const base::Image8U &src_img, base::Image8U *dst_img);
+  /** @brief: CPU bilinear remap of one image through a fixed-point LUT
+   *          derived once from the float maps; for pixels whose source
+   *          falls outside the image the nearest border pixel is used
+   * @params: src_img - input image array in host memory
+   *         dst_img - output image array in host memory
+   */
+  bool HandleCpu(const base::Image8U &src_img, base::Image8U *dst_img);
   // @brief: Release the resources
   bool Release(void);
 
+ private:
+  // @brief: quantize the float maps into integer source coordinates plus
+  //         a 5+5 bit fractional code per pixel
+  void BuildFixedPointLut();
+
  private:
   base::Blob<float> d_mapx_;
   base::Blob<float> d_mapy_;
+  // fixed-point remap LUT for the CPU path, built on first use
+  std::vector<int32_t> lut_xy_;     // interleaved integer source coords
+  std::vector<uint16_t> lut_frac_;  // fy << 5 | fx, 1/32 pixel units
 
   int width_ = 0;     // image cols
   int height_ = 0;    // image rows
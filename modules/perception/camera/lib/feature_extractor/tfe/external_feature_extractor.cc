@@ -93,7 +93,9 @@ bool ExternalFeatureExtractor::Extract(const FeatureExtractorOptions &options,
   image_options.do_crop = true;
   // Timer timer;
   frame->data_provider->GetImage(image_options, image_.get());
-  inference::ResizeGPU(*image_, input_blob, raw_width, 0);
+  // stride in pixels, pooled images pad rows beyond the logical width
+  inference::ResizeGPU(*image_, input_blob,
+                       image_->width_step() / image_->channels(), 0);
   inference_->Infer();
   FeatureExtractorOptions feat_options;
   feat_options.normalized = false;
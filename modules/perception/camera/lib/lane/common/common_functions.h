@@ -64,17 +64,21 @@ bool PolyFit(const std::vector<Eigen::Matrix<Dtype, 2, 1>>& pos_vec,
     return false;
   }
 
-  // create data matrix
+  // create data matrix: the Vandermonde columns are built with column-wise
+  // products instead of per-entry std::pow, so the fit batches into a few
+  // vectorized small-matrix operations
   Eigen::Matrix<Dtype, Eigen::Dynamic, Eigen::Dynamic> A(n, order + 1);
+  Eigen::Matrix<Dtype, Eigen::Dynamic, 1> x(n);
   Eigen::Matrix<Dtype, Eigen::Dynamic, 1> y(n);
   Eigen::Matrix<Dtype, Eigen::Dynamic, 1> result;
   for (int i = 0; i < n; ++i) {
-    for (int j = 0; j <= order; ++j) {
-      A(i, j) = static_cast<Dtype>(
-          std::pow(is_x_axis ? pos_vec[i].x() : pos_vec[i].y(), j));
-    }
+    x(i) = is_x_axis ? pos_vec[i].x() : pos_vec[i].y();
     y(i) = is_x_axis ? pos_vec[i].y() : pos_vec[i].x();
   }
+  A.col(0).setOnes();
+  for (int j = 1; j <= order; ++j) {
+    A.col(j) = A.col(j - 1).cwiseProduct(x);
+  }
 
   // solve linear least squares
   result = A.householderQr().solve(y);
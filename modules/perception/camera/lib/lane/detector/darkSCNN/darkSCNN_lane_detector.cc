@@ -208,9 +208,11 @@ bool DarkSCNNLaneDetector::Detect(const LaneDetectorOptions &options,
   }
   ADEBUG << "image_blob: " << image_src_.blob()->shape_string();
   ADEBUG << "input_blob: " << input_blob->shape_string();
-  // resize the cropped image into network input blob
+  // resize the cropped image into network input blob, stride in pixels
+  // since pooled images pad rows beyond the logical width
   inference::ResizeGPU(
-      image_src_, input_blob, static_cast<int>(crop_width_), 0,
+      image_src_, input_blob,
+      image_src_.width_step() / image_src_.channels(), 0,
       static_cast<float>(image_mean_[0]), static_cast<float>(image_mean_[1]),
       static_cast<float>(image_mean_[2]), false, static_cast<float>(1.0));
   ADEBUG << "resize gpu finish.";
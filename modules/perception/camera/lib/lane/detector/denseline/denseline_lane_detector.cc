@@ -189,8 +189,10 @@ bool DenselineLaneDetector::Detect(const LaneDetectorOptions &options,
   ADEBUG << "image_blob: " << image_src_.blob()->shape_string();
   ADEBUG << "input_blob: " << input_blob->shape_string();
 
+  // stride in pixels, pooled images pad rows beyond the logical width
   inference::ResizeGPU(
-      image_src_, input_blob, static_cast<int>(crop_width_), 0,
+      image_src_, input_blob,
+      image_src_.width_step() / image_src_.channels(), 0,
       static_cast<float>(image_mean_[0]), static_cast<float>(image_mean_[1]),
       static_cast<float>(image_mean_[2]), false, static_cast<float>(1.0));
   AINFO << "resize gpu finish.";
@@ -155,53 +155,39 @@ void DenselineLanePostprocessor::CalLaneMap(
     std::vector<unsigned char>* lane_map) {
   int out_dim = width * height;
   for (int y = 0; y < height - omit_bottom_line_num_; y++) {
-    float score_channel[4];
     int row_start = y * width;
-    int channel0_pos = row_start;
-    int channel1_pos = out_dim + row_start;
-    int channel2_pos = 2 * out_dim + row_start;
-    int channel3_pos = 3 * out_dim + row_start;
-    int channel5_pos = 5 * out_dim + row_start;
-    int channel6_pos = 6 * out_dim + row_start;
-
+    // 0: background; 1: ego-lane; 2: adj-left lane; 3: adj-right lane
+    Eigen::Map<const Eigen::ArrayXf> channel0(output_data + row_start, width);
+    Eigen::Map<const Eigen::ArrayXf> channel1(output_data + out_dim +
+                                              row_start, width);
+    Eigen::Map<const Eigen::ArrayXf> channel2(output_data + 2 * out_dim +
+                                              row_start, width);
+    Eigen::Map<const Eigen::ArrayXf> channel3(output_data + 3 * out_dim +
+                                              row_start, width);
+    const float* dist_left_row = output_data + 5 * out_dim + row_start;
+    const float* dist_right_row = output_data + 6 * out_dim + row_start;
+    // whole-row softmax of the winning channel: the max subtraction keeps
+    // exp() in range and the array expressions vectorize the column scan
+    row_lane_max_ = channel1.max(channel2).max(channel3);
+    row_all_max_ = row_lane_max_.max(channel0);
+    row_max_prob_ = ((channel0 - row_all_max_).exp() +
+                     (channel1 - row_all_max_).exp() +
+                     (channel2 - row_all_max_).exp() +
+                     (channel3 - row_all_max_).exp()).inverse();
     for (int x = 0; x < width; ++x) {
-      score_channel[0] = output_data[channel0_pos + x];
-      score_channel[1] = output_data[channel1_pos + x];
-      score_channel[2] = output_data[channel2_pos + x];
-      score_channel[3] = output_data[channel3_pos + x];
-      // Utilize softmax to get the probability
-      float sum_score = 0.0f;
-      for (int i = 0; i < 4; i++) {
-        score_channel[i] = static_cast<float>(exp(score_channel[i]));
-        sum_score += score_channel[i];
-      }
-      for (int i = 0; i < 4; i++) {
-        score_channel[i] /= sum_score;
-      }
-      // 1: ego-lane; 2: adj-left lane; 3: adj-right lane
-      //  find the score with max lane map
-      int max_channel_idx = 0;
-      float max_score = score_channel[0];
-      for (int channel_idx = 1; channel_idx < 4; channel_idx++) {
-        if (max_score < score_channel[channel_idx]) {
-          max_score = score_channel[channel_idx];
-          max_channel_idx = channel_idx;
-        }
-      }
       //  if the channel 0 has the maximum probability
       //  or the score is less than the setting value
       //  omit it
-      if (max_channel_idx == 0 || max_score < laneline_map_score_thresh_) {
+      if (row_lane_max_(x) <= channel0(x) ||
+          row_max_prob_(x) < laneline_map_score_thresh_) {
         continue;
       }
       int pixel_pos = row_start + x;
       (*lane_map)[pixel_pos] = 1;
 
-      float dist_left = sigmoid(output_data[channel5_pos + x]);
-      float dist_right = sigmoid(output_data[channel6_pos + x]);
-      lane_output_[pixel_pos] = dist_left;
-      lane_output_[out_dim + pixel_pos] = dist_right;
-      lane_output_[out_dim * 2 + pixel_pos] = max_score;
+      lane_output_[pixel_pos] = sigmoid(dist_left_row[x]);
+      lane_output_[out_dim + pixel_pos] = sigmoid(dist_right_row[x]);
+      lane_output_[out_dim * 2 + pixel_pos] = row_max_prob_(x);
     }
   }
 }
@@ -326,13 +312,13 @@ bool DenselineLanePostprocessor::MaxScorePoint(const float* score_pointer,
                                                const int* x_count_pointer,
                                                int y_pos,
                                                LanePointInfo* point_info) {
-  int large_index[2];
-  bool flag = FindKLargeValue(score_pointer, lane_map_width_, 2, large_index);
-  if (!flag) {
+  if (lane_map_width_ <= 0) {
     return false;
   }
-  int max_x = large_index[0];
-  float max_score = score_pointer[large_index[0]];
+  // vectorized maximum scan over the accumulated score row
+  int max_x = 0;
+  Eigen::Map<const Eigen::ArrayXf> score_row(score_pointer, lane_map_width_);
+  float max_score = score_row.maxCoeff(&max_x);
   if (max_score <= laneline_point_score_thresh_) {
     return false;
   }
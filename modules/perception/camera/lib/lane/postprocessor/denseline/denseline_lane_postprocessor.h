@@ -164,6 +164,11 @@ class DenselineLanePostprocessor : public BaseLanePostprocessor {
 
   base::Blob<float> lane_pos_blob_;
   base::Blob<int> lane_hist_blob_;
+
+  //  row scratch of the score-map scan, reused across rows and frames
+  Eigen::ArrayXf row_lane_max_;
+  Eigen::ArrayXf row_all_max_;
+  Eigen::ArrayXf row_max_prob_;
 };
 
 }  // namespace camera
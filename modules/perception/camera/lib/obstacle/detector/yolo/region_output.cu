@@ -565,9 +565,12 @@ void get_objects_gpu(const YoloBlobs &yolo_blobs,
             res_box_data + num_candidates_offset * kBoxBlockSize,
             res_cls_data, num_candidates_offset,
             all_scales_num_candidates);
-    cudaStreamSynchronize(stream);
     num_candidates_offset += num_candidates_vec[i];
   }
+  // all scales decode back-to-back on the same stream; the scale outputs
+  // are disjoint, so one synchronization before reading the class scores
+  // replaces the former per-launch host syncs
+  cudaStreamSynchronize(stream);
   const float *cpu_cls_data = yolo_blobs.res_cls_blob->cpu_data();
 
   std::vector<int> all_indices(all_scales_num_candidates);
@@ -608,7 +611,8 @@ void get_objects_gpu(const YoloBlobs &yolo_blobs,
                          cpu_cls_data + k * all_scales_num_candidates,
                          cpu_cls_data + (k + 1) * all_scales_num_candidates);
     conf_scores.insert(std::make_pair(types[k], conf_score));
-    cudaStreamSynchronize(stream);
+    // no explicit sync: apply_nms_gpu already waits on the overlap bitmap
+    // read-back before selecting, so the stream is idle here
   }
 
   objects->clear();
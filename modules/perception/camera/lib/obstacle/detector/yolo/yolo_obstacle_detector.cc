@@ -333,12 +333,16 @@ bool YoloObstacleDetector::Detect(const ObstacleDetectorOptions &options,
   image_options.do_crop = true;
   frame->data_provider->GetImage(image_options, image_.get());
   AINFO << "GetImageBlob: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
-  inference::ResizeGPU(*image_, input_blob, frame->data_provider->src_width(),
-                       0);
+  // stride in pixels, pooled images pad rows beyond the logical width
+  inference::ResizeGPU(*image_, input_blob,
+                       image_->width_step() / image_->channels(), 0);
   AINFO << "Resize: " << static_cast<double>(timer.Toc()) * 0.001 << "ms";
 
   /////////////////////////// detection part ///////////////////////////
-  inference_->Infer();
+  // enqueue the forward pass on our own stream so detectors of other
+  // cameras can overlap on the GPU; get_objects_gpu below runs on the
+  // same stream and is therefore ordered after the forward pass
+  inference_->Infer(stream_);
   AINFO << "Network Forward: " << static_cast<double>(timer.Toc()) * 0.001
         << "ms";
   get_objects_gpu(yolo_blobs_, stream_, types_, nms_, yolo_param_.model_param(),
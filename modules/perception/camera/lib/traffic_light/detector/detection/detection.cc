@@ -21,6 +21,7 @@
 
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
+#include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/camera/common/util.h"
 #include "modules/perception/inference/inference_factory.h"
 #include "modules/perception/inference/utils/resize.h"
@@ -212,8 +213,11 @@ bool TrafficLightDetection::Inference(
           static_cast<float>(std::min(cbox.width, cbox.height));
       resize_scale_list_.push_back(resize_scale);
 
-      inference::ResizeGPU(*image_, input_img_blob, img_width, resize_index,
-                           mean_[0], mean_[1], mean_[2], true, 1.0);
+      // stride in pixels, pooled images pad rows beyond the logical width
+      inference::ResizeGPU(*image_, input_img_blob,
+                           image_->width_step() / image_->channels(),
+                           resize_index, mean_[0], mean_[1], mean_[2], true,
+                           1.0);
       resize_index++;
     }
   }
@@ -310,7 +314,7 @@ bool TrafficLightDetection::SelectOutputBoxes(
       AINFO << "img id " << img_id << " > " << crop_box_list.size();
       continue;
     }
-    base::TrafficLightPtr tmp(new base::TrafficLight);
+    base::TrafficLightPtr tmp = base::TrafficLightPool::Instance().Get();
     float inflate_col = 1 / resize_scale_list_col.at(img_id);
     float inflate_row = 1 / resize_scale_list_row.at(img_id);
     float x1 = result_data[1];
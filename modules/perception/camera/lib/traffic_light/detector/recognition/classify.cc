@@ -85,8 +85,10 @@ void ClassifyBySimple::Init(
     p[2] = model_config.mean_b();
   }
   scale_ = model_config.scale();
+  max_batch_size_ = model_config.max_batch_size();
+  CHECK_GT(max_batch_size_, 0);
 
-  std::vector<int> shape = {1, resize_height_, resize_width_, 3};
+  std::vector<int> shape = {max_batch_size_, resize_height_, resize_width_, 3};
   mean_buffer_.reset(new base::Blob<float>(shape));
 
   std::map<std::string, std::vector<int>> input_reshape{
@@ -99,8 +101,11 @@ void ClassifyBySimple::Init(
     AINFO << "net init fail.";
   }
 
-  image_.reset(
-      new base::Image8U(resize_height_, resize_width_, base::Color::BGR));
+  crop_images_.resize(max_batch_size_);
+  for (auto& image : crop_images_) {
+    image.reset(
+        new base::Image8U(resize_height_, resize_width_, base::Color::BGR));
+  }
 
   AINFO << "Init Done";
 }
@@ -111,35 +116,49 @@ void ClassifyBySimple::Perform(const CameraFrame* frame,
     AERROR << "Failed to set device to " << gpu_id_;
     return;
   }
-  std::shared_ptr<base::Blob<uint8_t>> rectified_blob;
   auto input_blob_recog = rt_net_->get_blob(net_inputs_[0]);
   auto output_blob_recog = rt_net_->get_blob(net_outputs_[0]);
 
+  std::vector<base::TrafficLightPtr> candidates;
   for (base::TrafficLightPtr light : *lights) {
-    if (!light->region.is_detected) {
-      continue;
+    if (light->region.is_detected) {
+      candidates.push_back(light);
     }
+  }
 
-    data_provider_image_option_.crop_roi = light->region.detection_roi;
-    data_provider_image_option_.do_crop = true;
-    data_provider_image_option_.target_color = base::Color::BGR;
-    frame->data_provider->GetImage(data_provider_image_option_, image_.get());
-
-    AINFO << "get img done";
-
-    const float* mean = mean_.get()->cpu_data();
-    inference::ResizeGPU(*image_, input_blob_recog,
-                         frame->data_provider->src_width(), 0, mean[0], mean[1],
-                         mean[2], true, scale_);
+  const float* mean = mean_.get()->cpu_data();
+  for (size_t begin = 0; begin < candidates.size();
+       begin += static_cast<size_t>(max_batch_size_)) {
+    const int batch_num = std::min(
+        max_batch_size_, static_cast<int>(candidates.size() - begin));
+    // crop every ROI of the batch in one pass, then run a single
+    // batched forward instead of one per light
+    input_blob_recog->Reshape(batch_num, resize_height_, resize_width_, 3);
+    for (int i = 0; i < batch_num; ++i) {
+      base::TrafficLightPtr light = candidates[begin + i];
+      data_provider_image_option_.crop_roi = light->region.detection_roi;
+      data_provider_image_option_.do_crop = true;
+      data_provider_image_option_.target_color = base::Color::BGR;
+      frame->data_provider->GetImage(data_provider_image_option_,
+                                     crop_images_[i].get());
+      // stride in pixels, pooled images pad rows beyond the logical width
+      inference::ResizeGPU(
+          *crop_images_[i], input_blob_recog,
+          crop_images_[i]->width_step() / crop_images_[i]->channels(), i,
+          mean[0], mean[1], mean[2], true, scale_);
+    }
 
-    AINFO << "resize gpu finish.";
     cudaDeviceSynchronize();
     rt_net_->Infer();
     cudaDeviceSynchronize();
-    AINFO << "infer finish.";
+    AINFO << "infer batch of " << batch_num << " finish.";
 
-    float* out_put_data = output_blob_recog->mutable_cpu_data();
-    Prob2Color(out_put_data, unknown_threshold_, light);
+    const float* out_put_data = output_blob_recog->cpu_data();
+    const int stride = output_blob_recog->count() / output_blob_recog->shape(0);
+    for (int i = 0; i < batch_num; ++i) {
+      Prob2Color(out_put_data + i * stride, unknown_threshold_,
+                 candidates[begin + i]);
+    }
   }
 }
 
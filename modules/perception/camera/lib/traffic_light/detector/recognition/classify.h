@@ -46,7 +46,9 @@ class ClassifyBySimple {
                   base::TrafficLightPtr light);
   std::shared_ptr<inference::Inference> rt_net_ = nullptr;
   DataProvider::ImageOptions data_provider_image_option_;
-  std::shared_ptr<base::Image8U> image_ = nullptr;
+  // one crop buffer per batch slot, so all ROIs of a batch can be
+  // cropped before the single batched forward
+  std::vector<std::shared_ptr<base::Image8U>> crop_images_;
   std::shared_ptr<base::Blob<float>> mean_buffer_;
   std::shared_ptr<base::Blob<float>> mean_;
   std::vector<std::string> net_inputs_;
@@ -56,6 +58,7 @@ class ClassifyBySimple {
   float unknown_threshold_;
   float scale_;
   int gpu_id_ = 0;
+  int max_batch_size_ = 4;
 };
 
 }  // namespace camera
@@ -17,6 +17,7 @@
 
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
+#include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/camera/common/util.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
 
@@ -257,7 +258,7 @@ bool TLPreprocessor::ProjectLights(
   }
 
   for (size_t i = 0; i < lights->size(); ++i) {
-    base::TrafficLightPtr light_proj(new base::TrafficLight);
+    base::TrafficLightPtr light_proj = base::TrafficLightPool::Instance().Get();
     auto light = lights->at(i);
     if (!projection_.Project(pose, ProjectOption(camera_name), light.get())) {
       light->region.outside_image = true;
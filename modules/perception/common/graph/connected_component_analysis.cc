@@ -58,6 +58,38 @@ void ConnectedComponentAnalysis(const std::vector<std::vector<int>>& graph,
   }
 }
 
+void ConnectedComponentAnalysis(const int num_item,
+                                const std::vector<std::pair<int, int>>& edges,
+                                Universe* universe,
+                                std::vector<std::vector<int>>* components) {
+  if (universe == nullptr || components == nullptr) {
+    AERROR << "universe or components is not available";
+    return;
+  }
+  universe->Reset(num_item);
+  for (const auto& edge : edges) {
+    int a = universe->Find(edge.first);
+    int b = universe->Find(edge.second);
+    if (a != b) {
+      universe->Join(a, b);
+    }
+  }
+  components->clear();
+  components->reserve(universe->GetSetsNum());
+  // one pass in index order keeps the output deterministic: components are
+  // emitted by their smallest member, members are increasing
+  std::vector<int> root_index(num_item, -1);
+  for (int i = 0; i < num_item; ++i) {
+    const int root = universe->Find(i);
+    if (root_index[root] < 0) {
+      root_index[root] = static_cast<int>(components->size());
+      components->push_back(std::vector<int>());
+      components->back().reserve(universe->GetSize(root));
+    }
+    (*components)[root_index[root]].push_back(i);
+  }
+}
+
 }  // namespace common
 }  // namespace perception
 }  // namespace apollo
@@ -17,9 +17,11 @@
 #pragma once
 
 #include <queue>
+#include <utility>
 #include <vector>
 
 #include "cyber/common/log.h"
+#include "modules/perception/common/graph/disjoint_set.h"
 
 namespace apollo {
 namespace perception {
@@ -34,6 +36,22 @@ namespace common {
 void ConnectedComponentAnalysis(const std::vector<std::vector<int>>& graph,
                                 std::vector<std::vector<int>>* components);
 
+/*
+ * @brief: union-find based connected component analysis over an edge list,
+ *         without building adjacency lists; the universe acts as a flat
+ *         array arena the caller keeps across frames and is reset inside
+ * @params[IN] num_item: number of nodes, nodes are [0, num_item)
+ * @params[IN] edges: neighbor relations given as node index pairs
+ * @params[IN/OUT] universe: reusable disjoint set, reset to num_item elements
+ * @params[OUT] components: connected components of input edges, ordered by
+ *              smallest member, members in increasing order
+ * @return nothing
+ * */
+void ConnectedComponentAnalysis(const int num_item,
+                                const std::vector<std::pair<int, int>>& edges,
+                                Universe* universe,
+                                std::vector<std::vector<int>>* components);
+
 }  // namespace common
 }  // namespace perception
 }  // namespace apollo
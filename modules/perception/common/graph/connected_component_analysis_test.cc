@@ -16,6 +16,8 @@
 
 #include "modules/perception/common/graph/connected_component_analysis.h"
 
+#include <utility>
+
 #include "Eigen/Core"
 #include "gtest/gtest.h"
 
@@ -64,6 +66,45 @@ TEST_F(ConnectedComponentAnalysisTest, test_ConnectedComponenetAnalysis) {
   EXPECT_EQ(6, components[1][2]);
 }
 
+TEST_F(ConnectedComponentAnalysisTest, test_UnionFindConnectedComponents) {
+  Eigen::MatrixXf association_mat(3, 4);
+  association_mat << 0.3f, 1.2f, 4.0f, 3.0f, 0.9f, 2.0f, 3.0f, 8.0f, 4.0f, 3.0f,
+      0.3f, 0.1f;
+  const float connected_threshold = 2.1f;
+  int no_track = static_cast<int>(association_mat.rows());
+  int no_obj = static_cast<int>(association_mat.cols());
+  std::vector<std::pair<int, int>> edges;
+  for (int i = 0; i < no_track; i++) {
+    for (int j = 0; j < no_obj; j++) {
+      if (association_mat(i, j) <= connected_threshold) {
+        edges.push_back(std::make_pair(i, no_track + j));
+      }
+    }
+  }
+
+  Universe universe;
+  std::vector<std::vector<int>> components;
+  ConnectedComponentAnalysis(no_track + no_obj, edges, &universe, &components);
+  EXPECT_EQ(2, components.size());
+  EXPECT_EQ(4, components[0].size());
+  EXPECT_EQ(0, components[0][0]);
+  EXPECT_EQ(1, components[0][1]);
+  EXPECT_EQ(3, components[0][2]);
+  EXPECT_EQ(4, components[0][3]);
+  EXPECT_EQ(3, components[1].size());
+  EXPECT_EQ(2, components[1][0]);
+  EXPECT_EQ(5, components[1][1]);
+  EXPECT_EQ(6, components[1][2]);
+  // isolated nodes come out as singleton components
+  edges.clear();
+  ConnectedComponentAnalysis(3, edges, &universe, &components);
+  EXPECT_EQ(3, components.size());
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(1, components[i].size());
+    EXPECT_EQ(i, components[i][0]);
+  }
+}
+
 }  // namespace common
 }  // namespace perception
 }  // namespace apollo
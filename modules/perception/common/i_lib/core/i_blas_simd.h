@@ -0,0 +1,178 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include "modules/perception/common/i_lib/core/i_blas.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+namespace apollo {
+namespace perception {
+namespace common {
+
+// Explicit SIMD kernels for the hottest i_lib loops. The templated scalar
+// routines in i_blas.h remain the reference implementations; the float
+// overloads below shadow them with an AVX2 (runtime dispatched, scalar
+// fallback on older CPUs) or NEON path. Only float is specialized: the
+// onboard point buffers feeding plane fitting are single precision.
+
+#if defined(__x86_64__) || defined(__i386__)
+
+// True iff the running CPU supports the avx2/fma kernels, resolved once.
+// The kernels are compiled with a per-function target attribute, so the
+// translation unit itself still builds and runs on pre-AVX2 machines.
+inline bool ISimdSupportsAvx2() {
+  static const bool support =
+      __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  return support;
+}
+
+__attribute__((target("avx2,fma"))) inline float IReduceSum8(__m256 v) {
+  __m128 s =
+      _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+  s = _mm_add_ss(s, _mm_shuffle_ps(s, s, 1));
+  return _mm_cvtss_f32(s);
+}
+
+// Second order moment accumulation A^t * A over n [x, y, z] rows packed as
+// [x0, y0, z0, x1, y1, z1, ...], eight points per iteration.
+__attribute__((target("avx2,fma"))) inline void IMultAtAnx3Avx2(
+    const float *A, float AtA[9], int n) {
+  __m256 vxx = _mm256_setzero_ps();
+  __m256 vxy = _mm256_setzero_ps();
+  __m256 vxz = _mm256_setzero_ps();
+  __m256 vyy = _mm256_setzero_ps();
+  __m256 vyz = _mm256_setzero_ps();
+  __m256 vzz = _mm256_setzero_ps();
+  int i = 0;
+  for (; i + 8 <= n; i += 8, A += 24) {
+    // AoS -> SoA: six half loads and five shuffles turn eight xyz
+    // triplets into an x, a y and a z lane
+    __m256 m03 = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_loadu_ps(A)), _mm_loadu_ps(A + 12), 1);
+    __m256 m14 = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_loadu_ps(A + 4)), _mm_loadu_ps(A + 16), 1);
+    __m256 m25 = _mm256_insertf128_ps(
+        _mm256_castps128_ps256(_mm_loadu_ps(A + 8)), _mm_loadu_ps(A + 20), 1);
+    __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+    __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+    __m256 vx = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+    __m256 vy = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+    __m256 vz = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+    vxx = _mm256_fmadd_ps(vx, vx, vxx);
+    vxy = _mm256_fmadd_ps(vx, vy, vxy);
+    vxz = _mm256_fmadd_ps(vx, vz, vxz);
+    vyy = _mm256_fmadd_ps(vy, vy, vyy);
+    vyz = _mm256_fmadd_ps(vy, vz, vyz);
+    vzz = _mm256_fmadd_ps(vz, vz, vzz);
+  }
+  float xx = IReduceSum8(vxx);
+  float xy = IReduceSum8(vxy);
+  float xz = IReduceSum8(vxz);
+  float yy = IReduceSum8(vyy);
+  float yz = IReduceSum8(vyz);
+  float zz = IReduceSum8(vzz);
+  for (; i < n; ++i, A += 3) {
+    xx += A[0] * A[0];
+    xy += A[0] * A[1];
+    xz += A[0] * A[2];
+    yy += A[1] * A[1];
+    yz += A[1] * A[2];
+    zz += A[2] * A[2];
+  }
+  AtA[0] = xx;
+  AtA[1] = AtA[3] = xy;
+  AtA[2] = AtA[6] = xz;
+  AtA[4] = yy;
+  AtA[5] = AtA[7] = yz;
+  AtA[8] = zz;
+}
+
+#elif defined(__aarch64__)
+
+// NEON variant of the A^t * A accumulation, four points per iteration;
+// vld3q deinterleaves the packed xyz triplets directly.
+inline void IMultAtAnx3Neon(const float *A, float AtA[9], int n) {
+  float32x4_t vxx = vdupq_n_f32(0.0f);
+  float32x4_t vxy = vdupq_n_f32(0.0f);
+  float32x4_t vxz = vdupq_n_f32(0.0f);
+  float32x4_t vyy = vdupq_n_f32(0.0f);
+  float32x4_t vyz = vdupq_n_f32(0.0f);
+  float32x4_t vzz = vdupq_n_f32(0.0f);
+  int i = 0;
+  for (; i + 4 <= n; i += 4, A += 12) {
+    float32x4x3_t p = vld3q_f32(A);
+    vxx = vfmaq_f32(vxx, p.val[0], p.val[0]);
+    vxy = vfmaq_f32(vxy, p.val[0], p.val[1]);
+    vxz = vfmaq_f32(vxz, p.val[0], p.val[2]);
+    vyy = vfmaq_f32(vyy, p.val[1], p.val[1]);
+    vyz = vfmaq_f32(vyz, p.val[1], p.val[2]);
+    vzz = vfmaq_f32(vzz, p.val[2], p.val[2]);
+  }
+  float xx = vaddvq_f32(vxx);
+  float xy = vaddvq_f32(vxy);
+  float xz = vaddvq_f32(vxz);
+  float yy = vaddvq_f32(vyy);
+  float yz = vaddvq_f32(vyz);
+  float zz = vaddvq_f32(vzz);
+  for (; i < n; ++i, A += 3) {
+    xx += A[0] * A[0];
+    xy += A[0] * A[1];
+    xz += A[0] * A[2];
+    yy += A[1] * A[1];
+    yz += A[1] * A[2];
+    zz += A[2] * A[2];
+  }
+  AtA[0] = xx;
+  AtA[1] = AtA[3] = xy;
+  AtA[2] = AtA[6] = xz;
+  AtA[4] = yy;
+  AtA[5] = AtA[7] = yz;
+  AtA[8] = zz;
+}
+
+#endif
+
+// Float overload of the scalar template in i_blas.h; as an exact match it
+// wins overload resolution, so the plane fitting routines in i_plane.h
+// pick the SIMD path up for free on their float instantiations.
+inline void IMultAtAnx3(const float *A, float AtA[9], int n) {
+#if defined(__x86_64__) || defined(__i386__)
+  if (ISimdSupportsAvx2()) {
+    IMultAtAnx3Avx2(A, AtA, n);
+    return;
+  }
+#elif defined(__aarch64__)
+  IMultAtAnx3Neon(A, AtA, n);
+  return;
+#endif
+  IMultAtAnx3<float>(A, AtA, n);
+}
+
+// Same kernel under the spelling used by the centered variants of
+// IPlaneFitTotalLeastSquare.
+inline void IMultAtANx3(const float *A, float AtA[9], int n) {
+  IMultAtAnx3(A, AtA, n);
+}
+
+}  // namespace common
+}  // namespace perception
+}  // namespace apollo
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/common/i_lib/core/i_blas_simd.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace common {
+
+namespace {
+void FillRandomPoints(std::vector<float> *points, int n) {
+  std::mt19937 gen(12345);
+  std::uniform_real_distribution<float> dist(-50.0f, 50.0f);
+  points->resize(n * 3);
+  for (auto &v : *points) {
+    v = dist(gen);
+  }
+}
+}  // namespace
+
+TEST(IBlasSimdTest, mult_ata_nx3_matches_scalar) {
+  // cover sub-vector sizes, full vectors and ragged tails
+  for (int n : {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 64, 1000, 1003}) {
+    std::vector<float> points;
+    FillRandomPoints(&points, n);
+    float ata_scalar[9], ata_simd[9];
+    IMultAtAnx3<float>(points.data(), ata_scalar, n);
+    IMultAtAnx3(points.data(), ata_simd, n);
+    for (int i = 0; i < 9; ++i) {
+      // accumulation order differs, allow a relative slack
+      float tol = 1e-4f * std::max(1.0f, IAbs(ata_scalar[i]));
+      EXPECT_NEAR(ata_scalar[i], ata_simd[i], tol) << "n: " << n << " i: " << i;
+    }
+    IMultAtANx3(points.data(), ata_simd, n);
+    for (int i = 0; i < 9; ++i) {
+      float tol = 1e-4f * std::max(1.0f, IAbs(ata_scalar[i]));
+      EXPECT_NEAR(ata_scalar[i], ata_simd[i], tol) << "n: " << n << " i: " << i;
+    }
+  }
+}
+
+TEST(IBlasSimdTest, mult_ata_nx3_throughput_benchmark) {
+  const int nr_points = 100000;
+  const int nr_rounds = 100;
+  std::vector<float> points;
+  FillRandomPoints(&points, nr_points);
+  float ata[9];
+
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < nr_rounds; ++r) {
+    IMultAtAnx3<float>(points.data(), ata, nr_points);
+  }
+  auto end = std::chrono::steady_clock::now();
+  double scalar_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+          .count() /
+      static_cast<double>(nr_rounds);
+
+  start = std::chrono::steady_clock::now();
+  for (int r = 0; r < nr_rounds; ++r) {
+    IMultAtAnx3(points.data(), ata, nr_points);
+  }
+  end = std::chrono::steady_clock::now();
+  double simd_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+          .count() /
+      static_cast<double>(nr_rounds);
+
+  std::cout << "IMultAtAnx3 " << nr_points << " points, scalar: " << scalar_us
+            << " us (" << nr_points / scalar_us << " Mpts/s), simd: " << simd_us
+            << " us (" << nr_points / simd_us << " Mpts/s)" << std::endl;
+  EXPECT_GT(scalar_us, 0.0);
+  EXPECT_GT(simd_us, 0.0);
+}
+
+}  // namespace common
+}  // namespace perception
+}  // namespace apollo
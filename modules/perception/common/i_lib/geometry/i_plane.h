@@ -17,6 +17,7 @@
 
 #include "modules/perception/common/i_lib/algorithm/i_sort.h"
 #include "modules/perception/common/i_lib/core/i_alloc.h"
+#include "modules/perception/common/i_lib/core/i_blas_simd.h"
 #include "modules/perception/common/i_lib/core/i_struct.h"
 #include "modules/perception/common/i_lib/da/i_ransac.h"
 #include "modules/perception/common/i_lib/geometry/i_line.h"
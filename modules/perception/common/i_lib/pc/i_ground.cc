@@ -44,6 +44,7 @@ void PlaneFitGroundDetectorParam::SetDefault() {
   nr_ransac_iter_threshold = 32;
   candidate_filter_threshold = 1.0f;  // 1 meter
   nr_smooth_iter = 1;
+  nr_worker_threads = 4;
 }
 
 bool PlaneFitGroundDetectorParam::Validate() const {
@@ -250,6 +251,13 @@ bool PlaneFitGroundDetector::Init() {
   }
   memset(reinterpret_cast<void *>(sampled_indices_), 0,
          param_.nr_z_comp_candis * sizeof(int));
+  // worker pool for the parallel stages:
+  if (param_.nr_worker_threads > 1) {
+    task_candis_.resize(param_.nr_grids_coarse, 0);
+    thread_pool_ =
+        new lib::ThreadPool(static_cast<int>(param_.nr_worker_threads));
+    thread_pool_->Start();
+  }
   // ransac thresholds:
   pf_thresholds_ =
       IAlloc2<float>(param_.nr_grids_coarse, param_.nr_grids_coarse);
@@ -279,6 +287,10 @@ void PlaneFitGroundDetector::CleanUp() {
   IFreeAligned<int>(&sampled_indices_);
   IFree2<float>(&pf_thresholds_);
   IFree<std::pair<int, int> >(&order_table_);
+  if (thread_pool_ != nullptr) {
+    delete thread_pool_;  // joins the workers
+    thread_pool_ = nullptr;
+  }
 }
 
 int PlaneFitGroundDetector::CompareZ(const float *point_cloud,
@@ -392,6 +404,23 @@ void PlaneFitGroundDetector::ComputeSignedGroundHeight(
   for (r = 0; r < nr_points; ++r) {
     height_above_ground[r] = FLT_MAX;
   }
+  if (thread_pool_ != nullptr) {
+    //  each point belongs to exactly one coarse row, so the per-row tasks
+    //  write disjoint entries of height_above_ground and the result is
+    //  identical to the sequential pass
+    task_context_.point_cloud = point_cloud;
+    task_context_.height_above_ground = height_above_ground;
+    task_context_.nr_points = nr_points;
+    task_context_.nr_point_elements = nr_point_elements;
+    lib::BlockingCounter counter(param_.nr_grids_coarse);
+    for (r = 0; r < param_.nr_grids_coarse; ++r) {
+      thread_pool_->Add(google::protobuf::NewCallback(
+          this, &PlaneFitGroundDetector::ComputeSignedGroundHeightTask, r,
+          &counter));
+    }
+    counter.Wait();
+    return;
+  }
   ComputeSignedGroundHeightLine(
       point_cloud, ground_planes_[0], ground_planes_[0], ground_planes_[1],
       height_above_ground, 0, nr_points, nr_point_elements);
@@ -407,6 +436,18 @@ void PlaneFitGroundDetector::ComputeSignedGroundHeight(
                                 nr_point_elements);
 }
 
+void PlaneFitGroundDetector::ComputeSignedGroundHeightTask(
+    unsigned int r, lib::BlockingCounter *counter) {
+  unsigned int nm1 = param_.nr_grids_coarse - 1;
+  unsigned int up = r > 0 ? r - 1 : 0;
+  unsigned int dn = r < nm1 ? r + 1 : nm1;
+  ComputeSignedGroundHeightLine(
+      task_context_.point_cloud, ground_planes_[up], ground_planes_[r],
+      ground_planes_[dn], task_context_.height_above_ground, r,
+      task_context_.nr_points, task_context_.nr_point_elements);
+  counter->Decrement();
+}
+
 void PlaneFitGroundDetector::ComputeSignedGroundHeightLine(
     const float *point_cloud, const GroundPlaneLiDAR *up,
     const GroundPlaneLiDAR *cn, const GroundPlaneLiDAR *dn,
@@ -543,7 +584,9 @@ int PlaneFitGroundDetector::FilterGrid(const Voxel<float> &vx,
                                        const float *point_cloud,
                                        PlaneFitPointCandIndices *candi,
                                        unsigned int nr_points,
-                                       unsigned int nr_point_element) {
+                                       unsigned int nr_point_element,
+                                       float *sampled_z_values,
+                                       int *sampled_indices) {
   int pos = 0;
   int rseed = I_DEFAULT_SEED;
   int nr_candis = 0;
@@ -554,30 +597,31 @@ int PlaneFitGroundDetector::FilterGrid(const Voxel<float> &vx,
   }
   //  generate sampled indices
   if (vx.NrPoints() <= param_.nr_z_comp_candis) {
-    // IRamp(sampled_indices_, vx.NrPoints());
+    // IRamp(sampled_indices, vx.NrPoints());
     //  sampled z values
     for (i = 0; i < vx.NrPoints(); ++i) {
       pos = vx.indices_[i] * nr_point_element;
       //  requires the Z element to be in the third position, i.e., after X, Y
-      sampled_z_values_[i] = (point_cloud + pos)[2];
+      sampled_z_values[i] = (point_cloud + pos)[2];
     }
   } else {
-    IRandomSample(sampled_indices_, static_cast<int>(param_.nr_z_comp_candis),
+    IRandomSample(sampled_indices, static_cast<int>(param_.nr_z_comp_candis),
                   static_cast<int>(vx.NrPoints()), &rseed);
     //  sampled z values
     for (i = 0; i < nr_samples; ++i) {
-      pos = vx.indices_[sampled_indices_[i]] * nr_point_element;
+      pos = vx.indices_[sampled_indices[i]] * nr_point_element;
       // requires the Z element to be in the third position, i.e., after X, Y
-      sampled_z_values_[i] = (point_cloud + pos)[2];
+      sampled_z_values[i] = (point_cloud + pos)[2];
     }
   }
   // Filter points and get plane fitting candidates
-  nr_candis = CompareZ(point_cloud, vx.indices_, sampled_z_values_, candi,
+  nr_candis = CompareZ(point_cloud, vx.indices_, sampled_z_values, candi,
                        nr_points, nr_point_element, nr_samples);
   return nr_candis;
 }
 
-int PlaneFitGroundDetector::FilterLine(unsigned int r) {
+int PlaneFitGroundDetector::FilterLine(unsigned int r, float *sampled_z_values,
+                                       int *sampled_indices) {
   int nr_candis = 0;
   unsigned int c = 0;
   const float *point_cloud = vg_fine_->const_data();
@@ -589,11 +633,31 @@ int PlaneFitGroundDetector::FilterLine(unsigned int r) {
     parent = map_fine_to_coarse_[begin + c];
     nr_candis +=
         FilterGrid((*vg_fine_)(r, c), point_cloud, &local_candis_[0][parent],
-                   nr_points, nr_point_element);
+                   nr_points, nr_point_element, sampled_z_values,
+                   sampled_indices);
   }
   return nr_candis;
 }
 
+void PlaneFitGroundDetector::FilterRowTask(unsigned int coarse_r,
+                                           lib::BlockingCounter *counter) {
+  //  the fine rows of one coarse row only feed candidate lists of that
+  //  coarse row, so processing them in order within one task keeps every
+  //  candidate list identical to the sequential result
+  int nr_candis = 0;
+  unsigned int r = 0;
+  unsigned int sf = param_.nr_grids_fine / param_.nr_grids_coarse;
+  unsigned int begin = coarse_r * sf;
+  unsigned int end = begin + sf;
+  std::vector<float> sampled_z_values(param_.nr_z_comp_candis);
+  std::vector<int> sampled_indices(param_.nr_z_comp_candis);
+  for (r = begin; r < end; ++r) {
+    nr_candis += FilterLine(r, sampled_z_values.data(), sampled_indices.data());
+  }
+  task_candis_[coarse_r] = nr_candis;
+  counter->Decrement();
+}
+
 int PlaneFitGroundDetector::Filter() {
   int nr_candis = 0;
   unsigned int i = 0;
@@ -605,8 +669,20 @@ int PlaneFitGroundDetector::Filter() {
     local_candis_[0][i].Clear();
   }
   //  Filter plane fitting candidates
-  for (r = 0; r < param_.nr_grids_fine; ++r) {
-    nr_candis += FilterLine(r);
+  if (thread_pool_ != nullptr) {
+    lib::BlockingCounter counter(param_.nr_grids_coarse);
+    for (r = 0; r < param_.nr_grids_coarse; ++r) {
+      thread_pool_->Add(google::protobuf::NewCallback(
+          this, &PlaneFitGroundDetector::FilterRowTask, r, &counter));
+    }
+    counter.Wait();
+    for (r = 0; r < param_.nr_grids_coarse; ++r) {
+      nr_candis += task_candis_[r];
+    }
+  } else {
+    for (r = 0; r < param_.nr_grids_fine; ++r) {
+      nr_candis += FilterLine(r, sampled_z_values_, sampled_indices_);
+    }
   }
   return nr_candis;
 }
@@ -22,6 +22,8 @@
 #include "modules/perception/common/i_lib/core/i_rand.h"
 #include "modules/perception/common/i_lib/geometry/i_plane.h"
 #include "modules/perception/common/i_lib/pc/i_struct_s.h"
+#include "modules/perception/lib/thread/mutex.h"
+#include "modules/perception/lib/thread/thread_pool.h"
 
 namespace apollo {
 namespace perception {
@@ -189,6 +191,9 @@ struct PlaneFitGroundDetectorParam {
   float candidate_filter_threshold;
   int nr_ransac_iter_threshold;
   int nr_smooth_iter;
+  // number of worker threads for candidate filtering and ground height
+  // computation, 1 keeps the detector fully single-threaded
+  unsigned int nr_worker_threads;
 };
 
 struct PlaneFitPointCandIndices {
@@ -276,10 +281,15 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
   float CalculateAngleDist(const GroundPlaneLiDAR &plane,
                            const std::vector<std::pair<int, int> > &neighbors);
   int Filter();
-  int FilterLine(unsigned int r);
+  int FilterLine(unsigned int r, float *sampled_z_values,
+                 int *sampled_indices);
   int FilterGrid(const Voxel<float> &vg, const float *point_cloud,
                  PlaneFitPointCandIndices *candi, unsigned int nr_points,
-                 unsigned int nr_point_element);
+                 unsigned int nr_point_element, float *sampled_z_values,
+                 int *sampled_indices);
+  // one task covers the fine rows of one coarse row, so every candidate
+  // list receives its indices in the same order as the sequential code
+  void FilterRowTask(unsigned int coarse_r, lib::BlockingCounter *counter);
   int Smooth();
   int SmoothLine(unsigned int up, unsigned int r, unsigned int dn);
   int CompleteGrid(const GroundPlaneSpherical &lt,
@@ -305,6 +315,8 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
                                      float *height_above_ground, unsigned int r,
                                      unsigned int nr_points,
                                      unsigned int nr_point_elements);
+  void ComputeSignedGroundHeightTask(unsigned int r,
+                                     lib::BlockingCounter *counter);
 
  protected:
   VoxelGridXY<float> *vg_fine_;
@@ -320,6 +332,19 @@ class PlaneFitGroundDetector : public BaseGroundDetector {
   float *pf_threeds_;
   int *sampled_indices_;
   std::pair<int, int> *order_table_;
+  // worker pool shared by the parallel stages, null when
+  // nr_worker_threads <= 1
+  lib::ThreadPool *thread_pool_ = nullptr;
+  // per-frame context of the parallel stages, set by the dispatching
+  // thread before the tasks are queued
+  struct {
+    const float *point_cloud = nullptr;
+    float *height_above_ground = nullptr;
+    unsigned int nr_points = 0;
+    unsigned int nr_point_elements = 0;
+  } task_context_;
+  // per-coarse-row candidate counts collected by the filter tasks
+  std::vector<int> task_candis_;
 };
 
 }  // namespace common
@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/common/io/resource_loader.h"
+
+#include <algorithm>
+
+#include "cyber/common/log.h"
+#include "modules/perception/common/io/io_util.h"
+#include "modules/perception/lib/thread/thread_pool.h"
+#include "modules/perception/lib/utils/timer.h"
+
+namespace apollo {
+namespace perception {
+namespace common {
+
+ResourceLoader::ResourceLoader() {}
+
+bool ResourceLoader::LoadAll(std::vector<LoadTask>* tasks) {
+  if (tasks == nullptr) {
+    return false;
+  }
+  if (tasks->empty()) {
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(load_mutex_);
+  load_tasks_ = tasks;
+  load_results_.assign(tasks->size(), false);
+  const int num_workers =
+      std::min(kNumLoadWorkers, static_cast<int>(tasks->size()));
+  lib::ThreadPool thread_pool(num_workers);
+  thread_pool.Start();
+  lib::BlockingCounter counter(tasks->size());
+  for (size_t i = 0; i < tasks->size(); ++i) {
+    thread_pool.Add(google::protobuf::NewCallback(
+        this, &ResourceLoader::RunLoadTask, static_cast<int>(i), &counter));
+  }
+  counter.Wait();
+  load_tasks_ = nullptr;
+  bool success = true;
+  for (size_t i = 0; i < load_results_.size(); ++i) {
+    if (!load_results_[i]) {
+      AERROR << "Failed to load resource: " << tasks->at(i).name;
+      success = false;
+    }
+  }
+  return success;
+}
+
+void ResourceLoader::RunLoadTask(int index, lib::BlockingCounter* counter) {
+  LoadTask& task = load_tasks_->at(index);
+  lib::Timer timer;
+  timer.Start();
+  load_results_[index] = task.loader();
+  timer.End("Init load " + task.name);
+  counter->Decrement();
+}
+
+bool ResourceLoader::LoadBrownCameraIntrinsic(
+    const std::string& yaml_file,
+    std::shared_ptr<base::BrownCameraDistortionModel>* model) {
+  if (model == nullptr) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(intrinsic_mutex_);
+    auto iter = intrinsic_map_.find(yaml_file);
+    if (iter != intrinsic_map_.end()) {
+      *model = iter->second;
+      return true;
+    }
+  }
+  auto fresh_model = std::make_shared<base::BrownCameraDistortionModel>();
+  if (!::apollo::perception::common::LoadBrownCameraIntrinsic(
+          yaml_file, fresh_model.get())) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(intrinsic_mutex_);
+  // keep the first parsed copy if two components raced on the same file
+  auto iter = intrinsic_map_.emplace(yaml_file, fresh_model).first;
+  *model = iter->second;
+  return true;
+}
+
+size_t ResourceLoader::CachedIntrinsicSize() {
+  std::lock_guard<std::mutex> lock(intrinsic_mutex_);
+  return intrinsic_map_.size();
+}
+
+}  // namespace common
+}  // namespace perception
+}  // namespace apollo
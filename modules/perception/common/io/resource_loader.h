@@ -0,0 +1,89 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cyber/common/macros.h"
+#include "modules/perception/base/distortion_model.h"
+#include "modules/perception/lib/thread/mutex.h"
+
+namespace apollo {
+namespace perception {
+namespace lib {
+class BlockingCounter;
+}  // namespace lib
+namespace common {
+
+// @brief a named unit of init-time loading work, independent of the
+//        other tasks submitted in the same batch
+struct LoadTask {
+  std::string name;
+  std::function<bool()> loader;
+};
+
+/**
+ * @brief Init-time resource loader for the perception process.
+ *
+ * Component Init paths read calibration files, model weights and config
+ * protos one after another, so startup latency is the sum of every file
+ * read and parse. LoadAll runs a batch of independent load tasks on a
+ * transient thread pool and logs each task's wall time, so the init
+ * report shows which resource dominates. The intrinsic loaders cache
+ * the parsed, read-only model per file path, deduplicating calibration
+ * objects across components living in the same process.
+ */
+class ResourceLoader {
+ public:
+  // @brief: run the tasks concurrently and wait for all of them; each
+  //         task's wall time is logged; returns false if any task fails
+  bool LoadAll(std::vector<LoadTask>* tasks);
+
+  // @brief: load a camera intrinsic file once per process; subsequent
+  //         requests for the same path share the parsed model
+  bool LoadBrownCameraIntrinsic(
+      const std::string& yaml_file,
+      std::shared_ptr<base::BrownCameraDistortionModel>* model);
+
+  size_t CachedIntrinsicSize();
+
+ private:
+  void RunLoadTask(int index, lib::BlockingCounter* counter);
+
+  // enough to overlap file reads with proto/yaml parsing without
+  // oversubscribing the startup cores
+  static const int kNumLoadWorkers = 4;
+
+  // serializes LoadAll batches, tasks inside one batch run concurrently
+  std::mutex load_mutex_;
+  std::vector<LoadTask>* load_tasks_ = nullptr;
+  std::vector<bool> load_results_;
+
+  std::mutex intrinsic_mutex_;
+  std::map<std::string, std::shared_ptr<base::BrownCameraDistortionModel>>
+      intrinsic_map_;
+
+  DECLARE_SINGLETON(ResourceLoader)
+};  // class ResourceLoader
+
+}  // namespace common
+}  // namespace perception
+}  // namespace apollo
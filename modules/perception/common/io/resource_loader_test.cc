@@ -0,0 +1,77 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/common/io/resource_loader.h"
+
+#include <atomic>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace common {
+
+TEST(ResourceLoaderTest, load_all) {
+  auto* loader = ResourceLoader::Instance();
+  EXPECT_FALSE(loader->LoadAll(nullptr));
+
+  std::vector<LoadTask> empty_tasks;
+  EXPECT_TRUE(loader->LoadAll(&empty_tasks));
+
+  std::atomic<int> loaded(0);
+  std::vector<LoadTask> tasks(8);
+  for (size_t i = 0; i < tasks.size(); ++i) {
+    tasks[i].name = "task";
+    tasks[i].loader = [&loaded]() {
+      ++loaded;
+      return true;
+    };
+  }
+  EXPECT_TRUE(loader->LoadAll(&tasks));
+  EXPECT_EQ(loaded.load(), 8);
+
+  tasks[3].loader = []() { return false; };
+  EXPECT_FALSE(loader->LoadAll(&tasks));
+}
+
+TEST(ResourceLoaderTest, dedup_camera_intrinsic) {
+  const std::string testdata_folder =
+      "/apollo/modules/perception/testdata/common/io/params/";
+  auto* loader = ResourceLoader::Instance();
+
+  std::shared_ptr<base::BrownCameraDistortionModel> model;
+  EXPECT_FALSE(loader->LoadBrownCameraIntrinsic(testdata_folder + "test.yaml",
+                                                nullptr));
+  EXPECT_FALSE(
+      loader->LoadBrownCameraIntrinsic(testdata_folder + "empty.yaml", &model));
+
+  EXPECT_TRUE(
+      loader->LoadBrownCameraIntrinsic(testdata_folder + "test.yaml", &model));
+  ASSERT_NE(model, nullptr);
+  EXPECT_EQ(model->width_, 1192);
+  EXPECT_EQ(model->height_, 712);
+
+  // the second request for the same file shares the parsed model
+  std::shared_ptr<base::BrownCameraDistortionModel> second;
+  size_t cached = loader->CachedIntrinsicSize();
+  EXPECT_TRUE(
+      loader->LoadBrownCameraIntrinsic(testdata_folder + "test.yaml", &second));
+  EXPECT_EQ(second, model);
+  EXPECT_EQ(loader->CachedIntrinsicSize(), cached);
+}
+
+}  // namespace common
+}  // namespace perception
+}  // namespace apollo
@@ -16,10 +16,12 @@
 #include "modules/perception/common/sensor_manager/sensor_manager.h"
 
 #include <utility>
+#include <vector>
 
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 #include "modules/perception/common/io/io_util.h"
+#include "modules/perception/common/io/resource_loader.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
 #include "modules/perception/proto/sensor_meta_schema.pb.h"
 
@@ -54,7 +56,8 @@ bool SensorManager::Init() {
     return false;
   }
 
-  auto AddSensorInfo = [this](const SensorMeta& sensor_meta_proto) {
+  std::vector<std::string> camera_names;
+  auto AddSensorInfo = [&](const SensorMeta& sensor_meta_proto) {
     SensorInfo sensor_info;
     sensor_info.name = sensor_meta_proto.name();
     sensor_info.type = static_cast<SensorType>(sensor_meta_proto.type());
@@ -70,18 +73,7 @@ bool SensorManager::Init() {
     }
 
     if (this->IsCamera(sensor_info.type)) {
-      std::shared_ptr<BrownCameraDistortionModel> distort_model(
-          new BrownCameraDistortionModel());
-      auto intrinsic_file = IntrinsicPath(sensor_info.frame_id);
-      if (!LoadBrownCameraIntrinsic(intrinsic_file, distort_model.get())) {
-        AERROR << "Failed to load camera intrinsic:" << intrinsic_file;
-        return false;
-      }
-      distort_model_map_.insert(make_pair(
-          sensor_meta_proto.name(),
-          std::dynamic_pointer_cast<BaseCameraDistortionModel>(distort_model)));
-      undistort_model_map_.insert(make_pair(sensor_meta_proto.name(),
-                                            distort_model->get_camera_model()));
+      camera_names.push_back(sensor_info.name);
     }
     return true;
   };
@@ -93,6 +85,31 @@ bool SensorManager::Init() {
     }
   }
 
+  // intrinsic files are independent of each other, so they are parsed
+  // concurrently and deduplicated through the process-wide loader cache
+  std::vector<std::shared_ptr<BrownCameraDistortionModel>> distort_models(
+      camera_names.size());
+  std::vector<LoadTask> load_tasks(camera_names.size());
+  for (size_t i = 0; i < camera_names.size(); ++i) {
+    const std::string intrinsic_file = IntrinsicPath(camera_names[i]);
+    load_tasks[i].name = "camera intrinsic " + intrinsic_file;
+    load_tasks[i].loader = [i, intrinsic_file, &distort_models]() {
+      return ResourceLoader::Instance()->LoadBrownCameraIntrinsic(
+          intrinsic_file, &distort_models[i]);
+    };
+  }
+  if (!ResourceLoader::Instance()->LoadAll(&load_tasks)) {
+    AERROR << "Failed to load camera intrinsics.";
+    return false;
+  }
+  for (size_t i = 0; i < camera_names.size(); ++i) {
+    distort_model_map_.insert(make_pair(
+        camera_names[i], std::dynamic_pointer_cast<BaseCameraDistortionModel>(
+                             distort_models[i])));
+    undistort_model_map_.insert(
+        make_pair(camera_names[i], distort_models[i]->get_camera_model()));
+  }
+
   inited_ = true;
   AINFO << "Init sensor_manager success.";
   return true;
@@ -16,9 +16,11 @@
 #include "modules/perception/fusion/lib/data_association/hm_data_association/hm_tracks_objects_match.h"
 
 #include <map>
+#include <numeric>
 #include <utility>
 
 #include "modules/perception/common/graph/secure_matrix.h"
+#include "modules/perception/fusion/base/sensor_object.h"
 
 namespace apollo {
 namespace perception {
@@ -49,7 +51,7 @@ bool HMTrackersObjectsAssociation::Associate(
   const std::vector<SensorObjectPtr>& sensor_objects =
       sensor_measurements->GetForegroundObjects();
   const std::vector<TrackPtr>& fusion_tracks = scene->GetForegroundTracks();
-  std::vector<std::vector<double>> association_mat;
+  std::vector<std::vector<double>>& association_mat = association_mat_;
 
   if (fusion_tracks.empty() || sensor_objects.empty()) {
     association_result->unassigned_tracks.resize(fusion_tracks.size());
@@ -299,39 +301,95 @@ void HMTrackersObjectsAssociation::ComputeAssociationDistanceMat(
     const std::vector<size_t>& unassigned_measurements,
     std::vector<std::vector<double>>* association_mat) {
   // if (sensor_objects.empty()) return;
-  TrackObjectDistanceOptions opt;
-  // TODO(linjian) ref_point
-  Eigen::Vector3d tmp = Eigen::Vector3d::Zero();
-  opt.ref_point = &tmp;
+  // rows are allocated up front so worker threads only write into their
+  // own row
+  static const size_t kMinPairsToParallelize = 256;
   association_mat->resize(unassigned_tracks.size());
   for (size_t i = 0; i < unassigned_tracks.size(); ++i) {
-    int fusion_idx = static_cast<int>(unassigned_tracks[i]);
     (*association_mat)[i].resize(unassigned_measurements.size());
-    const TrackPtr& fusion_track = fusion_tracks[fusion_idx];
-    for (size_t j = 0; j < unassigned_measurements.size(); ++j) {
-      int sensor_idx = static_cast<int>(unassigned_measurements[j]);
-      const SensorObjectPtr& sensor_object = sensor_objects[sensor_idx];
-      double distance = s_match_distance_thresh_;
-      double center_dist =
-          (sensor_object->GetBaseObject()->center -
-           fusion_track->GetFusedObject()->GetBaseObject()->center)
-              .norm();
-      if (center_dist < s_association_center_dist_threshold_) {
-        distance =
-            track_object_distance_.Compute(fusion_track, sensor_object, opt);
-      } else {
-        ADEBUG << "center_distance " << center_dist
-               << " exceeds slack threshold "
-               << s_association_center_dist_threshold_
-               << ", track_id: " << fusion_track->GetTrackId()
-               << ", obs_id: " << sensor_object->GetBaseObject()->track_id;
+  }
+  task_context_.fusion_tracks = &fusion_tracks;
+  task_context_.sensor_objects = &sensor_objects;
+  task_context_.unassigned_tracks = &unassigned_tracks;
+  task_context_.unassigned_measurements = &unassigned_measurements;
+  task_context_.association_mat = association_mat;
+
+  bool parallel =
+      thread_pool_ != nullptr &&
+      unassigned_tracks.size() * unassigned_measurements.size() >=
+          kMinPairsToParallelize;
+  // camera pairs append to the shared projection cache, so any camera
+  // involvement keeps the fill serial
+  if (parallel && !unassigned_measurements.empty() &&
+      IsCamera(sensor_objects[unassigned_measurements[0]])) {
+    parallel = false;
+  }
+  if (parallel) {
+    for (auto track_idx : unassigned_tracks) {
+      if (!fusion_tracks[track_idx]->GetCameraObjects().empty()) {
+        parallel = false;
+        break;
       }
-      (*association_mat)[i][j] = distance;
-      ADEBUG << "track_id: " << fusion_track->GetTrackId()
-             << ", obs_id: " << sensor_object->GetBaseObject()->track_id
-             << ", distance: " << distance;
     }
   }
+  if (parallel) {
+    lib::BlockingCounter counter(unassigned_tracks.size());
+    for (size_t i = 0; i < unassigned_tracks.size(); ++i) {
+      thread_pool_->Add(google::protobuf::NewCallback(
+          this, &HMTrackersObjectsAssociation::ComputeAssociationRowTask, i,
+          &counter));
+    }
+    counter.Wait();
+  } else {
+    for (size_t i = 0; i < unassigned_tracks.size(); ++i) {
+      ComputeAssociationRow(i);
+    }
+  }
+}
+
+void HMTrackersObjectsAssociation::ComputeAssociationRow(size_t row) {
+  TrackObjectDistanceOptions opt;
+  // TODO(linjian) ref_point
+  Eigen::Vector3d tmp = Eigen::Vector3d::Zero();
+  opt.ref_point = &tmp;
+  const std::vector<TrackPtr>& fusion_tracks = *task_context_.fusion_tracks;
+  const std::vector<SensorObjectPtr>& sensor_objects =
+      *task_context_.sensor_objects;
+  const std::vector<size_t>& unassigned_tracks =
+      *task_context_.unassigned_tracks;
+  const std::vector<size_t>& unassigned_measurements =
+      *task_context_.unassigned_measurements;
+  int fusion_idx = static_cast<int>(unassigned_tracks[row]);
+  const TrackPtr& fusion_track = fusion_tracks[fusion_idx];
+  std::vector<double>& mat_row = (*task_context_.association_mat)[row];
+  for (size_t j = 0; j < unassigned_measurements.size(); ++j) {
+    int sensor_idx = static_cast<int>(unassigned_measurements[j]);
+    const SensorObjectPtr& sensor_object = sensor_objects[sensor_idx];
+    double distance = s_match_distance_thresh_;
+    double center_dist =
+        (sensor_object->GetBaseObject()->center -
+         fusion_track->GetFusedObject()->GetBaseObject()->center)
+            .norm();
+    if (center_dist < s_association_center_dist_threshold_) {
+      distance =
+          track_object_distance_.Compute(fusion_track, sensor_object, opt);
+    } else {
+      ADEBUG << "center_distance " << center_dist << " exceeds slack threshold "
+             << s_association_center_dist_threshold_
+             << ", track_id: " << fusion_track->GetTrackId()
+             << ", obs_id: " << sensor_object->GetBaseObject()->track_id;
+    }
+    mat_row[j] = distance;
+    ADEBUG << "track_id: " << fusion_track->GetTrackId()
+           << ", obs_id: " << sensor_object->GetBaseObject()->track_id
+           << ", distance: " << distance;
+  }
+}
+
+void HMTrackersObjectsAssociation::ComputeAssociationRowTask(
+    size_t row, lib::BlockingCounter* counter) {
+  ComputeAssociationRow(row);
+  counter->Decrement();
 }
 
 void HMTrackersObjectsAssociation::IdAssign(
@@ -15,12 +15,15 @@
  *****************************************************************************/
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "modules/perception/common/graph/gated_hungarian_bigraph_matcher.h"
 #include "modules/perception/fusion/lib/data_association/hm_data_association/track_object_distance.h"
 #include "modules/perception/fusion/lib/interface/base_data_association.h"
+#include "modules/perception/lib/thread/mutex.h"
+#include "modules/perception/lib/thread/thread_pool.h"
 
 namespace apollo {
 namespace perception {
@@ -37,6 +40,10 @@ class HMTrackersObjectsAssociation : public BaseDataAssociation {
   bool Init() override {
     track_object_distance_.set_distance_thresh(
         static_cast<float>(s_match_distance_thresh_));
+    if (thread_pool_ == nullptr) {
+      thread_pool_.reset(new lib::ThreadPool(kNrWorkerThreads));
+      thread_pool_->Start();
+    }
     return true;
   }
 
@@ -91,9 +98,32 @@ class HMTrackersObjectsAssociation : public BaseDataAssociation {
       std::vector<size_t>* unassigned_tracks,
       std::vector<size_t>* unassigned_objects);
 
+  // @brief: fill one row of the association matrix, reading the inputs
+  //         from task_context_; rows are independent so the parallel
+  //         fill is identical to the serial one
+  void ComputeAssociationRow(size_t row);
+
+  void ComputeAssociationRowTask(size_t row, lib::BlockingCounter* counter);
+
  private:
+  static const int kNrWorkerThreads = 4;
+
   common::GatedHungarianMatcher<float> optimizer_;
   TrackObjectDistance track_object_distance_;
+  // the distance computations of lidar and radar pairs are stateless, so
+  // rows can be filled concurrently; camera pairs mutate the shared
+  // projection cache and keep the serial path
+  std::unique_ptr<lib::ThreadPool> thread_pool_;
+  struct {
+    const std::vector<TrackPtr>* fusion_tracks = nullptr;
+    const std::vector<SensorObjectPtr>* sensor_objects = nullptr;
+    const std::vector<size_t>* unassigned_tracks = nullptr;
+    const std::vector<size_t>* unassigned_measurements = nullptr;
+    std::vector<std::vector<double>>* association_mat = nullptr;
+  } task_context_;
+  // scratch reused across frames so steady-state association does not
+  // reallocate the matrix rows
+  std::vector<std::vector<double>> association_mat_;
   static double s_match_distance_thresh_;
   static double s_match_distance_bound_;
   static double s_association_center_dist_threshold_;
@@ -38,6 +38,8 @@ namespace fusion {
 
 using cyber::common::GetAbsolutePath;
 
+constexpr size_t ProbabilisticFusion::kMaxPendingFramesPerSensor;
+
 ProbabilisticFusion::ProbabilisticFusion() {}
 
 ProbabilisticFusion::~ProbabilisticFusion() {}
@@ -114,53 +116,101 @@ bool ProbabilisticFusion::Fuse(const FusionOptions& options,
   }
 
   auto* sensor_data_manager = SensorDataManager::Instance();
-  // 1. save frame data
-  {
-    std::lock_guard<std::mutex> data_lock(data_mutex_);
-    if (!params_.use_lidar && sensor_data_manager->IsLidar(sensor_frame)) {
-      return true;
-    }
-    if (!params_.use_radar && sensor_data_manager->IsRadar(sensor_frame)) {
-      return true;
-    }
-    if (!params_.use_camera && sensor_data_manager->IsCamera(sensor_frame)) {
-      return true;
-    }
-
-    bool is_publish_sensor = this->IsPublishSensor(sensor_frame);
-    if (is_publish_sensor) {
-      started_ = true;
-    }
-
-    if (started_) {
-      AINFO << "add sensor measurement: " << sensor_frame->sensor_info.name
-            << ", obj_cnt : " << sensor_frame->objects.size() << ", "
-            << GLOG_TIMESTAMP(sensor_frame->timestamp);
-      sensor_data_manager->AddSensorMeasurements(sensor_frame);
-    }
+  if (!params_.use_lidar && sensor_data_manager->IsLidar(sensor_frame)) {
+    return true;
+  }
+  if (!params_.use_radar && sensor_data_manager->IsRadar(sensor_frame)) {
+    return true;
+  }
+  if (!params_.use_camera && sensor_data_manager->IsCamera(sensor_frame)) {
+    return true;
+  }
 
-    if (!is_publish_sensor) {
+  // 1. admit frame data; secondary sensors enqueue lock-free and return,
+  // only the main sensor triggers fusion
+  if (!this->IsPublishSensor(sensor_frame)) {
+    // bounded-staleness admission: frames behind the fused timeline can
+    // not contribute to fusion any more
+    if (sensor_frame->timestamp <
+        fused_timeline_.load(std::memory_order_acquire)) {
+      AINFO << "drop stale measurement: " << sensor_frame->sensor_info.name
+            << ", " << GLOG_TIMESTAMP(sensor_frame->timestamp);
       return true;
     }
+    const auto queue = this->GetPendingQueue(sensor_frame->sensor_info.name);
+    base::FrameConstPtr oldest = nullptr;
+    while (!queue->Enqueue(sensor_frame)) {
+      // full queue: the oldest pending frame gives way to the newest
+      queue->Dequeue(&oldest);
+    }
+    return true;
   }
 
-  // 2. query related sensor_frames for fusion
   std::lock_guard<std::mutex> fuse_lock(fuse_mutex_);
   double fusion_time = sensor_frame->timestamp;
+  // 2. save frame data: drain the secondary queues wait-free,
+  // then add the main sensor frame
+  this->DrainPendingFrames(sensor_data_manager);
+  AINFO << "add sensor measurement: " << sensor_frame->sensor_info.name
+        << ", obj_cnt : " << sensor_frame->objects.size() << ", "
+        << GLOG_TIMESTAMP(sensor_frame->timestamp);
+  sensor_data_manager->AddSensorMeasurements(sensor_frame);
+  fused_timeline_.store(fusion_time, std::memory_order_release);
+
+  // 3. query related sensor_frames for fusion
   std::vector<SensorFramePtr> frames;
   sensor_data_manager->GetLatestFrames(fusion_time, &frames);
   AINFO << "Get " << frames.size() << " related frames for fusion";
 
-  // 3. perform fusion on related frames
+  // 4. perform fusion on related frames
   for (const auto& frame : frames) {
     FuseFrame(frame);
   }
 
-  // 4. collect fused objects
+  // 5. collect fused objects
   CollectFusedObjects(fusion_time, fused_objects);
   return true;
 }
 
+std::shared_ptr<cyber::base::BoundedQueue<base::FrameConstPtr>>
+ProbabilisticFusion::GetPendingQueue(const std::string& sensor_id) {
+  std::lock_guard<std::mutex> map_lock(queue_map_mutex_);
+  auto& queue = pending_frames_[sensor_id];
+  if (queue == nullptr) {
+    queue.reset(new cyber::base::BoundedQueue<base::FrameConstPtr>());
+    queue->Init(kMaxPendingFramesPerSensor);
+  }
+  return queue;
+}
+
+void ProbabilisticFusion::DrainPendingFrames(
+    SensorDataManager* sensor_data_manager) {
+  std::vector<std::shared_ptr<cyber::base::BoundedQueue<base::FrameConstPtr>>>
+      queues;
+  {
+    std::lock_guard<std::mutex> map_lock(queue_map_mutex_);
+    queues.reserve(pending_frames_.size());
+    for (const auto& pair : pending_frames_) {
+      queues.push_back(pair.second);
+    }
+  }
+  const double fused_timeline =
+      fused_timeline_.load(std::memory_order_acquire);
+  base::FrameConstPtr frame = nullptr;
+  for (const auto& queue : queues) {
+    while (queue->Dequeue(&frame)) {
+      if (frame->timestamp < fused_timeline) {
+        // the frame went stale while pending
+        continue;
+      }
+      AINFO << "add sensor measurement: " << frame->sensor_info.name
+            << ", obj_cnt : " << frame->objects.size() << ", "
+            << GLOG_TIMESTAMP(frame->timestamp);
+      sensor_data_manager->AddSensorMeasurements(frame);
+    }
+  }
+}
+
 std::string ProbabilisticFusion::Name() const { return "ProbabilisticFusion"; }
 
 bool ProbabilisticFusion::IsPublishSensor(
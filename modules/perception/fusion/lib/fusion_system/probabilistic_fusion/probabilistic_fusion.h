@@ -15,10 +15,14 @@
  *****************************************************************************/
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "cyber/base/bounded_queue.h"
 #include "modules/perception/fusion/base/sensor_data_manager.h"
 #include "modules/perception/fusion/lib/interface/base_data_association.h"
 #include "modules/perception/fusion/lib/interface/base_fusion_system.h"
@@ -85,11 +89,27 @@ class ProbabilisticFusion : public BaseFusionSystem {
       const SensorObjectConstPtr& object,
       base::SensorObjectMeasurement* measurement);
 
+  // @brief: get or create the lock-free admission queue of one sensor
+  std::shared_ptr<cyber::base::BoundedQueue<base::FrameConstPtr>>
+  GetPendingQueue(const std::string& sensor_id);
+
+  // @brief: move all pending secondary frames into the sensor data manager
+  void DrainPendingFrames(SensorDataManager* sensor_data_manager);
+
  private:
-  std::mutex data_mutex_;
   std::mutex fuse_mutex_;
 
-  bool started_ = false;
+  // per-sensor single-producer queues; each sensor callback enqueues
+  // lock-free and the main-sensor arrival drains them wait-free
+  std::mutex queue_map_mutex_;
+  std::unordered_map<std::string,
+                     std::shared_ptr<cyber::base::BoundedQueue<
+                         base::FrameConstPtr>>> pending_frames_;
+  // timestamp of the latest fused main-sensor frame; secondary frames
+  // behind this timeline are dropped at admission
+  std::atomic<double> fused_timeline_{0.0};
+
+  static constexpr size_t kMaxPendingFramesPerSensor = 16;
 
   ScenePtr scenes_ = nullptr;
   std::vector<std::shared_ptr<BaseTracker>> trackers_;  // for foreground
@@ -20,6 +20,8 @@ namespace apollo {
 namespace perception {
 namespace inference {
 
+void Inference::Infer(cudaStream_t stream) { Infer(); }
+
 void Inference::set_max_batch_size(const int &batch_size) {
   max_batch_size_ = batch_size;
 }
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cuda_runtime_api.h>
+
 #include <boost/shared_ptr.hpp>
 #include <map>
 #include <memory>
@@ -35,6 +37,13 @@ typedef std::map<std::string,
 class Inference {
  public:
   virtual void Infer() = 0;
+
+  // enqueue the forward pass on the caller's stream without synchronizing,
+  // so models sharing one GPU can overlap; the caller owns the ordering of
+  // input uploads and output consumption on that stream. Backends without
+  // stream support fall back to the blocking Infer().
+  virtual void Infer(cudaStream_t stream);
+
   Inference() = default;
 
   virtual ~Inference() = default;
@@ -33,9 +33,14 @@ Inference *CreateInferenceByName(const std::string &name,
   if (name == "CaffeNet") {
     return new CaffeNet(proto_file, weight_file, outputs, inputs);
   } else if (name == "RTNet") {
-    return new RTNet(proto_file, weight_file, outputs, inputs);
+    RTNet *net = new RTNet(proto_file, weight_file, outputs, inputs);
+    net->set_engine_cache_root(model_root);
+    return net;
   } else if (name == "RTNetInt8") {
-    return new RTNet(proto_file, weight_file, outputs, inputs, model_root);
+    RTNet *net = new RTNet(proto_file, weight_file, outputs, inputs,
+                           model_root);
+    net->set_engine_cache_root(model_root);
+    return net;
   } else if (name == "PaddleNet") {
     return new PaddleNet(proto_file, weight_file, outputs, inputs);
   }
@@ -17,9 +17,13 @@
 #include "modules/perception/inference/tensorrt/rt_net.h"
 
 #include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <utility>
 
 #include "absl/strings/str_cat.h"
+#include "cyber/common/file.h"
 #include "cyber/common/log.h"
 #include "modules/perception/inference/tensorrt/plugins/argmax_plugin.h"
 #include "modules/perception/inference/tensorrt/plugins/leakyReLU_plugin.h"
@@ -550,6 +554,8 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
+  net_file_ = net_file;
+  model_file_ = model_file;
 }
 RTNet::RTNet(const std::string &net_file, const std::string &model_file,
              const std::vector<std::string> &outputs,
@@ -559,6 +565,8 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
+  net_file_ = net_file;
+  model_file_ = model_file;
   calibrator_ = calibrator;
   is_own_calibrator_ = false;
 }
@@ -570,6 +578,8 @@ RTNet::RTNet(const std::string &net_file, const std::string &model_file,
   loadWeights(model_file, &weight_map_);
   net_param_.reset(new NetParameter);
   loadNetParams(net_file, net_param_.get());
+  net_file_ = net_file;
+  model_file_ = model_file;
   model_root_ = model_root;
   BatchStream stream;
 
@@ -644,8 +654,26 @@ bool RTNet::Init(const std::map<std::string, std::vector<int>> &shapes) {
 
   builder_->setDebugSync(true);
 
-  nvinfer1::ICudaEngine *engine = builder_->buildCudaEngine(*network_);
-  context_ = engine->createExecutionContext();
+  // the custom plugins do not serialize their parameters, so engines
+  // containing them cannot be restored from disk
+  bool cacheable = !engine_cache_root_.empty() && argmax_plugins_.empty() &&
+                   softmax_plugins_.empty() && slice_plugins_.empty() &&
+                   relu_plugins_.empty();
+  std::string cache_file;
+  if (cacheable) {
+    std::string key = engineCacheKey(prop.name, int8_mode);
+    if (!key.empty()) {
+      cache_file = absl::StrCat(engine_cache_root_, "/", key, ".engine");
+      loadEngineFromCache(cache_file);
+    }
+  }
+  if (engine_ == nullptr) {
+    engine_ = builder_->buildCudaEngine(*network_);
+    if (!cache_file.empty()) {
+      saveEngineToCache(cache_file);
+    }
+  }
+  context_ = engine_->createExecutionContext();
   buffers_.resize(input_names_.size() + output_names_.size());
   init_blob(&input_names_);
   init_blob(&output_names_);
@@ -667,6 +695,68 @@ bool RTNet::checkInt8(const std::string &gpu_name,
   calibrator_ = nullptr;
   return false;
 }
+
+std::string RTNet::engineCacheKey(const std::string &gpu_name,
+                                  bool int8_mode) {
+  // FNV-1a over the network definition, the weights and the build
+  // parameters; any of them changing must miss the cache
+  uint64_t digest = 14695981039346656037ULL;
+  auto update = [&digest](const std::string &data) {
+    for (unsigned char c : data) {
+      digest ^= c;
+      digest *= 1099511628211ULL;
+    }
+  };
+  std::string content;
+  if (!cyber::common::GetContent(net_file_, &content)) {
+    return "";
+  }
+  update(content);
+  if (!cyber::common::GetContent(model_file_, &content)) {
+    return "";
+  }
+  update(content);
+  update(gpu_name);
+  update(int8_mode ? "int8" : "fp32");
+  update(std::to_string(max_batch_size_));
+  std::ostringstream key;
+  key << std::hex << std::setw(16) << std::setfill('0') << digest;
+  return key.str();
+}
+
+bool RTNet::loadEngineFromCache(const std::string &file) {
+  std::string data;
+  if (!cyber::common::GetContent(file, &data) || data.empty()) {
+    return false;
+  }
+  runtime_ = nvinfer1::createInferRuntime(rt_gLogger);
+  engine_ = runtime_->deserializeCudaEngine(data.data(), data.size(), nullptr);
+  if (engine_ == nullptr) {
+    AWARN << "Failed to deserialize engine cache: " << file;
+    runtime_->destroy();
+    runtime_ = nullptr;
+    return false;
+  }
+  AINFO << "Loaded engine cache: " << file;
+  return true;
+}
+
+void RTNet::saveEngineToCache(const std::string &file) {
+  nvinfer1::IHostMemory *serialized = engine_->serialize();
+  if (serialized == nullptr) {
+    AWARN << "Failed to serialize engine for: " << file;
+    return;
+  }
+  std::ofstream output(file, std::ios::binary);
+  if (!output) {
+    AWARN << "Failed to write engine cache: " << file;
+  } else {
+    output.write(static_cast<const char *>(serialized->data()),
+                 serialized->size());
+    AINFO << "Saved engine cache: " << file;
+  }
+  serialized->destroy();
+}
 bool RTNet::addInput(const TensorDimsMap &tensor_dims_map,
                      const std::map<std::string, std::vector<int>> &shapes,
                      TensorMap *tensor_map) {
@@ -734,6 +824,10 @@ RTNet::~RTNet() {
     network_->destroy();
     builder_->destroy();
     context_->destroy();
+    engine_->destroy();
+    if (runtime_ != nullptr) {
+      runtime_->destroy();
+    }
     for (auto buf : buffers_) {
       cudaFree(buf);
     }
@@ -741,8 +835,13 @@ RTNet::~RTNet() {
 }
 
 void RTNet::Infer() {
-  BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
   BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
+  Infer(stream_);
+  BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
+}
+
+void RTNet::Infer(cudaStream_t stream) {
+  BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
   for (auto name : input_names_) {
     auto blob = get_blob(name);
     if (blob != nullptr) {
@@ -761,8 +860,7 @@ void RTNet::Infer() {
       blob->gpu_data();
     }
   }
-  context_->enqueue(max_batch_size_, &buffers_[0], stream_, nullptr);
-  BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
+  context_->enqueue(max_batch_size_, &buffers_[0], stream, nullptr);
 
   for (auto name : output_names_) {
     auto blob = get_blob(name);
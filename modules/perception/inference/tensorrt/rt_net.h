@@ -72,9 +72,21 @@ class RTNet : public Inference {
 
   void Infer() override;
 
+  // asynchronous forward pass on the caller's stream; nothing is enqueued
+  // on the internal stream and no synchronization is performed, so several
+  // engines can run concurrently on one GPU
+  void Infer(cudaStream_t stream) override;
+
   std::shared_ptr<apollo::perception::base::Blob<float>> get_blob(
       const std::string &name) override;
 
+  // directory holding serialized engines keyed by model content, device
+  // and precision; an empty root disables the cache and the engine is
+  // rebuilt from the network definition at every start
+  void set_engine_cache_root(const std::string &root) {
+    engine_cache_root_ = root;
+  }
+
  protected:
   bool addInput(const TensorDimsMap &tensor_dims_map,
                 const std::map<std::string, std::vector<int>> &shapes,
@@ -168,6 +180,9 @@ class RTNet : public Inference {
                        TensorModifyMap *tensor_modify_map);
   bool checkInt8(const std::string &gpu_name,
                  nvinfer1::IInt8Calibrator *calibrator);
+  std::string engineCacheKey(const std::string &gpu_name, bool int8_mode);
+  bool loadEngineFromCache(const std::string &file);
+  void saveEngineToCache(const std::string &file);
   void mergeBN(int index, LayerParameter *layer_param);
   nvinfer1::Weights loadLayerWeights(const float *data, int size);
   nvinfer1::Weights loadLayerWeights(float data, int size);
@@ -176,6 +191,8 @@ class RTNet : public Inference {
   void init_blob(std::vector<std::string> *names);
 
  private:
+  nvinfer1::IRuntime *runtime_ = nullptr;
+  nvinfer1::ICudaEngine *engine_ = nullptr;
   nvinfer1::IExecutionContext *context_ = nullptr;
   cudaStream_t stream_ = 0;
   std::vector<std::shared_ptr<ArgMax1Plugin>> argmax_plugins_;
@@ -193,6 +210,9 @@ class RTNet : public Inference {
   nvinfer1::Int8EntropyCalibrator *calibrator_ = nullptr;
   bool is_own_calibrator_ = true;
   std::string model_root_;
+  std::string net_file_;
+  std::string model_file_;
+  std::string engine_cache_root_;
   nvinfer1::IBuilder *builder_ = nullptr;
   nvinfer1::INetworkDefinition *network_ = nullptr;
   std::vector<std::shared_ptr<float>> weights_mem_;
@@ -16,6 +16,7 @@
 #include "modules/perception/lidar/app/lidar_obstacle_segmentation.h"
 
 #include "cyber/common/file.h"
+#include "modules/perception/base/syncedmem.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
 #include "modules/perception/lib/utils/perf.h"
 #include "modules/perception/lidar/app/proto/lidar_obstacle_segmentation_config.pb.h"
@@ -47,6 +48,8 @@ bool LidarObstacleSegmentation::Init(
   segmentor_name_ = config.segmentor();
   use_map_manager_ = config.use_map_manager();
   use_object_filter_bank_ = config.use_object_filter_bank();
+  // optional switch, absent in most model configs
+  model_config->get_value("enable_transfer_stats", &enable_transfer_stats_);
 
   use_map_manager_ = use_map_manager_ && options.enable_hdmap_input;
 
@@ -120,6 +123,22 @@ LidarProcessResult LidarObstacleSegmentation::ProcessCommon(
     const LidarObstacleSegmentationOptions& options, LidarFrame* frame) {
   const auto& sensor_name = options.sensor_name;
 
+  // note the counters are process wide, so attribute copies to stages
+  // with a single lidar pipeline running
+  size_t h2d = base::SyncedMemory::h2d_sync_count();
+  size_t d2h = base::SyncedMemory::d2h_sync_count();
+  auto report_transfers = [&](const char* stage) {
+    if (!enable_transfer_stats_) {
+      return;
+    }
+    const size_t h2d_now = base::SyncedMemory::h2d_sync_count();
+    const size_t d2h_now = base::SyncedMemory::d2h_sync_count();
+    AINFO << "TRANSFER_STATISTICS:" << sensor_name << ":" << stage << ":h2d["
+          << h2d_now - h2d << "]:d2h[" << d2h_now - d2h << "]";
+    h2d = h2d_now;
+    d2h = d2h_now;
+  };
+
   PERCEPTION_PERF_BLOCK_START();
   if (use_map_manager_) {
     MapManagerOptions map_manager_options;
@@ -129,6 +148,7 @@ LidarProcessResult LidarObstacleSegmentation::ProcessCommon(
     }
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(sensor_name, "map_manager");
+  report_transfers("map_manager");
 
   SegmentationOptions segmentation_options;
   if (!segmentor_->Segment(segmentation_options, frame)) {
@@ -136,6 +156,7 @@ LidarProcessResult LidarObstacleSegmentation::ProcessCommon(
                               "Failed to segment.");
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(sensor_name, "segmentation");
+  report_transfers("segmentation");
 
   ObjectBuilderOptions builder_options;
   if (!builder_.Build(builder_options, frame)) {
@@ -143,6 +164,7 @@ LidarProcessResult LidarObstacleSegmentation::ProcessCommon(
                               "Failed to build objects.");
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(sensor_name, "object_builder");
+  report_transfers("object_builder");
 
   ObjectFilterOptions filter_options;
   if (!filter_bank_.Filter(filter_options, frame)) {
@@ -150,6 +172,7 @@ LidarProcessResult LidarObstacleSegmentation::ProcessCommon(
                               "Failed to filter objects.");
   }
   PERCEPTION_PERF_BLOCK_END_WITH_INDICATOR(sensor_name, "filter_bank");
+  report_transfers("filter_bank");
 
   return LidarProcessResult(LidarErrorCode::Succeed);
 }
@@ -74,6 +74,9 @@ class LidarObstacleSegmentation {
   std::string segmentor_name_;
   bool use_map_manager_ = true;
   bool use_object_filter_bank_ = true;
+  // when set via model config, every stage logs how many host/device
+  // copies it triggered, to locate redundant blob syncs in the pipeline
+  bool enable_transfer_stats_ = false;
 };  // class LidarObstacleSegmentation
 
 }  // namespace lidar
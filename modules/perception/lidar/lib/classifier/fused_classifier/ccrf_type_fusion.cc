@@ -145,11 +145,8 @@ bool CCRFSequenceTypeFusion::Init(const TypeFusionInitOption& option) {
   util::NormalizeRow(&transition_matrix_);
   AINFO << "transition matrix";
   AINFO << std::endl << transition_matrix_;
-  for (std::size_t i = 0; i < VALID_OBJECT_TYPE; ++i) {
-    for (std::size_t j = 0; j < VALID_OBJECT_TYPE; ++j) {
-      transition_matrix_(i, j) = log(transition_matrix_(i, j));
-    }
-  }
+  transition_matrix_ = transition_matrix_.array().log().matrix();
+  scaled_transition_matrix_ = transition_matrix_ * s_alpha_;
   AINFO << std::endl << transition_matrix_;
   return true;
 }
@@ -168,51 +165,101 @@ bool CCRFSequenceTypeFusion::TypeFusion(const TypeFusionOption& option,
 bool CCRFSequenceTypeFusion::FuseWithConditionalProbabilityInference(
     TrackedObjects* tracked_objects) {
   // AINFO << "Enter fuse with conditional probability inference";
-  fused_oneshot_probs_.resize(tracked_objects->size());
+  ObjectPtr latest_object = tracked_objects->rbegin()->second;
+  const double start_timestamp = tracked_objects->begin()->first;
+  const double last_timestamp = tracked_objects->rbegin()->first;
+  PruneStaleTrackStates(last_timestamp);
+  TrackState& state = track_states_[latest_object->track_id];
 
-  std::size_t i = 0;
+  // drop cached one-shot probs that slid out of the temporal window
+  auto& cached_probs = state.oneshot_log_probs;
+  cached_probs.erase(cached_probs.begin(),
+                     cached_probs.lower_bound(start_timestamp));
+
+  // fused one-shot probs are a pure function of the stored object, so
+  // only elements unseen so far (normally just the newest one) are
+  // computed, the rest is served from the per-track cache
   for (auto& pair : *tracked_objects) {
-    ObjectPtr& object = pair.second;
-    if (!one_shot_fuser_.FuseOneShotTypeProbs(object,
-                                              &fused_oneshot_probs_[i++])) {
+    if (cached_probs.find(pair.first) != cached_probs.end()) {
+      continue;
+    }
+    Vectord log_prob;
+    if (!one_shot_fuser_.FuseOneShotTypeProbs(pair.second, &log_prob)) {
       AERROR << "Failed to fuse one short probs in sequence.";
       return false;
     }
+    cached_probs.emplace(pair.first, log_prob);
   }
 
   // Use viterbi algorithm to infer the state
-  std::size_t length = tracked_objects->size();
-  fused_sequence_probs_.resize(length);
-  state_back_trace_.resize(length);
-
-  fused_sequence_probs_[0] = fused_oneshot_probs_[0];
-  // Add priori knowledge to suppress the sudden-appeared object types.
-  fused_sequence_probs_[0] += transition_matrix_.row(0).transpose();
-
-  for (std::size_t i = 1; i < length; ++i) {
-    for (std::size_t right = 0; right < VALID_OBJECT_TYPE; ++right) {
-      double prob = 0.0;
-      double max_prob = -DBL_MAX;
-      std::size_t id = 0;
-      for (std::size_t left = 0; left < VALID_OBJECT_TYPE; ++left) {
-        prob = fused_sequence_probs_[i - 1](left) +
-               transition_matrix_(left, right) * s_alpha_ +
-               fused_oneshot_probs_[i](right);
-        if (prob > max_prob) {
-          max_prob = prob;
-          id = left;
-        }
+  const std::size_t length = tracked_objects->size();
+  bool incremental = length == state.length + 1 &&
+                     start_timestamp == state.start_timestamp && length > 1;
+  if (incremental) {
+    auto second_to_last = tracked_objects->rbegin();
+    ++second_to_last;
+    incremental = second_to_last->first == state.last_timestamp;
+  }
+  if (incremental) {
+    // exactly one element was appended since the last fusion and the
+    // window start did not move, so a single recursion step carries the
+    // sequence state forward
+    Vectord next;
+    Vectori trace;
+    ViterbiStep(state.sequence_log_prob, cached_probs.rbegin()->second, &next,
+                &trace);
+    state.sequence_log_prob = next;
+  } else {
+    fused_sequence_probs_.resize(length);
+    state_back_trace_.resize(length);
+    std::size_t i = 0;
+    for (auto& pair : cached_probs) {
+      if (i == 0) {
+        fused_sequence_probs_[0] = pair.second;
+        // Add priori knowledge to suppress the sudden-appeared object types.
+        fused_sequence_probs_[0] += transition_matrix_.row(0).transpose();
+      } else {
+        ViterbiStep(fused_sequence_probs_[i - 1], pair.second,
+                    &fused_sequence_probs_[i], &state_back_trace_[i]);
       }
-      fused_sequence_probs_[i](right) = max_prob;
-      state_back_trace_[i](right) = static_cast<int>(id);
+      ++i;
     }
+    state.sequence_log_prob = fused_sequence_probs_.back();
   }
-  ObjectPtr object = tracked_objects->rbegin()->second;
-  RecoverFromLogProbability(&fused_sequence_probs_.back(), &object->type_probs,
-                            &object->type);
+  state.start_timestamp = start_timestamp;
+  state.last_timestamp = last_timestamp;
+  state.length = length;
+
+  Vectord fused_prob = state.sequence_log_prob;
+  RecoverFromLogProbability(&fused_prob, &latest_object->type_probs,
+                            &latest_object->type);
   return true;
 }
 
+void CCRFSequenceTypeFusion::ViterbiStep(const Vectord& prev,
+                                         const Vectord& oneshot, Vectord* next,
+                                         Vectori* back_trace) {
+  // candidate(left, right) = prev(left) + alpha * log-transition(left, right),
+  // built once for all state pairs and reduced column-wise
+  const Matrixd candidates =
+      prev.replicate(1, VALID_OBJECT_TYPE) + scaled_transition_matrix_;
+  Eigen::Index id = 0;
+  for (std::size_t right = 0; right < VALID_OBJECT_TYPE; ++right) {
+    (*next)(right) = candidates.col(right).maxCoeff(&id) + oneshot(right);
+    (*back_trace)(right) = static_cast<int>(id);
+  }
+}
+
+void CCRFSequenceTypeFusion::PruneStaleTrackStates(double current_timestamp) {
+  for (auto it = track_states_.begin(); it != track_states_.end();) {
+    if (it->second.last_timestamp + kMaxTrackStateTimeOut < current_timestamp) {
+      it = track_states_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 bool CCRFSequenceTypeFusion::RecoverFromLogProbability(Vectord* prob,
                                                        std::vector<float>* dst,
                                                        ObjectType* type) {
@@ -62,20 +62,46 @@ class CCRFSequenceTypeFusion : public BaseSequenceTypeFusion {
 
   // window version of Chain-CRFs inference
   bool FuseWithConditionalProbabilityInference(TrackedObjects* tracked_objects);
+  // @brief: one viterbi recursion step in matrix form, the candidate
+  //         matrix is built once and reduced column-wise instead of
+  //         looping over state pairs
+  void ViterbiStep(const Vectord& prev, const Vectord& oneshot, Vectord* next,
+                   Vectori* back_trace);
+  // @brief: drop cached states of tracks not updated recently
+  void PruneStaleTrackStates(double current_timestamp);
   // util
   bool RecoverFromLogProbability(Vectord* prob, std::vector<float>* dst,
                                  perception::base::ObjectType* type);
 
+ protected:
+  // per-track cache so the sequence fusion is carried incrementally
+  // instead of being rebuilt from raw probabilities every frame
+  struct TrackState {
+    // fused one-shot log probabilities of the elements currently in
+    // the temporal window, keyed by timestamp
+    std::map<double, Vectord> oneshot_log_probs;
+    // viterbi state at the newest element of the last fusion
+    Vectord sequence_log_prob;
+    double start_timestamp = 0.0;
+    double last_timestamp = 0.0;
+    std::size_t length = 0;
+  };
+
  protected:
   CCRFOneShotTypeFusion one_shot_fuser_;
   // Note all in the log space
   Matrixd transition_matrix_;
+  // log transition matrix pre-scaled by s_alpha_
+  Matrixd scaled_transition_matrix_;
 
   // data member for window inference version
-  std::vector<Vectord> fused_oneshot_probs_;
   std::vector<Vectord> fused_sequence_probs_;
   std::vector<Vectori> state_back_trace_;
 
+  std::map<int, TrackState> track_states_;
+  // mirror ObjectSequence::kMaxTimeOut
+  static constexpr double kMaxTrackStateTimeOut = 5.0;
+
  protected:
   double s_alpha_ = 1.8;
 };
@@ -40,23 +40,13 @@ void FromEigenToVector(const Vectord& src_prob, std::vector<float>* dst_prob) {
   }
 }
 
-void ToLog(Vectord* prob) {
-  for (size_t i = 0; i < VALID_OBJECT_TYPE; ++i) {
-    (*prob)(i) = log((*prob)(i));
-  }
-}
+void ToLog(Vectord* prob) { *prob = prob->array().log().matrix(); }
 
-void ToExp(Vectord* prob) {
-  for (size_t i = 0; i < VALID_OBJECT_TYPE; ++i) {
-    (*prob)(i) = exp((*prob)(i));
-  }
-}
+void ToExp(Vectord* prob) { *prob = prob->array().exp().matrix(); }
 
 void ToExpStable(Vectord* prob) {
   double min_value = prob->minCoeff();
-  for (size_t i = 0; i < VALID_OBJECT_TYPE; ++i) {
-    (*prob)(i) = exp((*prob)(i)-min_value);
-  }
+  *prob = (prob->array() - min_value).exp().matrix();
 }
 
 void Normalize(Vectord* prob) {
@@ -60,7 +60,9 @@ bool GroundServiceDetector::Detect(const GroundDetectorOptions& options,
     AERROR << "Frame is nullptr.";
     return false;
   }
-  ground_service_->GetServiceContentCopy(&ground_service_content_);
+  // refetch the ground grid only when a producer published a new version
+  ground_service_->GetServiceContentCopyIfChanged(&ground_service_content_,
+                                                  &content_version_);
   if (!ground_service_content_.IsServiceReady()) {
     AERROR << "service is not ready.";
     return false;
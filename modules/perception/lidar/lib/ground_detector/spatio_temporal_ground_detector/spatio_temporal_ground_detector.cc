@@ -207,6 +207,7 @@ bool SpatioTemporalGroundDetector::Detect(const GroundDetectorOptions& options,
           }
         }
       }
+      ground_service_content_.SetTimestamp(frame->timestamp);
       ground_service->UpdateServiceContent(ground_service_content_);
     } else {
       AINFO << "Failed to find ground service and cannot update.";
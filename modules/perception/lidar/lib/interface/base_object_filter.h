@@ -16,6 +16,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "cyber/common/macros.h"
 #include "modules/perception/lib/registerer/registerer.h"
@@ -47,6 +48,23 @@ class BaseObjectFilter {
   virtual bool Filter(const ObjectFilterOptions& options,
                       LidarFrame* frame) = 0;
 
+  // @brief: whether FilterVerdict is implemented, verdict capable
+  //         filters can be run concurrently by the filter bank
+  virtual bool SupportsVerdict() const { return false; }
+
+  // @brief: compute per-object keep verdicts without erasing objects,
+  //         so several filters can run over the same frame concurrently
+  //         and the caller merges the verdicts and compacts the list once.
+  //         implementations may only read shared frame state and write
+  //         per-object supplement flags
+  // @param [in]: options
+  // @param [in/out]: frame
+  // @param [out]: keep, one flag per segmented object
+  virtual bool FilterVerdict(const ObjectFilterOptions& options,
+                             LidarFrame* frame, std::vector<bool>* keep) {
+    return false;
+  }
+
   virtual std::string Name() const = 0;
 
  private:
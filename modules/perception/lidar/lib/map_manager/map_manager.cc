@@ -15,6 +15,9 @@
  *****************************************************************************/
 #include "modules/perception/lidar/lib/map_manager/map_manager.h"
 
+#include <cmath>
+#include <limits>
+
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
 
@@ -41,11 +44,16 @@ bool MapManager::Init(const MapManagerInitOptions& options) {
   CHECK(cyber::common::GetProtoFromFile(config_file, &config));
   update_pose_ = config.update_pose();
   roi_search_distance_ = config.roi_search_distance();
+  roi_cache_margin_ = options.roi_cache_margin;
   hdmap_input_ = map::HDMapInput::Instance();
   if (!hdmap_input_->Init()) {
     AINFO << "Failed to init hdmap input.";
     return false;
   }
+  if (roi_cache_margin_ > 0.0) {
+    prefetch_worker_.Bind([this]() { return PrefetchProc(); });
+    prefetch_worker_.Start();
+  }
   return true;
 }
 
@@ -70,14 +78,82 @@ bool MapManager::Update(const MapManagerOptions& options, LidarFrame* frame) {
   point.x = frame->lidar2world_pose.translation()(0);
   point.y = frame->lidar2world_pose.translation()(1);
   point.z = frame->lidar2world_pose.translation()(2);
-  if (!hdmap_input_->GetRoiHDMapStruct(point, roi_search_distance_,
-                                       frame->hdmap_struct)) {
+  if (roi_cache_margin_ <= 0.0) {
+    if (!hdmap_input_->GetRoiHDMapStruct(point, roi_search_distance_,
+                                         frame->hdmap_struct)) {
+      frame->hdmap_struct->road_polygons.clear();
+      frame->hdmap_struct->road_boundary.clear();
+      frame->hdmap_struct->hole_polygons.clear();
+      frame->hdmap_struct->junction_polygons.clear();
+      AINFO << "Failed to get roi from hdmap.";
+    }
+    return true;
+  }
+  if (!UpdateCache(point)) {
     frame->hdmap_struct->road_polygons.clear();
     frame->hdmap_struct->road_boundary.clear();
     frame->hdmap_struct->hole_polygons.clear();
     frame->hdmap_struct->junction_polygons.clear();
     AINFO << "Failed to get roi from hdmap.";
+    return true;
   }
+  // the cached struct is read-only downstream, share it with the frame
+  frame->hdmap_struct = cached_hdmap_struct_;
+  return true;
+}
+
+bool MapManager::UpdateCache(const base::PointD& center) {
+  double dist = std::numeric_limits<double>::max();
+  if (cache_valid_) {
+    const double dx = center.x - cached_center_.x;
+    const double dy = center.y - cached_center_.y;
+    dist = std::sqrt(dx * dx + dy * dy);
+  }
+  if (dist <= roi_cache_margin_) {
+    // still covered; prefetch the next query once past half the margin
+    if (dist > 0.5 * roi_cache_margin_ && !prefetch_inflight_) {
+      prefetch_center_ = center;
+      prefetch_inflight_ = true;
+      prefetch_worker_.WakeUp();
+    }
+    return true;
+  }
+  // adopt the prefetched result when it covers the current pose
+  if (prefetch_inflight_) {
+    prefetch_worker_.Join();
+    prefetch_inflight_ = false;
+    const double pdx = center.x - prefetch_center_.x;
+    const double pdy = center.y - prefetch_center_.y;
+    if (prefetch_success_ &&
+        std::sqrt(pdx * pdx + pdy * pdy) <= roi_cache_margin_) {
+      cached_hdmap_struct_ = prefetch_hdmap_struct_;
+      prefetch_hdmap_struct_.reset();
+      cached_center_ = prefetch_center_;
+      cache_valid_ = true;
+      return true;
+    }
+    prefetch_hdmap_struct_.reset();
+  }
+  // synchronous refill with the enlarged radius so every pose within
+  // the margin stays covered by at least roi_search_distance_
+  std::shared_ptr<base::HdmapStruct> hdmap_struct(new base::HdmapStruct);
+  if (!hdmap_input_->GetRoiHDMapStruct(
+          center, roi_search_distance_ + roi_cache_margin_, hdmap_struct)) {
+    cache_valid_ = false;
+    return false;
+  }
+  cached_hdmap_struct_ = hdmap_struct;
+  cached_center_ = center;
+  cache_valid_ = true;
+  return true;
+}
+
+bool MapManager::PrefetchProc() {
+  std::shared_ptr<base::HdmapStruct> hdmap_struct(new base::HdmapStruct);
+  prefetch_success_ = hdmap_input_->GetRoiHDMapStruct(
+      prefetch_center_, roi_search_distance_ + roi_cache_margin_,
+      hdmap_struct);
+  prefetch_hdmap_struct_ = hdmap_struct;
   return true;
 }
 bool MapManager::QueryPose(Eigen::Affine3d* sensor2world_pose) const {
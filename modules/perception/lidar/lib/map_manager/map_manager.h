@@ -15,11 +15,13 @@
  *****************************************************************************/
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "gtest/gtest_prod.h"
 
 #include "modules/perception/base/hdmap_struct.h"
+#include "modules/perception/lib/thread/thread_worker.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
 #include "modules/perception/map/hdmap/hdmap_input.h"
 
@@ -27,7 +29,12 @@ namespace apollo {
 namespace perception {
 namespace lidar {
 
-struct MapManagerInitOptions {};
+struct MapManagerInitOptions {
+  // reuse margin of the cached ROI query in meters, the cache serves
+  // every pose within this distance of the query center; 0 turns the
+  // cache off and queries the map every frame
+  double roi_cache_margin = 10.0;
+};
 
 struct MapManagerOptions {};
 
@@ -50,12 +57,36 @@ class MapManager {
 
   std::string Name() const { return "MapManager"; }
 
+ private:
+  // @brief: serve the ROI around center from the cache, refilling it
+  //         from the map (prefetched or synchronous) when the pose has
+  //         left the cache margin
+  // @param [in]: query center, the current ego position
+  bool UpdateCache(const base::PointD& center);
+
+  // @brief: body of the prefetch worker, queries the ROI around
+  //         prefetch_center_ into prefetch_hdmap_struct_
+  bool PrefetchProc();
+
  private:
   LidarFrame* cached_frame_ = nullptr;
   map::HDMapInput* hdmap_input_ = nullptr;
   // params
   bool update_pose_ = false;
   double roi_search_distance_ = 80.0;
+  double roi_cache_margin_ = 0.0;
+  // last ROI query, valid for poses within roi_cache_margin_ of its
+  // center since it was queried with the enlarged radius
+  std::shared_ptr<base::HdmapStruct> cached_hdmap_struct_;
+  base::PointD cached_center_;
+  bool cache_valid_ = false;
+  // background prefetch of the next query, kicked off when the pose
+  // passes half the cache margin
+  lib::ThreadWorker prefetch_worker_;
+  std::shared_ptr<base::HdmapStruct> prefetch_hdmap_struct_;
+  base::PointD prefetch_center_;
+  bool prefetch_inflight_ = false;
+  bool prefetch_success_ = false;
 
   FRIEND_TEST(LidarLibMapManagerTest, lidar_map_manager_test);
 };  // class MapManager
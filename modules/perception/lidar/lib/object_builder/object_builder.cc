@@ -36,6 +36,11 @@ using PointFCloud = apollo::perception::base::PointCloud<PointF>;
 using PolygonDType = apollo::perception::base::PointCloud<PointD>;
 
 bool ObjectBuilder::Init(const ObjectBuilderInitOptions& options) {
+  if (options.nr_worker_threads > 1) {
+    thread_pool_.reset(
+        new lib::ThreadPool(static_cast<int>(options.nr_worker_threads)));
+    thread_pool_->Start();
+  }
   return true;
 }
 
@@ -48,6 +53,23 @@ bool ObjectBuilder::Build(const ObjectBuilderOptions& options,
   for (size_t i = 0; i < objects->size(); ++i) {
     if (objects->at(i)) {
       objects->at(i)->id = static_cast<int>(i);
+    }
+  }
+  if (thread_pool_ != nullptr && objects->size() > 1) {
+    // every task only touches its own object, so the completion counter
+    // is the only synchronization needed
+    build_objects_ = objects;
+    lib::BlockingCounter counter(objects->size());
+    for (size_t i = 0; i < objects->size(); ++i) {
+      thread_pool_->Add(google::protobuf::NewCallback(
+          this, &ObjectBuilder::BuildObjectTask, static_cast<int>(i),
+          &counter));
+    }
+    counter.Wait();
+    return true;
+  }
+  for (size_t i = 0; i < objects->size(); ++i) {
+    if (objects->at(i)) {
       ComputePolygon2D(objects->at(i));
       ComputePolygonSizeCenter(objects->at(i));
       ComputeOtherObjectInformation(objects->at(i));
@@ -56,6 +78,16 @@ bool ObjectBuilder::Build(const ObjectBuilderOptions& options,
   return true;
 }
 
+void ObjectBuilder::BuildObjectTask(int index, lib::BlockingCounter* counter) {
+  ObjectPtr object = build_objects_->at(index);
+  if (object) {
+    ComputePolygon2D(object);
+    ComputePolygonSizeCenter(object);
+    ComputeOtherObjectInformation(object);
+  }
+  counter->Decrement();
+}
+
 void ObjectBuilder::ComputePolygon2D(ObjectPtr object) {
   Eigen::Vector3f min_pt;
   Eigen::Vector3f max_pt;
@@ -23,13 +23,19 @@
 #include "modules/perception/base/point.h"
 #include "modules/perception/base/point_cloud.h"
 #include "modules/perception/lib/registerer/registerer.h"
+#include "modules/perception/lib/thread/mutex.h"
+#include "modules/perception/lib/thread/thread_pool.h"
 #include "modules/perception/lidar/common/lidar_frame.h"
 
 namespace apollo {
 namespace perception {
 namespace lidar {
 
-struct ObjectBuilderInitOptions {};
+struct ObjectBuilderInitOptions {
+  // number of worker threads building objects in parallel,
+  // 1 keeps the builder single-threaded
+  unsigned int nr_worker_threads = 4;
+};
 
 struct ObjectBuilderOptions {
   Eigen::Vector3d ref_center = Eigen::Vector3d(0, 0, 0);
@@ -90,6 +96,19 @@ class ObjectBuilder {
   void GetMinMax3D(const apollo::perception::base::PointCloud<
                        apollo::perception::base::PointF>& cloud,
                    Eigen::Vector3f* min_pt, Eigen::Vector3f* max_pt);
+
+  // @brief: build one object of the current frame, each task only
+  //         touches its own object so tasks run concurrently.
+  // @param [in]: object index in the current frame.
+  // @param [in/out]: completion counter of the frame.
+  void BuildObjectTask(int index, lib::BlockingCounter* counter);
+
+  // worker pool building objects in parallel, null when
+  // nr_worker_threads <= 1
+  std::unique_ptr<lib::ThreadPool> thread_pool_;
+  // objects of the frame currently being built, set before dispatch
+  std::vector<std::shared_ptr<apollo::perception::base::Object>>*
+      build_objects_ = nullptr;
 };  // class ObjectBuilder
 
 }  // namespace lidar
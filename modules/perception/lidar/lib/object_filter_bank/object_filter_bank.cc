@@ -55,15 +55,72 @@ bool ObjectFilterBank::Init(const ObjectFilterInitOptions& options) {
     filter_bank_.push_back(filter);
     AINFO << "Filter bank add filter: " << name;
   }
+  verdict_filters_.clear();
+  sequential_filters_.clear();
+  for (auto& filter : filter_bank_) {
+    if (filter->SupportsVerdict()) {
+      verdict_filters_.push_back(filter);
+    } else {
+      sequential_filters_.push_back(filter);
+    }
+  }
+  // concurrency only pays off with at least two verdict capable filters,
+  // otherwise stick to the sequential path
+  if (verdict_filters_.size() > 1) {
+    thread_pool_.reset(
+        new lib::ThreadPool(static_cast<int>(verdict_filters_.size())));
+    thread_pool_->Start();
+  }
   return true;
 }
 
 bool ObjectFilterBank::Filter(const ObjectFilterOptions& options,
                               LidarFrame* frame) {
   size_t object_number = frame->segmented_objects.size();
-  for (auto& filter : filter_bank_) {
-    if (!filter->Filter(options, frame)) {
-      AINFO << "Failed to filter objects in: " << filter->Name();
+  if (thread_pool_ != nullptr) {
+    // verdict capable filters only read shared frame state and write
+    // disjoint per-object flags, so the completion counter is the only
+    // synchronization needed
+    filter_options_ = &options;
+    filter_frame_ = frame;
+    verdicts_.resize(verdict_filters_.size());
+    lib::BlockingCounter counter(verdict_filters_.size());
+    for (size_t i = 0; i < verdict_filters_.size(); ++i) {
+      thread_pool_->Add(google::protobuf::NewCallback(
+          this, &ObjectFilterBank::FilterVerdictTask, static_cast<int>(i),
+          &counter));
+    }
+    counter.Wait();
+    // merge the per-filter bitsets and compact the object list once,
+    // keeping the output order stable for the tracker downstream
+    auto& objects = frame->segmented_objects;
+    size_t count = 0;
+    for (size_t i = 0; i < objects.size(); ++i) {
+      bool keep = true;
+      for (auto& verdict : verdicts_) {
+        if (i < verdict.size() && !verdict[i]) {
+          keep = false;
+          break;
+        }
+      }
+      if (keep) {
+        if (count != i) {
+          objects[count] = objects[i];
+        }
+        ++count;
+      }
+    }
+    objects.resize(count);
+    for (auto& filter : sequential_filters_) {
+      if (!filter->Filter(options, frame)) {
+        AINFO << "Failed to filter objects in: " << filter->Name();
+      }
+    }
+  } else {
+    for (auto& filter : filter_bank_) {
+      if (!filter->Filter(options, frame)) {
+        AINFO << "Failed to filter objects in: " << filter->Name();
+      }
     }
   }
   AINFO << "Object filter bank, filtered objects size: from " << object_number
@@ -71,6 +128,19 @@ bool ObjectFilterBank::Filter(const ObjectFilterOptions& options,
   return true;
 }
 
+void ObjectFilterBank::FilterVerdictTask(int index,
+                                         lib::BlockingCounter* counter) {
+  auto* filter = verdict_filters_[index];
+  if (!filter->FilterVerdict(*filter_options_, filter_frame_,
+                             &verdicts_[index])) {
+    AINFO << "Failed to filter objects in: " << filter->Name();
+    // an empty verdict keeps every object, matching the sequential
+    // behavior where a failed filter leaves the list untouched
+    verdicts_[index].clear();
+  }
+  counter->Decrement();
+}
+
 }  // namespace lidar
 }  // namespace perception
 }  // namespace apollo
@@ -15,10 +15,13 @@
  *****************************************************************************/
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "cyber/common/macros.h"
+#include "modules/perception/lib/thread/mutex.h"
+#include "modules/perception/lib/thread/thread_pool.h"
 #include "modules/perception/lidar/lib/interface/base_object_filter.h"
 
 namespace apollo {
@@ -47,8 +50,21 @@ class ObjectFilterBank {
 
   size_t Size() const { return filter_bank_.size(); }
 
+ private:
+  // @brief: run one verdict capable filter over the frame,
+  //         filling its own keep bitset
+  void FilterVerdictTask(int index, lib::BlockingCounter* counter);
+
  private:
   std::vector<BaseObjectFilter*> filter_bank_;
+  // filters partitioned by verdict support, verdict capable ones are
+  // executed concurrently, the rest keep the legacy sequential path
+  std::vector<BaseObjectFilter*> verdict_filters_;
+  std::vector<BaseObjectFilter*> sequential_filters_;
+  std::vector<std::vector<bool>> verdicts_;
+  const ObjectFilterOptions* filter_options_ = nullptr;
+  LidarFrame* filter_frame_ = nullptr;
+  std::unique_ptr<lib::ThreadPool> thread_pool_;
   DISALLOW_COPY_AND_ASSIGN(ObjectFilterBank);
 };
 
@@ -49,12 +49,35 @@ bool ROIBoundaryFilter::Init(const ObjectFilterInitOptions& options) {
 
 bool ROIBoundaryFilter::Filter(const ObjectFilterOptions& options,
                                LidarFrame* frame) {
+  if (!FilterVerdict(options, frame, &objects_valid_flag_)) {
+    return false;
+  }
+  auto& objects = frame->segmented_objects;
+  size_t count = 0;
+  for (size_t i = 0; i < objects.size(); ++i) {
+    if (objects_valid_flag_[i]) {
+      if (count != i) {
+        objects[count] = objects[i];
+      }
+      ++count;
+    }
+  }
+  objects.resize(count);
+  AINFO << "Roi boundary filter, " << objects_valid_flag_.size() << " to "
+        << count;
+  return true;
+}
+
+bool ROIBoundaryFilter::FilterVerdict(const ObjectFilterOptions& options,
+                                      LidarFrame* frame,
+                                      std::vector<bool>* keep) {
   if (!frame) {
     AINFO << "Lidar frame is nullptr.";
     return false;
   }
   if (!frame->hdmap_struct) {
     AINFO << "HDMap struct is nullptr.";
+    keep->assign(frame->segmented_objects.size(), true);
     return true;
   }
   if (frame->hdmap_struct->road_boundary.size() +
@@ -65,6 +88,7 @@ bool ROIBoundaryFilter::Filter(const ObjectFilterOptions& options,
     for (auto& object : frame->segmented_objects) {
       object->lidar_supplement.is_in_roi = true;
     }
+    keep->assign(frame->segmented_objects.size(), true);
     return true;
   }
   auto& objects = frame->segmented_objects;
@@ -72,27 +96,15 @@ bool ROIBoundaryFilter::Filter(const ObjectFilterOptions& options,
     obj->lidar_supplement.is_in_roi = obj->lidar_supplement.is_background;
   }
   FillObjectRoiFlag(options, frame);
-  objects_valid_flag_.assign(frame->segmented_objects.size(), true);
+  keep->assign(frame->segmented_objects.size(), true);
   BuildWorldPolygons(options, *frame);
   if (distance_to_boundary_threshold_ >= 0.f) {
-    FilterObjectsOutsideBoundary(options, frame, &objects_valid_flag_);
+    FilterObjectsOutsideBoundary(options, frame, keep);
   }
   if (inside_threshold_ >= 0.f) {
-    FilterObjectsInsideBoundary(options, frame, &objects_valid_flag_);
+    FilterObjectsInsideBoundary(options, frame, keep);
   }
-  FilterObjectsByConfidence(options, frame, &objects_valid_flag_);
-  size_t count = 0;
-  for (size_t i = 0; i < objects.size(); ++i) {
-    if (objects_valid_flag_[i]) {
-      if (count != i) {
-        objects[count] = objects[i];
-      }
-      ++count;
-    }
-  }
-  objects.resize(count);
-  AINFO << "Roi boundary filter, " << objects_valid_flag_.size() << " to "
-        << count;
+  FilterObjectsByConfidence(options, frame, keep);
   return true;
 }
 
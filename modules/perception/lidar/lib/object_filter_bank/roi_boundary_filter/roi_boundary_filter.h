@@ -44,6 +44,15 @@ class ROIBoundaryFilter : public BaseObjectFilter {
   // segmented_objects should be valid, and will be filtered,
   bool Filter(const ObjectFilterOptions& options, LidarFrame* frame) override;
 
+  bool SupportsVerdict() const override { return true; }
+
+  // @brief: compute per-object keep verdicts without erasing objects
+  // @param [in]: options
+  // @param [in/out]: frame
+  // @param [out]: keep, one flag per segmented object
+  bool FilterVerdict(const ObjectFilterOptions& options, LidarFrame* frame,
+                     std::vector<bool>* keep) override;
+
   std::string Name() const override { return "ROIBoundaryFilter"; }
 
  private:
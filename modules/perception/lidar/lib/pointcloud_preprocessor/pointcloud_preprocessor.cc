@@ -77,7 +77,14 @@ bool PointCloudPreprocessor::Preprocess(
   frame->cloud->set_timestamp(message->measurement_time());
   if (message->point_size() > 0) {
     frame->cloud->reserve(message->point_size());
+    frame->world_cloud->clear();
+    frame->world_cloud->reserve(message->point_size());
+    // the filters, the ego-box test and the world transform run in one
+    // sweep so every surviving point is touched exactly once
+    const Eigen::Matrix4d& ext = options.sensor2novatel_extrinsics.matrix();
+    const Eigen::Affine3d& pose = frame->lidar2world_pose;
     base::PointF point;
+    base::PointD world_point;
     for (int i = 0; i < message->point_size(); ++i) {
       const apollo::drivers::PointXYZIT& pt = message->point(i);
       if (filter_naninf_points_) {
@@ -90,14 +97,17 @@ bool PointCloudPreprocessor::Preprocess(
           continue;
         }
       }
-      Eigen::Vector3d vec3d_lidar(pt.x(), pt.y(), pt.z());
-      Eigen::Vector3d vec3d_novatel =
-          options.sensor2novatel_extrinsics * vec3d_lidar;
-      if (filter_nearby_box_points_ && vec3d_novatel[0] < box_forward_x_ &&
-          vec3d_novatel[0] > box_backward_x_ &&
-          vec3d_novatel[1] < box_forward_y_ &&
-          vec3d_novatel[1] > box_backward_y_) {
-        continue;
+      if (filter_nearby_box_points_) {
+        // only the x and y rows of the extrinsics are needed for the
+        // ego-box test
+        double novatel_x = ext(0, 0) * pt.x() + ext(0, 1) * pt.y() +
+                           ext(0, 2) * pt.z() + ext(0, 3);
+        double novatel_y = ext(1, 0) * pt.x() + ext(1, 1) * pt.y() +
+                           ext(1, 2) * pt.z() + ext(1, 3);
+        if (novatel_x < box_forward_x_ && novatel_x > box_backward_x_ &&
+            novatel_y < box_forward_y_ && novatel_y > box_backward_y_) {
+          continue;
+        }
       }
       if (filter_high_z_points_ && pt.z() > z_threshold_) {
         continue;
@@ -106,10 +116,17 @@ bool PointCloudPreprocessor::Preprocess(
       point.y = pt.y();
       point.z = pt.z();
       point.intensity = static_cast<float>(pt.intensity());
-      frame->cloud->push_back(point, static_cast<double>(pt.timestamp()) * 1e-9,
-                              FLT_MAX, i, 0);
+      double point_timestamp = static_cast<double>(pt.timestamp()) * 1e-9;
+      frame->cloud->push_back(point, point_timestamp, FLT_MAX, i, 0);
+      Eigen::Vector3d trans_point(pt.x(), pt.y(), pt.z());
+      trans_point = pose * trans_point;
+      world_point.x = trans_point(0);
+      world_point.y = trans_point(1);
+      world_point.z = trans_point(2);
+      world_point.intensity = point.intensity;
+      frame->world_cloud->push_back(world_point, point_timestamp, FLT_MAX, i,
+                                    0);
     }
-    TransformCloud(frame->cloud, frame->lidar2world_pose, frame->world_cloud);
   }
   return true;
 }
@@ -125,6 +142,11 @@ bool PointCloudPreprocessor::Preprocess(
   if (frame->cloud->size() > 0) {
     size_t size = frame->cloud->size();
     size_t i = 0;
+    frame->world_cloud->clear();
+    frame->world_cloud->reserve(size);
+    const Eigen::Matrix4d& ext = options.sensor2novatel_extrinsics.matrix();
+    const Eigen::Affine3d& pose = frame->lidar2world_pose;
+    base::PointD world_point;
     while (i < size) {
       auto& pt = frame->cloud->at(i);
       if (filter_naninf_points_) {
@@ -139,52 +161,39 @@ bool PointCloudPreprocessor::Preprocess(
           continue;
         }
       }
-      Eigen::Vector3d vec3d_lidar(pt.x, pt.y, pt.z);
-      Eigen::Vector3d vec3d_novatel =
-          options.sensor2novatel_extrinsics * vec3d_lidar;
-      if (filter_nearby_box_points_ && vec3d_novatel[0] < box_forward_x_ &&
-          vec3d_novatel[0] > box_backward_x_ &&
-          vec3d_novatel[1] < box_forward_y_ &&
-          vec3d_novatel[1] > box_backward_y_) {
-        frame->cloud->SwapPoint(i, size--);
-        continue;
+      if (filter_nearby_box_points_) {
+        double novatel_x = ext(0, 0) * pt.x + ext(0, 1) * pt.y +
+                           ext(0, 2) * pt.z + ext(0, 3);
+        double novatel_y = ext(1, 0) * pt.x + ext(1, 1) * pt.y +
+                           ext(1, 2) * pt.z + ext(1, 3);
+        if (novatel_x < box_forward_x_ && novatel_x > box_backward_x_ &&
+            novatel_y < box_forward_y_ && novatel_y > box_backward_y_) {
+          frame->cloud->SwapPoint(i, size--);
+          continue;
+        }
       }
       if (filter_high_z_points_ && pt.z > z_threshold_) {
         frame->cloud->SwapPoint(i, size--);
         continue;
       }
+      // the point survives every filter, transform it in the same sweep
+      Eigen::Vector3d trans_point(pt.x, pt.y, pt.z);
+      trans_point = pose * trans_point;
+      world_point.x = trans_point(0);
+      world_point.y = trans_point(1);
+      world_point.z = trans_point(2);
+      world_point.intensity = pt.intensity;
+      frame->world_cloud->push_back(world_point,
+                                    frame->cloud->points_timestamp(i), FLT_MAX,
+                                    frame->cloud->points_beam_id()[i], 0);
       ++i;
     }
     frame->cloud->resize(i);
-    TransformCloud(frame->cloud, frame->lidar2world_pose, frame->world_cloud);
     AINFO << "Preprocessor filter points: " << size << " to " << i;
   }
   return true;
 }
 
-bool PointCloudPreprocessor::TransformCloud(
-    const base::PointFCloudPtr& local_cloud, const Eigen::Affine3d& pose,
-    base::PointDCloudPtr world_cloud) const {
-  if (local_cloud == nullptr) {
-    return false;
-  }
-  world_cloud->clear();
-  world_cloud->reserve(local_cloud->size());
-  for (size_t i = 0; i < local_cloud->size(); ++i) {
-    auto& pt = local_cloud->at(i);
-    Eigen::Vector3d trans_point(pt.x, pt.y, pt.z);
-    trans_point = pose * trans_point;
-    base::PointD world_point;
-    world_point.x = trans_point(0);
-    world_point.y = trans_point(1);
-    world_point.z = trans_point(2);
-    world_point.intensity = pt.intensity;
-    world_cloud->push_back(world_point, local_cloud->points_timestamp(i),
-                           FLT_MAX, local_cloud->points_beam_id()[i], 0);
-  }
-  return true;
-}
-
 }  // namespace lidar
 }  // namespace perception
 }  // namespace apollo
@@ -61,9 +61,6 @@ class PointCloudPreprocessor {
   std::string Name() const { return "PointCloudPreprocessor"; }
 
  private:
-  bool TransformCloud(const base::PointFCloudPtr& local_cloud,
-                      const Eigen::Affine3d& pose,
-                      base::PointDCloudPtr world_cloud) const;
   // params
   bool filter_naninf_points_ = true;
   bool filter_nearby_box_points_ = true;
@@ -16,6 +16,10 @@
 
 #include "modules/perception/lidar/lib/roi_filter/hdmap_roi_filter/bitmap2d.h"
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
 #include "modules/perception/lidar/common/lidar_log.h"
 
 namespace apollo {
@@ -24,6 +28,81 @@ namespace lidar {
 
 static constexpr uint64_t kZeroLast = static_cast<uint64_t>(-1) - 1;
 
+#if defined(__x86_64__) || defined(__i386__)
+namespace {
+
+bool CheckPointsSupportsAvx2() {
+  static const bool support = __builtin_cpu_supports("avx2");
+  return support;
+}
+
+// membership test of 4 points per iteration: the x/y pairs are fetched
+// with SIMD gathers, converted to grid cells with the same double
+// arithmetic as RealToBitmap so the outcome is bit-identical to the
+// scalar path, and the bitmap words of all 4 cells are fetched with a
+// masked gather that never touches memory for out-of-range points;
+// returns the number of points consumed, the caller handles the tail
+__attribute__((target("avx2"))) size_t CheckPointsAvx2(
+    const float* points, const size_t nr_points, const size_t point_step,
+    const double* min_range, const double* max_range, const double* cell_size,
+    const int major, const size_t words_per_line, const uint64_t* bitmap,
+    std::vector<int>* roi_indices) {
+  const int step = static_cast<int>(point_step);
+  const __m128i gather_idx = _mm_set_epi32(3 * step, 2 * step, step, 0);
+  const __m256d min_x = _mm256_set1_pd(min_range[0]);
+  const __m256d min_y = _mm256_set1_pd(min_range[1]);
+  const __m256d max_x = _mm256_set1_pd(max_range[0]);
+  const __m256d max_y = _mm256_set1_pd(max_range[1]);
+  const __m256d cell_x = _mm256_set1_pd(cell_size[0]);
+  const __m256d cell_y = _mm256_set1_pd(cell_size[1]);
+  const __m128i words_vec = _mm_set1_epi32(static_cast<int>(words_per_line));
+  const __m256i bit_mask = _mm256_set1_epi64x(1);
+  size_t i = 0;
+  for (; i + 4 <= nr_points; i += 4) {
+    const float* base = points + i * point_step;
+    const __m128 xs = _mm_i32gather_ps(base, gather_idx, sizeof(float));
+    const __m128 ys = _mm_i32gather_ps(base + 1, gather_idx, sizeof(float));
+    const __m256d xd = _mm256_cvtps_pd(xs);
+    const __m256d yd = _mm256_cvtps_pd(ys);
+    const __m256d in_range = _mm256_and_pd(
+        _mm256_and_pd(_mm256_cmp_pd(xd, min_x, _CMP_GE_OQ),
+                      _mm256_cmp_pd(xd, max_x, _CMP_LT_OQ)),
+        _mm256_and_pd(_mm256_cmp_pd(yd, min_y, _CMP_GE_OQ),
+                      _mm256_cmp_pd(yd, max_y, _CMP_LT_OQ)));
+    if (_mm256_movemask_pd(in_range) == 0) {
+      continue;
+    }
+    const __m128i pix_x = _mm256_cvttpd_epi32(
+        _mm256_div_pd(_mm256_sub_pd(xd, min_x), cell_x));
+    const __m128i pix_y = _mm256_cvttpd_epi32(
+        _mm256_div_pd(_mm256_sub_pd(yd, min_y), cell_y));
+    const __m128i major_pix = major == 0 ? pix_x : pix_y;
+    const __m128i minor_pix = major == 0 ? pix_y : pix_x;
+    const __m128i word_idx = _mm_add_epi32(
+        _mm_mullo_epi32(major_pix, words_vec), _mm_srli_epi32(minor_pix, 6));
+    const __m256i words = _mm256_mask_i32gather_epi64(
+        _mm256_setzero_si256(), reinterpret_cast<const long long*>(bitmap),
+        word_idx, _mm256_castpd_si256(in_range), sizeof(uint64_t));
+    const __m256i shift =
+        _mm256_and_si256(_mm256_cvtepi32_epi64(minor_pix),
+                         _mm256_set1_epi64x(63));
+    const __m256i bits =
+        _mm256_and_si256(_mm256_srlv_epi64(words, shift), bit_mask);
+    const int hit =
+        _mm256_movemask_pd(_mm256_castsi256_pd(
+            _mm256_cmpeq_epi64(bits, bit_mask)));
+    for (int lane = 0; lane < 4; ++lane) {
+      if (hit & (1 << lane)) {
+        roi_indices->push_back(static_cast<int>(i + lane));
+      }
+    }
+  }
+  return i;
+}
+
+}  // namespace
+#endif
+
 // static
 inline Bitmap2D::DirectionMajor Bitmap2D::OppositeDirection(
     const Bitmap2D::DirectionMajor dir_major) {
@@ -117,6 +196,27 @@ bool Bitmap2D::IsExists(const Eigen::Vector2d& p) const {
          p.y() >= min_range_.y() && p.y() < max_range_.y();
 }
 
+// batched check
+void Bitmap2D::CheckPoints(const float* points, const size_t nr_points,
+                           const size_t point_step,
+                           std::vector<int>* roi_indices) const {
+  size_t i = 0;
+#if defined(__x86_64__) || defined(__i386__)
+  if (CheckPointsSupportsAvx2()) {
+    i = CheckPointsAvx2(points, nr_points, point_step, min_range_.data(),
+                        max_range_.data(), cell_size_.data(), dir_major(),
+                        map_size_[1], bitmap_.data(), roi_indices);
+  }
+#endif
+  for (; i < nr_points; ++i) {
+    const Eigen::Vector2d p(points[i * point_step],
+                            points[i * point_step + 1]);
+    if (IsExists(p) && Check(p)) {
+      roi_indices->push_back(static_cast<int>(i));
+    }
+  }
+}
+
 // check
 bool Bitmap2D::Check(const Eigen::Vector2d& p) const {
   const Vec3ui bit_p = RealToBitmap(p);
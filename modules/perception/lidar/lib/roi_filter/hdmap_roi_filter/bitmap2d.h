@@ -59,6 +59,14 @@ class Bitmap2D {
   void Set(const Eigen::Vector2d& p);
   void Reset(const Eigen::Vector2d& p);
 
+  // batched membership test over interleaved x/y point data with
+  // point_step floats per point; appends the indices of points passing
+  // both IsExists() and Check() to roi_indices, result is identical to
+  // the per-point calls
+  void CheckPoints(const float* points, const size_t nr_points,
+                   const size_t point_step,
+                   std::vector<int>* roi_indices) const;
+
   // x for major x, min_y <= valid_y <= max_y
   void Set(const double x, const double min_y, const double max_y);
   void Reset(const double x, const double min_y, const double max_y);
@@ -134,6 +134,7 @@ bool HdmapROIFilter::Filter(const ROIFilterOptions& options,
         std::fill(roi_service_content_.bitmap_.begin(),
                   roi_service_content_.bitmap_.end(), -1);
       }
+      roi_service_content_.SetTimestamp(frame->timestamp);
       roi_service->UpdateServiceContent(roi_service_content_);
     } else {
       AINFO << "Failed to find roi service and cannot update.";
@@ -227,16 +228,13 @@ bool HdmapROIFilter::Bitmap2dFilter(const base::PointFCloudPtr& in_cloud,
   }
   roi_indices->indices.clear();
   roi_indices->indices.reserve(in_cloud->size());
-  for (size_t i = 0; i < in_cloud->size(); ++i) {
-    const auto& pt = in_cloud->at(i);
-    Eigen::Vector2d e_pt(pt.x, pt.y);
-    if (!bitmap.IsExists(e_pt)) {
-      continue;
-    }
-    if (bitmap.Check(e_pt)) {
-      roi_indices->indices.push_back(static_cast<int>(i));
-    }
+  if (in_cloud->empty()) {
+    return true;
   }
+  // batched range check and membership test over the point buffer
+  bitmap.CheckPoints(reinterpret_cast<const float*>(&(in_cloud->front())),
+                     in_cloud->size(), sizeof(base::PointF) / sizeof(float),
+                     &(roi_indices->indices));
   return true;
 }
 
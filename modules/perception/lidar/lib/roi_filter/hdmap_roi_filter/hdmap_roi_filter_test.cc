@@ -84,6 +84,48 @@ TEST(hdmap_roi_filter_bitmap2d_test, test_bitmap) {
   AINFO << bitmap;
 }
 
+//  batched membership test matches the per-point calls
+TEST(hdmap_roi_filter_bitmap2d_test, test_check_points) {
+  Bitmap2D bitmap;
+  Eigen::Vector2d min_range(0.0, 0.0);
+  Eigen::Vector2d max_range(70.0, 70.0);
+  Eigen::Vector2d cell_size(1.0, 1.0);
+  bitmap.Init(min_range, max_range, cell_size);
+  bitmap.SetUp(DirectionMajor::XMAJOR);
+  for (double x = 10.0; x < 40.0; x += 1.0) {
+    bitmap.Set(x, 5.0, 65.0);
+  }
+
+  // interleaved x/y/z/intensity points, some outside the map range
+  const size_t point_step = 4;
+  const size_t nr_points = 1003;
+  std::vector<float> points(nr_points * point_step, 0.f);
+  unsigned int seed = 13;
+  for (size_t i = 0; i < nr_points; ++i) {
+    points[i * point_step] =
+        static_cast<float>(rand_r(&seed) % 9000) * 0.01f - 10.f;
+    points[i * point_step + 1] =
+        static_cast<float>(rand_r(&seed) % 9000) * 0.01f - 10.f;
+  }
+
+  std::vector<int> batch_indices;
+  bitmap.CheckPoints(points.data(), nr_points, point_step, &batch_indices);
+
+  std::vector<int> scalar_indices;
+  for (size_t i = 0; i < nr_points; ++i) {
+    const Eigen::Vector2d p(points[i * point_step],
+                            points[i * point_step + 1]);
+    if (bitmap.IsExists(p) && bitmap.Check(p)) {
+      scalar_indices.push_back(static_cast<int>(i));
+    }
+  }
+  EXPECT_EQ(batch_indices.size(), scalar_indices.size());
+  for (size_t i = 0; i < scalar_indices.size(); ++i) {
+    EXPECT_EQ(batch_indices[i], scalar_indices[i]);
+  }
+  EXPECT_GT(scalar_indices.size(), 0);
+}
+
 // polygon scan test
 TEST(hdmap_roi_filter_bitmap2d_test, test_polygon_scan_cvter) {
   Edge edge;
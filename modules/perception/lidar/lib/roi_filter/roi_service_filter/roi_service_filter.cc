@@ -39,7 +39,10 @@ bool ROIServiceFilter::Filter(const ROIFilterOptions& options,
     AERROR << "Frame is nullptr.";
     return false;
   }
-  roi_service_->GetServiceContentCopy(&roi_service_content_);
+  // the bitmap is heavyweight; refetch it only when a producer
+  // published a new version
+  roi_service_->GetServiceContentCopyIfChanged(&roi_service_content_,
+                                               &content_version_);
   if (!roi_service_content_.IsServiceReady()) {
     AERROR << "service is not ready.";
     return false;
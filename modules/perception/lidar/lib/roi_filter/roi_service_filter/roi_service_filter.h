@@ -39,6 +39,7 @@ class ROIServiceFilter : public BaseROIFilter {
  private:
   ROIServicePtr roi_service_ = nullptr;
   ROIServiceContent roi_service_content_;
+  uint64_t content_version_ = 0;
 };
 
 }  // namespace lidar
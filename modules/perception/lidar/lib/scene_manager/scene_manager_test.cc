@@ -135,6 +135,21 @@ TEST_F(LidarLibSceneManagerTest, lidar_lib_scene_manager_ground_service_test) {
   // test set content
   ground_service->UpdateServiceContent(ground_service_content);
 
+  // test version stamping: each update bumps the version, and a fetch
+  // with the current version does not copy
+  uint64_t last_version = 0;
+  GroundServiceContent versioned_content;
+  EXPECT_TRUE(ground_service->GetServiceContentCopyIfChanged(
+      &versioned_content, &last_version));
+  const uint64_t fetched_version = last_version;
+  EXPECT_GT(fetched_version, 0);
+  EXPECT_FALSE(ground_service->GetServiceContentCopyIfChanged(
+      &versioned_content, &last_version));
+  ground_service->UpdateServiceContent(ground_service_content);
+  EXPECT_TRUE(ground_service->GetServiceContentCopyIfChanged(
+      &versioned_content, &last_version));
+  EXPECT_EQ(last_version, fetched_version + 1);
+
   EXPECT_EQ(ground_service_cast->GetGroundServiceContent()->grid_.size(),
             ground_service_content.grid_.size());
   EXPECT_EQ(ground_service_cast->GetGroundServiceContent()->grid_center_(0),
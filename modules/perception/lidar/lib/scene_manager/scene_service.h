@@ -41,9 +41,24 @@ class SceneServiceContent {
   // @brief: whether service is ready
   // @return: status
   bool IsServiceReady() const { return service_ready_; }
+  // @brief: version stamp, bumped by the owning service on every update,
+  //         lets consumers skip refetching unchanged content
+  // @return: version
+  uint64_t GetVersion() const { return version_; }
+  // @brief: set version stamp
+  // @param [in]: version
+  void SetVersion(uint64_t version) { version_ = version; }
+  // @brief: timestamp of the frame the content was computed from
+  // @return: timestamp
+  double GetTimestamp() const { return timestamp_; }
+  // @brief: set timestamp of the source frame
+  // @param [in]: timestamp
+  void SetTimestamp(double timestamp) { timestamp_ = timestamp; }
 
  protected:
   bool service_ready_ = false;
+  uint64_t version_ = 0;
+  double timestamp_ = 0.0;
 
  private:
   DISALLOW_COPY_AND_ASSIGN(SceneServiceContent);
@@ -74,12 +89,35 @@ class SceneService {
   void GetServiceContentCopy(SceneServiceContent* content) {
     std::lock_guard<std::mutex> lock(mutex_);
     self_content_->GetCopy(content);
+    content->SetVersion(self_content_->GetVersion());
+    content->SetTimestamp(self_content_->GetTimestamp());
   }
-  // @brief: update service content from copy
+  // @brief: get a copy of service content only if its version differs
+  //         from *last_version; on copy, *last_version is updated. Saves
+  //         copying heavyweight content (grids, bitmaps) when no
+  //         producer has published since the last fetch
+  // @param [out]: service content
+  // @param [in/out]: last version seen by the caller
+  // @return: true if content was copied
+  bool GetServiceContentCopyIfChanged(SceneServiceContent* content,
+                                      uint64_t* last_version) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (self_content_->GetVersion() == *last_version) {
+      return false;
+    }
+    self_content_->GetCopy(content);
+    content->SetVersion(self_content_->GetVersion());
+    content->SetTimestamp(self_content_->GetTimestamp());
+    *last_version = self_content_->GetVersion();
+    return true;
+  }
+  // @brief: update service content from copy and bump the version stamp
   // @param [in]: service content
   void UpdateServiceContent(const SceneServiceContent& content) {
     std::lock_guard<std::mutex> lock(mutex_);
     self_content_->SetContent(content);
+    self_content_->SetTimestamp(content.GetTimestamp());
+    self_content_->SetVersion(self_content_->GetVersion() + 1);
   }
 
  protected:
@@ -38,6 +38,14 @@ using base::AttributePointCloud;
 using base::Object;
 using base::PointF;
 
+CNNSegmentation::~CNNSegmentation() {
+#ifndef PERCEPTION_CPU_ONLY
+  if (stream_ != nullptr) {
+    cudaStreamDestroy(stream_);
+  }
+#endif
+}
+
 bool CNNSegmentation::Init(const SegmentationInitOptions& options) {
   // get configs
   std::string param_file;
@@ -85,6 +93,13 @@ bool CNNSegmentation::Init(const SegmentationInitOptions& options) {
   BASE_CUDA_CHECK(cudaSetDevice(gpu_id_));
   inference_->set_gpu_id(gpu_id_);  // inference sets CPU mode when -1
 
+#ifndef PERCEPTION_CPU_ONLY
+  // the legacy default stream serializes every instance in the process;
+  // a per-instance stream lets feature generation of this sensor overlap
+  // with the network forward of the others
+  BASE_CUDA_CHECK(cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking));
+#endif
+
   std::map<std::string, std::vector<int>> input_shapes;
   auto& input_shape = input_shapes[network_param.feature_blob()];
   input_shape = {1, 8, height_, width_};
@@ -121,6 +136,9 @@ bool CNNSegmentation::Init(const SegmentationInitOptions& options) {
   feature_generator_.reset(new FeatureGenerator);
   CHECK(feature_generator_->Init(feature_param, feature_blob_.get()))
       << "Failed to init feature generator.";
+#ifndef PERCEPTION_CPU_ONLY
+  feature_generator_->set_stream(stream_);
+#endif
 
   point2grid_.reserve(kDefaultPointCloudSize);
 
@@ -41,7 +41,7 @@ namespace lidar {
 class CNNSegmentation : public BaseSegmentation {
  public:
   CNNSegmentation() = default;
-  ~CNNSegmentation() = default;
+  ~CNNSegmentation();
 
   bool Init(const SegmentationInitOptions& options =
                 SegmentationInitOptions()) override;
@@ -107,6 +107,12 @@ class CNNSegmentation : public BaseSegmentation {
   std::shared_ptr<base::AttributePointCloud<base::PointD>> roi_world_cloud_;
   int gpu_id_ = -1;
 
+#ifndef PERCEPTION_CPU_ONLY
+  // dedicated stream of this instance, feature generation on it overlaps
+  // with the network forward of the other sensors' instances
+  cudaStream_t stream_ = nullptr;
+#endif
+
   // time statistics
   double mapping_time_ = 0.0;
   double feature_time_ = 0.0;
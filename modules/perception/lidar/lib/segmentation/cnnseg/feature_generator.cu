@@ -162,19 +162,19 @@ void FeatureGenerator::GenerateGPU(const base::PointFCloudPtr& pc_ptr,
   // fill initial value for feature blob
   int map_size = width_ * height_;
   int block_size = (map_size + kGPUThreadSize - 1) / kGPUThreadSize;
-  SetKernel<float><<<block_size, kGPUThreadSize>>>(map_size, -5.f,
+  SetKernel<float><<<block_size, kGPUThreadSize, 0, stream_>>>(map_size, -5.f,
                                                 max_height_data_);
-  BASE_CUDA_CHECK(cudaMemset(mean_height_data_, 0.f,
-                             sizeof(float) * map_size));
-  BASE_CUDA_CHECK(cudaMemset(count_data_, 0.f,
-                             sizeof(float) * map_size));
-  BASE_CUDA_CHECK(cudaMemset(nonempty_data_, 0.f,
-                             sizeof(float) * map_size));
+  BASE_CUDA_CHECK(cudaMemsetAsync(mean_height_data_, 0.f,
+                                  sizeof(float) * map_size, stream_));
+  BASE_CUDA_CHECK(cudaMemsetAsync(count_data_, 0.f,
+                                  sizeof(float) * map_size, stream_));
+  BASE_CUDA_CHECK(cudaMemsetAsync(nonempty_data_, 0.f,
+                                  sizeof(float) * map_size, stream_));
   if (use_intensity_feature_) {
-    BASE_CUDA_CHECK(cudaMemset(top_intensity_data_, 0.f,
-                               sizeof(float) * map_size));
-    BASE_CUDA_CHECK(cudaMemset(mean_intensity_data_, 0.f,
-                               sizeof(float) * map_size));
+    BASE_CUDA_CHECK(cudaMemsetAsync(top_intensity_data_, 0.f,
+                                    sizeof(float) * map_size, stream_));
+    BASE_CUDA_CHECK(cudaMemsetAsync(mean_intensity_data_, 0.f,
+                                    sizeof(float) * map_size, stream_));
   }
 
   // copy cloud data and point2grid from CPU to GPU memory
@@ -190,31 +190,34 @@ void FeatureGenerator::GenerateGPU(const base::PointFCloudPtr& pc_ptr,
     BASE_CUDA_CHECK(cudaMalloc(reinterpret_cast<void **>(&point2grid_gpu_),
                     cloud_size * sizeof(int)));
   }
-  BASE_CUDA_CHECK(cudaMemcpy(pc_gpu_, &(pc_ptr->front()),
+  BASE_CUDA_CHECK(cudaMemcpyAsync(pc_gpu_, &(pc_ptr->front()),
                  sizeof(base::PointF) * cloud_size,
-                 cudaMemcpyHostToDevice));
-  BASE_CUDA_CHECK(cudaMemcpy(point2grid_gpu_, point2grid.data(),
-                 sizeof(int) * cloud_size, cudaMemcpyHostToDevice));
+                 cudaMemcpyHostToDevice, stream_));
+  BASE_CUDA_CHECK(cudaMemcpyAsync(point2grid_gpu_, point2grid.data(),
+                 sizeof(int) * cloud_size, cudaMemcpyHostToDevice, stream_));
 
   // compute features
   // float inv_res_x = 0.5 * width_ / range_;
   // float inv_res_y = 0.5 * height_ / range_;
   {
     int block_size = (cloud_size + kGPUThreadSize - 1) / kGPUThreadSize;
-    MapKernel<float><<<block_size, kGPUThreadSize>>>(cloud_size, pc_gpu_,
-          max_height_data_, mean_height_data_, mean_intensity_data_,
+    MapKernel<float><<<block_size, kGPUThreadSize, 0, stream_>>>(cloud_size,
+          pc_gpu_, max_height_data_, mean_height_data_, mean_intensity_data_,
           count_data_, point2grid_gpu_);
-    TopIntensityKernel<float><<<block_size, kGPUThreadSize>>>(cloud_size,
-          top_intensity_data_, pc_gpu_, max_height_data_,
+    TopIntensityKernel<float><<<block_size, kGPUThreadSize, 0, stream_>>>(
+          cloud_size, top_intensity_data_, pc_gpu_, max_height_data_,
           point2grid_gpu_);
   }
   {
     int block_size = (map_size + kGPUThreadSize - 1) / kGPUThreadSize;
     float* log_table = log_blob_->mutable_gpu_data() + log_blob_->offset(0, 0);
-    AverageKernel<float><<<block_size, kGPUThreadSize>>>(map_size, count_data_,
-          max_height_data_, mean_height_data_, mean_intensity_data_,
-          nonempty_data_, log_table, kMaxLogNum);
+    AverageKernel<float><<<block_size, kGPUThreadSize, 0, stream_>>>(map_size,
+          count_data_, max_height_data_, mean_height_data_,
+          mean_intensity_data_, nonempty_data_, log_table, kMaxLogNum);
   }
+  // features must be visible to the inference engine's own stream before
+  // Infer() is issued, so fence the instance stream here
+  BASE_CUDA_CHECK(cudaStreamSynchronize(stream_));
 }
 
 void FeatureGenerator::ReleaseGPUMemory() {
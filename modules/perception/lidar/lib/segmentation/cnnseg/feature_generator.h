@@ -61,6 +61,14 @@ class FeatureGenerator {
 
   inline std::string Name() const { return "FeatureGenerator"; }
 
+#ifndef PERCEPTION_CPU_ONLY
+  // @brief: issue feature generation on a dedicated stream, so instances
+  //         of different sensors stop serializing on the legacy default
+  //         stream; GenerateGPU still synchronizes the stream before
+  //         returning
+  void set_stream(const cudaStream_t& stream) { stream_ = stream; }
+#endif
+
  private:
 #ifndef PERCEPTION_CPU_ONLY
   void GenerateGPU(const base::PointFCloudPtr& pc_ptr,
@@ -114,6 +122,9 @@ class FeatureGenerator {
   int pc_gpu_size_ = 0;
   const int kMaxPointCloudGPUSize = 120000;
   const int kGPUThreadSize = 512;
+#ifndef PERCEPTION_CPU_ONLY
+  cudaStream_t stream_ = nullptr;
+#endif
 
   // for TEST only
   FRIEND_TEST(FeatureGeneratorTest, basic_test);
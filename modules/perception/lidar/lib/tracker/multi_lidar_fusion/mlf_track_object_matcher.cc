@@ -16,6 +16,11 @@
 
 #include "modules/perception/lidar/lib/tracker/multi_lidar_fusion/mlf_track_object_matcher.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <numeric>
+
 #include "cyber/common/file.h"
 #include "modules/perception/lib/config_manager/config_manager.h"
 #include "modules/perception/lidar/lib/tracker/multi_lidar_fusion/proto/multi_lidar_fusion_config.pb.h"
@@ -58,6 +63,10 @@ bool MlfTrackObjectMatcher::Init(
 
   bound_value_ = config.bound_value();
   max_match_distance_ = config.max_match_distance();
+  // conservative foreground gate: with the default 0.6 location weight
+  // the location term alone exceeds max_match_distance_ well inside
+  // this radius, so gated-out pairs could never be assigned anyway
+  gate_distance_ = 3.f * max_match_distance_;
   return true;
 }
 
@@ -105,12 +114,92 @@ void MlfTrackObjectMatcher::ComputeAssociateMatrix(
     const std::vector<MlfTrackDataPtr> &tracks,
     const std::vector<TrackedObjectPtr> &new_objects,
     common::SecureMat<float> *association_mat) {
+  // background costs carry no location term and small problems are
+  // cheaper dense, so only foreground pairs beyond this size are gated
+  static const size_t kMinSizeToGate = 32;
+  bool gated = !new_objects[0]->is_background &&
+               tracks.size() >= kMinSizeToGate &&
+               new_objects.size() >= kMinSizeToGate &&
+               BuildGatingIndex(
+                   tracks, new_objects[0]->object_ptr->latest_tracked_time);
+  if (!gated) {
+    for (size_t i = 0; i < tracks.size(); ++i) {
+      for (size_t j = 0; j < new_objects.size(); ++j) {
+        (*association_mat)(i, j) =
+            track_object_distance_->ComputeDistance(new_objects[j], tracks[i]);
+      }
+    }
+    return;
+  }
   for (size_t i = 0; i < tracks.size(); ++i) {
     for (size_t j = 0; j < new_objects.size(); ++j) {
-      (*association_mat)(i, j) =
-          track_object_distance_->ComputeDistance(new_objects[j], tracks[i]);
+      (*association_mat)(i, j) = bound_value_;
     }
   }
+  // each detection only scores tracks in the 3x3 cell neighborhood,
+  // which covers every track within gate_distance_
+  for (size_t j = 0; j < new_objects.size(); ++j) {
+    const auto &anchor = new_objects[j]->anchor_point;
+    int cx = static_cast<int>(std::floor(
+        (static_cast<float>(anchor(0)) - gating_min_p_(0)) / gate_distance_));
+    int cy = static_cast<int>(std::floor(
+        (static_cast<float>(anchor(1)) - gating_min_p_(1)) / gate_distance_));
+    int rmin = std::max(cx - 1, 0);
+    int rmax = std::min(cx + 1, gating_rows_ - 1);
+    int cmin = std::max(cy - 1, 0);
+    int cmax = std::min(cy + 1, gating_cols_ - 1);
+    for (int gx = rmin; gx <= rmax; ++gx) {
+      for (int gy = cmin; gy <= cmax; ++gy) {
+        for (int t = gating_grid_head_[gx * gating_cols_ + gy]; t >= 0;
+             t = gating_grid_next_[t]) {
+          (*association_mat)(t, j) =
+              track_object_distance_->ComputeDistance(new_objects[j],
+                                                      tracks[t]);
+        }
+      }
+    }
+  }
+}
+
+bool MlfTrackObjectMatcher::BuildGatingIndex(
+    const std::vector<MlfTrackDataPtr> &tracks, double timestamp) {
+  // cap the grid so degenerate track spreads fall back to dense scoring
+  static const int kMaxGatingCells = 1 << 16;
+  gating_centers_.resize(tracks.size());
+  Eigen::Vector2f min_p(FLT_MAX, FLT_MAX);
+  Eigen::Vector2f max_p(-FLT_MAX, -FLT_MAX);
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    tracks[i]->PredictState(timestamp);
+    if (tracks[i]->predict_.state.size() < 6) {
+      return false;
+    }
+    gating_centers_[i] = tracks[i]->predict_.state.head(2);
+    min_p = min_p.cwiseMin(gating_centers_[i]);
+    max_p = max_p.cwiseMax(gating_centers_[i]);
+  }
+  gating_min_p_ = min_p;
+  gating_rows_ =
+      static_cast<int>((max_p(0) - min_p(0)) / gate_distance_) + 1;
+  gating_cols_ =
+      static_cast<int>((max_p(1) - min_p(1)) / gate_distance_) + 1;
+  if (gating_rows_ <= 0 || gating_cols_ <= 0 ||
+      gating_rows_ * gating_cols_ > kMaxGatingCells) {
+    return false;
+  }
+  gating_grid_head_.assign(gating_rows_ * gating_cols_, -1);
+  gating_grid_next_.resize(tracks.size());
+  for (size_t i = 0; i < tracks.size(); ++i) {
+    int cx = std::min(
+        static_cast<int>((gating_centers_[i](0) - min_p(0)) / gate_distance_),
+        gating_rows_ - 1);
+    int cy = std::min(
+        static_cast<int>((gating_centers_[i](1) - min_p(1)) / gate_distance_),
+        gating_cols_ - 1);
+    const int idx = cx * gating_cols_ + cy;
+    gating_grid_next_[i] = gating_grid_head_[idx];
+    gating_grid_head_[idx] = static_cast<int>(i);
+  }
+  return true;
 }
 
 }  // namespace lidar
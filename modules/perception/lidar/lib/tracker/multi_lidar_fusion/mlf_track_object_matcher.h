@@ -65,6 +65,15 @@ class MlfTrackObjectMatcher {
                               const std::vector<TrackedObjectPtr> &new_objects,
                               common::SecureMat<float> *association_mat);
 
+  // @brief: build the uniform grid over track predicted centers used to
+  //         gate foreground association, cell size is gate_distance_
+  // @params [in]: maintained tracks for matching
+  // @params [in]: timestamp the track states are predicted to
+  // @params [out]: false when gating is not applicable, e.g. tracks
+  //                without history or a degenerate grid
+  bool BuildGatingIndex(const std::vector<MlfTrackDataPtr> &tracks,
+                        double timestamp);
+
  protected:
   std::unique_ptr<MlfTrackObjectDistance> track_object_distance_;
   std::unique_ptr<BaseBipartiteGraphMatcher> foreground_matcher_;
@@ -73,6 +82,17 @@ class MlfTrackObjectMatcher {
   float bound_value_ = 100.f;
   float max_match_distance_ = 4.0f;
 
+  // spatial gating of foreground association: tracks farther than
+  // gate_distance_ from a detection get bound_value_ without scoring;
+  // the index buffers are reused across frames
+  float gate_distance_ = 12.f;
+  std::vector<Eigen::Vector2f> gating_centers_;
+  std::vector<int> gating_grid_head_;
+  std::vector<int> gating_grid_next_;
+  Eigen::Vector2f gating_min_p_;
+  int gating_rows_ = 0;
+  int gating_cols_ = 0;
+
  private:
   DISALLOW_COPY_AND_ASSIGN(MlfTrackObjectMatcher);
 };  // class MlfTrackObjectMatcher
@@ -0,0 +1,135 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "modules/perception/base/object.h"
+#include "modules/perception/lidar/lib/tracker/association/gnn_bipartite_graph_matcher.h"
+#include "modules/perception/lidar/lib/tracker/association/multi_hm_bipartite_graph_matcher.h"
+#include "modules/perception/lidar/lib/tracker/common/mlf_track_data.h"
+#include "modules/perception/lidar/lib/tracker/common/tracked_object.h"
+#include "modules/perception/lidar/lib/tracker/multi_lidar_fusion/mlf_track_object_matcher.h"
+
+namespace apollo {
+namespace perception {
+namespace lidar {
+
+// wires the matcher members directly so the benchmark runs from a bare
+// checkout without the config-driven Init()
+class AssociationBenchmarkMatcher : public MlfTrackObjectMatcher {
+ public:
+  AssociationBenchmarkMatcher() {
+    track_object_distance_.reset(new MlfTrackObjectDistance);
+    foreground_matcher_.reset(new GnnBipartiteGraphMatcher);
+    background_matcher_.reset(new MultiHmBipartiteGraphMatcher);
+    foreground_matcher_->cost_matrix()->Reserve(1000, 1000);
+    background_matcher_->cost_matrix()->Reserve(1000, 1000);
+  }
+  void set_gate_distance(float gate_distance) {
+    gate_distance_ = gate_distance;
+  }
+};
+
+TrackedObjectPtr MakeTrackedObject(double x, double y, double timestamp) {
+  TrackedObjectPtr object(new TrackedObject);
+  object->object_ptr.reset(new base::Object);
+  object->object_ptr->latest_tracked_time = timestamp;
+  base::PointD point;
+  point.x = x;
+  point.y = y;
+  object->object_ptr->lidar_supplement.cloud_world.push_back(point);
+  object->sensor_info.name = "velodyne64";
+  object->is_background = false;
+  object->anchor_point = Eigen::Vector3d(x, y, 0.0);
+  object->belief_anchor_point = object->anchor_point;
+  object->barycenter = object->anchor_point;
+  object->output_velocity = Eigen::Vector3d::Zero();
+  object->direction = Eigen::Vector3d(1.0, 0.0, 0.0);
+  object->output_direction = object->direction;
+  object->size = Eigen::Vector3d(4.0, 2.0, 1.5);
+  object->output_size = object->size;
+  object->center = object->anchor_point;
+  object->output_center = object->center;
+  return object;
+}
+
+void RunScale(size_t nr_tracks, size_t nr_rounds) {
+  const double kTrackTime = 0.0;
+  const double kFrameTime = 0.1;
+  const double kRange = 200.0;
+  unsigned int seed = static_cast<unsigned int>(nr_tracks);
+
+  std::vector<MlfTrackDataPtr> tracks(nr_tracks);
+  std::vector<TrackedObjectPtr> objects(nr_tracks);
+  for (size_t i = 0; i < nr_tracks; ++i) {
+    double x = (rand_r(&seed) % 20000) * 0.01 * kRange / 200.0 - kRange / 2;
+    double y = (rand_r(&seed) % 20000) * 0.01 * kRange / 200.0 - kRange / 2;
+    tracks[i].reset(new MlfTrackData);
+    tracks[i]->history_objects_.emplace(
+        kTrackTime, MakeTrackedObject(x, y, kTrackTime));
+    tracks[i]->age_ = 1;
+    tracks[i]->latest_visible_time_ = kTrackTime;
+    // detections near the predicted track positions plus some noise
+    double nx = x + (rand_r(&seed) % 100) * 0.01 - 0.5;
+    double ny = y + (rand_r(&seed) % 100) * 0.01 - 0.5;
+    objects[i] = MakeTrackedObject(nx, ny, kFrameTime);
+  }
+
+  MlfTrackObjectMatcherOptions options;
+  std::vector<std::pair<size_t, size_t>> assignments;
+  std::vector<size_t> unassigned_tracks;
+  std::vector<size_t> unassigned_objects;
+
+  // a 1x1 gating grid degenerates to the dense all-pairs scoring and
+  // serves as the baseline
+  const float gate_distances[] = {1e6f, 12.f};
+  const char* labels[] = {"dense", "gated"};
+  for (int mode = 0; mode < 2; ++mode) {
+    AssociationBenchmarkMatcher matcher;
+    matcher.set_gate_distance(gate_distances[mode]);
+    size_t nr_assignments = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < nr_rounds; ++round) {
+      matcher.Match(options, objects, tracks, &assignments,
+                    &unassigned_tracks, &unassigned_objects);
+      nr_assignments = assignments.size();
+    }
+    auto stop = std::chrono::steady_clock::now();
+    double ms_per_match =
+        std::chrono::duration_cast<std::chrono::microseconds>(stop - start)
+            .count() *
+        0.001 / static_cast<double>(nr_rounds);
+    std::cout << "tracks: " << nr_tracks << " mode: " << labels[mode]
+              << " match: " << ms_per_match
+              << " ms, assignments: " << nr_assignments << std::endl;
+  }
+}
+
+}  // namespace lidar
+}  // namespace perception
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  const size_t nr_rounds = 20;
+  apollo::perception::lidar::RunScale(100, nr_rounds);
+  apollo::perception::lidar::RunScale(200, nr_rounds);
+  apollo::perception::lidar::RunScale(400, nr_rounds);
+  return 0;
+}
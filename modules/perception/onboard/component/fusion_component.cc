@@ -15,6 +15,8 @@
  *****************************************************************************/
 #include "modules/perception/onboard/component/fusion_component.h"
 
+#include <utility>
+
 #include "modules/common/time/time.h"
 #include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/lib/utils/perf.h"
@@ -170,7 +172,8 @@ bool FusionComponent::InternalProc(
     viz_message->hdmap_ = in_message->hdmap_;
     viz_message->process_stage_ = ProcessStage::SENSOR_FUSION;
     viz_message->error_code_ = in_message->error_code_;
-    viz_message->frame_->objects = fused_objects;
+    // last use of fused_objects, hand them to the viz frame without a copy
+    viz_message->frame_->objects = std::move(fused_objects);
   }
   // produce pb output msg
   apollo::common::ErrorCode error_code = apollo::common::ErrorCode::OK;
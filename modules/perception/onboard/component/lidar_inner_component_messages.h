@@ -27,6 +27,11 @@ namespace apollo {
 namespace perception {
 namespace onboard {
 
+// Rides cyber's intra-process path like the messages in
+// inner_component_messages.h: readers in the same process get the writer's
+// shared_ptr without a copy. The segmentation output channel has a single
+// consumer (the recognition component), which therefore owns the lidar frame
+// after delivery and may move its contents onward.
 class LidarFrameMessage {
  public:
   LidarFrameMessage() : lidar_frame_(nullptr) {
@@ -14,6 +14,9 @@
  * limitations under the License.
  *****************************************************************************/
 #include "modules/perception/onboard/component/recognition_component.h"
+
+#include <utility>
+
 #include "modules/common/time/time.h"
 #include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/common/sensor_manager/sensor_manager.h"
@@ -112,7 +115,10 @@ bool RecognitionComponent::InternalProc(
   frame = base::FramePool::Instance().Get();
   frame->sensor_info = lidar_frame->sensor_info;
   frame->timestamp = in_message->timestamp_;
-  frame->objects = lidar_frame->tracked_objects;
+  // this component is the only consumer of the segmentation channel, so the
+  // tracked objects can be moved instead of copied, and the cloud is handed
+  // on by pointer; the points are never duplicated between stages
+  frame->objects = std::move(lidar_frame->tracked_objects);
   frame->sensor2world_pose = lidar_frame->lidar2world_pose;
   frame->lidar_frame_supplement.on_use = true;
   frame->lidar_frame_supplement.cloud_ptr = lidar_frame->cloud;
@@ -29,6 +29,7 @@
 #include "modules/common/math/math_utils.h"
 #include "modules/common/time/time.h"
 #include "modules/common/time/time_util.h"
+#include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/camera/common/data_provider.h"
 #include "modules/perception/common/sensor_manager/sensor_manager.h"
 #include "modules/perception/lib/utils/perf.h"
@@ -469,9 +470,11 @@ void TrafficLightsPerceptionComponent::GenerateTrafficLights(
     const std::vector<apollo::hdmap::Signal>& signals,
     std::vector<base::TrafficLightPtr>* traffic_lights) {
   traffic_lights->clear();
+  // one batched pool acquisition instead of a heap allocation per signal
+  base::TrafficLightPool::Instance().BatchGet(signals.size(), traffic_lights);
+  size_t light_index = 0;
   for (auto signal : signals) {
-    base::TrafficLightPtr light;
-    light.reset(new base::TrafficLight);
+    base::TrafficLightPtr light = traffic_lights->at(light_index++);
     light->id = signal.id().id();
     for (int i = 0; i < signal.boundary().point_size(); ++i) {
       base::PointXYZID point;
@@ -486,7 +489,6 @@ void TrafficLightsPerceptionComponent::GenerateTrafficLights(
     //   cur_semantic |= 1 << signal.control_direction(i);
     // }
     light->semantic = cur_semantic;
-    traffic_lights->push_back(light);
     stoplines_ = signal.stop_line();
   }
 }
@@ -511,6 +513,18 @@ bool TrafficLightsPerceptionComponent::QueryPoseAndSignals(
   }
   // get signals
   Eigen::Vector3d car_position = pose->getCarPosition();
+  // the signal set only changes with the query position, so while the
+  // car stays close to the last successful query the cached result is
+  // still valid and the hdmap lookup can be skipped
+  static constexpr double kSignalQueryReuseDistance = 2.0;  // meters
+  if (last_signals_ts_ > 0.0 && ts - last_signals_ts_ < valid_hdmap_interval_ &&
+      (car_position - last_signals_position_).norm() <
+          kSignalQueryReuseDistance) {
+    *signals = last_signals_;
+    ADEBUG << "query_pose_and_signals reused cached signals, ts: " << ts
+           << " signals.size(): " << signals->size();
+    return true;
+  }
   if (!hd_map_->GetSignals(car_position, forward_distance_to_query_signals,
                            signals)) {
     if (ts - last_signals_ts_ < valid_hdmap_interval_) {
@@ -528,6 +542,7 @@ bool TrafficLightsPerceptionComponent::QueryPoseAndSignals(
     // here need mutex lock_guard, added at the beginning of OnReceiveImage()
     last_signals_ts_ = ts;
     last_signals_ = *signals;
+    last_signals_position_ = car_position;
   }
   return true;
 }
@@ -152,6 +152,9 @@ class TrafficLightsPerceptionComponent : public apollo::cyber::Component<> {
   double valid_hdmap_interval_ = 1.5;
   double forward_distance_to_query_signals = 150.0;
   std::vector<apollo::hdmap::Signal> last_signals_;
+  // position of the last successful signals query; queries from nearby
+  // positions reuse last_signals_ instead of hitting the hdmap again
+  Eigen::Vector3d last_signals_position_;
 
   // image info.
   int image_width_ = 1920;
@@ -20,6 +20,7 @@
 #include "cyber/cyber.h"
 #include "modules/perception/base/frame.h"
 #include "modules/perception/base/hdmap_struct.h"
+#include "modules/perception/base/object_pool_types.h"
 #include "modules/perception/base/impending_collision_edge.h"
 #include "modules/perception/proto/perception_obstacle.pb.h"
 
@@ -46,6 +47,15 @@ class Descriptor {
   std::string full_name() { return "name"; }
 };
 
+// The inner perception messages implement only the minimal interface cyber
+// needs to route a raw C++ type (GetTypeName/New); they deliberately provide
+// no serialization, so the channels carrying them stay on cyber's
+// intra-process path, where every same-process reader receives the writer's
+// shared_ptr as-is and a frame crosses a hop without any copy.
+// Two rules follow from sharing one instance among readers:
+// 1. a message must not be mutated after Write();
+// 2. a reader may take over heavy members move-style only on channels with a
+//    single consumer in the dag.
 class SensorFrameMessage {
  public:
   SensorFrameMessage() { type_name_ = "SensorFrameMessage"; }
@@ -65,6 +75,11 @@ class SensorFrameMessage {
 
   base::FramePtr frame_;
 
+  // frame-local arena the producing pipeline draws frame_->objects from;
+  // carried with the message so downstream stages of the same pipeline
+  // can keep allocating without touching the shared object pool
+  base::ObjectArenaPtr arena_;
+
   ProcessStage process_stage_ = ProcessStage::UNKNOWN_STAGE;
 };
 
@@ -17,6 +17,8 @@
 
 #include <memory>
 
+#include "modules/perception/base/object_pool_types.h"
+
 namespace apollo {
 namespace perception {
 namespace radar {
@@ -52,28 +54,45 @@ void ContiArsDetector::RawObs2Frame(
   ADEBUG << "radar2novatel: " << radar2novatel;
   ADEBUG << "angular_speed: " << angular_speed;
   ADEBUG << "rotation_radar: " << rotation_radar;
-  for (const auto radar_obs : corrected_obstacles.contiobs()) {
-    base::ObjectPtr radar_object = std::make_shared<base::Object>();
+
+  const int obs_num = corrected_obstacles.contiobs_size();
+  if (obs_num <= 0) {
+    return;
+  }
+
+  // Gather the detections into column-major scratch arrays and apply the
+  // sensor-to-world transforms as single matrix products over the whole
+  // frame, with the angular compensation term folded into the velocity
+  // product.
+  if (local_locs_.cols() < obs_num) {
+    local_locs_.resize(4, obs_num);
+    local_vels_.resize(3, obs_num);
+    world_locs_.resize(4, obs_num);
+    world_vels_.resize(3, obs_num);
+  }
+  for (int i = 0; i < obs_num; ++i) {
+    const auto& radar_obs = corrected_obstacles.contiobs(i);
+    local_locs_.col(i) << radar_obs.longitude_dist(), radar_obs.lateral_dist(),
+        0, 1;
+    local_vels_.col(i) << radar_obs.longitude_vel(), radar_obs.lateral_vel(),
+        0;
+  }
+  world_locs_.leftCols(obs_num) = radar2world * local_locs_.leftCols(obs_num);
+  world_vels_.leftCols(obs_num) =
+      radar2world_rotate *
+      (local_vels_.leftCols(obs_num) +
+       rotation_radar * local_locs_.topLeftCorner(3, obs_num));
+
+  for (int i = 0; i < obs_num; ++i) {
+    const auto& radar_obs = corrected_obstacles.contiobs(i);
+    base::ObjectPtr radar_object = base::ObjectPool::Instance().Get();
     radar_object->id = radar_obs.obstacle_id();
     radar_object->track_id = radar_obs.obstacle_id();
-    Eigen::Vector4d local_loc(radar_obs.longitude_dist(),
-                              radar_obs.lateral_dist(), 0, 1);
-    Eigen::Vector4d world_loc =
-        static_cast<Eigen::Matrix<double, 4, 1, 0, 4, 1>>(radar2world *
-                                                          local_loc);
-    radar_object->center = world_loc.block<3, 1>(0, 0);
+    radar_object->center = world_locs_.col(i).head(3);
     radar_object->anchor_point = radar_object->center;
 
-    Eigen::Vector3d local_vel(radar_obs.longitude_vel(),
-                              radar_obs.lateral_vel(), 0);
-
-    Eigen::Vector3d angular_trans_speed =
-        rotation_radar * local_loc.topLeftCorner(3, 1);
-    Eigen::Vector3d world_vel =
-        static_cast<Eigen::Matrix<double, 3, 1, 0, 3, 1>>(
-            radar2world_rotate * (local_vel + angular_trans_speed));
     Eigen::Vector3d vel_temp =
-        world_vel + options.car_linear_speed.cast<double>();
+        world_vels_.col(i) + options.car_linear_speed.cast<double>();
     radar_object->velocity = vel_temp.cast<float>();
 
     Eigen::Matrix3d dist_rms;
@@ -146,9 +165,9 @@ void ContiArsDetector::RawObs2Frame(
     }
     MockRadarPolygon(radar_object);
 
-    float local_range = static_cast<float>(local_loc.head(2).norm());
-    float local_angle =
-        static_cast<float>(std::atan2(local_loc(1), local_loc(0)));
+    float local_range = static_cast<float>(local_locs_.col(i).head(2).norm());
+    float local_angle = static_cast<float>(
+        std::atan2(local_locs_(1, i), local_locs_(0, i)));
     radar_object->radar_supplement.range = local_range;
     radar_object->radar_supplement.angle = local_angle;
 
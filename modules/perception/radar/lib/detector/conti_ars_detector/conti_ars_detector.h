@@ -17,6 +17,7 @@
 
 #include <string>
 
+#include "Eigen/Core"
 #include "cyber/common/macros.h"
 
 #include "modules/perception/radar/common/radar_util.h"
@@ -43,6 +44,13 @@ class ContiArsDetector : public BaseDetector {
   void RawObs2Frame(const drivers::ContiRadar& corrected_obstacles,
                     const DetectorOptions& options, base::FramePtr radar_frame);
 
+  // Column-major scratch arrays for the batched sensor-to-world transforms.
+  // They only ever grow, so steady radar cycles reuse the same storage.
+  Eigen::Matrix<double, 4, Eigen::Dynamic> local_locs_;
+  Eigen::Matrix<double, 3, Eigen::Dynamic> local_vels_;
+  Eigen::Matrix<double, 4, Eigen::Dynamic> world_locs_;
+  Eigen::Matrix<double, 3, Eigen::Dynamic> world_vels_;
+
   DISALLOW_COPY_AND_ASSIGN(ContiArsDetector);
 };
 
@@ -0,0 +1,239 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+// Headless record-replay benchmark for the lidar perception pipeline.
+//
+// Recorded frames (pcd + pose files, same layout as
+// offline_lidar_obstacle_perception) are pushed through the
+// segmentation and tracking apps by direct library calls - no cyber
+// transport involved - while per-stage latencies are sampled. The
+// report carries latency percentiles and peak RSS, and can be diffed
+// against a golden baseline so optimization work is validated on
+// recorded drives in CI-like fashion.
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "gflags/gflags.h"
+#include "pcl/io/pcd_io.h"
+#include "pcl/kdtree/impl/kdtree_flann.hpp"
+#include "pcl/kdtree/kdtree.h"
+#include "pcl/kdtree/kdtree_flann.h"
+
+#include "cyber/common/file.h"
+#include "modules/perception/common/io/io_util.h"
+#include "modules/perception/common/perception_gflags.h"
+#include "modules/perception/common/sensor_manager/sensor_manager.h"
+#include "modules/perception/lib/config_manager/config_manager.h"
+#include "modules/perception/lidar/app/lidar_obstacle_segmentation.h"
+#include "modules/perception/lidar/app/lidar_obstacle_tracking.h"
+#include "modules/perception/lidar/common/lidar_frame.h"
+#include "modules/perception/lidar/common/lidar_frame_pool.h"
+#include "modules/perception/lidar/common/lidar_log.h"
+#include "modules/perception/lidar/common/pcl_util.h"
+#include "modules/perception/tool/benchmark/perf/stage_metrics.h"
+
+DEFINE_string(pcd_path, "./pcd/", "pcd path");
+DEFINE_string(pose_path, "", "pose path");
+DEFINE_string(sensor_name, "velodyne64", "sensor name");
+DEFINE_bool(use_hdmap, false, "option to enable using hdmap");
+DEFINE_bool(enable_tracking, true, "option to enable tracking");
+DEFINE_int32(warmup_frames, 5,
+             "frames excluded from the statistics while caches and pools "
+             "warm up");
+DEFINE_string(baseline, "", "golden baseline file to diff against");
+DEFINE_string(save_baseline, "", "write the measured numbers as baseline");
+DEFINE_double(tolerance_percent, 10.0,
+              "allowed p99 increase over the baseline before a stage is "
+              "reported as regression");
+
+namespace apollo {
+namespace perception {
+namespace lidar {
+
+using cyber::common::GetFileName;
+
+class LidarPerfBenchmark {
+ public:
+  LidarPerfBenchmark() = default;
+  ~LidarPerfBenchmark() = default;
+
+  bool Setup() {
+    FLAGS_config_manager_path = "./conf";
+    if (!lib::ConfigManager::Instance()->Init()) {
+      AERROR << "Failed to init ConfigManager.";
+      return false;
+    }
+    lidar_segmentation_.reset(new LidarObstacleSegmentation);
+    segment_init_options_.enable_hdmap_input = FLAGS_use_hdmap;
+    segment_init_options_.sensor_name = FLAGS_sensor_name;
+    if (!lidar_segmentation_->Init(segment_init_options_)) {
+      AERROR << "Failed to init LidarObstacleSegmentation.";
+      return false;
+    }
+    lidar_tracking_.reset(new LidarObstacleTracking);
+    tracking_init_options_.sensor_name = FLAGS_sensor_name;
+    if (!lidar_tracking_->Init(tracking_init_options_)) {
+      AERROR << "Failed to init LidarObstacleTracking.";
+      return false;
+    }
+    if (!common::SensorManager::Instance()->GetSensorInfo(FLAGS_sensor_name,
+                                                          &sensor_info_)) {
+      AERROR << "Failed to get sensor info: " << FLAGS_sensor_name;
+      return false;
+    }
+    return true;
+  }
+
+  bool Run(benchmark::BenchmarkMetrics* metrics) {
+    std::vector<std::string> pcd_file_names;
+    if (!common::GetFileList(FLAGS_pcd_path, ".pcd", &pcd_file_names)) {
+      AERROR << "pcd_path: " << FLAGS_pcd_path << " get file list error.";
+      return false;
+    }
+    std::sort(pcd_file_names.begin(), pcd_file_names.end(),
+              [](const std::string& lhs, const std::string& rhs) {
+                if (lhs.length() != rhs.length()) {
+                  return lhs.length() < rhs.length();
+                }
+                return lhs <= rhs;
+              });
+    benchmark::StageMetrics* segment_metrics = metrics->Stage("segmentation");
+    benchmark::StageMetrics* tracking_metrics = metrics->Stage("tracking");
+    benchmark::StageMetrics* frame_metrics = metrics->Stage("end_to_end");
+    for (size_t i = 0; i < pcd_file_names.size(); ++i) {
+      const std::string file_name = GetFileName(pcd_file_names[i]);
+      frame_ = LidarFramePool::Instance().Get();
+      frame_->sensor_info = sensor_info_;
+      frame_->reserve = file_name;
+      if (frame_->cloud == nullptr) {
+        frame_->cloud = base::PointFCloudPool::Instance().Get();
+      }
+      LoadPCLPCD(FLAGS_pcd_path + "/" + file_name + ".pcd",
+                 frame_->cloud.get());
+      bool has_pose = LoadPose(file_name);
+      const bool record = static_cast<int>(i) >= FLAGS_warmup_frames;
+
+      auto frame_start = std::chrono::steady_clock::now();
+      LidarProcessResult segment_result =
+          lidar_segmentation_->Process(segment_options_, frame_.get());
+      auto segment_end = std::chrono::steady_clock::now();
+      if (segment_result.error_code != LidarErrorCode::Succeed) {
+        AERROR << segment_result.log;
+        return false;
+      }
+      if (record) {
+        segment_metrics->AddSampleMs(ElapsedMs(frame_start, segment_end));
+      }
+
+      if (FLAGS_enable_tracking && has_pose) {
+        auto tracking_start = std::chrono::steady_clock::now();
+        LidarProcessResult tracking_result =
+            lidar_tracking_->Process(tracking_options_, frame_.get());
+        auto tracking_end = std::chrono::steady_clock::now();
+        if (tracking_result.error_code != LidarErrorCode::Succeed) {
+          AERROR << tracking_result.log;
+          return false;
+        }
+        if (record) {
+          tracking_metrics->AddSampleMs(ElapsedMs(tracking_start,
+                                                  tracking_end));
+        }
+      }
+      if (record) {
+        frame_metrics->AddSampleMs(
+            ElapsedMs(frame_start, std::chrono::steady_clock::now()));
+      }
+    }
+    return true;
+  }
+
+ private:
+  bool LoadPose(const std::string& file_name) {
+    if (FLAGS_pose_path.empty()) {
+      return false;
+    }
+    std::string pose_file_name =
+        FLAGS_pose_path + "/" + file_name + ".pose";
+    if (!apollo::cyber::common::PathExists(pose_file_name)) {
+      pose_file_name = FLAGS_pose_path + "/" + file_name + ".pcd.pose";
+    }
+    int frame_id = 0;
+    double timestamp = 0.0;
+    if (!common::ReadPoseFile(pose_file_name, &frame_->lidar2world_pose,
+                              &frame_id, &timestamp)) {
+      return false;
+    }
+    frame_->timestamp = timestamp;
+    return true;
+  }
+
+  static double ElapsedMs(const std::chrono::steady_clock::time_point& start,
+                          const std::chrono::steady_clock::time_point& end) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+               .count() *
+           1e-6;
+  }
+
+  std::unique_ptr<LidarObstacleSegmentation> lidar_segmentation_;
+  std::unique_ptr<LidarObstacleTracking> lidar_tracking_;
+  LidarObstacleSegmentationInitOptions segment_init_options_;
+  LidarObstacleSegmentationOptions segment_options_;
+  LidarObstacleTrackingInitOptions tracking_init_options_;
+  LidarObstacleTrackingOptions tracking_options_;
+  base::SensorInfo sensor_info_;
+  std::shared_ptr<LidarFrame> frame_;
+};  // class LidarPerfBenchmark
+
+}  // namespace lidar
+}  // namespace perception
+}  // namespace apollo
+
+int main(int argc, char** argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+  apollo::perception::lidar::LidarPerfBenchmark benchmark;
+  if (!benchmark.Setup()) {
+    return 1;
+  }
+  apollo::perception::benchmark::BenchmarkMetrics metrics;
+  if (!benchmark.Run(&metrics)) {
+    return 1;
+  }
+
+  std::cout << metrics.FormatReport();
+
+  if (!FLAGS_save_baseline.empty() &&
+      !metrics.SaveBaseline(FLAGS_save_baseline)) {
+    std::cerr << "Failed to save baseline: " << FLAGS_save_baseline
+              << std::endl;
+    return 1;
+  }
+  if (!FLAGS_baseline.empty()) {
+    std::string diff_report;
+    bool passed = metrics.DiffAgainstBaseline(
+        FLAGS_baseline, FLAGS_tolerance_percent, &diff_report);
+    std::cout << diff_report;
+    if (!passed) {
+      return 1;
+    }
+  }
+  return 0;
+}
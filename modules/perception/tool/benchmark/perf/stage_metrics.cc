@@ -0,0 +1,156 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/tool/benchmark/perf/stage_metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace apollo {
+namespace perception {
+namespace benchmark {
+
+void StageMetrics::AddSampleMs(double ms) {
+  samples_.push_back(ms);
+  sorted_ = false;
+}
+
+double StageMetrics::Percentile(double fraction) const {
+  if (samples_.empty()) {
+    return 0.0;
+  }
+  if (!sorted_) {
+    std::sort(samples_.begin(), samples_.end());
+    sorted_ = true;
+  }
+  double rank = fraction * static_cast<double>(samples_.size() - 1);
+  size_t lower = static_cast<size_t>(std::floor(rank));
+  size_t upper = std::min(lower + 1, samples_.size() - 1);
+  double weight = rank - static_cast<double>(lower);
+  return samples_[lower] * (1.0 - weight) + samples_[upper] * weight;
+}
+
+double StageMetrics::Mean() const {
+  if (samples_.empty()) {
+    return 0.0;
+  }
+  double sum = 0.0;
+  for (double sample : samples_) {
+    sum += sample;
+  }
+  return sum / static_cast<double>(samples_.size());
+}
+
+double StageMetrics::Max() const {
+  if (samples_.empty()) {
+    return 0.0;
+  }
+  return *std::max_element(samples_.begin(), samples_.end());
+}
+
+StageMetrics* BenchmarkMetrics::Stage(const std::string& name) {
+  for (auto& stage : stages_) {
+    if (stage->name() == name) {
+      return stage.get();
+    }
+  }
+  stages_.emplace_back(new StageMetrics(name));
+  return stages_.back().get();
+}
+
+size_t BenchmarkMetrics::PeakRssKb() {
+  std::ifstream fin("/proc/self/status");
+  std::string line;
+  while (std::getline(fin, line)) {
+    if (line.compare(0, 6, "VmHWM:") == 0) {
+      std::istringstream iss(line.substr(6));
+      size_t kb = 0;
+      iss >> kb;
+      return kb;
+    }
+  }
+  return 0;
+}
+
+std::string BenchmarkMetrics::FormatReport() const {
+  std::ostringstream oss;
+  oss << "stage samples mean_ms p50_ms p90_ms p99_ms max_ms" << std::endl;
+  for (const auto& stage : stages_) {
+    oss << stage->name() << " " << stage->SampleSize() << " " << stage->Mean()
+        << " " << stage->Percentile(0.5) << " " << stage->Percentile(0.9)
+        << " " << stage->Percentile(0.99) << " " << stage->Max() << std::endl;
+  }
+  oss << "peak_rss_kb " << PeakRssKb() << std::endl;
+  return oss.str();
+}
+
+bool BenchmarkMetrics::SaveBaseline(const std::string& filename) const {
+  std::ofstream fout(filename);
+  if (!fout.is_open()) {
+    return false;
+  }
+  for (const auto& stage : stages_) {
+    fout << stage->name() << " " << stage->Percentile(0.99) << std::endl;
+  }
+  return true;
+}
+
+bool BenchmarkMetrics::DiffAgainstBaseline(const std::string& filename,
+                                           double tolerance_percent,
+                                           std::string* report) const {
+  std::ifstream fin(filename);
+  if (!fin.is_open()) {
+    if (report != nullptr) {
+      *report += "failed to open baseline: " + filename + "\n";
+    }
+    return false;
+  }
+  std::map<std::string, double> baseline_p99;
+  std::string name;
+  double p99 = 0.0;
+  while (fin >> name >> p99) {
+    baseline_p99[name] = p99;
+  }
+  bool success = true;
+  std::ostringstream oss;
+  for (const auto& stage : stages_) {
+    auto iter = baseline_p99.find(stage->name());
+    if (iter == baseline_p99.end()) {
+      oss << stage->name() << " NOT_IN_BASELINE" << std::endl;
+      continue;
+    }
+    double current = stage->Percentile(0.99);
+    double budget = iter->second * (1.0 + tolerance_percent / 100.0);
+    if (current > budget) {
+      oss << stage->name() << " REGRESSION p99 " << current << " > budget "
+          << budget << " (baseline " << iter->second << ")" << std::endl;
+      success = false;
+    } else {
+      oss << stage->name() << " OK p99 " << current << " <= budget " << budget
+          << " (baseline " << iter->second << ")" << std::endl;
+    }
+  }
+  if (report != nullptr) {
+    *report += oss.str();
+  }
+  return success;
+}
+
+}  // namespace benchmark
+}  // namespace perception
+}  // namespace apollo
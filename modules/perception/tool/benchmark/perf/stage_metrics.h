@@ -0,0 +1,81 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace apollo {
+namespace perception {
+namespace benchmark {
+
+// @brief latency samples of one pipeline stage with percentile reduction
+class StageMetrics {
+ public:
+  explicit StageMetrics(const std::string& name) : name_(name) {}
+
+  void AddSampleMs(double ms);
+
+  // @brief: fraction in [0, 1], e.g. 0.99 for p99
+  double Percentile(double fraction) const;
+  double Mean() const;
+  double Max() const;
+  size_t SampleSize() const { return samples_.size(); }
+  const std::string& name() const { return name_; }
+
+ private:
+  std::string name_;
+  // sorted lazily on the first percentile query
+  mutable std::vector<double> samples_;
+  mutable bool sorted_ = false;
+};  // class StageMetrics
+
+// @brief harness-wide collection: per-stage latency percentiles, process
+//        peak RSS and golden baseline comparison for CI-style regression
+//        checks on recorded drives
+class BenchmarkMetrics {
+ public:
+  BenchmarkMetrics() = default;
+
+  // @brief: get or create a stage by name, creation order is kept in
+  //         the report
+  StageMetrics* Stage(const std::string& name);
+
+  // @brief: peak resident set size of this process in kilobytes, from
+  //         VmHWM in /proc/self/status
+  static size_t PeakRssKb();
+
+  std::string FormatReport() const;
+
+  // @brief: write the per-stage numbers as a golden baseline file
+  bool SaveBaseline(const std::string& filename) const;
+
+  // @brief: compare against a golden baseline; a stage regresses when
+  //         its p99 exceeds the baseline p99 by more than
+  //         tolerance_percent; returns false on regression, appends a
+  //         per-stage verdict to *report
+  bool DiffAgainstBaseline(const std::string& filename,
+                           double tolerance_percent,
+                           std::string* report) const;
+
+ private:
+  std::vector<std::unique_ptr<StageMetrics>> stages_;
+};  // class BenchmarkMetrics
+
+}  // namespace benchmark
+}  // namespace perception
+}  // namespace apollo
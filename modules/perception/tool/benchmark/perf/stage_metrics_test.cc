@@ -0,0 +1,90 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "modules/perception/tool/benchmark/perf/stage_metrics.h"
+
+#include <cstdio>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace perception {
+namespace benchmark {
+
+TEST(StageMetricsTest, percentiles) {
+  StageMetrics metrics("stage");
+  EXPECT_DOUBLE_EQ(metrics.Percentile(0.5), 0.0);
+  EXPECT_DOUBLE_EQ(metrics.Mean(), 0.0);
+  EXPECT_DOUBLE_EQ(metrics.Max(), 0.0);
+  // samples 1..100, out of order on purpose
+  for (int i = 100; i >= 1; --i) {
+    metrics.AddSampleMs(static_cast<double>(i));
+  }
+  EXPECT_EQ(metrics.SampleSize(), 100u);
+  EXPECT_DOUBLE_EQ(metrics.Percentile(0.0), 1.0);
+  EXPECT_DOUBLE_EQ(metrics.Percentile(1.0), 100.0);
+  EXPECT_DOUBLE_EQ(metrics.Percentile(0.5), 50.5);
+  EXPECT_NEAR(metrics.Percentile(0.99), 99.01, 1e-9);
+  EXPECT_DOUBLE_EQ(metrics.Mean(), 50.5);
+  EXPECT_DOUBLE_EQ(metrics.Max(), 100.0);
+  // adding a sample after a query invalidates the sorted cache
+  metrics.AddSampleMs(1000.0);
+  EXPECT_DOUBLE_EQ(metrics.Percentile(1.0), 1000.0);
+}
+
+TEST(BenchmarkMetricsTest, stage_order_and_reuse) {
+  BenchmarkMetrics metrics;
+  StageMetrics* first = metrics.Stage("segmentation");
+  StageMetrics* second = metrics.Stage("tracking");
+  EXPECT_NE(first, second);
+  EXPECT_EQ(metrics.Stage("segmentation"), first);
+  first->AddSampleMs(1.0);
+  second->AddSampleMs(2.0);
+  std::string report = metrics.FormatReport();
+  EXPECT_LT(report.find("segmentation"), report.find("tracking"));
+  EXPECT_NE(report.find("peak_rss_kb"), std::string::npos);
+  EXPECT_GT(BenchmarkMetrics::PeakRssKb(), 0u);
+}
+
+TEST(BenchmarkMetricsTest, baseline_diff) {
+  BenchmarkMetrics metrics;
+  StageMetrics* stage = metrics.Stage("segmentation");
+  for (int i = 0; i < 10; ++i) {
+    stage->AddSampleMs(10.0);
+  }
+  const std::string filename = "/tmp/stage_metrics_test_baseline.txt";
+  EXPECT_TRUE(metrics.SaveBaseline(filename));
+  std::string report;
+  EXPECT_TRUE(metrics.DiffAgainstBaseline(filename, 10.0, &report));
+  EXPECT_NE(report.find("OK"), std::string::npos);
+  // slower run against the same baseline regresses
+  BenchmarkMetrics slower;
+  StageMetrics* slow_stage = slower.Stage("segmentation");
+  for (int i = 0; i < 10; ++i) {
+    slow_stage->AddSampleMs(20.0);
+  }
+  slower.Stage("unknown_stage")->AddSampleMs(1.0);
+  report.clear();
+  EXPECT_FALSE(slower.DiffAgainstBaseline(filename, 10.0, &report));
+  EXPECT_NE(report.find("REGRESSION"), std::string::npos);
+  EXPECT_NE(report.find("NOT_IN_BASELINE"), std::string::npos);
+  EXPECT_FALSE(slower.DiffAgainstBaseline("/not/exist", 10.0, &report));
+  std::remove(filename.c_str());
+}
+
+}  // namespace benchmark
+}  // namespace perception
+}  // namespace apollo
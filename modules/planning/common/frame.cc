@@ -20,11 +20,14 @@
 #include "modules/planning/common/frame.h"
 
 #include <algorithm>
+#include <future>
 #include <limits>
+#include <utility>
 
 #include "modules/routing/proto/routing.pb.h"
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/configs/vehicle_config_helper.h"
 #include "modules/common/math/vec2d.h"
 #include "modules/common/time/time.h"
@@ -191,11 +194,30 @@ bool Frame::CreateReferenceLineInfo(
   }
 
   bool has_valid_reference_line = false;
-  for (auto &ref_info : reference_line_info_) {
-    if (!ref_info.Init(obstacles())) {
-      AERROR << "Failed to init reference line";
-    } else {
-      has_valid_reference_line = true;
+  if (FLAGS_use_multi_thread_to_init_reference_line &&
+      reference_line_info_.size() > 1) {
+    // Each candidate line only writes its own ReferenceLineInfo and reads
+    // shared frame state, so the per-line initialization (dominated by
+    // projecting every obstacle onto the line) can run concurrently.
+    std::vector<std::future<bool>> futures;
+    for (auto &ref_info : reference_line_info_) {
+      futures.push_back(
+          cyber::Async(&ReferenceLineInfo::Init, &ref_info, obstacles()));
+    }
+    for (auto &future : futures) {
+      if (!future.get()) {
+        AERROR << "Failed to init reference line";
+      } else {
+        has_valid_reference_line = true;
+      }
+    }
+  } else {
+    for (auto &ref_info : reference_line_info_) {
+      if (!ref_info.Init(obstacles())) {
+        AERROR << "Failed to init reference line";
+      } else {
+        has_valid_reference_line = true;
+      }
     }
   }
   return has_valid_reference_line;
@@ -352,13 +374,12 @@ Status Frame::InitFrameData() {
          << FLAGS_align_prediction_time;
 
   if (FLAGS_align_prediction_time) {
-    auto prediction = *(local_view_.prediction_obstacles);
-    AlignPredictionTime(vehicle_state_.timestamp(), &prediction);
-    local_view_.prediction_obstacles->CopyFrom(prediction);
+    AlignPredictionTime(vehicle_state_.timestamp(),
+                        local_view_.prediction_obstacles.get());
   }
   for (auto &ptr :
        Obstacle::CreateObstacles(*local_view_.prediction_obstacles)) {
-    AddObstacle(*ptr);
+    AddObstacle(std::move(*ptr));
   }
   if (planning_start_point_.v() < 1e-3) {
     const auto *collision_obstacle = FindCollisionObstacle();
@@ -465,6 +486,11 @@ void Frame::AddObstacle(const Obstacle &obstacle) {
   obstacles_.Add(obstacle.Id(), obstacle);
 }
 
+void Frame::AddObstacle(Obstacle &&obstacle) {
+  const std::string id = obstacle.Id();
+  obstacles_.Add(id, std::move(obstacle));
+}
+
 void Frame::ReadTrafficLights() {
   traffic_lights_.clear();
 
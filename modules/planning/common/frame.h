@@ -189,6 +189,7 @@ class Frame {
                                               const common::math::Box2d &box);
 
   void AddObstacle(const Obstacle &obstacle);
+  void AddObstacle(Obstacle &&obstacle);
 
   void ReadTrafficLights();
 
@@ -20,6 +20,7 @@
 
 #include "modules/planning/common/history.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "cyber/common/log.h"
@@ -63,6 +64,7 @@ HistoryObjectDecision::GetObjectDecision() const {
 // HistoryFrame
 
 void HistoryFrame::Init(const ADCTrajectory& adc_trajactory) {
+  Clear();
   adc_trajactory_.CopyFrom(adc_trajactory);
 
   seq_num_ = adc_trajactory.header().sequence_num();
@@ -74,7 +76,30 @@ void HistoryFrame::Init(const ADCTrajectory& adc_trajactory) {
     object_decisions_map_[id] = object_decision;
 
     object_decisions_.push_back(object_decision);
+
+    for (const ObjectDecisionType* decision_type :
+         object_decision.GetObjectDecision()) {
+      if (decision_type->has_stop()) {
+        HistoryObjectDecision stop_decision;
+        stop_decision.Init(id, {*decision_type});
+        stop_object_decisions_.emplace_back(std::move(stop_decision));
+      }
+    }
   }
+
+  std::sort(stop_object_decisions_.begin(), stop_object_decisions_.end(),
+            [](const HistoryObjectDecision& lhs,
+               const HistoryObjectDecision& rhs) {
+              return lhs.id() < rhs.id();
+            });
+}
+
+void HistoryFrame::Clear() {
+  seq_num_ = 0;
+  adc_trajactory_.Clear();
+  object_decisions_map_.clear();
+  object_decisions_.clear();
+  stop_object_decisions_.clear();
 }
 
 std::vector<const HistoryObjectDecision*> HistoryFrame::GetObjectDecisions()
@@ -89,28 +114,13 @@ std::vector<const HistoryObjectDecision*> HistoryFrame::GetObjectDecisions()
 
 std::vector<const HistoryObjectDecision*> HistoryFrame::GetStopObjectDecisions()
     const {
+  // served from the per-frame cache built in Init(); already sorted by id
   std::vector<const HistoryObjectDecision*> result;
-  for (size_t i = 0; i < object_decisions_.size(); i++) {
-    auto obj_decision = object_decisions_[i].GetObjectDecision();
-    for (const ObjectDecisionType* decision_type : obj_decision) {
-      if (decision_type->has_stop()) {
-        std::vector<ObjectDecisionType> object_decision;
-        object_decision.push_back(*decision_type);
-
-        HistoryObjectDecision* decision = new HistoryObjectDecision();
-        decision->Init(object_decisions_[i].id(), object_decision);
-        result.push_back(decision);
-      }
-    }
+  result.reserve(stop_object_decisions_.size());
+  for (size_t i = 0; i < stop_object_decisions_.size(); i++) {
+    result.push_back(&(stop_object_decisions_[i]));
   }
 
-  // sort
-  std::sort(
-      result.begin(), result.end(),
-      [](const HistoryObjectDecision* lhs, const HistoryObjectDecision* rhs) {
-        return lhs->id() < rhs->id();
-      });
-
   return result;
 }
 
@@ -155,28 +165,41 @@ bool HistoryStatus::GetObjectStatus(const std::string& id,
 History::History() {}
 
 const HistoryFrame* History::GetLastFrame() const {
-  if (history_frames_.empty()) {
+  if (size_ == 0) {
     return nullptr;
-  } else {
-    return &(history_frames_.back());
   }
+  return &(history_frames_[(head_ + size_ - 1) % history_frames_.size()]);
+}
+
+void History::Clear() {
+  // keep the allocated slots; they are re-initialized in place by Add()
+  head_ = 0;
+  size_ = 0;
 }
-void History::Clear() { history_frames_.clear(); }
 
 int History::Add(const ADCTrajectory& adc_trajectory_pb) {
-  if (history_frames_.size() >=
-      static_cast<size_t>(FLAGS_history_max_record_num)) {
-    history_frames_.pop_front();
+  const size_t capacity = static_cast<size_t>(
+      std::max(1, FLAGS_history_max_record_num));
+  if (history_frames_.size() != capacity) {
+    // first use, or the capacity flag changed: rebuild the ring
+    history_frames_.clear();
+    history_frames_.resize(capacity);
+    head_ = 0;
+    size_ = 0;
   }
 
-  HistoryFrame history_frame;
-  history_frame.Init(adc_trajectory_pb);
-  history_frames_.emplace_back(std::move(history_frame));
+  HistoryFrame* slot = &(history_frames_[(head_ + size_) % capacity]);
+  if (size_ == capacity) {
+    head_ = (head_ + 1) % capacity;
+  } else {
+    ++size_;
+  }
+  slot->Init(adc_trajectory_pb);
 
   return 0;
 }
 
-size_t History::Size() const { return history_frames_.size(); }
+size_t History::Size() const { return size_; }
 
 }  // namespace planning
 }  // namespace apollo
@@ -20,7 +20,6 @@
 
 #pragma once
 
-#include <list>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -52,6 +51,7 @@ class HistoryFrame {
   HistoryFrame() = default;
 
   void Init(const ADCTrajectory& adc_trajactory);
+  void Clear();
 
   int seq_num() const { return seq_num_; }
 
@@ -62,10 +62,11 @@ class HistoryFrame {
       const std::string& id) const;
 
  private:
-  int seq_num_;
+  int seq_num_ = 0;
   ADCTrajectory adc_trajactory_;
   std::unordered_map<std::string, HistoryObjectDecision> object_decisions_map_;
   std::vector<HistoryObjectDecision> object_decisions_;
+  std::vector<HistoryObjectDecision> stop_object_decisions_;
 };
 
 class HistoryObjectStatus {
@@ -105,7 +106,12 @@ class History {
   HistoryStatus* mutable_history_status() { return &history_status_; }
 
  private:
-  std::list<HistoryFrame> history_frames_;
+  // fixed ring of frame slots sized by FLAGS_history_max_record_num; slots
+  // are cleared and re-initialized in place so long runs do not keep
+  // re-allocating frame storage
+  std::vector<HistoryFrame> history_frames_;
+  size_t head_ = 0;
+  size_t size_ = 0;
   HistoryStatus history_status_;
 
   // this is a singleton class
@@ -315,8 +315,18 @@ DEFINE_bool(enable_sqp_solver, true, "True to enable SQP solver.");
 /// thread pool
 DEFINE_bool(use_multi_thread_to_add_obstacles, false,
             "use multiple thread to add obstacles.");
+DEFINE_bool(use_multi_thread_to_init_reference_line, false,
+            "use multiple thread to init reference line info in frame.");
 DEFINE_bool(enable_multi_thread_in_dp_st_graph, false,
             "Enable multiple thread to calculation curve cost in dp_st_graph.");
+DEFINE_bool(enable_multi_thread_in_lattice_evaluation, false,
+            "Enable multiple thread to evaluate trajectory pair cost in "
+            "lattice planner.");
+DEFINE_bool(enable_multi_thread_in_st_boundary_mapper, false,
+            "Enable multiple thread to map obstacles onto the st graph.");
+DEFINE_bool(enable_multi_thread_in_path_assessment, false,
+            "Enable multiple thread to check candidate path validity in "
+            "path assessment decider.");
 
 /// Lattice Planner
 DEFINE_double(numerical_epsilon, 1e-6, "Epsilon in lattice planner.");
@@ -154,7 +154,11 @@ DECLARE_bool(enable_sqp_solver);
 
 /// thread pool
 DECLARE_bool(use_multi_thread_to_add_obstacles);
+DECLARE_bool(use_multi_thread_to_init_reference_line);
 DECLARE_bool(enable_multi_thread_in_dp_st_graph);
+DECLARE_bool(enable_multi_thread_in_lattice_evaluation);
+DECLARE_bool(enable_multi_thread_in_st_boundary_mapper);
+DECLARE_bool(enable_multi_thread_in_path_assessment);
 
 DECLARE_double(numerical_epsilon);
 DECLARE_double(default_cruise_speed);
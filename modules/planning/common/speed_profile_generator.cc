@@ -21,6 +21,7 @@
 #include "modules/planning/common/speed_profile_generator.h"
 
 #include <algorithm>
+#include <cmath>
 
 #include "cyber/common/log.h"
 #include "modules/planning/common/ego_info.h"
@@ -33,14 +34,68 @@ namespace planning {
 
 using apollo::common::SpeedPoint;
 
+namespace {
+
+// precomputed fallback stop profile library, built once at planning init
+// and indexed by [speed_bin * num_acc_bins + acc_bin]; an empty entry
+// marks a bin whose optimization failed
+std::vector<std::vector<std::array<double, 3>>> fallback_profile_table;
+bool fallback_profile_inited = false;
+int fallback_num_speed_bins = 0;
+int fallback_num_acc_bins = 0;
+double fallback_min_acc = 0.0;
+double fallback_max_acc = 0.0;
+double fallback_max_speed = 0.0;
+
+constexpr double kFallbackSpeedBinSize = 1.0;  // [m/s]
+constexpr double kFallbackAccBinSize = 1.0;    // [m/s^2]
+
+}  // namespace
+
+void SpeedProfileGenerator::InitFallbackProfileLibrary() {
+  if (fallback_profile_inited) {
+    return;
+  }
+  const auto& veh_param =
+      common::VehicleConfigHelper::GetConfig().vehicle_param();
+  fallback_min_acc = veh_param.max_deceleration();
+  fallback_max_acc = veh_param.max_acceleration();
+  fallback_max_speed = FLAGS_planning_upper_speed_limit;
+  fallback_num_speed_bins =
+      static_cast<int>(std::ceil(fallback_max_speed / kFallbackSpeedBinSize)) +
+      1;
+  fallback_num_acc_bins =
+      static_cast<int>(std::ceil((fallback_max_acc - fallback_min_acc) /
+                                 kFallbackAccBinSize)) +
+      1;
+  fallback_profile_table.assign(
+      fallback_num_speed_bins * fallback_num_acc_bins, ProfileKnots());
+
+  int solved_num = 0;
+  for (int i = 0; i < fallback_num_speed_bins; ++i) {
+    const double init_v =
+        std::fmin(i * kFallbackSpeedBinSize, fallback_max_speed);
+    for (int j = 0; j < fallback_num_acc_bins; ++j) {
+      const double init_a =
+          std::fmin(fallback_min_acc + j * kFallbackAccBinSize,
+                    fallback_max_acc);
+      auto* knots = &fallback_profile_table[i * fallback_num_acc_bins + j];
+      if (SolveFallbackProfile(init_v, init_a, 0.0, knots)) {
+        ++solved_num;
+      }
+    }
+  }
+  fallback_profile_inited = true;
+  AINFO << "Fallback speed profile library initialized: " << solved_num
+        << " / " << fallback_profile_table.size() << " bins solved";
+}
+
 SpeedData SpeedProfileGenerator::GenerateFallbackSpeed(
     const double stop_distance) {
   AERROR << "Fallback using piecewise jerk speed!";
   const double init_v = EgoInfo::Instance()->start_point().v();
   const double init_a = EgoInfo::Instance()->start_point().a();
   AWARN << "init_v = " << init_v << ", init_a = " << init_a;
-  const auto& veh_param =
-      common::VehicleConfigHelper::GetConfig().vehicle_param();
 
   // if already stopped
   if (init_v <= 0.0 && init_a <= 0.0) {
@@ -51,6 +106,29 @@ SpeedData SpeedProfileGenerator::GenerateFallbackSpeed(
     return speed_data;
   }
 
+  // the precomputed library covers the default stop-in-place fallback;
+  // interpolating it costs microseconds exactly when the cycle is
+  // already over budget
+  ProfileKnots knots;
+  if (stop_distance <= 0.0 &&
+      InterpolateFallbackProfile(init_v, init_a, &knots)) {
+    return ToSpeedData(knots);
+  }
+
+  if (!SolveFallbackProfile(init_v, init_a, stop_distance, &knots)) {
+    AERROR << "Piecewise jerk fallback speed optimizer failed!";
+    return GenerateStopProfile(init_v, init_a);
+  }
+  return ToSpeedData(knots);
+}
+
+bool SpeedProfileGenerator::SolveFallbackProfile(const double init_v,
+                                                 const double init_a,
+                                                 const double stop_distance,
+                                                 ProfileKnots* knots) {
+  const auto& veh_param =
+      common::VehicleConfigHelper::GetConfig().vehicle_param();
+
   std::array<double, 3> init_s = {0.0, init_v, init_a};
 
   // TODO(all): dt is too small;
@@ -76,8 +154,8 @@ SpeedData SpeedProfileGenerator::GenerateFallbackSpeed(
 
   // Solve the problem
   if (!piecewise_jerk_problem.Optimize()) {
-    AERROR << "Piecewise jerk fallback speed optimizer failed!";
-    return GenerateStopProfile(init_v, init_a);
+    knots->clear();
+    return false;
   }
 
   // Extract output
@@ -85,20 +163,83 @@ SpeedData SpeedProfileGenerator::GenerateFallbackSpeed(
   const std::vector<double>& ds = piecewise_jerk_problem.opt_dx();
   const std::vector<double>& dds = piecewise_jerk_problem.opt_ddx();
 
+  knots->clear();
+  knots->reserve(num_of_knots);
   for (size_t i = 0; i < num_of_knots; ++i) {
     ADEBUG << "For[" << delta_t * static_cast<double>(i) << "], s = " << s[i]
            << ", v = " << ds[i] << ", a = " << dds[i];
+    knots->push_back({s[i], ds[i], dds[i]});
+  }
+  return true;
+}
+
+bool SpeedProfileGenerator::InterpolateFallbackProfile(const double init_v,
+                                                       const double init_a,
+                                                       ProfileKnots* knots) {
+  if (!fallback_profile_inited) {
+    return false;
   }
+  // queries outside the precomputed ranges go to the online solver
+  if (init_v < 0.0 || init_v > fallback_max_speed ||
+      init_a < fallback_min_acc || init_a > fallback_max_acc) {
+    return false;
+  }
+
+  const double speed_pos = init_v / kFallbackSpeedBinSize;
+  const double acc_pos = (init_a - fallback_min_acc) / kFallbackAccBinSize;
+  const int speed_low = std::min(static_cast<int>(speed_pos),
+                                 fallback_num_speed_bins - 1);
+  const int speed_high = std::min(speed_low + 1, fallback_num_speed_bins - 1);
+  const int acc_low =
+      std::min(static_cast<int>(acc_pos), fallback_num_acc_bins - 1);
+  const int acc_high = std::min(acc_low + 1, fallback_num_acc_bins - 1);
+  const double speed_weight =
+      speed_high > speed_low ? speed_pos - speed_low : 0.0;
+  const double acc_weight = acc_high > acc_low ? acc_pos - acc_low : 0.0;
+
+  const ProfileKnots& knots_ll =
+      fallback_profile_table[speed_low * fallback_num_acc_bins + acc_low];
+  const ProfileKnots& knots_lh =
+      fallback_profile_table[speed_low * fallback_num_acc_bins + acc_high];
+  const ProfileKnots& knots_hl =
+      fallback_profile_table[speed_high * fallback_num_acc_bins + acc_low];
+  const ProfileKnots& knots_hh =
+      fallback_profile_table[speed_high * fallback_num_acc_bins + acc_high];
+  if (knots_ll.empty() || knots_lh.empty() || knots_hl.empty() ||
+      knots_hh.empty()) {
+    return false;
+  }
+
+  // bilinear blend of the four neighboring profiles; the blended initial
+  // state matches (init_v, init_a) exactly since the bins are the corners
+  const size_t num_of_knots = std::min(
+      std::min(knots_ll.size(), knots_lh.size()),
+      std::min(knots_hl.size(), knots_hh.size()));
+  knots->resize(num_of_knots);
+  for (size_t i = 0; i < num_of_knots; ++i) {
+    for (size_t d = 0; d < 3; ++d) {
+      const double low = (1.0 - acc_weight) * knots_ll[i][d] +
+                         acc_weight * knots_lh[i][d];
+      const double high = (1.0 - acc_weight) * knots_hl[i][d] +
+                          acc_weight * knots_hh[i][d];
+      (*knots)[i][d] = (1.0 - speed_weight) * low + speed_weight * high;
+    }
+  }
+  return true;
+}
 
+SpeedData SpeedProfileGenerator::ToSpeedData(const ProfileKnots& knots) {
+  const double delta_t = FLAGS_fallback_time_unit;
   SpeedData speed_data;
-  speed_data.AppendSpeedPoint(s[0], 0.0, ds[0], dds[0], 0.0);
-  for (size_t i = 1; i < num_of_knots; ++i) {
+  speed_data.AppendSpeedPoint(knots[0][0], 0.0, knots[0][1], knots[0][2], 0.0);
+  for (size_t i = 1; i < knots.size(); ++i) {
     // Avoid the very last points when already stopped
-    if (s[i] - s[i - 1] <= 0.0 || ds[i] <= 0.0) {
+    if (knots[i][0] - knots[i - 1][0] <= 0.0 || knots[i][1] <= 0.0) {
       break;
     }
-    speed_data.AppendSpeedPoint(s[i], delta_t * static_cast<double>(i), ds[i],
-                                dds[i], (dds[i] - dds[i - 1]) / delta_t);
+    speed_data.AppendSpeedPoint(knots[i][0], delta_t * static_cast<double>(i),
+                                knots[i][1], knots[i][2],
+                                (knots[i][2] - knots[i - 1][2]) / delta_t);
   }
   FillEnoughSpeedPoints(&speed_data);
   return speed_data;
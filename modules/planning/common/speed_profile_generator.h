@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 
 #include "modules/common/proto/pnc_point.pb.h"
@@ -35,6 +36,14 @@ class SpeedProfileGenerator {
  public:
   SpeedProfileGenerator() = delete;
 
+  /**
+   * @brief Solve the fallback stop profiles over initial speed/acceleration
+   * bins into flat tables, so that overrun cycles only interpolate instead
+   * of running the optimizer. Expected to be called once at planning init;
+   * without it every fallback query falls back to the online solver.
+   */
+  static void InitFallbackProfileLibrary();
+
   static SpeedData GenerateFallbackSpeed(const double stop_distance = 0.0);
 
   static void FillEnoughSpeedPoints(SpeedData* const speed_data);
@@ -45,6 +54,19 @@ class SpeedProfileGenerator {
  private:
   static SpeedData GenerateStopProfile(const double init_speed,
                                        const double init_acc);
+
+  // knot rows (s, v, a) at FLAGS_fallback_time_unit spacing
+  using ProfileKnots = std::vector<std::array<double, 3>>;
+
+  static bool SolveFallbackProfile(const double init_v, const double init_a,
+                                   const double stop_distance,
+                                   ProfileKnots* knots);
+
+  static bool InterpolateFallbackProfile(const double init_v,
+                                         const double init_a,
+                                         ProfileKnots* knots);
+
+  static SpeedData ToSpeedData(const ProfileKnots& knots);
 };
 
 }  // namespace planning
@@ -20,6 +20,7 @@
 
 #include "modules/planning/common/trajectory/discretized_trajectory.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "cyber/common/log.h"
@@ -96,9 +97,16 @@ size_t DiscretizedTrajectory::QueryNearestPoint(
 
 size_t DiscretizedTrajectory::QueryNearestPointWithBuffer(
     const common::math::Vec2d& position, const double buffer) const {
+  return QueryNearestPointWithBuffer(position, buffer, 0, size());
+}
+
+size_t DiscretizedTrajectory::QueryNearestPointWithBuffer(
+    const common::math::Vec2d& position, const double buffer,
+    const size_t begin_index, const size_t end_index) const {
   double dist_sqr_min = std::numeric_limits<double>::max();
-  size_t index_min = 0;
-  for (size_t i = 0; i < size(); ++i) {
+  size_t index_min = begin_index;
+  const size_t bounded_end_index = std::min(end_index, size());
+  for (size_t i = begin_index; i < bounded_end_index; ++i) {
     const common::math::Vec2d curr_point(data()[i].path_point().x(),
                                          data()[i].path_point().y());
 
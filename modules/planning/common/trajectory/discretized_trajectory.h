@@ -63,6 +63,16 @@ class DiscretizedTrajectory : public std::vector<common::TrajectoryPoint> {
   size_t QueryNearestPointWithBuffer(const common::math::Vec2d& position,
                                      const double buffer) const;
 
+  /**
+   * @brief Same as above, but restricted to the index range
+   * [begin_index, end_index), so callers that already know a rough match
+   * avoid scanning the whole trajectory.
+   */
+  size_t QueryNearestPointWithBuffer(const common::math::Vec2d& position,
+                                     const double buffer,
+                                     const size_t begin_index,
+                                     const size_t end_index) const;
+
   virtual void AppendTrajectoryPoint(
       const common::TrajectoryPoint& trajectory_point);
 
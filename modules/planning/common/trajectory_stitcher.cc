@@ -171,8 +171,20 @@ std::vector<TrajectoryPoint> TrajectoryStitcher::ComputeStitchingTrajectory(
     return ComputeReinitStitchingTrajectory(planning_cycle_time, vehicle_state);
   }
 
+  // In auto mode the vehicle stays within a short time window around the
+  // time-matched point, so restrict the nearest-point scan to that window
+  // instead of the whole previous trajectory; larger deviations trip the
+  // replan-by-offset checks below anyway.
+  static constexpr double kPositionMatchTimeWindow = 1.0;  // in seconds
+  const size_t search_begin_index = prev_trajectory->QueryLowerBoundPoint(
+      veh_rel_time - kPositionMatchTimeWindow);
+  const size_t search_end_index =
+      prev_trajectory->QueryLowerBoundPoint(veh_rel_time +
+                                            kPositionMatchTimeWindow) +
+      1;
   size_t position_matched_index = prev_trajectory->QueryNearestPointWithBuffer(
-      {vehicle_state.x(), vehicle_state.y()}, 1.0e-6);
+      {vehicle_state.x(), vehicle_state.y()}, 1.0e-6, search_begin_index,
+      search_end_index);
 
   auto frenet_sd = ComputePositionProjection(
       vehicle_state.x(), vehicle_state.y(),
@@ -0,0 +1,150 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/planning/integration_tests/replay_benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "absl/strings/str_cat.h"
+
+#include "cyber/common/log.h"
+#include "modules/common/time/time.h"
+
+namespace apollo {
+namespace planning {
+
+using apollo::common::time::Clock;
+
+namespace {
+// regressions of tasks that finish in fractions of a millisecond are noise;
+// require this much absolute growth on top of the threshold ratio
+constexpr double kMinRegressionMs = 0.1;
+}  // namespace
+
+double PlanningReplayBenchmark::LatencyDistribution::MeanMs() const {
+  if (samples_ms.empty()) {
+    return 0.0;
+  }
+  double sum = 0.0;
+  for (const double sample : samples_ms) {
+    sum += sample;
+  }
+  return sum / static_cast<double>(samples_ms.size());
+}
+
+double PlanningReplayBenchmark::LatencyDistribution::PercentileMs(
+    const double percentile) const {
+  if (samples_ms.empty()) {
+    return 0.0;
+  }
+  std::vector<double> sorted_samples = samples_ms;
+  std::sort(sorted_samples.begin(), sorted_samples.end());
+  const double rank =
+      std::ceil(percentile / 100.0 *
+                static_cast<double>(sorted_samples.size())) -
+      1.0;
+  const std::size_t index =
+      static_cast<std::size_t>(std::max(rank, 0.0));
+  return sorted_samples[std::min(index, sorted_samples.size() - 1)];
+}
+
+double PlanningReplayBenchmark::LatencyDistribution::MaxMs() const {
+  if (samples_ms.empty()) {
+    return 0.0;
+  }
+  return *std::max_element(samples_ms.begin(), samples_ms.end());
+}
+
+bool PlanningReplayBenchmark::Run(PlanningBase* planning,
+                                  const LocalView& local_view,
+                                  const int cycles) {
+  if (planning == nullptr || cycles < 1 ||
+      local_view.localization_estimate == nullptr) {
+    AERROR << "Invalid replay benchmark inputs";
+    return false;
+  }
+  task_latencies_.clear();
+  total_latency_.samples_ms.clear();
+  total_latency_.samples_ms.reserve(cycles);
+
+  const double recorded_timestamp =
+      local_view.localization_estimate->header().timestamp_sec();
+  for (int i = 0; i < cycles; ++i) {
+    // rewind the mock clock so every cycle replays the recorded inputs
+    // against the identical planning time
+    Clock::SetNowInSeconds(recorded_timestamp);
+    ADCTrajectory trajectory;
+    planning->RunOnce(local_view, &trajectory);
+    const auto& latency_stats = trajectory.latency_stats();
+    if (latency_stats.task_stats().empty()) {
+      AERROR << "Replay cycle " << i << " reported no task latency stats";
+      return false;
+    }
+    for (const auto& task_stats : latency_stats.task_stats()) {
+      task_latencies_[task_stats.name()].samples_ms.push_back(
+          task_stats.time_ms());
+    }
+    total_latency_.samples_ms.push_back(latency_stats.total_time_ms());
+  }
+  return true;
+}
+
+LatencyStats PlanningReplayBenchmark::ToBaseline() const {
+  LatencyStats baseline;
+  baseline.set_total_time_ms(total_latency_.MeanMs());
+  for (const auto& task_latency : task_latencies_) {
+    auto* task_stats = baseline.add_task_stats();
+    task_stats->set_name(task_latency.first);
+    task_stats->set_time_ms(task_latency.second.MeanMs());
+  }
+  return baseline;
+}
+
+bool PlanningReplayBenchmark::CheckRegression(const LatencyStats& baseline,
+                                              const double threshold_ratio,
+                                              std::string* const report) const {
+  CHECK_NOTNULL(report);
+  bool no_regression = true;
+  for (const auto& baseline_task : baseline.task_stats()) {
+    const auto iter = task_latencies_.find(baseline_task.name());
+    if (iter == task_latencies_.end()) {
+      absl::StrAppend(report, "task [", baseline_task.name(),
+                      "] in baseline was not executed in replay\n");
+      continue;
+    }
+    const double measured_ms = iter->second.MeanMs();
+    const double baseline_ms = baseline_task.time_ms();
+    if (measured_ms > baseline_ms * threshold_ratio &&
+        measured_ms - baseline_ms > kMinRegressionMs) {
+      no_regression = false;
+      absl::StrAppend(report, "task [", baseline_task.name(), "] regressed: ",
+                      measured_ms, " ms vs baseline ", baseline_ms, " ms\n");
+    }
+  }
+  const double measured_total_ms = total_latency_.MeanMs();
+  const double baseline_total_ms = baseline.total_time_ms();
+  if (measured_total_ms > baseline_total_ms * threshold_ratio &&
+      measured_total_ms - baseline_total_ms > kMinRegressionMs) {
+    no_regression = false;
+    absl::StrAppend(report, "total cycle time regressed: ", measured_total_ms,
+                    " ms vs baseline ", baseline_total_ms, " ms\n");
+  }
+  return no_regression;
+}
+
+}  // namespace planning
+}  // namespace apollo
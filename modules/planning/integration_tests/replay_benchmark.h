@@ -0,0 +1,86 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ **/
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "modules/planning/common/local_view.h"
+#include "modules/planning/planning_base.h"
+
+namespace apollo {
+namespace planning {
+
+/**
+ * @class PlanningReplayBenchmark
+ * @brief Replays a recorded LocalView through PlanningBase::RunOnce and
+ * aggregates the per task latency distributions reported in the trajectory
+ * LatencyStats. The measured means can be exported as a baseline proto and
+ * later replays gated against it, so task level cycle-time regressions fail
+ * a test instead of drifting in unnoticed.
+ */
+class PlanningReplayBenchmark {
+ public:
+  struct LatencyDistribution {
+    std::vector<double> samples_ms;
+
+    double MeanMs() const;
+    double PercentileMs(const double percentile) const;
+    double MaxMs() const;
+  };
+
+  /**
+   * @brief Feed the recorded local view through RunOnce for the given number
+   * of cycles. The mock clock is reset to the recorded localization
+   * timestamp before every cycle so each replay observes identical inputs.
+   * @return true if every cycle reported task latency stats
+   */
+  bool Run(PlanningBase* planning, const LocalView& local_view,
+           const int cycles);
+
+  /**
+   * @brief Export the measured per task mean latencies as a baseline
+   */
+  LatencyStats ToBaseline() const;
+
+  /**
+   * @brief Compare the measured means against a baseline and report every
+   * task whose mean latency exceeds baseline * threshold_ratio
+   * @return true if no task regressed beyond the threshold
+   */
+  bool CheckRegression(const LatencyStats& baseline,
+                       const double threshold_ratio,
+                       std::string* const report) const;
+
+  const std::map<std::string, LatencyDistribution>& task_latencies() const {
+    return task_latencies_;
+  }
+
+  const LatencyDistribution& total_latency() const { return total_latency_; }
+
+ private:
+  std::map<std::string, LatencyDistribution> task_latencies_;
+  LatencyDistribution total_latency_;
+};
+
+}  // namespace planning
+}  // namespace apollo
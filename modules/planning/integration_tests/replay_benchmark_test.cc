@@ -0,0 +1,110 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "modules/planning/integration_tests/replay_benchmark.h"
+
+#include "cyber/common/file.h"
+#include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/integration_tests/planning_test_base.h"
+
+namespace apollo {
+namespace planning {
+
+DEFINE_int32(test_benchmark_cycles, 50,
+             "Number of replay cycles to feed through RunOnce");
+DEFINE_string(test_benchmark_baseline_file, "",
+              "Baseline latency file relative to the test data dir; when "
+              "empty the replay only reports the measured distributions");
+DEFINE_double(test_benchmark_regression_ratio, 1.3,
+              "A task fails the gate when its mean latency exceeds "
+              "baseline * this ratio");
+DEFINE_bool(test_update_benchmark_baseline, false,
+            "true to regenerate the benchmark baseline file");
+
+/**
+ * @class ReplayBenchmarkTest
+ * @brief Replays recorded garage scenario inputs through RunOnce and gates
+ * the per task latency distributions against a recorded baseline.
+ */
+class ReplayBenchmarkTest : public PlanningTestBase {
+ public:
+  virtual void SetUp() {
+    FLAGS_use_multi_thread_to_add_obstacles = false;
+    FLAGS_enable_multi_thread_in_dp_st_graph = false;
+    FLAGS_use_navigation_mode = false;
+    FLAGS_map_dir = "modules/planning/testdata/garage_map";
+    FLAGS_base_map_filename = "base_map.txt";
+    FLAGS_test_data_dir = "modules/planning/testdata/garage_test";
+    FLAGS_planning_upper_speed_limit = 12.5;
+    FLAGS_test_routing_response_file = "garage_routing.pb.txt";
+    FLAGS_test_previous_planning_file = "";
+    FLAGS_enable_rss_info = false;
+    // the task stats the benchmark aggregates are only recorded in debug
+    FLAGS_enable_record_debug = true;
+
+    FLAGS_enable_scenario_stop_sign = false;
+    FLAGS_enable_scenario_traffic_light = false;
+  }
+};
+
+/*
+ * replay the follow scenario and gate the per task cycle times
+ */
+TEST_F(ReplayBenchmarkTest, follow_cycle_time) {
+  FLAGS_test_prediction_file = "follow_prediction.pb.txt";
+  FLAGS_test_localization_file = "follow_localization.pb.txt";
+  FLAGS_test_chassis_file = "follow_chassis.pb.txt";
+
+  PlanningTestBase::SetUp();
+
+  PlanningReplayBenchmark benchmark;
+  ASSERT_TRUE(benchmark.Run(planning_.get(), local_view_,
+                            FLAGS_test_benchmark_cycles));
+
+  for (const auto& task_latency : benchmark.task_latencies()) {
+    AINFO << "task [" << task_latency.first
+          << "] mean: " << task_latency.second.MeanMs()
+          << " ms, p95: " << task_latency.second.PercentileMs(95.0)
+          << " ms, max: " << task_latency.second.MaxMs() << " ms";
+  }
+  AINFO << "total cycle mean: " << benchmark.total_latency().MeanMs()
+        << " ms, p95: " << benchmark.total_latency().PercentileMs(95.0)
+        << " ms";
+
+  if (FLAGS_test_benchmark_baseline_file.empty()) {
+    return;
+  }
+  const std::string baseline_path =
+      FLAGS_test_data_dir + "/" + FLAGS_test_benchmark_baseline_file;
+  if (FLAGS_test_update_benchmark_baseline) {
+    AINFO << "The benchmark baseline is regenerated: " << baseline_path;
+    ASSERT_TRUE(cyber::common::SetProtoToASCIIFile(benchmark.ToBaseline(),
+                                                   baseline_path));
+    return;
+  }
+  LatencyStats baseline;
+  ASSERT_TRUE(
+      cyber::common::GetProtoFromASCIIFile(baseline_path, &baseline));
+  std::string report;
+  EXPECT_TRUE(benchmark.CheckRegression(
+      baseline, FLAGS_test_benchmark_regression_ratio, &report))
+      << report;
+}
+
+}  // namespace planning
+}  // namespace apollo
+
+TMAIN;
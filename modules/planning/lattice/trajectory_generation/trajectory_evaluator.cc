@@ -21,9 +21,12 @@
 #include "modules/planning/lattice/trajectory_generation/trajectory_evaluator.h"
 
 #include <algorithm>
+#include <chrono>
+#include <future>
 #include <limits>
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/math/path_matcher.h"
 #include "modules/planning/common/planning_gflags.h"
 #include "modules/planning/common/trajectory1d/piecewise_acceleration_trajectory1d.h"
@@ -56,6 +59,18 @@ TrajectoryEvaluator::TrajectoryEvaluator(
   path_time_intervals_ = path_time_graph_->GetPathBlockingIntervals(
       start_time, end_time, FLAGS_trajectory_time_resolution);
 
+  // the grid mirrors the sampling of path_time_intervals_ above (inclusive
+  // end point); the cost loops that used to stop strictly before the time
+  // length only touch the first num_time_points_in_range_ entries
+  for (double t = start_time; t <= end_time;
+       t += FLAGS_trajectory_time_resolution) {
+    time_grid_.emplace_back(t);
+  }
+  while (num_time_points_in_range_ < time_grid_.size() &&
+         time_grid_[num_time_points_in_range_] < end_time) {
+    ++num_time_points_in_range_;
+  }
+
   reference_s_dot_ = ComputeLongitudinalGuideVelocity(planning_target);
 
   // if we have a stop point along the reference line,
@@ -64,32 +79,115 @@ TrajectoryEvaluator::TrajectoryEvaluator(
   if (planning_target.has_stop_point()) {
     stop_point = planning_target.stop_point().s();
   }
-  for (const auto& lon_trajectory : lon_trajectories) {
-    double lon_end_s = lon_trajectory->Evaluate(0, end_time);
-    if (init_s[0] < stop_point &&
-        lon_end_s + FLAGS_lattice_stop_buffer > stop_point) {
-      continue;
-    }
 
-    if (!ConstraintChecker1d::IsValidLongitudinalTrajectory(*lon_trajectory)) {
-      continue;
+  const auto evaluation_start = std::chrono::system_clock::now();
+
+  // The pairs sharing a longitudinal trajectory form one evaluation task.
+  // Each task prunes and writes into its own cost container, so the
+  // evaluation runs without locking; the containers are merged into the cost
+  // queue once all tasks are joined
+  std::vector<std::vector<PairCost>> paired_costs(lon_trajectories.size());
+  if (FLAGS_enable_multi_thread_in_lattice_evaluation) {
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < lon_trajectories.size(); ++i) {
+      results.emplace_back(cyber::Async(
+          &TrajectoryEvaluator::EvaluateLonTrajectory, this,
+          std::ref(planning_target), stop_point, std::ref(lon_trajectories[i]),
+          std::ref(lat_trajectories), &paired_costs[i]));
     }
-    for (const auto& lat_trajectory : lat_trajectories) {
-      /**
-       * The validity of the code needs to be verified.
-      if (!ConstraintChecker1d::IsValidLateralTrajectory(*lat_trajectory,
-                                                         *lon_trajectory)) {
-        continue;
-      }
-      */
-      double cost = Evaluate(planning_target, lon_trajectory, lat_trajectory);
-      cost_queue_.emplace(Trajectory1dPair(lon_trajectory, lat_trajectory),
-                          cost);
+    for (auto& result : results) {
+      result.get();
+    }
+  } else {
+    for (size_t i = 0; i < lon_trajectories.size(); ++i) {
+      EvaluateLonTrajectory(planning_target, stop_point, lon_trajectories[i],
+                            lat_trajectories, &paired_costs[i]);
+    }
+  }
+  for (auto& paired_cost : paired_costs) {
+    for (auto& pair_cost : paired_cost) {
+      cost_queue_.push(std::move(pair_cost));
     }
   }
+
+  const auto evaluation_end = std::chrono::system_clock::now();
+  std::chrono::duration<double> evaluation_diff =
+      evaluation_end - evaluation_start;
+  ADEBUG << "Trajectory pair evaluation used time: "
+         << evaluation_diff.count() * 1000 << " ms.";
   ADEBUG << "Number of valid 1d trajectory pairs: " << cost_queue_.size();
 }
 
+void TrajectoryEvaluator::EvaluateLonTrajectory(
+    const PlanningTarget& planning_target, const double stop_point,
+    const PtrTrajectory1d& lon_trajectory,
+    const std::vector<PtrTrajectory1d>& lat_trajectories,
+    std::vector<PairCost>* paired_costs) const {
+  double lon_end_s = lon_trajectory->Evaluate(0, FLAGS_trajectory_time_length);
+  if (init_s_[0] < stop_point &&
+      lon_end_s + FLAGS_lattice_stop_buffer > stop_point) {
+    return;
+  }
+
+  if (!ConstraintChecker1d::IsValidLongitudinalTrajectory(*lon_trajectory)) {
+    return;
+  }
+
+  // batch evaluate the longitudinal trajectory over the shared time grid
+  // once; everything below reuses these arrays instead of calling
+  // Evaluate() per point per pair
+  LonEvaluation lon_evaluation;
+  lon_trajectory->EvaluateBatch(0, time_grid_, &lon_evaluation.s);
+  lon_trajectory->EvaluateBatch(1, time_grid_, &lon_evaluation.s_dot);
+  lon_trajectory->EvaluateBatch(2, time_grid_, &lon_evaluation.s_dotdot);
+  lon_trajectory->EvaluateBatch(3, time_grid_, &lon_evaluation.jerk);
+
+  lon_evaluation.objective_cost = LonObjectiveCost(
+      lon_trajectory, planning_target, reference_s_dot_, lon_evaluation);
+  lon_evaluation.comfort_cost = LonComfortCost(lon_evaluation);
+  lon_evaluation.collision_cost = LonCollisionCost(lon_evaluation);
+  lon_evaluation.centripetal_acc_cost =
+      CentripetalAccelerationCost(lon_evaluation);
+
+  // decides the longitudinal evaluation horizon for lateral trajectories.
+  double evaluation_horizon =
+      std::min(FLAGS_speed_lon_decision_horizon,
+               lon_trajectory->Evaluate(0, lon_trajectory->ParamLength()));
+  std::vector<double> s_values;
+  for (double s = 0.0; s < evaluation_horizon;
+       s += FLAGS_trajectory_space_resolution) {
+    s_values.emplace_back(s);
+  }
+
+  std::vector<double> relative_s(lon_evaluation.s.size());
+  for (size_t i = 0; i < lon_evaluation.s.size(); ++i) {
+    relative_s[i] = lon_evaluation.s[i] - init_s_[0];
+  }
+
+  // all lateral candidates share the same two grids under this longitudinal
+  // trajectory, so evaluate them as one family per derivative order
+  std::vector<std::vector<double>> lat_offsets;
+  std::vector<std::vector<double>> lat_primes;
+  std::vector<std::vector<double>> lat_primeprimes;
+  Curve1d::EvaluateFamily(0, lat_trajectories, s_values, &lat_offsets);
+  Curve1d::EvaluateFamily(1, lat_trajectories, relative_s, &lat_primes);
+  Curve1d::EvaluateFamily(2, lat_trajectories, relative_s, &lat_primeprimes);
+
+  for (size_t i = 0; i < lat_trajectories.size(); ++i) {
+    /**
+     * The validity of the code needs to be verified.
+    if (!ConstraintChecker1d::IsValidLateralTrajectory(*lat_trajectories[i],
+                                                       *lon_trajectory)) {
+      continue;
+    }
+    */
+    double cost = Evaluate(lon_evaluation, lat_offsets[i], lat_primes[i],
+                           lat_primeprimes[i]);
+    paired_costs->emplace_back(
+        Trajectory1dPair(lon_trajectory, lat_trajectories[i]), cost);
+  }
+}
+
 bool TrajectoryEvaluator::has_more_trajectory_pairs() const {
   return !cost_queue_.empty();
 }
@@ -111,9 +209,9 @@ double TrajectoryEvaluator::top_trajectory_pair_cost() const {
 }
 
 double TrajectoryEvaluator::Evaluate(
-    const PlanningTarget& planning_target,
-    const PtrTrajectory1d& lon_trajectory,
-    const PtrTrajectory1d& lat_trajectory,
+    const LonEvaluation& lon_evaluation, const std::vector<double>& lat_offsets,
+    const std::vector<double>& lat_primes,
+    const std::vector<double>& lat_primeprimes,
     std::vector<double>* cost_components) const {
   // Costs:
   // 1. Cost of missing the objective, e.g., cruise, stop, etc.
@@ -122,54 +220,40 @@ double TrajectoryEvaluator::Evaluate(
   // 4. Cost of lateral offsets
   // 5. Cost of lateral comfort
 
-  // Longitudinal costs
-  double lon_objective_cost =
-      LonObjectiveCost(lon_trajectory, planning_target, reference_s_dot_);
-
-  double lon_jerk_cost = LonComfortCost(lon_trajectory);
-
-  double lon_collision_cost = LonCollisionCost(lon_trajectory);
-
-  double centripetal_acc_cost = CentripetalAccelerationCost(lon_trajectory);
-
-  // decides the longitudinal evaluation horizon for lateral trajectories.
-  double evaluation_horizon =
-      std::min(FLAGS_speed_lon_decision_horizon,
-               lon_trajectory->Evaluate(0, lon_trajectory->ParamLength()));
-  std::vector<double> s_values;
-  for (double s = 0.0; s < evaluation_horizon;
-       s += FLAGS_trajectory_space_resolution) {
-    s_values.emplace_back(s);
-  }
+  // Longitudinal costs are precomputed per longitudinal trajectory
 
   // Lateral costs
-  double lat_offset_cost = LatOffsetCost(lat_trajectory, s_values);
+  double lat_offset_cost = LatOffsetCost(lat_offsets);
 
-  double lat_comfort_cost = LatComfortCost(lon_trajectory, lat_trajectory);
+  double lat_comfort_cost =
+      LatComfortCost(lon_evaluation, lat_primes, lat_primeprimes);
 
   if (cost_components != nullptr) {
-    cost_components->emplace_back(lon_objective_cost);
-    cost_components->emplace_back(lon_jerk_cost);
-    cost_components->emplace_back(lon_collision_cost);
+    cost_components->emplace_back(lon_evaluation.objective_cost);
+    cost_components->emplace_back(lon_evaluation.comfort_cost);
+    cost_components->emplace_back(lon_evaluation.collision_cost);
     cost_components->emplace_back(lat_offset_cost);
   }
 
-  return lon_objective_cost * FLAGS_weight_lon_objective +
-         lon_jerk_cost * FLAGS_weight_lon_jerk +
-         lon_collision_cost * FLAGS_weight_lon_collision +
-         centripetal_acc_cost * FLAGS_weight_centripetal_acceleration +
+  return lon_evaluation.objective_cost * FLAGS_weight_lon_objective +
+         lon_evaluation.comfort_cost * FLAGS_weight_lon_jerk +
+         lon_evaluation.collision_cost * FLAGS_weight_lon_collision +
+         lon_evaluation.centripetal_acc_cost *
+             FLAGS_weight_centripetal_acceleration +
          lat_offset_cost * FLAGS_weight_lat_offset +
          lat_comfort_cost * FLAGS_weight_lat_comfort;
 }
 
 double TrajectoryEvaluator::LatOffsetCost(
-    const PtrTrajectory1d& lat_trajectory,
-    const std::vector<double>& s_values) const {
-  double lat_offset_start = lat_trajectory->Evaluate(0, 0.0);
+    const std::vector<double>& lat_offsets) const {
+  if (lat_offsets.empty()) {
+    return 0.0;
+  }
+  // the grid starts at s = 0.0, so the first entry is the start offset
+  double lat_offset_start = lat_offsets.front();
   double cost_sqr_sum = 0.0;
   double cost_abs_sum = 0.0;
-  for (const auto& s : s_values) {
-    double lat_offset = lat_trajectory->Evaluate(0, s);
+  for (const auto& lat_offset : lat_offsets) {
     double cost = lat_offset / FLAGS_lat_offset_bound;
     if (lat_offset * lat_offset_start < 0.0) {
       cost_sqr_sum += cost * cost * FLAGS_weight_opposite_side_offset;
@@ -183,32 +267,24 @@ double TrajectoryEvaluator::LatOffsetCost(
 }
 
 double TrajectoryEvaluator::LatComfortCost(
-    const PtrTrajectory1d& lon_trajectory,
-    const PtrTrajectory1d& lat_trajectory) const {
+    const LonEvaluation& lon_evaluation, const std::vector<double>& lat_primes,
+    const std::vector<double>& lat_primeprimes) const {
   double max_cost = 0.0;
-  for (double t = 0.0; t < FLAGS_trajectory_time_length;
-       t += FLAGS_trajectory_time_resolution) {
-    double s = lon_trajectory->Evaluate(0, t);
-    double s_dot = lon_trajectory->Evaluate(1, t);
-    double s_dotdot = lon_trajectory->Evaluate(2, t);
-
-    double relative_s = s - init_s_[0];
-    double l_prime = lat_trajectory->Evaluate(1, relative_s);
-    double l_primeprime = lat_trajectory->Evaluate(2, relative_s);
-    double cost = l_primeprime * s_dot * s_dot + l_prime * s_dotdot;
+  for (size_t i = 0; i < num_time_points_in_range_; ++i) {
+    double s_dot = lon_evaluation.s_dot[i];
+    double s_dotdot = lon_evaluation.s_dotdot[i];
+    double cost = lat_primeprimes[i] * s_dot * s_dot + lat_primes[i] * s_dotdot;
     max_cost = std::max(max_cost, std::fabs(cost));
   }
   return max_cost;
 }
 
 double TrajectoryEvaluator::LonComfortCost(
-    const PtrTrajectory1d& lon_trajectory) const {
+    const LonEvaluation& lon_evaluation) const {
   double cost_sqr_sum = 0.0;
   double cost_abs_sum = 0.0;
-  for (double t = 0.0; t < FLAGS_trajectory_time_length;
-       t += FLAGS_trajectory_time_resolution) {
-    double jerk = lon_trajectory->Evaluate(3, t);
-    double cost = jerk / FLAGS_longitudinal_jerk_upper_bound;
+  for (size_t i = 0; i < num_time_points_in_range_; ++i) {
+    double cost = lon_evaluation.jerk[i] / FLAGS_longitudinal_jerk_upper_bound;
     cost_sqr_sum += cost * cost;
     cost_abs_sum += std::fabs(cost);
   }
@@ -218,16 +294,19 @@ double TrajectoryEvaluator::LonComfortCost(
 double TrajectoryEvaluator::LonObjectiveCost(
     const PtrTrajectory1d& lon_trajectory,
     const PlanningTarget& planning_target,
-    const std::vector<double>& ref_s_dots) const {
+    const std::vector<double>& ref_s_dots,
+    const LonEvaluation& lon_evaluation) const {
   double t_max = lon_trajectory->ParamLength();
   double dist_s =
       lon_trajectory->Evaluate(0, t_max) - lon_trajectory->Evaluate(0, 0.0);
 
   double speed_cost_sqr_sum = 0.0;
   double speed_cost_weight_sum = 0.0;
-  for (size_t i = 0; i < ref_s_dots.size(); ++i) {
+  const size_t num_points =
+      std::min(ref_s_dots.size(), lon_evaluation.s_dot.size());
+  for (size_t i = 0; i < num_points; ++i) {
     double t = static_cast<double>(i) * FLAGS_trajectory_time_resolution;
-    double cost = ref_s_dots[i] - lon_trajectory->Evaluate(1, t);
+    double cost = ref_s_dots[i] - lon_evaluation.s_dot[i];
     speed_cost_sqr_sum += t * t * std::fabs(cost);
     speed_cost_weight_sum += t * t;
   }
@@ -242,16 +321,17 @@ double TrajectoryEvaluator::LonObjectiveCost(
 // TODO(all): consider putting pointer of reference_line_info and frame
 // while constructing trajectory evaluator
 double TrajectoryEvaluator::LonCollisionCost(
-    const PtrTrajectory1d& lon_trajectory) const {
+    const LonEvaluation& lon_evaluation) const {
   double cost_sqr_sum = 0.0;
   double cost_abs_sum = 0.0;
-  for (size_t i = 0; i < path_time_intervals_.size(); ++i) {
+  const size_t num_points =
+      std::min(path_time_intervals_.size(), lon_evaluation.s.size());
+  for (size_t i = 0; i < num_points; ++i) {
     const auto& pt_interval = path_time_intervals_[i];
     if (pt_interval.empty()) {
       continue;
     }
-    double t = static_cast<double>(i) * FLAGS_trajectory_time_resolution;
-    double traj_s = lon_trajectory->Evaluate(0, t);
+    double traj_s = lon_evaluation.s[i];
     double sigma = FLAGS_lon_collision_cost_std;
     for (const auto& m : pt_interval) {
       double dist = 0.0;
@@ -270,14 +350,13 @@ double TrajectoryEvaluator::LonCollisionCost(
 }
 
 double TrajectoryEvaluator::CentripetalAccelerationCost(
-    const PtrTrajectory1d& lon_trajectory) const {
+    const LonEvaluation& lon_evaluation) const {
   // Assumes the vehicle is not obviously deviate from the reference line.
   double centripetal_acc_sum = 0.0;
   double centripetal_acc_sqr_sum = 0.0;
-  for (double t = 0.0; t < FLAGS_trajectory_time_length;
-       t += FLAGS_trajectory_time_resolution) {
-    double s = lon_trajectory->Evaluate(0, t);
-    double v = lon_trajectory->Evaluate(1, t);
+  for (size_t i = 0; i < num_time_points_in_range_; ++i) {
+    double s = lon_evaluation.s[i];
+    double v = lon_evaluation.s_dot[i];
     PathPoint ref_point = PathMatcher::MatchToPath(*reference_line_, s);
     CHECK(ref_point.has_kappa());
     double centripetal_acc = v * v * ref_point.kappa();
@@ -69,27 +69,52 @@ class TrajectoryEvaluator {
   std::vector<double> top_trajectory_pair_component_cost() const;
 
  private:
-  double Evaluate(const PlanningTarget& planning_target,
-                  const std::shared_ptr<Curve1d>& lon_trajectory,
-                  const std::shared_ptr<Curve1d>& lat_trajectory,
+  // Batched evaluation of one longitudinal trajectory over the shared time
+  // grid, plus the pair-independent cost terms derived from it. Filled once
+  // per longitudinal trajectory and reused across all its pairs.
+  struct LonEvaluation {
+    std::vector<double> s;
+    std::vector<double> s_dot;
+    std::vector<double> s_dotdot;
+    std::vector<double> jerk;
+    double objective_cost = 0.0;
+    double comfort_cost = 0.0;
+    double collision_cost = 0.0;
+    double centripetal_acc_cost = 0.0;
+  };
+
+  // Evaluates the pairs sharing one longitudinal trajectory. The cheap
+  // longitudinal feasibility checks run first so that an invalid longitudinal
+  // trajectory prunes all its pairs before any cost is computed
+  void EvaluateLonTrajectory(
+      const PlanningTarget& planning_target, const double stop_point,
+      const std::shared_ptr<Curve1d>& lon_trajectory,
+      const std::vector<std::shared_ptr<Curve1d>>& lat_trajectories,
+      std::vector<PairCost>* paired_costs) const;
+
+  double Evaluate(const LonEvaluation& lon_evaluation,
+                  const std::vector<double>& lat_offsets,
+                  const std::vector<double>& lat_primes,
+                  const std::vector<double>& lat_primeprimes,
                   std::vector<double>* cost_components = nullptr) const;
 
-  double LatOffsetCost(const std::shared_ptr<Curve1d>& lat_trajectory,
-                       const std::vector<double>& s_values) const;
+  double LatOffsetCost(const std::vector<double>& lat_offsets) const;
 
-  double LatComfortCost(const std::shared_ptr<Curve1d>& lon_trajectory,
-                        const std::shared_ptr<Curve1d>& lat_trajectory) const;
+  double LatComfortCost(const LonEvaluation& lon_evaluation,
+                        const std::vector<double>& lat_primes,
+                        const std::vector<double>& lat_primeprimes) const;
 
-  double LonComfortCost(const std::shared_ptr<Curve1d>& lon_trajectory) const;
+  double LonComfortCost(const LonEvaluation& lon_evaluation) const;
 
-  double LonCollisionCost(const std::shared_ptr<Curve1d>& lon_trajectory) const;
+  double LonCollisionCost(const LonEvaluation& lon_evaluation) const;
 
   double LonObjectiveCost(const std::shared_ptr<Curve1d>& lon_trajectory,
                           const PlanningTarget& planning_target,
-                          const std::vector<double>& ref_s_dot) const;
+                          const std::vector<double>& ref_s_dot,
+                          const LonEvaluation& lon_evaluation) const;
 
   double CentripetalAccelerationCost(
-      const std::shared_ptr<Curve1d>& lon_trajectory) const;
+      const LonEvaluation& lon_evaluation) const;
 
   std::vector<double> ComputeLongitudinalGuideVelocity(
       const PlanningTarget& planning_target) const;
@@ -117,6 +142,13 @@ class TrajectoryEvaluator {
   std::array<double, 3> init_s_;
 
   std::vector<double> reference_s_dot_;
+
+  // shared evaluation time grid, matching the sampling of
+  // path_time_intervals_; the first num_time_points_in_range_ entries are
+  // strictly inside the trajectory time length
+  std::vector<double> time_grid_;
+
+  size_t num_time_points_in_range_ = 0;
 };
 
 }  // namespace planning
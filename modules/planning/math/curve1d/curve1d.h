@@ -20,7 +20,9 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace apollo {
 namespace planning {
@@ -36,6 +38,32 @@ class Curve1d {
   virtual double Evaluate(const std::uint32_t order,
                           const double param) const = 0;
 
+  // Evaluates the given derivative order over a whole parameter grid.
+  // The default implementation falls back to per-point Evaluate();
+  // polynomial curves override it with a vectorizable Horner sweep.
+  virtual void EvaluateBatch(const std::uint32_t order,
+                             const std::vector<double>& params,
+                             std::vector<double>* results) const {
+    results->resize(params.size());
+    for (size_t i = 0; i < params.size(); ++i) {
+      (*results)[i] = Evaluate(order, params[i]);
+    }
+  }
+
+  // Evaluates a family of curves over one shared parameter grid, one result
+  // row per curve. The rows are reused when the caller keeps the result
+  // matrix alive across calls.
+  static void EvaluateFamily(
+      const std::uint32_t order,
+      const std::vector<std::shared_ptr<Curve1d>>& curves,
+      const std::vector<double>& params,
+      std::vector<std::vector<double>>* results) {
+    results->resize(curves.size());
+    for (size_t i = 0; i < curves.size(); ++i) {
+      curves[i]->EvaluateBatch(order, params, &(*results)[i]);
+    }
+  }
+
   virtual double ParamLength() const = 0;
 
   virtual std::string ToString() const = 0;
@@ -76,6 +76,52 @@ double QuarticPolynomialCurve1d::Evaluate(const std::uint32_t order,
   }
 }
 
+void QuarticPolynomialCurve1d::EvaluateBatch(
+    const std::uint32_t order, const std::vector<double>& params,
+    std::vector<double>* results) const {
+  results->resize(params.size());
+  const size_t n = params.size();
+  const double* p = params.data();
+  double* r = results->data();
+  // copy the coefficients so the Horner sweeps below carry no aliasing with
+  // the output array and stay vectorizable
+  const std::array<double, 5> c = coef_;
+  switch (order) {
+    case 0: {
+      for (size_t i = 0; i < n; ++i) {
+        r[i] = (((c[4] * p[i] + c[3]) * p[i] + c[2]) * p[i] + c[1]) * p[i] +
+               c[0];
+      }
+      break;
+    }
+    case 1: {
+      for (size_t i = 0; i < n; ++i) {
+        r[i] = ((4.0 * c[4] * p[i] + 3.0 * c[3]) * p[i] + 2.0 * c[2]) * p[i] +
+               c[1];
+      }
+      break;
+    }
+    case 2: {
+      for (size_t i = 0; i < n; ++i) {
+        r[i] = (12.0 * c[4] * p[i] + 6.0 * c[3]) * p[i] + 2.0 * c[2];
+      }
+      break;
+    }
+    case 3: {
+      for (size_t i = 0; i < n; ++i) {
+        r[i] = 24.0 * c[4] * p[i] + 6.0 * c[3];
+      }
+      break;
+    }
+    default: {
+      for (size_t i = 0; i < n; ++i) {
+        r[i] = Evaluate(order, p[i]);
+      }
+      break;
+    }
+  }
+}
+
 QuarticPolynomialCurve1d& QuarticPolynomialCurve1d::FitWithEndPointFirstOrder(
     const double x0, const double dx0, const double ddx0, const double x1,
     const double dx1, const double p) {
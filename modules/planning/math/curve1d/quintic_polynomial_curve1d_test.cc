@@ -55,6 +55,22 @@ TEST(QuinticPolynomialCurve1dTest, basic_test) {
   EXPECT_NEAR(t, e_t, 1.0e-6);
 }
 
+TEST(QuinticPolynomialCurve1dTest, EvaluateBatch) {
+  QuinticPolynomialCurve1d curve(0.0, 1.0, 0.8, 10.0, 5.0, 0.0, 8.0);
+  std::vector<double> grid;
+  for (double t = 0.0; t < 8.0; t += 0.1) {
+    grid.push_back(t);
+  }
+  std::vector<double> values;
+  for (std::uint32_t order = 0; order <= 5; ++order) {
+    curve.EvaluateBatch(order, grid, &values);
+    ASSERT_EQ(grid.size(), values.size());
+    for (size_t i = 0; i < grid.size(); ++i) {
+      EXPECT_NEAR(curve.Evaluate(order, grid[i]), values[i], 1e-10);
+    }
+  }
+}
+
 TEST(QuinticPolynomialCurve1dTest, IntegratedFromQuarticCurve) {
   QuarticPolynomialCurve1d quartic_curve(2, 1, 4, 3, 2, 4);
   QuinticPolynomialCurve1d quintic_curve;
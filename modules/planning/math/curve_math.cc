@@ -47,5 +47,23 @@ double CurveMath::ComputeCurvatureDerivative(const double dx, const double d2x,
   return (b * d - 3.0 * a * c) / (d * d * d);
 }
 
+void CurveMath::ComputeCurvatureProfile(
+    const std::vector<double>& dx, const std::vector<double>& d2x,
+    const std::vector<double>& d3x, const std::vector<double>& dy,
+    const std::vector<double>& d2y, const std::vector<double>& d3y,
+    std::vector<double>* kappas, std::vector<double>* dkappas) {
+  const size_t n = dx.size();
+  kappas->resize(n);
+  dkappas->resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    const double a = dx[i] * d2y[i] - dy[i] * d2x[i];
+    const double b = dx[i] * d3y[i] - dy[i] * d3x[i];
+    const double c = dx[i] * d2x[i] + dy[i] * d2y[i];
+    const double d = dx[i] * dx[i] + dy[i] * dy[i];
+    (*kappas)[i] = a / (std::sqrt(d) * d);
+    (*dkappas)[i] = (b * d - 3.0 * a * c) / (d * d * d);
+  }
+}
+
 }  // namespace planning
 }  // namespace apollo
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <vector>
+
 namespace apollo {
 namespace planning {
 
@@ -53,6 +55,18 @@ class CurveMath {
   static double ComputeCurvatureDerivative(const double dx, const double d2x,
                                            const double d3x, const double dy,
                                            const double d2y, const double d3y);
+
+  /**
+   * @brief Batched variant computing kappa and dkappa over whole derivative
+   * arrays in one sweep. The cross and dot product terms are shared between
+   * the two quantities instead of being recomputed per call, and the loop is
+   * branch free so it vectorizes. All input arrays must have the same size.
+   */
+  static void ComputeCurvatureProfile(
+      const std::vector<double>& dx, const std::vector<double>& d2x,
+      const std::vector<double>& d3x, const std::vector<double>& dy,
+      const std::vector<double>& d2y, const std::vector<double>& d3y,
+      std::vector<double>* kappas, std::vector<double>* dkappas);
 };
 
 }  // namespace planning
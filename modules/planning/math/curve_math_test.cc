@@ -49,5 +49,40 @@ TEST(TestSuite, curvature_math_test) {
   EXPECT_NEAR(curvature_derivative, 0.0, 1e-6);
 }
 
+TEST(TestSuite, curvature_profile_parity_test) {
+  // Sample the unit circle X = (cos(t), sin(t)) and check the batched
+  // profile against the scalar versions point by point
+  std::vector<double> dx;
+  std::vector<double> d2x;
+  std::vector<double> d3x;
+  std::vector<double> dy;
+  std::vector<double> d2y;
+  std::vector<double> d3y;
+  for (double t = 0.0; t < 2.0 * M_PI; t += 0.1) {
+    dx.push_back(-sin(t));
+    d2x.push_back(-cos(t));
+    d3x.push_back(sin(t));
+    dy.push_back(cos(t));
+    d2y.push_back(-sin(t));
+    d3y.push_back(-cos(t));
+  }
+
+  std::vector<double> kappas;
+  std::vector<double> dkappas;
+  CurveMath::ComputeCurvatureProfile(dx, d2x, d3x, dy, d2y, d3y, &kappas,
+                                     &dkappas);
+  ASSERT_EQ(dx.size(), kappas.size());
+  ASSERT_EQ(dx.size(), dkappas.size());
+  for (size_t i = 0; i < dx.size(); ++i) {
+    EXPECT_NEAR(kappas[i],
+                CurveMath::ComputeCurvature(dx[i], d2x[i], dy[i], d2y[i]),
+                1e-12);
+    EXPECT_NEAR(dkappas[i],
+                CurveMath::ComputeCurvatureDerivative(dx[i], d2x[i], d3x[i],
+                                                      dy[i], d2y[i], d3y[i]),
+                1e-12);
+  }
+}
+
 }  // namespace planning
 }  // namespace apollo
@@ -41,40 +41,33 @@ bool DiscretePointsMath::ComputePathProfile(
   if (xy_points.size() < 2) {
     return false;
   }
-  std::vector<double> dxs;
-  std::vector<double> dys;
-  std::vector<double> y_over_s_first_derivatives;
-  std::vector<double> x_over_s_first_derivatives;
-  std::vector<double> y_over_s_second_derivatives;
-  std::vector<double> x_over_s_second_derivatives;
-
-  // Get finite difference approximated dx and dy for heading and kappa
-  // calculation
-  std::size_t points_size = xy_points.size();
-  for (std::size_t i = 0; i < points_size; ++i) {
-    double x_delta = 0.0;
-    double y_delta = 0.0;
-    if (i == 0) {
-      x_delta = (xy_points[i + 1].first - xy_points[i].first);
-      y_delta = (xy_points[i + 1].second - xy_points[i].second);
-    } else if (i == points_size - 1) {
-      x_delta = (xy_points[i].first - xy_points[i - 1].first);
-      y_delta = (xy_points[i].second - xy_points[i - 1].second);
-    } else {
-      x_delta = 0.5 * (xy_points[i + 1].first - xy_points[i - 1].first);
-      y_delta = 0.5 * (xy_points[i + 1].second - xy_points[i - 1].second);
-    }
-    dxs.push_back(x_delta);
-    dys.push_back(y_delta);
+  const std::size_t points_size = xy_points.size();
+
+  // Get finite difference approximated dx and dy for heading calculation.
+  // The boundary points are handled outside the loop so the sweep over the
+  // interior stays branch free
+  std::vector<double> dxs(points_size);
+  std::vector<double> dys(points_size);
+  dxs[0] = xy_points[1].first - xy_points[0].first;
+  dys[0] = xy_points[1].second - xy_points[0].second;
+  for (std::size_t i = 1; i + 1 < points_size; ++i) {
+    dxs[i] = 0.5 * (xy_points[i + 1].first - xy_points[i - 1].first);
+    dys[i] = 0.5 * (xy_points[i + 1].second - xy_points[i - 1].second);
   }
+  dxs[points_size - 1] =
+      xy_points[points_size - 1].first - xy_points[points_size - 2].first;
+  dys[points_size - 1] =
+      xy_points[points_size - 1].second - xy_points[points_size - 2].second;
 
   // Heading calculation
+  headings->reserve(points_size);
   for (std::size_t i = 0; i < points_size; ++i) {
     headings->push_back(std::atan2(dys[i], dxs[i]));
   }
 
   // Get linear interpolated s for dkappa calculation
   double distance = 0.0;
+  accumulated_s->reserve(points_size);
   accumulated_s->push_back(distance);
   double fx = xy_points[0].first;
   double fy = xy_points[0].second;
@@ -91,88 +84,86 @@ bool DiscretePointsMath::ComputePathProfile(
     fy = ny;
   }
 
+  // The first-derivative, second-derivative and dkappa differences below all
+  // divide by the same s spans, so invert each span once and share the
+  // reciprocals across the three sweeps
+  const std::vector<double>& s = *accumulated_s;
+  std::vector<double> inv_ds(points_size);
+  inv_ds[0] = 1.0 / (s[1] - s[0]);
+  for (std::size_t i = 1; i + 1 < points_size; ++i) {
+    inv_ds[i] = 1.0 / (s[i + 1] - s[i - 1]);
+  }
+  inv_ds[points_size - 1] = 1.0 / (s[points_size - 1] - s[points_size - 2]);
+
   // Get finite difference approximated first derivative of y and x respective
   // to s for kappa calculation
-  for (std::size_t i = 0; i < points_size; ++i) {
-    double xds = 0.0;
-    double yds = 0.0;
-    if (i == 0) {
-      xds = (xy_points[i + 1].first - xy_points[i].first) /
-            (accumulated_s->at(i + 1) - accumulated_s->at(i));
-      yds = (xy_points[i + 1].second - xy_points[i].second) /
-            (accumulated_s->at(i + 1) - accumulated_s->at(i));
-    } else if (i == points_size - 1) {
-      xds = (xy_points[i].first - xy_points[i - 1].first) /
-            (accumulated_s->at(i) - accumulated_s->at(i - 1));
-      yds = (xy_points[i].second - xy_points[i - 1].second) /
-            (accumulated_s->at(i) - accumulated_s->at(i - 1));
-    } else {
-      xds = (xy_points[i + 1].first - xy_points[i - 1].first) /
-            (accumulated_s->at(i + 1) - accumulated_s->at(i - 1));
-      yds = (xy_points[i + 1].second - xy_points[i - 1].second) /
-            (accumulated_s->at(i + 1) - accumulated_s->at(i - 1));
-    }
-    x_over_s_first_derivatives.push_back(xds);
-    y_over_s_first_derivatives.push_back(yds);
+  std::vector<double> x_over_s_first_derivatives(points_size);
+  std::vector<double> y_over_s_first_derivatives(points_size);
+  x_over_s_first_derivatives[0] =
+      (xy_points[1].first - xy_points[0].first) * inv_ds[0];
+  y_over_s_first_derivatives[0] =
+      (xy_points[1].second - xy_points[0].second) * inv_ds[0];
+  for (std::size_t i = 1; i + 1 < points_size; ++i) {
+    x_over_s_first_derivatives[i] =
+        (xy_points[i + 1].first - xy_points[i - 1].first) * inv_ds[i];
+    y_over_s_first_derivatives[i] =
+        (xy_points[i + 1].second - xy_points[i - 1].second) * inv_ds[i];
   }
+  x_over_s_first_derivatives[points_size - 1] =
+      (xy_points[points_size - 1].first - xy_points[points_size - 2].first) *
+      inv_ds[points_size - 1];
+  y_over_s_first_derivatives[points_size - 1] =
+      (xy_points[points_size - 1].second - xy_points[points_size - 2].second) *
+      inv_ds[points_size - 1];
 
   // Get finite difference approximated second derivative of y and x respective
   // to s for kappa calculation
-  for (std::size_t i = 0; i < points_size; ++i) {
-    double xdds = 0.0;
-    double ydds = 0.0;
-    if (i == 0) {
-      xdds =
-          (x_over_s_first_derivatives[i + 1] - x_over_s_first_derivatives[i]) /
-          (accumulated_s->at(i + 1) - accumulated_s->at(i));
-      ydds =
-          (y_over_s_first_derivatives[i + 1] - y_over_s_first_derivatives[i]) /
-          (accumulated_s->at(i + 1) - accumulated_s->at(i));
-    } else if (i == points_size - 1) {
-      xdds =
-          (x_over_s_first_derivatives[i] - x_over_s_first_derivatives[i - 1]) /
-          (accumulated_s->at(i) - accumulated_s->at(i - 1));
-      ydds =
-          (y_over_s_first_derivatives[i] - y_over_s_first_derivatives[i - 1]) /
-          (accumulated_s->at(i) - accumulated_s->at(i - 1));
-    } else {
-      xdds = (x_over_s_first_derivatives[i + 1] -
-              x_over_s_first_derivatives[i - 1]) /
-             (accumulated_s->at(i + 1) - accumulated_s->at(i - 1));
-      ydds = (y_over_s_first_derivatives[i + 1] -
-              y_over_s_first_derivatives[i - 1]) /
-             (accumulated_s->at(i + 1) - accumulated_s->at(i - 1));
-    }
-    x_over_s_second_derivatives.push_back(xdds);
-    y_over_s_second_derivatives.push_back(ydds);
+  std::vector<double> x_over_s_second_derivatives(points_size);
+  std::vector<double> y_over_s_second_derivatives(points_size);
+  x_over_s_second_derivatives[0] =
+      (x_over_s_first_derivatives[1] - x_over_s_first_derivatives[0]) *
+      inv_ds[0];
+  y_over_s_second_derivatives[0] =
+      (y_over_s_first_derivatives[1] - y_over_s_first_derivatives[0]) *
+      inv_ds[0];
+  for (std::size_t i = 1; i + 1 < points_size; ++i) {
+    x_over_s_second_derivatives[i] = (x_over_s_first_derivatives[i + 1] -
+                                      x_over_s_first_derivatives[i - 1]) *
+                                     inv_ds[i];
+    y_over_s_second_derivatives[i] = (y_over_s_first_derivatives[i + 1] -
+                                      y_over_s_first_derivatives[i - 1]) *
+                                     inv_ds[i];
   }
+  x_over_s_second_derivatives[points_size - 1] =
+      (x_over_s_first_derivatives[points_size - 1] -
+       x_over_s_first_derivatives[points_size - 2]) *
+      inv_ds[points_size - 1];
+  y_over_s_second_derivatives[points_size - 1] =
+      (y_over_s_first_derivatives[points_size - 1] -
+       y_over_s_first_derivatives[points_size - 2]) *
+      inv_ds[points_size - 1];
 
+  kappas->resize(points_size);
   for (std::size_t i = 0; i < points_size; ++i) {
     double xds = x_over_s_first_derivatives[i];
     double yds = y_over_s_first_derivatives[i];
     double xdds = x_over_s_second_derivatives[i];
     double ydds = y_over_s_second_derivatives[i];
-    double kappa =
+    (*kappas)[i] =
         (xds * ydds - yds * xdds) /
         (std::sqrt(xds * xds + yds * yds) * (xds * xds + yds * yds) + 1e-6);
-    kappas->push_back(kappa);
   }
 
   // Dkappa calculation
-  for (std::size_t i = 0; i < points_size; ++i) {
-    double dkappa = 0.0;
-    if (i == 0) {
-      dkappa = (kappas->at(i + 1) - kappas->at(i)) /
-               (accumulated_s->at(i + 1) - accumulated_s->at(i));
-    } else if (i == points_size - 1) {
-      dkappa = (kappas->at(i) - kappas->at(i - 1)) /
-               (accumulated_s->at(i) - accumulated_s->at(i - 1));
-    } else {
-      dkappa = (kappas->at(i + 1) - kappas->at(i - 1)) /
-               (accumulated_s->at(i + 1) - accumulated_s->at(i - 1));
-    }
-    dkappas->push_back(dkappa);
+  const std::vector<double>& kappa_values = *kappas;
+  dkappas->resize(points_size);
+  (*dkappas)[0] = (kappa_values[1] - kappa_values[0]) * inv_ds[0];
+  for (std::size_t i = 1; i + 1 < points_size; ++i) {
+    (*dkappas)[i] = (kappa_values[i + 1] - kappa_values[i - 1]) * inv_ds[i];
   }
+  (*dkappas)[points_size - 1] =
+      (kappa_values[points_size - 1] - kappa_values[points_size - 2]) *
+      inv_ds[points_size - 1];
   return true;
 }
 
@@ -0,0 +1,133 @@
+/******************************************************************************
+ * Copyright 2019 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file discrete_points_math_test.cc
+ **/
+
+#include "modules/planning/math/discrete_points_math.h"
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+namespace apollo {
+namespace planning {
+
+// Reference implementation of the profile computation with per-point
+// divisions, kept here to pin the accuracy of the batched sweeps in
+// ComputePathProfile against the straightforward scalar arithmetic
+namespace {
+
+void ScalarCentralDifference(const std::vector<double>& values,
+                             const std::vector<double>& s,
+                             std::vector<double>* derivatives) {
+  const std::size_t n = values.size();
+  derivatives->resize(n);
+  (*derivatives)[0] = (values[1] - values[0]) / (s[1] - s[0]);
+  for (std::size_t i = 1; i + 1 < n; ++i) {
+    (*derivatives)[i] = (values[i + 1] - values[i - 1]) / (s[i + 1] - s[i - 1]);
+  }
+  (*derivatives)[n - 1] =
+      (values[n - 1] - values[n - 2]) / (s[n - 1] - s[n - 2]);
+}
+
+}  // namespace
+
+TEST(DiscretePointsMathTest, profile_of_circle) {
+  const double radius = 10.0;
+  std::vector<std::pair<double, double>> xy_points;
+  for (double theta = 0.0; theta < M_PI; theta += 0.02) {
+    xy_points.emplace_back(radius * std::cos(theta), radius * std::sin(theta));
+  }
+
+  std::vector<double> headings;
+  std::vector<double> accumulated_s;
+  std::vector<double> kappas;
+  std::vector<double> dkappas;
+  ASSERT_TRUE(DiscretePointsMath::ComputePathProfile(
+      xy_points, &headings, &accumulated_s, &kappas, &dkappas));
+  ASSERT_EQ(xy_points.size(), headings.size());
+  ASSERT_EQ(xy_points.size(), accumulated_s.size());
+  ASSERT_EQ(xy_points.size(), kappas.size());
+  ASSERT_EQ(xy_points.size(), dkappas.size());
+
+  // skip the one-sided boundary points; the interior should recover the
+  // circle curvature and a flat curvature derivative
+  for (std::size_t i = 2; i + 2 < xy_points.size(); ++i) {
+    EXPECT_NEAR(std::fabs(kappas[i]), 1.0 / radius, 1e-3);
+    EXPECT_NEAR(dkappas[i], 0.0, 1e-3);
+    EXPECT_LT(accumulated_s[i], accumulated_s[i + 1]);
+  }
+}
+
+TEST(DiscretePointsMathTest, parity_with_scalar_differences) {
+  std::vector<std::pair<double, double>> xy_points;
+  for (double x = 0.0; x < 10.0; x += 0.25) {
+    xy_points.emplace_back(x, 0.1 * x * x + 0.5 * std::sin(x));
+  }
+
+  std::vector<double> headings;
+  std::vector<double> accumulated_s;
+  std::vector<double> kappas;
+  std::vector<double> dkappas;
+  ASSERT_TRUE(DiscretePointsMath::ComputePathProfile(
+      xy_points, &headings, &accumulated_s, &kappas, &dkappas));
+
+  std::vector<double> xs;
+  std::vector<double> ys;
+  for (const auto& point : xy_points) {
+    xs.push_back(point.first);
+    ys.push_back(point.second);
+  }
+  std::vector<double> xds;
+  std::vector<double> yds;
+  std::vector<double> xdds;
+  std::vector<double> ydds;
+  ScalarCentralDifference(xs, accumulated_s, &xds);
+  ScalarCentralDifference(ys, accumulated_s, &yds);
+  ScalarCentralDifference(xds, accumulated_s, &xdds);
+  ScalarCentralDifference(yds, accumulated_s, &ydds);
+
+  for (std::size_t i = 0; i < xy_points.size(); ++i) {
+    double expected_kappa =
+        (xds[i] * ydds[i] - yds[i] * xdds[i]) /
+        (std::sqrt(xds[i] * xds[i] + yds[i] * yds[i]) *
+             (xds[i] * xds[i] + yds[i] * yds[i]) +
+         1e-6);
+    EXPECT_NEAR(kappas[i], expected_kappa, 1e-12);
+  }
+
+  std::vector<double> expected_dkappas;
+  ScalarCentralDifference(kappas, accumulated_s, &expected_dkappas);
+  for (std::size_t i = 0; i < xy_points.size(); ++i) {
+    EXPECT_NEAR(dkappas[i], expected_dkappas[i], 1e-12);
+  }
+}
+
+TEST(DiscretePointsMathTest, too_few_points) {
+  std::vector<std::pair<double, double>> xy_points;
+  xy_points.emplace_back(0.0, 0.0);
+  std::vector<double> headings;
+  std::vector<double> accumulated_s;
+  std::vector<double> kappas;
+  std::vector<double> dkappas;
+  EXPECT_FALSE(DiscretePointsMath::ComputePathProfile(
+      xy_points, &headings, &accumulated_s, &kappas, &dkappas));
+}
+
+}  // namespace planning
+}  // namespace apollo
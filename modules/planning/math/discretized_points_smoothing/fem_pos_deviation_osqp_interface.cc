@@ -27,6 +27,10 @@
 namespace apollo {
 namespace planning {
 
+FemPosDeviationOsqpInterface::~FemPosDeviationOsqpInterface() {
+  FreeWorkspace();
+}
+
 bool FemPosDeviationOsqpInterface::Solve() {
   // Sanity Check
   if (ref_points_.empty()) {
@@ -54,56 +58,51 @@ bool FemPosDeviationOsqpInterface::Solve() {
   num_of_variables_ = num_of_points_ * 2;
   num_of_constraints_ = num_of_variables_;
 
-  // Calculate kernel
-  std::vector<c_float> P_data;
-  std::vector<c_int> P_indices;
-  std::vector<c_int> P_indptr;
-  CalculateKernel(&P_data, &P_indices, &P_indptr);
-
-  // Calculate affine constraints
-  std::vector<c_float> A_data;
-  std::vector<c_int> A_indices;
-  std::vector<c_int> A_indptr;
-  std::vector<c_float> lower_bounds;
-  std::vector<c_float> upper_bounds;
-  CalculateAffineConstraint(&A_data, &A_indices, &A_indptr, &lower_bounds,
-                            &upper_bounds);
-
   // Calculate offset
   std::vector<c_float> q;
   CalculateOffset(&q);
 
+  // Calculate constraint bounds
+  std::vector<c_float> lower_bounds;
+  std::vector<c_float> upper_bounds;
+  CalculateBounds(&lower_bounds, &upper_bounds);
+
   // Set primal warm start
   std::vector<c_float> primal_warm_start;
   SetPrimalWarmStart(&primal_warm_start);
 
-  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
-  OSQPSettings* settings =
-      reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
-
-  // Define Solver settings
-  osqp_set_default_settings(settings);
-  settings->max_iter = max_iter_;
-  settings->time_limit = time_limit_;
-  settings->verbose = verbose_;
-  settings->scaled_termination = scaled_termination_;
-  settings->warm_start = warm_start_;
+  // The kernel P and the constraint matrix A depend only on the number of
+  // points and on the weights. While those are unchanged between
+  // consecutive solves the workspace of the previous cycle is reused and
+  // only the offset and the bounds are refreshed; the primal variables
+  // are warm started on the current reference points and the dual
+  // variables carry over from the previous solve, so in steady state the
+  // solver converges in a few iterations instead of a cold solve
+  const bool reuse_workspace =
+      work_ != nullptr && num_of_points_ == cached_num_of_points_ &&
+      weight_fem_pos_deviation_ == cached_weight_fem_pos_deviation_ &&
+      weight_path_length_ == cached_weight_path_length_ &&
+      weight_ref_deviation_ == cached_weight_ref_deviation_;
+
+  if (reuse_workspace) {
+    osqp_update_lin_cost(work_, q.data());
+    osqp_update_bounds(work_, lower_bounds.data(), upper_bounds.data());
+  } else if (!SetupWorkspace(&q, &lower_bounds, &upper_bounds)) {
+    AERROR << "Failed to setup osqp workspace.";
+    return false;
+  }
 
-  OSQPWorkspace* work = nullptr;
-
-  bool res = OptimizeWithOsqp(num_of_variables_, lower_bounds.size(), &P_data,
-                              &P_indices, &P_indptr, &A_data, &A_indices,
-                              &A_indptr, &lower_bounds, &upper_bounds, &q,
-                              &primal_warm_start, data, &work, settings);
-  if (res == false || work == nullptr || work->solution == nullptr) {
-    AERROR << "Failed to find solution.";
-    // Cleanup
-    osqp_cleanup(work);
-    c_free(data->A);
-    c_free(data->P);
-    c_free(data);
-    c_free(settings);
+  osqp_warm_start_x(work_, primal_warm_start.data());
 
+  // Solve Problem
+  osqp_solve(work_);
+
+  auto status = work_->info->status_val;
+  if (status < 0 || (status != 1 && status != 2) ||
+      work_->solution == nullptr) {
+    AERROR << "failed optimization status:\t" << work_->info->status;
+    // do not carry the state of a failed solve into the next cycle
+    FreeWorkspace();
     return false;
   }
 
@@ -112,17 +111,10 @@ bool FemPosDeviationOsqpInterface::Solve() {
   y_.resize(num_of_points_);
   for (int i = 0; i < num_of_points_; ++i) {
     int index = i * 2;
-    x_.at(i) = work->solution->x[index];
-    y_.at(i) = work->solution->x[index + 1];
+    x_.at(i) = work_->solution->x[index];
+    y_.at(i) = work_->solution->x[index + 1];
   }
 
-  // Cleanup
-  osqp_cleanup(work);
-  c_free(data->A);
-  c_free(data->P);
-  c_free(data);
-  c_free(settings);
-
   return true;
 }
 
@@ -234,8 +226,7 @@ void FemPosDeviationOsqpInterface::CalculateOffset(std::vector<c_float>* q) {
 
 void FemPosDeviationOsqpInterface::CalculateAffineConstraint(
     std::vector<c_float>* A_data, std::vector<c_int>* A_indices,
-    std::vector<c_int>* A_indptr, std::vector<c_float>* lower_bounds,
-    std::vector<c_float>* upper_bounds) {
+    std::vector<c_int>* A_indptr) {
   int ind_A = 0;
   for (int i = 0; i < num_of_variables_; ++i) {
     A_data->push_back(1.0);
@@ -244,7 +235,10 @@ void FemPosDeviationOsqpInterface::CalculateAffineConstraint(
     ++ind_A;
   }
   A_indptr->push_back(ind_A);
+}
 
+void FemPosDeviationOsqpInterface::CalculateBounds(
+    std::vector<c_float>* lower_bounds, std::vector<c_float>* upper_bounds) {
   for (int i = 0; i < num_of_points_; ++i) {
     const auto& ref_point_xy = ref_points_[i];
     upper_bounds->push_back(ref_point_xy.first + bounds_around_refs_[i]);
@@ -263,47 +257,75 @@ void FemPosDeviationOsqpInterface::SetPrimalWarmStart(
   }
 }
 
-bool FemPosDeviationOsqpInterface::OptimizeWithOsqp(
-    const size_t kernel_dim, const size_t num_affine_constraint,
-    std::vector<c_float>* P_data, std::vector<c_int>* P_indices,
-    std::vector<c_int>* P_indptr, std::vector<c_float>* A_data,
-    std::vector<c_int>* A_indices, std::vector<c_int>* A_indptr,
-    std::vector<c_float>* lower_bounds, std::vector<c_float>* upper_bounds,
-    std::vector<c_float>* q, std::vector<c_float>* primal_warm_start,
-    OSQPData* data, OSQPWorkspace** work, OSQPSettings* settings) {
+bool FemPosDeviationOsqpInterface::SetupWorkspace(
+    std::vector<c_float>* q, std::vector<c_float>* lower_bounds,
+    std::vector<c_float>* upper_bounds) {
   CHECK_EQ(lower_bounds->size(), upper_bounds->size());
 
-  data->n = kernel_dim;
-  data->m = num_affine_constraint;
-  data->P = csc_matrix(data->n, data->n, P_data->size(), P_data->data(),
-                       P_indices->data(), P_indptr->data());
-  data->q = q->data();
-  data->A = csc_matrix(data->m, data->n, A_data->size(), A_data->data(),
-                       A_indices->data(), A_indptr->data());
-  data->l = lower_bounds->data();
-  data->u = upper_bounds->data();
+  FreeWorkspace();
 
-  *work = osqp_setup(data, settings);
+  // Calculate kernel
+  std::vector<c_float> P_data;
+  std::vector<c_int> P_indices;
+  std::vector<c_int> P_indptr;
+  CalculateKernel(&P_data, &P_indices, &P_indptr);
 
-  osqp_warm_start_x(*work, primal_warm_start->data());
+  // Calculate affine constraints
+  std::vector<c_float> A_data;
+  std::vector<c_int> A_indices;
+  std::vector<c_int> A_indptr;
+  CalculateAffineConstraint(&A_data, &A_indices, &A_indptr);
 
-  // Solve Problem
-  osqp_solve(*work);
+  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+  OSQPSettings* settings =
+      reinterpret_cast<OSQPSettings*>(c_malloc(sizeof(OSQPSettings)));
 
-  auto status = (*work)->info->status_val;
+  // Define Solver settings
+  osqp_set_default_settings(settings);
+  settings->max_iter = max_iter_;
+  settings->time_limit = time_limit_;
+  settings->verbose = verbose_;
+  settings->scaled_termination = scaled_termination_;
+  settings->warm_start = warm_start_;
 
-  if (status < 0) {
-    AERROR << "failed optimization status:\t" << (*work)->info->status;
-    return false;
-  }
+  data->n = num_of_variables_;
+  data->m = num_of_constraints_;
+  data->P = csc_matrix(data->n, data->n, P_data.size(), P_data.data(),
+                       P_indices.data(), P_indptr.data());
+  data->q = q->data();
+  data->A = csc_matrix(data->m, data->n, A_data.size(), A_data.data(),
+                       A_indices.data(), A_indptr.data());
+  data->l = lower_bounds->data();
+  data->u = upper_bounds->data();
 
-  if (status != 1 && status != 2) {
-    AERROR << "failed optimization status:\t" << (*work)->info->status;
+  work_ = osqp_setup(data, settings);
+
+  // osqp_setup copies the problem data into the workspace, so the csc
+  // wrappers and the settings can be released right away; only the
+  // workspace itself is kept for the next cycle
+  c_free(data->A);
+  c_free(data->P);
+  c_free(data);
+  c_free(settings);
+
+  if (work_ == nullptr) {
     return false;
   }
 
+  cached_num_of_points_ = num_of_points_;
+  cached_weight_fem_pos_deviation_ = weight_fem_pos_deviation_;
+  cached_weight_path_length_ = weight_path_length_;
+  cached_weight_ref_deviation_ = weight_ref_deviation_;
   return true;
 }
 
+void FemPosDeviationOsqpInterface::FreeWorkspace() {
+  if (work_ != nullptr) {
+    osqp_cleanup(work_);
+    work_ = nullptr;
+  }
+  cached_num_of_points_ = -1;
+}
+
 }  // namespace planning
 }  // namespace apollo
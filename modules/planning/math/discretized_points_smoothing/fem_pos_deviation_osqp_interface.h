@@ -32,7 +32,11 @@ class FemPosDeviationOsqpInterface {
  public:
   FemPosDeviationOsqpInterface() = default;
 
-  virtual ~FemPosDeviationOsqpInterface() = default;
+  FemPosDeviationOsqpInterface(const FemPosDeviationOsqpInterface&) = delete;
+  FemPosDeviationOsqpInterface& operator=(const FemPosDeviationOsqpInterface&) =
+      delete;
+
+  virtual ~FemPosDeviationOsqpInterface();
 
   void set_ref_points(
       const std::vector<std::pair<double, double>>& ref_points) {
@@ -82,20 +86,18 @@ class FemPosDeviationOsqpInterface {
 
   void CalculateAffineConstraint(std::vector<c_float>* A_data,
                                  std::vector<c_int>* A_indices,
-                                 std::vector<c_int>* A_indptr,
-                                 std::vector<c_float>* lower_bounds,
-                                 std::vector<c_float>* upper_bounds);
+                                 std::vector<c_int>* A_indptr);
+
+  void CalculateBounds(std::vector<c_float>* lower_bounds,
+                       std::vector<c_float>* upper_bounds);
 
   void SetPrimalWarmStart(std::vector<c_float>* primal_warm_start);
 
-  bool OptimizeWithOsqp(
-      const size_t kernel_dim, const size_t num_affine_constraint,
-      std::vector<c_float>* P_data, std::vector<c_int>* P_indices,
-      std::vector<c_int>* P_indptr, std::vector<c_float>* A_data,
-      std::vector<c_int>* A_indices, std::vector<c_int>* A_indptr,
-      std::vector<c_float>* lower_bounds, std::vector<c_float>* upper_bounds,
-      std::vector<c_float>* q, std::vector<c_float>* primal_warm_start,
-      OSQPData* data, OSQPWorkspace** work, OSQPSettings* settings);
+  bool SetupWorkspace(std::vector<c_float>* q,
+                      std::vector<c_float>* lower_bounds,
+                      std::vector<c_float>* upper_bounds);
+
+  void FreeWorkspace();
 
  private:
   // Reference points and deviation bounds
@@ -107,13 +109,26 @@ class FemPosDeviationOsqpInterface {
   double weight_path_length_ = 1.0;
   double weight_ref_deviation_ = 1.0;
 
-  // Settings of osqp
+  // Settings of osqp. They are baked into the workspace at setup time, so
+  // they should be configured before the first call to Solve()
   int max_iter_ = 4000;
   double time_limit_ = 0.0;
   bool verbose_ = false;
   bool scaled_termination_ = true;
   bool warm_start_ = true;
 
+  // Osqp workspace kept between calls to Solve(). The kernel P and the
+  // constraint matrix A depend only on the number of points and on the
+  // weights, so while those are unchanged consecutive solves reuse the
+  // workspace (and its factorization): only the offset and the bounds are
+  // refreshed and the dual variables of the previous solve serve as warm
+  // start
+  OSQPWorkspace* work_ = nullptr;
+  int cached_num_of_points_ = -1;
+  double cached_weight_fem_pos_deviation_ = 0.0;
+  double cached_weight_path_length_ = 0.0;
+  double cached_weight_ref_deviation_ = 0.0;
+
   // Optimization problem definitions
   int num_of_points_ = 0;
   int num_of_variables_ = 0;
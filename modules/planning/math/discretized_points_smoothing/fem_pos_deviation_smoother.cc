@@ -20,6 +20,8 @@
 
 #include "modules/planning/math/discretized_points_smoothing/fem_pos_deviation_smoother.h"
 
+#include <memory>
+
 #include <coin/IpIpoptApplication.hpp>
 #include <coin/IpSolveStatistics.hpp>
 
@@ -59,27 +61,32 @@ bool FemPosDeviationSmoother::QpWithOsqp(
     return false;
   }
 
-  FemPosDeviationOsqpInterface solver;
-
-  solver.set_weight_fem_pos_deviation(config_.weight_fem_pos_deviation());
-  solver.set_weight_path_length(config_.weight_path_length());
-  solver.set_weight_ref_deviation(config_.weight_ref_deviation());
-
-  solver.set_max_iter(config_.max_iter());
-  solver.set_time_limit(config_.time_limit());
-  solver.set_verbose(config_.verbose());
-  solver.set_scaled_termination(config_.scaled_termination());
-  solver.set_warm_start(config_.warm_start());
+  if (osqp_solver_ == nullptr) {
+    osqp_solver_ = std::make_unique<FemPosDeviationOsqpInterface>();
+
+    // weights and solver settings come from the config and do not change
+    // between cycles, so they are applied once
+    osqp_solver_->set_weight_fem_pos_deviation(
+        config_.weight_fem_pos_deviation());
+    osqp_solver_->set_weight_path_length(config_.weight_path_length());
+    osqp_solver_->set_weight_ref_deviation(config_.weight_ref_deviation());
+
+    osqp_solver_->set_max_iter(config_.max_iter());
+    osqp_solver_->set_time_limit(config_.time_limit());
+    osqp_solver_->set_verbose(config_.verbose());
+    osqp_solver_->set_scaled_termination(config_.scaled_termination());
+    osqp_solver_->set_warm_start(config_.warm_start());
+  }
 
-  solver.set_ref_points(raw_point2d);
-  solver.set_bounds_around_refs(bounds);
+  osqp_solver_->set_ref_points(raw_point2d);
+  osqp_solver_->set_bounds_around_refs(bounds);
 
-  if (!solver.Solve()) {
+  if (!osqp_solver_->Solve()) {
     return false;
   }
 
-  *opt_x = solver.opt_x();
-  *opt_y = solver.opt_y();
+  *opt_x = osqp_solver_->opt_x();
+  *opt_y = osqp_solver_->opt_y();
   return true;
 }
 
@@ -20,9 +20,11 @@
 
 #pragma once
 
+#include <memory>
 #include <utility>
 #include <vector>
 
+#include "modules/planning/math/discretized_points_smoothing/fem_pos_deviation_osqp_interface.h"
 #include "modules/planning/proto/fem_pos_deviation_smoother_config.pb.h"
 
 namespace apollo {
@@ -66,6 +68,11 @@ class FemPosDeviationSmoother {
 
  private:
   FemPosDeviationSmootherConfig config_;
+
+  // Created on the first qp smoothing and kept afterwards, so that the
+  // osqp workspace inside survives between cycles and consecutive solves
+  // warm start from each other
+  std::unique_ptr<FemPosDeviationOsqpInterface> osqp_solver_;
 };
 }  // namespace planning
 }  // namespace apollo
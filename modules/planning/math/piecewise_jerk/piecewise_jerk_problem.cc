@@ -47,7 +47,9 @@ PiecewiseJerkProblem::PiecewiseJerkProblem(
                      std::make_pair(-kMaxVariableRange, kMaxVariableRange));
 }
 
-OSQPData* PiecewiseJerkProblem::FormulateProblem() {
+PiecewiseJerkProblem::~PiecewiseJerkProblem() { FreeWorkspace(); }
+
+bool PiecewiseJerkProblem::Optimize(const int max_iter) {
   // calculate kernel
   std::vector<c_float> P_data;
   std::vector<c_int> P_indices;
@@ -67,69 +69,115 @@ OSQPData* PiecewiseJerkProblem::FormulateProblem() {
   std::vector<c_float> q;
   CalculateOffset(&q);
 
-  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
   CHECK_EQ(lower_bounds.size(), upper_bounds.size());
 
-  size_t kernel_dim = 3 * num_of_knots_;
-  size_t num_affine_constraint = lower_bounds.size();
-
-  data->n = kernel_dim;
-  data->m = num_affine_constraint;
-  data->P = csc_matrix(kernel_dim, kernel_dim, P_data.size(), CopyData(P_data),
-                       CopyData(P_indices), CopyData(P_indptr));
-  data->q = CopyData(q);
-  data->A =
-      csc_matrix(num_affine_constraint, kernel_dim, A_data.size(),
-                 CopyData(A_data), CopyData(A_indices), CopyData(A_indptr));
-  data->l = CopyData(lower_bounds);
-  data->u = CopyData(upper_bounds);
-  return data;
-}
-
-bool PiecewiseJerkProblem::Optimize(const int max_iter) {
-  OSQPData* data = FormulateProblem();
-
-  OSQPSettings* settings = SolverDefaultSettings();
-  settings->max_iter = max_iter;
-
-  OSQPWorkspace* osqp_work = osqp_setup(data, settings);
+  // The sparsity patterns of P and A are fixed for a given problem size,
+  // so when this problem object is kept alive across planning cycles the
+  // workspace of the previous solve is reused: only the matrix values,
+  // the offset and the bounds are refreshed, and osqp warm starts from
+  // the previous primal/dual solution
+  const bool reuse_workspace =
+      osqp_work_ != nullptr && num_of_knots_ == cached_num_of_knots_ &&
+      lower_bounds.size() == cached_num_of_constraints_ &&
+      P_data.size() == cached_p_nnz_ && A_data.size() == cached_a_nnz_;
+
+  if (reuse_workspace) {
+    osqp_update_max_iter(osqp_work_, max_iter);
+    osqp_update_P(osqp_work_, P_data.data(), OSQP_NULL, P_data.size());
+    osqp_update_lin_cost(osqp_work_, q.data());
+    osqp_update_bounds(osqp_work_, lower_bounds.data(), upper_bounds.data());
+  } else if (!SetupWorkspace(&P_data, &P_indices, &P_indptr, &A_data,
+                             &A_indices, &A_indptr, &q, &lower_bounds,
+                             &upper_bounds, max_iter)) {
+    AERROR << "Failed to setup osqp workspace";
+    return false;
+  }
 
-  osqp_solve(osqp_work);
+  osqp_solve(osqp_work_);
 
-  auto status = osqp_work->info->status_val;
+  auto status = osqp_work_->info->status_val;
 
   if (status < 0 || (status != 1 && status != 2)) {
-    AERROR << "failed optimization status:\t" << osqp_work->info->status;
-    osqp_cleanup(osqp_work);
-    FreeData(data);
-    c_free(settings);
+    AERROR << "failed optimization status:\t" << osqp_work_->info->status;
+    // do not carry the state of a failed solve into the next cycle
+    FreeWorkspace();
     return false;
-  } else if (osqp_work->solution == nullptr) {
+  } else if (osqp_work_->solution == nullptr) {
     AERROR << "The solution from OSQP is nullptr";
-    osqp_cleanup(osqp_work);
-    FreeData(data);
-    c_free(settings);
+    FreeWorkspace();
     return false;
   }
 
+  ADEBUG << "osqp solved in " << osqp_work_->info->iter << " iterations";
+
   // extract primal results
   x_.resize(num_of_knots_);
   dx_.resize(num_of_knots_);
   ddx_.resize(num_of_knots_);
   for (size_t i = 0; i < num_of_knots_; ++i) {
-    x_.at(i) = osqp_work->solution->x[i] / scale_factor_[0];
-    dx_.at(i) = osqp_work->solution->x[i + num_of_knots_] / scale_factor_[1];
+    x_.at(i) = osqp_work_->solution->x[i] / scale_factor_[0];
+    dx_.at(i) = osqp_work_->solution->x[i + num_of_knots_] / scale_factor_[1];
     ddx_.at(i) =
-        osqp_work->solution->x[i + 2 * num_of_knots_] / scale_factor_[2];
+        osqp_work_->solution->x[i + 2 * num_of_knots_] / scale_factor_[2];
   }
+  return true;
+}
+
+bool PiecewiseJerkProblem::SetupWorkspace(
+    std::vector<c_float>* P_data, std::vector<c_int>* P_indices,
+    std::vector<c_int>* P_indptr, std::vector<c_float>* A_data,
+    std::vector<c_int>* A_indices, std::vector<c_int>* A_indptr,
+    std::vector<c_float>* q, std::vector<c_float>* lower_bounds,
+    std::vector<c_float>* upper_bounds, const int max_iter) {
+  FreeWorkspace();
+
+  OSQPData* data = reinterpret_cast<OSQPData*>(c_malloc(sizeof(OSQPData)));
+
+  size_t kernel_dim = 3 * num_of_knots_;
+  size_t num_affine_constraint = lower_bounds->size();
+
+  data->n = kernel_dim;
+  data->m = num_affine_constraint;
+  data->P = csc_matrix(kernel_dim, kernel_dim, P_data->size(), P_data->data(),
+                       P_indices->data(), P_indptr->data());
+  data->q = q->data();
+  data->A = csc_matrix(num_affine_constraint, kernel_dim, A_data->size(),
+                       A_data->data(), A_indices->data(), A_indptr->data());
+  data->l = lower_bounds->data();
+  data->u = upper_bounds->data();
 
-  // Cleanup
-  osqp_cleanup(osqp_work);
-  FreeData(data);
+  OSQPSettings* settings = SolverDefaultSettings();
+  settings->max_iter = max_iter;
+
+  osqp_work_ = osqp_setup(data, settings);
+
+  // osqp_setup copies the problem data into the workspace, so the csc
+  // wrappers and the settings can be released right away; only the
+  // workspace itself is kept for the next solve
+  c_free(data->A);
+  c_free(data->P);
+  c_free(data);
   c_free(settings);
+
+  if (osqp_work_ == nullptr) {
+    return false;
+  }
+
+  cached_num_of_knots_ = num_of_knots_;
+  cached_num_of_constraints_ = num_affine_constraint;
+  cached_p_nnz_ = P_data->size();
+  cached_a_nnz_ = A_data->size();
   return true;
 }
 
+void PiecewiseJerkProblem::FreeWorkspace() {
+  if (osqp_work_ != nullptr) {
+    osqp_cleanup(osqp_work_);
+    osqp_work_ = nullptr;
+  }
+  cached_num_of_knots_ = 0;
+}
+
 void PiecewiseJerkProblem::CalculateAffineConstraint(
     std::vector<c_float>* A_data, std::vector<c_int>* A_indices,
     std::vector<c_int>* A_indptr, std::vector<c_float>* lower_bounds,
@@ -323,19 +371,5 @@ void PiecewiseJerkProblem::set_end_state_ref(
   has_end_state_ref_ = true;
 }
 
-void PiecewiseJerkProblem::FreeData(OSQPData* data) {
-  delete[] data->q;
-  delete[] data->l;
-  delete[] data->u;
-
-  delete[] data->P->i;
-  delete[] data->P->p;
-  delete[] data->P->x;
-
-  delete[] data->A->i;
-  delete[] data->A->p;
-  delete[] data->A->x;
-}
-
 }  // namespace planning
 }  // namespace apollo
@@ -51,7 +51,14 @@ class PiecewiseJerkProblem {
   PiecewiseJerkProblem(const size_t num_of_knots, const double delta_s,
                        const std::array<double, 3>& x_init);
 
-  virtual ~PiecewiseJerkProblem() = default;
+  PiecewiseJerkProblem(const PiecewiseJerkProblem&) = delete;
+  PiecewiseJerkProblem& operator=(const PiecewiseJerkProblem&) = delete;
+
+  virtual ~PiecewiseJerkProblem();
+
+  size_t num_of_knots() const { return num_of_knots_; }
+
+  void set_x_init(const std::array<double, 3>& x_init) { x_init_ = x_init; }
 
   void set_x_bounds(std::vector<std::pair<double, double>> x_bounds);
 
@@ -117,20 +124,32 @@ class PiecewiseJerkProblem {
 
   virtual OSQPSettings* SolverDefaultSettings();
 
-  OSQPData* FormulateProblem();
+  bool SetupWorkspace(std::vector<c_float>* P_data,
+                      std::vector<c_int>* P_indices,
+                      std::vector<c_int>* P_indptr,
+                      std::vector<c_float>* A_data,
+                      std::vector<c_int>* A_indices,
+                      std::vector<c_int>* A_indptr, std::vector<c_float>* q,
+                      std::vector<c_float>* lower_bounds,
+                      std::vector<c_float>* upper_bounds, const int max_iter);
 
-  void FreeData(OSQPData* data);
-
-  template <typename T>
-  T* CopyData(const std::vector<T>& vec) {
-    T* data = new T[vec.size()];
-    memcpy(data, vec.data(), sizeof(T) * vec.size());
-    return data;
-  }
+  void FreeWorkspace();
 
  protected:
   size_t num_of_knots_ = 0;
 
+  // Osqp workspace kept between calls to Optimize(). The sparsity
+  // patterns of P and A are fixed for a given problem size, so when this
+  // object is kept alive across planning cycles consecutive solves reuse
+  // the workspace (and its factorization): only the matrix values, the
+  // offset and the bounds are refreshed, and osqp warm starts from the
+  // previous primal/dual solution
+  OSQPWorkspace* osqp_work_ = nullptr;
+  size_t cached_num_of_knots_ = 0;
+  size_t cached_num_of_constraints_ = 0;
+  size_t cached_p_nnz_ = 0;
+  size_t cached_a_nnz_ = 0;
+
   // output
   std::vector<double> x_;
   std::vector<double> dx_;
@@ -20,6 +20,8 @@
 
 #include "modules/planning/math/smoothing_spline/affine_constraint.h"
 
+#include <utility>
+
 #include "cyber/common/log.h"
 
 namespace apollo {
@@ -42,10 +44,12 @@ void AffineConstraint::SetIsEquality(const double is_equality) {
 }
 
 const Eigen::MatrixXd& AffineConstraint::constraint_matrix() const {
+  MergePendingConstraints();
   return constraint_matrix_;
 }
 
 const Eigen::MatrixXd& AffineConstraint::constraint_boundary() const {
+  MergePendingConstraints();
   return constraint_boundary_;
 }
 
@@ -60,15 +64,19 @@ bool AffineConstraint::AddConstraint(
     return false;
   }
 
-  if (constraint_matrix_.rows() == 0) {
-    constraint_matrix_ = constraint_matrix;
-    constraint_boundary_ = constraint_boundary;
+  Eigen::Index existing_cols = constraint_matrix_.cols();
+  if (constraint_matrix_.rows() == 0 && !pending_constraint_matrices_.empty()) {
+    existing_cols = pending_constraint_matrices_.front().cols();
+  }
+  if (constraint_matrix_.rows() == 0 && pending_constraint_matrices_.empty()) {
+    pending_constraint_matrices_.push_back(constraint_matrix);
+    pending_constraint_boundaries_.push_back(constraint_boundary);
     return true;
   }
-  if (constraint_matrix_.cols() != constraint_matrix.cols()) {
+  if (existing_cols != constraint_matrix.cols()) {
     AERROR
         << "constraint_matrix_ cols and constraint_matrix cols do not match.";
-    AERROR << "constraint_matrix_.cols() = " << constraint_matrix_.cols();
+    AERROR << "constraint_matrix_.cols() = " << existing_cols;
     AERROR << "constraint_matrix.cols() = " << constraint_matrix.cols();
     return false;
   }
@@ -77,17 +85,42 @@ bool AffineConstraint::AddConstraint(
     return false;
   }
 
-  Eigen::MatrixXd n_matrix(constraint_matrix_.rows() + constraint_matrix.rows(),
-                           constraint_matrix_.cols());
-  Eigen::MatrixXd n_boundary(
-      constraint_boundary_.rows() + constraint_boundary.rows(), 1);
-
-  n_matrix << constraint_matrix_, constraint_matrix;
-  n_boundary << constraint_boundary_, constraint_boundary;
-  constraint_matrix_ = n_matrix;
-  constraint_boundary_ = n_boundary;
+  pending_constraint_matrices_.push_back(constraint_matrix);
+  pending_constraint_boundaries_.push_back(constraint_boundary);
   return true;
 }
 
+void AffineConstraint::MergePendingConstraints() const {
+  if (pending_constraint_matrices_.empty()) {
+    return;
+  }
+  Eigen::Index total_rows = constraint_matrix_.rows();
+  for (const auto& pending_matrix : pending_constraint_matrices_) {
+    total_rows += pending_matrix.rows();
+  }
+  const Eigen::Index cols = constraint_matrix_.rows() > 0
+                                ? constraint_matrix_.cols()
+                                : pending_constraint_matrices_.front().cols();
+
+  Eigen::MatrixXd merged_matrix(total_rows, cols);
+  Eigen::MatrixXd merged_boundary(total_rows, 1);
+  Eigen::Index row = constraint_matrix_.rows();
+  if (row > 0) {
+    merged_matrix.topRows(row) = constraint_matrix_;
+    merged_boundary.topRows(row) = constraint_boundary_;
+  }
+  for (size_t i = 0; i < pending_constraint_matrices_.size(); ++i) {
+    const auto& pending_matrix = pending_constraint_matrices_[i];
+    merged_matrix.block(row, 0, pending_matrix.rows(), cols) = pending_matrix;
+    merged_boundary.block(row, 0, pending_matrix.rows(), 1) =
+        pending_constraint_boundaries_[i];
+    row += pending_matrix.rows();
+  }
+  constraint_matrix_ = std::move(merged_matrix);
+  constraint_boundary_ = std::move(merged_boundary);
+  pending_constraint_matrices_.clear();
+  pending_constraint_boundaries_.clear();
+}
+
 }  // namespace planning
 }  // namespace apollo
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "Eigen/Core"
 #include "modules/planning/math/polynomial_xd.h"
 
@@ -42,8 +44,15 @@ class AffineConstraint {
                      const Eigen::MatrixXd& constraint_boundary);
 
  private:
-  Eigen::MatrixXd constraint_matrix_;
-  Eigen::MatrixXd constraint_boundary_;
+  // Merge the chunks pending from AddConstraint into constraint_matrix_ and
+  // constraint_boundary_. Appending m chunks then costs one linear copy on
+  // the next read instead of m quadratically growing concatenations.
+  void MergePendingConstraints() const;
+
+  mutable Eigen::MatrixXd constraint_matrix_;
+  mutable Eigen::MatrixXd constraint_boundary_;
+  mutable std::vector<Eigen::MatrixXd> pending_constraint_matrices_;
+  mutable std::vector<Eigen::MatrixXd> pending_constraint_boundaries_;
   bool is_equality_ = true;
 };
 
@@ -478,8 +478,12 @@ std::vector<double> Spline2dConstraint::AffineCoef(const double angle,
                                                    const double t) const {
   const uint32_t num_params = spline_order_ + 1;
   std::vector<double> result(num_params * 2, 0.0);
-  double x_coef = -common::math::sin(common::math::Angle16::from_rad(angle));
-  double y_coef = common::math::cos(common::math::Angle16::from_rad(angle));
+  float sin_angle = 0.0f;
+  float cos_angle = 0.0f;
+  common::math::sin_cos(common::math::Angle16::from_rad(angle), &sin_angle,
+                        &cos_angle);
+  double x_coef = -sin_angle;
+  double y_coef = cos_angle;
   for (uint32_t i = 0; i < num_params; ++i) {
     result[i] = x_coef;
     result[i + num_params] = y_coef;
@@ -493,8 +497,12 @@ std::vector<double> Spline2dConstraint::AffineDerivativeCoef(
     const double angle, const double t) const {
   const uint32_t num_params = spline_order_ + 1;
   std::vector<double> result(num_params * 2, 0.0);
-  double x_coef = -common::math::sin(common::math::Angle16::from_rad(angle));
-  double y_coef = common::math::cos(common::math::Angle16::from_rad(angle));
+  float sin_angle = 0.0f;
+  float cos_angle = 0.0f;
+  common::math::sin_cos(common::math::Angle16::from_rad(angle), &sin_angle,
+                        &cos_angle);
+  double x_coef = -sin_angle;
+  double y_coef = cos_angle;
   std::vector<double> power_t = PolyCoef(t);
   for (uint32_t i = 1; i < num_params; ++i) {
     result[i] = x_coef * power_t[i - 1] * i;
@@ -507,8 +515,12 @@ std::vector<double> Spline2dConstraint::AffineSecondDerivativeCoef(
     const double angle, const double t) const {
   const uint32_t num_params = spline_order_ + 1;
   std::vector<double> result(num_params * 2, 0.0);
-  double x_coef = -common::math::sin(common::math::Angle16::from_rad(angle));
-  double y_coef = common::math::cos(common::math::Angle16::from_rad(angle));
+  float sin_angle = 0.0f;
+  float cos_angle = 0.0f;
+  common::math::sin_cos(common::math::Angle16::from_rad(angle), &sin_angle,
+                        &cos_angle);
+  double x_coef = -sin_angle;
+  double y_coef = cos_angle;
   std::vector<double> power_t = PolyCoef(t);
   for (uint32_t i = 2; i < num_params; ++i) {
     result[i] = x_coef * power_t[i - 2] * i * (i - 1);
@@ -521,8 +533,12 @@ std::vector<double> Spline2dConstraint::AffineThirdDerivativeCoef(
     const double angle, const double t) const {
   const uint32_t num_params = spline_order_ + 1;
   std::vector<double> result(num_params * 2, 0.0);
-  double x_coef = -common::math::sin(common::math::Angle16::from_rad(angle));
-  double y_coef = common::math::cos(common::math::Angle16::from_rad(angle));
+  float sin_angle = 0.0f;
+  float cos_angle = 0.0f;
+  common::math::sin_cos(common::math::Angle16::from_rad(angle), &sin_angle,
+                        &cos_angle);
+  double x_coef = -sin_angle;
+  double y_coef = cos_angle;
   std::vector<double> power_t = PolyCoef(t);
   for (uint32_t i = 3; i < num_params; ++i) {
     result[i] = x_coef * power_t[i - 3] * i * (i - 1) * (i - 2);
@@ -533,10 +549,12 @@ std::vector<double> Spline2dConstraint::AffineThirdDerivativeCoef(
 
 double Spline2dConstraint::SignDistance(const Vec2d& xy_point,
                                         const double angle) const {
-  return common::math::InnerProd(
-      xy_point.x(), xy_point.y(),
-      -common::math::sin(common::math::Angle16::from_rad(angle)),
-      common::math::cos(common::math::Angle16::from_rad(angle)));
+  float sin_angle = 0.0f;
+  float cos_angle = 0.0f;
+  common::math::sin_cos(common::math::Angle16::from_rad(angle), &sin_angle,
+                        &cos_angle);
+  return common::math::InnerProd(xy_point.x(), xy_point.y(), -sin_angle,
+                                 cos_angle);
 }
 
 std::vector<double> Spline2dConstraint::PolyCoef(const double t) const {
@@ -259,9 +259,9 @@ void NaviPlanning::RunOnce(const LocalView& local_view,
     ProcessPadMsg(pad_msg_driving_action);
   }
 
+  TrafficDecider traffic_decider;
+  traffic_decider.Init(traffic_rule_configs_);
   for (auto& ref_line_info : *frame_->mutable_reference_line_info()) {
-    TrafficDecider traffic_decider;
-    traffic_decider.Init(traffic_rule_configs_);
     auto traffic_status = traffic_decider.Execute(frame_.get(), &ref_line_info);
     if (!traffic_status.ok() || !ref_line_info.IsDrivable()) {
       ref_line_info.SetDrivable(false);
@@ -36,6 +36,7 @@
 #include "modules/planning/common/history.h"
 #include "modules/planning/common/planning_context.h"
 #include "modules/planning/common/planning_gflags.h"
+#include "modules/planning/common/speed_profile_generator.h"
 #include "modules/planning/common/trajectory_stitcher.h"
 #include "modules/planning/common/util/util.h"
 #include "modules/planning/planner/rtk/rtk_replay_planner.h"
@@ -91,6 +92,10 @@ Status OnLanePlanning::Init(const PlanningConfig& config) {
       << "Failed to load traffic rule config file "
       << FLAGS_traffic_rule_config_filename;
 
+  // precompute the fallback speed profile library so that overrun cycles
+  // only interpolate
+  SpeedProfileGenerator::InitFallbackProfileLibrary();
+
   // clear planning history
   History::Instance()->Clear();
 
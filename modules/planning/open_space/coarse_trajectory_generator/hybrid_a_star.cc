@@ -700,20 +700,46 @@ bool HybridAStar::Plan(
     const double rs_end_time = Clock::NowInSeconds();
     rs_time += rs_end_time - rs_start_time;
     close_set_.emplace(current_node->GetIndex(), current_node);
-    for (size_t i = 0; i < next_node_num_; ++i) {
-      std::shared_ptr<Node3d> next_node = Next_node_generator(current_node, i);
-      // boundary check failure handle
+    // batch the successor generation and the collision checks of one
+    // expansion; with the parallel flag on they are spread across the
+    // worker pool while the open/close set bookkeeping stays on the
+    // search thread
+    std::vector<std::shared_ptr<Node3d>> next_nodes(next_node_num_);
+    if (FLAGS_enable_parallel_hybrid_a) {
+      const int node_num = static_cast<int>(next_node_num_);
+#pragma omp parallel for schedule(dynamic, 2) num_threads(8)
+      for (int i = 0; i < node_num; ++i) {
+        std::shared_ptr<Node3d> next_node =
+            Next_node_generator(current_node, static_cast<size_t>(i));
+        if (next_node != nullptr && ValidityCheck(next_node)) {
+          next_nodes[i] = next_node;
+        }
+      }
+    } else {
+      for (size_t i = 0; i < next_node_num_; ++i) {
+        std::shared_ptr<Node3d> next_node =
+            Next_node_generator(current_node, i);
+        // boundary check failure handle
+        if (next_node == nullptr) {
+          continue;
+        }
+        // check if the node is already in the close set
+        if (close_set_.find(next_node->GetIndex()) != close_set_.end()) {
+          continue;
+        }
+        // collision check
+        if (ValidityCheck(next_node)) {
+          next_nodes[i] = next_node;
+        }
+      }
+    }
+    for (auto& next_node : next_nodes) {
       if (next_node == nullptr) {
         continue;
       }
-      // check if the node is already in the close set
       if (close_set_.find(next_node->GetIndex()) != close_set_.end()) {
         continue;
       }
-      // collision check
-      if (!ValidityCheck(next_node)) {
-        continue;
-      }
       if (open_set_.find(next_node->GetIndex()) == open_set_.end()) {
         explored_node_num++;
         const double start_time = Clock::NowInSeconds();
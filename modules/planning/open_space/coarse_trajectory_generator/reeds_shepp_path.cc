@@ -54,9 +54,64 @@ std::pair<double, double> ReedShepp::calc_tau_omega(const double u,
   return std::make_pair(tau, omega);
 }
 
+std::string ReedShepp::RSPKey(const std::shared_ptr<Node3d> start_node,
+                              const std::shared_ptr<Node3d> end_node) const {
+  double dx = end_node->GetX() - start_node->GetX();
+  double dy = end_node->GetY() - start_node->GetY();
+  double dphi = end_node->GetPhi() - start_node->GetPhi();
+  double c = std::cos(start_node->GetPhi());
+  double s = std::sin(start_node->GetPhi());
+  // normalize the relative pose the same way GenerateRSP() does, so that
+  // queries mapping to the same scaled configuration share a cache entry
+  double x = (c * dx + s * dy) * max_kappa_;
+  double y = (-s * dx + c * dy) * max_kappa_;
+  // quantization fine enough that a cached segment combination re-sampled
+  // from the true start stays within the end configuration tolerance
+  static constexpr double kQuantResolution = 1e-4;
+  const int64_t kx = std::lround(x / kQuantResolution);
+  const int64_t ky = std::lround(y / kQuantResolution);
+  const int64_t kphi = std::lround(dphi / kQuantResolution);
+  return std::to_string(kx) + "_" + std::to_string(ky) + "_" +
+         std::to_string(kphi);
+}
+
+bool ReedShepp::CheckRSPEndPose(const std::shared_ptr<Node3d> end_node,
+                                const ReedSheppPath& path) const {
+  if (std::abs(path.x.back() - end_node->GetX()) > 1e-3 ||
+      std::abs(path.y.back() - end_node->GetY()) > 1e-3 ||
+      std::abs(path.phi.back() - end_node->GetPhi()) > 1e-3) {
+    ADEBUG << "RSP end position not right";
+    for (size_t i = 0; i < path.segs_types.size(); ++i) {
+      ADEBUG << "types are " << path.segs_types[i];
+    }
+    ADEBUG << "x, y, phi are: " << path.x.back() << ", " << path.y.back()
+           << ", " << path.phi.back();
+    ADEBUG << "end x, y, phi are: " << end_node->GetX() << ", "
+           << end_node->GetY() << ", " << end_node->GetPhi();
+    return false;
+  }
+  return true;
+}
+
 bool ReedShepp::ShortestRSP(const std::shared_ptr<Node3d> start_node,
                             const std::shared_ptr<Node3d> end_node,
                             std::shared_ptr<ReedSheppPath> optimal_path) {
+  const std::string cache_key = RSPKey(start_node, end_node);
+  ReedSheppPath* cached = rsp_cache_.Get(cache_key);
+  if (cached != nullptr) {
+    ReedSheppPath candidate;
+    candidate.segs_types = cached->segs_types;
+    candidate.segs_lengths = cached->segs_lengths;
+    candidate.total_length = cached->total_length;
+    if (GenerateLocalConfigurations(start_node, end_node, &candidate) &&
+        CheckRSPEndPose(end_node, candidate)) {
+      *optimal_path = std::move(candidate);
+      return true;
+    }
+    // the cached combination missed the end configuration because of
+    // quantization error; fall through to the full search
+  }
+
   std::vector<ReedSheppPath> all_possible_paths;
   if (!GenerateRSPs(start_node, end_node, &all_possible_paths)) {
     ADEBUG << "Fail to generate different combination of Reed Shepp "
@@ -81,24 +136,7 @@ bool ReedShepp::ShortestRSP(const std::shared_ptr<Node3d> start_node,
     return false;
   }
 
-  if (std::abs(all_possible_paths[optimal_path_index].x.back() -
-               end_node->GetX()) > 1e-3 ||
-      std::abs(all_possible_paths[optimal_path_index].y.back() -
-               end_node->GetY()) > 1e-3 ||
-      std::abs(all_possible_paths[optimal_path_index].phi.back() -
-               end_node->GetPhi()) > 1e-3) {
-    ADEBUG << "RSP end position not right";
-    for (size_t i = 0;
-         i < all_possible_paths[optimal_path_index].segs_types.size(); ++i) {
-      ADEBUG << "types are "
-             << all_possible_paths[optimal_path_index].segs_types[i];
-    }
-    ADEBUG << "x, y, phi are: "
-           << all_possible_paths[optimal_path_index].x.back() << ", "
-           << all_possible_paths[optimal_path_index].y.back() << ", "
-           << all_possible_paths[optimal_path_index].phi.back();
-    ADEBUG << "end x, y, phi are: " << end_node->GetX() << ", "
-           << end_node->GetY() << ", " << end_node->GetPhi();
+  if (!CheckRSPEndPose(end_node, all_possible_paths[optimal_path_index])) {
     return false;
   }
   (*optimal_path).x = all_possible_paths[optimal_path_index].x;
@@ -111,6 +149,14 @@ bool ReedShepp::ShortestRSP(const std::shared_ptr<Node3d> start_node,
       all_possible_paths[optimal_path_index].segs_types;
   (*optimal_path).segs_lengths =
       all_possible_paths[optimal_path_index].segs_lengths;
+
+  // cache the segment combination only; the local configurations are
+  // cheap to re-sample and depend on the absolute start pose
+  ReedSheppPath cache_entry;
+  cache_entry.segs_types = optimal_path->segs_types;
+  cache_entry.segs_lengths = optimal_path->segs_lengths;
+  cache_entry.total_length = optimal_path->total_length;
+  rsp_cache_.Put(cache_key, std::move(cache_entry));
   return true;
 }
 
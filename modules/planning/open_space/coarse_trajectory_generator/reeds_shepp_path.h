@@ -32,6 +32,7 @@
 #include "cyber/common/macros.h"
 #include "modules/common/configs/proto/vehicle_config.pb.h"
 #include "modules/common/math/math_utils.h"
+#include "modules/common/util/lru_cache.h"
 #include "modules/planning/open_space/coarse_trajectory_generator/node3d.h"
 #include "modules/planning/proto/planner_open_space_config.pb.h"
 
@@ -126,11 +127,28 @@ class ReedShepp {
   std::pair<double, double> calc_tau_omega(const double u, const double v,
                                            const double xi, const double eta,
                                            const double phi);
+  // Quantized start-to-end relative pose used as cache key; the segment
+  // combination of an RSP depends on the relative pose only
+  std::string RSPKey(const std::shared_ptr<Node3d> start_node,
+                     const std::shared_ptr<Node3d> end_node) const;
+  // End configuration check shared by cached and freshly generated paths
+  bool CheckRSPEndPose(const std::shared_ptr<Node3d> end_node,
+                       const ReedSheppPath& path) const;
 
  protected:
   common::VehicleParam vehicle_param_;
   PlannerOpenSpaceConfig planner_open_space_config_;
   double max_kappa_;
+
+  // Cache of recently used segment combinations keyed on the quantized
+  // relative pose. Replans of the same scene (e.g. a stopped vehicle
+  // retrying a valet parking search) issue the analytic expansion with
+  // identical queries over and over; on a hit only the local
+  // configurations are re-sampled from the true start pose and the end
+  // configuration check guards against quantization error
+  static constexpr size_t kRSPCacheCapacity = 10000;
+  common::util::LRUCache<std::string, ReedSheppPath> rsp_cache_{
+      kRSPCacheCapacity};
 };
 }  // namespace planning
 }  // namespace apollo
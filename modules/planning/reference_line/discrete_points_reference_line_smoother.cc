@@ -17,6 +17,7 @@
 #include "modules/planning/reference_line/discrete_points_reference_line_smoother.h"
 
 #include <algorithm>
+#include <memory>
 
 #include "cyber/common/file.h"
 #include "cyber/common/log.h"
@@ -156,7 +157,10 @@ bool DiscretePointsReferenceLineSmoother::FemPosSmooth(
   const auto& fem_pos_config =
       config_.discrete_points().fem_pos_deviation_smoothing();
 
-  FemPosDeviationSmoother smoother(fem_pos_config);
+  if (fem_pos_smoother_ == nullptr) {
+    fem_pos_smoother_ = std::make_unique<FemPosDeviationSmoother>(
+        fem_pos_config);
+  }
 
   // box contraints on pos are used in fem pos smoother, thus shrink the
   // bounds by 1.0 / sqrt(2.0)
@@ -168,7 +172,8 @@ bool DiscretePointsReferenceLineSmoother::FemPosSmooth(
 
   std::vector<double> opt_x;
   std::vector<double> opt_y;
-  bool status = smoother.Solve(raw_point2d, box_bounds, &opt_x, &opt_y);
+  bool status =
+      fem_pos_smoother_->Solve(raw_point2d, box_bounds, &opt_x, &opt_y);
 
   if (!status) {
     AERROR << "Fem Pos reference line smoothing failed";
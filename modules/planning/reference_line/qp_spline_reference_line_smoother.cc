@@ -91,19 +91,37 @@ bool QpSplineReferenceLineSmoother::Smooth(
   double t = start_t;
   std::vector<ReferencePoint> ref_points;
   const auto& spline = spline_solver_->spline();
+
+  // gather the spline derivatives once per point, then compute kappa and
+  // dkappa for the whole line in one batched sweep
+  std::vector<double> ts;
+  std::vector<double> dxs;
+  std::vector<double> d2xs;
+  std::vector<double> d3xs;
+  std::vector<double> dys;
+  std::vector<double> d2ys;
+  std::vector<double> d3ys;
   for (std::uint32_t i = 0; i < config_.num_of_total_points() && t < end_t;
        ++i, t += resolution) {
-    const double heading =
-        std::atan2(spline.DerivativeY(t), spline.DerivativeX(t));
-    const double kappa = CurveMath::ComputeCurvature(
-        spline.DerivativeX(t), spline.SecondDerivativeX(t),
-        spline.DerivativeY(t), spline.SecondDerivativeY(t));
-    const double dkappa = CurveMath::ComputeCurvatureDerivative(
-        spline.DerivativeX(t), spline.SecondDerivativeX(t),
-        spline.ThirdDerivativeX(t), spline.DerivativeY(t),
-        spline.SecondDerivativeY(t), spline.ThirdDerivativeY(t));
-
-    std::pair<double, double> xy = spline(t);
+    ts.push_back(t);
+    dxs.push_back(spline.DerivativeX(t));
+    d2xs.push_back(spline.SecondDerivativeX(t));
+    d3xs.push_back(spline.ThirdDerivativeX(t));
+    dys.push_back(spline.DerivativeY(t));
+    d2ys.push_back(spline.SecondDerivativeY(t));
+    d3ys.push_back(spline.ThirdDerivativeY(t));
+  }
+  std::vector<double> kappas;
+  std::vector<double> dkappas;
+  CurveMath::ComputeCurvatureProfile(dxs, d2xs, d3xs, dys, d2ys, d3ys, &kappas,
+                                     &dkappas);
+
+  for (std::size_t i = 0; i < ts.size(); ++i) {
+    const double heading = std::atan2(dys[i], dxs[i]);
+    const double kappa = kappas[i];
+    const double dkappa = dkappas[i];
+
+    std::pair<double, double> xy = spline(ts[i]);
     xy.first += ref_x_;
     xy.second += ref_y_;
     common::SLPoint ref_sl_point;
@@ -318,6 +318,48 @@ ReferencePoint ReferenceLine::GetReferencePoint(const double s) const {
   return InterpolateWithMatchedIndex(p0, s0, p1, s1, interpolate_index);
 }
 
+std::vector<ReferencePoint> ReferenceLine::GetReferencePoints(
+    const std::vector<double>& accumulated_s_values) const {
+  std::vector<ReferencePoint> ref_points;
+  ref_points.reserve(accumulated_s_values.size());
+  const auto& accumulated_s = map_path_.accumulated_s();
+  size_t index = 0;
+  double prev_s = -std::numeric_limits<double>::infinity();
+  for (const double s : accumulated_s_values) {
+    if (s < prev_s) {
+      // out-of-order value; the sweep index is useless for it.
+      ref_points.push_back(GetReferencePoint(s));
+      continue;
+    }
+    prev_s = s;
+    if (s < accumulated_s.front() - 1e-2) {
+      AWARN << "The requested s: " << s << " < 0.";
+      ref_points.push_back(reference_points_.front());
+      continue;
+    }
+    if (s > accumulated_s.back() + 1e-2) {
+      AWARN << "The requested s: " << s
+            << " > reference line length: " << accumulated_s.back();
+      ref_points.push_back(reference_points_.back());
+      continue;
+    }
+
+    // advance the matched index; amortized O(1) over the whole batch.
+    while (index + 1 < accumulated_s.size() && accumulated_s[index + 1] < s) {
+      ++index;
+    }
+    const hdmap::InterpolatedIndex interpolate_index(
+        static_cast<int>(index), std::max(0.0, s - accumulated_s[index]));
+    const size_t next_index =
+        std::min(index + 1, reference_points_.size() - 1);
+    ref_points.push_back(InterpolateWithMatchedIndex(
+        reference_points_[index], accumulated_s[index],
+        reference_points_[next_index], accumulated_s[next_index],
+        interpolate_index));
+  }
+  return ref_points;
+}
+
 double ReferenceLine::FindMinDistancePoint(const ReferencePoint& p0,
                                            const double s0,
                                            const ReferencePoint& p1,
@@ -384,8 +426,11 @@ bool ReferenceLine::SLToXY(const SLPoint& sl_point,
 
   const auto matched_point = GetReferencePoint(sl_point.s());
   const auto angle = common::math::Angle16::from_rad(matched_point.heading());
-  xy_point->set_x(matched_point.x() - common::math::sin(angle) * sl_point.l());
-  xy_point->set_y(matched_point.y() + common::math::cos(angle) * sl_point.l());
+  float sin_angle = 0.0f;
+  float cos_angle = 0.0f;
+  common::math::sin_cos(angle, &sin_angle, &cos_angle);
+  xy_point->set_x(matched_point.x() - sin_angle * sl_point.l());
+  xy_point->set_y(matched_point.y() + cos_angle * sl_point.l());
   return true;
 }
 
@@ -766,11 +811,24 @@ std::string ReferenceLine::DebugString() const {
                     apollo::common::util::DebugStringFormatter()));
 }
 
+const ReferenceLine::SpeedLimit* ReferenceLine::FindSpeedLimitSegment(
+    const double s) const {
+  // both start_s and end_s are ascending across the sorted non-overlapping
+  // segments, so the first segment ending at or after s is the only
+  // candidate covering it.
+  const auto it_lower = std::lower_bound(
+      speed_limit_.begin(), speed_limit_.end(), s,
+      [](const SpeedLimit& limit, const double s) { return limit.end_s < s; });
+  if (it_lower != speed_limit_.end() && s >= it_lower->start_s) {
+    return &(*it_lower);
+  }
+  return nullptr;
+}
+
 double ReferenceLine::GetSpeedLimitFromS(const double s) const {
-  for (const auto& speed_limit : speed_limit_) {
-    if (s >= speed_limit.start_s && s <= speed_limit.end_s) {
-      return speed_limit.speed_limit;
-    }
+  const auto* speed_limit_segment = FindSpeedLimitSegment(s);
+  if (speed_limit_segment != nullptr) {
+    return speed_limit_segment->speed_limit;
   }
   const auto& map_path_point = GetReferencePoint(s);
   double speed_limit = FLAGS_planning_upper_speed_limit;
@@ -785,6 +843,42 @@ double ReferenceLine::GetSpeedLimitFromS(const double s) const {
   return speed_limit;
 }
 
+std::vector<double> ReferenceLine::GetSpeedLimitsFromS(
+    const std::vector<double>& s_values) const {
+  std::vector<double> speed_limits;
+  speed_limits.reserve(s_values.size());
+  std::vector<size_t> unresolved_indices;
+  std::vector<double> unresolved_s;
+  for (const double s : s_values) {
+    const auto* speed_limit_segment = FindSpeedLimitSegment(s);
+    if (speed_limit_segment == nullptr) {
+      unresolved_indices.push_back(speed_limits.size());
+      unresolved_s.push_back(s);
+      speed_limits.push_back(0.0);
+    } else {
+      speed_limits.push_back(speed_limit_segment->speed_limit);
+    }
+  }
+
+  if (!unresolved_indices.empty()) {
+    // resolve the remaining values from the map with one batched query.
+    const auto ref_points = GetReferencePoints(unresolved_s);
+    for (size_t i = 0; i < unresolved_indices.size(); ++i) {
+      double speed_limit = FLAGS_planning_upper_speed_limit;
+      for (const auto& lane_waypoint : ref_points[i].lane_waypoints()) {
+        if (lane_waypoint.lane == nullptr) {
+          AWARN << "lane_waypoint.lane is nullptr.";
+          continue;
+        }
+        speed_limit =
+            std::fmin(lane_waypoint.lane->lane().speed_limit(), speed_limit);
+      }
+      speed_limits[unresolved_indices[i]] = speed_limit;
+    }
+  }
+  return speed_limits;
+}
+
 void ReferenceLine::AddSpeedLimit(double start_s, double end_s,
                                   double speed_limit) {
   std::vector<SpeedLimit> new_speed_limit;
@@ -91,6 +91,15 @@ class ReferenceLine {
   std::vector<ReferencePoint> GetReferencePoints(double start_s,
                                                  double end_s) const;
 
+  /**
+   * @brief batch version of GetReferencePoint(s). For non-decreasing
+   * s values the matched index is advanced in a single sweep instead of
+   * being searched per value; out-of-order values fall back to the scalar
+   * query.
+   */
+  std::vector<ReferencePoint> GetReferencePoints(
+      const std::vector<double>& accumulated_s_values) const;
+
   size_t GetNearestReferenceIndex(const double s) const;
 
   ReferencePoint GetNearestReferencePoint(const common::math::Vec2d& xy) const;
@@ -172,6 +181,14 @@ class ReferenceLine {
 
   double GetSpeedLimitFromS(const double s) const;
 
+  /**
+   * @brief batch version of GetSpeedLimitFromS. The map fallback for
+   * values not covered by a stored speed limit segment is resolved with
+   * one batched reference point query.
+   */
+  std::vector<double> GetSpeedLimitsFromS(
+      const std::vector<double>& s_values) const;
+
   void AddSpeedLimit(double start_s, double end_s, double speed_limit);
 
   uint32_t GetPriority() const { return priority_; }
@@ -219,6 +236,14 @@ class ReferenceLine {
     SpeedLimit(double _start_s, double _end_s, double _speed_limit)
         : start_s(_start_s), end_s(_end_s), speed_limit(_speed_limit) {}
   };
+
+  /**
+   * @brief binary search the stored speed limit segment covering s;
+   * AddSpeedLimit keeps the segments sorted and non-overlapping.
+   * @return nullptr when no stored segment covers s.
+   */
+  const SpeedLimit* FindSpeedLimitSegment(const double s) const;
+
   /**
    * This speed limit overrides the lane speed limit
    **/
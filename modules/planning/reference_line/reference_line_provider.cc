@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <utility>
 
 #include "cyber/common/file.h"
@@ -107,8 +108,8 @@ ReferenceLineProvider::FutureRouteWaypoints() {
 
 void ReferenceLineProvider::UpdateVehicleState(
     const VehicleState &vehicle_state) {
-  std::lock_guard<std::mutex> lock(vehicle_state_mutex_);
-  vehicle_state_ = vehicle_state;
+  std::atomic_store(&vehicle_state_snapshot_,
+                    std::make_shared<const VehicleState>(vehicle_state));
 }
 
 bool ReferenceLineProvider::Start() {
@@ -143,10 +144,11 @@ void ReferenceLineProvider::UpdateReferenceLine(
     return;
   }
   std::lock_guard<std::mutex> lock(reference_lines_mutex_);
+  bool changed = false;
   if (reference_lines_.size() != reference_lines.size()) {
     reference_lines_ = reference_lines;
     route_segments_ = route_segments;
-
+    changed = true;
   } else {
     auto segment_iter = route_segments.begin();
     auto internal_iter = reference_lines_.begin();
@@ -173,15 +175,20 @@ void ReferenceLineProvider::UpdateReferenceLine(
       }
       *internal_iter = *iter;
       *internal_segment_iter = *segment_iter;
+      changed = true;
     }
   }
-  // update history
-  reference_line_history_.push(reference_lines_);
-  route_segments_history_.push(route_segments_);
-  static constexpr int kMaxHistoryNum = 3;
-  if (reference_line_history_.size() > kMaxHistoryNum) {
-    reference_line_history_.pop();
-    route_segments_history_.pop();
+  // update history; in steady state the stitched lines are unchanged cycle
+  // over cycle and the back of the history already equals the current
+  // state, so skip the deep copies then
+  if (changed || reference_line_history_.empty()) {
+    reference_line_history_.push(reference_lines_);
+    route_segments_history_.push(route_segments_);
+    static constexpr int kMaxHistoryNum = 3;
+    if (reference_line_history_.size() > kMaxHistoryNum) {
+      reference_line_history_.pop();
+      route_segments_history_.pop();
+    }
   }
 }
 
@@ -552,9 +559,10 @@ bool ReferenceLineProvider::CreateReferenceLine(
   CHECK_NOTNULL(segments);
 
   common::VehicleState vehicle_state;
-  {
-    std::lock_guard<std::mutex> lock(vehicle_state_mutex_);
-    vehicle_state = vehicle_state_;
+  const auto vehicle_state_snapshot =
+      std::atomic_load(&vehicle_state_snapshot_);
+  if (vehicle_state_snapshot != nullptr) {
+    vehicle_state = *vehicle_state_snapshot;
   }
 
   routing::RoutingResponse routing;
@@ -131,7 +131,13 @@ class ReferenceLineProvider {
 
   /**
    * @brief This function creates a smoothed forward reference line
-   * based on the given segments.
+   * based on the given segments. It is incremental: while enough of the
+   * previously smoothed line remains ahead of the vehicle it is reused
+   * as-is, and when the lookahead runs short only the forward extension
+   * window (stitch overlap plus extend distance) is smoothed, anchored
+   * on the previous line, and stitched; the tail is trimmed by Shrink().
+   * A full re-smooth only happens on a new routing or when the segments
+   * lose connectivity with the previous cycle.
    */
   bool ExtendReferenceLine(const common::VehicleState& state,
                            hdmap::RouteSegments* segments,
@@ -169,8 +175,10 @@ class ReferenceLineProvider {
   // Used in Navigation mode
   std::shared_ptr<relative_map::MapMsg> relative_map_;
 
-  std::mutex vehicle_state_mutex_;
-  common::VehicleState vehicle_state_;
+  // vehicle state snapshot published by the planning loop and read by the
+  // generation thread; replaced wholesale through the atomic shared_ptr
+  // operations so neither side ever blocks the other.
+  std::shared_ptr<const common::VehicleState> vehicle_state_snapshot_;
 
   std::mutex routing_mutex_;
   routing::RoutingResponse routing_;
@@ -36,10 +36,6 @@ namespace bare_intersection {
 using apollo::hdmap::HDMapUtil;
 
 void BareIntersectionUnprotectedScenario::Init() {
-  if (init_) {
-    return;
-  }
-
   Scenario::Init();
 
   if (!GetScenarioConfig()) {
@@ -66,7 +62,6 @@ void BareIntersectionUnprotectedScenario::Init() {
 
   context_.current_pnc_junction_overlap_id = pnc_junction_overlap_id;
 
-  init_ = true;
 }
 
 apollo::common::util::Factory<
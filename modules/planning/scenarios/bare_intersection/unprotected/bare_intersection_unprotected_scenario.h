@@ -61,7 +61,6 @@ class BareIntersectionUnprotectedScenario : public Scenario {
       ScenarioConfig::StageType, Stage,
       Stage* (*)(const ScenarioConfig::StageConfig& stage_config)>
       s_stage_factory_;
-  bool init_ = false;
   BareIntersectionUnprotectedContext context_;
 };
 
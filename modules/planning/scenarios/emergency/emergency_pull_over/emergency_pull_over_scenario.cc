@@ -36,10 +36,6 @@ apollo::common::util::Factory<
     EmergencyPullOverScenario::s_stage_factory_;
 
 void EmergencyPullOverScenario::Init() {
-  if (init_) {
-    return;
-  }
-
   Scenario::Init();
 
   if (!GetScenarioConfig()) {
@@ -47,7 +43,6 @@ void EmergencyPullOverScenario::Init() {
     return;
   }
 
-  init_ = true;
 }
 
 void EmergencyPullOverScenario::RegisterStages() {
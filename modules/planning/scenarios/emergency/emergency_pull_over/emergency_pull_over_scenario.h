@@ -59,7 +59,6 @@ class EmergencyPullOverScenario : public Scenario {
       ScenarioConfig::StageType, Stage,
       Stage* (*)(const ScenarioConfig::StageConfig& stage_config)>
       s_stage_factory_;
-  bool init_ = false;
   EmergencyPullOverContext context_;
 };
 
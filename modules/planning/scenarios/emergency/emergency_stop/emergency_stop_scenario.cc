@@ -35,10 +35,6 @@ apollo::common::util::Factory<
     EmergencyStopScenario::s_stage_factory_;
 
 void EmergencyStopScenario::Init() {
-  if (init_) {
-    return;
-  }
-
   Scenario::Init();
 
   if (!GetScenarioConfig()) {
@@ -46,7 +42,6 @@ void EmergencyStopScenario::Init() {
     return;
   }
 
-  init_ = true;
 }
 
 void EmergencyStopScenario::RegisterStages() {
@@ -58,7 +58,6 @@ class EmergencyStopScenario : public Scenario {
       ScenarioConfig::StageType, Stage,
       Stage* (*)(const ScenarioConfig::StageConfig& stage_config)>
       s_stage_factory_;
-  bool init_ = false;
   EmergencyStopContext context_;
 };
 
@@ -20,11 +20,11 @@
 
 #include "modules/planning/scenarios/lane_follow/lane_follow_stage.h"
 
+#include <chrono>
 #include <utility>
 
 #include "cyber/common/log.h"
 #include "modules/common/math/math_utils.h"
-#include "modules/common/time/time.h"
 #include "modules/common/util/point_factory.h"
 #include "modules/common/util/string_util.h"
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
@@ -48,7 +48,6 @@ using apollo::common::ErrorCode;
 using apollo::common::SLPoint;
 using apollo::common::Status;
 using apollo::common::TrajectoryPoint;
-using apollo::common::time::Clock;
 using apollo::common::util::PointFactory;
 
 namespace {
@@ -178,14 +177,22 @@ Status LaneFollowStage::PlanOnReferenceLine(
 
   auto ret = Status::OK();
   for (auto* optimizer : task_list_) {
-    const double start_timestamp = Clock::NowInSeconds();
+    // time each task with the wall clock, like total_time_ms, so the task
+    // stats stay meaningful when the planning clock is mocked in replay
+    const double start_timestamp =
+        std::chrono::duration<double>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
     ret = optimizer->Execute(frame, reference_line_info);
     if (!ret.ok()) {
       AERROR << "Failed to run tasks[" << optimizer->Name()
              << "], Error message: " << ret.error_message();
       break;
     }
-    const double end_timestamp = Clock::NowInSeconds();
+    const double end_timestamp =
+        std::chrono::duration<double>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
     const double time_diff_ms = (end_timestamp - start_timestamp) * 1000;
 
     ADEBUG << "after optimizer " << optimizer->Name() << ":"
@@ -36,10 +36,6 @@ apollo::common::util::Factory<
     PullOverScenario::s_stage_factory_;
 
 void PullOverScenario::Init() {
-  if (init_) {
-    return;
-  }
-
   Scenario::Init();
 
   if (!GetScenarioConfig()) {
@@ -47,7 +43,6 @@ void PullOverScenario::Init() {
     return;
   }
 
-  init_ = true;
 }
 
 void PullOverScenario::RegisterStages() {
@@ -40,10 +40,6 @@ apollo::common::util::Factory<
     ValetParkingScenario::s_stage_factory_;
 
 void ValetParkingScenario::Init() {
-  if (init_) {
-    return;
-  }
-
   Scenario::Init();
 
   if (!GetScenarioConfig()) {
@@ -69,7 +69,6 @@ class ValetParkingScenario : public Scenario {
       const hdmap::PathOverlap& parking_space_overlap);
 
  private:
-  bool init_ = false;
   static apollo::common::util::Factory<
       ScenarioConfig::StageType, Stage,
       Stage* (*)(const ScenarioConfig::StageConfig& stage_config)>
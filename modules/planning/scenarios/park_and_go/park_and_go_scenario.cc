@@ -33,10 +33,6 @@ apollo::common::util::Factory<
     ParkAndGoScenario::s_stage_factory_;
 
 void ParkAndGoScenario::Init() {
-  if (init_) {
-    return;
-  }
-
   Scenario::Init();
 
   if (!GetScenarioConfig()) {
@@ -44,7 +40,6 @@ void ParkAndGoScenario::Init() {
     return;
   }
 
-  init_ = true;
 }
 
 void ParkAndGoScenario::RegisterStages() {
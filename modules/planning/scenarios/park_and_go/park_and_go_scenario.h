@@ -55,7 +55,6 @@ class ParkAndGoScenario : public Scenario {
       ScenarioConfig::StageType, Stage,
       Stage* (*)(const ScenarioConfig::StageConfig& stage_config)>
       s_stage_factory_;
-  bool init_ = false;
   ParkAndGoContext context_;
 };
 
@@ -49,6 +49,9 @@ void Scenario::Init() {
   scenario->Clear();
   scenario->set_scenario_type(scenario_type());
 
+  // scenario objects are pooled and Init is called again on re-entry
+  scenario_status_ = STATUS_UNKNOWN;
+
   for (const auto& stage_config : config_.stage_config()) {
     stage_config_map_[stage_config.stage_type()] = &stage_config;
   }
@@ -60,7 +63,20 @@ void Scenario::Init() {
   }
   ADEBUG << "init stage "
          << ScenarioConfig::StageType_Name(config_.stage_type(0));
-  current_stage_ = CreateStage(*stage_config_map_[config_.stage_type(0)]);
+  current_stage_ = GetOrCreateStage(*stage_config_map_[config_.stage_type(0)]);
+}
+
+Stage* Scenario::GetOrCreateStage(
+    const ScenarioConfig::StageConfig& stage_config) {
+  auto iter = stage_pool_.find(stage_config.stage_type());
+  if (iter == stage_pool_.end()) {
+    iter = stage_pool_
+               .emplace(stage_config.stage_type(), CreateStage(stage_config))
+               .first;
+  } else if (iter->second != nullptr) {
+    iter->second->Reset();
+  }
+  return iter->second.get();
 }
 
 Scenario::ScenarioStatus Scenario::Process(
@@ -98,7 +114,7 @@ Scenario::ScenarioStatus Scenario::Process(
           scenario_status_ = STATUS_UNKNOWN;
           return scenario_status_;
         }
-        current_stage_ = CreateStage(*stage_config_map_[next_stage]);
+        current_stage_ = GetOrCreateStage(*stage_config_map_[next_stage]);
         if (current_stage_ == nullptr) {
           AWARN << "Current stage is a null pointer.";
           return STATUS_UNKNOWN;
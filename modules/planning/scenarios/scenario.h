@@ -88,9 +88,22 @@ class Scenario {
   const std::string& Name() const;
   const std::string& GetMsg() const { return msg_; }
 
+ protected:
+  /**
+   * Fetch the stage for the given config from the stage pool, building it
+   * via CreateStage on first use and calling Stage::Reset on reuse, so
+   * stage transitions do not reconstruct tasks.
+   */
+  Stage* GetOrCreateStage(const ScenarioConfig::StageConfig& stage_config);
+
  protected:
   ScenarioStatus scenario_status_ = STATUS_UNKNOWN;
-  std::unique_ptr<Stage> current_stage_;
+  // stage objects are pooled and re-entered via Stage::Reset;
+  // current_stage_ points into stage_pool_
+  std::unordered_map<ScenarioConfig::StageType, std::unique_ptr<Stage>,
+                     std::hash<int>>
+      stage_pool_;
+  Stage* current_stage_ = nullptr;
   ScenarioConfig config_;
   std::unordered_map<ScenarioConfig::StageType,
                      const ScenarioConfig::StageConfig*, std::hash<int>>
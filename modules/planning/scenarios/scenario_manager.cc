@@ -51,10 +51,24 @@ using apollo::hdmap::PathOverlap;
 bool ScenarioManager::Init() {
   RegisterScenarios();
   default_scenario_type_ = ScenarioConfig::LANE_FOLLOW;
-  current_scenario_ = CreateScenario(default_scenario_type_);
+  current_scenario_ = GetScenario(default_scenario_type_);
   return true;
 }
 
+Scenario* ScenarioManager::GetScenario(
+    ScenarioConfig::ScenarioType scenario_type) {
+  auto iter = scenario_pool_.find(scenario_type);
+  if (iter == scenario_pool_.end()) {
+    iter = scenario_pool_.emplace(scenario_type, CreateScenario(scenario_type))
+               .first;
+  } else if (iter->second != nullptr) {
+    // re-entering a pooled scenario: re-run Init to refresh its context and
+    // reset its stages without reconstructing them
+    iter->second->Init();
+  }
+  return iter->second.get();
+}
+
 std::unique_ptr<Scenario> ScenarioManager::CreateScenario(
     ScenarioConfig::ScenarioType scenario_type) {
   std::unique_ptr<Scenario> ptr;
@@ -857,7 +871,7 @@ void ScenarioManager::ScenarioDispatch(const common::TrajectoryPoint& ego_point,
   UpdatePlanningContext(frame, scenario_type);
 
   if (current_scenario_->scenario_type() != scenario_type) {
-    current_scenario_ = CreateScenario(scenario_type);
+    current_scenario_ = GetScenario(scenario_type);
   }
 }
 
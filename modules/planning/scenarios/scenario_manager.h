@@ -34,7 +34,7 @@ class ScenarioManager final {
 
   bool Init();
 
-  Scenario* mutable_scenario() { return current_scenario_.get(); }
+  Scenario* mutable_scenario() { return current_scenario_; }
 
   void Update(const common::TrajectoryPoint& ego_point, const Frame& frame);
 
@@ -44,6 +44,11 @@ class ScenarioManager final {
   std::unique_ptr<Scenario> CreateScenario(
       ScenarioConfig::ScenarioType scenario_type);
 
+  // Fetch the scenario from the pool, building it lazily via CreateScenario
+  // on first use and re-running Init on reuse, so scenario switches do not
+  // reconstruct stages and tasks.
+  Scenario* GetScenario(ScenarioConfig::ScenarioType scenario_type);
+
   void RegisterScenarios();
 
   ScenarioConfig::ScenarioType SelectBareIntersectionScenario(
@@ -103,7 +108,12 @@ class ScenarioManager final {
   std::unordered_map<ScenarioConfig::ScenarioType, ScenarioConfig,
                      std::hash<int>>
       config_map_;
-  std::unique_ptr<Scenario> current_scenario_;
+  // scenario objects are pooled across switches; current_scenario_ points
+  // into scenario_pool_
+  std::unordered_map<ScenarioConfig::ScenarioType, std::unique_ptr<Scenario>,
+                     std::hash<int>>
+      scenario_pool_;
+  Scenario* current_scenario_ = nullptr;
   ScenarioConfig::ScenarioType default_scenario_type_;
   ScenarioContext scenario_context_;
   std::unordered_map<ReferenceLineInfo::OverlapType, hdmap::PathOverlap,
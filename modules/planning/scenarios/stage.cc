@@ -71,6 +71,17 @@ Stage::Stage(const ScenarioConfig::StageConfig& config) : config_(config) {
   }
 }
 
+void Stage::Reset() {
+  // set stage_type in PlanningContext, as the constructor does on a
+  // freshly built stage
+  PlanningContext::Instance()
+      ->mutable_planning_status()
+      ->mutable_scenario()
+      ->set_stage_type(stage_type());
+
+  next_stage_ = config_.stage_type();
+}
+
 const std::string& Stage::Name() const { return name_; }
 
 Task* Stage::FindTask(TaskConfig::TaskType task_type) const {
@@ -49,6 +49,14 @@ class Stage {
 
   virtual ~Stage() = default;
 
+  /**
+   * @brief Restore the per-run state a fresh construction would establish,
+   * so a pooled stage object can be re-entered without reallocating its
+   * tasks. Stages keeping their own per-run members should override this
+   * and call the base implementation.
+   */
+  virtual void Reset();
+
   const ScenarioConfig::StageConfig& config() const { return config_; }
 
   ScenarioConfig::StageType stage_type() const { return config_.stage_type(); }
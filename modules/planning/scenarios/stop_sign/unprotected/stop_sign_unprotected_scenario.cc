@@ -51,10 +51,6 @@ apollo::common::util::Factory<
     StopSignUnprotectedScenario::s_stage_factory_;
 
 void StopSignUnprotectedScenario::Init() {
-  if (init_) {
-    return;
-  }
-
   Scenario::Init();
 
   if (!GetScenarioConfig()) {
@@ -82,7 +78,6 @@ void StopSignUnprotectedScenario::Init() {
 
   GetAssociatedLanes(*stop_sign);
 
-  init_ = true;
 }
 
 void StopSignUnprotectedScenario::RegisterStages() {
@@ -72,7 +72,6 @@ class StopSignUnprotectedScenario : public Scenario {
       ScenarioConfig::StageType, Stage,
       Stage* (*)(const ScenarioConfig::StageConfig& stage_config)>
       s_stage_factory_;
-  bool init_ = false;
   StopSignUnprotectedContext context_;
 };
 
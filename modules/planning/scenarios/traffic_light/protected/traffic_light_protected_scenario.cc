@@ -36,10 +36,6 @@ namespace traffic_light {
 using apollo::hdmap::HDMapUtil;
 
 void TrafficLightProtectedScenario::Init() {
-  if (init_) {
-    return;
-  }
-
   Scenario::Init();
 
   if (!GetScenarioConfig()) {
@@ -71,7 +67,6 @@ void TrafficLightProtectedScenario::Init() {
         traffic_light_overlap_id);
   }
 
-  init_ = true;
 }
 
 apollo::common::util::Factory<
@@ -62,7 +62,6 @@ class TrafficLightProtectedScenario : public Scenario {
       ScenarioConfig::StageType, Stage,
       Stage* (*)(const ScenarioConfig::StageConfig& stage_config)>
       s_stage_factory_;
-  bool init_ = false;
   TrafficLightProtectedContext context_;
 };
 
@@ -64,7 +64,6 @@ class TrafficLightUnprotectedLeftTurnScenario : public Scenario {
       ScenarioConfig::StageType, Stage,
       Stage* (*)(const ScenarioConfig::StageConfig& stage_config)>
       s_stage_factory_;
-  bool init_ = false;
   TrafficLightUnprotectedLeftTurnContext context_;
 };
 
@@ -41,10 +41,6 @@ namespace traffic_light {
 using apollo::hdmap::HDMapUtil;
 
 void TrafficLightUnprotectedRightTurnScenario::Init() {
-  if (init_) {
-    return;
-  }
-
   Scenario::Init();
 
   if (!GetScenarioConfig()) {
@@ -76,7 +72,6 @@ void TrafficLightUnprotectedRightTurnScenario::Init() {
         traffic_light_overlap_id);
   }
 
-  init_ = true;
 }
 
 apollo::common::util::Factory<
@@ -65,7 +65,6 @@ class TrafficLightUnprotectedRightTurnScenario : public Scenario {
       ScenarioConfig::StageType, Stage,
       Stage* (*)(const ScenarioConfig::StageConfig& stage_config)>
       s_stage_factory_;
-  bool init_ = false;
   TrafficLightUnprotectedRightTurnContext context_;
 };
 
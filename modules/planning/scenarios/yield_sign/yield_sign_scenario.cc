@@ -47,10 +47,6 @@ apollo::common::util::Factory<
     YieldSignScenario::s_stage_factory_;
 
 void YieldSignScenario::Init() {
-  if (init_) {
-    return;
-  }
-
   Scenario::Init();
 
   if (!GetScenarioConfig()) {
@@ -81,7 +77,6 @@ void YieldSignScenario::Init() {
     context_.current_yield_sign_overlap_ids.push_back(yield_sign_overlap_id);
   }
 
-  init_ = true;
 }
 
 void YieldSignScenario::RegisterStages() {
@@ -17,6 +17,7 @@
 #include "modules/planning/tasks/deciders/lane_change_decider/lane_change_decider.h"
 
 #include <limits>
+#include <unordered_map>
 
 #include "modules/common/time/time.h"
 #include "modules/planning/common/planning_context.h"
@@ -30,6 +31,35 @@ using apollo::common::SLPoint;
 using apollo::common::Status;
 using apollo::common::time::Clock;
 
+namespace {
+
+// Projection footprint of one obstacle polygon on a reference line, kept
+// across cycles so a steady obstacle only needs a single anchor projection
+// instead of one XYToSL call per polygon point.
+struct ObstacleProjectionCache {
+  std::string lane_id;
+  // obstacle heading relative to the lane heading at the anchor; the SL
+  // extents below are only valid while this stays put
+  double relative_heading = 0.0;
+  int num_polygon_points = 0;
+  // polygon SL extents relative to the anchor projection
+  double ds_min = 0.0;
+  double ds_max = 0.0;
+  double dl_min = 0.0;
+  double dl_max = 0.0;
+  bool was_blocking = false;
+  int64_t last_use_cycle = 0;
+};
+
+constexpr double kCachedHeadingEpsilon = 0.05;
+constexpr size_t kProjectionCacheShrinkSize = 128;
+constexpr int64_t kProjectionCacheMaxIdleCycles = 20;
+
+std::unordered_map<std::string, ObstacleProjectionCache> projection_cache;
+int64_t projection_cache_cycle = 0;
+
+}  // namespace
+
 LaneChangeDecider::LaneChangeDecider(const TaskConfig& config)
     : Decider(config) {
   CHECK(config_.has_lane_change_decider_config());
@@ -271,93 +301,171 @@ bool LaneChangeDecider::IsClearToChangeLane(
   double ego_v =
       std::abs(reference_line_info->vehicle_state().linear_velocity());
 
-  for (const auto* obstacle :
-       reference_line_info->path_decision()->obstacles().Items()) {
-    if (obstacle->IsVirtual() || obstacle->IsStatic()) {
-      ADEBUG << "skip one virtual or static obstacle";
+  ++projection_cache_cycle;
+  const auto& obstacles =
+      reference_line_info->path_decision()->obstacles().Items();
+
+  // Re-check the obstacles that bounded the gap last cycle first: while a
+  // lane-change window stays blocked this settles the verdict without
+  // touching the rest of the traffic.
+  for (const auto* obstacle : obstacles) {
+    const auto iter = projection_cache.find(obstacle->Id());
+    if (iter == projection_cache.end() || !iter->second.was_blocking) {
       continue;
     }
-
-    double start_s = std::numeric_limits<double>::max();
-    double end_s = -std::numeric_limits<double>::max();
-    double start_l = std::numeric_limits<double>::max();
-    double end_l = -std::numeric_limits<double>::max();
-
-    for (const auto& p : obstacle->PerceptionPolygon().points()) {
-      SLPoint sl_point;
-      reference_line_info->reference_line().XYToSL(p, &sl_point);
-      start_s = std::fmin(start_s, sl_point.s());
-      end_s = std::fmax(end_s, sl_point.s());
-
-      start_l = std::fmin(start_l, sl_point.l());
-      end_l = std::fmax(end_l, sl_point.l());
+    if (IsObstacleBlockingChangeLane(reference_line_info, *obstacle,
+                                     ego_start_s, ego_end_s, ego_v)) {
+      return false;
     }
+  }
 
-    if (reference_line_info->IsChangeLanePath()) {
-      static constexpr double kLateralShift = 2.5;
-      if (end_l < -kLateralShift || start_l > kLateralShift) {
-        continue;
-      }
+  for (const auto* obstacle : obstacles) {
+    const auto iter = projection_cache.find(obstacle->Id());
+    if (iter != projection_cache.end() &&
+        iter->second.last_use_cycle == projection_cache_cycle) {
+      // already re-checked above
+      continue;
+    }
+    if (IsObstacleBlockingChangeLane(reference_line_info, *obstacle,
+                                     ego_start_s, ego_end_s, ego_v)) {
+      return false;
     }
+  }
 
-    // Raw estimation on whether same direction with ADC or not based on
-    // prediction trajectory
-    bool same_direction = true;
-    if (obstacle->HasTrajectory()) {
-      double obstacle_moving_direction =
-          obstacle->Trajectory().trajectory_point(0).path_point().theta();
-      const auto& vehicle_state = reference_line_info->vehicle_state();
-      double vehicle_moving_direction = vehicle_state.heading();
-      if (vehicle_state.gear() == canbus::Chassis::GEAR_REVERSE) {
-        vehicle_moving_direction =
-            common::math::NormalizeAngle(vehicle_moving_direction + M_PI);
+  if (projection_cache.size() > kProjectionCacheShrinkSize) {
+    for (auto iter = projection_cache.begin();
+         iter != projection_cache.end();) {
+      if (projection_cache_cycle - iter->second.last_use_cycle >
+          kProjectionCacheMaxIdleCycles) {
+        iter = projection_cache.erase(iter);
+      } else {
+        ++iter;
       }
-      double heading_difference = std::abs(common::math::NormalizeAngle(
-          obstacle_moving_direction - vehicle_moving_direction));
-      same_direction = heading_difference < (M_PI / 2.0);
     }
+  }
+  return true;
+}
 
-    // TODO(All) move to confs
-    static constexpr double kSafeTimeOnSameDirection = 3.0;
-    static constexpr double kSafeTimeOnOppositeDirection = 5.0;
-    static constexpr double kForwardMinSafeDistanceOnSameDirection = 10.0;
-    static constexpr double kBackwardMinSafeDistanceOnSameDirection = 10.0;
-    static constexpr double kForwardMinSafeDistanceOnOppositeDirection = 50.0;
-    static constexpr double kBackwardMinSafeDistanceOnOppositeDirection = 1.0;
-    static constexpr double kDistanceBuffer = 0.5;
-
-    double kForwardSafeDistance = 0.0;
-    double kBackwardSafeDistance = 0.0;
-    if (same_direction) {
-      kForwardSafeDistance =
-          std::fmax(kForwardMinSafeDistanceOnSameDirection,
-                    (ego_v - obstacle->speed()) * kSafeTimeOnSameDirection);
-      kBackwardSafeDistance =
-          std::fmax(kBackwardMinSafeDistanceOnSameDirection,
-                    (obstacle->speed() - ego_v) * kSafeTimeOnSameDirection);
-    } else {
-      kForwardSafeDistance =
-          std::fmax(kForwardMinSafeDistanceOnOppositeDirection,
-                    (ego_v + obstacle->speed()) * kSafeTimeOnOppositeDirection);
-      kBackwardSafeDistance = kBackwardMinSafeDistanceOnOppositeDirection;
+bool LaneChangeDecider::IsObstacleBlockingChangeLane(
+    ReferenceLineInfo* reference_line_info, const Obstacle& obstacle,
+    const double ego_start_s, const double ego_end_s, const double ego_v) {
+  if (obstacle.IsVirtual() || obstacle.IsStatic()) {
+    ADEBUG << "skip one virtual or static obstacle";
+    return false;
+  }
+
+  const auto& reference_line = reference_line_info->reference_line();
+  const auto& perception = obstacle.Perception();
+  SLPoint anchor_sl;
+  reference_line.XYToSL(
+      common::math::Vec2d(perception.position().x(), perception.position().y()),
+      &anchor_sl);
+  const double relative_heading = common::math::NormalizeAngle(
+      perception.theta() - reference_line.GetReferencePoint(anchor_sl.s())
+                               .heading());
+
+  auto& cache = projection_cache[obstacle.Id()];
+  const auto& polygon = obstacle.PerceptionPolygon();
+  const bool reuse_extents =
+      cache.lane_id == reference_line_info->Lanes().Id() &&
+      cache.num_polygon_points == polygon.num_points() &&
+      std::abs(common::math::NormalizeAngle(
+          relative_heading - cache.relative_heading)) < kCachedHeadingEpsilon;
+  if (!reuse_extents) {
+    double min_s = std::numeric_limits<double>::max();
+    double max_s = -std::numeric_limits<double>::max();
+    double min_l = std::numeric_limits<double>::max();
+    double max_l = -std::numeric_limits<double>::max();
+    for (const auto& p : polygon.points()) {
+      SLPoint sl_point;
+      reference_line.XYToSL(p, &sl_point);
+      min_s = std::fmin(min_s, sl_point.s());
+      max_s = std::fmax(max_s, sl_point.s());
+
+      min_l = std::fmin(min_l, sl_point.l());
+      max_l = std::fmax(max_l, sl_point.l());
     }
+    cache.lane_id = reference_line_info->Lanes().Id();
+    cache.relative_heading = relative_heading;
+    cache.num_polygon_points = polygon.num_points();
+    cache.ds_min = min_s - anchor_sl.s();
+    cache.ds_max = max_s - anchor_sl.s();
+    cache.dl_min = min_l - anchor_sl.l();
+    cache.dl_max = max_l - anchor_sl.l();
+  }
+  cache.last_use_cycle = projection_cache_cycle;
 
-    if (HysteresisFilter(ego_start_s - end_s, kBackwardSafeDistance,
-                         kDistanceBuffer, obstacle->IsLaneChangeBlocking()) &&
-        HysteresisFilter(start_s - ego_end_s, kForwardSafeDistance,
-                         kDistanceBuffer, obstacle->IsLaneChangeBlocking())) {
-      reference_line_info->path_decision()
-          ->Find(obstacle->Id())
-          ->SetLaneChangeBlocking(true);
-      ADEBUG << "Lane Change is blocked by obstacle" << obstacle->Id();
+  const double start_s = anchor_sl.s() + cache.ds_min;
+  const double end_s = anchor_sl.s() + cache.ds_max;
+  const double start_l = anchor_sl.l() + cache.dl_min;
+  const double end_l = anchor_sl.l() + cache.dl_max;
+
+  if (reference_line_info->IsChangeLanePath()) {
+    static constexpr double kLateralShift = 2.5;
+    if (end_l < -kLateralShift || start_l > kLateralShift) {
+      cache.was_blocking = false;
       return false;
-    } else {
-      reference_line_info->path_decision()
-          ->Find(obstacle->Id())
-          ->SetLaneChangeBlocking(false);
     }
   }
-  return true;
+
+  // Raw estimation on whether same direction with ADC or not based on
+  // prediction trajectory
+  bool same_direction = true;
+  if (obstacle.HasTrajectory()) {
+    double obstacle_moving_direction =
+        obstacle.Trajectory().trajectory_point(0).path_point().theta();
+    const auto& vehicle_state = reference_line_info->vehicle_state();
+    double vehicle_moving_direction = vehicle_state.heading();
+    if (vehicle_state.gear() == canbus::Chassis::GEAR_REVERSE) {
+      vehicle_moving_direction =
+          common::math::NormalizeAngle(vehicle_moving_direction + M_PI);
+    }
+    double heading_difference = std::abs(common::math::NormalizeAngle(
+        obstacle_moving_direction - vehicle_moving_direction));
+    same_direction = heading_difference < (M_PI / 2.0);
+  }
+
+  // TODO(All) move to confs
+  static constexpr double kSafeTimeOnSameDirection = 3.0;
+  static constexpr double kSafeTimeOnOppositeDirection = 5.0;
+  static constexpr double kForwardMinSafeDistanceOnSameDirection = 10.0;
+  static constexpr double kBackwardMinSafeDistanceOnSameDirection = 10.0;
+  static constexpr double kForwardMinSafeDistanceOnOppositeDirection = 50.0;
+  static constexpr double kBackwardMinSafeDistanceOnOppositeDirection = 1.0;
+  static constexpr double kDistanceBuffer = 0.5;
+
+  double kForwardSafeDistance = 0.0;
+  double kBackwardSafeDistance = 0.0;
+  if (same_direction) {
+    kForwardSafeDistance =
+        std::fmax(kForwardMinSafeDistanceOnSameDirection,
+                  (ego_v - obstacle.speed()) * kSafeTimeOnSameDirection);
+    kBackwardSafeDistance =
+        std::fmax(kBackwardMinSafeDistanceOnSameDirection,
+                  (obstacle.speed() - ego_v) * kSafeTimeOnSameDirection);
+  } else {
+    kForwardSafeDistance =
+        std::fmax(kForwardMinSafeDistanceOnOppositeDirection,
+                  (ego_v + obstacle.speed()) * kSafeTimeOnOppositeDirection);
+    kBackwardSafeDistance = kBackwardMinSafeDistanceOnOppositeDirection;
+  }
+
+  if (HysteresisFilter(ego_start_s - end_s, kBackwardSafeDistance,
+                       kDistanceBuffer, obstacle.IsLaneChangeBlocking()) &&
+      HysteresisFilter(start_s - ego_end_s, kForwardSafeDistance,
+                       kDistanceBuffer, obstacle.IsLaneChangeBlocking())) {
+    reference_line_info->path_decision()
+        ->Find(obstacle.Id())
+        ->SetLaneChangeBlocking(true);
+    cache.was_blocking = true;
+    ADEBUG << "Lane Change is blocked by obstacle" << obstacle.Id();
+    return true;
+  }
+  reference_line_info->path_decision()
+      ->Find(obstacle.Id())
+      ->SetLaneChangeBlocking(false);
+  cache.was_blocking = false;
+  return false;
 }
 
 bool LaneChangeDecider::IsPerceptionBlocked(
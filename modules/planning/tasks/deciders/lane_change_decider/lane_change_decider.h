@@ -73,6 +73,15 @@ class LaneChangeDecider : public Decider {
                                const double distance_buffer,
                                const bool is_obstacle_blocking);
 
+  /**
+   * @brief Check whether one obstacle blocks the lane-change gap; fills the
+   * per-obstacle projection cache so steady obstacles only need an anchor
+   * projection on later cycles
+   */
+  static bool IsObstacleBlockingChangeLane(
+      ReferenceLineInfo* reference_line_info, const Obstacle& obstacle,
+      const double ego_start_s, const double ego_end_s, const double ego_v);
+
   void UpdateStatus(ChangeLaneStatus::Status status_code,
                     const std::string& path_id);
   void UpdateStatus(double timestamp, ChangeLaneStatus::Status status_code,
@@ -20,8 +20,10 @@
 
 #include "modules/planning/tasks/deciders/open_space_decider/open_space_roi_decider.h"
 
+#include <future>
 #include <utility>
 
+#include "cyber/task/task.h"
 #include "modules/common/util/point_factory.h"
 #include "modules/planning/common/planning_context.h"
 
@@ -1565,13 +1567,8 @@ bool OpenSpaceRoiDecider::FilterOutObstacle(const Frame &frame,
 }
 
 bool OpenSpaceRoiDecider::LoadObstacleInHyperPlanes(Frame *const frame) {
-  *(frame->mutable_open_space_info()->mutable_obstacles_A()) =
-      Eigen::MatrixXd::Zero(
-          frame->open_space_info().obstacles_edges_num().sum(), 2);
-  *(frame->mutable_open_space_info()->mutable_obstacles_b()) =
-      Eigen::MatrixXd::Zero(
-          frame->open_space_info().obstacles_edges_num().sum(), 1);
-  // vertices using H-representation
+  // vertices using H-representation; every row of A and b is written by
+  // GetHyperPlanes(), so no zero initialization is needed here
   if (!GetHyperPlanes(
           frame->open_space_info().obstacles_num(),
           frame->open_space_info().obstacles_edges_num(),
@@ -1593,68 +1590,79 @@ bool OpenSpaceRoiDecider::GetHyperPlanes(
     return false;
   }
 
+  // resize is a no-op when the dimensions already match, so the constraint
+  // storage is reused when the ROI is reformulated for a replan with the
+  // same obstacle set
   A_all->resize(obstacles_edges_num.sum(), 2);
   b_all->resize(obstacles_edges_num.sum(), 1);
 
+  // start building H representation; every obstacle owns a disjoint block
+  // of rows, so the per obstacle transforms are dispatched concurrently and
+  // write into A_all and b_all in place
+  std::vector<std::future<void>> results;
   int counter = 0;
-  double kEpsilon = 1.0e-5;
-  // start building H representation
   for (size_t i = 0; i < obstacles_num; ++i) {
-    size_t current_vertice_num = obstacles_edges_num(i, 0);
-    Eigen::MatrixXd A_i(current_vertice_num, 2);
-    Eigen::MatrixXd b_i(current_vertice_num, 1);
-
-    // take two subsequent vertices, and computer hyperplane
-    for (size_t j = 0; j < current_vertice_num; ++j) {
-      Vec2d v1 = obstacles_vertices_vec[i][j];
-      Vec2d v2 = obstacles_vertices_vec[i][j + 1];
-
-      Eigen::MatrixXd A_tmp(2, 1), b_tmp(1, 1), ab(2, 1);
-      // find hyperplane passing through v1 and v2
-      if (std::abs(v1.x() - v2.x()) < kEpsilon) {
-        if (v2.y() < v1.y()) {
-          A_tmp << 1, 0;
-          b_tmp << v1.x();
-        } else {
-          A_tmp << -1, 0;
-          b_tmp << -v1.x();
-        }
-      } else if (std::abs(v1.y() - v2.y()) < kEpsilon) {
-        if (v1.x() < v2.x()) {
-          A_tmp << 0, 1;
-          b_tmp << v1.y();
-        } else {
-          A_tmp << 0, -1;
-          b_tmp << -v1.y();
-        }
+    const int current_edges_num = obstacles_edges_num(i, 0);
+    results.push_back(
+        cyber::Async(&OpenSpaceRoiDecider::BuildObstacleHyperPlanes, this,
+                     std::ref(obstacles_vertices_vec[i]), current_edges_num,
+                     counter, A_all, b_all));
+    counter += current_edges_num;
+  }
+  for (auto &result : results) {
+    result.get();
+  }
+  return true;
+}
+
+void OpenSpaceRoiDecider::BuildObstacleHyperPlanes(
+    const std::vector<Vec2d> &obstacle_vertices, const int edges_num,
+    const int row_offset, Eigen::MatrixXd *A_all, Eigen::MatrixXd *b_all) {
+  static constexpr double kEpsilon = 1.0e-5;
+  // take two subsequent vertices, and compute the hyperplane passing
+  // through them in closed form instead of inverting a 2x2 matrix per edge
+  for (int j = 0; j < edges_num; ++j) {
+    const Vec2d &v1 = obstacle_vertices[j];
+    const Vec2d &v2 = obstacle_vertices[j + 1];
+
+    double a0 = 0.0;
+    double a1 = 0.0;
+    double b_coef = 0.0;
+    if (std::abs(v1.x() - v2.x()) < kEpsilon) {
+      if (v2.y() < v1.y()) {
+        a0 = 1.0;
+        b_coef = v1.x();
       } else {
-        Eigen::MatrixXd tmp1(2, 2);
-        tmp1 << v1.x(), 1, v2.x(), 1;
-        Eigen::MatrixXd tmp2(2, 1);
-        tmp2 << v1.y(), v2.y();
-        ab = tmp1.inverse() * tmp2;
-        double a = ab(0, 0);
-        double b = ab(1, 0);
-
-        if (v1.x() < v2.x()) {
-          A_tmp << -a, 1;
-          b_tmp << b;
-        } else {
-          A_tmp << a, -1;
-          b_tmp << -b;
-        }
+        a0 = -1.0;
+        b_coef = -v1.x();
       }
+    } else if (std::abs(v1.y() - v2.y()) < kEpsilon) {
+      if (v1.x() < v2.x()) {
+        a1 = 1.0;
+        b_coef = v1.y();
+      } else {
+        a1 = -1.0;
+        b_coef = -v1.y();
+      }
+    } else {
+      const double a = (v2.y() - v1.y()) / (v2.x() - v1.x());
+      const double b = v1.y() - a * v1.x();
 
-      // store vertices
-      A_i.block(j, 0, 1, 2) = A_tmp.transpose();
-      b_i.block(j, 0, 1, 1) = b_tmp;
+      if (v1.x() < v2.x()) {
+        a0 = -a;
+        a1 = 1.0;
+        b_coef = b;
+      } else {
+        a0 = a;
+        a1 = -1.0;
+        b_coef = -b;
+      }
     }
 
-    A_all->block(counter, 0, A_i.rows(), 2) = A_i;
-    b_all->block(counter, 0, b_i.rows(), 1) = b_i;
-    counter += static_cast<int>(current_vertice_num);
+    (*A_all)(row_offset + j, 0) = a0;
+    (*A_all)(row_offset + j, 1) = a1;
+    (*b_all)(row_offset + j, 0) = b_coef;
   }
-  return true;
 }
 
 bool OpenSpaceRoiDecider::IsInParkingLot(
@@ -177,6 +177,15 @@ class OpenSpaceRoiDecider : public Decider {
                       const std::vector<std::vector<common::math::Vec2d>>
                           &obstacles_vertices_vec,
                       Eigen::MatrixXd *A_all, Eigen::MatrixXd *b_all);
+
+  // @brief Transform one obstacle's closed vertices list into hyperplane
+  // rows, written in place into the block of A_all and b_all starting at
+  // row_offset. The blocks of different obstacles are disjoint, which lets
+  // GetHyperPlanes() run the per obstacle transforms concurrently
+  void BuildObstacleHyperPlanes(
+      const std::vector<common::math::Vec2d> &obstacle_vertices,
+      const int edges_num, const int row_offset, Eigen::MatrixXd *A_all,
+      Eigen::MatrixXd *b_all);
   /**
    * @brief check if vehicle is parked in a parking lot
    *
@@ -17,9 +17,11 @@
 #include "modules/planning/tasks/deciders/path_assessment_decider/path_assessment_decider.h"
 
 #include <algorithm>
+#include <future>
 #include <limits>
 #include <utility>
 
+#include "cyber/task/task.h"
 #include "modules/common/configs/vehicle_config_helper.h"
 #include "modules/common/proto/pnc_point.pb.h"
 #include "modules/map/hdmap/hdmap_util.h"
@@ -66,16 +68,39 @@ Status PathAssessmentDecider::Process(
 
   // 1. Remove invalid path.
   std::vector<PathData> valid_path_data;
-  for (const auto& curr_path_data : candidate_path_data) {
-    // RecordDebugInfo(curr_path_data, curr_path_data.path_label(),
-    //                 reference_line_info);
-    if (curr_path_data.path_label().find("fallback") != std::string::npos) {
-      if (IsValidFallbackPath(*reference_line_info, curr_path_data)) {
-        valid_path_data.push_back(curr_path_data);
+  if (FLAGS_enable_multi_thread_in_path_assessment &&
+      candidate_path_data.size() > 1) {
+    // The validity checks only read the reference line info and the
+    // candidate itself, so every candidate is checked on its own task.
+    std::vector<std::future<bool>> validity_futures;
+    validity_futures.reserve(candidate_path_data.size());
+    for (const auto& curr_path_data : candidate_path_data) {
+      validity_futures.push_back(
+          cyber::Async([this, reference_line_info, &curr_path_data]() {
+            if (curr_path_data.path_label().find("fallback") !=
+                std::string::npos) {
+              return IsValidFallbackPath(*reference_line_info, curr_path_data);
+            }
+            return IsValidRegularPath(*reference_line_info, curr_path_data);
+          }));
+    }
+    for (size_t i = 0; i < validity_futures.size(); ++i) {
+      if (validity_futures[i].get()) {
+        valid_path_data.push_back(candidate_path_data[i]);
       }
-    } else {
-      if (IsValidRegularPath(*reference_line_info, curr_path_data)) {
-        valid_path_data.push_back(curr_path_data);
+    }
+  } else {
+    for (const auto& curr_path_data : candidate_path_data) {
+      // RecordDebugInfo(curr_path_data, curr_path_data.path_label(),
+      //                 reference_line_info);
+      if (curr_path_data.path_label().find("fallback") != std::string::npos) {
+        if (IsValidFallbackPath(*reference_line_info, curr_path_data)) {
+          valid_path_data.push_back(curr_path_data);
+        }
+      } else {
+        if (IsValidRegularPath(*reference_line_info, curr_path_data)) {
+          valid_path_data.push_back(curr_path_data);
+        }
       }
     }
   }
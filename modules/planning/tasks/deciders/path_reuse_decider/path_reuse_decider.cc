@@ -20,8 +20,11 @@
 #include "modules/planning/tasks/deciders/path_reuse_decider/path_reuse_decider.h"
 
 #include <algorithm>
+#include <cmath>
 #include <string>
+#include <utility>
 
+#include "modules/common/math/math_utils.h"
 #include "modules/planning/common/planning_context.h"
 #include "modules/planning/proto/planning.pb.h"
 
@@ -35,6 +38,8 @@ using apollo::common::math::Vec2d;
 int PathReuseDecider::reusable_path_counter_ = 0;
 int PathReuseDecider::total_path_counter_ = 0;
 bool PathReuseDecider::path_reusable_ = false;
+std::unordered_map<std::string, std::pair<common::math::Vec2d, double>>
+    PathReuseDecider::static_obstacle_snapshot_;
 
 PathReuseDecider::PathReuseDecider(const TaskConfig& config)
     : Decider(config) {}
@@ -221,6 +226,9 @@ bool PathReuseDecider::IsCollisionFree(
 
   // current obstacles
   std::vector<Polygon2d> obstacle_polygons;
+  std::vector<std::pair<double, double>> obstacle_s_intervals;
+  std::unordered_map<std::string, std::pair<common::math::Vec2d, double>>
+      current_obstacle_snapshot;
   for (auto obstacle :
        reference_line_info->path_decision()->obstacles().Items()) {
     // filtered all non-static objects and virtual obstacle
@@ -248,12 +256,45 @@ bool PathReuseDecider::IsCollisionFree(
                    Vec2d(obstacle_sl.start_s(), obstacle_sl.end_l()),
                    Vec2d(obstacle_sl.end_s(), obstacle_sl.end_l()),
                    Vec2d(obstacle_sl.end_s(), obstacle_sl.start_l())}));
+    obstacle_s_intervals.emplace_back(obstacle_sl.start_s(),
+                                      obstacle_sl.end_s());
+    const auto& obstacle_box = obstacle->PerceptionBoundingBox();
+    current_obstacle_snapshot.emplace(
+        obstacle->Id(),
+        std::make_pair(obstacle_box.center(), obstacle_box.heading()));
   }
 
   if (obstacle_polygons.empty()) {
+    static_obstacle_snapshot_.clear();
     return true;
   }
 
+  // fast invalidation: while reusing the same path, the full per-point check
+  // below only needs to rerun when some static obstacle actually moved since
+  // the last collision-free verdict.
+  static constexpr double kObstacleMotionEpsilon = 0.1;     // meter
+  static constexpr double kObstacleRotationEpsilon = 0.05;  // radian
+  if (path_reusable_ &&
+      current_obstacle_snapshot.size() == static_obstacle_snapshot_.size()) {
+    bool obstacles_unchanged = true;
+    for (const auto& obstacle_state : current_obstacle_snapshot) {
+      const auto iter = static_obstacle_snapshot_.find(obstacle_state.first);
+      if (iter == static_obstacle_snapshot_.end() ||
+          obstacle_state.second.first.DistanceTo(iter->second.first) >
+              kObstacleMotionEpsilon ||
+          std::fabs(common::math::NormalizeAngle(obstacle_state.second.second -
+                                                 iter->second.second)) >
+              kObstacleRotationEpsilon) {
+        obstacles_unchanged = false;
+        break;
+      }
+    }
+    if (obstacles_unchanged) {
+      ADEBUG << "static obstacles unchanged, reuse last collision check";
+      return true;
+    }
+  }
+
   const auto& history_frame = FrameHistory::Instance()->Latest();
   if (!history_frame) {
     return false;
@@ -265,6 +306,18 @@ bool PathReuseDecider::IsCollisionFree(
   common::math::Vec2d path_end_position = {history_path.back().x(),
                                            history_path.back().y()};
   reference_line.XYToSL(path_end_position, &path_end_position_sl);
+
+  // every corner of the vehicle box stays within this radius of its path
+  // point, so obstacles farther away along s cannot be hit.
+  const auto& vehicle_param =
+      common::VehicleConfigHelper::GetConfig().vehicle_param();
+  static constexpr double kSPrefilterBuffer = 1.0;  // meter
+  const double adc_corner_radius =
+      std::hypot(std::max(vehicle_param.front_edge_to_center(),
+                          vehicle_param.back_edge_to_center()),
+                 0.5 * vehicle_param.width()) +
+      kSPrefilterBuffer;
+
   for (size_t i = 0; i < history_path.size(); ++i) {
     common::SLPoint path_position_sl;
     common::math::Vec2d path_position = {history_path[i].x(),
@@ -277,6 +330,19 @@ bool PathReuseDecider::IsCollisionFree(
     if (path_position_sl.s() < adc_position_sl.s() - kSBuffer) {
       continue;
     }
+    // skip the corner projections when the point is longitudinally clear of
+    // every obstacle.
+    bool overlaps_in_s = false;
+    for (const auto& s_interval : obstacle_s_intervals) {
+      if (path_position_sl.s() + adc_corner_radius >= s_interval.first &&
+          path_position_sl.s() - adc_corner_radius <= s_interval.second) {
+        overlaps_in_s = true;
+        break;
+      }
+    }
+    if (!overlaps_in_s) {
+      continue;
+    }
     const auto& vehicle_box =
         common::VehicleConfigHelper::Instance()->GetBoundingBox(
             history_path[i]);
@@ -287,6 +353,7 @@ bool PathReuseDecider::IsCollisionFree(
       if (!reference_line.XYToSL(corner_point, &curr_point_sl)) {
         AERROR << "Failed to get the projection from point onto "
                   "reference_line";
+        static_obstacle_snapshot_.clear();
         return false;
       }
       auto curr_point = Vec2d(curr_point_sl.s(), curr_point_sl.l());
@@ -305,11 +372,13 @@ bool PathReuseDecider::IsCollisionFree(
           reference_line.SLToXY(curr_point_sl, &xy_point);
           ADEBUG << "collision:" << xy_point.x() << ", " << xy_point.y();
 
+          static_obstacle_snapshot_.clear();
           return false;
         }
       }
     }
   }
+  static_obstacle_snapshot_ = std::move(current_obstacle_snapshot);
   return true;
 }
 
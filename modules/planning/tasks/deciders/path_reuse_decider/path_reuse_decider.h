@@ -20,9 +20,12 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "modules/common/math/vec2d.h"
 #include "modules/common/vehicle_state/vehicle_state_provider.h"
 #include "modules/planning/common/history.h"
 #include "modules/planning/common/indexed_list.h"
@@ -75,6 +78,13 @@ class PathReuseDecider : public Decider {
   static int reusable_path_counter_;  // count reused path
   static int total_path_counter_;     // count total path
   static bool path_reusable_;
+
+  // snapshot of the static obstacles checked when the last full collision
+  // check on the reused path passed, keyed by obstacle id with the
+  // perception bounding box center and heading; while every obstacle stays
+  // where it was, the previous collision-free verdict still holds.
+  static std::unordered_map<std::string, std::pair<common::math::Vec2d, double>>
+      static_obstacle_snapshot_;
 };
 
 }  // namespace planning
@@ -75,6 +75,7 @@ Status SpeedBoundsDecider::Process(
          << " msec.";
 
   std::vector<const STBoundary *> boundaries;
+  boundaries.reserve(path_decision->obstacles().Items().size());
   for (auto *obstacle : path_decision->obstacles().Items()) {
     const auto &id = obstacle->Id();
     const auto &st_boundary = obstacle->path_st_boundary();
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "modules/common/proto/pnc_point.pb.h"
 #include "modules/planning/proto/decision.pb.h"
@@ -52,6 +53,16 @@ Status SpeedLimitDecider::GetSpeedLimits(
   const auto& discretized_path = path_data_.discretized_path();
   const auto& frenet_path = path_data_.frenet_frame_path();
 
+  // batch the per-point map speed limit queries; frenet path s values are
+  // non-decreasing, so the reference line resolves them in one sweep.
+  std::vector<double> reference_line_s_values;
+  reference_line_s_values.reserve(frenet_path.size());
+  for (const auto& frenet_point : frenet_path) {
+    reference_line_s_values.push_back(frenet_point.s());
+  }
+  const std::vector<double> speed_limits_from_reference_line =
+      reference_line_.GetSpeedLimitsFromS(reference_line_s_values);
+
   for (uint32_t i = 0; i < discretized_path.size(); ++i) {
     const double path_s = discretized_path.at(i).s();
     const double reference_line_s = frenet_path.at(i).s();
@@ -64,7 +75,7 @@ Status SpeedLimitDecider::GetSpeedLimits(
 
     // (1) speed limit from map
     double speed_limit_from_reference_line =
-        reference_line_.GetSpeedLimitFromS(reference_line_s);
+        speed_limits_from_reference_line[i];
 
     // (2) speed limit from path curvature
     //  -- 2.1: limit by centripetal force (acceleration)
@@ -21,6 +21,7 @@
 #include "modules/planning/tasks/deciders/speed_bounds_decider/st_boundary_mapper.h"
 
 #include <algorithm>
+#include <future>
 #include <limits>
 #include <utility>
 
@@ -28,6 +29,7 @@
 #include "modules/planning/proto/decision.pb.h"
 
 #include "cyber/common/log.h"
+#include "cyber/task/task.h"
 #include "modules/common/configs/vehicle_config_helper.h"
 #include "modules/common/math/line_segment2d.h"
 #include "modules/common/math/vec2d.h"
@@ -47,6 +49,11 @@ using apollo::common::Status;
 using apollo::common::math::Box2d;
 using apollo::common::math::Vec2d;
 
+namespace {
+// Maximum number of sampled path points used to map moving obstacles.
+constexpr int kDefaultNumPoint = 50;
+}  // namespace
+
 STBoundaryMapper::STBoundaryMapper(const SpeedBoundsDeciderConfig& config,
                                    const ReferenceLine& reference_line,
                                    const PathData& path_data,
@@ -57,7 +64,45 @@ STBoundaryMapper::STBoundaryMapper(const SpeedBoundsDeciderConfig& config,
       path_data_(path_data),
       vehicle_param_(common::VehicleConfigHelper::GetConfig().vehicle_param()),
       planning_max_distance_(planning_distance),
-      planning_max_time_(planning_time) {}
+      planning_max_time_(planning_time) {
+  const auto* planning_status = PlanningContext::Instance()
+                                    ->mutable_planning_status()
+                                    ->mutable_change_lane();
+  l_buffer_ = planning_status->status() == ChangeLaneStatus::IN_CHANGE_LANE
+                  ? FLAGS_lane_change_obstacle_nudge_l_buffer
+                  : FLAGS_nonstatic_obstacle_nudge_l_buffer;
+
+  const auto& path_points = path_data_.discretized_path();
+  if (path_points.size() < 2) {
+    return;
+  }
+
+  // Subsample the path to reduce computation time, and pre-build the ADC
+  // bounding boxes at the coarse samples once for all obstacles.
+  if (path_points.size() > 2 * static_cast<size_t>(kDefaultNumPoint)) {
+    const auto ratio = path_points.size() / kDefaultNumPoint;
+    std::vector<PathPoint> sampled_path_points;
+    for (size_t i = 0; i < path_points.size(); ++i) {
+      if (i % ratio == 0) {
+        sampled_path_points.push_back(path_points[i]);
+      }
+    }
+    sampled_path_ = DiscretizedPath(std::move(sampled_path_points));
+  } else {
+    sampled_path_ = DiscretizedPath(path_points);
+  }
+
+  const double step_length = vehicle_param_.front_edge_to_center();
+  const auto path_len =
+      std::min(FLAGS_max_trajectory_len, sampled_path_.Length());
+  for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
+    const auto curr_adc_path_point =
+        sampled_path_.Evaluate(path_s + sampled_path_.front().s());
+    sampled_path_s_.push_back(path_s);
+    sampled_adc_boxes_.push_back(
+        ComputeAdcBoundingBox(curr_adc_path_point, l_buffer_));
+  }
+}
 
 Status STBoundaryMapper::ComputeSTBoundary(PathDecision* path_decision) const {
   // Sanity checks.
@@ -70,17 +115,21 @@ Status STBoundaryMapper::ComputeSTBoundary(PathDecision* path_decision) const {
                   "Fail to get params because of too few path points");
   }
 
-  // Go through every obstacle.
+  // Go through every obstacle and sort them into mapping groups; the
+  // per-obstacle mapping only writes the obstacle's own st-boundary, so the
+  // groups can be mapped concurrently.
   Obstacle* stop_obstacle = nullptr;
   ObjectDecisionType stop_decision;
   double min_stop_s = std::numeric_limits<double>::max();
+  std::vector<Obstacle*> non_decision_obstacles;
+  std::vector<std::pair<Obstacle*, ObjectDecisionType>> decision_obstacles;
   for (const auto* ptr_obstacle_item : path_decision->obstacles().Items()) {
     Obstacle* ptr_obstacle = path_decision->Find(ptr_obstacle_item->Id());
     CHECK(ptr_obstacle != nullptr);
 
     // If no longitudinal decision has been made, then plot it onto ST-graph.
     if (!ptr_obstacle->HasLongitudinalDecision()) {
-      ComputeSTBoundary(ptr_obstacle);
+      non_decision_obstacles.push_back(ptr_obstacle);
       continue;
     }
 
@@ -102,12 +151,38 @@ Status STBoundaryMapper::ComputeSTBoundary(PathDecision* path_decision) const {
                decision.has_yield()) {
       // 2. Depending on the longitudinal overtake/yield decision,
       //    fine-tune the upper/lower st-boundary of related obstacles.
-      ComputeSTBoundaryWithDecision(ptr_obstacle, decision);
+      decision_obstacles.emplace_back(ptr_obstacle, decision);
     } else if (!decision.has_ignore()) {
       // 3. Ignore those unrelated obstacles.
       AWARN << "No mapping for decision: " << decision.DebugString();
     }
   }
+
+  if (FLAGS_enable_multi_thread_in_st_boundary_mapper) {
+    std::vector<std::future<void>> futures;
+    for (auto* ptr_obstacle : non_decision_obstacles) {
+      futures.push_back(cyber::Async(
+          [this, ptr_obstacle]() { ComputeSTBoundary(ptr_obstacle); }));
+    }
+    for (auto& obstacle_with_decision : decision_obstacles) {
+      futures.push_back(cyber::Async([this, &obstacle_with_decision]() {
+        ComputeSTBoundaryWithDecision(obstacle_with_decision.first,
+                                      obstacle_with_decision.second);
+      }));
+    }
+    for (auto& future : futures) {
+      future.get();
+    }
+  } else {
+    for (auto* ptr_obstacle : non_decision_obstacles) {
+      ComputeSTBoundary(ptr_obstacle);
+    }
+    for (const auto& obstacle_with_decision : decision_obstacles) {
+      ComputeSTBoundaryWithDecision(obstacle_with_decision.first,
+                                    obstacle_with_decision.second);
+    }
+  }
+
   if (stop_obstacle) {
     bool success = MapStopDecision(stop_obstacle, stop_decision);
     if (!success) {
@@ -199,17 +274,10 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
     return false;
   }
 
-  const auto* planning_status = PlanningContext::Instance()
-                                    ->mutable_planning_status()
-                                    ->mutable_change_lane();
-
-  double l_buffer =
-      planning_status->status() == ChangeLaneStatus::IN_CHANGE_LANE
-          ? FLAGS_lane_change_obstacle_nudge_l_buffer
-          : FLAGS_nonstatic_obstacle_nudge_l_buffer;
-
   // Draw the given obstacle on the ST-graph.
   const auto& trajectory = obstacle.Trajectory();
+  upper_points->reserve(trajectory.trajectory_point_size());
+  lower_points->reserve(trajectory.trajectory_point_size());
   if (trajectory.trajectory_point().empty()) {
     // For those with no predicted trajectories, just map the obstacle's
     // current position to ST-graph and always assume it's static.
@@ -224,7 +292,7 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
       }
 
       const Box2d& obs_box = obstacle.PerceptionBoundingBox();
-      if (CheckOverlap(curr_point_on_path, obs_box, l_buffer)) {
+      if (CheckOverlap(curr_point_on_path, obs_box, l_buffer_)) {
         // If there is overlapping, then plot it on ST-graph.
         const double backward_distance = -vehicle_param_.front_edge_to_center();
         const double forward_distance = obs_box.length();
@@ -244,22 +312,8 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
     }
   } else {
     // For those with predicted trajectories (moving obstacles):
-    // 1. Subsample to reduce computation time.
-    const int default_num_point = 50;
-    DiscretizedPath discretized_path;
-    if (path_points.size() > 2 * default_num_point) {
-      const auto ratio = path_points.size() / default_num_point;
-      std::vector<PathPoint> sampled_path_points;
-      for (size_t i = 0; i < path_points.size(); ++i) {
-        if (i % ratio == 0) {
-          sampled_path_points.push_back(path_points[i]);
-        }
-      }
-      discretized_path = DiscretizedPath(std::move(sampled_path_points));
-    } else {
-      discretized_path = DiscretizedPath(path_points);
-    }
-    // 2. Go through every point of the predicted obstacle trajectory.
+    // Go through every point of the predicted obstacle trajectory and check
+    // it against the pre-built ADC bounding boxes along the sampled path.
     for (int i = 0; i < trajectory.trajectory_point_size(); ++i) {
       const auto& trajectory_point = trajectory.trajectory_point(i);
       const Box2d obs_box = obstacle.GetBoundingBox(trajectory_point);
@@ -271,13 +325,10 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
       }
 
       const double step_length = vehicle_param_.front_edge_to_center();
-      auto path_len =
-          std::min(FLAGS_max_trajectory_len, discretized_path.Length());
       // Go through every point of the ADC's path.
-      for (double path_s = 0.0; path_s < path_len; path_s += step_length) {
-        const auto curr_adc_path_point =
-            discretized_path.Evaluate(path_s + discretized_path.front().s());
-        if (CheckOverlap(curr_adc_path_point, obs_box, l_buffer)) {
+      for (size_t j = 0; j < sampled_adc_boxes_.size(); ++j) {
+        if (obs_box.HasOverlap(sampled_adc_boxes_[j])) {
+          const double path_s = sampled_path_s_[j];
           // Found overlap, start searching with higher resolution
           const double backward_distance = -step_length;
           const double forward_distance = vehicle_param_.length() +
@@ -285,13 +336,13 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
                                           obs_box.length() + obs_box.width();
           const double default_min_step = 0.1;  // in meters
           const double fine_tuning_step_length = std::fmin(
-              default_min_step, discretized_path.Length() / default_num_point);
+              default_min_step, sampled_path_.Length() / kDefaultNumPoint);
 
           bool find_low = false;
           bool find_high = false;
           double low_s = std::fmax(0.0, path_s + backward_distance);
           double high_s =
-              std::fmin(discretized_path.Length(), path_s + forward_distance);
+              std::fmin(sampled_path_.Length(), path_s + forward_distance);
 
           // Keep shrinking by the resolution bidirectionally until finally
           // locating the tight upper and lower bounds.
@@ -300,18 +351,18 @@ bool STBoundaryMapper::GetOverlapBoundaryPoints(
               break;
             }
             if (!find_low) {
-              const auto& point_low = discretized_path.Evaluate(
-                  low_s + discretized_path.front().s());
-              if (!CheckOverlap(point_low, obs_box, l_buffer)) {
+              const auto& point_low =
+                  sampled_path_.Evaluate(low_s + sampled_path_.front().s());
+              if (!CheckOverlap(point_low, obs_box, l_buffer_)) {
                 low_s += fine_tuning_step_length;
               } else {
                 find_low = true;
               }
             }
             if (!find_high) {
-              const auto& point_high = discretized_path.Evaluate(
-                  high_s + discretized_path.front().s());
-              if (!CheckOverlap(point_high, obs_box, l_buffer)) {
+              const auto& point_high =
+                  sampled_path_.Evaluate(high_s + sampled_path_.front().s());
+              if (!CheckOverlap(point_high, obs_box, l_buffer_)) {
                 high_s -= fine_tuning_step_length;
               } else {
                 find_high = true;
@@ -388,6 +439,12 @@ void STBoundaryMapper::ComputeSTBoundaryWithDecision(
 bool STBoundaryMapper::CheckOverlap(const PathPoint& path_point,
                                     const Box2d& obs_box,
                                     const double l_buffer) const {
+  // Check whether ADC bounding box overlaps with obstacle bounding box.
+  return obs_box.HasOverlap(ComputeAdcBoundingBox(path_point, l_buffer));
+}
+
+Box2d STBoundaryMapper::ComputeAdcBoundingBox(const PathPoint& path_point,
+                                              const double l_buffer) const {
   // Convert reference point from center of rear axis to center of ADC.
   Vec2d ego_center_map_frame((vehicle_param_.front_edge_to_center() -
                               vehicle_param_.back_edge_to_center()) *
@@ -399,12 +456,8 @@ bool STBoundaryMapper::CheckOverlap(const PathPoint& path_point,
   ego_center_map_frame.set_x(ego_center_map_frame.x() + path_point.x());
   ego_center_map_frame.set_y(ego_center_map_frame.y() + path_point.y());
 
-  // Compute the ADC bounding box.
-  Box2d adc_box(ego_center_map_frame, path_point.theta(),
-                vehicle_param_.length(), vehicle_param_.width() + l_buffer * 2);
-
-  // Check whether ADC bounding box overlaps with obstacle bounding box.
-  return obs_box.HasOverlap(adc_box);
+  return Box2d(ego_center_map_frame, path_point.theta(),
+               vehicle_param_.length(), vehicle_param_.width() + l_buffer * 2);
 }
 
 }  // namespace planning
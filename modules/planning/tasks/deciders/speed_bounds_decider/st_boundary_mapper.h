@@ -76,6 +76,12 @@ class STBoundaryMapper {
                     const common::math::Box2d& obs_box,
                     const double l_buffer) const;
 
+  /** @brief Compute the ADC bounding box when the center of its rear axis
+   * is at the given path-point, laterally expanded by l_buffer on each side.
+   */
+  common::math::Box2d ComputeAdcBoundingBox(
+      const common::PathPoint& path_point, const double l_buffer) const;
+
   /** @brief Maps the closest STOP decision onto the ST-graph. This STOP
    * decision can be stopping for blocking obstacles, or can be due to
    * traffic rules, etc.
@@ -97,6 +103,15 @@ class STBoundaryMapper {
   const common::VehicleParam& vehicle_param_;
   const double planning_max_distance_;
   const double planning_max_time_;
+  // Obstacle-independent data built once at construction and shared by all
+  // obstacles mapped onto the ST-graph: the lateral nudge buffer, the
+  // subsampled path, and the ADC bounding boxes at every coarse sample
+  // along it, so the per-obstacle trajectory scans do not re-evaluate the
+  // path or rebuild the boxes.
+  double l_buffer_ = 0.0;
+  DiscretizedPath sampled_path_;
+  std::vector<double> sampled_path_s_;
+  std::vector<common::math::Box2d> sampled_adc_boxes_;
 };
 
 }  // namespace planning
@@ -20,8 +20,11 @@
 
 #include "modules/planning/tasks/optimizers/open_space_trajectory_generation/open_space_trajectory_optimizer.h"
 
+#include <future>
 #include <utility>
 
+#include "cyber/task/task.h"
+
 namespace apollo {
 namespace planning {
 
@@ -135,6 +138,7 @@ Status OpenSpaceTrajectoryOptimizer::Plan(
     std::vector<Eigen::MatrixXd> time_result_ds_vec;
     std::vector<Eigen::MatrixXd> l_warm_up_vec;
     std::vector<Eigen::MatrixXd> n_warm_up_vec;
+    std::vector<Eigen::MatrixXd> s_warm_up_vec;
     std::vector<Eigen::MatrixXd> dual_l_result_ds_vec;
     std::vector<Eigen::MatrixXd> dual_n_result_ds_vec;
     xWS_vec.resize(size);
@@ -144,10 +148,10 @@ Status OpenSpaceTrajectoryOptimizer::Plan(
     time_result_ds_vec.resize(size);
     l_warm_up_vec.resize(size);
     n_warm_up_vec.resize(size);
+    s_warm_up_vec.resize(size);
     dual_l_result_ds_vec.resize(size);
     dual_n_result_ds_vec.resize(size);
 
-    // In for loop
     ADEBUG << "Trajectories size in smoother is " << size;
     for (size_t i = 0; i < size; ++i) {
       LoadHybridAstarResultInEigen(&partition_trajectories[i], &xWS_vec[i],
@@ -161,7 +165,49 @@ Status OpenSpaceTrajectoryOptimizer::Plan(
         AINFO << "ending point: "
               << xWS_vec[i].col(xWS_vec[i].cols() - 1).transpose();
       }
+    }
 
+    // The dual variable problems of the partitioned trajectories are
+    // independent of each other, so they are solved concurrently before the
+    // distance approach smoothing consumes them piece by piece
+    if (!FLAGS_use_iterative_anchoring_smoother) {
+      const auto& vehicle_param =
+          common::VehicleConfigHelper::GetConfig().vehicle_param();
+      Eigen::MatrixXd ego(4, 1);
+      ego << vehicle_param.front_edge_to_center(),
+          vehicle_param.right_edge_to_center(),
+          vehicle_param.back_edge_to_center(),
+          vehicle_param.left_edge_to_center();
+      const size_t obstacles_num = obstacles_vertices_vec.size();
+      const double ts = config_.planner_open_space_config().delta_t();
+      std::vector<std::future<bool>> dual_results;
+      for (size_t i = 0; i < size; ++i) {
+        const size_t piece_horizon = xWS_vec[i].cols() - 1;
+        dual_results.push_back(cyber::Async(
+            &OpenSpaceTrajectoryOptimizer::GenerateDualWarmStart, this,
+            std::ref(xWS_vec[i]), piece_horizon, ts, ego, obstacles_num,
+            std::ref(obstacles_edges_num), std::ref(obstacles_A),
+            std::ref(obstacles_b), &l_warm_up_vec[i], &n_warm_up_vec[i],
+            &s_warm_up_vec[i]));
+      }
+      // Wait on every piece before any return so that no task is left
+      // writing into the result containers
+      bool dual_warm_start_success = true;
+      for (size_t i = 0; i < size; ++i) {
+        if (!dual_results[i].get()) {
+          ADEBUG << "Dual variable problem failed to solve at " << i
+                 << "th trajectory with index starts from 0";
+          dual_warm_start_success = false;
+        }
+      }
+      if (!dual_warm_start_success) {
+        return Status(ErrorCode::PLANNING_ERROR,
+                      "distance approach smoothing problem failed to solve");
+      }
+    }
+
+    // In for loop
+    for (size_t i = 0; i < size; ++i) {
       Eigen::MatrixXd last_time_u(2, 1);
       double init_v = 0.0;
       // Stitching point control and velocity is set for first piece of
@@ -193,7 +239,8 @@ Status OpenSpaceTrajectoryOptimizer::Plan(
                 obstacles_A, obstacles_b, obstacles_vertices_vec, last_time_u,
                 init_v, &state_result_ds_vec[i], &control_result_ds_vec[i],
                 &time_result_ds_vec[i], &l_warm_up_vec[i], &n_warm_up_vec[i],
-                &dual_l_result_ds_vec[i], &dual_n_result_ds_vec[i])) {
+                &s_warm_up_vec[i], &dual_l_result_ds_vec[i],
+                &dual_n_result_ds_vec[i])) {
           ADEBUG << "Smoother fail at " << i
                  << "th trajectory with index starts from 0";
           ADEBUG << i << "th trajectory size is " << xWS_vec[i].cols();
@@ -223,11 +270,12 @@ Status OpenSpaceTrajectoryOptimizer::Plan(
 
     const double init_v = trajectory_stitching_point.v();
 
+    Eigen::MatrixXd s_warm_up;
     if (!GenerateDistanceApproachTraj(
             xWS, uWS, XYbounds, obstacles_edges_num, obstacles_A, obstacles_b,
             obstacles_vertices_vec, last_time_u, init_v, &state_result_ds,
             &control_result_ds, &time_result_ds, &l_warm_up, &n_warm_up,
-            &dual_l_result_ds, &dual_n_result_ds)) {
+            &s_warm_up, &dual_l_result_ds, &dual_n_result_ds)) {
       return Status(ErrorCode::PLANNING_ERROR,
                     "distance approach smoothing problem failed to solve");
     }
@@ -503,6 +551,34 @@ void OpenSpaceTrajectoryOptimizer::UseWarmStartAsResult(
       1, time_result_horizon, config_.planner_open_space_config().delta_t());
 }
 
+bool OpenSpaceTrajectoryOptimizer::GenerateDualWarmStart(
+    const Eigen::MatrixXd& xWS, const size_t horizon, const double ts,
+    const Eigen::MatrixXd& ego, const size_t obstacles_num,
+    const Eigen::MatrixXi& obstacles_edges_num,
+    const Eigen::MatrixXd& obstacles_A, const Eigen::MatrixXd& obstacles_b,
+    Eigen::MatrixXd* l_warm_up, Eigen::MatrixXd* n_warm_up,
+    Eigen::MatrixXd* s_warm_up) {
+  // slack_warm_up, temp usage
+  *s_warm_up = Eigen::MatrixXd::Zero(obstacles_num, horizon + 1);
+
+  if (FLAGS_use_dual_variable_warm_start) {
+    if (dual_variable_warm_start_->Solve(horizon, ts, ego, obstacles_num,
+                                         obstacles_edges_num, obstacles_A,
+                                         obstacles_b, xWS, l_warm_up, n_warm_up,
+                                         s_warm_up)) {
+      ADEBUG << "Dual variable problem solved successfully!";
+    } else {
+      ADEBUG << "Dual variable problem failed to solve";
+      return false;
+    }
+  } else {
+    *l_warm_up =
+        0.5 * Eigen::MatrixXd::Ones(obstacles_edges_num.sum(), horizon + 1);
+    *n_warm_up = 0.5 * Eigen::MatrixXd::Ones(4 * obstacles_num, horizon + 1);
+  }
+  return true;
+}
+
 bool OpenSpaceTrajectoryOptimizer::GenerateDistanceApproachTraj(
     const Eigen::MatrixXd& xWS, const Eigen::MatrixXd& uWS,
     const std::vector<double>& XYbounds,
@@ -512,8 +588,8 @@ bool OpenSpaceTrajectoryOptimizer::GenerateDistanceApproachTraj(
     const Eigen::MatrixXd& last_time_u, const double init_v,
     Eigen::MatrixXd* state_result_ds, Eigen::MatrixXd* control_result_ds,
     Eigen::MatrixXd* time_result_ds, Eigen::MatrixXd* l_warm_up,
-    Eigen::MatrixXd* n_warm_up, Eigen::MatrixXd* dual_l_result_ds,
-    Eigen::MatrixXd* dual_n_result_ds) {
+    Eigen::MatrixXd* n_warm_up, Eigen::MatrixXd* s_warm_up,
+    Eigen::MatrixXd* dual_l_result_ds, Eigen::MatrixXd* dual_n_result_ds) {
   size_t horizon = xWS.cols() - 1;
   Eigen::MatrixXd x0(4, 1);
   x0 << xWS(0, 0), xWS(1, 0), xWS(2, 0), init_v;
@@ -537,32 +613,40 @@ bool OpenSpaceTrajectoryOptimizer::GenerateDistanceApproachTraj(
   // Get timestep delta t
   double ts = config_.planner_open_space_config().delta_t();
 
-  // slack_warm_up, temp usage
-  Eigen::MatrixXd s_warm_up = Eigen::MatrixXd::Zero(obstacles_num, horizon + 1);
-
-  // Dual variable warm start for distance approach problem
-  if (FLAGS_use_dual_variable_warm_start) {
-    if (dual_variable_warm_start_->Solve(
-            horizon, ts, ego, obstacles_num, obstacles_edges_num, obstacles_A,
-            obstacles_b, xWS, l_warm_up, n_warm_up, &s_warm_up)) {
-      ADEBUG << "Dual variable problem solved successfully!";
-    } else {
-      ADEBUG << "Dual variable problem failed to solve";
+  // Dual variable warm start for distance approach problem; skipped when the
+  // caller has solved the dual variable problem beforehand
+  if (l_warm_up->size() == 0 || n_warm_up->size() == 0) {
+    if (FLAGS_use_dual_variable_warm_start &&
+        last_dual_l_result_.rows() == obstacles_edges_num.sum() &&
+        last_dual_l_result_.cols() == static_cast<int>(horizon) + 1 &&
+        last_dual_n_result_.rows() == static_cast<int>(4 * obstacles_num) &&
+        last_dual_n_result_.cols() == static_cast<int>(horizon) + 1) {
+      // Replan with an unchanged problem size: warm start from the optimized
+      // duals of the previous cycle instead of solving the dual variable
+      // problem from scratch
+      ADEBUG << "Dual variables warm started from previous solution";
+      *l_warm_up = last_dual_l_result_;
+      *n_warm_up = last_dual_n_result_;
+      *s_warm_up = Eigen::MatrixXd::Zero(obstacles_num, horizon + 1);
+    } else if (!GenerateDualWarmStart(xWS, horizon, ts, ego, obstacles_num,
+                                      obstacles_edges_num, obstacles_A,
+                                      obstacles_b, l_warm_up, n_warm_up,
+                                      s_warm_up)) {
       return false;
     }
-  } else {
-    *l_warm_up =
-        0.5 * Eigen::MatrixXd::Ones(obstacles_edges_num.sum(), horizon + 1);
-    *n_warm_up = 0.5 * Eigen::MatrixXd::Ones(4 * obstacles_num, horizon + 1);
   }
 
   // Distance approach trajectory smoothing
   if (distance_approach_->Solve(
           x0, xF, last_time_u, horizon, ts, ego, xWS, uWS, *l_warm_up,
-          *n_warm_up, s_warm_up, XYbounds, obstacles_num, obstacles_edges_num,
+          *n_warm_up, *s_warm_up, XYbounds, obstacles_num, obstacles_edges_num,
           obstacles_A, obstacles_b, state_result_ds, control_result_ds,
           time_result_ds, dual_l_result_ds, dual_n_result_ds)) {
     ADEBUG << "Distance approach problem solved successfully!";
+    // Keep the optimized duals for warm starting the next replan of an
+    // identically sized problem
+    last_dual_l_result_ = *dual_l_result_ds;
+    last_dual_n_result_ = *dual_n_result_ds;
   } else {
     ADEBUG << "Distance approach problem failed to solve";
     if (FLAGS_enable_smoother_failsafe) {
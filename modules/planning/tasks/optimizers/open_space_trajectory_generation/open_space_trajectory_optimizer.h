@@ -112,6 +112,18 @@ class OpenSpaceTrajectoryOptimizer {
       Eigen::MatrixXd* time_result_ds, Eigen::MatrixXd* dual_l_result_ds,
       Eigen::MatrixXd* dual_n_result_ds);
 
+  // Dual variable warm start for distance approach problem; fills constant
+  // initial guesses when FLAGS_use_dual_variable_warm_start is off
+  bool GenerateDualWarmStart(const Eigen::MatrixXd& xWS, const size_t horizon,
+                             const double ts, const Eigen::MatrixXd& ego,
+                             const size_t obstacles_num,
+                             const Eigen::MatrixXi& obstacles_edges_num,
+                             const Eigen::MatrixXd& obstacles_A,
+                             const Eigen::MatrixXd& obstacles_b,
+                             Eigen::MatrixXd* l_warm_up,
+                             Eigen::MatrixXd* n_warm_up,
+                             Eigen::MatrixXd* s_warm_up);
+
   bool GenerateDistanceApproachTraj(
       const Eigen::MatrixXd& xWS, const Eigen::MatrixXd& uWS,
       const std::vector<double>& XYbounds,
@@ -122,8 +134,8 @@ class OpenSpaceTrajectoryOptimizer {
       const Eigen::MatrixXd& last_time_u, const double init_v,
       Eigen::MatrixXd* state_result_ds, Eigen::MatrixXd* control_result_ds,
       Eigen::MatrixXd* time_result_ds, Eigen::MatrixXd* l_warm_up,
-      Eigen::MatrixXd* n_warm_up, Eigen::MatrixXd* dual_l_result_ds,
-      Eigen::MatrixXd* dual_n_result_ds);
+      Eigen::MatrixXd* n_warm_up, Eigen::MatrixXd* s_warm_up,
+      Eigen::MatrixXd* dual_l_result_ds, Eigen::MatrixXd* dual_n_result_ds);
 
   bool GenerateDecoupledTraj(
       const Eigen::MatrixXd& xWS, const double init_a, const double init_v,
@@ -164,6 +176,12 @@ class OpenSpaceTrajectoryOptimizer {
   std::vector<common::TrajectoryPoint> stitching_trajectory_;
   DiscretizedTrajectory optimized_trajectory_;
 
+  // Optimized dual variables of the last successful smoothing. When a replan
+  // smooths a problem of unchanged size, e.g. after a minor obstacle update,
+  // they warm start the new solve and the dual variable problem is skipped
+  Eigen::MatrixXd last_dual_l_result_;
+  Eigen::MatrixXd last_dual_n_result_;
+
   apollo::planning_internal::OpenSpaceDebug open_space_debug_;
 };
 }  // namespace planning
@@ -71,6 +71,10 @@ OpenSpaceTrajectoryPartition::OpenSpaceTrajectoryPartition(
 }
 
 void OpenSpaceTrajectoryPartition::Restart() {
+  partition_cache_key_.clear();
+  cached_interpolated_trajectory_.clear();
+  cached_partitioned_trajectories_.clear();
+  cached_trajectories_encodings_.clear();
   auto* current_gear_status =
       frame_->mutable_open_space_info()->mutable_gear_switch_states();
   current_gear_status->gear_switching_flag = false;
@@ -90,14 +94,30 @@ Status OpenSpaceTrajectoryPartition::Process() {
   auto* interpolated_trajectory_result_ptr =
       open_space_info_ptr->mutable_interpolated_trajectory_result();
 
-  InterpolateTrajectory(stitched_trajectory_result,
-                        interpolated_trajectory_result_ptr);
-
   auto* partitioned_trajectories =
       open_space_info_ptr->mutable_partitioned_trajectories();
 
-  PartitionTrajectory(*interpolated_trajectory_result_ptr,
-                      partitioned_trajectories);
+  // The time basis of the stitched result shifts every cycle, but its
+  // geometry only changes when the provider delivers a new smoothed
+  // trajectory, so the interpolation and partition are reused while the
+  // geometry fingerprint is unchanged.
+  std::string partition_key;
+  bool partition_cache_hit = false;
+  if (EncodeTrajectory(stitched_trajectory_result, &partition_key)) {
+    partition_key += "_" + std::to_string(stitched_trajectory_result.size());
+    partition_cache_hit = (partition_key == partition_cache_key_);
+  }
+
+  if (partition_cache_hit) {
+    *interpolated_trajectory_result_ptr = cached_interpolated_trajectory_;
+    *partitioned_trajectories = cached_partitioned_trajectories_;
+  } else {
+    InterpolateTrajectory(stitched_trajectory_result,
+                          interpolated_trajectory_result_ptr);
+
+    PartitionTrajectory(*interpolated_trajectory_result_ptr,
+                        partitioned_trajectories);
+  }
 
   const auto& open_space_status =
       PlanningContext::Instance()->planning_status().open_space();
@@ -132,14 +152,22 @@ Status OpenSpaceTrajectoryPartition::Process() {
       closest_point_on_trajs;
 
   std::vector<std::string> trajectories_encodings;
-  for (size_t i = 0; i < trajectories_size; ++i) {
-    const auto& trajectory = partitioned_trajectories->at(i).first;
-    std::string trajectory_encoding;
-    if (!EncodeTrajectory(trajectory, &trajectory_encoding)) {
-      return Status(ErrorCode::PLANNING_ERROR,
-                    "Trajectory empty in trajectory partition");
+  if (partition_cache_hit) {
+    trajectories_encodings = cached_trajectories_encodings_;
+  } else {
+    for (size_t i = 0; i < trajectories_size; ++i) {
+      const auto& trajectory = partitioned_trajectories->at(i).first;
+      std::string trajectory_encoding;
+      if (!EncodeTrajectory(trajectory, &trajectory_encoding)) {
+        return Status(ErrorCode::PLANNING_ERROR,
+                      "Trajectory empty in trajectory partition");
+      }
+      trajectories_encodings.emplace_back(std::move(trajectory_encoding));
     }
-    trajectories_encodings.emplace_back(std::move(trajectory_encoding));
+    partition_cache_key_ = std::move(partition_key);
+    cached_interpolated_trajectory_ = *interpolated_trajectory_result_ptr;
+    cached_partitioned_trajectories_ = *partitioned_trajectories;
+    cached_trajectories_encodings_ = trajectories_encodings;
   }
 
   for (size_t i = 0; i < trajectories_size; ++i) {
@@ -112,6 +112,16 @@ class OpenSpaceTrajectoryPartition : public TrajectoryOptimizer {
   double shift_distance_ = 0.0;
   double wheel_base_ = 0.0;
 
+  // Cache of the interpolated and partitioned stitched trajectory. While
+  // the provider keeps streaming the same smoothed result, only its time
+  // basis changes between cycles and the partition depends on geometry
+  // only, so the interpolation and gear partition are reused until a new
+  // result arrives.
+  std::string partition_cache_key_;
+  DiscretizedTrajectory cached_interpolated_trajectory_;
+  std::vector<TrajGearPair> cached_partitioned_trajectories_;
+  std::vector<std::string> cached_trajectories_encodings_;
+
   double ego_theta_ = 0.0;
   double ego_x_ = 0.0;
   double ego_y_ = 0.0;
@@ -20,6 +20,8 @@
 
 #include "modules/planning/tasks/optimizers/piecewise_jerk_speed/piecewise_jerk_speed_optimizer.h"
 
+#include <chrono>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -74,8 +76,15 @@ Status PiecewiseJerkSpeedOptimizer::Process(const PathData& path_data,
   double total_time = st_graph_data.total_time_by_conf();
   int num_of_knots = static_cast<int>(total_time / delta_t) + 1;
 
-  PiecewiseJerkSpeedProblem piecewise_jerk_problem(num_of_knots, delta_t,
-                                                   init_s);
+  if (piecewise_jerk_problem_ == nullptr ||
+      piecewise_jerk_problem_->num_of_knots() !=
+          static_cast<size_t>(num_of_knots)) {
+    piecewise_jerk_problem_ = std::make_unique<PiecewiseJerkSpeedProblem>(
+        num_of_knots, delta_t, init_s);
+  } else {
+    piecewise_jerk_problem_->set_x_init(init_s);
+  }
+  PiecewiseJerkSpeedProblem& piecewise_jerk_problem = *piecewise_jerk_problem_;
 
   const auto& piecewise_jerk_speed_config =
       config_.piecewise_jerk_speed_config();
@@ -162,7 +171,12 @@ Status PiecewiseJerkSpeedOptimizer::Process(const PathData& path_data,
   piecewise_jerk_problem.set_dx_bounds(std::move(s_dot_bounds));
 
   // Solve the problem
-  if (!piecewise_jerk_problem.Optimize()) {
+  const auto qp_start = std::chrono::system_clock::now();
+  const bool qp_success = piecewise_jerk_problem.Optimize();
+  const auto qp_end = std::chrono::system_clock::now();
+  std::chrono::duration<double> qp_diff = qp_end - qp_start;
+  ADEBUG << "Speed Optimizer used time: " << qp_diff.count() * 1000 << " ms.";
+  if (!qp_success) {
     std::string msg("Piecewise jerk speed optimizer failed!");
     AERROR << msg;
     speed_data->clear();
@@ -20,6 +20,9 @@
 
 #pragma once
 
+#include <memory>
+
+#include "modules/planning/math/piecewise_jerk/piecewise_jerk_speed_problem.h"
 #include "modules/planning/tasks/optimizers/speed_optimizer.h"
 
 namespace apollo {
@@ -35,6 +38,11 @@ class PiecewiseJerkSpeedOptimizer : public SpeedOptimizer {
   common::Status Process(const PathData& path_data,
                          const common::TrajectoryPoint& init_point,
                          SpeedData* const speed_data) override;
+
+  // Kept across planning cycles so that the osqp workspace inside
+  // survives and, while the horizon length is unchanged, consecutive
+  // cycles solve warm started from the previous solution
+  std::unique_ptr<PiecewiseJerkSpeedProblem> piecewise_jerk_problem_;
 };
 
 }  // namespace planning
@@ -81,6 +81,8 @@ DEFINE_string(container_submodule_name, "container_submodule",
               "Container submodule name");
 DEFINE_string(evaluator_submodule_name, "evaluator_submodule",
               "Evaluator submodule name");
+DEFINE_string(predictor_submodule_name, "predictor_submodule",
+              "Predictor submodule name");
 DEFINE_string(perception_obstacles_topic_name,
               "/apollo/prediction/perception_obstacles",
               "Internal topic of perception obstacles");
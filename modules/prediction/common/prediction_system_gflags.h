@@ -50,4 +50,5 @@ DECLARE_string(adccontainer_topic_name);
 DECLARE_string(evaluator_topic_name);
 DECLARE_string(container_submodule_name);
 DECLARE_string(evaluator_submodule_name);
+DECLARE_string(predictor_submodule_name);
 DECLARE_string(perception_obstacles_topic_name);
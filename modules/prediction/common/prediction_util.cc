@@ -242,6 +242,7 @@ void GenerateFreeMoveTrajectoryPoints(
     const Eigen::Matrix<double, 6, 6>& transition, double theta,
     const double start_time, const std::size_t num, const double period,
     std::vector<TrajectoryPoint>* points) {
+  points->reserve(points->size() + num);
   double x = (*state)(0, 0);
   double y = (*state)(1, 0);
   double v_x = (*state)(2, 0);
@@ -17,8 +17,10 @@
 #include "modules/prediction/container/obstacles/obstacle_clusters.h"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
+#include "modules/prediction/common/prediction_map.h"
 #include "modules/prediction/common/road_graph.h"
 
 namespace apollo {
@@ -30,6 +32,8 @@ std::unordered_map<std::string, std::vector<LaneObstacle>>
     ObstacleClusters::lane_obstacles_;
 std::unordered_map<std::string, StopSign>
     ObstacleClusters::lane_id_stop_sign_map_;
+std::unordered_map<std::string, std::vector<ObstacleClusters::LaneChain>>
+    ObstacleClusters::lane_graph_chains_;
 
 void ObstacleClusters::Clear() {
   lane_obstacles_.clear();
@@ -42,12 +46,98 @@ LaneGraph ObstacleClusters::GetLaneGraph(
     const double start_s, const double length, const bool consider_lane_split,
     std::shared_ptr<const LaneInfo> lane_info_ptr) {
   std::string lane_id = lane_info_ptr->id().id();
-  RoadGraph road_graph(start_s, length, consider_lane_split, lane_info_ptr);
   LaneGraph lane_graph;
+  const std::string memo_key =
+      lane_id + (consider_lane_split ? "|split" : "|no_split");
+  auto memo_iter = lane_graph_chains_.find(memo_key);
+  if (memo_iter != lane_graph_chains_.end() &&
+      ReplayLaneGraph(start_s, length, memo_iter->second, &lane_graph)) {
+    return lane_graph;
+  }
+  RoadGraph road_graph(start_s, length, consider_lane_split, lane_info_ptr);
   road_graph.BuildLaneGraph(&lane_graph);
+  MemorizeLaneGraph(lane_graph, memo_key);
   return lane_graph;
 }
 
+bool ObstacleClusters::ReplayLaneGraph(const double start_s,
+                                       const double length,
+                                       const std::vector<LaneChain>& chains,
+                                       LaneGraph* const lane_graph_ptr) {
+  LaneGraph lane_graph;
+  std::unordered_set<std::string> replayed_chains;
+  for (const LaneChain& chain : chains) {
+    LaneSequence sequence;
+    std::string chain_signature;
+    double accumulated_s = 0.0;
+    bool terminated = false;
+    for (size_t i = 0; i < chain.lanes.size(); ++i) {
+      const LaneChain::ChainLane& lane = chain.lanes[i];
+      const double curr_s = i == 0 ? start_s : 0.0;
+      LaneSegment* lane_segment = sequence.add_lane_segment();
+      lane_segment->set_adc_s(curr_s);
+      lane_segment->set_lane_id(lane.lane_id);
+      lane_segment->set_lane_turn_type(lane.lane_turn_type);
+      lane_segment->set_total_length(lane.total_length);
+      lane_segment->set_start_s(curr_s);
+      lane_segment->set_end_s(
+          std::fmin(curr_s + length - accumulated_s, lane.total_length));
+      chain_signature.append(lane.lane_id);
+      chain_signature.push_back('|');
+      if (lane_segment->end_s() < lane.total_length) {
+        terminated = true;
+        break;
+      }
+      if (i + 1 == chain.lanes.size()) {
+        // The window runs exactly to the end of the memorized chain; the
+        // replay is complete only if the map ends there too.
+        terminated = !chain.tail_has_successor;
+        break;
+      }
+      accumulated_s += lane.total_length - curr_s;
+    }
+    if (!terminated) {
+      // The search window outgrew the memorized chain.
+      return false;
+    }
+    // Sibling chains truncated ahead of their divergence point collapse
+    // into a single sequence, as a fresh search would return.
+    if (!replayed_chains.insert(chain_signature).second) {
+      continue;
+    }
+    lane_graph.add_lane_sequence()->CopyFrom(sequence);
+  }
+  lane_graph_ptr->CopyFrom(lane_graph);
+  return true;
+}
+
+void ObstacleClusters::MemorizeLaneGraph(const LaneGraph& lane_graph,
+                                         const std::string& memo_key) {
+  if (lane_graph.lane_sequence().empty()) {
+    return;
+  }
+  std::vector<LaneChain> chains;
+  for (const LaneSequence& lane_sequence : lane_graph.lane_sequence()) {
+    LaneChain chain;
+    for (const LaneSegment& lane_segment : lane_sequence.lane_segment()) {
+      LaneChain::ChainLane lane;
+      lane.lane_id = lane_segment.lane_id();
+      lane.total_length = lane_segment.total_length();
+      lane.lane_turn_type = lane_segment.lane_turn_type();
+      chain.lanes.push_back(std::move(lane));
+    }
+    if (chain.lanes.empty()) {
+      continue;
+    }
+    std::shared_ptr<const LaneInfo> tail_lane =
+        PredictionMap::LaneById(chain.lanes.back().lane_id);
+    chain.tail_has_successor =
+        tail_lane != nullptr && !tail_lane->lane().successor_id().empty();
+    chains.push_back(std::move(chain));
+  }
+  lane_graph_chains_[memo_key] = std::move(chains);
+}
+
 LaneGraph ObstacleClusters::GetLaneGraphWithoutMemorizing(
     const double start_s, const double length, bool is_on_lane,
     std::shared_ptr<const LaneInfo> lane_info_ptr) {
@@ -19,6 +19,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -130,10 +131,54 @@ class ObstacleClusters {
 
   static void Clear();
 
+  /**
+   * @brief A memorized chain of lanes a road-graph search has visited,
+   *        together with whether the map continues past its last lane.
+   *        The per-lane static map attributes are memorized as well so
+   *        that a replay touches the HDMap zero times.
+   */
+  struct LaneChain {
+    struct ChainLane {
+      std::string lane_id;
+      double total_length = 0.0;
+      int lane_turn_type = 0;
+    };
+    std::vector<ChainLane> lanes;
+    bool tail_has_successor = false;
+  };
+
+  /**
+   * @brief Rebuild a lane graph from memorized lane chains in time linear
+   *        in the chain lengths, reproducing what a fresh road-graph
+   *        search from the given s and length would return.
+   * @param lane start s
+   * @param lane graph length
+   * @param the memorized lane chains of the seed lane
+   * @param the lane graph to write in
+   * @return False if the search window outgrows the memorized chains and
+   *         a fresh search is required
+   */
+  static bool ReplayLaneGraph(const double start_s, const double length,
+                              const std::vector<LaneChain>& chains,
+                              LaneGraph* const lane_graph_ptr);
+
+  /**
+   * @brief Memorize the lane chains of a freshly built lane graph
+   * @param the lane graph to memorize
+   * @param the memo key of the seed lane
+   */
+  static void MemorizeLaneGraph(const LaneGraph& lane_graph,
+                                const std::string& memo_key);
+
  private:
   static std::unordered_map<std::string, std::vector<LaneObstacle>>
       lane_obstacles_;
   static std::unordered_map<std::string, StopSign> lane_id_stop_sign_map_;
+  // lane chains memorized by GetLaneGraph, keyed by seed lane id and split
+  // flag; they only depend on static map topology, so unlike the members
+  // above they deliberately survive Clear() across frames
+  static std::unordered_map<std::string, std::vector<LaneChain>>
+      lane_graph_chains_;
 };
 
 }  // namespace prediction
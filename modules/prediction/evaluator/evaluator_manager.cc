@@ -17,6 +17,7 @@
 #include "modules/prediction/evaluator/evaluator_manager.h"
 
 #include <algorithm>
+#include <chrono>
 
 #include "modules/common/configs/vehicle_config_helper.h"
 #include "modules/prediction/common/feature_output.h"
@@ -224,6 +225,37 @@ void EvaluatorManager::Run(ObstaclesContainer* obstacles_container) {
       EvaluateObstacle(obstacle, obstacles_container, dynamic_env);
     }
   }
+
+  LogEvaluatorLatencyStats();
+}
+
+bool EvaluatorManager::EvaluateWithStats(
+    Evaluator* evaluator, Obstacle* obstacle,
+    ObstaclesContainer* obstacles_container,
+    std::vector<Obstacle*>* dynamic_env) {
+  const auto start_time = std::chrono::system_clock::now();
+  bool ret = dynamic_env == nullptr
+                 ? evaluator->Evaluate(obstacle, obstacles_container)
+                 : evaluator->Evaluate(obstacle, obstacles_container,
+                                       *dynamic_env);
+  const auto end_time = std::chrono::system_clock::now();
+  const std::chrono::duration<double> diff = end_time - start_time;
+  {
+    std::lock_guard<std::mutex> lock(evaluator_stats_mutex_);
+    auto& stats = evaluator_latency_stats_[evaluator->GetName()];
+    ++stats.first;
+    stats.second += diff.count() * 1000.0;
+  }
+  return ret;
+}
+
+void EvaluatorManager::LogEvaluatorLatencyStats() {
+  std::lock_guard<std::mutex> lock(evaluator_stats_mutex_);
+  for (const auto& stats : evaluator_latency_stats_) {
+    ADEBUG << "Evaluator " << stats.first << " ran " << stats.second.first
+           << " time(s) in " << stats.second.second << " ms.";
+  }
+  evaluator_latency_stats_.clear();
 }
 
 void EvaluatorManager::EvaluateObstacle(Obstacle* obstacle,
@@ -243,7 +275,7 @@ void EvaluatorManager::EvaluateObstacle(Obstacle* obstacle,
         }
         CHECK_NOTNULL(evaluator);
         // Evaluate and break if success
-        if (evaluator->Evaluate(obstacle, obstacles_container)) {
+        if (EvaluateWithStats(evaluator, obstacle, obstacles_container)) {
           break;
         } else {
           AERROR << "Obstacle: " << obstacle->id()
@@ -263,9 +295,10 @@ void EvaluatorManager::EvaluateObstacle(Obstacle* obstacle,
       }
       CHECK_NOTNULL(evaluator);
       if (evaluator->GetName() == "LANE_SCANNING_EVALUATOR") {
-        evaluator->Evaluate(obstacle, obstacles_container, dynamic_env);
+        EvaluateWithStats(evaluator, obstacle, obstacles_container,
+                          &dynamic_env);
       } else {
-        evaluator->Evaluate(obstacle, obstacles_container);
+        EvaluateWithStats(evaluator, obstacle, obstacles_container);
       }
       break;
     }
@@ -273,7 +306,7 @@ void EvaluatorManager::EvaluateObstacle(Obstacle* obstacle,
       if (obstacle->IsOnLane()) {
         evaluator = GetEvaluator(cyclist_on_lane_evaluator_);
         CHECK_NOTNULL(evaluator);
-        evaluator->Evaluate(obstacle, obstacles_container);
+        EvaluateWithStats(evaluator, obstacle, obstacles_container);
       }
       break;
     }
@@ -282,7 +315,7 @@ void EvaluatorManager::EvaluateObstacle(Obstacle* obstacle,
           ObstaclePriority::CAUTION) {
         evaluator = GetEvaluator(pedestrian_evaluator_);
         CHECK_NOTNULL(evaluator);
-        evaluator->Evaluate(obstacle, obstacles_container);
+        EvaluateWithStats(evaluator, obstacle, obstacles_container);
         break;
       }
     }
@@ -290,7 +323,7 @@ void EvaluatorManager::EvaluateObstacle(Obstacle* obstacle,
       if (obstacle->IsOnLane()) {
         evaluator = GetEvaluator(default_on_lane_evaluator_);
         CHECK_NOTNULL(evaluator);
-        evaluator->Evaluate(obstacle, obstacles_container);
+        EvaluateWithStats(evaluator, obstacle, obstacles_container);
       }
       break;
     }
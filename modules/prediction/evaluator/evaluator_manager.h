@@ -24,7 +24,10 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "cyber/common/macros.h"
@@ -93,9 +96,31 @@ class EvaluatorManager {
    */
   void RegisterEvaluators();
 
+  /**
+   * @brief Run an evaluator on an obstacle and accumulate its wall time
+   * into the per-evaluator latency statistics of the current frame;
+   * thread-safe, since evaluation may run on the prediction thread pool.
+   * @return The evaluator result
+   */
+  bool EvaluateWithStats(Evaluator* evaluator, Obstacle* obstacle,
+                         ObstaclesContainer* obstacles_container,
+                         std::vector<Obstacle*>* dynamic_env = nullptr);
+
+  /**
+   * @brief Log the per-evaluator latency breakdown of the frame and reset
+   * the statistics.
+   */
+  void LogEvaluatorLatencyStats();
+
  private:
   std::map<ObstacleConf::EvaluatorType, std::unique_ptr<Evaluator>> evaluators_;
 
+  // per-frame evaluator latency statistics: evaluator name to
+  // (number of runs, accumulated wall time in ms)
+  std::mutex evaluator_stats_mutex_;
+  std::unordered_map<std::string, std::pair<int, double>>
+      evaluator_latency_stats_;
+
   ObstacleConf::EvaluatorType vehicle_on_lane_evaluator_ =
       ObstacleConf::CRUISE_MLP_EVALUATOR;
 
@@ -20,9 +20,6 @@
 
 #include "modules/prediction/network/net_layer.h"
 
-#include <algorithm>
-#include <limits>
-
 #include "cyber/common/log.h"
 
 namespace apollo {
@@ -123,6 +120,12 @@ bool Conv1d::Load(const Conv1dParameter& conv1d_pb) {
   } else {
     stride_ = 1;
   }
+  CHECK_GT(kernel_.size(), 0);
+  flat_kernel_.resize(static_cast<int>(kernel_.size()), kernel_[0].size());
+  for (size_t i = 0; i < kernel_.size(); ++i) {
+    flat_kernel_.row(static_cast<int>(i)) = Eigen::Map<const Eigen::VectorXf>(
+        kernel_[i].data(), kernel_[i].size());
+  }
   return true;
 }
 
@@ -134,21 +137,19 @@ void Conv1d::Run(const std::vector<Eigen::MatrixXf>& inputs,
   int kernel_size = static_cast<int>(kernel_[0].cols());
   int output_num_col =
       static_cast<int>((inputs[0].cols() - kernel_size) / stride_) + 1;
-  int output_num_row = static_cast<int>(kernel_.size());
-  output->resize(output_num_row, output_num_col);
-  for (int i = 0; i < output_num_row; ++i) {
-    for (int j = 0; j < output_num_col; ++j) {
-      float output_i_j_unbiased = 0.0f;
-      for (int p = 0; p < inputs[0].rows(); ++p) {
-        for (int q = j * stride_; q < j * stride_ + kernel_size; ++q) {
-          output_i_j_unbiased +=
-              inputs[0](p, q) * kernel_[i](p, q - j * stride_);
-        }
-      }
-
-      (*output)(i, j) = output_i_j_unbiased + bias_(i);
-    }
+  int input_num_row = static_cast<int>(inputs[0].rows());
+  // im2col: each sliding window is one column of the patch matrix, so the
+  // whole convolution reduces to a single GEMM with the flattened kernels.
+  // A window spans all input rows, hence is contiguous in column-major
+  // storage and can be mapped without a copy.
+  Eigen::MatrixXf patches(input_num_row * kernel_size, output_num_col);
+  for (int j = 0; j < output_num_col; ++j) {
+    patches.col(j) = Eigen::Map<const Eigen::VectorXf>(
+        inputs[0].data() + j * stride_ * input_num_row,
+        input_num_row * kernel_size);
   }
+  *output = flat_kernel_ * patches;
+  output->colwise() += bias_;
 }
 
 bool MaxPool1d::Load(const LayerParameter& layer_pb) {
@@ -183,13 +184,10 @@ void MaxPool1d::Run(const std::vector<Eigen::MatrixXf>& inputs,
   int input_index = 0;
   for (int j = 0; j < output_num_col; ++j) {
     CHECK_LE(input_index + kernel_size_, inputs[0].cols());
-    for (int i = 0; i < output_num_row; ++i) {
-      float output_i_j = -std::numeric_limits<float>::infinity();
-      for (int k = input_index; k < input_index + kernel_size_; ++k) {
-        output_i_j = std::max(output_i_j, inputs[0](i, k));
-      }
-      (*output)(i, j) = output_i_j;
-    }
+    output->col(j) = inputs[0]
+                         .block(0, input_index, output_num_row, kernel_size_)
+                         .rowwise()
+                         .maxCoeff();
     input_index += stride_;
   }
 }
@@ -226,13 +224,11 @@ void AvgPool1d::Run(const std::vector<Eigen::MatrixXf>& inputs,
   int input_index = 0;
   for (int j = 0; j < output_num_col; ++j) {
     CHECK_LE(input_index + kernel_size_, inputs[0].cols());
-    for (int i = 0; i < output_num_row; ++i) {
-      float output_i_j_sum = 0.0f;
-      for (int k = input_index; k < input_index + kernel_size_; ++k) {
-        output_i_j_sum += inputs[0](i, k);
-      }
-      (*output)(i, j) = output_i_j_sum / static_cast<float>(kernel_size_);
-    }
+    output->col(j) = inputs[0]
+                         .block(0, input_index, output_num_row, kernel_size_)
+                         .rowwise()
+                         .sum() /
+                     static_cast<float>(kernel_size_);
     input_index += stride_;
   }
 }
@@ -421,23 +417,33 @@ bool LSTM::Load(const LayerParameter& layer_pb) {
     AERROR << "Fail to Load recurrent output weights!";
     return false;
   }
+  // Fuse the per-gate weights side by side so each step costs one input
+  // GEMM and one recurrent GEMM instead of eight.
+  w_cat_.resize(wi_.rows(), 4 * units_);
+  w_cat_ << wi_, wf_, wc_, wo_;
+  r_w_cat_.resize(r_wi_.rows(), 4 * units_);
+  r_w_cat_ << r_wi_, r_wf_, r_wc_, r_wo_;
+  b_cat_.resize(4 * units_);
+  b_cat_ << bi_, bf_, bc_, bo_;
   ResetState();
   return true;
 }
 
-void LSTM::Step(const Eigen::MatrixXf& input, Eigen::MatrixXf* output,
+void LSTM::Step(const Eigen::MatrixXf& gate_input, Eigen::MatrixXf* output,
                 Eigen::MatrixXf* ht_1, Eigen::MatrixXf* ct_1) {
-  Eigen::MatrixXf x_i = input * wi_ + bi_.transpose();
-  Eigen::MatrixXf x_f = input * wf_ + bf_.transpose();
-  Eigen::MatrixXf x_c = input * wc_ + bc_.transpose();
-  Eigen::MatrixXf x_o = input * wo_ + bo_.transpose();
+  Eigen::MatrixXf gates = gate_input + (*ht_1) * r_w_cat_;
 
-  Eigen::MatrixXf i = (x_i + (*ht_1) * r_wi_).unaryExpr(krecurrent_activation_);
-  Eigen::MatrixXf f = (x_f + (*ht_1) * r_wf_).unaryExpr(krecurrent_activation_);
+  Eigen::MatrixXf i =
+      gates.leftCols(units_).unaryExpr(krecurrent_activation_);
+  Eigen::MatrixXf f =
+      gates.middleCols(units_, units_).unaryExpr(krecurrent_activation_);
   Eigen::MatrixXf c =
       f.array() * ct_1->array() +
-      i.array() * ((x_c + (*ht_1) * r_wc_).unaryExpr(kactivation_)).array();
-  Eigen::MatrixXf o = (x_o + (*ht_1) * r_wo_).unaryExpr(krecurrent_activation_);
+      i.array() *
+          (gates.middleCols(2 * units_, units_).unaryExpr(kactivation_))
+              .array();
+  Eigen::MatrixXf o =
+      gates.rightCols(units_).unaryExpr(krecurrent_activation_);
   Eigen::MatrixXf h = o.array() * (c.unaryExpr(kactivation_)).array();
 
   *ht_1 = h;
@@ -448,10 +454,14 @@ void LSTM::Step(const Eigen::MatrixXf& input, Eigen::MatrixXf* output,
 void LSTM::Run(const std::vector<Eigen::MatrixXf>& inputs,
                Eigen::MatrixXf* output) {
   CHECK_EQ(inputs.size(), 1);
+  // One GEMM projects the whole input sequence onto all four gates; the
+  // sequential loop only carries the recurrent half of each step.
+  Eigen::MatrixXf x_gates = inputs[0] * w_cat_;
+  x_gates.rowwise() += b_cat_.transpose();
   Eigen::MatrixXf sequences(inputs[0].rows(), units_);
   Eigen::MatrixXf temp;
   for (int i = 0; i < inputs[0].rows(); ++i) {
-    Step(inputs[0].row(i), &temp, &ht_1_, &ct_1_);
+    Step(x_gates.row(i), &temp, &ht_1_, &ct_1_);
     sequences.row(i) = temp.row(0);
   }
   if (return_sequences_) {
@@ -174,6 +174,9 @@ class Conv1d : public Layer {
   std::vector<int> shape_;
   bool use_bias_;
   std::vector<Eigen::MatrixXf> kernel_;
+  // kernels flattened into one matrix, one kernel per row, so the whole
+  // convolution runs as a single GEMM over im2col patches
+  Eigen::MatrixXf flat_kernel_;
   Eigen::VectorXf bias_;
   int stride_;
 };
@@ -356,12 +359,13 @@ class LSTM : public Layer {
  private:
   /**
    * @brief Compute the output of LSTM step by step
-   * @param Input of current step
+   * @param Biased input projection of all four gates [i | f | c | o]
+   *        for the current step
    * @param Output of current step
    * @param Hidden state of previous step and return current hidden state
    * @param Cell state of previous step and return current cell state
    */
-  void Step(const Eigen::MatrixXf& input, Eigen::MatrixXf* output,
+  void Step(const Eigen::MatrixXf& gate_input, Eigen::MatrixXf* output,
             Eigen::MatrixXf* ht_1, Eigen::MatrixXf* ct_1);
 
   Eigen::MatrixXf wi_;
@@ -378,6 +382,12 @@ class LSTM : public Layer {
   Eigen::MatrixXf r_wc_;
   Eigen::MatrixXf r_wo_;
 
+  // gate weights fused side by side as [i | f | c | o] so one GEMM
+  // projects the input sequence and one GEMM per step the hidden state
+  Eigen::MatrixXf w_cat_;
+  Eigen::MatrixXf r_w_cat_;
+  Eigen::VectorXf b_cat_;
+
   Eigen::MatrixXf ht_1_;
   Eigen::MatrixXf ct_1_;
   std::function<float(float)> kactivation_;
@@ -0,0 +1,195 @@
+/******************************************************************************
+ * Copyright 2020 The Apollo Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+/**
+ * @file
+ * @brief Replays recorded perception obstacles through the full prediction
+ *        stack headless and reports per-stage latency percentiles and
+ *        throughput. Run it with different --max_thread_num and
+ *        --enable_multi_thread settings to compare parallelization options
+ *        against real drive data.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "cyber/record/record_reader.h"
+
+#include "absl/strings/str_split.h"
+#include "modules/common/adapters/adapter_gflags.h"
+#include "modules/common/adapters/proto/adapter_config.pb.h"
+#include "modules/prediction/common/message_process.h"
+#include "modules/prediction/common/prediction_map.h"
+#include "modules/prediction/common/prediction_system_gflags.h"
+#include "modules/prediction/container/adc_trajectory/adc_trajectory_container.h"
+#include "modules/prediction/container/container_manager.h"
+#include "modules/prediction/container/obstacles/obstacles_container.h"
+#include "modules/prediction/evaluator/evaluator_manager.h"
+#include "modules/prediction/predictor/predictor_manager.h"
+#include "modules/prediction/util/data_extraction.h"
+
+namespace apollo {
+namespace prediction {
+namespace {
+
+using apollo::common::adapter::AdapterConfig;
+using apollo::cyber::record::RecordMessage;
+using apollo::cyber::record::RecordReader;
+using apollo::localization::LocalizationEstimate;
+using apollo::perception::PerceptionObstacles;
+using apollo::planning::ADCTrajectory;
+
+class StageTimer {
+ public:
+  void AddSample(const double latency_ms) {
+    latencies_ms_.push_back(latency_ms);
+  }
+
+  void Report(const std::string& stage_name) {
+    if (latencies_ms_.empty()) {
+      AINFO << stage_name << ": no samples";
+      return;
+    }
+    std::sort(latencies_ms_.begin(), latencies_ms_.end());
+    double sum = 0.0;
+    for (const double latency_ms : latencies_ms_) {
+      sum += latency_ms;
+    }
+    AINFO << stage_name << ": frames = " << latencies_ms_.size()
+          << ", mean = " << sum / static_cast<double>(latencies_ms_.size())
+          << " ms, p50 = " << Percentile(0.50)
+          << " ms, p90 = " << Percentile(0.90)
+          << " ms, p99 = " << Percentile(0.99)
+          << " ms, max = " << latencies_ms_.back() << " ms";
+  }
+
+ private:
+  double Percentile(const double quantile) const {
+    size_t index = static_cast<size_t>(
+        quantile * static_cast<double>(latencies_ms_.size()));
+    index = std::min(index, latencies_ms_.size() - 1);
+    return latencies_ms_[index];
+  }
+
+  std::vector<double> latencies_ms_;
+};
+
+double ElapsedMs(const std::chrono::steady_clock::time_point& start_time) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start_time)
+      .count();
+}
+
+void BenchmarkRecords() {
+  apollo::hdmap::HDMapUtil::ReloadMaps();
+  if (FLAGS_prediction_offline_bags.empty()) {
+    AERROR << "No input records; set --prediction_offline_bags.";
+    return;
+  }
+  if (!MessageProcess::Init()) {
+    return;
+  }
+
+  auto ptr_obstacles_container =
+      ContainerManager::Instance()->GetContainer<ObstaclesContainer>(
+          AdapterConfig::PERCEPTION_OBSTACLES);
+  CHECK_NOTNULL(ptr_obstacles_container);
+  auto ptr_ego_trajectory_container =
+      ContainerManager::Instance()->GetContainer<ADCTrajectoryContainer>(
+          AdapterConfig::PLANNING_TRAJECTORY);
+  CHECK_NOTNULL(ptr_ego_trajectory_container);
+
+  StageTimer container_timer;
+  StageTimer evaluator_timer;
+  StageTimer predictor_timer;
+  StageTimer end_to_end_timer;
+  int frame_count = 0;
+
+  const std::vector<std::string> inputs =
+      absl::StrSplit(FLAGS_prediction_offline_bags, ':');
+  const auto benchmark_start_time = std::chrono::steady_clock::now();
+  for (const auto& input : inputs) {
+    std::vector<std::string> offline_bags;
+    GetRecordFileNames(boost::filesystem::path(input), &offline_bags);
+    std::sort(offline_bags.begin(), offline_bags.end());
+    AINFO << "For input " << input << ", found " << offline_bags.size()
+          << " records to benchmark";
+    for (const auto& offline_bag : offline_bags) {
+      RecordReader reader(offline_bag);
+      RecordMessage message;
+      while (reader.ReadMessage(&message)) {
+        if (message.channel_name == FLAGS_perception_obstacle_topic) {
+          PerceptionObstacles perception_obstacles;
+          if (!perception_obstacles.ParseFromString(message.content)) {
+            continue;
+          }
+          // The three stages below mirror MessageProcess::OnPerception
+          const auto frame_start_time = std::chrono::steady_clock::now();
+          MessageProcess::ContainerProcess(perception_obstacles);
+          container_timer.AddSample(ElapsedMs(frame_start_time));
+
+          const auto evaluator_start_time = std::chrono::steady_clock::now();
+          EvaluatorManager::Instance()->Run(ptr_obstacles_container);
+          evaluator_timer.AddSample(ElapsedMs(evaluator_start_time));
+
+          const auto predictor_start_time = std::chrono::steady_clock::now();
+          PredictorManager::Instance()->Run(perception_obstacles,
+                                            ptr_ego_trajectory_container,
+                                            ptr_obstacles_container);
+          predictor_timer.AddSample(ElapsedMs(predictor_start_time));
+          end_to_end_timer.AddSample(ElapsedMs(frame_start_time));
+          ++frame_count;
+        } else if (message.channel_name == FLAGS_localization_topic) {
+          LocalizationEstimate localization;
+          if (localization.ParseFromString(message.content)) {
+            MessageProcess::OnLocalization(localization);
+          }
+        } else if (message.channel_name == FLAGS_planning_trajectory_topic) {
+          ADCTrajectory adc_trajectory;
+          if (adc_trajectory.ParseFromString(message.content)) {
+            MessageProcess::OnPlanning(adc_trajectory);
+          }
+        }
+      }
+    }
+  }
+  const double total_time_sec = ElapsedMs(benchmark_start_time) / 1000.0;
+
+  AINFO << "Benchmark with enable_multi_thread = "
+        << FLAGS_enable_multi_thread
+        << ", max_thread_num = " << FLAGS_max_thread_num
+        << ", max_caution_thread_num = " << FLAGS_max_caution_thread_num;
+  container_timer.Report("container");
+  evaluator_timer.Report("evaluator");
+  predictor_timer.Report("predictor");
+  end_to_end_timer.Report("end-to-end");
+  if (total_time_sec > 0.0) {
+    AINFO << "Total replay time = " << total_time_sec << " s, throughput = "
+          << static_cast<double>(frame_count) / total_time_sec << " frames/s";
+  }
+}
+
+}  // namespace
+}  // namespace prediction
+}  // namespace apollo
+
+int main(int argc, char* argv[]) {
+  google::ParseCommandLineFlags(&argc, &argv, true);
+  apollo::prediction::BenchmarkRecords();
+  return 0;
+}
@@ -16,6 +16,8 @@
 
 #include "modules/prediction/predictor/free_move/free_move_predictor.h"
 
+#include <utility>
+
 #include "modules/prediction/common/prediction_gflags.h"
 #include "modules/prediction/common/prediction_util.h"
 #include "modules/prediction/proto/prediction_conf.pb.h"
@@ -65,9 +67,9 @@ bool FreeMovePredictor::Predict(
         position, velocity, acc, theta, 0.0, prediction_total_time,
         FLAGS_prediction_trajectory_time_resolution, &points);
 
-    Trajectory trajectory = GenerateTrajectory(points);
-    obstacle->mutable_latest_feature()->add_predicted_trajectory()->CopyFrom(
-        trajectory);
+    Trajectory trajectory = GenerateTrajectory(std::move(points));
+    obstacle->mutable_latest_feature()->add_predicted_trajectory()->Swap(
+        &trajectory);
     SetEqualProbability(1.0, 0, obstacle);
   } else {
     for (int i = 0; i < feature.predicted_trajectory_size(); ++i) {
@@ -96,7 +98,7 @@ bool FreeMovePredictor::Predict(
       // The following for-loop starts from index 1 because the vector points
       // includes the last point in the existing predicted trajectory
       for (size_t i = 1; i < points.size(); ++i) {
-        trajectory->add_trajectory_point()->CopyFrom(points[i]);
+        trajectory->add_trajectory_point()->Swap(&points[i]);
       }
     }
   }
@@ -20,6 +20,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "modules/common/adapters/proto/adapter_config.pb.h"
 #include "modules/prediction/common/feature_output.h"
@@ -120,9 +121,9 @@ bool InteractionPredictor::Predict(
       DrawTrajectory(*obstacle, lane_sequence, best_lon_acceleration,
                      FLAGS_prediction_trajectory_time_length,
                      FLAGS_prediction_trajectory_time_resolution, &points);
-      Trajectory trajectory = GenerateTrajectory(points);
-      obstacle->mutable_latest_feature()->add_predicted_trajectory()->CopyFrom(
-          trajectory);
+      Trajectory trajectory = GenerateTrajectory(std::move(points));
+      obstacle->mutable_latest_feature()->add_predicted_trajectory()->Swap(
+          &trajectory);
     }
   } else {
     const LaneSequence& sequence = lane_graph->lane_sequence(best_seq_idx);
@@ -137,9 +138,9 @@ bool InteractionPredictor::Predict(
                    best_lon_acceleration,
                    FLAGS_prediction_trajectory_time_length,
                    FLAGS_prediction_trajectory_time_resolution, &points);
-    Trajectory trajectory = GenerateTrajectory(points);
-    obstacle->mutable_latest_feature()->add_predicted_trajectory()->CopyFrom(
-        trajectory);
+    Trajectory trajectory = GenerateTrajectory(std::move(points));
+    obstacle->mutable_latest_feature()->add_predicted_trajectory()->Swap(
+        &trajectory);
   }
   return true;
 }
@@ -54,9 +54,9 @@ bool JunctionPredictor::Predict(
     DrawJunctionTrajectoryPoints(
         latest_feature, junction_exit, FLAGS_prediction_trajectory_time_length,
         FLAGS_prediction_trajectory_time_resolution, &trajectory_points);
-    Trajectory trajectory = GenerateTrajectory(trajectory_points);
-    obstacle->mutable_latest_feature()->add_predicted_trajectory()->CopyFrom(
-        trajectory);
+    Trajectory trajectory = GenerateTrajectory(std::move(trajectory_points));
+    obstacle->mutable_latest_feature()->add_predicted_trajectory()->Swap(
+        &trajectory);
   }
   return true;
 }
@@ -109,10 +109,10 @@ bool LaneSequencePredictor::Predict(
       continue;
     }
 
-    Trajectory trajectory = GenerateTrajectory(points);
+    Trajectory trajectory = GenerateTrajectory(std::move(points));
     trajectory.set_probability(sequence.probability());
-    obstacle->mutable_latest_feature()->add_predicted_trajectory()->CopyFrom(
-        trajectory);
+    obstacle->mutable_latest_feature()->add_predicted_trajectory()->Swap(
+        &trajectory);
   }
   return true;
 }
@@ -147,6 +147,7 @@ void LaneSequencePredictor::DrawLaneSequenceTrajectoryPoints(
     approach_rate = FLAGS_cutin_approach_rate;
   }
   size_t total_num = static_cast<size_t>(total_time / period);
+  points->reserve(total_num);
   for (size_t i = 0; i < total_num; ++i) {
     double relative_time = static_cast<double>(i) * period;
     Eigen::Vector2d point;
@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <utility>
 
 #include "modules/prediction/common/prediction_gflags.h"
 #include "modules/prediction/common/prediction_util.h"
@@ -105,10 +106,10 @@ bool MoveSequencePredictor::Predict(
     std::chrono::duration<double> diff = end_time2 - end_time1;
     ADEBUG << " Time to draw trajectory: " << diff.count() * 1000 << " msec.";
 
-    Trajectory trajectory = GenerateTrajectory(points);
+    Trajectory trajectory = GenerateTrajectory(std::move(points));
     trajectory.set_probability(sequence.probability());
-    obstacle->mutable_latest_feature()->add_predicted_trajectory()->CopyFrom(
-        trajectory);
+    obstacle->mutable_latest_feature()->add_predicted_trajectory()->Swap(
+        &trajectory);
   }
   return true;
 }
@@ -176,6 +177,7 @@ bool MoveSequencePredictor::DrawMoveSequenceTrajectoryPoints(
 
   // Draw each trajectory point within the total time of prediction
   size_t total_num = static_cast<size_t>(total_time / period);
+  points->reserve(total_num);
   for (size_t i = 0; i < total_num; ++i) {
     double relative_time = static_cast<double>(i) * period;
     Eigen::Vector2d point;
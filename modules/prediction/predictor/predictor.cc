@@ -17,6 +17,7 @@
 #include "modules/prediction/predictor/predictor.h"
 
 #include <algorithm>
+#include <utility>
 
 #include "modules/prediction/common/prediction_gflags.h"
 
@@ -31,10 +32,13 @@ int Predictor::NumOfTrajectories(const Obstacle& obstacle) {
   return obstacle.latest_feature().predicted_trajectory_size();
 }
 
-Trajectory Predictor::GenerateTrajectory(
-    const std::vector<TrajectoryPoint>& points) {
+Trajectory Predictor::GenerateTrajectory(std::vector<TrajectoryPoint> points) {
   Trajectory trajectory;
-  *trajectory.mutable_trajectory_point() = {points.begin(), points.end()};
+  auto* trajectory_points = trajectory.mutable_trajectory_point();
+  trajectory_points->Reserve(static_cast<int>(points.size()));
+  for (auto& point : points) {
+    *trajectory_points->Add() = std::move(point);
+  }
   return trajectory;
 }
 
@@ -84,12 +84,13 @@ class Predictor {
 
  protected:
   /**
-   * @brief Generate trajectory from trajectory points
+   * @brief Generate trajectory from trajectory points; the points are
+   *        moved into the trajectory, not copied
    * @param A vector of trajectory points
    * @return Generated trajectory
    */
   static Trajectory GenerateTrajectory(
-      const std::vector<apollo::common::TrajectoryPoint>& points);
+      std::vector<apollo::common::TrajectoryPoint> points);
 
   /**
    * @brief Set equal probability to prediction trajectories
@@ -283,6 +283,7 @@ void SequencePredictor::DrawConstantAccelerationTrajectory(
     return;
   }
   size_t total_num = static_cast<size_t>(total_time / period);
+  points->reserve(total_num);
   for (size_t i = 0; i < total_num; ++i) {
     double relative_time = static_cast<double>(i) * period;
     Eigen::Vector2d point;
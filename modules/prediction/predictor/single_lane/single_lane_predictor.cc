@@ -76,10 +76,10 @@ bool SingleLanePredictor::Predict(
       continue;
     }
 
-    Trajectory trajectory = GenerateTrajectory(points);
+    Trajectory trajectory = GenerateTrajectory(std::move(points));
     trajectory.set_probability(sequence.probability());
-    obstacle->mutable_latest_feature()->add_predicted_trajectory()->CopyFrom(
-        trajectory);
+    obstacle->mutable_latest_feature()->add_predicted_trajectory()->Swap(
+        &trajectory);
   }
   return true;
 }
@@ -116,6 +116,7 @@ void SingleLanePredictor::GenerateTrajectoryPoints(
     return;
   }
   size_t num_of_points = static_cast<size_t>(time_length / time_resolution);
+  points->reserve(num_of_points);
   for (size_t i = 0; i < num_of_points; ++i) {
     double relative_time = static_cast<double>(i) * time_resolution;
     Eigen::Vector2d point;
@@ -137,25 +137,24 @@ void ObstaclesPrioritizer::AssignIgnoreLevel() {
     Vec2d ego_vec = Vec2d::CreateUnitVec2d(ego_theta);
     double s = ego_to_obstacle_vec.InnerProd(ego_vec);
 
-    double pedestrian_like_nearby_lane_radius =
-        FLAGS_pedestrian_nearby_lane_search_radius;
-    bool is_near_lane = PredictionMap::HasNearbyLane(
-        obstacle_x, obstacle_y, pedestrian_like_nearby_lane_radius);
-
     // Decide if we need consider this obstacle
     bool is_in_scan_area = scan_box.IsPointIn({obstacle_x, obstacle_y});
     bool is_on_lane = obstacle_ptr->IsOnLane();
-    bool is_pedestrian_like_in_front_near_lanes =
+    bool is_near_junction = obstacle_ptr->IsNearJunction();
+
+    bool need_consider = is_in_scan_area || is_on_lane || is_near_junction;
+    // Only pay for the nearby-lane map query when the obstacle is a
+    // pedestrian-like type in front and nothing above already keeps it
+    bool is_pedestrian_like_in_front =
         s > FLAGS_back_dist_ignore_ped &&
         (latest_feature_ptr->type() == PerceptionObstacle::PEDESTRIAN ||
          latest_feature_ptr->type() == PerceptionObstacle::BICYCLE ||
          latest_feature_ptr->type() == PerceptionObstacle::UNKNOWN ||
-         latest_feature_ptr->type() == PerceptionObstacle::UNKNOWN_MOVABLE) &&
-        is_near_lane;
-    bool is_near_junction = obstacle_ptr->IsNearJunction();
-
-    bool need_consider = is_in_scan_area || is_on_lane || is_near_junction ||
-                         is_pedestrian_like_in_front_near_lanes;
+         latest_feature_ptr->type() == PerceptionObstacle::UNKNOWN_MOVABLE);
+    if (!need_consider && is_pedestrian_like_in_front) {
+      need_consider = PredictionMap::HasNearbyLane(
+          obstacle_x, obstacle_y, FLAGS_pedestrian_nearby_lane_search_radius);
+    }
 
     if (!need_consider) {
       latest_feature_ptr->mutable_priority()->set_priority(
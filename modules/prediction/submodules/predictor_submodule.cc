@@ -32,7 +32,7 @@ using apollo::common::time::Clock;
 using apollo::perception::PerceptionObstacles;
 
 std::string PredictorSubmodule::Name() const {
-  return FLAGS_evaluator_submodule_name;
+  return FLAGS_predictor_submodule_name;
 }
 
 bool PredictorSubmodule::Init() {
@@ -60,6 +60,8 @@ bool PredictorSubmodule::Proc(
   PredictionObstacles prediction_obstacles =
       PredictorManager::Instance()->prediction_obstacles();
 
+  prediction_obstacles.set_start_timestamp(
+      absl::ToDoubleSeconds(frame_start_time - absl::UnixEpoch()));
   prediction_obstacles.set_end_timestamp(Clock::NowInSeconds());
   prediction_obstacles.mutable_header()->set_lidar_timestamp(
       perception_header.lidar_timestamp());
@@ -32,3 +32,11 @@ DEFINE_bool(enable_change_lane_in_result, true,
 
 DEFINE_uint32(routing_response_history_interval_ms, 1000,
               "ms, emit routing resposne for this time interval");
+
+DEFINE_uint32(routing_response_cache_size, 8,
+              "max number of recent routing responses cached by request "
+              "endpoints for instant repeats");
+
+DEFINE_double(routing_cache_s_quantization, 2.0,
+              "meters, quantization of waypoint s when building routing "
+              "response cache keys");
@@ -179,12 +179,11 @@ void SubTopoGraph::InitSubNodeByValidRange(
     if (range.Length() < MIN_INTERNAL_FOR_NODE) {
       continue;
     }
-    std::shared_ptr<TopoNode> sub_topo_node_ptr;
-    sub_topo_node_ptr.reset(new TopoNode(topo_node, range));
-    sub_node_vec.emplace_back(sub_topo_node_ptr.get(), range);
-    sub_node_set.insert(sub_topo_node_ptr.get());
-    sub_node_sorted_vec.push_back(sub_topo_node_ptr.get());
-    topo_nodes_.push_back(std::move(sub_topo_node_ptr));
+    topo_nodes_.emplace_back(topo_node, range);
+    TopoNode* sub_topo_node = &topo_nodes_.back();
+    sub_node_vec.emplace_back(sub_topo_node, range);
+    sub_node_set.insert(sub_topo_node);
+    sub_node_sorted_vec.push_back(sub_topo_node);
   }
 
   for (size_t i = 1; i < sub_node_sorted_vec.size(); ++i) {
@@ -196,11 +195,10 @@ void SubTopoGraph::InitSubNodeByValidRange(
       edge.set_to_lane_id(topo_node->LaneId());
       edge.set_direction_type(Edge::FORWARD);
       edge.set_cost(0.0);
-      std::shared_ptr<TopoEdge> topo_edge_ptr;
-      topo_edge_ptr.reset(new TopoEdge(edge, pre_node, next_node));
-      pre_node->AddOutEdge(topo_edge_ptr.get());
-      next_node->AddInEdge(topo_edge_ptr.get());
-      topo_edges_.push_back(std::move(topo_edge_ptr));
+      topo_edges_.emplace_back(edge, pre_node, next_node);
+      TopoEdge* topo_edge = &topo_edges_.back();
+      pre_node->AddOutEdge(topo_edge);
+      next_node->AddInEdge(topo_edge);
     }
   }
 }
@@ -219,7 +217,7 @@ void SubTopoGraph::InitSubEdge(const TopoNode* topo_node) {
 
 void SubTopoGraph::InitInSubNodeSubEdge(
     TopoNode* const sub_node,
-    const std::unordered_set<const TopoEdge*> origin_edge) {
+    const std::unordered_set<const TopoEdge*>& origin_edge) {
   std::unordered_set<TopoNode*> other_sub_nodes;
   for (const auto* in_edge : origin_edge) {
     if (GetSubNodes(in_edge->FromNode(), &other_sub_nodes)) {
@@ -227,26 +225,22 @@ void SubTopoGraph::InitInSubNodeSubEdge(
         if (!sub_from_node->IsOverlapEnough(sub_node, in_edge)) {
           continue;
         }
-        std::shared_ptr<TopoEdge> topo_edge_ptr;
-        topo_edge_ptr.reset(
-            new TopoEdge(in_edge->PbEdge(), sub_from_node, sub_node));
-        sub_node->AddInEdge(topo_edge_ptr.get());
-        sub_from_node->AddOutEdge(topo_edge_ptr.get());
-        topo_edges_.push_back(std::move(topo_edge_ptr));
+        topo_edges_.emplace_back(in_edge->PbEdge(), sub_from_node, sub_node);
+        TopoEdge* topo_edge = &topo_edges_.back();
+        sub_node->AddInEdge(topo_edge);
+        sub_from_node->AddOutEdge(topo_edge);
       }
     } else if (in_edge->FromNode()->IsOverlapEnough(sub_node, in_edge)) {
-      std::shared_ptr<TopoEdge> topo_edge_ptr;
-      topo_edge_ptr.reset(
-          new TopoEdge(in_edge->PbEdge(), in_edge->FromNode(), sub_node));
-      sub_node->AddInEdge(topo_edge_ptr.get());
-      topo_edges_.push_back(std::move(topo_edge_ptr));
+      topo_edges_.emplace_back(in_edge->PbEdge(), in_edge->FromNode(),
+                               sub_node);
+      sub_node->AddInEdge(&topo_edges_.back());
     }
   }
 }
 
 void SubTopoGraph::InitOutSubNodeSubEdge(
     TopoNode* const sub_node,
-    const std::unordered_set<const TopoEdge*> origin_edge) {
+    const std::unordered_set<const TopoEdge*>& origin_edge) {
   std::unordered_set<TopoNode*> other_sub_nodes;
   for (const auto* out_edge : origin_edge) {
     if (GetSubNodes(out_edge->ToNode(), &other_sub_nodes)) {
@@ -254,19 +248,15 @@ void SubTopoGraph::InitOutSubNodeSubEdge(
         if (!sub_node->IsOverlapEnough(sub_to_node, out_edge)) {
           continue;
         }
-        std::shared_ptr<TopoEdge> topo_edge_ptr;
-        topo_edge_ptr.reset(
-            new TopoEdge(out_edge->PbEdge(), sub_node, sub_to_node));
-        sub_node->AddOutEdge(topo_edge_ptr.get());
-        sub_to_node->AddInEdge(topo_edge_ptr.get());
-        topo_edges_.push_back(std::move(topo_edge_ptr));
+        topo_edges_.emplace_back(out_edge->PbEdge(), sub_node, sub_to_node);
+        TopoEdge* topo_edge = &topo_edges_.back();
+        sub_node->AddOutEdge(topo_edge);
+        sub_to_node->AddInEdge(topo_edge);
       }
     } else if (sub_node->IsOverlapEnough(out_edge->ToNode(), out_edge)) {
-      std::shared_ptr<TopoEdge> topo_edge_ptr;
-      topo_edge_ptr.reset(
-          new TopoEdge(out_edge->PbEdge(), sub_node, out_edge->ToNode()));
-      sub_node->AddOutEdge(topo_edge_ptr.get());
-      topo_edges_.push_back(std::move(topo_edge_ptr));
+      topo_edges_.emplace_back(out_edge->PbEdge(), sub_node,
+                               out_edge->ToNode());
+      sub_node->AddOutEdge(&topo_edges_.back());
     }
   }
 }
@@ -296,7 +286,7 @@ void SubTopoGraph::AddPotentialEdge(const TopoNode* topo_node) {
 
 void SubTopoGraph::AddPotentialInEdge(
     TopoNode* const sub_node,
-    const std::unordered_set<const TopoEdge*> origin_edge) {
+    const std::unordered_set<const TopoEdge*>& origin_edge) {
   std::unordered_set<TopoNode*> other_sub_nodes;
   for (const auto* in_edge : origin_edge) {
     if (GetSubNodes(in_edge->FromNode(), &other_sub_nodes)) {
@@ -307,29 +297,25 @@ void SubTopoGraph::AddPotentialInEdge(
         if (!IsReachable(sub_from_node, sub_node)) {
           continue;
         }
-        std::shared_ptr<TopoEdge> topo_edge_ptr;
-        topo_edge_ptr.reset(
-            new TopoEdge(in_edge->PbEdge(), sub_from_node, sub_node));
-        sub_node->AddInEdge(topo_edge_ptr.get());
-        sub_from_node->AddOutEdge(topo_edge_ptr.get());
-        topo_edges_.push_back(std::move(topo_edge_ptr));
+        topo_edges_.emplace_back(in_edge->PbEdge(), sub_from_node, sub_node);
+        TopoEdge* topo_edge = &topo_edges_.back();
+        sub_node->AddInEdge(topo_edge);
+        sub_from_node->AddOutEdge(topo_edge);
       }
     } else {
       if (sub_node->GetInEdgeFrom(in_edge->FromNode()) != nullptr) {
         continue;
       }
-      std::shared_ptr<TopoEdge> topo_edge_ptr;
-      topo_edge_ptr.reset(
-          new TopoEdge(in_edge->PbEdge(), in_edge->FromNode(), sub_node));
-      sub_node->AddInEdge(topo_edge_ptr.get());
-      topo_edges_.push_back(std::move(topo_edge_ptr));
+      topo_edges_.emplace_back(in_edge->PbEdge(), in_edge->FromNode(),
+                               sub_node);
+      sub_node->AddInEdge(&topo_edges_.back());
     }
   }
 }
 
 void SubTopoGraph::AddPotentialOutEdge(
     TopoNode* const sub_node,
-    const std::unordered_set<const TopoEdge*> origin_edge) {
+    const std::unordered_set<const TopoEdge*>& origin_edge) {
   std::unordered_set<TopoNode*> other_sub_nodes;
   for (const auto* out_edge : origin_edge) {
     if (GetSubNodes(out_edge->ToNode(), &other_sub_nodes)) {
@@ -340,22 +326,18 @@ void SubTopoGraph::AddPotentialOutEdge(
         if (!IsReachable(sub_node, sub_to_node)) {
           continue;
         }
-        std::shared_ptr<TopoEdge> topo_edge_ptr;
-        topo_edge_ptr.reset(
-            new TopoEdge(out_edge->PbEdge(), sub_node, sub_to_node));
-        sub_node->AddOutEdge(topo_edge_ptr.get());
-        sub_to_node->AddInEdge(topo_edge_ptr.get());
-        topo_edges_.push_back(std::move(topo_edge_ptr));
+        topo_edges_.emplace_back(out_edge->PbEdge(), sub_node, sub_to_node);
+        TopoEdge* topo_edge = &topo_edges_.back();
+        sub_node->AddOutEdge(topo_edge);
+        sub_to_node->AddInEdge(topo_edge);
       }
     } else {
       if (sub_node->GetOutEdgeTo(out_edge->ToNode()) != nullptr) {
         continue;
       }
-      std::shared_ptr<TopoEdge> topo_edge_ptr;
-      topo_edge_ptr.reset(
-          new TopoEdge(out_edge->PbEdge(), sub_node, out_edge->ToNode()));
-      sub_node->AddOutEdge(topo_edge_ptr.get());
-      topo_edges_.push_back(std::move(topo_edge_ptr));
+      topo_edges_.emplace_back(out_edge->PbEdge(), sub_node,
+                               out_edge->ToNode());
+      sub_node->AddOutEdge(&topo_edges_.back());
     }
   }
 }
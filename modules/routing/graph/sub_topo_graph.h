@@ -16,7 +16,7 @@
 
 #pragma once
 
-#include <memory>
+#include <deque>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -76,10 +76,10 @@ class SubTopoGraph {
 
   void InitInSubNodeSubEdge(
       TopoNode* const sub_node,
-      const std::unordered_set<const TopoEdge*> origin_edge);
+      const std::unordered_set<const TopoEdge*>& origin_edge);
   void InitOutSubNodeSubEdge(
       TopoNode* const sub_node,
-      const std::unordered_set<const TopoEdge*> origin_edge);
+      const std::unordered_set<const TopoEdge*>& origin_edge);
 
   bool GetSubNodes(const TopoNode* node,
                    std::unordered_set<TopoNode*>* const sub_nodes) const;
@@ -87,14 +87,17 @@ class SubTopoGraph {
   void AddPotentialEdge(const TopoNode* topo_node);
   void AddPotentialInEdge(
       TopoNode* const sub_node,
-      const std::unordered_set<const TopoEdge*> origin_edge);
+      const std::unordered_set<const TopoEdge*>& origin_edge);
   void AddPotentialOutEdge(
       TopoNode* const sub_node,
-      const std::unordered_set<const TopoEdge*> origin_edge);
+      const std::unordered_set<const TopoEdge*>& origin_edge);
 
  private:
-  std::vector<std::shared_ptr<TopoNode>> topo_nodes_;
-  std::vector<std::shared_ptr<TopoEdge>> topo_edges_;
+  // Sub nodes and sub edges are owned in bulk by the graph; deque keeps
+  // the addresses handed out below stable while avoiding one heap
+  // allocation per node / edge on every query.
+  std::deque<TopoNode> topo_nodes_;
+  std::deque<TopoEdge> topo_edges_;
   std::unordered_map<const TopoNode*, std::vector<NodeWithRange>>
       sub_node_range_sorted_map_;
   std::unordered_map<const TopoNode*, std::unordered_set<TopoNode*>>
@@ -16,11 +16,61 @@
 
 #include "modules/routing/routing.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "absl/strings/str_cat.h"
+
 #include "modules/common/util/point_factory.h"
 #include "modules/routing/common/routing_gflags.h"
 
 namespace apollo {
 namespace routing {
+namespace {
+
+constexpr double kWaypointSEpsilon = 1e-3;
+
+// True if the two fixed requests agree on everything except, possibly,
+// the start waypoint: same destination and intermediate waypoints and the
+// same black list, so the old route's tail is still a valid answer.
+bool TailAndBlackListMatch(const RoutingRequest& request,
+                           const RoutingRequest& last_request) {
+  if (request.waypoint_size() != last_request.waypoint_size() ||
+      request.waypoint_size() < 2) {
+    return false;
+  }
+  for (int i = 1; i < request.waypoint_size(); ++i) {
+    const auto& waypoint = request.waypoint(i);
+    const auto& last_waypoint = last_request.waypoint(i);
+    if (waypoint.id() != last_waypoint.id() ||
+        std::fabs(waypoint.s() - last_waypoint.s()) > kWaypointSEpsilon) {
+      return false;
+    }
+  }
+  if (request.blacklisted_lane_size() !=
+          last_request.blacklisted_lane_size() ||
+      request.blacklisted_road_size() !=
+          last_request.blacklisted_road_size()) {
+    return false;
+  }
+  for (int i = 0; i < request.blacklisted_lane_size(); ++i) {
+    const auto& lane = request.blacklisted_lane(i);
+    const auto& last_lane = last_request.blacklisted_lane(i);
+    if (lane.id() != last_lane.id() ||
+        std::fabs(lane.start_s() - last_lane.start_s()) > kWaypointSEpsilon ||
+        std::fabs(lane.end_s() - last_lane.end_s()) > kWaypointSEpsilon) {
+      return false;
+    }
+  }
+  for (int i = 0; i < request.blacklisted_road_size(); ++i) {
+    if (request.blacklisted_road(i) != last_request.blacklisted_road(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
 
 using apollo::common::ErrorCode;
 
@@ -85,11 +135,140 @@ RoutingRequest Routing::FillLaneInfoIfMissing(
   return fixed_request;
 }
 
+std::string Routing::BuildRequestKey(const RoutingRequest& routing_request) {
+  std::string key;
+  for (const auto& waypoint : routing_request.waypoint()) {
+    if (waypoint.has_id()) {
+      absl::StrAppend(&key, waypoint.id(), ":",
+                      static_cast<int64_t>(
+                          waypoint.s() / FLAGS_routing_cache_s_quantization),
+                      ";");
+    } else {
+      absl::StrAppend(&key, static_cast<int64_t>(waypoint.pose().x()), ",",
+                      static_cast<int64_t>(waypoint.pose().y()), ";");
+    }
+  }
+  for (const auto& lane : routing_request.blacklisted_lane()) {
+    absl::StrAppend(&key, "bl:", lane.id(), ":",
+                    static_cast<int64_t>(lane.start_s()), ":",
+                    static_cast<int64_t>(lane.end_s()), ";");
+  }
+  for (const auto& road : routing_request.blacklisted_road()) {
+    absl::StrAppend(&key, "br:", road, ";");
+  }
+  return key;
+}
+
+bool Routing::GetRouteFromCache(const RoutingRequest& routing_request,
+                                RoutingResponse* const routing_response) {
+  const std::string key = BuildRequestKey(routing_request);
+  for (auto it = route_cache_.begin(); it != route_cache_.end(); ++it) {
+    if (it->first != key) {
+      continue;
+    }
+    route_cache_.splice(route_cache_.begin(), route_cache_, it);
+    routing_response->CopyFrom(route_cache_.front().second);
+    // the component stamps a fresh header after Process() returns; only
+    // the embedded request needs to reflect the current one
+    routing_response->mutable_routing_request()->CopyFrom(routing_request);
+    return true;
+  }
+  return false;
+}
+
+void Routing::AddRouteToCache(const RoutingRequest& routing_request,
+                              const RoutingResponse& routing_response) {
+  const std::string key = BuildRequestKey(routing_request);
+  for (auto it = route_cache_.begin(); it != route_cache_.end(); ++it) {
+    if (it->first == key) {
+      route_cache_.erase(it);
+      break;
+    }
+  }
+  route_cache_.emplace_front(key, routing_response);
+  while (route_cache_.size() > FLAGS_routing_response_cache_size) {
+    route_cache_.pop_back();
+  }
+}
+
+bool Routing::ReuseRouteTail(const RoutingRequest& routing_request,
+                             RoutingResponse* const routing_response) {
+  if (!has_last_route_ ||
+      !TailAndBlackListMatch(routing_request, last_request_)) {
+    return false;
+  }
+  const auto& start = routing_request.waypoint(0);
+  if (!start.has_id()) {
+    return false;
+  }
+  // locate the new start on the previous route; parallel passages are
+  // searched too, so a start on the source lane of a missed lane change
+  // still reconnects
+  int road_index = -1;
+  int passage_index = -1;
+  int segment_index = -1;
+  for (int i = 0; i < last_response_.road_size() && road_index < 0; ++i) {
+    const auto& road = last_response_.road(i);
+    for (int j = 0; j < road.passage_size() && road_index < 0; ++j) {
+      const auto& passage = road.passage(j);
+      for (int k = 0; k < passage.segment_size(); ++k) {
+        const auto& segment = passage.segment(k);
+        if (segment.id() == start.id() &&
+            start.s() >= segment.start_s() - kWaypointSEpsilon &&
+            start.s() <= segment.end_s() + kWaypointSEpsilon) {
+          road_index = i;
+          passage_index = j;
+          segment_index = k;
+          break;
+        }
+      }
+    }
+  }
+  if (road_index < 0) {
+    return false;
+  }
+  routing_response->CopyFrom(last_response_);
+  routing_response->mutable_road()->DeleteSubrange(0, road_index);
+  auto* passage =
+      routing_response->mutable_road(0)->mutable_passage(passage_index);
+  double trimmed_length = 0.0;
+  for (int k = 0; k < segment_index; ++k) {
+    trimmed_length +=
+        passage->segment(k).end_s() - passage->segment(k).start_s();
+  }
+  passage->mutable_segment()->DeleteSubrange(0, segment_index);
+  auto* reconnect_segment = passage->mutable_segment(0);
+  const double new_start_s =
+      std::min(std::max(start.s(), reconnect_segment->start_s()),
+               reconnect_segment->end_s());
+  trimmed_length += new_start_s - reconnect_segment->start_s();
+  reconnect_segment->set_start_s(new_start_s);
+  if (routing_response->has_measurement()) {
+    routing_response->mutable_measurement()->set_distance(std::max(
+        0.0, routing_response->measurement().distance() - trimmed_length));
+  }
+  routing_response->mutable_routing_request()->CopyFrom(routing_request);
+  return true;
+}
+
 bool Routing::Process(const std::shared_ptr<RoutingRequest>& routing_request,
                       RoutingResponse* const routing_response) {
   CHECK_NOTNULL(routing_response);
   AINFO << "Get new routing request:" << routing_request->DebugString();
   const auto& fixed_request = FillLaneInfoIfMissing(*routing_request);
+  if (GetRouteFromCache(fixed_request, routing_response)) {
+    AINFO << "Replied with routing response from cache.";
+    monitor_logger_buffer_.INFO("Routing success! (cached)");
+    return true;
+  }
+  if (ReuseRouteTail(fixed_request, routing_response)) {
+    AINFO << "Replied with the previous route trimmed at the new start.";
+    last_request_ = fixed_request;
+    last_response_ = *routing_response;
+    AddRouteToCache(fixed_request, *routing_response);
+    monitor_logger_buffer_.INFO("Routing success! (incremental)");
+    return true;
+  }
   if (!navigator_ptr_->SearchRoute(fixed_request, routing_response)) {
     AERROR << "Failed to search route with navigator.";
 
@@ -97,6 +276,10 @@ bool Routing::Process(const std::shared_ptr<RoutingRequest>& routing_request,
                                 routing_response->status().msg());
     return false;
   }
+  last_request_ = fixed_request;
+  last_response_ = *routing_response;
+  has_last_route_ = true;
+  AddRouteToCache(fixed_request, *routing_response);
   monitor_logger_buffer_.INFO("Routing success!");
   return true;
 }
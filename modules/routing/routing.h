@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <list>
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "modules/common/monitor_log/monitor_log_buffer.h"
 #include "modules/common/status/status.h"
@@ -61,11 +63,43 @@ class Routing {
  private:
   RoutingRequest FillLaneInfoIfMissing(const RoutingRequest &routing_request);
 
+  /**
+   * @brief build a cache key from the request endpoints and black list,
+   *        with waypoint s quantized so nearby repeats share an entry
+   */
+  static std::string BuildRequestKey(const RoutingRequest &routing_request);
+
+  /**
+   * @brief look up a recently generated response for an equivalent request
+   * @return true if the response was served from the cache
+   */
+  bool GetRouteFromCache(const RoutingRequest &routing_request,
+                         RoutingResponse *const routing_response);
+
+  void AddRouteToCache(const RoutingRequest &routing_request,
+                       const RoutingResponse &routing_response);
+
+  /**
+   * @brief incremental replan: if the request differs from the previous one
+   *        only in its start waypoint and the new start still lies on the
+   *        previous route, reuse the previous route's tail instead of
+   *        searching the whole topo graph again
+   * @return true if the response was rebuilt from the previous route
+   */
+  bool ReuseRouteTail(const RoutingRequest &routing_request,
+                      RoutingResponse *const routing_response);
+
   std::unique_ptr<Navigator> navigator_ptr_;
   common::monitor::MonitorLogBuffer monitor_logger_buffer_;
 
   RoutingConfig routing_conf_;
   const hdmap::HDMap *hdmap_ = nullptr;
+
+  // most-recently-used first; bounded by FLAGS_routing_response_cache_size
+  std::list<std::pair<std::string, RoutingResponse>> route_cache_;
+  RoutingRequest last_request_;
+  RoutingResponse last_response_;
+  bool has_last_route_ = false;
 };
 
 }  // namespace routing
@@ -275,6 +275,8 @@ bool AStarStrategy::Search(const TopoGraph* graph,
       next_edge_set.insert(sub_edge_set.begin(), sub_edge_set.end());
     }
 
+    // from_node is fixed for the whole expansion, look its score up once
+    const double from_node_g_score = g_score_[from_node];
     for (const auto* edge : next_edge_set) {
       const auto* to_node = edge->ToNode();
       if (closed_set_.count(to_node) == 1) {
@@ -283,8 +285,7 @@ bool AStarStrategy::Search(const TopoGraph* graph,
       if (GetResidualS(edge, to_node) < FLAGS_min_length_for_lane_change) {
         continue;
       }
-      tentative_g_score =
-          g_score_[current_node.topo_node] + GetCostToNeighbor(edge);
+      tentative_g_score = from_node_g_score + GetCostToNeighbor(edge);
       if (edge->Type() != TopoEdgeType::TET_FORWARD) {
         tentative_g_score -=
             (edge->FromNode()->Cost() + edge->ToNode()->Cost()) / 2;
@@ -16,6 +16,9 @@
 
 #include "modules/routing/topo_creator/graph_creator.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include <vector>
 
 #include "absl/strings/match.h"
@@ -95,6 +98,10 @@ bool GraphCreator::Create() {
   const double min_turn_radius =
       VehicleConfigHelper::GetConfig().vehicle_param().min_turn_radius();
 
+  // Assign node indices in deterministic lane order first, then fill the
+  // nodes in parallel: building a node only reads the lane and writes its
+  // own output slot.
+  std::vector<const hdmap::Lane*> valid_lanes;
   for (const auto& lane : pbmap_.lane()) {
     const auto& lane_id = lane.id().id();
     if (forbidden_lane_id_set_.find(lane_id) != forbidden_lane_id_set_.end()) {
@@ -109,14 +116,37 @@ bool GraphCreator::Create() {
     }
     AINFO << "Current lane id: " << lane_id;
     node_index_map_[lane_id] = graph_.node_size();
-    const auto iter = road_id_map_.find(lane_id);
-    if (iter != road_id_map_.end()) {
-      node_creator::GetPbNode(lane, iter->second, routing_conf_,
-                              graph_.add_node());
-    } else {
-      AWARN << "Failed to find road id of lane " << lane_id;
-      node_creator::GetPbNode(lane, "", routing_conf_, graph_.add_node());
-    }
+    valid_lanes.push_back(&lane);
+    graph_.add_node();
+  }
+
+  const unsigned int num_threads =
+      std::max(1u, std::min(std::thread::hardware_concurrency(),
+                            static_cast<unsigned int>(valid_lanes.size())));
+  std::atomic<size_t> next_lane_index(0);
+  std::vector<std::thread> workers;
+  workers.reserve(num_threads);
+  for (unsigned int thread_index = 0; thread_index < num_threads;
+       ++thread_index) {
+    workers.emplace_back([this, &valid_lanes, &next_lane_index]() {
+      for (size_t i = next_lane_index.fetch_add(1); i < valid_lanes.size();
+           i = next_lane_index.fetch_add(1)) {
+        const auto& lane = *valid_lanes[i];
+        const auto& lane_id = lane.id().id();
+        const auto iter = road_id_map_.find(lane_id);
+        if (iter != road_id_map_.end()) {
+          node_creator::GetPbNode(lane, iter->second, routing_conf_,
+                                  graph_.mutable_node(static_cast<int>(i)));
+        } else {
+          AWARN << "Failed to find road id of lane " << lane_id;
+          node_creator::GetPbNode(lane, "", routing_conf_,
+                                  graph_.mutable_node(static_cast<int>(i)));
+        }
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
   }
 
   for (const auto& lane : pbmap_.lane()) {
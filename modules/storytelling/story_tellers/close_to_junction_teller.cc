@@ -71,23 +71,38 @@ bool IsPointInRegularJunction(const PathPoint& point,
 double DistanceToJunction(const ADCTrajectory& adc_trajectory,
                           std::string* junction_id) {
   const double s_start = adc_trajectory.trajectory_point(0).path_point().s();
+  // Trajectory points are much denser than the junction search radius, so
+  // stepping by a fraction of the radius keeps the detection coverage while
+  // issuing far fewer map queries.
+  const double query_stride = 0.5 * FLAGS_junction_search_radius;
+
   // Test for PNCJunction.
+  double next_query_s = s_start;
   for (const auto& point : adc_trajectory.trajectory_point()) {
     const auto& path_point = point.path_point();
     if (path_point.s() > FLAGS_adc_trajectory_search_length) {
       break;
     }
+    if (path_point.s() < next_query_s) {
+      continue;
+    }
+    next_query_s = path_point.s() + query_stride;
     if (IsPointInPNCJunction(path_point, junction_id)) {
       return path_point.s() - s_start;
     }
   }
 
   // Test for regular junction.
+  next_query_s = s_start;
   for (const auto& point : adc_trajectory.trajectory_point()) {
     const auto& path_point = point.path_point();
     if (path_point.s() > FLAGS_adc_trajectory_search_length) {
       break;
     }
+    if (path_point.s() < next_query_s) {
+      continue;
+    }
+    next_query_s = path_point.s() + query_stride;
     if (IsPointInRegularJunction(path_point, junction_id)) {
       return path_point.s() - s_start;
     }
@@ -114,16 +129,24 @@ void CloseToJunctionTeller::Update(Stories* stories) {
     return;
   }
 
-  std::string junction_id;
-  const double distance = DistanceToJunction(*trajectory, &junction_id);
-  const bool close_to_junction = distance >= 0;
+  // The result only depends on the trajectory, so recompute it when planning
+  // publishes a new one and reuse the cached answer in between.
+  const uint32_t sequence_num = trajectory->header().sequence_num();
+  if (!has_cached_result_ || sequence_num != cached_sequence_num_) {
+    cached_junction_id_.clear();
+    cached_distance_ = DistanceToJunction(*trajectory, &cached_junction_id_);
+    cached_sequence_num_ = sequence_num;
+    has_cached_result_ = true;
+  }
+
+  const bool close_to_junction = cached_distance_ >= 0;
   if (close_to_junction) {
     if (!stories->has_close_to_junction()) {
       AINFO << "Enter CloseToJunction story";
     }
     auto* story = stories->mutable_close_to_junction();
-    story->set_distance(distance);
-    story->set_junction_id(junction_id);
+    story->set_distance(cached_distance_);
+    story->set_junction_id(cached_junction_id_);
   } else if (stories->has_close_to_junction()) {
     AINFO << "Exit CloseToJunction story";
     stories->clear_close_to_junction();
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "modules/storytelling/story_tellers/base_teller.h"
 
 namespace apollo {
@@ -25,6 +27,13 @@ class CloseToJunctionTeller : public BaseTeller {
  public:
   void Init() override;
   void Update(Stories* stories) override;
+
+ private:
+  // Junction query result cached for the latest planning trajectory.
+  uint32_t cached_sequence_num_ = 0;
+  bool has_cached_result_ = false;
+  double cached_distance_ = -1.0;
+  std::string cached_junction_id_;
 };
 
 }  // namespace storytelling
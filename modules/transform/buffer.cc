@@ -103,6 +103,19 @@ void Buffer::SubscriptionCallbackImpl(
 
       if (is_static) {
         static_msgs_.push_back(trans_stamped);
+        std::lock_guard<std::mutex> lock(static_cache_mutex_);
+        static_edges_[trans_stamped.child_frame_id] = std::make_pair(
+            trans_stamped.header.frame_id,
+            Eigen::Affine3d(
+                Eigen::Translation3d(trans_stamped.transform.translation.x,
+                                     trans_stamped.transform.translation.y,
+                                     trans_stamped.transform.translation.z) *
+                Eigen::Quaterniond(trans_stamped.transform.rotation.w,
+                                   trans_stamped.transform.rotation.x,
+                                   trans_stamped.transform.rotation.y,
+                                   trans_stamped.transform.rotation.z)));
+        // Composed pairs may now go through the new edge.
+        static_pair_cache_.clear();
       }
       setTransform(trans_stamped, authority, is_static);
     } catch (tf2::TransformException& ex) {
@@ -157,6 +170,83 @@ void Buffer::TF2MsgToCyber(
       tf2_trans_stamped.transform.rotation.w);
 }
 
+bool Buffer::ComposeStaticPose(const std::string& frame_id,
+                               const std::string& child_frame_id,
+                               Eigen::Affine3d* pose) const {
+  // Bounds the walk in case the static edges ever form a cycle.
+  static constexpr int kMaxChainDepth = 16;
+  auto walk_up = [this](const std::string& from, const std::string& to,
+                        Eigen::Affine3d* result) {
+    Eigen::Affine3d acc = Eigen::Affine3d::Identity();
+    std::string cur = from;
+    for (int depth = 0; depth < kMaxChainDepth; ++depth) {
+      if (cur == to) {
+        *result = acc;
+        return true;
+      }
+      auto itr = static_edges_.find(cur);
+      if (itr == static_edges_.end()) {
+        return false;
+      }
+      acc = itr->second.second * acc;
+      cur = itr->second.first;
+    }
+    return false;
+  };
+
+  Eigen::Affine3d chain;
+  if (walk_up(child_frame_id, frame_id, &chain)) {
+    *pose = chain;
+    return true;
+  }
+  if (walk_up(frame_id, child_frame_id, &chain)) {
+    *pose = chain.inverse();
+    return true;
+  }
+  return false;
+}
+
+bool Buffer::QueryPose(const std::string& frame_id,
+                       const std::string& child_frame_id,
+                       const cyber::Time& time, Eigen::Affine3d* pose,
+                       std::string* errstr) const {
+  // Frame pairs connected by static edges only are time invariant; they
+  // are composed once and then served without a graph traversal.
+  const std::string cache_key = frame_id + "/" + child_frame_id;
+  {
+    std::lock_guard<std::mutex> lock(static_cache_mutex_);
+    auto itr = static_pair_cache_.find(cache_key);
+    if (itr != static_pair_cache_.end()) {
+      *pose = itr->second;
+      return true;
+    }
+    Eigen::Affine3d composed;
+    if (ComposeStaticPose(frame_id, child_frame_id, &composed)) {
+      static_pair_cache_.emplace(cache_key, composed);
+      *pose = composed;
+      return true;
+    }
+  }
+
+  tf2::Time tf2_time(time.ToNanosecond());
+  geometry_msgs::TransformStamped stamped;
+  try {
+    stamped = lookupTransform(frame_id, child_frame_id, tf2_time);
+  } catch (tf2::TransformException& ex) {
+    if (errstr != nullptr) {
+      *errstr = ex.what();
+    }
+    return false;
+  }
+  *pose = Eigen::Translation3d(stamped.transform.translation.x,
+                               stamped.transform.translation.y,
+                               stamped.transform.translation.z) *
+          Eigen::Quaterniond(
+              stamped.transform.rotation.w, stamped.transform.rotation.x,
+              stamped.transform.rotation.y, stamped.transform.rotation.z);
+  return true;
+}
+
 TransformStamped Buffer::lookupTransform(const std::string& target_frame,
                                          const std::string& source_frame,
                                          const cyber::Time& time,
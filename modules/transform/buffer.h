@@ -17,9 +17,13 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "Eigen/Geometry"
 #include "tf2/buffer_core.h"
 #include "tf2/convert.h"
 
@@ -119,6 +123,15 @@ class Buffer : public BufferInterface, public tf2::BufferCore {
                          const std::string& child_frame_id,
                          TransformStamped* tf);
 
+  /** \brief Query the pose of child_frame_id relative to frame_id at the
+   * given time, interpolated from the buffered history and returned as an
+   * Eigen transform without the proto detour taken by lookupTransform.
+   * \return True on success; on failure errstr is filled if not nullptr.
+   */
+  bool QueryPose(const std::string& frame_id, const std::string& child_frame_id,
+                 const cyber::Time& time, Eigen::Affine3d* pose,
+                 std::string* errstr = nullptr) const;
+
  private:
   void SubscriptionCallback(
       const std::shared_ptr<const TransformStampeds>& transform);
@@ -139,6 +152,25 @@ class Buffer : public BufferInterface, public tf2::BufferCore {
   cyber::Time last_update_;
   std::vector<geometry_msgs::TransformStamped> static_msgs_;
 
+  template <typename T>
+  using AlignedMap = std::unordered_map<
+      std::string, T, std::hash<std::string>, std::equal_to<std::string>,
+      Eigen::aligned_allocator<std::pair<const std::string, T>>>;
+
+  /**@brief Compose the static chain from child_frame_id up to frame_id.
+   * Returns false if the frames are not connected by static edges only. */
+  bool ComposeStaticPose(const std::string& frame_id,
+                         const std::string& child_frame_id,
+                         Eigen::Affine3d* pose) const;
+
+  /**@brief Guards the static edge map and the composed pair cache. */
+  mutable std::mutex static_cache_mutex_;
+  /**@brief Static edges child frame -> (parent frame, parent_T_child). */
+  AlignedMap<std::pair<std::string, Eigen::Affine3d>> static_edges_;
+  /**@brief Fully composed static pairs, keyed "frame/child", filled at
+   * first query so repeated lookups are one hash fetch. */
+  mutable AlignedMap<Eigen::Affine3d> static_pair_cache_;
+
   DECLARE_SINGLETON(Buffer)
 };  // class
 
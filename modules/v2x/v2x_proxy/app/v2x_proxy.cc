@@ -125,6 +125,14 @@ bool V2xProxy::TrafficLightProc(CurrentLaneTrafficLight* msg) {
 }
 
 void V2xProxy::OnX2vTrafficLightTimer() {
+  // Skip the tick when no new traffic light has arrived from the OBU, so a
+  // quiet link does not cost an hdmap signal query and a stale republish.
+  const uint64_t recv_count = obu_interface_->TrafficLightRecvCount();
+  if (recv_count == processed_trafficlight_count_) {
+    return;
+  }
+  processed_trafficlight_count_ = recv_count;
+
   x2v_trafficlight_->Clear();
   obu_interface_->GetV2xTrafficLightFromObu(x2v_trafficlight_);
   if (!x2v_trafficlight_->has_current_lane_trafficlight()) {
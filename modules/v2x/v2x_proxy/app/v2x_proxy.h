@@ -64,6 +64,10 @@ class V2xProxy {
   bool TrafficLightProc(CurrentLaneTrafficLight *msg);
   std::unique_ptr<apollo::hdmap::HDMap> hdmap_;
 
+  // Count of traffic light messages already processed, used to skip timer
+  // ticks with no new OBU data.
+  uint64_t processed_trafficlight_count_ = 0;
+
   bool init_flag_ = false;
 };
 
@@ -27,6 +27,10 @@ namespace v2x {
 using apollo::perception::PerceptionObstacles;
 using grpc::Status;
 
+namespace {
+constexpr int kIntakeStatsLogInterval = 100;
+}  // namespace
+
 GrpcServerImpl::GrpcServerImpl() : node_(cyber::CreateNode("v2x_grpc_server")) {
   CHECK(node_) << "Create v2x grpc server node failed";
   first_flag_writer_ =
@@ -41,12 +45,14 @@ grpc::Status GrpcServerImpl::SendPerceptionObstacles(
     StatusResponse* response) {
   ADEBUG << "Received SendPerceptionObstacles request from client! \n";
   if (request->perception_obstacle().empty()) {
+    obstacles_invalid_count_++;
     response->set_status(false);
     response->set_info("error perception obstacle size == 0");
     AERROR << "SendPerceptionObstacles request has no perception obstacle";
     return Status::CANCELLED;
   }
   if (!request->has_header()) {
+    obstacles_invalid_count_++;
     response->set_status(false);
     response->set_info("error no header in PerceptionObstacles request");
     AERROR << "SendPerceptionObstacles request has no header";
@@ -56,6 +62,11 @@ grpc::Status GrpcServerImpl::SendPerceptionObstacles(
     std::lock_guard<std::mutex> guard(obstacles_mutex_);
     latest_obstacles_.CopyFrom(*request);
   }
+  obstacles_recv_count_++;
+  AINFO_EVERY(kIntakeStatsLogInterval)
+      << "v2x intake stats: obstacles received "
+      << obstacles_recv_count_.load() << ", invalid "
+      << obstacles_invalid_count_.load();
   response->set_status(true);
   ADEBUG << "SendPerceptionObstacles response success.";
   return Status::OK;
@@ -66,12 +77,14 @@ grpc::Status GrpcServerImpl::SendV2xTrafficLight(
     const IntersectionTrafficLightData* request, StatusResponse* response) {
   ADEBUG << "Received SendV2xTrafficLight request from client! \n";
   if (request->current_lane_trafficlight().single_traffic_light().empty()) {
+    trafficlight_invalid_count_++;
     response->set_status(false);
     response->set_info("error v2x traffic light size == 0");
     AERROR << "SendV2xTrafficLight request has no traffic light";
     return Status::CANCELLED;
   }
   if (!request->has_header()) {
+    trafficlight_invalid_count_++;
     response->set_status(false);
     response->set_info(
         "error no header in IntersectionTrafficLightData request");
@@ -82,6 +95,11 @@ grpc::Status GrpcServerImpl::SendV2xTrafficLight(
     std::lock_guard<std::mutex> guard(traffic_light_mutex_);
     latest_trafficlight_.CopyFrom(*request);
   }
+  trafficlight_recv_count_++;
+  AINFO_EVERY(kIntakeStatsLogInterval)
+      << "v2x intake stats: traffic lights received "
+      << trafficlight_recv_count_.load() << ", invalid "
+      << trafficlight_invalid_count_.load();
   if (first_recv_flag_) {
     auto msg = std::make_shared<StatusResponse>();
     msg->set_status(true);
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 #include "cyber/cyber.h"
@@ -63,7 +64,19 @@ class GrpcServerImpl final : public ObuToCar::Service {
       const std::shared_ptr<apollo::perception::PerceptionObstacles>& ptr);
   void GetMsgFromGrpc(const std::shared_ptr<IntersectionTrafficLightData>& ptr);
 
+  /* function that return the number of valid traffic light messages received,
+  so that consumers can tell whether a new message arrived since last poll
+  */
+  uint64_t TrafficLightRecvCount() const {
+    return trafficlight_recv_count_.load();
+  }
+
  private:
+  // Per-type intake counters for monitoring OBU traffic.
+  std::atomic<uint64_t> obstacles_recv_count_{0};
+  std::atomic<uint64_t> obstacles_invalid_count_{0};
+  std::atomic<uint64_t> trafficlight_recv_count_{0};
+  std::atomic<uint64_t> trafficlight_invalid_count_{0};
   std::mutex traffic_light_mutex_;
   std::mutex obstacles_mutex_;
   apollo::perception::PerceptionObstacles latest_obstacles_;
@@ -72,6 +72,12 @@ class ObuInterFaceGrpcImpl : public ObuInterFaceBase {
    */
   bool InitFlag() { return init_succ_; }
 
+  /* function that return the number of valid traffic light messages received
+   */
+  uint64_t TrafficLightRecvCount() const {
+    return grpc_server_->TrafficLightRecvCount();
+  }
+
  private:
   /* thread function that run server
    */